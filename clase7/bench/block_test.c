@@ -0,0 +1,389 @@
+/**
+ * @file block_test.c
+ * @brief Test de host: recepción por bloques (Block1) del servidor CoAP
+ *
+ * Llama a coapServerReceiveBody() con peticiones formateadas a mano, sin
+ * sockets, y comprueba:
+ * - Una subida completa: 2.31 por bloque intermedio, cuerpo entero en orden.
+ * - Dos subidas intercaladas de clientes distintos, cada una con su estado.
+ * - Un bloque que sigue en el callback (en otra tarea) reserva la
+ *   transferencia: su retransmisión recibe 5.03 y coapServerBlockTick() no
+ *   la libera aunque venza COAP_SERVER_BLOCK_TIMEOUT.
+ * - Un error del callback (5.00) y un cuerpo demasiado grande (4.13)
+ *   liberan la transferencia.
+ *
+ * El Makefile lo compila con COAP_SERVER_BLOCK_TIMEOUT = 1000 ms.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "core/net.h"
+#include "coap/coap_server.h"
+#include "coap/coap_server_block.h"
+
+/* Tamaño de bloque: SZX 2, 64 bytes */
+#define TEST_SZX 2
+#define TEST_BLOCK_SIZE 64
+
+/* Estado de una subida, el param del callback */
+typedef struct
+{
+  size_t size;
+  uint32_t hash;
+  uint_t calls;
+  bool_t fail;          /* El callback devuelve un error */
+  OsSemaphore *entered; /* Se libera al entrar en el callback */
+  OsSemaphore *resume;  /* El callback espera a este semáforo */
+} TestUpload;
+
+/* Petición procesada en otra tarea */
+typedef struct
+{
+  CoapServerExchange *exchange;
+  TestUpload *upload;
+  OsSemaphore done;
+  error_t error;
+  bool_t complete;
+} TestWorker;
+
+static CoapServerContext s_context;
+static int s_failures;
+
+/* ========================================================================== */
+/*                       STUBS DEL RESTO DEL SERVIDOR                         */
+/* ========================================================================== */
+
+uint32_t coapServerHashPath(const char_t *path)
+{
+  uint32_t h = 2166136261UL;
+
+  while (*path != '\0')
+  {
+    h ^= (uint8_t)*path++;
+    h *= 16777619UL;
+  }
+  return h;
+}
+
+bool_t ipCompAddr(const IpAddr *ipAddr1, const IpAddr *ipAddr2)
+{
+  return memcmp(ipAddr1, ipAddr2, sizeof(IpAddr)) == 0;
+}
+
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+/* Solo se llama para intercambios TCP */
+size_t coapServerGetMaxTcpBodySize(CoapServerExchange *exchange)
+{
+  return 0;
+}
+#endif
+
+/* ========================================================================== */
+/*                                 UTILIDADES                                 */
+/* ========================================================================== */
+
+static void check(bool_t condition, const char *what)
+{
+  if (!condition)
+  {
+    printf("FALLO: %s\n", what);
+    s_failures++;
+  }
+}
+
+static uint32_t fnv1a(uint32_t h, const uint8_t *data, size_t length)
+{
+  for (size_t i = 0; i < length; i++)
+  {
+    h ^= data[i];
+    h *= 16777619UL;
+  }
+  return h;
+}
+
+/* Byte i del cuerpo de prueba de un cliente */
+static uint8_t body_byte(uint16_t port, size_t i)
+{
+  return (uint8_t)(port + i * 7);
+}
+
+/**
+ * @brief Prepara un intercambio con el bloque num de una subida
+ * @param[in] length Longitud del bloque (menor que el tamaño en el último)
+ */
+static void make_block(CoapServerExchange *exchange, uint16_t port,
+                       uint32_t num, bool_t more, size_t length)
+{
+  CoapMessageHeader *request;
+  CoapMessageHeader *response;
+  uint8_t data[TEST_BLOCK_SIZE];
+  uint32_t value = 0;
+
+  memset(exchange, 0, sizeof(CoapServerExchange));
+  exchange->context = &s_context;
+  exchange->clientIpAddr.length = sizeof(Ipv4Addr);
+  exchange->clientIpAddr.ipv4Addr = IPV4_ADDR(192, 168, 1, 20);
+  exchange->clientPort = port;
+  strcpy(exchange->uri, "/upload");
+
+  for (size_t i = 0; i < length; i++)
+    data[i] = body_byte(port, num * TEST_BLOCK_SIZE + i);
+
+  request = (CoapMessageHeader *)exchange->request.buffer;
+  request->version = COAP_VERSION_1;
+  request->type = COAP_TYPE_CON;
+  request->tokenLen = 0;
+  request->code = COAP_CODE_PUT;
+  request->mid = htons(port + num);
+  exchange->request.length = sizeof(CoapMessageHeader);
+
+  COAP_SET_BLOCK_NUM(value, num);
+  COAP_SET_BLOCK_M(value, more);
+  COAP_SET_BLOCK_SZX(value, TEST_SZX);
+  coapSetUintOption(&exchange->request, COAP_OPT_BLOCK1, 0, value);
+  coapSetPayload(&exchange->request, data, length);
+  exchange->request.buffer[exchange->request.length] = '\0';
+  coapParseMessageEx(&exchange->request, &exchange->requestIndex);
+
+  // Igual que coapServerInitResponse()
+  response = (CoapMessageHeader *)exchange->response.buffer;
+  response->version = COAP_VERSION_1;
+  response->type = COAP_TYPE_ACK;
+  response->tokenLen = 0;
+  response->code = COAP_CODE_INTERNAL_SERVER;
+  response->mid = request->mid;
+  exchange->response.length = sizeof(CoapMessageHeader);
+  coapInitOptionWriter(&exchange->responseWriter, &exchange->response);
+}
+
+static CoapCode response_code(CoapServerExchange *exchange)
+{
+  CoapCode code;
+
+  coapGetCode(&exchange->response, &code);
+  return code;
+}
+
+/* ========================================================================== */
+/*                                  CALLBACK                                  */
+/* ========================================================================== */
+
+static error_t upload_write(void *param, size_t offset, const uint8_t *data,
+                            size_t length, bool_t last)
+{
+  TestUpload *upload = (TestUpload *)param;
+  OsSemaphore *resume = upload->resume;
+
+  // resume se lee antes de avisar: el test lo borra en cuanto entramos
+  if (upload->entered != NULL)
+    osReleaseSemaphore(upload->entered);
+  if (resume != NULL)
+    osWaitForSemaphore(resume, INFINITE_DELAY);
+
+  if (upload->fail)
+    return ERROR_FAILURE;
+
+  if (offset == 0)
+  {
+    upload->size = 0;
+    upload->hash = 2166136261UL;
+  }
+  upload->hash = fnv1a(upload->hash, data, length);
+  upload->size += length;
+  upload->calls++;
+  return NO_ERROR;
+}
+
+static void worker_task(void *param)
+{
+  TestWorker *worker = (TestWorker *)param;
+
+  worker->error = coapServerReceiveBody(worker->exchange, upload_write,
+                                        worker->upload, 0, &worker->complete);
+  osReleaseSemaphore(&worker->done);
+  osDeleteTask(OS_SELF_TASK_ID);
+}
+
+/**
+ * @brief Envía un bloque y devuelve el código de respuesta
+ */
+static CoapCode send_block(TestUpload *upload, uint16_t port, uint32_t num,
+                           bool_t more, size_t length, size_t maxSize,
+                           bool_t *complete)
+{
+  static CoapServerExchange exchange;
+  bool_t done = FALSE;
+
+  make_block(&exchange, port, num, more, length);
+  if (coapServerReceiveBody(&exchange, upload_write, upload, maxSize, &done))
+    return COAP_CODE_EMPTY;
+
+  if (complete != NULL)
+    *complete = done;
+
+  return done ? COAP_CODE_CHANGED : response_code(&exchange);
+}
+
+/* Hash esperado del cuerpo de un cliente */
+static uint32_t expected_hash(uint16_t port, size_t length)
+{
+  uint32_t h = 2166136261UL;
+
+  for (size_t i = 0; i < length; i++)
+  {
+    uint8_t b = body_byte(port, i);
+    h = fnv1a(h, &b, 1);
+  }
+  return h;
+}
+
+/* ========================================================================== */
+/*                                 ESCENARIOS                                 */
+/* ========================================================================== */
+
+/* Subida de 3 bloques y medio de un cliente */
+static void test_sequential(void)
+{
+  TestUpload upload = {0};
+  bool_t complete = FALSE;
+
+  check(send_block(&upload, 1000, 0, TRUE, 64, 0, NULL) == COAP_CODE_CONTINUE,
+        "bloque 0: 2.31");
+  check(send_block(&upload, 1000, 1, TRUE, 64, 0, NULL) == COAP_CODE_CONTINUE,
+        "bloque 1: 2.31");
+  check(send_block(&upload, 1000, 2, TRUE, 64, 0, NULL) == COAP_CODE_CONTINUE,
+        "bloque 2: 2.31");
+  send_block(&upload, 1000, 3, FALSE, 10, 0, &complete);
+
+  check(complete, "último bloque: cuerpo completo");
+  check(upload.size == 202 && upload.hash == expected_hash(1000, 202),
+        "subida secuencial: cuerpo íntegro");
+
+  // Terminada: un bloque intermedio ya no pertenece a ninguna subida
+  check(send_block(&upload, 1000, 2, TRUE, 64, 0, NULL) ==
+            COAP_CODE_REQUEST_ENTITY_INCOMPLETE,
+        "bloque tras el final: 4.08");
+}
+
+/* Dos subidas intercaladas, cada una con su estado */
+static void test_interleaved(void)
+{
+  TestUpload a = {0};
+  TestUpload b = {0};
+  bool_t completeA = FALSE;
+  bool_t completeB = FALSE;
+
+  send_block(&a, 2000, 0, TRUE, 64, 0, NULL);
+  send_block(&b, 3000, 0, TRUE, 64, 0, NULL);
+  send_block(&a, 2000, 1, TRUE, 64, 0, NULL);
+  send_block(&b, 3000, 1, FALSE, 20, 0, &completeB);
+  send_block(&a, 2000, 2, FALSE, 30, 0, &completeA);
+
+  check(completeA && a.size == 158 && a.hash == expected_hash(2000, 158),
+        "subidas intercaladas: cuerpo del cliente A");
+  check(completeB && b.size == 84 && b.hash == expected_hash(3000, 84),
+        "subidas intercaladas: cuerpo del cliente B");
+}
+
+/* Un bloque en proceso reserva la transferencia */
+static void test_busy(void)
+{
+  static CoapServerExchange exchange;
+  OsSemaphore entered;
+  OsSemaphore resume;
+  TestUpload upload = {0};
+  TestWorker worker = {0};
+  bool_t complete = FALSE;
+
+  osCreateSemaphore(&entered, 0);
+  osCreateSemaphore(&resume, 0);
+  osCreateSemaphore(&worker.done, 0);
+
+  send_block(&upload, 4000, 0, TRUE, 64, 0, NULL);
+
+  // El bloque 1 se queda dentro del callback en otra tarea
+  upload.entered = &entered;
+  upload.resume = &resume;
+  make_block(&exchange, 4000, 1, TRUE, 64);
+  worker.exchange = &exchange;
+  worker.upload = &upload;
+  osCreateTask("Worker", worker_task, &worker, &OS_TASK_DEFAULT_PARAMS);
+  osWaitForSemaphore(&entered, INFINITE_DELAY);
+  upload.entered = NULL;
+  upload.resume = NULL;
+
+  // La retransmisión del mismo bloque no entra en el callback
+  check(send_block(&upload, 4000, 1, TRUE, 64, 0, NULL) ==
+            COAP_CODE_SERVICE_UNAVAILABLE,
+        "bloque en proceso: la retransmisión recibe 5.03");
+  check(upload.calls == 1, "bloque en proceso: el callback no se repite");
+
+  // Vence el plazo de la transferencia mientras el bloque sigue en proceso
+  osDelayTask(COAP_SERVER_BLOCK_TIMEOUT + 200);
+  osAcquireMutex(&s_context.mutex);
+  coapServerBlockTick(&s_context);
+  osReleaseMutex(&s_context.mutex);
+
+  osReleaseSemaphore(&resume);
+  osWaitForSemaphore(&worker.done, INFINITE_DELAY);
+  check(!worker.error && response_code(&exchange) == COAP_CODE_CONTINUE,
+        "bloque en proceso: 2.31 al terminar");
+
+  // La transferencia sigue viva y espera el bloque 2
+  send_block(&upload, 4000, 2, FALSE, 5, 0, &complete);
+  check(complete && upload.size == 133 &&
+            upload.hash == expected_hash(4000, 133),
+        "bloque en proceso: el plazo no libera la transferencia");
+
+  osDeleteSemaphore(&entered);
+  osDeleteSemaphore(&resume);
+  osDeleteSemaphore(&worker.done);
+}
+
+/* Error del callback y cuerpo demasiado grande */
+static void test_abort(void)
+{
+  TestUpload upload = {0};
+
+  send_block(&upload, 5000, 0, TRUE, 64, 0, NULL);
+  upload.fail = TRUE;
+  check(send_block(&upload, 5000, 1, TRUE, 64, 0, NULL) ==
+            COAP_CODE_INTERNAL_SERVER,
+        "error del callback: 5.00");
+  upload.fail = FALSE;
+  check(send_block(&upload, 5000, 2, TRUE, 64, 0, NULL) ==
+            COAP_CODE_REQUEST_ENTITY_INCOMPLETE,
+        "error del callback: transferencia liberada (4.08)");
+
+  send_block(&upload, 6000, 0, TRUE, 64, 100, NULL);
+  check(send_block(&upload, 6000, 1, TRUE, 64, 100, NULL) ==
+            COAP_CODE_REQUEST_ENTITY_TO_LARGE,
+        "cuerpo demasiado grande: 4.13");
+  check(send_block(&upload, 6000, 2, TRUE, 64, 0, NULL) ==
+            COAP_CODE_REQUEST_ENTITY_INCOMPLETE,
+        "cuerpo demasiado grande: transferencia liberada (4.08)");
+
+  // Ninguna entrada queda ocupada
+  for (uint_t i = 0; i < COAP_SERVER_MAX_BLOCK_TRANSFERS; i++)
+    check(!s_context.blockTransfers[i].active, "tabla de transferencias vacía");
+}
+
+int main(void)
+{
+  osCreateMutex(&s_context.mutex);
+
+  test_sequential();
+  test_interleaved();
+  test_busy();
+  test_abort();
+
+  if (s_failures)
+  {
+    printf("Block1: %d comprobaciones fallidas\n", s_failures);
+    return 1;
+  }
+
+  printf("Block1: subida secuencial, intercalada, bloque en proceso y "
+         "abortos correctos\n");
+  return 0;
+}
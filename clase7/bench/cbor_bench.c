@@ -0,0 +1,192 @@
+/**
+ * @file cbor_bench.c
+ * @brief Benchmark de host: documento /info en CBOR frente a JSON
+ *
+ * Codifica el mismo objeto que render_info() en main.cpp (uptime_s,
+ * free_heap y chip) con CborWriter y con JsonWriter, y decodifica el cuerpo
+ * de PUT /led ({"state": "on"}) en CBOR con cborFindMapKey() y en JSON con
+ * ArduinoJson, como parse_led_state().
+ *
+ * ArduinoJson no forma parte del repositorio (ESP-IDF lo descarga en
+ * managed_components/). Sin él, el Makefile compila el benchmark sin
+ * BENCH_ARDUINOJSON y la decodificación JSON no se mide.
+ *
+ * Antes de medir comprueba que ambas codificaciones producen los bytes
+ * esperados.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "cbor.h"
+#include "json_writer.h"
+
+/* Iteraciones de cada bucle medido */
+#define BENCH_ITERATIONS 1000000
+
+/* Salida de los writers: buffer en memoria */
+typedef struct
+{
+  uint8_t data[128];
+  size_t length;
+} BenchBuffer;
+
+/* {"uptime_s": 123456, "free_heap": 234567, "chip": "ESP32"} */
+static const uint8_t s_info_cbor[] = {
+    0xA3, 0x68, 'u',  'p',  't',  'i',  'm',  'e',  '_',  's',  0x1A,
+    0x00, 0x01, 0xE2, 0x40, 0x69, 'f',  'r',  'e',  'e',  '_',  'h',
+    'e',  'a',  'p',  0x1A, 0x00, 0x03, 0x94, 0x47, 0x64, 'c',  'h',
+    'i',  'p',  0x65, 'E',  'S',  'P',  '3',  '2'};
+static const char s_info_json[] =
+    "{\"uptime_s\":123456,\"free_heap\":234567,\"chip\":\"ESP32\"}";
+
+/* Cuerpo CBOR de PUT /led: {"state": "on"} */
+static const uint8_t s_led_cbor[] = {0xA1, 0x65, 's', 't', 'a',
+                                     't',  'e',  0x62, 'o', 'n'};
+/* El mismo cuerpo en JSON */
+static const char s_led_json[] = "{\"state\":\"on\"}";
+
+#ifdef BENCH_ARDUINOJSON
+/* json_decode.cpp */
+int json_decode_led_state(const char *payload, size_t length);
+#endif
+
+static error_t buffer_output(void *param, const void *data, size_t length)
+{
+  BenchBuffer *buffer = (BenchBuffer *)param;
+
+  if (buffer->length + length > sizeof(buffer->data))
+    return ERROR_BUFFER_OVERFLOW;
+
+  memcpy(buffer->data + buffer->length, data, length);
+  buffer->length += length;
+  return NO_ERROR;
+}
+
+/**
+ * @brief Tiempo monotónico en nanosegundos.
+ */
+static double now_ns(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static error_t encode_info_cbor(BenchBuffer *buffer, uint32_t uptime_s)
+{
+  CborWriter writer;
+
+  buffer->length = 0;
+  cborWriterInit(&writer, buffer_output, buffer);
+  cborWriterBeginMap(&writer, 3);
+  cborWriterUintMember(&writer, "uptime_s", uptime_s);
+  cborWriterUintMember(&writer, "free_heap", 234567);
+  cborWriterStringMember(&writer, "chip", "ESP32");
+  return cborWriterFlush(&writer);
+}
+
+static error_t encode_info_json(BenchBuffer *buffer, uint32_t uptime_s)
+{
+  JsonWriter writer;
+
+  buffer->length = 0;
+  jsonWriterInit(&writer, buffer_output, buffer);
+  jsonWriterBeginObject(&writer);
+  jsonWriterUintMember(&writer, "uptime_s", uptime_s);
+  jsonWriterUintMember(&writer, "free_heap", 234567);
+  jsonWriterStringMember(&writer, "chip", "ESP32");
+  jsonWriterEndObject(&writer);
+  return jsonWriterFlush(&writer);
+}
+
+int main(void)
+{
+  BenchBuffer buffer;
+  CborReader reader;
+  CborItem item;
+  volatile size_t sink = 0;
+  double t0, cbor_ns, json_ns;
+  int i;
+
+  // Comprobación de los bytes generados
+  if (encode_info_cbor(&buffer, 123456) ||
+      buffer.length != sizeof(s_info_cbor) ||
+      memcmp(buffer.data, s_info_cbor, sizeof(s_info_cbor)) != 0)
+  {
+    printf("CBOR de /info incorrecto\n");
+    return 1;
+  }
+
+  if (encode_info_json(&buffer, 123456) ||
+      buffer.length != strlen(s_info_json) ||
+      memcmp(buffer.data, s_info_json, buffer.length) != 0)
+  {
+    printf("JSON de /info incorrecto\n");
+    return 1;
+  }
+
+  cborReaderInit(&reader, s_led_cbor, sizeof(s_led_cbor));
+  if (cborFindMapKey(&reader, "state", &item) ||
+      !cborCompareText(&item, "on"))
+  {
+    printf("Decodificación de /led incorrecta\n");
+    return 1;
+  }
+
+#ifdef BENCH_ARDUINOJSON
+  if (json_decode_led_state(s_led_json, strlen(s_led_json)) != 1)
+  {
+    printf("Decodificación JSON de /led incorrecta\n");
+    return 1;
+  }
+#endif
+
+  printf("Tamaño de /info: CBOR %u bytes, JSON %u bytes\n",
+         (unsigned)sizeof(s_info_cbor), (unsigned)strlen(s_info_json));
+
+  t0 = now_ns();
+  for (i = 0; i < BENCH_ITERATIONS; i++)
+  {
+    encode_info_cbor(&buffer, (uint32_t)i);
+    sink += buffer.length;
+  }
+  cbor_ns = (now_ns() - t0) / BENCH_ITERATIONS;
+
+  t0 = now_ns();
+  for (i = 0; i < BENCH_ITERATIONS; i++)
+  {
+    encode_info_json(&buffer, (uint32_t)i);
+    sink += buffer.length;
+  }
+  json_ns = (now_ns() - t0) / BENCH_ITERATIONS;
+
+  printf("Codificación de /info: CBOR %.0f ns, JSON %.0f ns\n", cbor_ns,
+         json_ns);
+
+  t0 = now_ns();
+  for (i = 0; i < BENCH_ITERATIONS; i++)
+  {
+    cborReaderInit(&reader, s_led_cbor, sizeof(s_led_cbor));
+    if (!cborFindMapKey(&reader, "state", &item))
+      sink += cborCompareText(&item, "on");
+  }
+  cbor_ns = (now_ns() - t0) / BENCH_ITERATIONS;
+
+#ifdef BENCH_ARDUINOJSON
+  t0 = now_ns();
+  for (i = 0; i < BENCH_ITERATIONS; i++)
+    sink += json_decode_led_state(s_led_json, strlen(s_led_json));
+  json_ns = (now_ns() - t0) / BENCH_ITERATIONS;
+
+  printf("Decodificación de %s: CBOR %.0f ns, JSON (ArduinoJson) %.0f ns\n",
+         s_led_json, cbor_ns, json_ns);
+#else
+  printf("Decodificación de %s: CBOR %.0f ns, JSON no medido (falta "
+         "ArduinoJson, ver ARDUINOJSON_DIR en el Makefile)\n",
+         s_led_json, cbor_ns);
+#endif
+
+  return 0;
+}
@@ -0,0 +1,304 @@
+/**
+ * @file client_test.c
+ * @brief Test de host: peticiones en vuelo del cliente CoAP (NSTART)
+ *
+ * Usa coap_client*.c con el transporte UDP sustituido por stubs: el envío
+ * guarda los datagramas y la recepción entrega las respuestas que el test
+ * prepara. Con COAP_CLIENT_NSTART = 2 y COAP_CLIENT_MAX_REQUESTS = 4
+ * (valores por defecto de Kconfig) comprueba:
+ * - Las cuatro peticiones asíncronas caben en la tabla y una quinta no.
+ * - Solo salen NSTART; las demás esperan en la tabla (RFC 7252, sección 4.7).
+ * - Una retransmisión sigue contando como interacción en vuelo y no deja
+ *   salir a la siguiente.
+ * - Cada respuesta libera un hueco y la petición siguiente sale en el mismo
+ *   coapClientTask(); al final los cuatro callbacks informan de éxito.
+ *
+ * Los plazos se adelantan retrasando las marcas de tiempo, sin esperar.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "core/net.h"
+#include "coap/coap_client.h"
+#include "coap/coap_client_misc.h"
+#include "coap/coap_client_transport.h"
+#include "coap/coap_debug.h"
+
+/* Peticiones lanzadas a la vez, tantas como admite la tabla */
+#define TEST_REQUESTS COAP_CLIENT_MAX_REQUESTS
+/* Datagramas enviados que se guardan */
+#define TEST_MAX_SENT 16
+
+/* Datagrama enviado por el cliente */
+typedef struct
+{
+  uint8_t data[COAP_MAX_MSG_SIZE];
+  size_t length;
+} TestDatagram;
+
+static CoapClientContext s_context;
+static TestDatagram s_sent[TEST_MAX_SENT];
+static uint_t s_sent_count;
+static TestDatagram s_rx;          /* Respuesta pendiente de recibir */
+static bool_t s_rx_ready;
+static uint_t s_done[TEST_REQUESTS]; /* Callbacks con éxito por petición */
+static uint_t s_errors;            /* Callbacks con otro estado */
+static int s_failures;
+
+/* ========================================================================== */
+/*                        STUBS DEL TRANSPORTE UDP                            */
+/* ========================================================================== */
+
+error_t coapClientOpenConnection(CoapClientContext *context)
+{
+  return NO_ERROR;
+}
+
+error_t coapClientEstablishConnection(CoapClientContext *context,
+                                      const IpAddr *serverIpAddr,
+                                      uint16_t serverPort)
+{
+  return NO_ERROR;
+}
+
+error_t coapClientShutdownConnection(CoapClientContext *context)
+{
+  return NO_ERROR;
+}
+
+void coapClientCloseConnection(CoapClientContext *context)
+{
+}
+
+error_t coapClientSendDatagram(CoapClientContext *context, const void *data,
+                               size_t length)
+{
+  if (s_sent_count < TEST_MAX_SENT)
+  {
+    memcpy(s_sent[s_sent_count].data, data, length);
+    s_sent[s_sent_count].length = length;
+  }
+  s_sent_count++;
+  return NO_ERROR;
+}
+
+error_t coapClientReceiveDatagram(CoapClientContext *context, void *data,
+                                  size_t size, size_t *received)
+{
+  if (!s_rx_ready || s_rx.length > size)
+    return ERROR_WOULD_BLOCK;
+
+  memcpy(data, s_rx.data, s_rx.length);
+  *received = s_rx.length;
+  s_rx_ready = FALSE;
+  return NO_ERROR;
+}
+
+/* Nunca espera: el test prepara la respuesta antes de coapClientTask() */
+error_t coapClientWaitForDatagram(CoapClientContext *context,
+                                  systime_t timeout)
+{
+  return NO_ERROR;
+}
+
+error_t coapDumpMessage(const void *message, size_t length)
+{
+  return NO_ERROR;
+}
+
+uint32_t netGetRand(void)
+{
+  return 0x1234;
+}
+
+uint32_t netGetRandRange(uint32_t min, uint32_t max)
+{
+  return max;
+}
+
+/* Tokens distintos para cada petición */
+void netGetRandData(uint8_t *data, size_t length)
+{
+  static uint8_t seed;
+
+  while (length-- > 0)
+    *data++ = ++seed;
+}
+
+/* ========================================================================== */
+/*                                  TEST                                      */
+/* ========================================================================== */
+
+static void check(bool_t condition, const char *what)
+{
+  if (!condition)
+  {
+    printf("FALLO: %s\n", what);
+    s_failures++;
+  }
+}
+
+static error_t request_callback(CoapClientContext *context,
+                                CoapClientRequest *request,
+                                CoapRequestStatus status, void *param)
+{
+  if (status == COAP_REQUEST_STATUS_SUCCESS)
+    s_done[(uintptr_t)param]++;
+  else
+    s_errors++;
+
+  return NO_ERROR;
+}
+
+/**
+ * @brief Prepara un ACK 2.05 con el mismo MID y token que un datagrama
+ *        enviado (respuesta piggybacked)
+ */
+static void answer(uint_t sent)
+{
+  CoapMessageHeader *header;
+  size_t length;
+
+  header = (CoapMessageHeader *)s_sent[sent].data;
+  length = sizeof(CoapMessageHeader) + header->tokenLen;
+
+  memcpy(s_rx.data, s_sent[sent].data, length);
+  header = (CoapMessageHeader *)s_rx.data;
+  header->type = COAP_TYPE_ACK;
+  header->code = COAP_CODE_CONTENT;
+  s_rx.length = length;
+  s_rx_ready = TRUE;
+}
+
+/* Índice de la petición (parámetro del callback) de un datagrama enviado */
+static uint_t sent_request(uint_t sent)
+{
+  const CoapMessageHeader *header = (const CoapMessageHeader *)s_sent[sent].data;
+
+  for (uint_t i = 0; i < COAP_CLIENT_MAX_REQUESTS; i++)
+  {
+    const CoapMessageHeader *request =
+        (const CoapMessageHeader *)s_context.request[i].message.buffer;
+
+    if (request->mid == header->mid)
+      return (uintptr_t)s_context.request[i].param;
+  }
+
+  return TEST_REQUESTS;
+}
+
+static void test_nstart(void)
+{
+  CoapClientRequest *request;
+  CoapClientRequest *first;
+  IpAddr serverIpAddr;
+  uint_t total;
+  uint_t i;
+
+  memset(&serverIpAddr, 0, sizeof(serverIpAddr));
+  serverIpAddr.length = sizeof(Ipv4Addr);
+
+  check(coapClientInit(&s_context) == NO_ERROR &&
+            coapClientConnect(&s_context, &serverIpAddr, 5683) == NO_ERROR,
+        "cliente: conexión");
+
+  // Todas las peticiones se envían sin esperar respuesta
+  for (i = 0; i < TEST_REQUESTS; i++)
+  {
+    request = coapClientCreateRequest(&s_context);
+    check(request != NULL, "cliente: hueco libre en la tabla");
+    if (request == NULL)
+      return;
+
+    check(coapClientSendRequest(request, request_callback,
+                                (void *)(uintptr_t)i) == NO_ERROR,
+          "cliente: petición asíncrona aceptada");
+  }
+
+  check(coapClientCreateRequest(&s_context) == NULL,
+        "cliente: la tabla admite COAP_CLIENT_MAX_REQUESTS peticiones");
+
+  // Solo NSTART salen; el resto espera en la tabla
+  coapClientTask(&s_context, 0);
+  check(s_sent_count == COAP_CLIENT_NSTART,
+        "cliente: solo NSTART peticiones en vuelo");
+  coapClientTask(&s_context, 0);
+  check(s_sent_count == COAP_CLIENT_NSTART,
+        "cliente: las demás siguen retenidas");
+  check(coapClientGetOutstandingCount(&s_context) == COAP_CLIENT_NSTART,
+        "cliente: interacciones en vuelo");
+
+  // Vence el plazo de retransmisión de la primera
+  first = NULL;
+  for (i = 0; i < COAP_CLIENT_MAX_REQUESTS && first == NULL; i++)
+  {
+    if (s_context.request[i].state == COAP_REQ_STATE_RECEIVE &&
+        sent_request(0) == (uintptr_t)s_context.request[i].param)
+      first = &s_context.request[i];
+  }
+  check(first != NULL, "cliente: primera petición esperando respuesta");
+  if (first == NULL)
+    return;
+
+  first->retransmitStartTime -= first->retransmitTimeout;
+  coapClientTask(&s_context, 0);
+  coapClientTask(&s_context, 0);
+  check(s_sent_count == COAP_CLIENT_NSTART + 1 &&
+            memcmp(s_sent[COAP_CLIENT_NSTART].data, s_sent[0].data,
+                   s_sent[0].length) == 0,
+        "cliente: retransmisión con el mismo MID");
+  check(coapClientGetOutstandingCount(&s_context) == COAP_CLIENT_NSTART,
+        "cliente: la retransmisión sigue en vuelo y no deja salir otra");
+
+  // Cada respuesta deja salir la siguiente petición en el mismo tick
+  total = s_sent_count;
+  answer(0);
+  coapClientTask(&s_context, 0);
+  check(s_done[sent_request(0)] == 1,
+        "cliente: callback de la primera respuesta");
+  check(s_sent_count == total + 1,
+        "cliente: la tercera petición sale al liberarse un hueco");
+  check(coapClientGetOutstandingCount(&s_context) == COAP_CLIENT_NSTART,
+        "cliente: de nuevo NSTART en vuelo");
+
+  // Responder el resto en el orden de envío, salvo la retransmisión
+  for (i = 1; i < s_sent_count && i < TEST_MAX_SENT; i++)
+  {
+    if (i == total - 1)
+      continue;
+
+    answer(i);
+    coapClientTask(&s_context, 0);
+    check(coapClientGetOutstandingCount(&s_context) <= COAP_CLIENT_NSTART,
+          "cliente: nunca más de NSTART en vuelo");
+  }
+
+  for (i = 0; i < TEST_REQUESTS; i++)
+    check(s_done[i] == 1, "cliente: cada callback informa de éxito una vez");
+  check(s_errors == 0, "cliente: ningún callback con error");
+  check(s_sent_count == TEST_REQUESTS + 1,
+        "cliente: una transmisión por petición más la retransmisión");
+
+  for (i = 0; i < COAP_CLIENT_MAX_REQUESTS; i++)
+    check(s_context.request[i].state == COAP_REQ_STATE_UNUSED,
+          "cliente: las peticiones asíncronas se liberan solas");
+
+  coapClientDisconnect(&s_context);
+  coapClientDeinit(&s_context);
+}
+
+int main(void)
+{
+  test_nstart();
+
+  if (s_failures)
+  {
+    printf("Cliente: %d comprobaciones fallidas\n", s_failures);
+    return 1;
+  }
+
+  printf("Cliente: %u peticiones con NSTART = %u, retransmisión y "
+         "respuestas correctas\n",
+         (unsigned)TEST_REQUESTS, (unsigned)COAP_CLIENT_NSTART);
+  return 0;
+}
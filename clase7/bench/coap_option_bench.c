@@ -0,0 +1,266 @@
+/**
+ * @file coap_option_bench.c
+ * @brief Benchmark de host: índice de opciones CoAP frente a búsqueda lineal
+ *
+ * Mide las dos rutas que conviven en coap_option.c:
+ * - Análisis de una petición con 7 opciones y 4 consultas (Content-Format,
+ *   Block2, Observe y Uri-Path), con coapParseMessage() + coapGetXxxOption()
+ *   frente a coapParseMessageEx() + coapGetIndexedXxxOption().
+ * - Formato de 5 opciones de respuesta, con coapSetUintOption() frente a
+ *   CoapOptionWriter.
+ *
+ * Antes de medir comprueba, con mensajes aleatorios, que ambas rutas dan el
+ * mismo resultado.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "coap/coap_message.h"
+#include "coap/coap_option.h"
+
+/* Iteraciones de cada bucle medido */
+#define BENCH_ITERATIONS 2000000
+/* Mensajes aleatorios de la comprobación previa */
+#define CHECK_ITERATIONS 20000
+
+/* Números de opción usados en la comprobación (incluye repetibles) */
+static const uint16_t s_option_nums[] = {1,  4,  4,  6,  11,  11,  11,
+                                         12, 14, 15, 15, 17,  23,  27,
+                                         28, 60, 258, 300, 1000};
+
+/**
+ * @brief Cabecera CON GET con token de 2 bytes.
+ */
+static void init_message(CoapMessage *message)
+{
+  memset(message, 0, sizeof(CoapMessage));
+  message->buffer[0] = 0x42;
+  message->buffer[1] = COAP_CODE_GET;
+  message->buffer[4] = 0xAA;
+  message->buffer[5] = 0xBB;
+  message->length = 6;
+}
+
+/**
+ * @brief Tiempo monotónico en nanosegundos.
+ */
+static double now_ns(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+/**
+ * @brief Construye el mismo mensaje con coapSetOption() y con
+ *        coapAppendOption(), y compara búsquedas lineales e indexadas.
+ * @return Número de discrepancias.
+ */
+static int check_equivalence(void)
+{
+  int bad = 0;
+  int it;
+
+  srand(1);
+
+  for (it = 0; it < CHECK_ITERATIONS; it++)
+  {
+    CoapMessage a, b;
+    CoapOptionWriter writer;
+    CoapOptionIndex index;
+    int count[1001] = {0};
+    int n = rand() % 20;
+    int i, k;
+    uint16_t num;
+    char s1[600], s2[600];
+    error_t e1, e2;
+
+    init_message(&a);
+    init_message(&b);
+    coapInitOptionWriter(&writer, &b);
+
+    for (i = 0; i < n; i++)
+    {
+      uint8_t value[300];
+      int index_in = 0;
+      int len;
+
+      // A veces se repite o se inserta desordenado para forzar el fallback
+      num = s_option_nums[rand() % arraysize(s_option_nums)];
+      if (rand() % 4 == 0)
+        num = s_option_nums[rand() % arraysize(s_option_nums)];
+
+      index_in = count[num];
+      if (rand() % 8 == 0 && index_in > 0)
+        index_in = rand() % index_in;
+      else
+        count[num]++;
+
+      len = rand() % (rand() % 10 == 0 ? 300 : 6);
+      for (k = 0; k < len; k++)
+        value[k] = (uint8_t)rand();
+
+      if (a.length + len + 5 >= COAP_MAX_MSG_SIZE)
+        break;
+
+      // Opciones añadidas después del payload
+      if (rand() % 20 == 0)
+      {
+        coapSetPayload(&a, "xy", 2);
+        coapSetPayload(&b, "xy", 2);
+        writer.length = 0;
+      }
+
+      e1 = coapSetOption(&a, num, index_in, value, len);
+      e2 = coapAppendOption(&writer, &b, num, index_in, value, len);
+
+      if (e1 != e2 || a.length != b.length ||
+          memcmp(a.buffer, b.buffer, a.length) != 0)
+      {
+        printf("Formato distinto en el mensaje %d\n", it);
+        bad++;
+        break;
+      }
+    }
+
+    if (coapParseMessageEx(&a, &index))
+    {
+      bad++;
+      continue;
+    }
+
+    for (num = 0; num < 1100; num++)
+    {
+      for (k = 0; k < 5; k++)
+      {
+        const uint8_t *p1, *p2;
+        size_t l1, l2;
+
+        e1 = coapGetOption(&a, num, k, &p1, &l1);
+        e2 = coapGetIndexedOption(&a, &index, num, k, &p2, &l2);
+
+        if (e1 != e2 || (!e1 && (p1 != p2 || l1 != l2)))
+        {
+          printf("Búsqueda distinta: opción %u, índice %d\n", num, k);
+          bad++;
+        }
+      }
+    }
+
+    e1 = coapJoinRepeatableOption(&a, COAP_OPT_URI_PATH, s1, sizeof(s1) - 1,
+                                  '/');
+    e2 = coapJoinIndexedOption(&a, &index, COAP_OPT_URI_PATH, s2,
+                               sizeof(s2) - 1, '/');
+    if (e1 != e2 || strcmp(s1, s2) != 0)
+      bad++;
+  }
+
+  return bad;
+}
+
+int main(void)
+{
+  CoapMessage request;
+  volatile uint32_t sink = 0;
+  char uri[64];
+  uint32_t value;
+  double t0, linear, indexed;
+  int bad;
+  int i;
+
+  bad = check_equivalence();
+  printf("Comprobación: %d discrepancias\n", bad);
+  if (bad)
+    return 1;
+
+  // Petición típica: /sensors/temp?a=1, Accept, Block2, Observe y ETag
+  init_message(&request);
+  coapSetOption(&request, COAP_OPT_URI_PATH, 0, (const uint8_t *)"sensors", 7);
+  coapSetOption(&request, COAP_OPT_URI_PATH, 1, (const uint8_t *)"temp", 4);
+  coapSetOption(&request, COAP_OPT_URI_QUERY, 0, (const uint8_t *)"a=1", 3);
+  coapSetOption(&request, COAP_OPT_ACCEPT, 0, (const uint8_t *)"\x32", 1);
+  coapSetOption(&request, COAP_OPT_BLOCK2, 0, (const uint8_t *)"\x02", 1);
+  coapSetOption(&request, COAP_OPT_OBSERVE, 0, (const uint8_t *)"", 0);
+  coapSetOption(&request, COAP_OPT_ETAG, 0, (const uint8_t *)"abcd", 4);
+
+  t0 = now_ns();
+  for (i = 0; i < BENCH_ITERATIONS; i++)
+  {
+    const uint8_t *payload;
+    size_t length;
+
+    coapParseMessage(&request);
+    coapGetUintOption(&request, COAP_OPT_ACCEPT, 0, &value);
+    sink += value;
+    coapGetUintOption(&request, COAP_OPT_BLOCK2, 0, &value);
+    sink += value;
+    coapGetUintOption(&request, COAP_OPT_OBSERVE, 0, &value);
+    sink += value;
+    coapJoinRepeatableOption(&request, COAP_OPT_URI_PATH, uri, sizeof(uri) - 1,
+                             '/');
+    coapGetPayload(&request, &payload, &length);
+  }
+  linear = (now_ns() - t0) / BENCH_ITERATIONS;
+
+  t0 = now_ns();
+  for (i = 0; i < BENCH_ITERATIONS; i++)
+  {
+    CoapOptionIndex index;
+
+    coapParseMessageEx(&request, &index);
+    coapGetIndexedUintOption(&request, &index, COAP_OPT_ACCEPT, 0, &value);
+    sink += value;
+    coapGetIndexedUintOption(&request, &index, COAP_OPT_BLOCK2, 0, &value);
+    sink += value;
+    coapGetIndexedUintOption(&request, &index, COAP_OPT_OBSERVE, 0, &value);
+    sink += value;
+    coapJoinIndexedOption(&request, &index, COAP_OPT_URI_PATH, uri,
+                          sizeof(uri) - 1, '/');
+  }
+  indexed = (now_ns() - t0) / BENCH_ITERATIONS;
+
+  printf("Análisis + 4 consultas: lineal %.0f ns, indexado %.0f ns\n", linear,
+         indexed);
+
+  // Respuesta: Observe, Content-Format, Max-Age, Block2 y Size2
+  t0 = now_ns();
+  for (i = 0; i < BENCH_ITERATIONS; i++)
+  {
+    CoapMessage response;
+
+    init_message(&response);
+    coapSetUintOption(&response, COAP_OPT_OBSERVE, 0, 5);
+    coapSetUintOption(&response, COAP_OPT_CONTENT_FORMAT, 0, 50);
+    coapSetUintOption(&response, COAP_OPT_MAX_AGE, 0, 60);
+    coapSetUintOption(&response, COAP_OPT_BLOCK2, 0, 0x16);
+    coapSetUintOption(&response, COAP_OPT_SIZE2, 0, 900);
+    sink += response.length;
+  }
+  linear = (now_ns() - t0) / BENCH_ITERATIONS;
+
+  t0 = now_ns();
+  for (i = 0; i < BENCH_ITERATIONS; i++)
+  {
+    CoapMessage response;
+    CoapOptionWriter writer;
+
+    init_message(&response);
+    coapInitOptionWriter(&writer, &response);
+    coapAppendUintOption(&writer, &response, COAP_OPT_OBSERVE, 0, 5);
+    coapAppendUintOption(&writer, &response, COAP_OPT_CONTENT_FORMAT, 0, 50);
+    coapAppendUintOption(&writer, &response, COAP_OPT_MAX_AGE, 0, 60);
+    coapAppendUintOption(&writer, &response, COAP_OPT_BLOCK2, 0, 0x16);
+    coapAppendUintOption(&writer, &response, COAP_OPT_SIZE2, 0, 900);
+    sink += response.length;
+  }
+  indexed = (now_ns() - t0) / BENCH_ITERATIONS;
+
+  printf("Formato de 5 opciones: coapSetUintOption %.0f ns, "
+         "CoapOptionWriter %.0f ns\n",
+         linear, indexed);
+
+  return 0;
+}
@@ -0,0 +1,261 @@
+/**
+ * @file os_port_host.c
+ * @brief Capa os*() de CycloneTCP sobre pthreads, para los tests de host
+ *
+ * Implementa las funciones que declara os_port_freertos.h. Las tareas son
+ * hilos, los eventos son banderas protegidas por un mutex y una variable de
+ * condición, y osSuspendAllTasks() toma un mutex global recursivo. Es la
+ * misma capa que wifi_manager/bench/host, sin el aviso a sus sockets en
+ * memoria.
+ */
+
+// PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP
+#define _GNU_SOURCE
+
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "os_port.h"
+
+/* Objeto detrás de SemaphoreHandle_t (eventos, semáforos y mutex) */
+typedef struct
+{
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  uint_t count;
+} HostSync;
+
+const OsTaskParameters OS_TASK_DEFAULT_PARAMS = {
+    650,                 // Tamaño de pila (palabras)
+    tskIDLE_PRIORITY + 1 // Prioridad
+};
+
+static pthread_mutex_t s_scheduler_mutex = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+
+typedef struct
+{
+  OsTaskCode code;
+  void *arg;
+} HostTaskStart;
+
+static void *host_task_entry(void *param)
+{
+  HostTaskStart start = *(HostTaskStart *)param;
+
+  free(param);
+  start.code(start.arg);
+  return NULL;
+}
+
+static HostSync *host_sync_create(uint_t count)
+{
+  HostSync *sync = (HostSync *)malloc(sizeof(HostSync));
+
+  if (sync != NULL)
+  {
+    pthread_mutex_init(&sync->mutex, NULL);
+    pthread_cond_init(&sync->cond, NULL);
+    sync->count = count;
+  }
+  return sync;
+}
+
+static void host_sync_delete(SemaphoreHandle_t handle)
+{
+  HostSync *sync = (HostSync *)handle;
+
+  if (sync != NULL)
+  {
+    pthread_mutex_destroy(&sync->mutex);
+    pthread_cond_destroy(&sync->cond);
+    free(sync);
+  }
+}
+
+/* Espera hasta que count > 0 (o vence el plazo) y lo decrementa */
+static bool_t host_sync_take(SemaphoreHandle_t handle, systime_t timeout)
+{
+  HostSync *sync = (HostSync *)handle;
+  struct timespec deadline;
+  bool_t taken;
+
+  if (timeout != INFINITE_DELAY)
+  {
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += timeout / 1000;
+    deadline.tv_nsec += (long)(timeout % 1000) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+      deadline.tv_sec++;
+      deadline.tv_nsec -= 1000000000L;
+    }
+  }
+
+  pthread_mutex_lock(&sync->mutex);
+  while (sync->count == 0)
+  {
+    if (timeout == INFINITE_DELAY)
+      pthread_cond_wait(&sync->cond, &sync->mutex);
+    else if (timeout == 0 ||
+             pthread_cond_timedwait(&sync->cond, &sync->mutex, &deadline) != 0)
+      break;
+  }
+  taken = (sync->count > 0) ? TRUE : FALSE;
+  if (taken)
+    sync->count--;
+  pthread_mutex_unlock(&sync->mutex);
+
+  return taken;
+}
+
+static void host_sync_give(SemaphoreHandle_t handle, uint_t max)
+{
+  HostSync *sync = (HostSync *)handle;
+
+  pthread_mutex_lock(&sync->mutex);
+  if (sync->count < max)
+    sync->count++;
+  pthread_cond_signal(&sync->cond);
+  pthread_mutex_unlock(&sync->mutex);
+}
+
+void osInitKernel(void) {}
+
+void osStartKernel(void) {}
+
+OsTaskId osCreateTask(const char_t *name, OsTaskCode taskCode, void *arg,
+                      const OsTaskParameters *params)
+{
+  pthread_t thread;
+  pthread_attr_t attr;
+  HostTaskStart *start;
+  size_t stack_size;
+
+  (void)name;
+
+  start = (HostTaskStart *)malloc(sizeof(HostTaskStart));
+  if (start == NULL)
+    return OS_INVALID_TASK_ID;
+  start->code = taskCode;
+  start->arg = arg;
+
+  // La pila se expresa en palabras, como en FreeRTOS
+  stack_size = params->stackSize * sizeof(uint32_t);
+  if (stack_size < PTHREAD_STACK_MIN)
+    stack_size = PTHREAD_STACK_MIN;
+
+  pthread_attr_init(&attr);
+  pthread_attr_setstacksize(&attr, stack_size);
+  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+  if (pthread_create(&thread, &attr, host_task_entry, start) != 0)
+  {
+    pthread_attr_destroy(&attr);
+    free(start);
+    return OS_INVALID_TASK_ID;
+  }
+
+  pthread_attr_destroy(&attr);
+  return (OsTaskId)(uintptr_t)thread;
+}
+
+void osDeleteTask(OsTaskId taskId)
+{
+  // Solo se admite la autodestrucción (OS_SELF_TASK_ID)
+  if (taskId == OS_SELF_TASK_ID)
+    pthread_exit(NULL);
+}
+
+void osDelayTask(systime_t delay) { usleep((useconds_t)delay * 1000); }
+
+void osSwitchTask(void) { sched_yield(); }
+
+void osSuspendAllTasks(void) { pthread_mutex_lock(&s_scheduler_mutex); }
+
+void osResumeAllTasks(void) { pthread_mutex_unlock(&s_scheduler_mutex); }
+
+bool_t osCreateEvent(OsEvent *event)
+{
+  event->handle = host_sync_create(0);
+  return (event->handle != NULL) ? TRUE : FALSE;
+}
+
+void osDeleteEvent(OsEvent *event)
+{
+  host_sync_delete(event->handle);
+  event->handle = NULL;
+}
+
+void osSetEvent(OsEvent *event)
+{
+  host_sync_give(event->handle, 1);
+}
+
+void osResetEvent(OsEvent *event) { host_sync_take(event->handle, 0); }
+
+bool_t osWaitForEvent(OsEvent *event, systime_t timeout)
+{
+  return host_sync_take(event->handle, timeout);
+}
+
+bool_t osSetEventFromIsr(OsEvent *event)
+{
+  osSetEvent(event);
+  return FALSE;
+}
+
+bool_t osCreateSemaphore(OsSemaphore *semaphore, uint_t count)
+{
+  semaphore->handle = host_sync_create(count);
+  return (semaphore->handle != NULL) ? TRUE : FALSE;
+}
+
+void osDeleteSemaphore(OsSemaphore *semaphore)
+{
+  host_sync_delete(semaphore->handle);
+  semaphore->handle = NULL;
+}
+
+bool_t osWaitForSemaphore(OsSemaphore *semaphore, systime_t timeout)
+{
+  return host_sync_take(semaphore->handle, timeout);
+}
+
+void osReleaseSemaphore(OsSemaphore *semaphore)
+{
+  host_sync_give(semaphore->handle, (uint_t)-1);
+}
+
+bool_t osCreateMutex(OsMutex *mutex)
+{
+  mutex->handle = host_sync_create(1);
+  return (mutex->handle != NULL) ? TRUE : FALSE;
+}
+
+void osDeleteMutex(OsMutex *mutex)
+{
+  host_sync_delete(mutex->handle);
+  mutex->handle = NULL;
+}
+
+void osAcquireMutex(OsMutex *mutex)
+{
+  host_sync_take(mutex->handle, INFINITE_DELAY);
+}
+
+void osReleaseMutex(OsMutex *mutex) { host_sync_give(mutex->handle, 1); }
+
+systime_t osGetSystemTime(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (systime_t)(t.tv_sec * 1000 + t.tv_nsec / 1000000);
+}
+
+void *osAllocMem(size_t size) { return malloc(size); }
+
+void osFreeMem(void *p) { free(p); }
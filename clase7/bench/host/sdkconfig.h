@@ -0,0 +1,91 @@
+/**
+ * @file sdkconfig.h
+ * @brief Configuración para compilar los benchmarks en el host
+ *
+ * Valores por defecto de main/Kconfig.projbuild con las trazas
+ * desactivadas. Sustituye al sdkconfig.h que genera ESP-IDF, de modo que
+ * "make -C bench" no necesita "idf.py reconfigure".
+ */
+
+#ifndef _BENCH_SDKCONFIG_H
+#define _BENCH_SDKCONFIG_H
+
+#define CONFIG_MEM_TRACE_LEVEL_OFF 1
+#define CONFIG_NIC_TRACE_LEVEL_OFF 1
+#define CONFIG_ETH_TRACE_LEVEL_OFF 1
+#define CONFIG_LLDP_TRACE_LEVEL_OFF 1
+#define CONFIG_ARP_TRACE_LEVEL_OFF 1
+#define CONFIG_IP_TRACE_LEVEL_OFF 1
+#define CONFIG_IPV4_TRACE_LEVEL_OFF 1
+#define CONFIG_IPV6_TRACE_LEVEL_OFF 1
+#define CONFIG_ICMP_TRACE_LEVEL_OFF 1
+#define CONFIG_IGMP_TRACE_LEVEL_OFF 1
+#define CONFIG_NAT_TRACE_LEVEL_OFF 1
+#define CONFIG_ICMPV6_TRACE_LEVEL_OFF 1
+#define CONFIG_MLD_TRACE_LEVEL_OFF 1
+#define CONFIG_NDP_TRACE_LEVEL_OFF 1
+#define CONFIG_UDP_TRACE_LEVEL_OFF 1
+#define CONFIG_TCP_TRACE_LEVEL_OFF 1
+#define CONFIG_SOCKET_TRACE_LEVEL_OFF 1
+#define CONFIG_RAW_SOCKET_TRACE_LEVEL_OFF 1
+#define CONFIG_BSD_SOCKET_TRACE_LEVEL_OFF 1
+#define CONFIG_WEB_SOCKET_TRACE_LEVEL_OFF 1
+#define CONFIG_AUTO_IP_TRACE_LEVEL_OFF 1
+#define CONFIG_SLAAC_TRACE_LEVEL_OFF 1
+#define CONFIG_DHCP_TRACE_LEVEL_OFF 1
+#define CONFIG_DHCPV6_TRACE_LEVEL_OFF 1
+#define CONFIG_DNS_TRACE_LEVEL_OFF 1
+#define CONFIG_MDNS_TRACE_LEVEL_OFF 1
+#define CONFIG_NBNS_TRACE_LEVEL_OFF 1
+#define CONFIG_LLMNR_TRACE_LEVEL_OFF 1
+#define CONFIG_ECHO_TRACE_LEVEL_OFF 1
+#define CONFIG_COAP_TRACE_LEVEL_OFF 1
+#define CONFIG_FTP_TRACE_LEVEL_OFF 1
+#define CONFIG_HTTP_TRACE_LEVEL_OFF 1
+#define CONFIG_MQTT_TRACE_LEVEL_OFF 1
+#define CONFIG_MQTT_SN_TRACE_LEVEL_OFF 1
+#define CONFIG_SMTP_TRACE_LEVEL_OFF 1
+#define CONFIG_SNMP_TRACE_LEVEL_OFF 1
+#define CONFIG_SNTP_TRACE_LEVEL_OFF 1
+#define CONFIG_NTP_TRACE_LEVEL_OFF 1
+#define CONFIG_NTS_TRACE_LEVEL_OFF 1
+#define CONFIG_TFTP_TRACE_LEVEL_OFF 1
+#define CONFIG_MODBUS_TRACE_LEVEL_OFF 1
+#define CONFIG_NET_INTERFACE_COUNT 2
+#define CONFIG_MAC_ADDR_FILTER_SIZE 12
+#define CONFIG_IPV4_SUPPORT 1
+#define CONFIG_IPV4_MULTICAST_FILTER_SIZE 4
+#define CONFIG_IPV4_FRAG_SUPPORT 1
+#define CONFIG_IPV4_MAX_FRAG_DATAGRAMS 4
+#define CONFIG_IPV4_MAX_FRAG_DATAGRAM_SIZE 8192
+#define CONFIG_ARP_CACHE_SIZE 8
+#define CONFIG_ARP_MAX_PENDING_PACKETS 2
+#define CONFIG_IGMP_HOST_SUPPORT 1
+#define CONFIG_DHCP_SERVER_SUPPORT 1
+#define CONFIG_IPV6_SUPPORT 1
+#define CONFIG_IPV6_MULTICAST_FILTER_SIZE 8
+#define CONFIG_IPV6_FRAG_SUPPORT 1
+#define CONFIG_IPV6_MAX_FRAG_DATAGRAMS 4
+#define CONFIG_IPV6_MAX_FRAG_DATAGRAM_SIZE 8192
+#define CONFIG_MLD_NODE_SUPPORT 1
+#define CONFIG_NDP_ROUTER_ADV_SUPPORT 1
+#define CONFIG_NDP_NEIGHBOR_CACHE_SIZE 8
+#define CONFIG_NDP_DEST_CACHE_SIZE 8
+#define CONFIG_NDP_MAX_PENDING_PACKETS 2
+#define CONFIG_TCP_SUPPORT 1
+#define CONFIG_TCP_DEFAULT_TX_BUFFER_SIZE 2860
+#define CONFIG_TCP_DEFAULT_RX_BUFFER_SIZE 2860
+#define CONFIG_TCP_DEFAULT_SYN_QUEUE_SIZE 4
+#define CONFIG_TCP_MAX_RETRIES 5
+#define CONFIG_UDP_SUPPORT 1
+#define CONFIG_UDP_RX_QUEUE_SIZE 4
+#define CONFIG_RAW_SOCKET_RX_QUEUE_SIZE 4
+#define CONFIG_SOCKET_MAX_COUNT 10
+#define CONFIG_LLMNR_RESPONDER_SUPPORT 1
+#define CONFIG_HTTP_SERVER_SUPPORT 1
+#define CONFIG_HTTP_SERVER_SSI_SUPPORT 1
+#define CONFIG_COAP_SERVER_WORKER_STACK_SIZE 1536
+#define CONFIG_COAP_CLIENT_NSTART 2
+#define CONFIG_COAP_CLIENT_MAX_REQUESTS 4
+
+#endif
@@ -0,0 +1,4 @@
+/**
+ * @file semphr.h
+ * @brief Vacío: los tipos necesarios están en FreeRTOS.h
+ */
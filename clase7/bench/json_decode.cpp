@@ -0,0 +1,43 @@
+/**
+ * @file json_decode.cpp
+ * @brief Decodificación JSON del cuerpo de PUT /led con ArduinoJson
+ *
+ * Los mismos pasos que parse_led_state() en main.cpp para un payload JSON:
+ * copia terminada en nulo, deserializeJson() en un JsonDocument y lectura
+ * del miembro "state". cbor_bench.c la mide frente a cborFindMapKey().
+ *
+ * Solo se compila si el Makefile encuentra ArduinoJson (ARDUINOJSON_DIR).
+ */
+
+#include <string.h>
+#include <strings.h>
+#include "ArduinoJson.h"
+
+/**
+ * @brief Lee el estado del LED de un cuerpo JSON
+ * @return 1 si es "on", 0 si es "off", -1 si el cuerpo no es válido
+ */
+extern "C" int json_decode_led_state(const char *payload, size_t length)
+{
+  /* Copia terminada en nulo del payload JSON recibido */
+  char json_buf[256];
+
+  if (length >= sizeof(json_buf))
+    return -1;
+
+  memcpy(json_buf, payload, length);
+  json_buf[length] = '\0';
+
+  JsonDocument req;
+  DeserializationError de_err = deserializeJson(req, json_buf);
+
+  if (de_err != DeserializationError::Ok || !req["state"].is<const char *>())
+    return -1;
+
+  const char *state_str = req["state"];
+  if (!strcasecmp(state_str, "on"))
+    return 1;
+  if (!strcasecmp(state_str, "off"))
+    return 0;
+  return -1;
+}
@@ -0,0 +1,464 @@
+/**
+ * @file tcp_test.c
+ * @brief Test de host: conexiones CoAP sobre TCP del servidor (RFC 8323)
+ *
+ * Llama a las funciones de coap_server_tcp.c sobre un socket simulado, que
+ * guarda todo lo enviado y acepta como mucho los bytes que el test le deja
+ * en cada momento. Comprueba:
+ * - La cola de transmisión: con el socket libre el mensaje sale entero; con
+ *   el socket lleno se encola, se despierta una vez al servidor y se vacía
+ *   en cada evento de escritura sin cortar ni mezclar mensajes; si no se
+ *   vacía, el mensaje que no cabe se rechaza y la conexión se cierra.
+ * - El aborto: una cabecera incorrecta o un CSM mal formado reciben un 7.05
+ *   Abort con su diagnóstico, la conexión descarta lo que llega y no admite
+ *   más mensajes, y se cierra en el tick al completarse el cierre ordenado o
+ *   al vencer COAP_SERVER_TCP_ABORT_TIMEOUT.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "core/net.h"
+#include "coap/coap_server.h"
+#include "coap/coap_server_misc.h"
+#include "coap/coap_server_observe.h"
+#include "coap/coap_server_tcp.h"
+
+/* Bytes enviados que se guardan */
+#define TEST_STREAM_SIZE 8192
+/* El socket acepta cualquier cantidad */
+#define TEST_UNLIMITED ((size_t)-1)
+
+/* Socket TCP simulado */
+typedef struct
+{
+  uint8_t sent[TEST_STREAM_SIZE];
+  size_t sentLen;
+  size_t room;      /* Bytes que acepta el buffer de envío */
+  const uint8_t *rx; /* Datos pendientes de recibir */
+  size_t rxLen;
+  bool_t shutdown;
+  error_t shutdownError;
+  bool_t closed;
+} TestSocket;
+
+static CoapServerContext s_context;
+static Socket s_socket;
+static TestSocket s_test_socket;
+static uint_t s_requests;
+static int s_failures;
+
+/* ========================================================================== */
+/*                       STUBS DEL RESTO DEL SERVIDOR                         */
+/* ========================================================================== */
+
+/* El socket de escucha no se usa */
+const IpAddr IP_ADDR_ANY = {0};
+
+Socket *socketOpen(uint_t type, uint_t protocol)
+{
+  return NULL;
+}
+
+error_t socketSetInterface(Socket *socket, NetInterface *interface)
+{
+  return ERROR_NOT_IMPLEMENTED;
+}
+
+error_t socketBind(Socket *socket, const IpAddr *localIpAddr,
+                   uint16_t localPort)
+{
+  return ERROR_NOT_IMPLEMENTED;
+}
+
+error_t socketListen(Socket *socket, uint_t backlog)
+{
+  return ERROR_NOT_IMPLEMENTED;
+}
+
+Socket *socketAccept(Socket *socket, IpAddr *clientIpAddr,
+                     uint16_t *clientPort)
+{
+  memset(&s_test_socket, 0, sizeof(s_test_socket));
+  s_test_socket.room = TEST_UNLIMITED;
+  clientIpAddr->length = sizeof(Ipv4Addr);
+  clientIpAddr->ipv4Addr = IPV4_ADDR(192, 168, 1, 20);
+  *clientPort = 40000;
+  return &s_socket;
+}
+
+error_t socketSetTimeout(Socket *socket, systime_t timeout)
+{
+  return NO_ERROR;
+}
+
+error_t socketGetLocalAddr(Socket *socket, IpAddr *localIpAddr,
+                           uint16_t *localPort)
+{
+  localIpAddr->length = sizeof(Ipv4Addr);
+  localIpAddr->ipv4Addr = IPV4_ADDR(192, 168, 1, 10);
+  return NO_ERROR;
+}
+
+error_t socketSend(Socket *socket, const void *data, size_t length,
+                   size_t *written, uint_t flags)
+{
+  size_t n = MIN(length, s_test_socket.room);
+
+  if (n > TEST_STREAM_SIZE - s_test_socket.sentLen)
+    return ERROR_FAILURE;
+
+  memcpy(s_test_socket.sent + s_test_socket.sentLen, data, n);
+  s_test_socket.sentLen += n;
+  if (s_test_socket.room != TEST_UNLIMITED)
+    s_test_socket.room -= n;
+
+  if (written != NULL)
+    *written = n;
+
+  return (n < length) ? ERROR_WOULD_BLOCK : NO_ERROR;
+}
+
+error_t socketReceive(Socket *socket, void *data, size_t size,
+                      size_t *received, uint_t flags)
+{
+  size_t n = MIN(size, s_test_socket.rxLen);
+
+  if (n == 0)
+    return ERROR_WOULD_BLOCK;
+
+  memcpy(data, s_test_socket.rx, n);
+  s_test_socket.rx += n;
+  s_test_socket.rxLen -= n;
+  *received = n;
+  return NO_ERROR;
+}
+
+error_t socketShutdown(Socket *socket, uint_t how)
+{
+  s_test_socket.shutdown = TRUE;
+  return s_test_socket.shutdownError;
+}
+
+void socketClose(Socket *socket)
+{
+  s_test_socket.closed = TRUE;
+}
+
+/* Las peticiones solo se cuentan */
+error_t coapServerProcessRequest(CoapServerContext *context,
+                                 const uint8_t *data, size_t length)
+{
+  s_requests++;
+  return NO_ERROR;
+}
+
+#if (COAP_SERVER_OBSERVE_SUPPORT == ENABLED)
+void coapServerDeleteObserver(CoapServerContext *context,
+                              CoapServerObserver *observer)
+{
+  observer->resource = 0;
+}
+#endif
+
+/* ========================================================================== */
+/*                                 UTILIDADES                                 */
+/* ========================================================================== */
+
+static void check(bool_t condition, const char *what)
+{
+  if (!condition)
+  {
+    printf("FALLO: %s\n", what);
+    s_failures++;
+  }
+}
+
+/* Abre la conexión y descarta el CSM del servidor */
+static CoapServerConnection *accept_connection(void)
+{
+  coapServerAcceptConnection(&s_context);
+  s_test_socket.sentLen = 0;
+  osResetEvent(&s_context.event);
+  return &s_context.connections[0];
+}
+
+/**
+ * @brief Lee el mensaje enviado que empieza en *pos
+ * @param[out] message Mensaje en el formato de datagrama
+ * @return FALSE si no hay un mensaje completo
+ */
+static bool_t read_message(size_t *pos, CoapMessage *message)
+{
+  size_t headerLen;
+  size_t length;
+
+  if (coapParseTcpMessageHeader(s_test_socket.sent + *pos,
+                                s_test_socket.sentLen - *pos, &headerLen,
+                                &length) ||
+      length > s_test_socket.sentLen - *pos)
+    return FALSE;
+
+  if (coapDecodeTcpMessage(s_test_socket.sent + *pos, length, message->buffer,
+                           COAP_MAX_MSG_SIZE, &message->length))
+    return FALSE;
+
+  message->pos = 0;
+  *pos += length;
+  return TRUE;
+}
+
+/* El siguiente mensaje enviado es un Abort con este diagnóstico */
+static bool_t is_abort(size_t *pos, const char *diagnostic)
+{
+  static CoapMessage message;
+  const uint8_t *payload;
+  size_t n;
+  CoapCode code;
+
+  if (!read_message(pos, &message))
+    return FALSE;
+
+  coapGetCode(&message, &code);
+  if (code != COAP_CODE_ABORT || coapGetPayload(&message, &payload, &n))
+    return FALSE;
+
+  return n == strlen(diagnostic) && memcmp(payload, diagnostic, n) == 0;
+}
+
+/**
+ * @brief Envía una respuesta 2.05 con un payload de length bytes
+ * @param[in] fill Byte de relleno del payload
+ */
+static error_t send_response(CoapServerConnection *connection, size_t length,
+                             uint8_t fill)
+{
+  static CoapMessage message;
+  static uint8_t payload[COAP_MAX_MSG_SIZE];
+  CoapMessageHeader *header = (CoapMessageHeader *)message.buffer;
+
+  header->version = COAP_VERSION_1;
+  header->type = COAP_TYPE_NON;
+  header->tokenLen = 0;
+  header->code = COAP_CODE_CONTENT;
+  header->mid = 0;
+  message.length = sizeof(CoapMessageHeader);
+  memset(payload, fill, length);
+  coapSetPayload(&message, payload, length);
+
+  return coapServerSendTcpMessage(&s_context, connection, connection->id,
+                                  message.buffer, message.length, NULL, 0);
+}
+
+/* El siguiente mensaje enviado es una respuesta de length bytes de fill */
+static bool_t is_response(size_t *pos, size_t length, uint8_t fill)
+{
+  static CoapMessage message;
+  const uint8_t *payload;
+  size_t n;
+  CoapCode code;
+
+  if (!read_message(pos, &message))
+    return FALSE;
+
+  coapGetCode(&message, &code);
+  if (code != COAP_CODE_CONTENT || coapGetPayload(&message, &payload, &n) ||
+      n != length)
+    return FALSE;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    if (payload[i] != fill)
+      return FALSE;
+  }
+  return TRUE;
+}
+
+/* ========================================================================== */
+/*                                 ESCENARIOS                                 */
+/* ========================================================================== */
+
+/* Socket libre: el mensaje sale entero en la llamada */
+static void test_send_direct(void)
+{
+  CoapServerConnection *connection = accept_connection();
+  size_t pos = 0;
+
+  check(send_response(connection, 1000, 0xA5) == NO_ERROR,
+        "envío directo: aceptado");
+  check(connection->txBufferLen == 0 && is_response(&pos, 1000, 0xA5) &&
+            pos == s_test_socket.sentLen,
+        "envío directo: enviado entero");
+  check(!osWaitForEvent(&s_context.event, 0),
+        "envío directo: el servidor no se despierta");
+
+  coapServerCloseConnection(&s_context, connection);
+}
+
+/* Socket lleno: cola, un aviso y vaciado por eventos de escritura */
+static void test_send_queued(void)
+{
+  CoapServerConnection *connection = accept_connection();
+  uint_t events = 0;
+  size_t pos = 0;
+
+  s_test_socket.room = 10;
+  check(send_response(connection, 1000, 0x11) == NO_ERROR &&
+            connection->txBufferLen > 0,
+        "cola: respuesta encolada");
+  check(osWaitForEvent(&s_context.event, 0) &&
+            !osWaitForEvent(&s_context.event, 0),
+        "cola: el servidor se despierta una vez");
+
+  // Otra respuesta detrás, con la primera aún en la cola
+  check(send_response(connection, 500, 0x22) == NO_ERROR,
+        "cola: segunda respuesta encolada");
+
+  while (connection->txBufferLen > 0 && events < 100)
+  {
+    s_test_socket.room = 100;
+    coapServerSendTcpData(&s_context, connection);
+    events++;
+  }
+
+  check(connection->txBufferLen == 0 && !connection->closing,
+        "cola: vaciada por eventos de escritura");
+  check(events > 1, "cola: varios eventos de escritura");
+  check(is_response(&pos, 1000, 0x11) && is_response(&pos, 500, 0x22) &&
+            pos == s_test_socket.sentLen,
+        "cola: mensajes completos y en orden");
+
+  coapServerCloseConnection(&s_context, connection);
+}
+
+/* Cliente que no lee: el mensaje que no cabe cierra la conexión */
+static void test_send_overflow(void)
+{
+  CoapServerConnection *connection = accept_connection();
+  error_t error = NO_ERROR;
+  uint_t queued = 0;
+  size_t pos = 0;
+
+  s_test_socket.room = 0;
+  while (!error && queued < 10)
+  {
+    error = send_response(connection, 1000, 0x33);
+    if (!error)
+      queued++;
+  }
+
+  check(error == ERROR_BUFFER_OVERFLOW && queued > 0,
+        "cola llena: mensaje rechazado");
+  check(connection->closing, "cola llena: conexión marcada para cerrar");
+
+  // La cola solo guarda mensajes completos
+  s_test_socket.room = TEST_UNLIMITED;
+  coapServerSendTcpData(&s_context, connection);
+  for (uint_t i = 0; i < queued; i++)
+    check(is_response(&pos, 1000, 0x33),
+          "cola llena: solo mensajes completos en la cola");
+  check(pos == s_test_socket.sentLen, "cola llena: nada más en la cola");
+
+  coapServerTcpTick(&s_context);
+  check(connection->socket == NULL && s_test_socket.closed,
+        "cola llena: el tick cierra la conexión");
+}
+
+/* Cabecera incorrecta: Abort, descarte y cierre ordenado */
+static void test_abort_header(void)
+{
+  static const uint8_t bad[] = {0x09, 0x45, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  static const uint8_t more[] = {0x00, 0x01};
+  CoapServerConnection *connection = accept_connection();
+  size_t pos = 0;
+
+  s_requests = 0;
+  s_test_socket.rx = bad;
+  s_test_socket.rxLen = sizeof(bad);
+  coapServerReceiveTcpData(&s_context, connection);
+
+  check(is_abort(&pos, "Malformed message header"),
+        "cabecera incorrecta: Abort con diagnóstico");
+  check(connection->socket != NULL && connection->aborting &&
+            !s_test_socket.shutdown,
+        "cabecera incorrecta: la conexión sigue abierta hasta el tick");
+
+  // Lo que llega después se descarta
+  s_test_socket.rx = more;
+  s_test_socket.rxLen = sizeof(more);
+  coapServerReceiveTcpData(&s_context, connection);
+  check(connection->bufferLen == 0 && s_requests == 0,
+        "abortada: los datos recibidos se descartan");
+  check(send_response(connection, 10, 0x44) == ERROR_NOT_CONNECTED,
+        "abortada: no admite más mensajes");
+
+  coapServerTcpTick(&s_context);
+  check(s_test_socket.shutdown && connection->socket == NULL &&
+            s_test_socket.closed,
+        "abortada: cierre ordenado en el tick");
+}
+
+/* Abort atascado en el socket: se cierra al vencer el plazo */
+static void test_abort_timeout(void)
+{
+  static const uint8_t bad[] = {0x0F, 0x01};
+  CoapServerConnection *connection = accept_connection();
+
+  s_test_socket.room = 0;
+  s_test_socket.rx = bad;
+  s_test_socket.rxLen = sizeof(bad);
+  coapServerReceiveTcpData(&s_context, connection);
+
+  check(connection->aborting && connection->txBufferLen > 0,
+        "Abort atascado: en la cola");
+
+  coapServerTcpTick(&s_context);
+  check(connection->socket != NULL && !s_test_socket.shutdown,
+        "Abort atascado: espera antes del plazo");
+
+  connection->timestamp -= COAP_SERVER_TCP_ABORT_TIMEOUT;
+  coapServerTcpTick(&s_context);
+  check(connection->socket == NULL && s_test_socket.closed,
+        "Abort atascado: cerrado al vencer el plazo");
+}
+
+/* CSM con una opción cortada */
+static void test_abort_signal(void)
+{
+  static const uint8_t csm[] = {0x20, 0xE1, 0x22, 0x04};
+  CoapServerConnection *connection = accept_connection();
+  size_t pos = 0;
+
+  s_test_socket.rx = csm;
+  s_test_socket.rxLen = sizeof(csm);
+  coapServerReceiveTcpData(&s_context, connection);
+
+  check(is_abort(&pos, "Malformed signaling message") &&
+            connection->aborting,
+        "CSM mal formado: Abort con diagnóstico");
+
+  coapServerCloseConnection(&s_context, connection);
+}
+
+int main(void)
+{
+  osCreateMutex(&s_context.mutex);
+  osCreateMutex(&s_context.tcpMutex);
+  osCreateEvent(&s_context.event);
+
+  test_send_direct();
+  test_send_queued();
+  test_send_overflow();
+  test_abort_header();
+  test_abort_timeout();
+  test_abort_signal();
+
+  if (s_failures)
+  {
+    printf("CoAP sobre TCP: %d comprobaciones fallidas\n", s_failures);
+    return 1;
+  }
+
+  printf("CoAP sobre TCP: cola de transmisión y Abort con diagnóstico "
+         "correctos\n");
+  return 0;
+}
@@ -0,0 +1,478 @@
+/**
+ * @file worker_test.c
+ * @brief Test de host: pool de workers y respuestas separadas del servidor CoAP
+ *
+ * Arranca las tareas de coap_server_worker.c sobre pthreads y les entrega
+ * peticiones formateadas a mano con coapServerStartWorker(), sin sockets.
+ * coapServerSendResponse() es un stub que guarda los mensajes enviados.
+ * Comprueba:
+ * - coapServerStopWorkers() termina las tareas creadas, también la de un
+ *   worker ocupado, y deja el pool en reposo y listo para otro arranque
+ *   (el camino de error de coapServerStart()).
+ * - Un handler lento recibe un ACK vacío, su respuesta separada se copia a
+ *   una entrada de retransmisión y el worker queda libre en el acto.
+ * - La respuesta separada se retransmite con back-off exponencial hasta su
+ *   ACK, o COAP_SERVER_MAX_RETRANSMIT veces si no llega.
+ * - Una petición multicast también va a un worker, que encola la respuesta
+ *   para que la envíe coapServerMulticastTick() (y descarta los errores).
+ *
+ * El Makefile lo compila con COAP_SERVER_MULTICAST_SUPPORT habilitado.
+ *
+ * Los plazos se adelantan retrasando las marcas de tiempo, sin esperar.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "core/net.h"
+#include "coap/coap_server.h"
+#include "coap/coap_server_misc.h"
+#include "coap/coap_server_dedup.h"
+#include "coap/coap_server_worker.h"
+#include "coap/coap_server_multicast.h"
+#include "coap/coap_debug.h"
+
+/* Mensajes enviados que se guardan */
+#define TEST_MAX_SENT 32
+
+/* Cabecera de un mensaje enviado */
+typedef struct
+{
+  uint8_t type;
+  uint8_t code;
+  uint16_t mid;
+  uint16_t clientPort;
+} TestSent;
+
+static CoapServerContext s_context;
+static TestSent s_sent[TEST_MAX_SENT];
+static uint_t s_sent_count;
+static OsSemaphore s_entered;      /* Se libera al entrar en el handler */
+static OsSemaphore s_resume;       /* El handler lento espera a este semáforo */
+static volatile bool_t s_slow;     /* El handler siguiente es lento */
+static CoapCode s_code = COAP_CODE_CONTENT; /* Respuesta del handler */
+static uint_t s_multicast_sent;    /* Respuestas multicast enviadas */
+static int s_failures;
+
+/* ========================================================================== */
+/*                       STUBS DEL RESTO DEL SERVIDOR                         */
+/* ========================================================================== */
+
+bool_t ipCompAddr(const IpAddr *ipAddr1, const IpAddr *ipAddr2)
+{
+  return memcmp(ipAddr1, ipAddr2, sizeof(IpAddr)) == 0;
+}
+
+error_t coapDumpMessage(const void *message, size_t length)
+{
+  return NO_ERROR;
+}
+
+#if (COAP_SERVER_DEDUP_SUPPORT == ENABLED)
+void coapServerAddDedupEntry(CoapServerExchange *exchange, const uint8_t *data,
+                             size_t length)
+{
+}
+#endif
+
+/* Igual que coapServerInitResponse(), sin token */
+error_t coapServerInitResponse(CoapServerExchange *exchange)
+{
+  CoapMessageHeader *request = (CoapMessageHeader *)exchange->request.buffer;
+  CoapMessageHeader *response = (CoapMessageHeader *)exchange->response.buffer;
+
+  response->version = COAP_VERSION_1;
+  response->tokenLen = 0;
+  response->code = COAP_CODE_INTERNAL_SERVER;
+  response->mid = request->mid;
+  response->type = (request->type == COAP_TYPE_CON) ? COAP_TYPE_ACK
+                                                     : COAP_TYPE_NON;
+  exchange->response.length = sizeof(CoapMessageHeader);
+  exchange->response.pos = 0;
+  coapInitOptionWriter(&exchange->responseWriter, &exchange->response);
+  return NO_ERROR;
+}
+
+#if (COAP_SERVER_MULTICAST_SUPPORT == ENABLED)
+/* coapServerMulticastTick() envía directamente por el socket */
+error_t socketSendTo(Socket *socket, const IpAddr *destIpAddr,
+                     uint16_t destPort, const void *data, size_t length,
+                     size_t *written, uint_t flags)
+{
+  s_multicast_sent++;
+  return NO_ERROR;
+}
+
+error_t socketJoinMulticastGroup(Socket *socket, const IpAddr *groupAddr)
+{
+  return NO_ERROR;
+}
+
+bool_t ipIsMulticastAddr(const IpAddr *ipAddr)
+{
+  return ipAddr->length == sizeof(Ipv4Addr) &&
+         (ntohl(ipAddr->ipv4Addr) & 0xF0000000) == 0xE0000000;
+}
+
+uint32_t netGetRandRange(uint32_t min, uint32_t max)
+{
+  return max;
+}
+#endif
+
+/* Se llama con el mutex del contexto tomado */
+error_t coapServerSendResponse(CoapServerExchange *exchange, const void *data,
+                               size_t length)
+{
+  const CoapMessageHeader *header = (const CoapMessageHeader *)data;
+
+  if (s_sent_count < TEST_MAX_SENT)
+  {
+    s_sent[s_sent_count].type = header->type;
+    s_sent[s_sent_count].code = header->code;
+    s_sent[s_sent_count].mid = ntohs(header->mid);
+    s_sent[s_sent_count].clientPort = exchange->clientPort;
+  }
+  s_sent_count++;
+  return NO_ERROR;
+}
+
+/* Handler de todas las peticiones: 2.05, lento si s_slow */
+error_t coapServerHandleRequest(CoapServerExchange *exchange, CoapCode code)
+{
+  if (s_slow)
+  {
+    s_slow = FALSE;
+    osReleaseSemaphore(&s_entered);
+    osWaitForSemaphore(&s_resume, INFINITE_DELAY);
+  }
+
+  return coapSetCode(&exchange->response, s_code);
+}
+
+/* ========================================================================== */
+/*                                 UTILIDADES                                 */
+/* ========================================================================== */
+
+static void check(bool_t condition, const char *what)
+{
+  if (!condition)
+  {
+    printf("FALLO: %s\n", what);
+    s_failures++;
+  }
+}
+
+static void start_workers(void)
+{
+  s_context.stop = FALSE;
+
+  for (uint_t i = 0; i < COAP_SERVER_MAX_WORKERS; i++)
+  {
+    CoapServerExchange *worker = &s_context.workers[i];
+
+    worker->taskId = osCreateTask("Worker", (OsTaskCode)coapServerWorkerTask,
+                                  worker, &OS_TASK_DEFAULT_PARAMS);
+  }
+}
+
+/**
+ * @brief Entrega una petición de un cliente a un worker
+ * @param[in] group Grupo multicast de destino (0: petición CON unicast)
+ * @return Worker que la procesa, NULL si no se ha entregado
+ */
+static CoapServerExchange *send_request_to(uint16_t port, uint16_t mid,
+                                           Ipv4Addr group)
+{
+  CoapServerExchange *exchange = &s_context.exchange;
+  CoapMessageHeader *request = (CoapMessageHeader *)exchange->request.buffer;
+  CoapServerExchange *worker = NULL;
+
+  osAcquireMutex(&s_context.mutex);
+
+  exchange->clientIpAddr.length = sizeof(Ipv4Addr);
+  exchange->clientIpAddr.ipv4Addr = IPV4_ADDR(192, 168, 1, 20);
+  exchange->clientPort = port;
+  exchange->serverIpAddr.length = sizeof(Ipv4Addr);
+  exchange->serverIpAddr.ipv4Addr = (group != 0) ? group
+                                                 : IPV4_ADDR(192, 168, 1, 10);
+
+  request->version = COAP_VERSION_1;
+  request->type = (group != 0) ? COAP_TYPE_NON : COAP_TYPE_CON;
+  request->tokenLen = 0;
+  request->code = COAP_CODE_GET;
+  request->mid = htons(mid);
+  exchange->request.length = sizeof(CoapMessageHeader);
+  exchange->request.buffer[exchange->request.length] = '\0';
+  coapParseMessageEx(&exchange->request, &exchange->requestIndex);
+  coapServerInitResponse(exchange);
+
+  coapServerStartWorker(&s_context, exchange);
+
+  for (uint_t i = 0; i < COAP_SERVER_MAX_WORKERS; i++)
+  {
+    CoapServerExchange *w = &s_context.workers[i];
+
+    if (w->state == COAP_SERVER_WORKER_STATE_BUSY && w->clientPort == port &&
+        ((CoapMessageHeader *)w->request.buffer)->mid == htons(mid))
+      worker = w;
+  }
+
+  osReleaseMutex(&s_context.mutex);
+  return worker;
+}
+
+static CoapServerExchange *send_request(uint16_t port, uint16_t mid)
+{
+  return send_request_to(port, mid, 0);
+}
+
+/* Espera a que un worker vuelva a estar en reposo */
+static bool_t wait_idle(CoapServerExchange *worker)
+{
+  for (uint_t i = 0; i < 1000; i++)
+  {
+    bool_t idle;
+
+    osAcquireMutex(&s_context.mutex);
+    idle = (worker->state == COAP_SERVER_WORKER_STATE_IDLE);
+    osReleaseMutex(&s_context.mutex);
+
+    if (idle)
+      return TRUE;
+    osDelayTask(1);
+  }
+  return FALSE;
+}
+
+/* Adelanta el plazo de una entrada de retransmisión y llama al tick */
+static void expire_slot(CoapServerSeparateResponse *entry)
+{
+  osAcquireMutex(&s_context.mutex);
+  entry->timestamp -= entry->timeout;
+  coapServerWorkerTick(&s_context);
+  osReleaseMutex(&s_context.mutex);
+}
+
+/**
+ * @brief Petición con un handler lento: ACK vacío y respuesta separada
+ * @return Entrada de retransmisión de la respuesta separada
+ */
+static CoapServerSeparateResponse *slow_request(uint16_t port, uint16_t mid)
+{
+  CoapServerExchange *worker;
+  CoapServerSeparateResponse *entry = NULL;
+  uint_t sent;
+
+  s_slow = TRUE;
+  worker = send_request(port, mid);
+  check(worker != NULL, "handler lento: petición entregada");
+  if (worker == NULL)
+    return NULL;
+  osWaitForSemaphore(&s_entered, INFINITE_DELAY);
+
+  // Vence COAP_SERVER_SEPARATE_RESPONSE_DELAY
+  osAcquireMutex(&s_context.mutex);
+  worker->timestamp -= COAP_SERVER_SEPARATE_RESPONSE_DELAY;
+  sent = s_sent_count;
+  coapServerWorkerTick(&s_context);
+  osReleaseMutex(&s_context.mutex);
+
+  check(s_sent_count == sent + 1 && s_sent[sent].type == COAP_TYPE_ACK &&
+            s_sent[sent].code == COAP_CODE_EMPTY && s_sent[sent].mid == mid,
+        "handler lento: ACK vacío con el MID de la petición");
+
+  sent = s_sent_count;
+  osReleaseSemaphore(&s_resume);
+  check(wait_idle(worker), "respuesta separada: el worker queda libre");
+
+  check(s_sent_count == sent + 1 && s_sent[sent].type == COAP_TYPE_CON &&
+            s_sent[sent].code == COAP_CODE_CONTENT &&
+            s_sent[sent].mid == s_context.mid,
+        "respuesta separada: CON 2.05 con un MID nuevo");
+
+  for (uint_t i = 0; i < COAP_SERVER_MAX_SEPARATE_RESPONSES; i++)
+  {
+    if (s_context.separateResponses[i].length > 0 &&
+        s_context.separateResponses[i].mid == s_context.mid)
+      entry = &s_context.separateResponses[i];
+  }
+  check(entry != NULL && entry->clientPort == port,
+        "respuesta separada: copiada a una entrada de retransmisión");
+
+  return entry;
+}
+
+/* ========================================================================== */
+/*                                 ESCENARIOS                                 */
+/* ========================================================================== */
+
+/* Parada de los workers tras un arranque fallido */
+static void test_stop_workers(void)
+{
+  start_workers();
+
+  // Un worker ocupado, el resto esperando una petición
+  osAcquireMutex(&s_context.mutex);
+  s_context.workers[0].state = COAP_SERVER_WORKER_STATE_BUSY;
+  osReleaseMutex(&s_context.mutex);
+
+  s_context.stop = TRUE;
+  coapServerStopWorkers(&s_context);
+
+  for (uint_t i = 0; i < COAP_SERVER_MAX_WORKERS; i++)
+  {
+    CoapServerExchange *worker = &s_context.workers[i];
+
+    check(worker->taskId == OS_INVALID_TASK_ID, "parada: tarea terminada");
+    check(worker->state == COAP_SERVER_WORKER_STATE_IDLE,
+          "parada: worker en reposo");
+    check(!osWaitForEvent(&worker->startEvent, 0),
+          "parada: sin señales de arranque pendientes");
+  }
+}
+
+/* Respuesta separada retransmitida hasta su ACK */
+static void test_separate_ack(void)
+{
+  CoapServerSeparateResponse *entry;
+  CoapServerExchange *worker;
+  systime_t timeout;
+  uint16_t mid;
+  uint_t sent;
+
+  entry = slow_request(5000, 0x0101);
+  if (entry == NULL)
+    return;
+  mid = entry->mid;
+
+  // El worker atiende otra petición mientras la respuesta sigue pendiente
+  worker = send_request(5001, 0x0102);
+  check(worker == &s_context.workers[0],
+        "respuesta pendiente: el mismo worker atiende la petición siguiente");
+  if (worker != NULL)
+    wait_idle(worker);
+  check(s_sent[s_sent_count - 1].type == COAP_TYPE_ACK &&
+            s_sent[s_sent_count - 1].mid == 0x0102,
+        "respuesta pendiente: la petición siguiente va en el ACK");
+
+  osAcquireMutex(&s_context.mutex);
+  timeout = coapServerGetWorkerTimeout(&s_context, INFINITE_DELAY);
+  osReleaseMutex(&s_context.mutex);
+  check(timeout <= COAP_SERVER_ACK_TIMEOUT,
+        "respuesta pendiente: el plazo limita la espera del servidor");
+
+  // Dos retransmisiones, con el plazo doblado cada vez
+  for (uint_t i = 1; i <= 2; i++)
+  {
+    sent = s_sent_count;
+    expire_slot(entry);
+    check(s_sent_count == sent + 1 && s_sent[sent].mid == mid &&
+              s_sent[sent].clientPort == 5000 && entry->retransmitCount == i &&
+              entry->timeout == (COAP_SERVER_ACK_TIMEOUT << i),
+          "respuesta separada: retransmisión con back-off");
+  }
+
+  // El ACK del cliente libera la entrada
+  osAcquireMutex(&s_context.mutex);
+  s_context.clientIpAddr = s_context.exchange.clientIpAddr;
+  s_context.clientPort = 5000;
+  coapServerProcessWorkerAck(&s_context, mid);
+  osReleaseMutex(&s_context.mutex);
+  check(entry->length == 0, "respuesta separada: el ACK libera la entrada");
+}
+
+/* Respuesta separada sin ACK */
+static void test_separate_lost(void)
+{
+  CoapServerSeparateResponse *entry;
+  uint_t sent;
+
+  entry = slow_request(5002, 0x0103);
+  if (entry == NULL)
+    return;
+
+  sent = s_sent_count;
+  for (uint_t i = 0; i <= COAP_SERVER_MAX_RETRANSMIT; i++)
+    expire_slot(entry);
+
+  check(s_sent_count == sent + COAP_SERVER_MAX_RETRANSMIT,
+        "sin ACK: COAP_SERVER_MAX_RETRANSMIT retransmisiones");
+  check(entry->length == 0, "sin ACK: la entrada se libera");
+}
+
+#if (COAP_SERVER_MULTICAST_SUPPORT == ENABLED)
+/* Petición multicast: el worker encola la respuesta */
+static void test_multicast(void)
+{
+  CoapServerDeferredResponse *entry = &s_context.deferredResponses[0];
+  CoapServerExchange *worker;
+  uint_t sent = s_sent_count;
+
+  osResetEvent(&s_context.event);
+  worker = send_request_to(5003, 0x0104, COAP_IPV4_ALL_COAP_NODES_ADDR);
+  check(worker != NULL, "multicast: petición entregada a un worker");
+  if (worker == NULL)
+    return;
+
+  check(wait_idle(worker), "multicast: el worker queda libre");
+  check(s_sent_count == sent && entry->length > 0 &&
+            entry->clientPort == 5003,
+        "multicast: respuesta encolada, no enviada");
+  check(osWaitForEvent(&s_context.event, 0),
+        "multicast: el servidor se despierta para fijar su plazo");
+
+  osAcquireMutex(&s_context.mutex);
+  entry->time -= COAP_SERVER_LEISURE;
+  coapServerMulticastTick(&s_context);
+  osReleaseMutex(&s_context.mutex);
+  check(s_multicast_sent == 1 && entry->length == 0 &&
+            s_context.multicastStats.responses == 1,
+        "multicast: enviada por el tick al vencer su plazo");
+
+  // Las respuestas de error no se envían
+  s_code = COAP_CODE_NOT_FOUND;
+  worker = send_request_to(5003, 0x0105, COAP_IPV4_ALL_COAP_NODES_ADDR);
+  if (worker != NULL)
+    wait_idle(worker);
+  s_code = COAP_CODE_CONTENT;
+  check(entry->length == 0 && s_context.multicastStats.suppressed == 1,
+        "multicast: respuesta de error descartada");
+}
+#endif
+
+int main(void)
+{
+  osCreateMutex(&s_context.mutex);
+  osCreateEvent(&s_context.event);
+  osCreateSemaphore(&s_entered, 0);
+  osCreateSemaphore(&s_resume, 0);
+
+  for (uint_t i = 0; i < COAP_SERVER_MAX_WORKERS; i++)
+  {
+    s_context.workers[i].context = &s_context;
+    osCreateEvent(&s_context.workers[i].startEvent);
+  }
+
+  test_stop_workers();
+
+  // El contexto admite otro arranque después de la parada
+  start_workers();
+  test_separate_ack();
+  test_separate_lost();
+#if (COAP_SERVER_MULTICAST_SUPPORT == ENABLED)
+  test_multicast();
+#endif
+
+  s_context.stop = TRUE;
+  coapServerStopWorkers(&s_context);
+
+  if (s_failures)
+  {
+    printf("Workers: %d comprobaciones fallidas\n", s_failures);
+    return 1;
+  }
+
+  printf("Workers: parada, respuestas separadas, retransmisión, ACK y "
+         "multicast correctos\n");
+  return 0;
+}
@@ -0,0 +1,733 @@
+/**
+ * @file cbor.c
+ * @brief CBOR encoder and decoder (RFC 8949)
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * The encoder streams data items through a small buffer to a user-supplied
+ * function, like the JSON writer. The decoder is a pull parser working in
+ * place on the encoded data: strings are returned as pointers into the
+ * input, so neither side allocates memory
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+//Dependencies
+#include <string.h>
+#include "cpu_endian.h"
+#include "cbor.h"
+
+
+/**
+ * @brief Initialize a CBOR writer
+ * @param[in] writer Pointer to the CBOR writer context
+ * @param[in] callback Function that receives the encoded data
+ * @param[in] param User-defined parameter passed to the callback
+ **/
+
+void cborWriterInit(CborWriter *writer, CborWriterCallback callback,
+   void *param)
+{
+   //Initialize context
+   writer->callback = callback;
+   writer->param = param;
+   writer->error = NO_ERROR;
+   writer->length = 0;
+}
+
+
+/**
+ * @brief Open a map with a known number of pairs
+ * @param[in] writer Pointer to the CBOR writer context
+ * @param[in] count Number of key/value pairs that follow
+ **/
+
+void cborWriterBeginMap(CborWriter *writer, uint_t count)
+{
+   cborWriterHead(writer, CBOR_TYPE_MAP, count);
+}
+
+
+/**
+ * @brief Open an array with a known number of elements
+ * @param[in] writer Pointer to the CBOR writer context
+ * @param[in] count Number of data items that follow
+ **/
+
+void cborWriterBeginArray(CborWriter *writer, uint_t count)
+{
+   cborWriterHead(writer, CBOR_TYPE_ARRAY, count);
+}
+
+
+/**
+ * @brief Open an indefinite-length map
+ *
+ * The map must be closed with cborWriterBreak()
+ *
+ * @param[in] writer Pointer to the CBOR writer context
+ **/
+
+void cborWriterBeginIndefiniteMap(CborWriter *writer)
+{
+   uint8_t c;
+
+   //The additional information field signals an indefinite length
+   c = (CBOR_TYPE_MAP << 5) | CBOR_AI_INDEFINITE;
+   cborWriterWrite(writer, &c, 1);
+}
+
+
+/**
+ * @brief Open an indefinite-length array
+ *
+ * The array must be closed with cborWriterBreak()
+ *
+ * @param[in] writer Pointer to the CBOR writer context
+ **/
+
+void cborWriterBeginIndefiniteArray(CborWriter *writer)
+{
+   uint8_t c;
+
+   //The additional information field signals an indefinite length
+   c = (CBOR_TYPE_ARRAY << 5) | CBOR_AI_INDEFINITE;
+   cborWriterWrite(writer, &c, 1);
+}
+
+
+/**
+ * @brief Close an indefinite-length map or array
+ * @param[in] writer Pointer to the CBOR writer context
+ **/
+
+void cborWriterBreak(CborWriter *writer)
+{
+   uint8_t c;
+
+   //Write the "break" stop code
+   c = CBOR_BREAK;
+   cborWriterWrite(writer, &c, 1);
+}
+
+
+/**
+ * @brief Write a text string
+ * @param[in] writer Pointer to the CBOR writer context
+ * @param[in] value NULL-terminated string (a NULL pointer is written as null)
+ **/
+
+void cborWriterString(CborWriter *writer, const char_t *value)
+{
+   size_t n;
+
+   //Null pointer?
+   if(value == NULL)
+   {
+      cborWriterNull(writer);
+   }
+   else
+   {
+      //Retrieve the length of the string
+      n = osStrlen(value);
+
+      //The length is followed by the UTF-8 encoded string
+      cborWriterHead(writer, CBOR_TYPE_TEXT, (uint32_t) n);
+      cborWriterWrite(writer, value, n);
+   }
+}
+
+
+/**
+ * @brief Write a byte string
+ * @param[in] writer Pointer to the CBOR writer context
+ * @param[in] data Pointer to the bytes to be written
+ * @param[in] length Number of bytes
+ **/
+
+void cborWriterBytes(CborWriter *writer, const void *data, size_t length)
+{
+   //The length is followed by the raw bytes
+   cborWriterHead(writer, CBOR_TYPE_BYTES, (uint32_t) length);
+   cborWriterWrite(writer, data, length);
+}
+
+
+/**
+ * @brief Write a signed integer value
+ * @param[in] writer Pointer to the CBOR writer context
+ * @param[in] value Integer value
+ **/
+
+void cborWriterInt(CborWriter *writer, int32_t value)
+{
+   //Negative integers are encoded as -1 minus the argument
+   if(value >= 0)
+   {
+      cborWriterHead(writer, CBOR_TYPE_UINT, (uint32_t) value);
+   }
+   else
+   {
+      cborWriterHead(writer, CBOR_TYPE_NEGINT, (uint32_t) (-1 - value));
+   }
+}
+
+
+/**
+ * @brief Write an unsigned integer value
+ * @param[in] writer Pointer to the CBOR writer context
+ * @param[in] value Integer value
+ **/
+
+void cborWriterUint(CborWriter *writer, uint32_t value)
+{
+   cborWriterHead(writer, CBOR_TYPE_UINT, value);
+}
+
+
+/**
+ * @brief Write a boolean value
+ * @param[in] writer Pointer to the CBOR writer context
+ * @param[in] value Boolean value
+ **/
+
+void cborWriterBool(CborWriter *writer, bool_t value)
+{
+   //Booleans are simple values
+   cborWriterHead(writer, CBOR_TYPE_SIMPLE,
+      value ? CBOR_SIMPLE_TRUE : CBOR_SIMPLE_FALSE);
+}
+
+
+/**
+ * @brief Write a null value
+ * @param[in] writer Pointer to the CBOR writer context
+ **/
+
+void cborWriterNull(CborWriter *writer)
+{
+   cborWriterHead(writer, CBOR_TYPE_SIMPLE, CBOR_SIMPLE_NULL);
+}
+
+
+/**
+ * @brief Write a map member whose value is a text string
+ * @param[in] writer Pointer to the CBOR writer context
+ * @param[in] name Member name
+ * @param[in] value Member value
+ **/
+
+void cborWriterStringMember(CborWriter *writer, const char_t *name,
+   const char_t *value)
+{
+   cborWriterString(writer, name);
+   cborWriterString(writer, value);
+}
+
+
+/**
+ * @brief Write a map member whose value is a signed integer
+ * @param[in] writer Pointer to the CBOR writer context
+ * @param[in] name Member name
+ * @param[in] value Member value
+ **/
+
+void cborWriterIntMember(CborWriter *writer, const char_t *name,
+   int32_t value)
+{
+   cborWriterString(writer, name);
+   cborWriterInt(writer, value);
+}
+
+
+/**
+ * @brief Write a map member whose value is an unsigned integer
+ * @param[in] writer Pointer to the CBOR writer context
+ * @param[in] name Member name
+ * @param[in] value Member value
+ **/
+
+void cborWriterUintMember(CborWriter *writer, const char_t *name,
+   uint32_t value)
+{
+   cborWriterString(writer, name);
+   cborWriterUint(writer, value);
+}
+
+
+/**
+ * @brief Write a map member whose value is a boolean
+ * @param[in] writer Pointer to the CBOR writer context
+ * @param[in] name Member name
+ * @param[in] value Member value
+ **/
+
+void cborWriterBoolMember(CborWriter *writer, const char_t *name,
+   bool_t value)
+{
+   cborWriterString(writer, name);
+   cborWriterBool(writer, value);
+}
+
+
+/**
+ * @brief Hand the buffered data over to the output function
+ * @param[in] writer Pointer to the CBOR writer context
+ * @return Error code (first error encountered while encoding)
+ **/
+
+error_t cborWriterFlush(CborWriter *writer)
+{
+   //Any data pending?
+   if(!writer->error && writer->length > 0)
+   {
+      //Invoke the output function
+      writer->error = writer->callback(writer->param, writer->buffer,
+         writer->length);
+   }
+
+   //Flush the buffer
+   writer->length = 0;
+
+   //Return status code
+   return writer->error;
+}
+
+
+/**
+ * @brief Write the initial byte of a data item and its argument
+ *
+ * The argument is encoded in the shortest form (preferred serialization,
+ * refer to RFC 8949, section 4.1)
+ *
+ * @param[in] writer Pointer to the CBOR writer context
+ * @param[in] type Major type
+ * @param[in] value Argument (integer value, length or number of elements)
+ **/
+
+void cborWriterHead(CborWriter *writer, CborType type, uint32_t value)
+{
+   size_t n;
+   uint8_t temp[5];
+
+   //Check the magnitude of the argument
+   if(value < CBOR_AI_1_BYTE)
+   {
+      //Small values are held by the initial byte
+      temp[0] = (uint8_t) ((type << 5) | value);
+      n = 1;
+   }
+   else if(value <= 0xFF)
+   {
+      //8-bit argument
+      temp[0] = (uint8_t) ((type << 5) | CBOR_AI_1_BYTE);
+      temp[1] = (uint8_t) value;
+      n = 2;
+   }
+   else if(value <= 0xFFFF)
+   {
+      //16-bit argument, in network byte order
+      temp[0] = (uint8_t) ((type << 5) | CBOR_AI_2_BYTES);
+      STORE16BE(value, temp + 1);
+      n = 3;
+   }
+   else
+   {
+      //32-bit argument, in network byte order
+      temp[0] = (uint8_t) ((type << 5) | CBOR_AI_4_BYTES);
+      STORE32BE(value, temp + 1);
+      n = 5;
+   }
+
+   //Write the head of the data item
+   cborWriterWrite(writer, temp, n);
+}
+
+
+/**
+ * @brief Append raw data to the output buffer
+ * @param[in] writer Pointer to the CBOR writer context
+ * @param[in] data Data to be written
+ * @param[in] length Number of bytes to write
+ **/
+
+void cborWriterWrite(CborWriter *writer, const void *data, size_t length)
+{
+   size_t n;
+   const uint8_t *p;
+
+   //Point to the data to be written
+   p = (const uint8_t *) data;
+
+   //Process the data
+   while(!writer->error && length > 0)
+   {
+      //Flush the buffer when it is full
+      if(writer->length >= CBOR_WRITER_BUFFER_SIZE)
+         cborWriterFlush(writer);
+
+      //Limit the number of bytes to copy at a time
+      n = MIN(length, CBOR_WRITER_BUFFER_SIZE - writer->length);
+
+      //Copy data to the buffer
+      osMemcpy(writer->buffer + writer->length, p, n);
+      writer->length += n;
+
+      //Advance data pointer
+      p += n;
+      length -= n;
+   }
+}
+
+
+/**
+ * @brief Initialize a CBOR reader
+ * @param[in] reader Pointer to the CBOR reader context
+ * @param[in] data Encoded data
+ * @param[in] length Length of the encoded data, in bytes
+ **/
+
+void cborReaderInit(CborReader *reader, const uint8_t *data, size_t length)
+{
+   //Initialize context
+   reader->data = data;
+   reader->length = length;
+   reader->pos = 0;
+}
+
+
+/**
+ * @brief Read the header of the next data item
+ *
+ * For a byte or text string, the content is consumed as well. For an array
+ * or a map, the reader is left on the first element. Indefinite-length
+ * strings are not supported
+ *
+ * @param[in] reader Pointer to the CBOR reader context
+ * @param[out] item Header of the data item
+ * @return Error code
+ **/
+
+error_t cborReadItem(CborReader *reader, CborItem *item)
+{
+   size_t i;
+   size_t k;
+   size_t n;
+   uint8_t ai;
+   const uint8_t *p;
+
+   //End of the encoded data?
+   if(reader->pos >= reader->length)
+      return ERROR_END_OF_STREAM;
+
+   //Point to the initial byte
+   p = reader->data + reader->pos;
+   //Number of bytes left to process
+   n = reader->length - reader->pos;
+
+   //The initial byte holds the major type and the additional information
+   item->type = (CborType) (p[0] >> 5);
+   item->indefinite = FALSE;
+   item->string = NULL;
+   ai = p[0] & 0x1F;
+
+   //Decode the argument
+   if(ai < CBOR_AI_1_BYTE)
+   {
+      //The argument is held by the initial byte
+      item->value = ai;
+      k = 1;
+   }
+   else if(ai <= CBOR_AI_8_BYTES)
+   {
+      //A 1, 2, 4 or 8-byte argument follows, in network byte order
+      k = (size_t) 1 << (ai - CBOR_AI_1_BYTE);
+
+      //Malformed data item?
+      if(n < (k + 1))
+         return ERROR_INVALID_LENGTH;
+
+      //Retrieve the argument
+      for(item->value = 0, i = 1; i <= k; i++)
+      {
+         item->value = (item->value << 8) | p[i];
+      }
+
+      //Length of the head
+      k++;
+   }
+   else if(ai == CBOR_AI_INDEFINITE &&
+      (item->type == CBOR_TYPE_ARRAY || item->type == CBOR_TYPE_MAP))
+   {
+      //The elements are terminated by a "break" stop code
+      item->value = 0;
+      item->indefinite = TRUE;
+      k = 1;
+   }
+   else if(ai == CBOR_AI_INDEFINITE &&
+      (item->type == CBOR_TYPE_BYTES || item->type == CBOR_TYPE_TEXT))
+   {
+      //Indefinite-length strings are not supported
+      return ERROR_UNSUPPORTED_TYPE;
+   }
+   else
+   {
+      //Reserved values, or "break" stop code outside of an indefinite-length
+      //array or map
+      return ERROR_INVALID_SYNTAX;
+   }
+
+   //Byte or text string?
+   if(item->type == CBOR_TYPE_BYTES || item->type == CBOR_TYPE_TEXT)
+   {
+      //Malformed data item?
+      if(item->value > (n - k))
+         return ERROR_INVALID_LENGTH;
+
+      //The content of the string is not copied
+      item->string = p + k;
+      k += (size_t) item->value;
+   }
+
+   //Jump to the next data item
+   reader->pos += k;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Skip the next data item, including nested elements
+ * @param[in] reader Pointer to the CBOR reader context
+ * @return Error code
+ **/
+
+error_t cborSkipItem(CborReader *reader)
+{
+   error_t error;
+   uint_t depth;
+   uint64_t remaining[CBOR_READER_MAX_DEPTH + 1];
+   CborItem item;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //A single data item is skipped at the outermost level. An indefinite
+   //number of elements is denoted by UINT64_MAX
+   depth = 0;
+   remaining[0] = 1;
+
+   //Skip data items until the outermost one is complete
+   while(!error && (depth > 0 || remaining[0] > 0))
+   {
+      //Current array or map complete?
+      if(remaining[depth] == 0)
+      {
+         //Return to the enclosing level
+         depth--;
+      }
+      else if(remaining[depth] == UINT64_MAX && reader->pos < reader->length &&
+         reader->data[reader->pos] == CBOR_BREAK)
+      {
+         //End of an indefinite-length array or map
+         reader->pos++;
+         remaining[depth] = 0;
+      }
+      else
+      {
+         //Read the header of the next data item
+         error = cborReadItem(reader, &item);
+
+         //Check status code
+         if(!error)
+         {
+            //One element less at this level
+            if(remaining[depth] != UINT64_MAX)
+               remaining[depth]--;
+
+            //Check the type of the data item
+            if(item.type == CBOR_TYPE_ARRAY || item.type == CBOR_TYPE_MAP)
+            {
+               //Each element occupies at least one byte
+               if(!item.indefinite && item.value > (reader->length - reader->pos))
+               {
+                  error = ERROR_INVALID_LENGTH;
+               }
+               else if(depth >= CBOR_READER_MAX_DEPTH)
+               {
+                  error = ERROR_OUT_OF_RESOURCES;
+               }
+               else
+               {
+                  //Enter the array or map
+                  depth++;
+
+                  //A map holds pairs of data items
+                  if(item.indefinite)
+                     remaining[depth] = UINT64_MAX;
+                  else if(item.type == CBOR_TYPE_MAP)
+                     remaining[depth] = item.value * 2;
+                  else
+                     remaining[depth] = item.value;
+               }
+            }
+            else if(item.type == CBOR_TYPE_TAG)
+            {
+               //The tagged data item follows the tag
+               if(remaining[depth] != UINT64_MAX)
+                  remaining[depth]++;
+            }
+            else
+            {
+               //Integers, strings and simple values have no nested elements
+            }
+         }
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Search a map for a member whose key is a text string
+ *
+ * The reader must point to the map. On success, the header of the member
+ * value is returned and the reader points right after it
+ *
+ * @param[in] reader Pointer to the CBOR reader context
+ * @param[in] key NULL-terminated string containing the key to search for
+ * @param[out] value Header of the member value
+ * @return Error code
+ **/
+
+error_t cborFindMapKey(CborReader *reader, const char_t *key,
+   CborItem *value)
+{
+   error_t error;
+   bool_t found;
+   size_t pos;
+   uint64_t i;
+   CborItem map;
+
+   //Read the header of the map
+   error = cborReadItem(reader, &map);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //The data item must be a map
+   if(map.type != CBOR_TYPE_MAP)
+      return ERROR_INVALID_TYPE;
+
+   //Initialize flag
+   found = FALSE;
+
+   //Loop through the key/value pairs
+   for(i = 0; !error && !found; i++)
+   {
+      //End of the map?
+      if(map.indefinite)
+      {
+         //An indefinite-length map is terminated by a "break" stop code
+         if(reader->pos < reader->length &&
+            reader->data[reader->pos] == CBOR_BREAK)
+         {
+            error = ERROR_NOT_FOUND;
+         }
+      }
+      else if(i >= map.value)
+      {
+         error = ERROR_NOT_FOUND;
+      }
+
+      //Check status code
+      if(!error)
+      {
+         //Save the position of the key
+         pos = reader->pos;
+
+         //Read the key
+         error = cborReadItem(reader, value);
+
+         //Check status code
+         if(!error)
+         {
+            //Matching key?
+            if(cborCompareText(value, key))
+            {
+               //Read the header of the value
+               error = cborReadItem(reader, value);
+               found = TRUE;
+            }
+            else
+            {
+               //Skip the key, which may be an array or a map, and the value
+               reader->pos = pos;
+               error = cborSkipItem(reader);
+
+               //Check status code
+               if(!error)
+                  error = cborSkipItem(reader);
+            }
+         }
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Compare a text string data item with a NULL-terminated string
+ * @param[in] item Data item
+ * @param[in] value NULL-terminated string
+ * @return TRUE if the item is a text string holding the same characters
+ **/
+
+bool_t cborCompareText(const CborItem *item, const char_t *value)
+{
+   bool_t res;
+   size_t n;
+
+   //Retrieve the length of the string
+   n = osStrlen(value);
+
+   //Compare the text strings
+   if(item->type == CBOR_TYPE_TEXT && item->value == n &&
+      !osMemcmp(item->string, value, n))
+   {
+      res = TRUE;
+   }
+   else
+   {
+      res = FALSE;
+   }
+
+   //Return comparison result
+   return res;
+}
@@ -0,0 +1,200 @@
+/**
+ * @file cbor.h
+ * @brief CBOR encoder and decoder (RFC 8949)
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+
+#ifndef _CBOR_H
+#define _CBOR_H
+
+//Dependencies
+#include "compiler_port.h"
+#include "os_port.h"
+#include "error.h"
+
+//Size of the buffer used to coalesce small writes
+#ifndef CBOR_WRITER_BUFFER_SIZE
+   #define CBOR_WRITER_BUFFER_SIZE 64
+#elif (CBOR_WRITER_BUFFER_SIZE < 16)
+   #error CBOR_WRITER_BUFFER_SIZE parameter is not valid
+#endif
+
+//Maximum nesting level of arrays and maps the decoder can skip
+#ifndef CBOR_READER_MAX_DEPTH
+   #define CBOR_READER_MAX_DEPTH 8
+#elif (CBOR_READER_MAX_DEPTH < 1)
+   #error CBOR_READER_MAX_DEPTH parameter is not valid
+#endif
+
+//Additional information values
+#define CBOR_AI_1_BYTE     24
+#define CBOR_AI_2_BYTES    25
+#define CBOR_AI_4_BYTES    26
+#define CBOR_AI_8_BYTES    27
+#define CBOR_AI_INDEFINITE 31
+
+//Simple values (major type 7)
+#define CBOR_SIMPLE_FALSE 20
+#define CBOR_SIMPLE_TRUE  21
+#define CBOR_SIMPLE_NULL  22
+
+//"break" stop code
+#define CBOR_BREAK 0xFF
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Major types
+ **/
+
+typedef enum
+{
+   CBOR_TYPE_UINT   = 0, ///<Unsigned integer
+   CBOR_TYPE_NEGINT = 1, ///<Negative integer
+   CBOR_TYPE_BYTES  = 2, ///<Byte string
+   CBOR_TYPE_TEXT   = 3, ///<Text string
+   CBOR_TYPE_ARRAY  = 4, ///<Array of data items
+   CBOR_TYPE_MAP    = 5, ///<Map of pairs of data items
+   CBOR_TYPE_TAG    = 6, ///<Tagged data item
+   CBOR_TYPE_SIMPLE = 7  ///<Simple value or floating-point number
+} CborType;
+
+
+/**
+ * @brief Output function
+ *
+ * Invoked each time the internal buffer is full, and once more when the
+ * data item is flushed
+ *
+ **/
+
+typedef error_t (*CborWriterCallback)(void *param, const void *data,
+   size_t length);
+
+
+/**
+ * @brief CBOR writer context
+ *
+ * The writer does not allocate memory. Errors are sticky: once a write
+ * fails, subsequent calls do nothing and cborWriterFlush() reports the
+ * first error
+ *
+ **/
+
+typedef struct
+{
+   CborWriterCallback callback;            ///<Output function
+   void *param;                            ///<User-defined parameter
+   error_t error;                          ///<First error encountered
+   size_t length;                          ///<Number of bytes in the buffer
+   uint8_t buffer[CBOR_WRITER_BUFFER_SIZE]; ///<Output buffer
+} CborWriter;
+
+
+/**
+ * @brief CBOR reader context
+ **/
+
+typedef struct
+{
+   const uint8_t *data; ///<Encoded data
+   size_t length;       ///<Length of the encoded data
+   size_t pos;          ///<Current position
+} CborReader;
+
+
+/**
+ * @brief Data item header
+ *
+ * For byte and text strings, the content is not copied: the item points
+ * to the encoded data
+ *
+ **/
+
+typedef struct
+{
+   CborType type;         ///<Major type
+   uint64_t value;        ///<Integer, string length, number of elements, tag or simple value
+   bool_t indefinite;     ///<Indefinite-length array or map
+   const uint8_t *string; ///<Content of a byte or text string
+} CborItem;
+
+
+//CBOR writer related functions
+void cborWriterInit(CborWriter *writer, CborWriterCallback callback,
+   void *param);
+
+void cborWriterBeginMap(CborWriter *writer, uint_t count);
+void cborWriterBeginArray(CborWriter *writer, uint_t count);
+void cborWriterBeginIndefiniteMap(CborWriter *writer);
+void cborWriterBeginIndefiniteArray(CborWriter *writer);
+void cborWriterBreak(CborWriter *writer);
+
+void cborWriterString(CborWriter *writer, const char_t *value);
+void cborWriterBytes(CborWriter *writer, const void *data, size_t length);
+void cborWriterInt(CborWriter *writer, int32_t value);
+void cborWriterUint(CborWriter *writer, uint32_t value);
+void cborWriterBool(CborWriter *writer, bool_t value);
+void cborWriterNull(CborWriter *writer);
+
+void cborWriterStringMember(CborWriter *writer, const char_t *name,
+   const char_t *value);
+
+void cborWriterIntMember(CborWriter *writer, const char_t *name,
+   int32_t value);
+
+void cborWriterUintMember(CborWriter *writer, const char_t *name,
+   uint32_t value);
+
+void cborWriterBoolMember(CborWriter *writer, const char_t *name,
+   bool_t value);
+
+error_t cborWriterFlush(CborWriter *writer);
+
+void cborWriterHead(CborWriter *writer, CborType type, uint32_t value);
+void cborWriterWrite(CborWriter *writer, const void *data, size_t length);
+
+//CBOR reader related functions
+void cborReaderInit(CborReader *reader, const uint8_t *data, size_t length);
+
+error_t cborReadItem(CborReader *reader, CborItem *item);
+error_t cborSkipItem(CborReader *reader);
+
+error_t cborFindMapKey(CborReader *reader, const char_t *key,
+   CborItem *value);
+
+bool_t cborCompareText(const CborItem *item, const char_t *value);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
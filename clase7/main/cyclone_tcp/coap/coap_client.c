@@ -37,6 +37,7 @@
 #include "coap/coap_client.h"
 #include "coap/coap_client_transport.h"
 #include "coap/coap_client_misc.h"
+#include "coap/coap_client_cocoa.h"
 #include "coap/coap_debug.h"
 #include "debug.h"
 
@@ -123,7 +124,7 @@ error_t coapClientInit(CoapClientContext *context)
 /**
  * @brief Set the transport protocol to be used
  * @param[in] context Pointer to the CoAP client context
- * @param[in] transportProtocol Transport protocol to be used (UDP or DTLS)
+ * @param[in] transportProtocol Transport protocol to be used (UDP, DTLS or TCP)
  * @return Error code
  **/
 
@@ -299,11 +300,16 @@ error_t coapClientConnect(CoapClientContext *context,
             context->startTime = time;
             //Update CoAP client state
             context->state = COAP_CLIENT_STATE_CONNECTING;
+
+#if (COAP_CLIENT_COCOA_SUPPORT == ENABLED)
+            //RTT measurements are specific to the server
+            coapClientInitRto(context);
+#endif
          }
       }
       else if(context->state == COAP_CLIENT_STATE_CONNECTING)
       {
-         //Establish DTLS connection
+         //Establish DTLS or TCP connection
          error = coapClientEstablishConnection(context, serverIpAddr,
             serverPort);
 
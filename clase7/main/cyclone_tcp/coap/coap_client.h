@@ -51,6 +51,13 @@
    #error COAP_CLIENT_DTLS_SUPPORT parameter is not valid
 #endif
 
+//CoAP over TCP support
+#ifndef COAP_CLIENT_TCP_SUPPORT
+   #define COAP_CLIENT_TCP_SUPPORT DISABLED
+#elif (COAP_CLIENT_TCP_SUPPORT != ENABLED && COAP_CLIENT_TCP_SUPPORT != DISABLED)
+   #error COAP_CLIENT_TCP_SUPPORT parameter is not valid
+#endif
+
 //CoAP observe support
 #ifndef COAP_CLIENT_OBSERVE_SUPPORT
    #define COAP_CLIENT_OBSERVE_SUPPORT ENABLED
@@ -65,6 +72,13 @@
    #error COAP_CLIENT_BLOCK_SUPPORT parameter is not valid
 #endif
 
+//CoCoA adaptive retransmission timeout support
+#ifndef COAP_CLIENT_COCOA_SUPPORT
+   #define COAP_CLIENT_COCOA_SUPPORT ENABLED
+#elif (COAP_CLIENT_COCOA_SUPPORT != ENABLED && COAP_CLIENT_COCOA_SUPPORT != DISABLED)
+   #error COAP_CLIENT_COCOA_SUPPORT parameter is not valid
+#endif
+
 //CoAP client tick interval
 #ifndef COAP_CLIENT_TICK_INTERVAL
    #define COAP_CLIENT_TICK_INTERVAL 100
@@ -86,6 +100,13 @@
    #error COAP_CLIENT_NSTART parameter is not valid
 #endif
 
+//Maximum number of requests (outstanding or waiting to be sent)
+#ifndef COAP_CLIENT_MAX_REQUESTS
+   #define COAP_CLIENT_MAX_REQUESTS 4
+#elif (COAP_CLIENT_MAX_REQUESTS < COAP_CLIENT_NSTART)
+   #error COAP_CLIENT_MAX_REQUESTS parameter is not valid
+#endif
+
 //Maximum number of retransmissions
 #ifndef COAP_CLIENT_MAX_RETRANSMIT
    #define COAP_CLIENT_MAX_RETRANSMIT 4
@@ -107,6 +128,20 @@
    #error COAP_CLIENT_ACK_TIMEOUT_MAX parameter is not valid
 #endif
 
+//Lower bound of the retransmission timeout estimated by CoCoA
+#ifndef COAP_CLIENT_RTO_MIN
+   #define COAP_CLIENT_RTO_MIN 100
+#elif (COAP_CLIENT_RTO_MIN < 10)
+   #error COAP_CLIENT_RTO_MIN parameter is not valid
+#endif
+
+//Upper bound of the retransmission timeout estimated by CoCoA
+#ifndef COAP_CLIENT_RTO_MAX
+   #define COAP_CLIENT_RTO_MAX 32000
+#elif (COAP_CLIENT_RTO_MAX < COAP_CLIENT_ACK_TIMEOUT_MAX)
+   #error COAP_CLIENT_RTO_MAX parameter is not valid
+#endif
+
 //Random delay after Max-Age has expired (minimum)
 #ifndef COAP_CLIENT_RAND_DELAY_MIN
    #define COAP_CLIENT_RAND_DELAY_MIN 5000
@@ -181,6 +216,18 @@ typedef error_t (*CoapClientDtlsInitCallback)(CoapClientContext *context,
 #endif
 
 
+/**
+ * @brief Round-trip time estimator
+ **/
+
+typedef struct
+{
+   bool_t valid;     ///<At least one RTT sample has been taken
+   systime_t srtt;   ///<Smoothed round-trip time
+   systime_t rttvar; ///<Round-trip time variation
+} CoapClientRttEstimator;
+
+
 /**
  * @brief CoAP client context
  **/
@@ -190,19 +237,29 @@ struct _CoapClientContext
    OsMutex mutex;                                 ///<Mutex preventing simultaneous access to the context
    OsEvent event;                                 ///<Event object used to receive notifications
    CoapClientState state;                         ///<CoAP client state
-   CoapTransportProtocol transportProtocol;       ///<Transport protocol (UDP or DTLS)
+   CoapTransportProtocol transportProtocol;       ///<Transport protocol (UDP, DTLS or TCP)
    NetInterface *interface;                       ///<Underlying network interface
-   Socket *socket;                                ///<Underlying UDP socket
+   Socket *socket;                                ///<Underlying UDP or TCP socket
 #if (COAP_CLIENT_DTLS_SUPPORT == ENABLED)
    TlsContext *dtlsContext;                       ///<DTLS context
    TlsSessionState dtlsSession;                   ///<DTLS session state
    CoapClientDtlsInitCallback dtlsInitCallback;   ///<DTLS initialization callback
+#endif
+#if (COAP_CLIENT_TCP_SUPPORT == ENABLED)
+   uint8_t rxBuffer[COAP_MAX_MSG_SIZE];           ///<Receive buffer (TCP)
+   size_t rxBufferLen;                            ///<Number of bytes in the receive buffer
+#endif
+#if (COAP_CLIENT_COCOA_SUPPORT == ENABLED)
+   CoapClientRttEstimator strongEstimator;        ///<RTT estimator fed by exchanges without retransmission
+   CoapClientRttEstimator weakEstimator;          ///<RTT estimator fed by exchanges with one or two retransmissions
+   systime_t rto;                                 ///<Overall retransmission timeout
+   systime_t rtoTimestamp;                        ///<Time at which the overall retransmission timeout was last updated
 #endif
    systime_t startTime;                           ///<Start time
    systime_t timeout;                             ///<Timeout value
    uint16_t mid;                                  ///<Message identifier
    size_t tokenLen;                               ///<Token length
-   CoapClientRequest request[COAP_CLIENT_NSTART]; ///<Outstanding CoAP requests
+   CoapClientRequest request[COAP_CLIENT_MAX_REQUESTS]; ///<Outstanding and pending CoAP requests
    CoapMessage response;                          ///<CoAP response message
    COAP_CLIENT_PRIVATE_CONTEXT                    ///<Application specific context
 };
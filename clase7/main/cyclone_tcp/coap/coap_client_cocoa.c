@@ -0,0 +1,267 @@
+/**
+ * @file coap_client_cocoa.c
+ * @brief CoCoA retransmission timeout estimation
+ *
+ * @section Description
+ *
+ * CoCoA replaces the fixed initial timeout of RFC 7252 with a timeout
+ * derived from the round-trip times measured on previous exchanges with the
+ * server. Two estimators are maintained: a strong estimator fed by
+ * exchanges that did not need any retransmission, and a weak estimator fed
+ * by exchanges whose acknowledgment arrived after one or two
+ * retransmissions. Refer to draft-ietf-core-cocoa for more details
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL COAP_TRACE_LEVEL
+
+//Dependencies
+#include "core/net.h"
+#include "coap/coap_client.h"
+#include "coap/coap_client_cocoa.h"
+#include "debug.h"
+
+//Check TCP/IP stack configuration
+#if (COAP_CLIENT_SUPPORT == ENABLED && COAP_CLIENT_COCOA_SUPPORT == ENABLED)
+
+
+/**
+ * @brief Reset the retransmission timeout estimation
+ *
+ * Measurements are specific to a server, so the estimation starts over
+ * each time the client connects
+ *
+ * @param[in] context Pointer to the CoAP client context
+ **/
+
+void coapClientInitRto(CoapClientContext *context)
+{
+   //No RTT sample has been taken yet
+   context->strongEstimator.valid = FALSE;
+   context->weakEstimator.valid = FALSE;
+
+   //The initial RTO is the default ACK_TIMEOUT of RFC 7252
+   context->rto = COAP_CLIENT_ACK_TIMEOUT_MIN;
+   context->rtoTimestamp = osGetSystemTime();
+}
+
+
+/**
+ * @brief Update the retransmission timeout with a new RTT sample
+ *
+ * The RTT is measured from the first transmission of a Confirmable request
+ * to the reception of its acknowledgment. Samples taken after more than two
+ * retransmissions are too ambiguous to be used
+ *
+ * @param[in] request CoAP request handle
+ **/
+
+void coapClientUpdateRto(CoapClientRequest *request)
+{
+   systime_t time;
+   systime_t rtt;
+   systime_t rto;
+   CoapClientContext *context;
+
+   //Point to the CoAP client context
+   context = request->context;
+
+   //Get current time
+   time = osGetSystemTime();
+   //Measure the round-trip time from the first transmission
+   rtt = time - request->startTime;
+
+   //Acknowledgment of the first transmission?
+   if(request->retransmitCount == 1)
+   {
+      //Update the strong estimator
+      rto = coapClientUpdateRttEstimator(&context->strongEstimator, rtt,
+         COAP_CLIENT_COCOA_K_STRONG);
+
+      //RTO := 0.5 * RTO_strong + 0.5 * RTO
+      context->rto = (rto + context->rto) / 2;
+   }
+   else if(request->retransmitCount <= 3)
+   {
+      //Update the weak estimator
+      rto = coapClientUpdateRttEstimator(&context->weakEstimator, rtt,
+         COAP_CLIENT_COCOA_K_WEAK);
+
+      //RTO := 0.25 * RTO_weak + 0.75 * RTO
+      context->rto = (rto + 3 * context->rto) / 4;
+   }
+   else
+   {
+      //The sample is discarded
+      return;
+   }
+
+   //Keep the retransmission timeout within reasonable bounds
+   context->rto = MAX(context->rto, COAP_CLIENT_RTO_MIN);
+   context->rto = MIN(context->rto, COAP_CLIENT_RTO_MAX);
+
+   //Save the time of the update
+   context->rtoTimestamp = time;
+
+   //Debug message
+   TRACE_DEBUG("CoAP RTT = %" PRIu32 " ms, RTO = %" PRIu32 " ms\r\n",
+      (uint32_t) rtt, (uint32_t) context->rto);
+}
+
+
+/**
+ * @brief Feed an RTT estimator with a new sample
+ *
+ * The smoothed RTT and the RTT variation are computed as specified in
+ * RFC 6298, section 2
+ *
+ * @param[in] estimator Pointer to the RTT estimator
+ * @param[in] rtt Round-trip time, in milliseconds
+ * @param[in] k Weight of the RTT variation
+ * @return Retransmission timeout computed by the estimator
+ **/
+
+systime_t coapClientUpdateRttEstimator(CoapClientRttEstimator *estimator,
+   systime_t rtt, uint_t k)
+{
+   systime_t delta;
+
+   //First RTT sample?
+   if(!estimator->valid)
+   {
+      //SRTT := R, RTTVAR := R/2
+      estimator->srtt = rtt;
+      estimator->rttvar = rtt / 2;
+      estimator->valid = TRUE;
+   }
+   else
+   {
+      //Compute |SRTT - R|
+      if(estimator->srtt > rtt)
+      {
+         delta = estimator->srtt - rtt;
+      }
+      else
+      {
+         delta = rtt - estimator->srtt;
+      }
+
+      //RTTVAR := 3/4 * RTTVAR + 1/4 * |SRTT - R|
+      estimator->rttvar = (3 * estimator->rttvar + delta) / 4;
+      //SRTT := 7/8 * SRTT + 1/8 * R
+      estimator->srtt = (7 * estimator->srtt + rtt) / 8;
+   }
+
+   //RTO := SRTT + K * RTTVAR
+   return estimator->srtt + k * estimator->rttvar;
+}
+
+
+/**
+ * @brief Get the timeout of the first transmission of a request
+ *
+ * An estimate that has not been updated for a long time drifts back towards
+ * the default value. The timeout is then randomized between RTO and
+ * RTO * ACK_RANDOM_FACTOR, as in RFC 7252
+ *
+ * @param[in] context Pointer to the CoAP client context
+ * @return Retransmission timeout, in milliseconds
+ **/
+
+systime_t coapClientGetInitialTimeout(CoapClientContext *context)
+{
+   systime_t time;
+
+   //Get current time
+   time = osGetSystemTime();
+
+   //Small RTO that has not been updated for 16 * RTO?
+   if(context->rto < 1000 &&
+      timeCompare(time, context->rtoTimestamp + 16 * context->rto) >= 0)
+   {
+      //The RTO is doubled
+      context->rto *= 2;
+      context->rtoTimestamp = time;
+   }
+   //Large RTO that has not been updated for 4 * RTO?
+   else if(context->rto > 3000 &&
+      timeCompare(time, context->rtoTimestamp + 4 * context->rto) >= 0)
+   {
+      //RTO := (RTO + 2 s) / 2
+      context->rto = (context->rto + COAP_CLIENT_ACK_TIMEOUT_MIN) / 2;
+      context->rtoTimestamp = time;
+   }
+   else
+   {
+      //The estimate is still fresh
+   }
+
+   //Randomize the timeout
+   return netGetRandRange(context->rto, context->rto *
+      COAP_CLIENT_ACK_TIMEOUT_MAX / COAP_CLIENT_ACK_TIMEOUT_MIN);
+}
+
+
+/**
+ * @brief Get the timeout of a retransmission
+ *
+ * The backoff factor depends on the initial timeout of the exchange: small
+ * timeouts grow faster, so that a retransmission caused by a short RTO does
+ * not follow too closely, and large timeouts grow slower (variable backoff
+ * factor)
+ *
+ * @param[in] request CoAP request handle
+ * @return Retransmission timeout, in milliseconds
+ **/
+
+systime_t coapClientGetBackoffTimeout(CoapClientRequest *request)
+{
+   systime_t timeout;
+
+   //Check the initial timeout of the exchange
+   if(request->initialTimeout < 1000)
+   {
+      //The timeout is tripled
+      timeout = request->retransmitTimeout * 3;
+   }
+   else if(request->initialTimeout > 3000)
+   {
+      //The timeout is multiplied by 1.5
+      timeout = request->retransmitTimeout * 3 / 2;
+   }
+   else
+   {
+      //The timeout is doubled
+      timeout = request->retransmitTimeout * 2;
+   }
+
+   //Limit the retransmission timeout
+   return MIN(timeout, COAP_CLIENT_RTO_MAX);
+}
+
+#endif
@@ -1,6 +1,6 @@
 /**
- * @file debug.c
- * @brief Debugging facilities
+ * @file coap_client_cocoa.h
+ * @brief CoCoA retransmission timeout estimation
  *
  * @section License
  *
@@ -8,6 +8,8 @@
  *
  * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
  *
+ * This file is part of CycloneTCP Open.
+ *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
  * as published by the Free Software Foundation; either version 2
@@ -26,39 +28,36 @@
  * @version 2.5.4
  **/
 
+#ifndef _COAP_CLIENT_COCOA_H
+#define _COAP_CLIENT_COCOA_H
+
 //Dependencies
-#include "debug.h"
+#include "core/net.h"
+#include "coap/coap_client.h"
 
+//Constant of the strong estimator
+#define COAP_CLIENT_COCOA_K_STRONG 4
+//Constant of the weak estimator
+#define COAP_CLIENT_COCOA_K_WEAK 1
 
-/**
- * @brief Display the contents of an array
- * @param[in] stream Pointer to a FILE object that identifies an output stream
- * @param[in] prepend String to prepend to the left of each line
- * @param[in] data Pointer to the data array
- * @param[in] length Number of bytes to display
- **/
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
 
-void debugDisplayArray(FILE *stream,
-   const char_t *prepend, const void *data, size_t length)
-{
-   uint_t i;
+//CoAP client related functions
+void coapClientInitRto(CoapClientContext *context);
+void coapClientUpdateRto(CoapClientRequest *request);
 
-   //Dump the contents of the array
-   for(i = 0; i < length; i++)
-   {
-      //Beginning of a new line?
-      if((i % 16) == 0)
-      {
-         TRACE_PRINTF("%s", prepend);
-      }
+systime_t coapClientUpdateRttEstimator(CoapClientRttEstimator *estimator,
+   systime_t rtt, uint_t k);
 
-      //Display current data byte
-      TRACE_PRINTF("%02" PRIX8 " ", *((const uint8_t *) data + i));
+systime_t coapClientGetInitialTimeout(CoapClientContext *context);
+systime_t coapClientGetBackoffTimeout(CoapClientRequest *request);
 
-      //End of current line?
-      if((i % 16) == 15 || i == (length - 1))
-      {
-         TRACE_PRINTF("\r\n");
-      }
-   }
+//C++ guard
+#ifdef __cplusplus
 }
+#endif
+
+#endif
@@ -36,6 +36,7 @@
 #include "core/net.h"
 #include "coap/coap_client.h"
 #include "coap/coap_client_observe.h"
+#include "coap/coap_client_cocoa.h"
 #include "coap/coap_client_transport.h"
 #include "coap/coap_client_misc.h"
 #include "coap/coap_common.h"
@@ -119,7 +120,7 @@ error_t coapClientProcessEvents(CoapClientContext *context, systime_t timeout)
                context->response.length);
 
             //Try to match the response with an outstanding request
-            for(i = 0; i < COAP_CLIENT_NSTART; i++)
+            for(i = 0; i < COAP_CLIENT_MAX_REQUESTS; i++)
             {
                //Apply request/response matching rules
                error = coapClientMatchResponse(&context->request[i],
@@ -169,7 +170,7 @@ error_t coapClientProcessEvents(CoapClientContext *context, systime_t timeout)
       if(error == NO_ERROR)
       {
          //Process request-specific events
-         for(i = 0; i < COAP_CLIENT_NSTART; i++)
+         for(i = 0; i < COAP_CLIENT_MAX_REQUESTS; i++)
          {
             //Manage retransmission for the current request
             error = coapClientProcessRequestEvents(&context->request[i]);
@@ -214,7 +215,15 @@ error_t coapClientProcessRequestEvents(CoapClientRequest *request)
    header = (CoapMessageHeader *) request->message.buffer;
 
    //Check current state
-   if(request->state == COAP_REQ_STATE_TRANSMIT)
+   if(request->state == COAP_REQ_STATE_TRANSMIT &&
+      request->retransmitCount == 0 &&
+      coapClientGetOutstandingCount(context) >= COAP_CLIENT_NSTART)
+   {
+      //A client must limit the number of simultaneous outstanding
+      //interactions to NSTART (refer to RFC 7252, section 4.7). The request
+      //is held back until an outstanding interaction completes
+   }
+   else if(request->state == COAP_REQ_STATE_TRANSMIT)
    {
       //Debug message
       TRACE_INFO("Sending CoAP message (%" PRIuSIZE " bytes)...\r\n",
@@ -236,14 +245,27 @@ error_t coapClientProcessRequestEvents(CoapClientRequest *request)
          //Save request start time
          request->startTime = request->retransmitStartTime;
 
+#if (COAP_CLIENT_COCOA_SUPPORT == ENABLED)
+         //The initial timeout is derived from the RTT measured on previous
+         //exchanges with the server
+         request->retransmitTimeout = coapClientGetInitialTimeout(context);
+         //Save the initial timeout
+         request->initialTimeout = request->retransmitTimeout;
+#else
          //The initial timeout is set to a random duration
          request->retransmitTimeout = netGetRandRange(COAP_CLIENT_ACK_TIMEOUT_MIN,
             COAP_CLIENT_ACK_TIMEOUT_MAX);
+#endif
       }
       else
       {
+#if (COAP_CLIENT_COCOA_SUPPORT == ENABLED)
+         //The backoff factor depends on the initial timeout
+         request->retransmitTimeout = coapClientGetBackoffTimeout(request);
+#else
          //The timeout is doubled
          request->retransmitTimeout *= 2;
+#endif
       }
 
       //Increment retransmission counter
@@ -264,8 +286,10 @@ error_t coapClientProcessRequestEvents(CoapClientRequest *request)
          request->retransmitTimeout) >= 0)
       {
          //The reliable transmission of a message is initiated by marking the
-         //message as Confirmable in the CoAP header
-         if(header->type == COAP_TYPE_CON)
+         //message as Confirmable in the CoAP header. Over TCP, the transport
+         //is reliable and messages are never retransmitted
+         if(header->type == COAP_TYPE_CON &&
+            context->transportProtocol != COAP_TRANSPORT_PROTOCOL_TCP)
          {
             //The sender retransmits the Confirmable message at exponentially
             //increasing intervals, until it receives an acknowledgment or
@@ -332,6 +356,51 @@ error_t coapClientProcessRequestEvents(CoapClientRequest *request)
 }
 
 
+/**
+ * @brief Get the number of outstanding interactions
+ *
+ * An outstanding interaction is a request that has been sent and for which
+ * neither a response nor an acknowledgment has been received yet. Separate
+ * responses and notifications do not count (refer to RFC 7252, section 4.7)
+ *
+ * @param[in] context Pointer to the CoAP client context
+ * @return Number of outstanding interactions
+ **/
+
+uint_t coapClientGetOutstandingCount(CoapClientContext *context)
+{
+   uint_t i;
+   uint_t n;
+   CoapClientRequest *request;
+
+   //Initialize counter
+   n = 0;
+
+   //Congestion control is left to the transport when using TCP
+   if(context->transportProtocol != COAP_TRANSPORT_PROTOCOL_TCP)
+   {
+      //Loop through the CoAP requests
+      for(i = 0; i < COAP_CLIENT_MAX_REQUESTS; i++)
+      {
+         //Point to the current request
+         request = &context->request[i];
+
+         //Check whether the request is awaiting a response or is about to
+         //be retransmitted
+         if(request->state == COAP_REQ_STATE_RECEIVE ||
+            (request->state == COAP_REQ_STATE_TRANSMIT &&
+            request->retransmitCount > 0))
+         {
+            n++;
+         }
+      }
+   }
+
+   //Return the number of outstanding interactions
+   return n;
+}
+
+
 /**
  * @brief Update CoAP request state
  * @param[in] request CoAP request handle
@@ -587,6 +656,17 @@ error_t coapClientProcessResponse(CoapClientRequest *request,
       coapClientSendAck(context, ntohs(header->mid));
    }
 
+#if (COAP_CLIENT_COCOA_SUPPORT == ENABLED)
+   //Acknowledgment of a Confirmable request?
+   if(header->type == COAP_TYPE_ACK &&
+      request->state == COAP_REQ_STATE_RECEIVE &&
+      context->transportProtocol != COAP_TRANSPORT_PROTOCOL_TCP)
+   {
+      //Update the retransmission timeout with the measured RTT
+      coapClientUpdateRto(request);
+   }
+#endif
+
    //Check the type of the response
    if(header->type == COAP_TYPE_ACK &&
       header->code == COAP_CODE_EMPTY)
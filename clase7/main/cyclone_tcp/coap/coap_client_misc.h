@@ -44,6 +44,8 @@ extern "C" {
 error_t coapClientProcessEvents(CoapClientContext *context, systime_t timeout);
 error_t coapClientProcessRequestEvents(CoapClientRequest *request);
 
+uint_t coapClientGetOutstandingCount(CoapClientContext *context);
+
 error_t coapClientChangeRequestState(CoapClientRequest *request,
    CoapRequestState newState);
 
@@ -66,7 +66,7 @@ CoapClientRequest *coapClientCreateRequest(CoapClientContext *context)
       osAcquireMutex(&context->mutex);
 
       //Loop through the CoAP request table
-      for(i = 0; i < COAP_CLIENT_NSTART; i++)
+      for(i = 0; i < COAP_CLIENT_MAX_REQUESTS; i++)
       {
          //Unused request found?
          if(context->request[i].state == COAP_REQ_STATE_UNUSED)
@@ -96,6 +96,9 @@ struct _CoapClientRequest
    systime_t retransmitStartTime; ///<Time at which the last message was sent
    systime_t retransmitTimeout;   ///<Retransmission timeout
    uint_t retransmitCount;        ///<Retransmission counter
+#if (COAP_CLIENT_COCOA_SUPPORT == ENABLED)
+   systime_t initialTimeout;      ///<Retransmission timeout of the first transmission
+#endif
 #if (COAP_CLIENT_OBSERVE_SUPPORT == ENABLED)
    uint32_t observeSeqNum;        ///<Sequence number for reordering detection
 #endif
@@ -51,8 +51,22 @@ error_t coapClientOpenConnection(CoapClientContext *context)
 {
    error_t error;
 
-   //Open a UDP socket
-   context->socket = socketOpen(SOCKET_TYPE_DGRAM, SOCKET_IP_PROTO_UDP);
+#if (COAP_CLIENT_TCP_SUPPORT == ENABLED)
+   //TCP transport protocol?
+   if(context->transportProtocol == COAP_TRANSPORT_PROTOCOL_TCP)
+   {
+      //Open a TCP socket
+      context->socket = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+      //Flush receive buffer
+      context->rxBufferLen = 0;
+   }
+   else
+#endif
+   {
+      //Open a UDP socket
+      context->socket = socketOpen(SOCKET_TYPE_DGRAM, SOCKET_IP_PROTO_UDP);
+   }
+
    //Failed to open socket?
    if(context->socket == NULL)
       return ERROR_OPEN_FAILED;
@@ -132,7 +146,7 @@ error_t coapClientOpenConnection(CoapClientContext *context)
  * @brief Establish network connection
  * @param[in] context Pointer to the CoAP client context
  * @param[in] serverIpAddr IP address of the CoAP server
- * @param[in] serverPort UDP port number
+ * @param[in] serverPort UDP or TCP port number
  * @return Error code
  **/
 
@@ -141,12 +155,32 @@ error_t coapClientEstablishConnection(CoapClientContext *context,
 {
    error_t error;
 
-   //Only accept datagrams from the specified CoAP server
+   //Only accept datagrams from the specified CoAP server. Over TCP, the
+   //function returns a timeout error until the connection is established
    error = socketConnect(context->socket, serverIpAddr, serverPort);
    //Any error to report?
    if(error)
       return error;
 
+#if (COAP_CLIENT_TCP_SUPPORT == ENABLED)
+   //TCP transport protocol?
+   if(context->transportProtocol == COAP_TRANSPORT_PROTOCOL_TCP)
+   {
+      //Sending a message may have to wait for room in the send buffer
+      error = socketSetTimeout(context->socket, context->timeout);
+      //Any error to report?
+      if(error)
+         return error;
+
+      //Each endpoint must send a CSM message as its first message on the
+      //connection (refer to RFC 8323, section 5.3)
+      error = coapClientSendCsm(context);
+      //Any error to report?
+      if(error)
+         return error;
+   }
+#endif
+
 #if (COAP_CLIENT_DTLS_SUPPORT == ENABLED)
    //DTLS transport protocol?
    if(context->transportProtocol == COAP_TRANSPORT_PROTOCOL_DTLS)
@@ -221,7 +255,7 @@ void coapClientCloseConnection(CoapClientContext *context)
    //Valid socket?
    if(context->socket != NULL)
    {
-      //Close UDP socket
+      //Close UDP or TCP socket
       socketClose(context->socket);
       context->socket = NULL;
    }
@@ -241,6 +275,15 @@ error_t coapClientSendDatagram(CoapClientContext *context,
 {
    error_t error;
 
+#if (COAP_CLIENT_TCP_SUPPORT == ENABLED)
+   //TCP transport protocol?
+   if(context->transportProtocol == COAP_TRANSPORT_PROTOCOL_TCP)
+   {
+      //Transmit the message over the connection
+      error = coapClientSendTcpMessage(context, data, length);
+   }
+   else
+#endif
 #if (COAP_CLIENT_DTLS_SUPPORT == ENABLED)
    //DTLS transport protocol?
    if(context->transportProtocol == COAP_TRANSPORT_PROTOCOL_DTLS)
@@ -278,6 +321,15 @@ error_t coapClientReceiveDatagram(CoapClientContext *context,
    //No data has been read yet
    *received = 0;
 
+#if (COAP_CLIENT_TCP_SUPPORT == ENABLED)
+   //TCP transport protocol?
+   if(context->transportProtocol == COAP_TRANSPORT_PROTOCOL_TCP)
+   {
+      //Extract the next message from the connection
+      error = coapClientReceiveTcpMessage(context, data, size, received);
+   }
+   else
+#endif
 #if (COAP_CLIENT_DTLS_SUPPORT == ENABLED)
    //DTLS transport protocol?
    if(context->transportProtocol == COAP_TRANSPORT_PROTOCOL_DTLS)
@@ -310,10 +362,28 @@ error_t coapClientWaitForDatagram(CoapClientContext *context,
 {
    error_t error;
    SocketEventDesc eventDesc[1];
+#if (COAP_CLIENT_TCP_SUPPORT == ENABLED)
+   size_t n;
+   size_t length;
+#endif
 
    //Initialize status code
    error = ERROR_BUFFER_EMPTY;
 
+#if (COAP_CLIENT_TCP_SUPPORT == ENABLED)
+   //TCP transport protocol?
+   if(context->transportProtocol == COAP_TRANSPORT_PROTOCOL_TCP)
+   {
+      //Check whether a complete message is pending in the receive buffer
+      if(!coapParseTcpMessageHeader(context->rxBuffer, context->rxBufferLen,
+         &n, &length) && length <= context->rxBufferLen)
+      {
+         //No need to poll the underlying socket for incoming traffic...
+         error = NO_ERROR;
+      }
+   }
+#endif
+
 #if (COAP_CLIENT_DTLS_SUPPORT == ENABLED)
    //DTLS transport protocol?
    if(context->transportProtocol == COAP_TRANSPORT_PROTOCOL_DTLS)
@@ -334,6 +404,16 @@ error_t coapClientWaitForDatagram(CoapClientContext *context,
       eventDesc[0].socket = context->socket;
       eventDesc[0].eventMask = SOCKET_EVENT_RX_READY;
 
+#if (COAP_CLIENT_TCP_SUPPORT == ENABLED)
+      //TCP connection being established?
+      if(context->transportProtocol == COAP_TRANSPORT_PROTOCOL_TCP &&
+         context->state == COAP_CLIENT_STATE_CONNECTING)
+      {
+         //Wait for the connection to be established or refused
+         eventDesc[0].eventMask = SOCKET_EVENT_CONNECTED | SOCKET_EVENT_CLOSED;
+      }
+#endif
+
       //Release exclusive access to the CoAP client context
       osReleaseMutex(&context->mutex);
 
@@ -349,4 +429,264 @@ error_t coapClientWaitForDatagram(CoapClientContext *context,
    return error;
 }
 
+#if (COAP_CLIENT_TCP_SUPPORT == ENABLED)
+
+/**
+ * @brief Send a CSM message
+ *
+ * The client announces the largest message it accepts. The message is
+ * formatted in the response buffer, which is not in use while the
+ * connection is being established
+ *
+ * @param[in] context Pointer to the CoAP client context
+ * @return Error code
+ **/
+
+error_t coapClientSendCsm(CoapClientContext *context)
+{
+   error_t error;
+   CoapMessage *message;
+   CoapMessageHeader *header;
+
+   //Point to the response buffer
+   message = &context->response;
+   //Point to the CoAP message header
+   header = (CoapMessageHeader *) message->buffer;
+
+   //Format message header
+   header->version = COAP_VERSION_1;
+   header->type = COAP_TYPE_NON;
+   header->tokenLen = 0;
+   header->code = COAP_CODE_CSM;
+   header->mid = 0;
+
+   //Set the length of the CoAP message
+   message->length = sizeof(CoapMessageHeader);
+   message->pos = 0;
+
+   //Add the Max-Message-Size option (refer to RFC 8323, section 5.3.1)
+   error = coapSetUintOption(message, COAP_SIGNAL_OPT_MAX_MESSAGE_SIZE, 0,
+      COAP_CLIENT_TCP_MAX_MSG_SIZE);
+
+   //Check status code
+   if(!error)
+   {
+      //Send the CSM message
+      error = coapClientSendTcpMessage(context, message->buffer,
+         message->length);
+   }
+
+   //Flush the response buffer
+   message->length = 0;
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Send a message over TCP
+ *
+ * The message is stored in the datagram format. Its header is replaced by
+ * the TCP header, and its type and message ID are dropped (refer to
+ * RFC 8323, section 3.2)
+ *
+ * @param[in] context Pointer to the CoAP client context
+ * @param[in] data Pointer to the CoAP message
+ * @param[in] length Length of the CoAP message, in bytes
+ * @return Error code
+ **/
+
+error_t coapClientSendTcpMessage(CoapClientContext *context,
+   const void *data, size_t length)
+{
+   error_t error;
+   size_t n;
+   uint8_t header[COAP_TCP_MAX_HEADER_SIZE];
+
+   //Malformed CoAP message?
+   if(length < sizeof(CoapMessageHeader))
+      return ERROR_INVALID_MESSAGE;
+
+   //Acknowledgement and Reset messages are not used over TCP (refer to
+   //RFC 8323, section 2.2)
+   if(((CoapMessageHeader *) data)->code == COAP_CODE_EMPTY)
+      return NO_ERROR;
+
+   //Format the TCP header
+   error = coapFormatTcpMessageHeader(data, length, 0, header, &n);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Send the TCP header. The segment is only pushed with the last part of
+   //the message
+   error = socketSend(context->socket, header, n, NULL,
+      (length > sizeof(CoapMessageHeader)) ? SOCKET_FLAG_DELAY :
+      SOCKET_FLAG_NO_DELAY);
+
+   //Send the token, the options and the payload, if any
+   if(!error && length > sizeof(CoapMessageHeader))
+   {
+      error = socketSend(context->socket, (const uint8_t *) data +
+         sizeof(CoapMessageHeader), length - sizeof(CoapMessageHeader), NULL,
+         SOCKET_FLAG_NO_DELAY);
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Receive a message over TCP
+ *
+ * Data is accumulated in the receive buffer until a whole message is
+ * available. Signaling messages are processed here, so that only requests
+ * and responses are returned, in the datagram format
+ *
+ * @param[in] context Pointer to the CoAP client context
+ * @param[out] data Buffer into which the received message will be placed
+ * @param[in] size Maximum number of bytes that can be received
+ * @param[out] received Number of bytes that have been received
+ * @return Error code
+ **/
+
+error_t coapClientReceiveTcpMessage(CoapClientContext *context,
+   void *data, size_t size, size_t *received)
+{
+   error_t error;
+   size_t n;
+   size_t length;
+   CoapMessageHeader *header;
+
+   //Any room left in the receive buffer?
+   if(context->rxBufferLen < COAP_MAX_MSG_SIZE)
+   {
+      //Read the data available on the connection, if any
+      error = socketReceive(context->socket, context->rxBuffer +
+         context->rxBufferLen, COAP_MAX_MSG_SIZE - context->rxBufferLen, &n,
+         SOCKET_FLAG_DONT_WAIT);
+
+      //Check status code
+      if(!error)
+      {
+         //Update the length of the receive buffer
+         context->rxBufferLen += n;
+      }
+      else if(error != ERROR_WOULD_BLOCK && error != ERROR_TIMEOUT)
+      {
+         //The connection has been closed or reset by the server
+         return error;
+      }
+      else
+      {
+         //No data available
+      }
+   }
+
+   //Point to the CoAP message header
+   header = (CoapMessageHeader *) data;
+   //No message has been received yet
+   error = ERROR_WOULD_BLOCK;
+
+   //Process the complete messages
+   while(error == ERROR_WOULD_BLOCK && context->rxBufferLen > 0)
+   {
+      //Retrieve the length of the next message
+      error = coapParseTcpMessageHeader(context->rxBuffer,
+         context->rxBufferLen, &n, &length);
+
+      //Incomplete header?
+      if(error == ERROR_BUFFER_UNDERFLOW)
+      {
+         error = ERROR_WOULD_BLOCK;
+         break;
+      }
+
+      //Malformed or oversized message?
+      if(error || length > COAP_CLIENT_TCP_MAX_MSG_SIZE)
+      {
+         //The boundary of the next message is unknown
+         error = ERROR_INVALID_MESSAGE;
+         break;
+      }
+
+      //Incomplete message?
+      if(length > context->rxBufferLen)
+      {
+         error = ERROR_WOULD_BLOCK;
+         break;
+      }
+
+      //Convert the message to the datagram format
+      error = coapDecodeTcpMessage(context->rxBuffer, length, data, size,
+         received);
+
+      //Discard the message from the receive buffer
+      context->rxBufferLen -= length;
+      osMemmove(context->rxBuffer, context->rxBuffer + length,
+         context->rxBufferLen);
+
+      //Any error to report?
+      if(error)
+         break;
+
+      //Signaling message?
+      if(COAP_GET_CODE_CLASS(header->code) == COAP_CODE_CLASS_SIGNALING)
+      {
+         //Check message code
+         if(header->code == COAP_CODE_PING)
+         {
+            //A Ping message is answered with a Pong message that echoes its
+            //token (refer to RFC 8323, section 5.4)
+            header->code = COAP_CODE_PONG;
+
+            //Send the Pong message
+            error = coapClientSendTcpMessage(context, data,
+               sizeof(CoapMessageHeader) + header->tokenLen);
+         }
+         else if(header->code == COAP_CODE_RELEASE ||
+            header->code == COAP_CODE_ABORT)
+         {
+            //The server does not want to use the connection anymore (refer
+            //to RFC 8323, sections 5.5 and 5.6)
+            error = ERROR_CONNECTION_CLOSING;
+         }
+         else
+         {
+            //CSM and Pong messages, as well as signaling messages with an
+            //unknown code, are silently ignored
+         }
+
+         //Wait for a request or a response
+         if(!error)
+         {
+            error = ERROR_WOULD_BLOCK;
+         }
+      }
+      else if(header->code == COAP_CODE_EMPTY)
+      {
+         //Empty messages are silently ignored (refer to RFC 8323,
+         //section 3.4)
+         error = ERROR_WOULD_BLOCK;
+      }
+      else
+      {
+         //A request or a response has been received
+      }
+   }
+
+   //No request or response received?
+   if(error)
+   {
+      *received = 0;
+   }
+
+   //Return status code
+   return error;
+}
+
+#endif
+
 #endif
@@ -35,6 +35,10 @@
 #include "core/net.h"
 #include "coap/coap_client.h"
 
+//Largest message accepted over TCP. Once converted to the datagram format,
+//a message grows by up to two bytes and is terminated by a NULL character
+#define COAP_CLIENT_TCP_MAX_MSG_SIZE (COAP_MAX_MSG_SIZE - 3)
+
 //C++ guard
 #ifdef __cplusplus
 extern "C" {
@@ -59,6 +63,14 @@ error_t coapClientReceiveDatagram(CoapClientContext *context,
 error_t coapClientWaitForDatagram(CoapClientContext *context,
    systime_t timeout);
 
+error_t coapClientSendCsm(CoapClientContext *context);
+
+error_t coapClientSendTcpMessage(CoapClientContext *context,
+   const void *data, size_t length);
+
+error_t coapClientReceiveTcpMessage(CoapClientContext *context,
+   void *data, size_t size, size_t *received);
+
 //C++ guard
 #ifdef __cplusplus
 }
@@ -39,6 +39,9 @@
 //DTLS-secured CoAP port number
 #define COAPS_PORT 5684
 
+//"All CoAP Nodes" IPv4 multicast address (refer to RFC 7252, section 12.8)
+#define COAP_IPV4_ALL_COAP_NODES_ADDR IPV4_ADDR(224, 0, 1, 187)
+
 //CoAP message header size
 #define COAP_HEADER_SIZE 4
 //Maximum acceptable length for tokens
@@ -76,7 +79,8 @@ typedef enum {
 
 typedef enum {
    COAP_TRANSPORT_PROTOCOL_UDP  = 1, ///<UDP protocol
-   COAP_TRANSPORT_PROTOCOL_DTLS = 2  ///<DTLS protocol
+   COAP_TRANSPORT_PROTOCOL_DTLS = 2, ///<DTLS protocol
+   COAP_TRANSPORT_PROTOCOL_TCP  = 3  ///<TCP protocol
 } CoapTransportProtocol;
 
 
@@ -101,7 +105,8 @@ typedef enum
 {
    COAP_CODE_CLASS_SUCCESS      = 2,
    COAP_CODE_CLASS_CLIENT_ERROR = 4,
-   COAP_CODE_CLASS_SERVER_ERROR = 5
+   COAP_CODE_CLASS_SERVER_ERROR = 5,
+   COAP_CODE_CLASS_SIGNALING    = 7
 } CoapCodeClass;
 
 
@@ -36,6 +36,7 @@
 #include "coap/coap_client.h"
 #include "coap/coap_server.h"
 #include "coap/coap_message.h"
+#include "coap/coap_option.h"
 #include "debug.h"
 
 //Check TCP/IP stack configuration
@@ -49,11 +50,32 @@
  **/
 
 error_t coapParseMessage(const CoapMessage *message)
+{
+   //Parse the message without indexing its options
+   return coapParseMessageEx(message, NULL);
+}
+
+
+/**
+ * @brief Parse CoAP message and build its option index
+ *
+ * The option list is walked once. Each option is recorded in the index by
+ * number, offset and length, so that later lookups do not need to parse
+ * the message again
+ *
+ * @param[in] message Pointer to the CoAP message
+ * @param[out] index Option index (optional parameter)
+ * @return Error code
+ **/
+
+error_t coapParseMessageEx(const CoapMessage *message, CoapOptionIndex *index)
 {
    error_t error;
    size_t n;
    size_t length;
    const uint8_t *p;
+   CoapOption option;
+   CoapOptionIndexEntry *entry;
 
    //Point to the first byte of the CoAP message
    p = message->buffer;
@@ -71,16 +93,63 @@ error_t coapParseMessage(const CoapMessage *message)
    //Number of bytes left to process
    length -= n;
 
-   //Parse the list of options
-   error = coapParseOptions(p, length, &n);
-   //Any error to report?
-   if(error)
-      return error;
+   //The second parameter is optional
+   if(index != NULL)
+   {
+      //Initialize option index
+      index->numOptions = 0;
+      index->overflow = FALSE;
+   }
 
-   //Point to the payload
-   p += n;
-   //Number of bytes left to process
-   length -= n;
+   //For the first option in a message, a preceding option instance with
+   //Option Number zero is assumed
+   option.number = 0;
+
+   //Loop through CoAP options
+   while(length > 0)
+   {
+      //Payload marker found?
+      if(*p == COAP_PAYLOAD_MARKER)
+         break;
+
+      //Parse current option
+      error = coapParseOption(p, length, option.number, &option, &n);
+      //Any error to report?
+      if(error)
+         return error;
+
+      //The second parameter is optional
+      if(index != NULL)
+      {
+         //Make sure the index is large enough
+         if(index->numOptions < COAP_MAX_INDEXED_OPTIONS)
+         {
+            //Point to the next entry
+            entry = &index->options[index->numOptions++];
+
+            //Record the location of the option value
+            entry->number = option.number;
+            entry->offset = (uint16_t) (option.value - message->buffer);
+            entry->length = (uint16_t) option.length;
+         }
+         else
+         {
+            //Lookups will fall back to a linear search
+            index->overflow = TRUE;
+         }
+      }
+
+      //Jump to the next option
+      p += n;
+      length -= n;
+   }
+
+   //The second parameter is optional
+   if(index != NULL)
+   {
+      //Save the position of the payload marker
+      index->payloadPos = p - message->buffer;
+   }
 
    //The payload is optional
    if(length > 0)
@@ -141,6 +210,227 @@ error_t coapParseMessageHeader(const uint8_t *p, size_t length,
 }
 
 
+/**
+ * @brief Parse the header of a CoAP message over TCP
+ *
+ * The Len field gives the length of the options and of the payload. When it
+ * does not fit in the first nibble, it is extended by 1, 2 or 4 bytes (refer
+ * to RFC 8323, section 3.2)
+ *
+ * @param[in] p Input stream where to read the message header
+ * @param[in] length Number of bytes available in the input stream
+ * @param[out] headerLen Length of the header, up to and including the Code
+ *   field
+ * @param[out] messageLen Total length of the message
+ * @return Error code
+ **/
+
+error_t coapParseTcpMessageHeader(const uint8_t *p, size_t length,
+   size_t *headerLen, size_t *messageLen)
+{
+   size_t n;
+   uint32_t value;
+
+   //Incomplete header?
+   if(length < 1)
+      return ERROR_BUFFER_UNDERFLOW;
+
+   //The length of the Token field must 0-8 bytes
+   if((p[0] & 0x0F) > COAP_MAX_TOKEN_LEN)
+      return ERROR_INVALID_HEADER;
+
+   //Retrieve the value of the Len field
+   value = p[0] >> 4;
+
+   //Determine the length of the extended length field
+   if(value == COAP_TCP_LEN_8_BITS)
+   {
+      n = 1;
+   }
+   else if(value == COAP_TCP_LEN_16_BITS)
+   {
+      n = 2;
+   }
+   else if(value == COAP_TCP_LEN_32_BITS)
+   {
+      n = 4;
+   }
+   else
+   {
+      n = 0;
+   }
+
+   //Incomplete header?
+   if(length < (n + 2))
+      return ERROR_BUFFER_UNDERFLOW;
+
+   //Decode the extended length
+   if(n == 1)
+   {
+      value = p[1] + COAP_TCP_LEN_MINUS_8_BITS;
+   }
+   else if(n == 2)
+   {
+      value = LOAD16BE(p + 1) + COAP_TCP_LEN_MINUS_16_BITS;
+   }
+   else if(n == 4)
+   {
+      value = LOAD32BE(p + 1);
+
+      //Messages whose length cannot be represented are rejected
+      if(value > 0x7FFFFFFF)
+         return ERROR_INVALID_LENGTH;
+
+      value += COAP_TCP_LEN_MINUS_32_BITS;
+   }
+   else
+   {
+      //The length fits in the first nibble
+   }
+
+   //The header is terminated by the Code field
+   *headerLen = n + 2;
+   //The token, the options and the payload follow the header
+   *messageLen = *headerLen + (p[0] & 0x0F) + value;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Convert a CoAP message received over TCP
+ *
+ * Messages over TCP have neither a type nor a message ID. The message is
+ * stored in the datagram format, as a Non-confirmable message with a zero
+ * message ID, so that it can be processed like a message received over UDP
+ *
+ * @param[in] p Pointer to the message received over TCP
+ * @param[in] length Length of the message, in bytes
+ * @param[out] buffer Buffer where to store the CoAP message
+ * @param[in] size Size of the buffer, in bytes
+ * @param[out] written Length of the CoAP message
+ * @return Error code
+ **/
+
+error_t coapDecodeTcpMessage(const uint8_t *p, size_t length,
+   uint8_t *buffer, size_t size, size_t *written)
+{
+   error_t error;
+   size_t n;
+   size_t messageLen;
+   CoapMessageHeader *header;
+
+   //Parse message header
+   error = coapParseTcpMessageHeader(p, length, &n, &messageLen);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Malformed message?
+   if(messageLen != length)
+      return ERROR_INVALID_LENGTH;
+
+   //Number of bytes following the Code field
+   length -= n;
+
+   //Make sure the buffer is large enough to hold the message
+   if((sizeof(CoapMessageHeader) + length) > size)
+      return ERROR_BUFFER_OVERFLOW;
+
+   //Point to the CoAP message header
+   header = (CoapMessageHeader *) buffer;
+
+   //Format message header
+   header->version = COAP_VERSION_1;
+   header->type = COAP_TYPE_NON;
+   header->tokenLen = p[0] & 0x0F;
+   header->code = p[n - 1];
+   header->mid = 0;
+
+   //Copy the token, the options and the payload
+   osMemcpy(buffer + sizeof(CoapMessageHeader), p + n, length);
+
+   //Length of the CoAP message
+   *written = sizeof(CoapMessageHeader) + length;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Format the header of a CoAP message over TCP
+ *
+ * The message is stored in the datagram format. Over TCP, its first four
+ * bytes are replaced by the header formatted by this function, while the
+ * token, the options and the payload are sent as is. Additional bytes sent
+ * right after the message are accounted for in the Len field
+ *
+ * @param[in] data Pointer to the CoAP message
+ * @param[in] length Length of the CoAP message, in bytes
+ * @param[in] extraLen Number of bytes sent after the message
+ * @param[out] header Buffer where to format the header
+ *   (COAP_TCP_MAX_HEADER_SIZE bytes)
+ * @param[out] headerLen Length of the header
+ * @return Error code
+ **/
+
+error_t coapFormatTcpMessageHeader(const uint8_t *data, size_t length,
+   size_t extraLen, uint8_t *header, size_t *headerLen)
+{
+   size_t n;
+   const CoapMessageHeader *messageHeader;
+
+   //Malformed CoAP message?
+   if(length < sizeof(CoapMessageHeader))
+      return ERROR_INVALID_MESSAGE;
+
+   //Point to the CoAP message header
+   messageHeader = (CoapMessageHeader *) data;
+
+   //Malformed CoAP message?
+   if(length < (sizeof(CoapMessageHeader) + messageHeader->tokenLen))
+      return ERROR_INVALID_MESSAGE;
+
+   //Length of the options and of the payload
+   n = length - sizeof(CoapMessageHeader) - messageHeader->tokenLen + extraLen;
+
+   //Encode the Len field
+   if(n < COAP_TCP_LEN_MINUS_8_BITS)
+   {
+      header[0] = (uint8_t) (n << 4);
+      *headerLen = 1;
+   }
+   else if(n < COAP_TCP_LEN_MINUS_16_BITS)
+   {
+      header[0] = COAP_TCP_LEN_8_BITS << 4;
+      header[1] = (uint8_t) (n - COAP_TCP_LEN_MINUS_8_BITS);
+      *headerLen = 2;
+   }
+   else if(n < COAP_TCP_LEN_MINUS_32_BITS)
+   {
+      header[0] = COAP_TCP_LEN_16_BITS << 4;
+      STORE16BE(n - COAP_TCP_LEN_MINUS_16_BITS, header + 1);
+      *headerLen = 3;
+   }
+   else
+   {
+      header[0] = COAP_TCP_LEN_32_BITS << 4;
+      STORE32BE(n - COAP_TCP_LEN_MINUS_32_BITS, header + 1);
+      *headerLen = 5;
+   }
+
+   //The TKL field follows the Len field
+   header[0] |= messageHeader->tokenLen;
+   //The header is terminated by the Code field
+   header[(*headerLen)++] = messageHeader->code;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
 /**
  * @brief Set message type
  * @param[in] message Pointer to the CoAP message
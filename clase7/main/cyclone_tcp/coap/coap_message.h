@@ -42,6 +42,24 @@
    #error COAP_MAX_MSG_SIZE parameter is not valid
 #endif
 
+//Maximum size of the header of CoAP messages over TCP
+#define COAP_TCP_MAX_HEADER_SIZE 6
+
+//Max-Message-Size assumed until a CSM message is received
+#define COAP_TCP_DEFAULT_MAX_MSG_SIZE 1152
+
+//Length encoding of CoAP messages over TCP
+#define COAP_TCP_LEN_8_BITS        13
+#define COAP_TCP_LEN_16_BITS       14
+#define COAP_TCP_LEN_32_BITS       15
+#define COAP_TCP_LEN_MINUS_8_BITS  13
+#define COAP_TCP_LEN_MINUS_16_BITS 269
+#define COAP_TCP_LEN_MINUS_32_BITS 65805
+
+//Forward declaration of CoapOptionIndex structure
+struct _CoapOptionIndex;
+#define CoapOptionIndex struct _CoapOptionIndex
+
 //C++ guard
 #ifdef __cplusplus
 extern "C" {
@@ -63,9 +81,21 @@ typedef struct
 //CoAP related functions
 error_t coapParseMessage(const CoapMessage *message);
 
+error_t coapParseMessageEx(const CoapMessage *message,
+   CoapOptionIndex *index);
+
 error_t coapParseMessageHeader(const uint8_t *p, size_t length,
    size_t *consumed);
 
+error_t coapParseTcpMessageHeader(const uint8_t *p, size_t length,
+   size_t *headerLen, size_t *messageLen);
+
+error_t coapDecodeTcpMessage(const uint8_t *p, size_t length,
+   uint8_t *buffer, size_t size, size_t *written);
+
+error_t coapFormatTcpMessageHeader(const uint8_t *data, size_t length,
+   size_t extraLen, uint8_t *header, size_t *headerLen);
+
 error_t coapSetType(CoapMessage *message, CoapMessageType type);
 error_t coapGetType(const CoapMessage *message, CoapMessageType *type);
 
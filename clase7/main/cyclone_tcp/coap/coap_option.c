@@ -651,29 +651,9 @@ error_t coapGetOption(const CoapMessage *message, uint16_t optionNum,
 error_t coapGetUintOption(const CoapMessage *message, uint16_t optionNum,
    uint_t optionIndex, uint32_t *optionValue)
 {
-   error_t error;
-   size_t i;
-   size_t n;
-   const uint8_t *p;
-
-   //Search the CoAP message for the specified option number
-   error = coapGetOption(message, optionNum, optionIndex, &p, &n);
-   //Any error to report ?
-   if(error)
-      return error;
-
-   //Initialize integer value
-   *optionValue = 0;
-
-   //Convert the integer from network byte order
-   for(i = 0; i < n; i++)
-   {
-      *optionValue <<= 8;
-      *optionValue += p[i];
-   }
-
-   //Successful processing
-   return NO_ERROR;
+   //Search the whole option list
+   return coapGetIndexedUintOption(message, NULL, optionNum, optionIndex,
+      optionValue);
 }
 
 
@@ -876,11 +856,143 @@ error_t coapSplitRepeatableOption(CoapMessage *message, uint16_t optionNum,
 
 error_t coapJoinRepeatableOption(const CoapMessage *message,
    uint16_t optionNum, char_t *optionValue, size_t maxLen, char_t separator)
+{
+   //Search the whole option list
+   return coapJoinIndexedOption(message, NULL, optionNum, optionValue, maxLen,
+      separator);
+}
+
+
+/**
+ * @brief Get the value of the specified option using an option index
+ * @param[in] message Pointer to the CoAP message
+ * @param[in] index Option index built by coapParseMessageEx() (optional
+ *   parameter)
+ * @param[in] optionNum Option number
+ * @param[in] optionIndex Occurrence index (for repeatable options only)
+ * @param[out] optionValue Pointer to the first byte of the option value
+ * @param[out] optionLen Length of the option, in bytes
+ * @return Error code
+ **/
+
+error_t coapGetIndexedOption(const CoapMessage *message,
+   const CoapOptionIndex *index, uint16_t optionNum, uint_t optionIndex,
+   const uint8_t **optionValue, size_t *optionLen)
+{
+   uint_t i;
+   uint_t left;
+   uint_t right;
+
+   //Without a complete index, the option list must be parsed
+   if(index == NULL || index->overflow)
+   {
+      return coapGetOption(message, optionNum, optionIndex, optionValue,
+         optionLen);
+   }
+
+   //Options are sorted by ascending option number
+   left = 0;
+   right = index->numOptions;
+
+   //Binary search for the first occurrence of the option
+   while(left < right)
+   {
+      //Check the entry in the middle of the interval
+      i = left + (right - left) / 2;
+
+      //Narrow the search interval
+      if(index->options[i].number < optionNum)
+      {
+         left = i + 1;
+      }
+      else
+      {
+         right = i;
+      }
+   }
+
+   //Occurrences of a repeatable option are contiguous
+   if(optionIndex >= (index->numOptions - left))
+      return ERROR_NOT_FOUND;
+
+   //Point to the requested occurrence
+   i = left + optionIndex;
+
+   //The specified option number was not found?
+   if(index->options[i].number != optionNum)
+      return ERROR_NOT_FOUND;
+
+   //Return option value
+   *optionValue = message->buffer + index->options[i].offset;
+   *optionLen = index->options[i].length;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Get the value of the specified uint option using an option index
+ * @param[in] message Pointer to the CoAP message
+ * @param[in] index Option index built by coapParseMessageEx() (optional
+ *   parameter)
+ * @param[in] optionNum Option number to search for
+ * @param[in] optionIndex Occurrence index (for repeatable options only)
+ * @param[out] optionValue Option value (unsigned integer)
+ * @return Error code
+ **/
+
+error_t coapGetIndexedUintOption(const CoapMessage *message,
+   const CoapOptionIndex *index, uint16_t optionNum, uint_t optionIndex,
+   uint32_t *optionValue)
 {
    error_t error;
    size_t i;
    size_t n;
-   uint_t index;
+   const uint8_t *p;
+
+   //Search the CoAP message for the specified option number
+   error = coapGetIndexedOption(message, index, optionNum, optionIndex, &p,
+      &n);
+   //Any error to report ?
+   if(error)
+      return error;
+
+   //Initialize integer value
+   *optionValue = 0;
+
+   //Convert the integer from network byte order
+   for(i = 0; i < n; i++)
+   {
+      *optionValue <<= 8;
+      *optionValue += p[i];
+   }
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Decode a path or query component using an option index
+ * @param[in] message Pointer to the CoAP message
+ * @param[in] index Option index built by coapParseMessageEx() (optional
+ *   parameter)
+ * @param[in] optionNum Option number
+ * @param[out] optionValue Buffer where to copy the path or query component
+ * @param[in] maxLen Maximum number of characters the buffer can hold
+ * @param[in] separator Delimiting character
+ * @return Error code
+ **/
+
+error_t coapJoinIndexedOption(const CoapMessage *message,
+   const CoapOptionIndex *index, uint16_t optionNum, char_t *optionValue,
+   size_t maxLen, char_t separator)
+{
+   error_t error;
+   size_t i;
+   size_t n;
+   uint_t occurrence;
    const uint8_t *p;
 
    //Initialize status code
@@ -888,13 +1000,14 @@ error_t coapJoinRepeatableOption(const CoapMessage *message,
 
    //Initialize variables
    i = 0;
-   index = 0;
+   occurrence = 0;
 
    //Build path or query component
    while(!error)
    {
       //Each option specifies one segment of the component
-      error = coapGetOption(message, optionNum, index++, &p, &n);
+      error = coapGetIndexedOption(message, index, optionNum, occurrence++,
+         &p, &n);
 
       //Check status code
       if(!error)
@@ -941,6 +1054,145 @@ error_t coapJoinRepeatableOption(const CoapMessage *message,
 }
 
 
+/**
+ * @brief Initialize an append-only option writer
+ * @param[out] writer Pointer to the option writer
+ * @param[in] message CoAP message that does not contain any option yet
+ **/
+
+void coapInitOptionWriter(CoapOptionWriter *writer,
+   const CoapMessage *message)
+{
+   //Options will be appended after the header and the token
+   writer->length = message->length;
+   writer->number = 0;
+   writer->count = 0;
+}
+
+
+/**
+ * @brief Append an option to the specified CoAP message
+ * @param[in] writer Pointer to the option writer
+ * @param[in] message Pointer to the CoAP message
+ * @param[in] optionNum Option number
+ * @param[in] optionIndex Occurrence index (for repeatable options only)
+ * @param[in] optionValue Pointer to the first byte of the option value
+ * @param[in] optionLen Length of the option, in bytes
+ * @return Error code
+ **/
+
+error_t coapAppendOption(CoapOptionWriter *writer, CoapMessage *message,
+   uint16_t optionNum, uint_t optionIndex, const uint8_t *optionValue,
+   size_t optionLen)
+{
+   error_t error;
+   bool_t append;
+   size_t n;
+   CoapOption option;
+
+   //Initialize flag
+   append = FALSE;
+
+   //The writer is out of sync once the payload or any option has been added
+   //by other means
+   if(writer->length == message->length)
+   {
+      //New option number or next occurrence of the last option?
+      if(optionNum > writer->number && optionIndex == 0)
+      {
+         append = TRUE;
+      }
+      else if(optionNum == writer->number && optionIndex == writer->count)
+      {
+         append = TRUE;
+      }
+   }
+
+   //Check whether the option can be appended
+   if(append)
+   {
+      //Each option instance in a message specifies the Option Number of the
+      //defined CoAP option, the length of the Option Value, and the Option
+      //Value itself
+      option.number = optionNum;
+      option.length = optionLen;
+      option.value = optionValue;
+
+      //The first pass calculates the required length
+      error = coapFormatOption(NULL, writer->number, &option, &n);
+      //Any error to report?
+      if(error)
+         return error;
+
+      //Make sure the output buffer is large enough to hold the new option
+      if((message->length + n) > COAP_MAX_MSG_SIZE)
+         return ERROR_BUFFER_OVERFLOW;
+
+      //The second pass formats the CoAP option at the end of the message
+      error = coapFormatOption(message->buffer + message->length,
+         writer->number, &option, &n);
+      //Any error to report?
+      if(error)
+         return error;
+
+      //Adjust the length of the CoAP message
+      message->length += n;
+
+      //Keep track of the last appended option
+      if(optionNum != writer->number)
+      {
+         writer->number = optionNum;
+         writer->count = 0;
+      }
+
+      //Update the state of the writer
+      writer->count++;
+      writer->length = message->length;
+   }
+   else
+   {
+      //Insert the option at the right place
+      error = coapSetOption(message, optionNum, optionIndex, optionValue,
+         optionLen);
+
+      //The writer is no longer in sync with the message
+      writer->length = 0;
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Append a uint option to the specified CoAP message
+ * @param[in] writer Pointer to the option writer
+ * @param[in] message Pointer to the CoAP message
+ * @param[in] optionNum Option number
+ * @param[in] optionIndex Occurrence index (for repeatable options only)
+ * @param[in] optionValue Option value (unsigned integer)
+ * @return Error code
+ **/
+
+error_t coapAppendUintOption(CoapOptionWriter *writer, CoapMessage *message,
+   uint16_t optionNum, uint_t optionIndex, uint32_t optionValue)
+{
+   size_t i;
+   uint8_t buffer[4];
+
+   //A sender should represent the integer with as few bytes as possible
+   for(i = 4; optionValue != 0; i--)
+   {
+      buffer[i - 1] = optionValue & 0xFF;
+      optionValue >>= 8;
+   }
+
+   //Append the specified option to the CoAP message
+   return coapAppendOption(writer, message, optionNum, optionIndex,
+      buffer + i, 4 - i);
+}
+
+
 /**
  * @brief Retrieve parameters for a given option number
  * @param[in] optionNum Option number
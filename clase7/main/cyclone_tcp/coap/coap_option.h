@@ -36,6 +36,13 @@
 #include "coap/coap_common.h"
 #include "coap/coap_message.h"
 
+//Maximum number of options that can be indexed per message
+#ifndef COAP_MAX_INDEXED_OPTIONS
+   #define COAP_MAX_INDEXED_OPTIONS 16
+#elif (COAP_MAX_INDEXED_OPTIONS < 1)
+   #error COAP_MAX_INDEXED_OPTIONS parameter is not valid
+#endif
+
 //Option delta encoding
 #define COAP_OPT_DELTA_8_BITS         13
 #define COAP_OPT_DELTA_16_BITS        14
@@ -53,6 +60,10 @@
 //Default Max-Age option value
 #define COAP_DEFAULT_MAX_AGE 60
 
+//Signaling option numbers (refer to RFC 8323, section 5.3)
+#define COAP_SIGNAL_OPT_MAX_MESSAGE_SIZE    2
+#define COAP_SIGNAL_OPT_BLOCK_WISE_TRANSFER 4
+
 //Test whether an option is critical
 #define COAP_IS_OPTION_CRITICAL(num) (((num) & 0x01U) ? TRUE : FALSE)
 //Test whether an option is unsafe to forward
@@ -222,6 +233,51 @@ typedef struct
 } CoapOption;
 
 
+/**
+ * @brief Option index entry
+ **/
+
+typedef struct
+{
+   uint16_t number; ///<Option number
+   uint16_t offset; ///<Offset of the option value from the start of the message
+   uint16_t length; ///<Length of the option value, in bytes
+} CoapOptionIndexEntry;
+
+
+/**
+ * @brief Option index
+ *
+ * Entries are stored in ascending option number order, as they appear in the
+ * message. Offsets are relative to the message buffer, so an index remains
+ * valid when the message is copied
+ **/
+
+struct _CoapOptionIndex
+{
+   uint_t numOptions;                                     ///<Number of indexed options
+   bool_t overflow;                                       ///<Too many options to be indexed
+   size_t payloadPos;                                     ///<Offset of the payload marker
+   CoapOptionIndexEntry options[COAP_MAX_INDEXED_OPTIONS]; ///<Indexed options
+};
+
+
+/**
+ * @brief Append-only option writer
+ *
+ * Options added in ascending order are appended to the end of the message
+ * without re-parsing the option list. The writer falls back to
+ * coapSetOption() when it is out of sync with the message
+ **/
+
+typedef struct
+{
+   size_t length;   ///<Length of the message after the last appended option
+   uint16_t number; ///<Number of the last appended option
+   uint_t count;    ///<Occurrences of the last appended option
+} CoapOptionWriter;
+
+
 /**
  * @brief CoAP option parameters
  **/
@@ -270,6 +326,28 @@ error_t coapSplitRepeatableOption(CoapMessage *message, uint16_t optionNum,
 error_t coapJoinRepeatableOption(const CoapMessage *message,
    uint16_t optionNum, char_t *optionValue, size_t maxLen, char_t separator);
 
+error_t coapGetIndexedOption(const CoapMessage *message,
+   const CoapOptionIndex *index, uint16_t optionNum, uint_t optionIndex,
+   const uint8_t **optionValue, size_t *optionLen);
+
+error_t coapGetIndexedUintOption(const CoapMessage *message,
+   const CoapOptionIndex *index, uint16_t optionNum, uint_t optionIndex,
+   uint32_t *optionValue);
+
+error_t coapJoinIndexedOption(const CoapMessage *message,
+   const CoapOptionIndex *index, uint16_t optionNum, char_t *optionValue,
+   size_t maxLen, char_t separator);
+
+void coapInitOptionWriter(CoapOptionWriter *writer,
+   const CoapMessage *message);
+
+error_t coapAppendOption(CoapOptionWriter *writer, CoapMessage *message,
+   uint16_t optionNum, uint_t optionIndex, const uint8_t *optionValue,
+   size_t optionLen);
+
+error_t coapAppendUintOption(CoapOptionWriter *writer, CoapMessage *message,
+   uint16_t optionNum, uint_t optionIndex, uint32_t optionValue);
+
 const CoapOptionParameters *coapGetOptionParameters(uint16_t optionNum);
 
 //C++ guard
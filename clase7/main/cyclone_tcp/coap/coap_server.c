@@ -36,6 +36,10 @@
 #include "coap/coap_server.h"
 #include "coap/coap_server_transport.h"
 #include "coap/coap_server_misc.h"
+#include "coap/coap_server_observe.h"
+#include "coap/coap_server_worker.h"
+#include "coap/coap_server_tcp.h"
+#include "coap/coap_server_multicast.h"
 #include "coap/coap_debug.h"
 #include "debug.h"
 
@@ -50,17 +54,41 @@
 
 void coapServerGetDefaultSettings(CoapServerSettings *settings)
 {
+#if (COAP_SERVER_MULTICAST_SUPPORT == ENABLED)
+   uint_t i;
+#endif
+
    //Default task parameters
    settings->task = OS_TASK_DEFAULT_PARAMS;
    settings->task.stackSize = COAP_SERVER_STACK_SIZE;
    settings->task.priority = COAP_SERVER_PRIORITY;
 
+#if (COAP_SERVER_WORKER_SUPPORT == ENABLED)
+   //Default worker task parameters
+   settings->workerTask = OS_TASK_DEFAULT_PARAMS;
+   settings->workerTask.stackSize = COAP_SERVER_WORKER_STACK_SIZE;
+   settings->workerTask.priority = COAP_SERVER_WORKER_PRIORITY;
+#endif
+
    //The CoAP server is not bound to any interface
    settings->interface = NULL;
 
    //CoAP port number
    settings->port = COAP_PORT;
 
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+   //CoAP over TCP port number
+   settings->tcpPort = COAP_PORT;
+#endif
+
+#if (COAP_SERVER_MULTICAST_SUPPORT == ENABLED)
+   //The CoAP server does not join any multicast group
+   for(i = 0; i < COAP_SERVER_MAX_MULTICAST_GROUPS; i++)
+   {
+      settings->groupAddr[i] = IP_ADDR_UNSPECIFIED;
+   }
+#endif
+
    //UDP initialization callback
    settings->udpInitCallback = NULL;
 
@@ -85,6 +113,10 @@ error_t coapServerInit(CoapServerContext *context,
    const CoapServerSettings *settings)
 {
    error_t error;
+#if (COAP_SERVER_WORKER_SUPPORT == ENABLED)
+   uint_t i;
+   CoapServerExchange *worker;
+#endif
 
    //Debug message
    TRACE_INFO("Initializing CoAP server...\r\n");
@@ -103,6 +135,12 @@ error_t coapServerInit(CoapServerContext *context,
    //Save user settings
    context->settings = *settings;
 
+   //Initialize message ID of the messages initiated by the server
+   context->mid = (uint16_t) netGetRand();
+
+   //Exchange used by the CoAP server task
+   context->exchange.context = context;
+
    //Initialize status code
    error = NO_ERROR;
 
@@ -113,6 +151,44 @@ error_t coapServerInit(CoapServerContext *context,
       error = ERROR_OUT_OF_RESOURCES;
    }
 
+   //Create a mutex to protect the state shared with the worker tasks
+   if(!osCreateMutex(&context->mutex))
+   {
+      //Failed to create mutex
+      error = ERROR_OUT_OF_RESOURCES;
+   }
+
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+   //Create a mutex to serialize the messages sent over TCP
+   if(!osCreateMutex(&context->tcpMutex))
+   {
+      //Failed to create mutex
+      error = ERROR_OUT_OF_RESOURCES;
+   }
+#endif
+
+#if (COAP_SERVER_WORKER_SUPPORT == ENABLED)
+   //Loop through the worker pool
+   for(i = 0; i < COAP_SERVER_MAX_WORKERS; i++)
+   {
+      //Point to the current worker
+      worker = &context->workers[i];
+
+      //Initialize the worker
+      worker->context = context;
+      worker->taskParams = settings->workerTask;
+      worker->taskId = OS_INVALID_TASK_ID;
+      worker->state = COAP_SERVER_WORKER_STATE_IDLE;
+
+      //Create an event object to hand requests over to the worker
+      if(!osCreateEvent(&worker->startEvent))
+      {
+         //Failed to create event
+         error = ERROR_OUT_OF_RESOURCES;
+      }
+   }
+#endif
+
    //Check status code
    if(error)
    {
@@ -170,6 +246,10 @@ error_t coapServerSetCookieSecret(CoapServerContext *context,
 error_t coapServerStart(CoapServerContext *context)
 {
    error_t error;
+#if (COAP_SERVER_WORKER_SUPPORT == ENABLED)
+   uint_t i;
+   CoapServerExchange *worker;
+#endif
 
    //Make sure the CoAP server context is valid
    if(context == NULL)
@@ -224,10 +304,66 @@ error_t coapServerStart(CoapServerContext *context)
             break;
       }
 
+#if (COAP_SERVER_WORKER_SUPPORT == ENABLED)
+      //Discard the separate responses pending when the server was stopped
+      osMemset(context->separateResponses, 0,
+         sizeof(context->separateResponses));
+#endif
+
+#if (COAP_SERVER_MULTICAST_SUPPORT == ENABLED)
+      //Discard the responses deferred before the server was stopped
+      osMemset(context->deferredResponses, 0, sizeof(context->deferredResponses));
+
+      //Join the multicast groups, if any
+      error = coapServerJoinMulticastGroups(context);
+      //Any error to report?
+      if(error)
+         break;
+#endif
+
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+      //The CoAP server also accepts TCP connections
+      error = coapServerOpenTcpSocket(context);
+      //Any error to report?
+      if(error)
+         break;
+#endif
+
       //Start the CoAP server
       context->stop = FALSE;
       context->running = TRUE;
 
+#if (COAP_SERVER_WORKER_SUPPORT == ENABLED)
+#if (COAP_SERVER_DTLS_SUPPORT == ENABLED)
+      //DTLS records are processed by the CoAP server task, which owns the
+      //DTLS sessions
+      if(context->settings.dtlsInitCallback == NULL)
+#endif
+      {
+         //Loop through the worker pool
+         for(i = 0; i < COAP_SERVER_MAX_WORKERS && !error; i++)
+         {
+            //Point to the current worker
+            worker = &context->workers[i];
+
+            //Create a task
+            worker->taskId = osCreateTask("CoAP Worker",
+               (OsTaskCode) coapServerWorkerTask, worker, &worker->taskParams);
+
+            //Failed to create task?
+            if(worker->taskId == OS_INVALID_TASK_ID)
+            {
+               //Report an error
+               error = ERROR_OUT_OF_RESOURCES;
+            }
+         }
+
+         //Any error to report?
+         if(error)
+            break;
+      }
+#endif
+
       //Create a task
       context->taskId = osCreateTask("CoAP Server", (OsTaskCode) coapServerTask,
          context, &context->taskParams);
@@ -246,12 +382,23 @@ error_t coapServerStart(CoapServerContext *context)
    //Any error to report?
    if(error)
    {
+#if (COAP_SERVER_WORKER_SUPPORT == ENABLED)
+      //Terminate the worker tasks that have already been created
+      context->stop = TRUE;
+      coapServerStopWorkers(context);
+#endif
+
       //Clean up side effects
       context->running = FALSE;
 
       //Close the UDP socket
       socketClose(context->socket);
       context->socket = NULL;
+
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+      //Close the TCP sockets
+      coapServerCloseTcpSockets(context);
+#endif
    }
 
    //Return status code
@@ -292,6 +439,11 @@ error_t coapServerStop(CoapServerContext *context)
       {
          osDelayTask(1);
       }
+
+#if (COAP_SERVER_WORKER_SUPPORT == ENABLED)
+      //Terminate the worker tasks
+      coapServerStopWorkers(context);
+#endif
 #endif
 
 #if (COAP_SERVER_DTLS_SUPPORT == ENABLED)
@@ -306,6 +458,11 @@ error_t coapServerStop(CoapServerContext *context)
       //Close the UDP socket
       socketClose(context->socket);
       context->socket = NULL;
+
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+      //Close the TCP sockets
+      coapServerCloseTcpSockets(context);
+#endif
    }
 
    //Successful processing
@@ -321,7 +478,15 @@ error_t coapServerStop(CoapServerContext *context)
 void coapServerTask(CoapServerContext *context)
 {
    error_t error;
-   SocketEventDesc eventDesc;
+   size_t size;
+   uint8_t *buffer;
+   systime_t timeout;
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+   uint_t i;
+   SocketEventDesc eventDesc[COAP_SERVER_MAX_CONNECTIONS + 2];
+#else
+   SocketEventDesc eventDesc[1];
+#endif
 
 #if (NET_RTOS_SUPPORT == ENABLED)
    //Task prologue
@@ -332,12 +497,56 @@ void coapServerTask(CoapServerContext *context)
    {
 #endif
       //Specify the events the application is interested in
-      eventDesc.socket = context->socket;
-      eventDesc.eventMask = SOCKET_EVENT_RX_READY;
-      eventDesc.eventFlags = 0;
+      eventDesc[0].socket = context->socket;
+      eventDesc[0].eventMask = SOCKET_EVENT_RX_READY;
+      eventDesc[0].eventFlags = 0;
+
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+      //Incoming TCP connections
+      eventDesc[1].socket = context->tcpSocket;
+      eventDesc[1].eventMask = SOCKET_EVENT_ACCEPT;
+      eventDesc[1].eventFlags = 0;
+
+      //Loop through the TCP connections
+      for(i = 0; i < COAP_SERVER_MAX_CONNECTIONS; i++)
+      {
+         //Free entries are skipped by socketPoll()
+         eventDesc[i + 2].socket = context->connections[i].socket;
+         eventDesc[i + 2].eventMask = SOCKET_EVENT_RX_READY;
+         eventDesc[i + 2].eventFlags = 0;
+
+         //Any data waiting in the transmit queue?
+         if(context->connections[i].txBufferLen > 0)
+         {
+            //Wait for room in the send buffer of the socket
+            eventDesc[i + 2].eventMask |= SOCKET_EVENT_TX_READY;
+         }
+      }
+#endif
+
+      //Default polling timeout
+      timeout = COAP_SERVER_TICK_INTERVAL;
+
+#if (COAP_SERVER_WORKER_SUPPORT == ENABLED || COAP_SERVER_MULTICAST_SUPPORT == ENABLED)
+      //The deadlines are updated by the worker tasks
+      osAcquireMutex(&context->mutex);
+
+#if (COAP_SERVER_WORKER_SUPPORT == ENABLED)
+      //Wake up in time to acknowledge slow requests
+      timeout = coapServerGetWorkerTimeout(context, timeout);
+#endif
+
+#if (COAP_SERVER_MULTICAST_SUPPORT == ENABLED)
+      //Wake up in time to send the responses to multicast requests
+      timeout = coapServerGetMulticastTimeout(context, timeout);
+#endif
+
+      //Release exclusive access
+      osReleaseMutex(&context->mutex);
+#endif
 
       //Wait for an event
-      socketPoll(&eventDesc, 1, &context->event, COAP_SERVER_TICK_INTERVAL);
+      socketPoll(eventDesc, arraysize(eventDesc), &context->event, timeout);
 
       //Stop request?
       if(context->stop)
@@ -351,12 +560,29 @@ void coapServerTask(CoapServerContext *context)
       }
 
       //Any datagram received?
-      if(eventDesc.eventFlags != 0)
+      if(eventDesc[0].eventFlags != 0)
       {
+#if (COAP_SERVER_DTLS_SUPPORT == ENABLED)
+         //DTLS-secured communication?
+         if(context->settings.dtlsInitCallback != NULL)
+         {
+            //The datagram is passed to the DTLS implementation
+            buffer = context->buffer;
+            size = COAP_SERVER_BUFFER_SIZE;
+         }
+         else
+#endif
+         {
+            //Plain CoAP messages are received directly into the request
+            //message, where they are parsed in place
+            buffer = context->exchange.request.buffer;
+            size = COAP_MAX_MSG_SIZE;
+         }
+
          //Receive incoming datagram
          error = socketReceiveEx(context->socket, &context->clientIpAddr,
-            &context->clientPort, &context->serverIpAddr, context->buffer,
-            COAP_SERVER_BUFFER_SIZE, &context->bufferLen, 0);
+            &context->clientPort, &context->serverIpAddr, buffer, size,
+            &context->bufferLen, 0);
 
          //Check status code
          if(!error)
@@ -376,15 +602,59 @@ void coapServerTask(CoapServerContext *context)
    #endif
                {
                   //Process the received CoAP message
-                  error = coapServerProcessRequest(context, context->buffer,
+                  error = coapServerProcessRequest(context, buffer,
                      context->bufferLen);
                }
             }
+#if (COAP_SERVER_MULTICAST_SUPPORT == ENABLED)
+            else if(coapServerIsMulticastGroup(context, &context->serverIpAddr))
+            {
+               //Update statistics
+               context->multicastStats.requests++;
+
+               //Requests sent to a group the CoAP server has joined are plain
+               //CoAP messages, whose responses are deferred
+               error = coapServerProcessRequest(context, buffer,
+                  context->bufferLen);
+            }
+#endif
+         }
+      }
+
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+      //Loop through the TCP connections
+      for(i = 0; i < COAP_SERVER_MAX_CONNECTIONS; i++)
+      {
+         //Room available in the send buffer of the current connection?
+         if((eventDesc[i + 2].eventFlags & SOCKET_EVENT_TX_READY) != 0)
+         {
+            //Resume transmission
+            coapServerSendTcpData(context, &context->connections[i]);
+         }
+
+         //Any data received on the current connection?
+         if((eventDesc[i + 2].eventFlags & SOCKET_EVENT_RX_READY) != 0)
+         {
+            //Process the complete messages
+            coapServerReceiveTcpData(context, &context->connections[i]);
          }
       }
 
+      //Any connection request?
+      if(eventDesc[1].eventFlags != 0)
+      {
+         //Accept the connection
+         coapServerAcceptConnection(context);
+      }
+#endif
+
       //Handle periodic operations
       coapServerTick(context);
+
+#if (COAP_SERVER_OBSERVE_SUPPORT == ENABLED)
+      //Send pending notifications
+      coapServerProcessNotifications(context);
+#endif
 #if (NET_RTOS_SUPPORT == ENABLED)
    }
 #endif
@@ -398,11 +668,28 @@ void coapServerTask(CoapServerContext *context)
 
 void coapServerDeinit(CoapServerContext *context)
 {
+#if (COAP_SERVER_WORKER_SUPPORT == ENABLED)
+   uint_t i;
+#endif
+
    //Make sure the CoAP server context is valid
    if(context != NULL)
    {
       //Free previously allocated resources
       osDeleteEvent(&context->event);
+      osDeleteMutex(&context->mutex);
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+      osDeleteMutex(&context->tcpMutex);
+#endif
+
+#if (COAP_SERVER_WORKER_SUPPORT == ENABLED)
+      //Loop through the worker pool
+      for(i = 0; i < COAP_SERVER_MAX_WORKERS; i++)
+      {
+         //Release the event object of the worker
+         osDeleteEvent(&context->workers[i].startEvent);
+      }
+#endif
 
       //Clear CoAP server context
       osMemset(context, 0, sizeof(CoapServerContext));
@@ -51,6 +51,48 @@
    #error COAP_SERVER_DTLS_SUPPORT parameter is not valid
 #endif
 
+//CoAP over TCP support
+#ifndef COAP_SERVER_TCP_SUPPORT
+   #define COAP_SERVER_TCP_SUPPORT DISABLED
+#elif (COAP_SERVER_TCP_SUPPORT != ENABLED && COAP_SERVER_TCP_SUPPORT != DISABLED)
+   #error COAP_SERVER_TCP_SUPPORT parameter is not valid
+#endif
+
+//Multicast support
+#ifndef COAP_SERVER_MULTICAST_SUPPORT
+   #define COAP_SERVER_MULTICAST_SUPPORT DISABLED
+#elif (COAP_SERVER_MULTICAST_SUPPORT != ENABLED && COAP_SERVER_MULTICAST_SUPPORT != DISABLED)
+   #error COAP_SERVER_MULTICAST_SUPPORT parameter is not valid
+#endif
+
+//Observe support
+#ifndef COAP_SERVER_OBSERVE_SUPPORT
+   #define COAP_SERVER_OBSERVE_SUPPORT ENABLED
+#elif (COAP_SERVER_OBSERVE_SUPPORT != ENABLED && COAP_SERVER_OBSERVE_SUPPORT != DISABLED)
+   #error COAP_SERVER_OBSERVE_SUPPORT parameter is not valid
+#endif
+
+//Block-wise transfer support
+#ifndef COAP_SERVER_BLOCK_SUPPORT
+   #define COAP_SERVER_BLOCK_SUPPORT ENABLED
+#elif (COAP_SERVER_BLOCK_SUPPORT != ENABLED && COAP_SERVER_BLOCK_SUPPORT != DISABLED)
+   #error COAP_SERVER_BLOCK_SUPPORT parameter is not valid
+#endif
+
+//Duplicate detection support
+#ifndef COAP_SERVER_DEDUP_SUPPORT
+   #define COAP_SERVER_DEDUP_SUPPORT ENABLED
+#elif (COAP_SERVER_DEDUP_SUPPORT != ENABLED && COAP_SERVER_DEDUP_SUPPORT != DISABLED)
+   #error COAP_SERVER_DEDUP_SUPPORT parameter is not valid
+#endif
+
+//Worker pool support
+#ifndef COAP_SERVER_WORKER_SUPPORT
+   #define COAP_SERVER_WORKER_SUPPORT ENABLED
+#elif (COAP_SERVER_WORKER_SUPPORT != ENABLED && COAP_SERVER_WORKER_SUPPORT != DISABLED)
+   #error COAP_SERVER_WORKER_SUPPORT parameter is not valid
+#endif
+
 //Stack size required to run the CoAP server
 #ifndef COAP_SERVER_STACK_SIZE
    #define COAP_SERVER_STACK_SIZE 650
@@ -79,6 +121,56 @@
    #error COAP_SERVER_SESSION_TIMEOUT parameter is not valid
 #endif
 
+//Maximum number of simultaneous TCP connections
+#ifndef COAP_SERVER_MAX_CONNECTIONS
+   #define COAP_SERVER_MAX_CONNECTIONS 2
+#elif (COAP_SERVER_MAX_CONNECTIONS < 1)
+   #error COAP_SERVER_MAX_CONNECTIONS parameter is not valid
+#endif
+
+//TCP connection idle timeout
+#ifndef COAP_SERVER_CONNECTION_TIMEOUT
+   #define COAP_SERVER_CONNECTION_TIMEOUT 120000
+#elif (COAP_SERVER_CONNECTION_TIMEOUT < 1000)
+   #error COAP_SERVER_CONNECTION_TIMEOUT parameter is not valid
+#endif
+
+//Time allowed for an Abort message to be delivered before the TCP connection
+//is closed
+#ifndef COAP_SERVER_TCP_ABORT_TIMEOUT
+   #define COAP_SERVER_TCP_ABORT_TIMEOUT 2000
+#elif (COAP_SERVER_TCP_ABORT_TIMEOUT < 0)
+   #error COAP_SERVER_TCP_ABORT_TIMEOUT parameter is not valid
+#endif
+
+//Size of the transmit queue of a TCP connection
+#ifndef COAP_SERVER_TCP_TX_BUFFER_SIZE
+   #define COAP_SERVER_TCP_TX_BUFFER_SIZE 2048
+#elif (COAP_SERVER_TCP_TX_BUFFER_SIZE < (COAP_MAX_MSG_SIZE + COAP_TCP_MAX_HEADER_SIZE))
+   #error COAP_SERVER_TCP_TX_BUFFER_SIZE parameter is not valid
+#endif
+
+//Maximum number of multicast groups the server can join
+#ifndef COAP_SERVER_MAX_MULTICAST_GROUPS
+   #define COAP_SERVER_MAX_MULTICAST_GROUPS 1
+#elif (COAP_SERVER_MAX_MULTICAST_GROUPS < 1)
+   #error COAP_SERVER_MAX_MULTICAST_GROUPS parameter is not valid
+#endif
+
+//Maximum number of responses to multicast requests waiting to be sent
+#ifndef COAP_SERVER_MAX_DEFERRED_RESPONSES
+   #define COAP_SERVER_MAX_DEFERRED_RESPONSES 2
+#elif (COAP_SERVER_MAX_DEFERRED_RESPONSES < 1)
+   #error COAP_SERVER_MAX_DEFERRED_RESPONSES parameter is not valid
+#endif
+
+//Period over which responses to multicast requests are spread (Leisure)
+#ifndef COAP_SERVER_LEISURE
+   #define COAP_SERVER_LEISURE 5000
+#elif (COAP_SERVER_LEISURE < 0)
+   #error COAP_SERVER_LEISURE parameter is not valid
+#endif
+
 //Size of buffer used for input/output operations
 #ifndef COAP_SERVER_BUFFER_SIZE
    #define COAP_SERVER_BUFFER_SIZE 2048
@@ -100,11 +192,148 @@
    #error COAP_SERVER_MAX_URI_LEN parameter is not valid
 #endif
 
+//Maximum number of registered resources
+#ifndef COAP_SERVER_MAX_RESOURCES
+   #define COAP_SERVER_MAX_RESOURCES 16
+#elif (COAP_SERVER_MAX_RESOURCES < 1 || COAP_SERVER_MAX_RESOURCES > 65535)
+   #error COAP_SERVER_MAX_RESOURCES parameter is not valid
+#endif
+
+//Size of the resource hash table (must be a power of two)
+#ifndef COAP_SERVER_RESOURCE_HASH_SIZE
+   #define COAP_SERVER_RESOURCE_HASH_SIZE 32
+#elif (COAP_SERVER_RESOURCE_HASH_SIZE < COAP_SERVER_MAX_RESOURCES || \
+   (COAP_SERVER_RESOURCE_HASH_SIZE & (COAP_SERVER_RESOURCE_HASH_SIZE - 1)) != 0)
+   #error COAP_SERVER_RESOURCE_HASH_SIZE parameter is not valid
+#endif
+
+//Maximum number of content formats advertised by a resource
+#ifndef COAP_SERVER_MAX_CONTENT_FORMATS
+   #define COAP_SERVER_MAX_CONTENT_FORMATS 2
+#elif (COAP_SERVER_MAX_CONTENT_FORMATS < 1)
+   #error COAP_SERVER_MAX_CONTENT_FORMATS parameter is not valid
+#endif
+
+//Size of the buffer holding the /.well-known/core document
+#ifndef COAP_SERVER_LINK_FORMAT_SIZE
+   #define COAP_SERVER_LINK_FORMAT_SIZE 512
+#elif (COAP_SERVER_LINK_FORMAT_SIZE < 1)
+   #error COAP_SERVER_LINK_FORMAT_SIZE parameter is not valid
+#endif
+
+//Maximum number of observers (all resources)
+#ifndef COAP_SERVER_MAX_OBSERVERS
+   #define COAP_SERVER_MAX_OBSERVERS 8
+#elif (COAP_SERVER_MAX_OBSERVERS < 1)
+   #error COAP_SERVER_MAX_OBSERVERS parameter is not valid
+#endif
+
+//Every Nth notification sent to an observer is confirmable
+#ifndef COAP_SERVER_OBSERVE_CON_PERIOD
+   #define COAP_SERVER_OBSERVE_CON_PERIOD 8
+#elif (COAP_SERVER_OBSERVE_CON_PERIOD < 1)
+   #error COAP_SERVER_OBSERVE_CON_PERIOD parameter is not valid
+#endif
+
+//Initial acknowledgment timeout for confirmable messages sent by the server
+#ifndef COAP_SERVER_ACK_TIMEOUT
+   #define COAP_SERVER_ACK_TIMEOUT 2000
+#elif (COAP_SERVER_ACK_TIMEOUT < 1000)
+   #error COAP_SERVER_ACK_TIMEOUT parameter is not valid
+#endif
+
+//Maximum number of retransmissions of a confirmable message
+#ifndef COAP_SERVER_MAX_RETRANSMIT
+   #define COAP_SERVER_MAX_RETRANSMIT 4
+#elif (COAP_SERVER_MAX_RETRANSMIT < 0)
+   #error COAP_SERVER_MAX_RETRANSMIT parameter is not valid
+#endif
+
+//Preferred block size
+#ifndef COAP_SERVER_BLOCK_SIZE
+   #define COAP_SERVER_BLOCK_SIZE 512
+#elif (COAP_SERVER_BLOCK_SIZE != 16 && COAP_SERVER_BLOCK_SIZE != 32 && \
+   COAP_SERVER_BLOCK_SIZE != 64 && COAP_SERVER_BLOCK_SIZE != 128 && \
+   COAP_SERVER_BLOCK_SIZE != 256 && COAP_SERVER_BLOCK_SIZE != 512 && \
+   COAP_SERVER_BLOCK_SIZE != 1024)
+   #error COAP_SERVER_BLOCK_SIZE parameter is not valid
+#endif
+
+//Maximum number of simultaneous Block1 transfers
+#ifndef COAP_SERVER_MAX_BLOCK_TRANSFERS
+   #define COAP_SERVER_MAX_BLOCK_TRANSFERS 2
+#elif (COAP_SERVER_MAX_BLOCK_TRANSFERS < 1)
+   #error COAP_SERVER_MAX_BLOCK_TRANSFERS parameter is not valid
+#endif
+
+//Block1 transfer timeout
+#ifndef COAP_SERVER_BLOCK_TIMEOUT
+   #define COAP_SERVER_BLOCK_TIMEOUT 30000
+#elif (COAP_SERVER_BLOCK_TIMEOUT < 1000)
+   #error COAP_SERVER_BLOCK_TIMEOUT parameter is not valid
+#endif
+
+//Maximum number of requests remembered for duplicate detection
+#ifndef COAP_SERVER_DEDUP_CACHE_SIZE
+   #define COAP_SERVER_DEDUP_CACHE_SIZE 16
+#elif (COAP_SERVER_DEDUP_CACHE_SIZE < 1)
+   #error COAP_SERVER_DEDUP_CACHE_SIZE parameter is not valid
+#endif
+
+//Size of the buffer holding the responses to remembered requests
+#ifndef COAP_SERVER_DEDUP_BUFFER_SIZE
+   #define COAP_SERVER_DEDUP_BUFFER_SIZE 2048
+#elif (COAP_SERVER_DEDUP_BUFFER_SIZE < COAP_MAX_MSG_SIZE)
+   #error COAP_SERVER_DEDUP_BUFFER_SIZE parameter is not valid
+#endif
+
+//Time during which a Message ID is remembered (EXCHANGE_LIFETIME)
+#ifndef COAP_SERVER_EXCHANGE_LIFETIME
+   #define COAP_SERVER_EXCHANGE_LIFETIME 247000
+#elif (COAP_SERVER_EXCHANGE_LIFETIME < 1000)
+   #error COAP_SERVER_EXCHANGE_LIFETIME parameter is not valid
+#endif
+
 //Priority at which the CoAP server should run
 #ifndef COAP_SERVER_PRIORITY
    #define COAP_SERVER_PRIORITY OS_TASK_PRIORITY_NORMAL
 #endif
 
+//Number of worker tasks processing requests concurrently
+#ifndef COAP_SERVER_MAX_WORKERS
+   #define COAP_SERVER_MAX_WORKERS 2
+#elif (COAP_SERVER_MAX_WORKERS < 1)
+   #error COAP_SERVER_MAX_WORKERS parameter is not valid
+#endif
+
+//Stack size required to run a worker task
+#ifndef COAP_SERVER_WORKER_STACK_SIZE
+   #define COAP_SERVER_WORKER_STACK_SIZE 650
+#elif (COAP_SERVER_WORKER_STACK_SIZE < 1)
+   #error COAP_SERVER_WORKER_STACK_SIZE parameter is not valid
+#endif
+
+//Priority at which the worker tasks should run
+#ifndef COAP_SERVER_WORKER_PRIORITY
+   #define COAP_SERVER_WORKER_PRIORITY OS_TASK_PRIORITY_NORMAL
+#endif
+
+//Maximum number of separate responses awaiting acknowledgment
+#ifndef COAP_SERVER_MAX_SEPARATE_RESPONSES
+   #define COAP_SERVER_MAX_SEPARATE_RESPONSES 4
+#elif (COAP_SERVER_MAX_SEPARATE_RESPONSES < 1)
+   #error COAP_SERVER_MAX_SEPARATE_RESPONSES parameter is not valid
+#endif
+
+//Processing time after which a Confirmable request is acknowledged with an
+//empty ACK and answered later with a separate response
+#ifndef COAP_SERVER_SEPARATE_RESPONSE_DELAY
+   #define COAP_SERVER_SEPARATE_RESPONSE_DELAY 1000
+#elif (COAP_SERVER_SEPARATE_RESPONSE_DELAY < 100 || \
+   COAP_SERVER_SEPARATE_RESPONSE_DELAY >= COAP_SERVER_ACK_TIMEOUT)
+   #error COAP_SERVER_SEPARATE_RESPONSE_DELAY parameter is not valid
+#endif
+
 //Application specific context
 #ifndef COAP_SERVER_PRIVATE_CONTEXT
    #define COAP_SERVER_PRIVATE_CONTEXT
@@ -120,6 +349,14 @@
 struct _CoapServerContext;
 #define CoapServerContext struct _CoapServerContext
 
+//Forward declaration of CoapServerExchange structure
+struct _CoapServerExchange;
+#define CoapServerExchange struct _CoapServerExchange
+
+//Forward declaration of CoapServerResource structure
+struct _CoapServerResource;
+#define CoapServerResource struct _CoapServerResource
+
 //Forward declaration of CoapDtlsSession structure
 struct _CoapDtlsSession;
 #define CoapDtlsSession struct _CoapDtlsSession
@@ -151,14 +388,89 @@ typedef error_t (*CoapServerDtlsInitCallback)(CoapServerContext *context,
 #endif
 
 
+/**
+ * @brief Body read callback function
+ *
+ * Copies up to size bytes of the response body, starting at the given
+ * offset. Returning fewer bytes than requested signals the end of the body
+ *
+ **/
+
+typedef error_t (*CoapServerBodyReadCallback)(void *param, size_t offset,
+   void *data, size_t size, size_t *length);
+
+
+/**
+ * @brief Body write callback function
+ *
+ * Receives the request body block by block, in order. The last flag is set
+ * for the final block. The callback is invoked without holding the server
+ * mutex, possibly from several worker tasks for different transfers
+ *
+ **/
+
+typedef error_t (*CoapServerBodyWriteCallback)(void *param, size_t offset,
+   const uint8_t *data, size_t length, bool_t last);
+
+
 /**
  * @brief CoAP request callback function
  **/
 
-typedef error_t (*CoapServerRequestCallback)(CoapServerContext *context,
+typedef error_t (*CoapServerRequestCallback)(CoapServerExchange *exchange,
    CoapCode method, const char_t *uri);
 
 
+/**
+ * @brief Request methods a resource accepts
+ **/
+
+typedef enum
+{
+   COAP_SERVER_METHOD_NONE   = 0x00,
+   COAP_SERVER_METHOD_GET    = 0x01,
+   COAP_SERVER_METHOD_POST   = 0x02,
+   COAP_SERVER_METHOD_PUT    = 0x04,
+   COAP_SERVER_METHOD_DELETE = 0x08,
+   COAP_SERVER_METHOD_FETCH  = 0x10,
+   COAP_SERVER_METHOD_PATCH  = 0x20,
+   COAP_SERVER_METHOD_IPATCH = 0x40,
+   COAP_SERVER_METHOD_ANY    = 0x7F
+} CoapServerMethod;
+
+
+/**
+ * @brief Resource handler
+ **/
+
+typedef error_t (*CoapServerResourceCallback)(CoapServerExchange *exchange,
+   const CoapServerResource *resource, CoapCode method);
+
+
+/**
+ * @brief Resource definition
+ *
+ * The server keeps a pointer to the definition and to its strings, which
+ * must therefore remain valid (typically a constant table). The link
+ * attributes are optional and are only used to build /.well-known/core
+ *
+ **/
+
+struct _CoapServerResource
+{
+   const char_t *path;                                     ///<Resource path (e.g. "/sensors/temp")
+   uint_t methods;                                         ///<Accepted methods (combination of CoapServerMethod flags)
+   const char_t *rt;                                       ///<Resource type attribute (NULL if not present)
+   const char_t *iface;                                    ///<Interface description attribute (NULL if not present)
+   const char_t *title;                                    ///<Title attribute (NULL if not present)
+   uint_t numContentFormats;                               ///<Number of content formats the resource can produce
+   uint16_t contentFormats[COAP_SERVER_MAX_CONTENT_FORMATS]; ///<Content formats the resource can produce
+   bool_t observable;                                      ///<The resource can be observed (RFC 7641)
+   CoapServerResourceCallback callback;                    ///<Handler
+   void *param;                                            ///<User-defined parameter
+};
+
+
 /**
  * @brief CoAP server settings
  **/
@@ -166,8 +478,17 @@ typedef error_t (*CoapServerRequestCallback)(CoapServerContext *context,
 typedef struct
 {
    OsTaskParameters task;                       ///<Task parameters
+#if (COAP_SERVER_WORKER_SUPPORT == ENABLED)
+   OsTaskParameters workerTask;                 ///<Worker task parameters
+#endif
    NetInterface *interface;                     ///<Underlying network interface
    uint16_t port;                               ///<CoAP port number
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+   uint16_t tcpPort;                            ///<CoAP over TCP port number
+#endif
+#if (COAP_SERVER_MULTICAST_SUPPORT == ENABLED)
+   IpAddr groupAddr[COAP_SERVER_MAX_MULTICAST_GROUPS]; ///<Multicast groups to join (unspecified entries are ignored)
+#endif
    CoapServerUdpInitCallback udpInitCallback;   ///<UDP initialization callback
 #if (COAP_SERVER_DTLS_SUPPORT == ENABLED)
    CoapServerDtlsInitCallback dtlsInitCallback; ///<DTLS initialization callback
@@ -176,6 +497,239 @@ typedef struct
 } CoapServerSettings;
 
 
+/**
+ * @brief TCP connection
+ *
+ * Bytes are accumulated in the receive buffer until a whole message is
+ * available (refer to RFC 8323, section 3). Outgoing messages are appended
+ * to the transmit queue as a whole, and the queue is flushed without
+ * blocking whenever the socket becomes writable
+ *
+ **/
+
+typedef struct
+{
+   Socket *socket;                    ///<Underlying TCP socket (NULL if the entry is free)
+   uint_t id;                         ///<Connection identifier
+   IpAddr serverIpAddr;               ///<Server's IP address
+   IpAddr clientIpAddr;               ///<Client's IP address
+   uint16_t clientPort;               ///<Client's port
+   size_t peerMaxMsgSize;             ///<Largest message the client accepts
+   systime_t timestamp;               ///<Time of the last activity
+   bool_t closing;                    ///<A message could not be sent
+   bool_t aborting;                   ///<An Abort message has been sent
+   uint8_t buffer[COAP_MAX_MSG_SIZE]; ///<Receive buffer
+   size_t bufferLen;                  ///<Number of bytes in the receive buffer
+   uint8_t txBuffer[COAP_SERVER_TCP_TX_BUFFER_SIZE]; ///<Transmit queue
+   size_t txBufferLen;                ///<Number of bytes in the transmit queue
+} CoapServerConnection;
+
+
+/**
+ * @brief Observer of a resource
+ *
+ * An observer is identified by the resource, the client endpoint and the
+ * token of the registration request (refer to RFC 7641, section 4.1)
+ *
+ **/
+
+typedef struct
+{
+   uint16_t resource;                 ///<Observed resource (index + 1, 0 if the entry is free)
+   IpAddr serverIpAddr;               ///<Local IP address the registration was received on
+   IpAddr clientIpAddr;               ///<Observer's IP address
+   uint16_t clientPort;               ///<Observer's port
+   uint8_t token[COAP_MAX_TOKEN_LEN]; ///<Token of the registration request
+   size_t tokenLen;                   ///<Length of the token
+   int32_t accept;                    ///<Accept option of the registration request (-1 if absent)
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+   CoapServerConnection *connection;  ///<TCP connection of the observer (NULL for datagrams)
+   uint_t connectionId;               ///<Identifier of the TCP connection
+#endif
+   uint_t count;                      ///<Number of notifications sent
+   uint16_t mid;                      ///<Message ID of the last notification
+   bool_t conPending;                 ///<A confirmable notification awaits acknowledgment
+   uint_t retransmitCount;            ///<Number of retransmissions
+   systime_t timestamp;               ///<Time at which the last confirmable notification was sent
+   systime_t timeout;                 ///<Acknowledgment timeout
+} CoapServerObserver;
+
+
+/**
+ * @brief Observe statistics
+ **/
+
+typedef struct
+{
+   uint32_t registrations;    ///<Observers registered
+   uint32_t deregistrations;  ///<Observers removed at the client's request
+   uint32_t renders;          ///<Representations rendered for notification
+   uint32_t notifications;    ///<Notifications sent (one per observer)
+   uint32_t conNotifications; ///<Confirmable notifications sent
+   uint32_t resets;           ///<Observers removed by a Reset message
+   uint32_t timeouts;         ///<Observers removed after unacknowledged notifications
+} CoapServerObserveStats;
+
+
+/**
+ * @brief Block1 transfer state
+ *
+ * A transfer is identified by the client endpoint and the request URI
+ * (refer to RFC 7959, section 2.4)
+ *
+ **/
+
+typedef struct
+{
+   bool_t active;       ///<The entry is in use
+   bool_t busy;         ///<A worker is processing a block of the transfer
+   IpAddr clientIpAddr; ///<Client's IP address
+   uint16_t clientPort; ///<Client's port
+   uint32_t uriHash;    ///<Hash of the request URI
+   size_t offset;       ///<Number of bytes received so far
+   systime_t timestamp; ///<Time at which the last block was received
+} CoapServerBlockTransfer;
+
+
+/**
+ * @brief Request remembered for duplicate detection
+ *
+ * The response is stored in the circular buffer of the context, starting at
+ * the given offset
+ *
+ **/
+
+typedef struct
+{
+   IpAddr clientIpAddr; ///<Client's IP address
+   uint16_t clientPort; ///<Client's port
+   uint16_t mid;        ///<Message ID of the request
+   systime_t timestamp; ///<Time at which the request was processed
+   size_t offset;       ///<Offset of the response in the buffer
+   size_t length;       ///<Length of the response (0 if no response was sent)
+} CoapServerDedupEntry;
+
+
+/**
+ * @brief Duplicate detection statistics
+ **/
+
+typedef struct
+{
+   uint32_t hits;      ///<Duplicates answered from the cache
+   uint32_t misses;    ///<New requests
+   uint32_t evictions; ///<Entries evicted before the end of their lifetime
+} CoapServerDedupStats;
+
+
+/**
+ * @brief Response to a multicast request
+ *
+ * The response is held until its transmission time, which is chosen at
+ * random within the Leisure period (refer to RFC 7252, section 8.2)
+ *
+ **/
+
+typedef struct
+{
+   IpAddr clientIpAddr;               ///<Client's IP address
+   uint16_t clientPort;               ///<Client's port
+   systime_t time;                    ///<Transmission time
+   uint8_t buffer[COAP_MAX_MSG_SIZE]; ///<Response message
+   size_t length;                     ///<Length of the response (0 if the entry is free)
+} CoapServerDeferredResponse;
+
+
+/**
+ * @brief Multicast statistics
+ **/
+
+typedef struct
+{
+   uint32_t requests;   ///<Requests received on a multicast group
+   uint32_t responses;  ///<Responses sent after a random delay
+   uint32_t suppressed; ///<Error responses that were not sent
+   uint32_t dropped;    ///<Responses dropped because the queue was full
+} CoapServerMulticastStats;
+
+
+/**
+ * @brief Separate response awaiting acknowledgment
+ *
+ * The response is retransmitted by the CoAP server task with an exponential
+ * back-off, so that the worker that formatted it is available again as soon
+ * as it has been sent (refer to RFC 7252, section 5.2.2)
+ *
+ **/
+
+typedef struct
+{
+   IpAddr serverIpAddr;               ///<Server's IP address
+   IpAddr clientIpAddr;               ///<Client's IP address
+   uint16_t clientPort;               ///<Client's port
+   uint16_t mid;                      ///<Message ID of the separate response
+   uint_t retransmitCount;            ///<Number of retransmissions
+   systime_t timestamp;               ///<Time of the last transmission
+   systime_t timeout;                 ///<Acknowledgment timeout
+   uint8_t buffer[COAP_MAX_MSG_SIZE]; ///<Response message
+   size_t length;                     ///<Length of the response (0 if the entry is free)
+} CoapServerSeparateResponse;
+
+
+/**
+ * @brief Worker state
+ **/
+
+typedef enum
+{
+   COAP_SERVER_WORKER_STATE_IDLE = 0,
+   COAP_SERVER_WORKER_STATE_BUSY = 1
+} CoapServerWorkerState;
+
+
+/**
+ * @brief Request/response exchange
+ *
+ * Each request is processed in its own exchange, so that several requests
+ * can be handled at the same time. The server task uses a dedicated
+ * exchange, and each worker task owns another one
+ *
+ **/
+
+struct _CoapServerExchange
+{
+   CoapServerContext *context;               ///<CoAP server context
+#if (COAP_SERVER_WORKER_SUPPORT == ENABLED)
+   OsTaskParameters taskParams;              ///<Task parameters
+   OsTaskId taskId;                          ///<Task identifier
+   OsEvent startEvent;                       ///<Event signaling a new request
+   CoapServerWorkerState state;              ///<Worker state
+   bool_t separate;                          ///<An empty ACK has been sent
+   systime_t timestamp;                      ///<Start of processing
+#endif
+   IpAddr serverIpAddr;                      ///<Server's IP address
+   IpAddr clientIpAddr;                      ///<Client's IP address
+   uint16_t clientPort;                      ///<Client's port
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+   CoapServerConnection *connection;         ///<TCP connection (NULL for datagrams)
+   uint_t connectionId;                      ///<Identifier of the TCP connection
+   const uint8_t *body;                      ///<Body sent right after the response over TCP (NULL if none)
+   size_t bodyLen;                           ///<Length of the body
+#endif
+   char_t uri[COAP_SERVER_MAX_URI_LEN + 1];  ///<Resource identifier
+#if (COAP_SERVER_OBSERVE_SUPPORT == ENABLED)
+   bool_t notification;                      ///<The handler renders an Observe notification, not a client request
+#endif
+   CoapMessage request;                      ///<CoAP request message
+   CoapOptionIndex requestIndex;             ///<Options of the request message
+   CoapMessage response;                     ///<CoAP response message
+   CoapOptionWriter responseWriter;          ///<Options of the response message
+#if (COAP_SERVER_BLOCK_SUPPORT == ENABLED)
+   uint8_t blockBuffer[COAP_SERVER_BLOCK_SIZE + 1]; ///<Block read from a body read callback
+#endif
+};
+
+
 /**
  * @brief DTLS session
  **/
@@ -213,12 +767,52 @@ struct _CoapServerContext
    uint8_t cookieSecret[COAP_SERVER_MAX_COOKIE_SECRET_SIZE]; ///<Cookie secret
    size_t cookieSecretLen;                                   ///<Length of the cookie secret, in bytes
    CoapDtlsSession session[COAP_SERVER_MAX_SESSIONS];        ///<DTLS sessions
+#endif
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+   Socket *tcpSocket;                                        ///<Listening TCP socket
+   CoapServerConnection connections[COAP_SERVER_MAX_CONNECTIONS]; ///<TCP connections
+   CoapServerConnection *connection;                         ///<Connection of the current message (NULL for datagrams)
+   uint_t connectionId;                                      ///<Identifier of the last accepted connection
+   OsMutex tcpMutex;                                         ///<Mutex serializing the messages sent over TCP
 #endif
    uint8_t buffer[COAP_SERVER_BUFFER_SIZE];                  ///<Memory buffer for input/output operations
    size_t bufferLen;                                         ///<Length of the buffer, in bytes
-   char_t uri[COAP_SERVER_MAX_URI_LEN + 1];                  ///<Resource identifier
-   CoapMessage request;                                      ///<CoAP request message
-   CoapMessage response;                                     ///<CoAP response message
+   CoapServerExchange exchange;                              ///<Exchange used by the server task
+#if (COAP_SERVER_WORKER_SUPPORT == ENABLED)
+   CoapServerExchange workers[COAP_SERVER_MAX_WORKERS];      ///<Worker pool
+   CoapServerSeparateResponse separateResponses[COAP_SERVER_MAX_SEPARATE_RESPONSES]; ///<Separate responses awaiting acknowledgment
+#endif
+   OsMutex mutex;                                            ///<Mutex protecting the state shared with the workers
+   uint16_t mid;                                             ///<Message ID of the last message initiated by the server
+   const CoapServerResource *resources[COAP_SERVER_MAX_RESOURCES]; ///<Registered resources
+   uint_t numResources;                                      ///<Number of registered resources
+   uint16_t resourceTable[COAP_SERVER_RESOURCE_HASH_SIZE];   ///<Hash table of resource paths (index + 1)
+   char_t linkFormat[COAP_SERVER_LINK_FORMAT_SIZE];          ///<Cached /.well-known/core document
+   size_t linkFormatLen;                                     ///<Length of the cached document
+   bool_t linkFormatValid;                                   ///<The cached document matches the registry
+#if (COAP_SERVER_DEDUP_SUPPORT == ENABLED)
+   CoapServerDedupEntry dedupEntries[COAP_SERVER_DEDUP_CACHE_SIZE]; ///<Remembered requests (ring)
+   uint_t dedupHead;                                         ///<Index of the oldest entry
+   uint_t dedupCount;                                        ///<Number of entries
+   uint8_t dedupBuffer[COAP_SERVER_DEDUP_BUFFER_SIZE];       ///<Stored responses (circular buffer)
+   size_t dedupWritePos;                                     ///<Write position in the buffer
+   size_t dedupUsed;                                         ///<Number of bytes in use
+   CoapServerDedupStats dedupStats;                          ///<Duplicate detection statistics
+#endif
+#if (COAP_SERVER_BLOCK_SUPPORT == ENABLED)
+   CoapServerBlockTransfer blockTransfers[COAP_SERVER_MAX_BLOCK_TRANSFERS]; ///<Block1 transfers
+#endif
+#if (COAP_SERVER_MULTICAST_SUPPORT == ENABLED)
+   CoapServerDeferredResponse deferredResponses[COAP_SERVER_MAX_DEFERRED_RESPONSES]; ///<Responses to multicast requests
+   CoapServerMulticastStats multicastStats;                  ///<Multicast statistics
+#endif
+#if (COAP_SERVER_OBSERVE_SUPPORT == ENABLED)
+   CoapServerObserver observers[COAP_SERVER_MAX_OBSERVERS];  ///<Observers
+   bool_t notifyPending[COAP_SERVER_MAX_RESOURCES];          ///<Resources whose observers must be notified
+   bool_t notify;                                            ///<At least one notification is pending
+   uint32_t observeSeq;                                      ///<Sequence number of the last notification
+   CoapServerObserveStats observeStats;                      ///<Observe statistics
+#endif
    COAP_SERVER_PRIVATE_CONTEXT                               ///<Application specific context
 };
 
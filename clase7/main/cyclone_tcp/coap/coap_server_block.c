@@ -0,0 +1,648 @@
+/**
+ * @file coap_server_block.c
+ * @brief CoAP server block-wise transfers (RFC 7959)
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL COAP_TRACE_LEVEL
+
+//Dependencies
+#include "coap/coap_server.h"
+#include "coap/coap_server_request.h"
+#include "coap/coap_server_resource.h"
+#include "coap/coap_server_block.h"
+#include "coap/coap_server_tcp.h"
+#include "debug.h"
+
+//Check TCP/IP stack configuration
+#if (COAP_SERVER_SUPPORT == ENABLED && COAP_SERVER_BLOCK_SUPPORT == ENABLED)
+
+//Room reserved for the Block2 and Size2 options and the payload marker
+#define COAP_SERVER_BLOCK_OVERHEAD 16
+
+
+/**
+ * @brief Set the response body from a memory range
+ *
+ * The body is sent as is when it fits in a single message. Otherwise the
+ * block requested by the client is sent with a Block2 option (refer to
+ * RFC 7959, section 2.4). The handler is invoked again for each block, and
+ * only the requested slice is copied to the response. Over TCP, a body that
+ * the client accepts in a single message is sent from the memory range
+ * after the handler returns, so the range must remain valid
+ *
+ * @param[in] exchange Pointer to the request/response exchange
+ * @param[in] data Pointer to the body
+ * @param[in] length Length of the body, in bytes
+ * @return Error code
+ **/
+
+error_t coapServerSetBody(CoapServerExchange *exchange, const void *data,
+   size_t length)
+{
+   //Check parameters
+   if(exchange == NULL || (data == NULL && length != 0))
+      return ERROR_INVALID_PARAMETER;
+
+   //Format the requested block
+   return coapServerFormatBody(exchange, data, NULL, NULL, length);
+}
+
+
+/**
+ * @brief Set the response body from a read callback
+ *
+ * The callback is only asked for the block requested by the client, so
+ * that the body is never materialized as a whole
+ *
+ * @param[in] exchange Pointer to the request/response exchange
+ * @param[in] callback Body read callback
+ * @param[in] param Callback parameter
+ * @param[in] length Length of the body, in bytes, or
+ *   COAP_SERVER_BODY_LENGTH_UNKNOWN
+ * @return Error code
+ **/
+
+error_t coapServerSetBodyStream(CoapServerExchange *exchange,
+   CoapServerBodyReadCallback callback, void *param, size_t length)
+{
+   //Check parameters
+   if(exchange == NULL || callback == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Format the requested block
+   return coapServerFormatBody(exchange, NULL, callback, param, length);
+}
+
+
+/**
+ * @brief Receive the request body
+ *
+ * Each block of a Block1 transfer is handed to the callback as soon as it
+ * is received. Intermediate blocks are acknowledged with a 2.31 response;
+ * complete is set once the last block has been processed, and the handler
+ * must then format the final response. Blocks received out of order are
+ * rejected with 4.08, and bodies larger than maxSize with 4.13 (refer to
+ * RFC 7959, section 2.3). A block of a transfer that another worker is
+ * still processing is answered with 5.03, so the callback never runs twice
+ * at once for the same transfer. Transfers from different clients do run
+ * concurrently, and param must then point to per-transfer state
+ *
+ * @param[in] exchange Pointer to the request/response exchange
+ * @param[in] callback Body write callback
+ * @param[in] param Callback parameter
+ * @param[in] maxSize Maximum acceptable body size (0 for no limit)
+ * @param[out] complete The whole body has been received
+ * @return Error code
+ **/
+
+error_t coapServerReceiveBody(CoapServerExchange *exchange,
+   CoapServerBodyWriteCallback callback, void *param, size_t maxSize,
+   bool_t *complete)
+{
+   error_t error;
+   uint_t i;
+   uint_t szx;
+   uint_t ackSzx;
+   bool_t more;
+   bool_t oversize;
+   size_t pos;
+   size_t length;
+   uint32_t value;
+   uint32_t uriHash;
+   CoapCode code;
+   const uint8_t *data;
+   CoapServerContext *context;
+   CoapServerBlockTransfer *transfer;
+
+   //Check parameters
+   if(exchange == NULL || callback == NULL || complete == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Initialize flag
+   *complete = FALSE;
+
+   //Retrieve the payload of the request
+   error = coapServerGetPayload(exchange, &data, &length);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //The Size1 option indicates the size of the whole body, so that a body
+   //that is too large can be rejected before it is transferred
+   if(maxSize > 0 && !coapServerGetUintOption(exchange, COAP_OPT_SIZE1, 0,
+      &value) && value > maxSize)
+   {
+      return coapServerRejectBody(exchange, maxSize);
+   }
+
+   //Search the request for a Block1 option
+   error = coapServerGetUintOption(exchange, COAP_OPT_BLOCK1, 0, &value);
+
+   //The body fits in a single message?
+   if(error)
+   {
+      //Check the length of the body
+      if(maxSize > 0 && length > maxSize)
+         return coapServerRejectBody(exchange, maxSize);
+
+      //Process the body
+      error = callback(param, 0, data, length, TRUE);
+
+      //Check status code
+      if(!error)
+      {
+         *complete = TRUE;
+      }
+      else
+      {
+         error = coapServerSetResponseCode(exchange, COAP_CODE_INTERNAL_SERVER);
+      }
+
+      //Return status code
+      return error;
+   }
+
+   //Decode the Block1 option
+   szx = COAP_GET_BLOCK_SZX(value);
+   pos = COAP_GET_BLOCK_POS(value);
+   more = COAP_GET_BLOCK_M(value);
+
+   //All blocks but the last one must have the indicated size
+   if(szx == COAP_BLOCK_SIZE_RESERVED || (more && length != (16U << szx)))
+      return coapServerSetResponseCode(exchange, COAP_CODE_BAD_REQUEST);
+
+   //Point to the CoAP server context
+   context = exchange->context;
+   //Initialize response code
+   code = COAP_CODE_EMPTY;
+
+   //Check the length of the body
+   oversize = (maxSize > 0 && (pos + length) > maxSize);
+
+   //Transfers are identified by the client endpoint and the request URI
+   uriHash = coapServerHashPath(exchange->uri);
+
+   //The transfer table is shared with the other worker tasks and with the
+   //CoAP server task, which releases stale transfers
+   osAcquireMutex(&context->mutex);
+
+   //Search the table for the transfer
+   transfer = coapServerFindBlockTransfer(exchange, uriHash);
+
+   //Another worker is processing a block of the same transfer?
+   if(transfer != NULL && transfer->busy)
+   {
+      //The client will retransmit the block
+      code = COAP_CODE_SERVICE_UNAVAILABLE;
+   }
+   else if(oversize)
+   {
+      //Abort the transfer
+      if(transfer != NULL)
+      {
+         transfer->active = FALSE;
+      }
+   }
+   //First block?
+   else if(pos == 0)
+   {
+      //New transfer?
+      if(transfer == NULL)
+      {
+         //Loop through the transfer table
+         for(i = 0; i < COAP_SERVER_MAX_BLOCK_TRANSFERS; i++)
+         {
+            //Free entry?
+            if(!context->blockTransfers[i].active)
+            {
+               transfer = &context->blockTransfers[i];
+               break;
+            }
+         }
+
+         //Any free entry?
+         if(transfer != NULL)
+         {
+            //Save the client endpoint and the request URI
+            transfer->active = TRUE;
+            transfer->clientIpAddr = exchange->clientIpAddr;
+            transfer->clientPort = exchange->clientPort;
+            transfer->uriHash = uriHash;
+         }
+         else
+         {
+            //No room for another transfer
+            code = COAP_CODE_SERVICE_UNAVAILABLE;
+         }
+      }
+
+      //Start (or restart) the transfer
+      if(transfer != NULL)
+      {
+         transfer->offset = 0;
+      }
+   }
+   else if(transfer == NULL || pos != transfer->offset)
+   {
+      //Debug message
+      TRACE_INFO("CoAP Server: Unexpected block (offset %" PRIuSIZE ")\r\n",
+         pos);
+
+      //The block does not follow the previous one
+      code = COAP_CODE_REQUEST_ENTITY_INCOMPLETE;
+   }
+   else
+   {
+      //The block is the expected one
+   }
+
+   //Reserve the transfer while the block is being processed, so that
+   //neither the timeout nor another worker can release or reuse the entry
+   if(code == COAP_CODE_EMPTY && !oversize)
+   {
+      transfer->busy = TRUE;
+      transfer->timestamp = osGetSystemTime();
+   }
+
+   //Release exclusive access to the transfer table
+   osReleaseMutex(&context->mutex);
+
+   //The block cannot be accepted?
+   if(code != COAP_CODE_EMPTY)
+      return coapServerSetResponseCode(exchange, code);
+
+   //Report the maximum size to the client
+   if(oversize)
+      return coapServerRejectBody(exchange, maxSize);
+
+   //Process the block. The callback is invoked without holding the mutex
+   error = callback(param, pos, data, length, !more);
+
+   //Update the transfer state
+   osAcquireMutex(&context->mutex);
+
+   //The transfer ends with the last block or with an error
+   if(error || !more)
+   {
+      transfer->active = FALSE;
+   }
+   else
+   {
+      transfer->offset += length;
+      transfer->timestamp = osGetSystemTime();
+   }
+
+   //The entry can be released by the timeout again
+   transfer->busy = FALSE;
+
+   //Release exclusive access to the transfer table
+   osReleaseMutex(&context->mutex);
+
+   //Any error to report?
+   if(error)
+   {
+      //Report an internal error to the client
+      return coapServerSetResponseCode(exchange, COAP_CODE_INTERNAL_SERVER);
+   }
+
+   //The server may ask for smaller blocks when acknowledging the first one
+   //(refer to RFC 7959, section 2.5)
+   ackSzx = (pos == 0) ? MIN(szx, coapServerGetMaxBlockSzx(exchange)) : szx;
+
+   //The Block1 option of the response acknowledges the block
+   value = 0;
+   COAP_SET_BLOCK_NUM(value, pos >> (szx + 4));
+   COAP_SET_BLOCK_M(value, more);
+   COAP_SET_BLOCK_SZX(value, ackSzx);
+
+   //Add the Block1 option
+   error = coapServerSetUintOption(exchange, COAP_OPT_BLOCK1, 0, value);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //More blocks to come?
+   if(more)
+   {
+      //Ask the client to send the next block
+      error = coapServerSetResponseCode(exchange, COAP_CODE_CONTINUE);
+   }
+   else
+   {
+      //The transfer is complete
+      *complete = TRUE;
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Format the block of the response body requested by the client
+ * @param[in] exchange Pointer to the request/response exchange
+ * @param[in] data Pointer to the body (NULL if the body is read through a
+ *   callback)
+ * @param[in] callback Body read callback
+ * @param[in] param Callback parameter
+ * @param[in] length Length of the body, in bytes, or
+ *   COAP_SERVER_BODY_LENGTH_UNKNOWN
+ * @return Error code
+ **/
+
+error_t coapServerFormatBody(CoapServerExchange *exchange, const uint8_t *data,
+   CoapServerBodyReadCallback callback, void *param, size_t length)
+{
+   error_t error;
+   bool_t block;
+   bool_t more;
+   uint_t szx;
+   size_t pos;
+   size_t size;
+   size_t n;
+   uint32_t value;
+
+   //Largest block that fits in the response
+   szx = coapServerGetMaxBlockSzx(exchange);
+
+   //Search the request for a Block2 option
+   error = coapServerGetUintOption(exchange, COAP_OPT_BLOCK2, 0, &value);
+
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+   //Over TCP, a body held in memory is sent in a single message when the
+   //client accepts messages of that size, which avoids block-wise transfers
+   if(error && COAP_SERVER_IS_TCP_EXCHANGE(exchange) && data != NULL &&
+      length != COAP_SERVER_BODY_LENGTH_UNKNOWN &&
+      length <= coapServerGetMaxTcpBodySize(exchange))
+   {
+      //The body is sent right after the response message, without being
+      //copied to the response
+      exchange->body = data;
+      exchange->bodyLen = length;
+
+      //Successful processing
+      return NO_ERROR;
+   }
+#endif
+
+   //Block requested by the client?
+   if(!error)
+   {
+      //Reserved block size?
+      if(COAP_GET_BLOCK_SZX(value) == COAP_BLOCK_SIZE_RESERVED)
+         return coapServerSetResponseCode(exchange, COAP_CODE_BAD_OPTION);
+
+      //The server may use a smaller block size than requested
+      szx = MIN(szx, COAP_GET_BLOCK_SZX(value));
+      //Offset of the requested block
+      pos = COAP_GET_BLOCK_POS(value);
+      //The response carries a Block2 option
+      block = TRUE;
+   }
+   else
+   {
+      //Start with the first block
+      pos = 0;
+      //The Block2 option is only added if the body does not fit
+      block = FALSE;
+   }
+
+   //Size of the block
+   size = 16U << szx;
+
+   //Known length?
+   if(length != COAP_SERVER_BODY_LENGTH_UNKNOWN)
+   {
+      //The requested block must lie within the body
+      if(pos > 0 && pos >= length)
+         return coapServerSetResponseCode(exchange, COAP_CODE_BAD_OPTION);
+
+      //Length of the block
+      n = MIN(size, length - pos);
+      //Check whether more blocks follow
+      more = (pos + n) < length;
+
+      //Memory range?
+      if(data != NULL)
+      {
+         //Point to the requested slice
+         data += pos;
+      }
+      else
+      {
+         //Read the block into the I/O buffer
+         error = callback(param, pos, exchange->blockBuffer, n, &n);
+         //Any error to report?
+         if(error)
+            return error;
+
+         //Point to the block
+         data = exchange->blockBuffer;
+      }
+   }
+   else
+   {
+      //Read one more byte than the block size, to find out whether another
+      //block follows
+      error = callback(param, pos, exchange->blockBuffer, size + 1, &n);
+      //Any error to report?
+      if(error)
+         return error;
+
+      //The requested block must lie within the body
+      if(pos > 0 && n == 0)
+         return coapServerSetResponseCode(exchange, COAP_CODE_BAD_OPTION);
+
+      //Check whether more blocks follow
+      more = (n > size);
+      //Length of the block
+      n = MIN(n, size);
+      //Point to the block
+      data = exchange->blockBuffer;
+   }
+
+   //Block-wise transfer?
+   if(block || more)
+   {
+      //Format the Block2 option
+      value = 0;
+      COAP_SET_BLOCK_NUM(value, pos >> (szx + 4));
+      COAP_SET_BLOCK_M(value, more);
+      COAP_SET_BLOCK_SZX(value, szx);
+
+      //Add the Block2 option
+      error = coapServerSetUintOption(exchange, COAP_OPT_BLOCK2, 0, value);
+
+      //The first block carries the size of the whole body, when known
+      if(!error && pos == 0 && length != COAP_SERVER_BODY_LENGTH_UNKNOWN)
+      {
+         error = coapServerSetUintOption(exchange, COAP_OPT_SIZE2, 0,
+            (uint32_t) length);
+      }
+
+      //Any error to report?
+      if(error)
+         return error;
+   }
+
+   //Copy the block to the response
+   return coapServerSetPayload(exchange, data, n);
+}
+
+
+/**
+ * @brief Reject a request body that is too large
+ *
+ * The 4.13 response carries a Size1 option indicating the maximum size the
+ * server is able to accept (refer to RFC 7959, section 4)
+ *
+ * @param[in] exchange Pointer to the request/response exchange
+ * @param[in] maxSize Maximum acceptable body size
+ * @return Error code
+ **/
+
+error_t coapServerRejectBody(CoapServerExchange *exchange, size_t maxSize)
+{
+   error_t error;
+
+   //Set response code
+   error = coapServerSetResponseCode(exchange,
+      COAP_CODE_REQUEST_ENTITY_TO_LARGE);
+
+   //Check status code
+   if(!error)
+   {
+      //Add the Size1 option
+      error = coapServerSetUintOption(exchange, COAP_OPT_SIZE1, 0,
+         (uint32_t) maxSize);
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Release Block1 transfers that have timed out
+ * @param[in] context Pointer to the CoAP server context
+ **/
+
+void coapServerBlockTick(CoapServerContext *context)
+{
+   uint_t i;
+   systime_t time;
+   CoapServerBlockTransfer *transfer;
+
+   //Get current time
+   time = osGetSystemTime();
+
+   //Loop through the transfer table
+   for(i = 0; i < COAP_SERVER_MAX_BLOCK_TRANSFERS; i++)
+   {
+      //Point to the current entry
+      transfer = &context->blockTransfers[i];
+
+      //Stale transfer? A block being processed keeps the transfer alive
+      if(transfer->active && !transfer->busy &&
+         timeCompare(time, transfer->timestamp + COAP_SERVER_BLOCK_TIMEOUT) >= 0)
+      {
+         //Debug message
+         TRACE_INFO("CoAP Server: Block1 transfer timeout!\r\n");
+
+         //Release the entry
+         transfer->active = FALSE;
+      }
+   }
+}
+
+
+/**
+ * @brief Find the Block1 transfer matching the current request
+ * @param[in] exchange Pointer to the request/response exchange
+ * @param[in] uriHash Hash of the request URI
+ * @return Pointer to the matching transfer, if any
+ **/
+
+CoapServerBlockTransfer *coapServerFindBlockTransfer(CoapServerExchange *exchange,
+   uint32_t uriHash)
+{
+   uint_t i;
+   CoapServerBlockTransfer *transfer;
+
+   //Loop through the transfer table
+   for(i = 0; i < COAP_SERVER_MAX_BLOCK_TRANSFERS; i++)
+   {
+      //Point to the current entry
+      transfer = &exchange->context->blockTransfers[i];
+
+      //Matching transfer?
+      if(transfer->active && transfer->uriHash == uriHash &&
+         transfer->clientPort == exchange->clientPort &&
+         ipCompAddr(&transfer->clientIpAddr, &exchange->clientIpAddr))
+      {
+         return transfer;
+      }
+   }
+
+   //No matching transfer
+   return NULL;
+}
+
+
+/**
+ * @brief Get the largest block size usable in the current response
+ *
+ * The preferred block size is reduced until a block fits in the response
+ * along with the options already present
+ *
+ * @param[in] exchange Pointer to the request/response exchange
+ * @return Block size exponent (SZX)
+ **/
+
+uint_t coapServerGetMaxBlockSzx(CoapServerExchange *exchange)
+{
+   uint_t szx;
+
+   //Convert the preferred block size to an exponent
+   for(szx = COAP_BLOCK_SIZE_1024; (16U << szx) > COAP_SERVER_BLOCK_SIZE; szx--)
+   {
+   }
+
+   //Make sure the block fits in the response
+   while(szx > COAP_BLOCK_SIZE_16 && ((16U << szx) + exchange->response.length +
+      COAP_SERVER_BLOCK_OVERHEAD) > COAP_MAX_MSG_SIZE)
+   {
+      szx--;
+   }
+
+   //Return the block size exponent
+   return szx;
+}
+
+#endif
@@ -0,0 +1,74 @@
+/**
+ * @file coap_server_block.h
+ * @brief CoAP server block-wise transfers (RFC 7959)
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+#ifndef _COAP_SERVER_BLOCK_H
+#define _COAP_SERVER_BLOCK_H
+
+//Dependencies
+#include "core/net.h"
+#include "coap/coap_server.h"
+
+//Body of unknown length
+#define COAP_SERVER_BODY_LENGTH_UNKNOWN ((size_t) -1)
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//CoAP server related functions
+error_t coapServerSetBody(CoapServerExchange *exchange, const void *data,
+   size_t length);
+
+error_t coapServerSetBodyStream(CoapServerExchange *exchange,
+   CoapServerBodyReadCallback callback, void *param, size_t length);
+
+error_t coapServerReceiveBody(CoapServerExchange *exchange,
+   CoapServerBodyWriteCallback callback, void *param, size_t maxSize,
+   bool_t *complete);
+
+error_t coapServerFormatBody(CoapServerExchange *exchange, const uint8_t *data,
+   CoapServerBodyReadCallback callback, void *param, size_t length);
+
+error_t coapServerRejectBody(CoapServerExchange *exchange, size_t maxSize);
+
+void coapServerBlockTick(CoapServerContext *context);
+
+CoapServerBlockTransfer *coapServerFindBlockTransfer(CoapServerExchange *exchange,
+   uint32_t uriHash);
+
+uint_t coapServerGetMaxBlockSzx(CoapServerExchange *exchange);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
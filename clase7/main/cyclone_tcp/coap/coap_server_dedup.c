@@ -0,0 +1,273 @@
+/**
+ * @file coap_server_dedup.c
+ * @brief CoAP server duplicate detection
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL COAP_TRACE_LEVEL
+
+//Dependencies
+#include "coap/coap_server.h"
+#include "coap/coap_server_dedup.h"
+#include "debug.h"
+
+//Check TCP/IP stack configuration
+#if (COAP_SERVER_SUPPORT == ENABLED && COAP_SERVER_DEDUP_SUPPORT == ENABLED)
+
+
+/**
+ * @brief Answer a duplicate request from the cache
+ *
+ * A retransmitted Confirmable request receives the same response as the
+ * original one, and a duplicate Non-confirmable request is silently ignored.
+ * In both cases the request is processed only once (refer to RFC 7252,
+ * section 4.5). The cache is shared with the worker tasks, so the caller
+ * must hold the mutex of the context
+ *
+ * @param[in] exchange Pointer to the request/response exchange
+ * @return TRUE if the request is a duplicate, else FALSE
+ **/
+
+bool_t coapServerReplayDuplicate(CoapServerExchange *exchange)
+{
+   size_t n;
+   const CoapMessageHeader *header;
+   CoapServerContext *context;
+   CoapServerDedupEntry *entry;
+
+   //Point to the CoAP server context
+   context = exchange->context;
+   //Point to the CoAP request header
+   header = (CoapMessageHeader *) exchange->request.buffer;
+
+   //Search the cache for the Message ID
+   entry = coapServerFindDedupEntry(exchange, ntohs(header->mid));
+
+   //New request?
+   if(entry == NULL)
+   {
+      //Update statistics
+      context->dedupStats.misses++;
+      //The request must be processed
+      return FALSE;
+   }
+
+   //Debug message
+   TRACE_INFO("CoAP Server: Duplicate message (MID 0x%04" PRIX16 ")\r\n",
+      entry->mid);
+
+   //Update statistics
+   context->dedupStats.hits++;
+
+   //Confirmable request?
+   if(header->type == COAP_TYPE_CON)
+   {
+      //Copy the stored response, which may wrap around the end of the
+      //circular buffer
+      n = MIN(entry->length, COAP_SERVER_DEDUP_BUFFER_SIZE - entry->offset);
+      osMemcpy(exchange->response.buffer, context->dedupBuffer + entry->offset, n);
+      osMemcpy(exchange->response.buffer + n, context->dedupBuffer,
+         entry->length - n);
+
+      //Set the length of the response
+      exchange->response.length = entry->length;
+   }
+   else
+   {
+      //Duplicate Non-confirmable messages are silently ignored
+      exchange->response.length = 0;
+   }
+
+   //The request is a duplicate
+   return TRUE;
+}
+
+
+/**
+ * @brief Remember the response sent to a new request
+ *
+ * The oldest entries are evicted when the entry ring or the response buffer
+ * is full, so that memory usage stays bounded whatever the request rate.
+ * The caller must hold the mutex of the context
+ *
+ * @param[in] exchange Pointer to the request/response exchange
+ * @param[in] data Message to send again to a retransmitted request
+ * @param[in] length Length of the message (0 if no response was sent)
+ **/
+
+void coapServerAddDedupEntry(CoapServerExchange *exchange, const uint8_t *data,
+   size_t length)
+{
+   size_t n;
+   const CoapMessageHeader *header;
+   CoapServerContext *context;
+   CoapServerDedupEntry *entry;
+
+   //Point to the CoAP server context
+   context = exchange->context;
+   //Point to the CoAP request header
+   header = (CoapMessageHeader *) exchange->request.buffer;
+
+   //Release expired entries first
+   coapServerDedupTick(context);
+
+   //Make room for the new entry
+   while(context->dedupCount >= COAP_SERVER_DEDUP_CACHE_SIZE ||
+      (context->dedupUsed + length) > COAP_SERVER_DEDUP_BUFFER_SIZE)
+   {
+      //Evict the oldest entry
+      coapServerEvictDedupEntry(context);
+      //Update statistics
+      context->dedupStats.evictions++;
+   }
+
+   //Point to the next entry of the ring
+   entry = &context->dedupEntries[(context->dedupHead + context->dedupCount) %
+      COAP_SERVER_DEDUP_CACHE_SIZE];
+
+   //Save the client endpoint and the Message ID
+   entry->clientIpAddr = exchange->clientIpAddr;
+   entry->clientPort = exchange->clientPort;
+   entry->mid = ntohs(header->mid);
+   entry->timestamp = osGetSystemTime();
+   entry->offset = context->dedupWritePos;
+   entry->length = length;
+
+   //Copy the response, which may wrap around the end of the circular buffer
+   n = MIN(length, COAP_SERVER_DEDUP_BUFFER_SIZE - entry->offset);
+   osMemcpy(context->dedupBuffer + entry->offset, data, n);
+   osMemcpy(context->dedupBuffer, data + n, length - n);
+
+   //Advance the write position
+   context->dedupWritePos = (context->dedupWritePos + length) %
+      COAP_SERVER_DEDUP_BUFFER_SIZE;
+
+   //Update the state of the cache
+   context->dedupUsed += length;
+   context->dedupCount++;
+}
+
+
+/**
+ * @brief Release the entries whose lifetime has elapsed
+ *
+ * Entries are stored in chronological order, so only the oldest ones need
+ * to be checked
+ *
+ * @param[in] context Pointer to the CoAP server context
+ **/
+
+void coapServerDedupTick(CoapServerContext *context)
+{
+   systime_t time;
+   CoapServerDedupEntry *entry;
+
+   //Get current time
+   time = osGetSystemTime();
+
+   //Loop through the oldest entries
+   while(context->dedupCount > 0)
+   {
+      //Point to the oldest entry
+      entry = &context->dedupEntries[context->dedupHead];
+
+      //Still within EXCHANGE_LIFETIME?
+      if(timeCompare(time, entry->timestamp + COAP_SERVER_EXCHANGE_LIFETIME) < 0)
+         break;
+
+      //Release the entry
+      coapServerEvictDedupEntry(context);
+   }
+}
+
+
+/**
+ * @brief Search the cache for a request from the current client
+ * @param[in] exchange Pointer to the request/response exchange
+ * @param[in] mid Message ID of the request
+ * @return Pointer to the matching entry, if any
+ **/
+
+CoapServerDedupEntry *coapServerFindDedupEntry(CoapServerExchange *exchange,
+   uint16_t mid)
+{
+   uint_t i;
+   systime_t time;
+   CoapServerContext *context;
+   CoapServerDedupEntry *entry;
+
+   //Point to the CoAP server context
+   context = exchange->context;
+
+   //Get current time
+   time = osGetSystemTime();
+
+   //Loop through the entries, from the most recent one
+   for(i = context->dedupCount; i > 0; i--)
+   {
+      //Point to the current entry
+      entry = &context->dedupEntries[(context->dedupHead + i - 1) %
+         COAP_SERVER_DEDUP_CACHE_SIZE];
+
+      //The Message ID is only meaningful within EXCHANGE_LIFETIME
+      if(timeCompare(time, entry->timestamp + COAP_SERVER_EXCHANGE_LIFETIME) >= 0)
+         break;
+
+      //Matching request?
+      if(entry->mid == mid && entry->clientPort == exchange->clientPort &&
+         ipCompAddr(&entry->clientIpAddr, &exchange->clientIpAddr))
+      {
+         return entry;
+      }
+   }
+
+   //No matching entry
+   return NULL;
+}
+
+
+/**
+ * @brief Evict the oldest entry
+ * @param[in] context Pointer to the CoAP server context
+ **/
+
+void coapServerEvictDedupEntry(CoapServerContext *context)
+{
+   //Any entry?
+   if(context->dedupCount > 0)
+   {
+      //Release the bytes used by the response
+      context->dedupUsed -= context->dedupEntries[context->dedupHead].length;
+
+      //The next entry becomes the oldest one
+      context->dedupHead = (context->dedupHead + 1) % COAP_SERVER_DEDUP_CACHE_SIZE;
+      context->dedupCount--;
+   }
+}
+
+#endif
@@ -1,6 +1,6 @@
 /**
- * @file os_port_config.h
- * @brief RTOS port configuration file
+ * @file coap_server_dedup.h
+ * @brief CoAP server duplicate detection
  *
  * @section License
  *
@@ -8,6 +8,8 @@
  *
  * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
  *
+ * This file is part of CycloneTCP Open.
+ *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
  * as published by the Free Software Foundation; either version 2
@@ -26,21 +28,34 @@
  * @version 2.5.4
  **/
 
-#ifndef _OS_PORT_CONFIG_H
-#define _OS_PORT_CONFIG_H
+#ifndef _COAP_SERVER_DEDUP_H
+#define _COAP_SERVER_DEDUP_H
 
 //Dependencies
-#include "rom/ets_sys.h"
+#include "core/net.h"
+#include "coap/coap_server.h"
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//CoAP server related functions
+bool_t coapServerReplayDuplicate(CoapServerExchange *exchange);
+
+void coapServerAddDedupEntry(CoapServerExchange *exchange, const uint8_t *data,
+   size_t length);
+
+void coapServerDedupTick(CoapServerContext *context);
 
-//Select underlying RTOS
-#define USE_FREERTOS
+CoapServerDedupEntry *coapServerFindDedupEntry(CoapServerExchange *exchange,
+   uint16_t mid);
 
-//Trace output redirection
-#define TRACE_PRINTF(...) ets_printf(__VA_ARGS__)
+void coapServerEvictDedupEntry(CoapServerContext *context);
 
-//Undefine macro from ESP-IDF
-#ifdef IP_ADDR_ANY
-   #undef IP_ADDR_ANY
+//C++ guard
+#ifdef __cplusplus
+}
 #endif
 
 #endif
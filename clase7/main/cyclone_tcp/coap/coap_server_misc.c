@@ -36,6 +36,13 @@
 #include "coap/coap_server.h"
 #include "coap/coap_server_transport.h"
 #include "coap/coap_server_misc.h"
+#include "coap/coap_server_resource.h"
+#include "coap/coap_server_observe.h"
+#include "coap/coap_server_block.h"
+#include "coap/coap_server_dedup.h"
+#include "coap/coap_server_worker.h"
+#include "coap/coap_server_tcp.h"
+#include "coap/coap_server_multicast.h"
 #include "coap/coap_common.h"
 #include "coap/coap_debug.h"
 #include "debug.h"
@@ -51,6 +58,42 @@
 
 void coapServerTick(CoapServerContext *context)
 {
+   //The state shared with the worker tasks is protected by a mutex
+   osAcquireMutex(&context->mutex);
+
+#if (COAP_SERVER_WORKER_SUPPORT == ENABLED)
+   //Send empty ACKs for slow requests and retransmit separate responses
+   coapServerWorkerTick(context);
+#endif
+
+#if (COAP_SERVER_OBSERVE_SUPPORT == ENABLED)
+   //Handle retransmission of confirmable notifications
+   coapServerObserveTick(context);
+#endif
+
+#if (COAP_SERVER_BLOCK_SUPPORT == ENABLED)
+   //Release stale Block1 transfers
+   coapServerBlockTick(context);
+#endif
+
+#if (COAP_SERVER_DEDUP_SUPPORT == ENABLED)
+   //Forget requests older than EXCHANGE_LIFETIME
+   coapServerDedupTick(context);
+#endif
+
+#if (COAP_SERVER_MULTICAST_SUPPORT == ENABLED)
+   //Send the responses to multicast requests that are due
+   coapServerMulticastTick(context);
+#endif
+
+   //Release exclusive access
+   osReleaseMutex(&context->mutex);
+
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+   //Close idle and broken TCP connections
+   coapServerTcpTick(context);
+#endif
+
 #if (COAP_SERVER_DTLS_SUPPORT == ENABLED)
    error_t error;
    uint_t i;
@@ -105,6 +148,11 @@ void coapServerTick(CoapServerContext *context)
 
 /**
  * @brief Process CoAP request
+ *
+ * The message is parsed by the CoAP server task. Duplicates, empty messages
+ * and invalid requests are answered immediately, while valid requests are
+ * handed over to a worker task when the worker pool is running
+ *
  * @param[in] context Pointer to the CoAP server context
  * @param[in] data Pointer to the incoming CoAP message
  * @param[in] length Length of the CoAP message, in bytes
@@ -115,45 +163,79 @@ error_t coapServerProcessRequest(CoapServerContext *context,
    const uint8_t *data, size_t length)
 {
    error_t error;
+   bool_t process;
    CoapCode code;
    CoapMessageType type;
+   CoapServerExchange *exchange;
+#if (COAP_SERVER_DEDUP_SUPPORT == ENABLED)
+   bool_t cache;
+
+   //Only responses to new requests are remembered
+   cache = FALSE;
+#endif
 
-   //Check the length of the CoAP message
-   if(length > COAP_MAX_MSG_SIZE)
+   //Check the length of the CoAP message (one byte is reserved for the
+   //terminating NULL character)
+   if(length >= COAP_MAX_MSG_SIZE)
       return ERROR_INVALID_LENGTH;
 
-   //Copy the request message
-   osMemcpy(context->request.buffer, data, length);
+   //The message is parsed in the exchange of the CoAP server task
+   exchange = &context->exchange;
+
+   //Datagrams are normally received directly into the request message
+   if(data != exchange->request.buffer)
+   {
+      //Copy the request message
+      osMemcpy(exchange->request.buffer, data, length);
+   }
 
    //Save the length of the request message
-   context->request.length = length;
-   context->request.pos = 0;
+   exchange->request.length = length;
+   exchange->request.pos = 0;
+
+   //Save the endpoints of the exchange
+   exchange->serverIpAddr = context->serverIpAddr;
+   exchange->clientIpAddr = context->clientIpAddr;
+   exchange->clientPort = context->clientPort;
+
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+   //Save the TCP connection the message was received on, if any
+   exchange->connection = context->connection;
+   exchange->connectionId = (context->connection != NULL) ?
+      context->connection->id : 0;
+#endif
 
-   //Parse the received message
-   error = coapParseMessage(&context->request);
+   //Parse the received message and index its options in a single pass
+   error = coapParseMessageEx(&exchange->request, &exchange->requestIndex);
 
    //Valid CoAP message?
    if(error == NO_ERROR)
    {
       //Terminate the payload with a NULL character
-      context->request.buffer[context->request.length] = '\0';
+      exchange->request.buffer[exchange->request.length] = '\0';
 
       //Debug message
       TRACE_INFO("CoAP Server: CoAP message received (%" PRIuSIZE " bytes)...\r\n",
-         context->request.length);
+         exchange->request.length);
 
       //Dump the contents of the message for debugging purpose
-      coapDumpMessage(context->request.buffer, context->request.length);
+      coapDumpMessage(exchange->request.buffer, exchange->request.length);
 
       //Retrieve message type and method code
-      coapGetType(&context->request, &type);
-      coapGetCode(&context->request, &code);
+      coapGetType(&exchange->request, &type);
+      coapGetCode(&exchange->request, &code);
 
       //Initialize CoAP response message
-      coapServerInitResponse(context);
+      coapServerInitResponse(exchange);
 
       //Check the type of the request
-      if(type == COAP_TYPE_CON || type == COAP_TYPE_NON)
+      if(type == COAP_TYPE_CON && COAP_SERVER_IS_MULTICAST_EXCHANGE(exchange))
+      {
+         //Multicast requests must be Non-confirmable, since a message sent
+         //to a group cannot be acknowledged (refer to RFC 7252, section 8.1)
+         error = ERROR_INVALID_REQUEST;
+      }
+      else if(type == COAP_TYPE_CON || type == COAP_TYPE_NON)
       {
          //Check message code
          if(code == COAP_CODE_GET ||
@@ -164,28 +246,49 @@ error_t coapServerProcessRequest(CoapServerContext *context,
             code == COAP_CODE_PATCH ||
             code == COAP_CODE_IPATCH)
          {
-            //Reconstruct the path component from Uri-Path options
-            coapJoinRepeatableOption(&context->request, COAP_OPT_URI_PATH,
-               context->uri, COAP_SERVER_MAX_URI_LEN, '/');
+            //New request?
+            process = TRUE;
+
+            //The duplicate detection state is shared with the worker tasks
+            osAcquireMutex(&context->mutex);
 
-            //If the resource name is the empty string, set it to a single "/"
-            //character (refer to RFC 7252, section 6.5)
-            if(context->uri[0] == '\0')
+#if (COAP_SERVER_DEDUP_SUPPORT == ENABLED)
+            //Retransmission of a request that has already been processed?
+            //Messages over TCP are never retransmitted
+            if(!COAP_SERVER_IS_TCP_EXCHANGE(exchange) &&
+               coapServerReplayDuplicate(exchange))
             {
-               osStrcpy(context->uri, "/");
+               //The stored response (if any) is sent again without invoking
+               //the request handler (refer to RFC 7252, section 4.5)
+               process = FALSE;
             }
+#endif
 
-            //Any registered callback?
-            if(context->settings.requestCallback != NULL)
+#if (COAP_SERVER_WORKER_SUPPORT == ENABLED)
+            //Worker pool running? Requests sent to a multicast group are
+            //handed over too, and the worker queues the deferred response
+            if(process && context->workers[0].taskId != OS_INVALID_TASK_ID)
             {
-               //Invoke user callback function
-               error = context->settings.requestCallback(context, code,
-                  context->uri);
+               //Hand the request over to an idle worker task
+               coapServerStartWorker(context, exchange);
+               //The worker sends the response
+               process = FALSE;
             }
-            else
+#endif
+
+            //Release exclusive access
+            osReleaseMutex(&context->mutex);
+
+            //Process the request in the CoAP server task?
+            if(process)
             {
-               //Generate a 4.04 piggybacked response
-               error = coapSetCode(&context->response, COAP_CODE_NOT_FOUND);
+               //Invoke the request handler
+               error = coapServerHandleRequest(exchange, code);
+
+#if (COAP_SERVER_DEDUP_SUPPORT == ENABLED)
+               //Remember the response to this request
+               cache = !COAP_SERVER_IS_TCP_EXCHANGE(exchange);
+#endif
             }
          }
          else if(code == COAP_CODE_EMPTY)
@@ -193,18 +296,35 @@ error_t coapServerProcessRequest(CoapServerContext *context,
             //Provoking a Reset message by sending an Empty Confirmable message
             //can be used to check of the liveness of an endpoint (refer to
             //RFC 7252, section 4.3)
-            error = coapServerRejectRequest(context);
+            error = coapServerRejectRequest(exchange);
          }
          else
          {
             //A request with an unrecognized or unsupported method code must
             //generate a 4.05 piggybacked response (refer to RFC 7252, section
             //5.8)
-            error = coapSetCode(&context->response, COAP_CODE_METHOD_NOT_ALLOWED);
+            error = coapSetCode(&exchange->response, COAP_CODE_METHOD_NOT_ALLOWED);
          }
       }
       else
       {
+#if (COAP_SERVER_OBSERVE_SUPPORT == ENABLED || COAP_SERVER_WORKER_SUPPORT == ENABLED)
+         //Acquire exclusive access
+         osAcquireMutex(&context->mutex);
+
+#if (COAP_SERVER_OBSERVE_SUPPORT == ENABLED)
+         //Acknowledgement or Reset message matching a notification?
+         coapServerProcessObserveAck(context, type,
+            ntohs(((CoapMessageHeader *) exchange->request.buffer)->mid));
+#endif
+#if (COAP_SERVER_WORKER_SUPPORT == ENABLED)
+         //Acknowledgement or Reset message matching a separate response?
+         coapServerProcessWorkerAck(context,
+            ntohs(((CoapMessageHeader *) exchange->request.buffer)->mid));
+#endif
+         //Release exclusive access
+         osReleaseMutex(&context->mutex);
+#endif
          //Recipients of Acknowledgement and Reset messages must not respond
          //with either Acknowledgement or Reset messages
          error = ERROR_INVALID_REQUEST;
@@ -219,25 +339,108 @@ error_t coapServerProcessRequest(CoapServerContext *context,
    {
       //Other message format errors, such as an incomplete datagram or the
       //usage of reserved values, are rejected with a Reset message
-      error = coapServerRejectRequest(context);
+      error = coapServerRejectRequest(exchange);
    }
 
    //Check status code
    if(!error)
    {
       //Any response?
-      if(context->response.length > 0)
+      if(exchange->response.length > 0)
       {
-         //Debug message
-         TRACE_INFO("CoAP Server: Sending CoAP message (%" PRIuSIZE " bytes)...\r\n",
-            context->response.length);
+#if (COAP_SERVER_MULTICAST_SUPPORT == ENABLED)
+         //Request sent to a multicast group?
+         if(COAP_SERVER_IS_MULTICAST_EXCHANGE(exchange))
+         {
+            //The response is sent later, after a random delay. The queue is
+            //shared with the worker tasks
+            osAcquireMutex(&context->mutex);
+            error = coapServerDeferResponse(exchange);
+            osReleaseMutex(&context->mutex);
+         }
+         else
+#endif
+         {
+            //Debug message
+            TRACE_INFO("CoAP Server: Sending CoAP message (%" PRIuSIZE " bytes)...\r\n",
+               exchange->response.length);
 
-         //Dump the contents of the message for debugging purpose
-         coapDumpMessage(context->response.buffer, context->response.length);
+            //Dump the contents of the message for debugging purpose
+            coapDumpMessage(exchange->response.buffer, exchange->response.length);
 
-         //Send CoAP response message
-         error = coapServerSendResponse(context, context->response.buffer,
-            context->response.length);
+            //Send CoAP response message
+            error = coapServerSendResponse(exchange, exchange->response.buffer,
+               exchange->response.length);
+         }
+      }
+
+#if (COAP_SERVER_DEDUP_SUPPORT == ENABLED)
+      //New request?
+      if(cache)
+      {
+         //Retransmissions of the request will receive the same response
+         osAcquireMutex(&context->mutex);
+         coapServerAddDedupEntry(exchange, exchange->response.buffer,
+            exchange->response.length);
+         osReleaseMutex(&context->mutex);
+      }
+#endif
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Invoke the handler of a request
+ *
+ * The response is formatted in the exchange but is not sent. This function
+ * is called without holding the mutex, either by a worker task or by the
+ * CoAP server task
+ *
+ * @param[in] exchange Pointer to the request/response exchange
+ * @param[in] code Method code
+ * @return Error code
+ **/
+
+error_t coapServerHandleRequest(CoapServerExchange *exchange, CoapCode code)
+{
+   error_t error;
+   CoapServerContext *context;
+
+   //Point to the CoAP server context
+   context = exchange->context;
+
+   //Reconstruct the path component from Uri-Path options, using the option
+   //index built when the request was parsed
+   coapJoinIndexedOption(&exchange->request, &exchange->requestIndex,
+      COAP_OPT_URI_PATH, exchange->uri, COAP_SERVER_MAX_URI_LEN, '/');
+
+   //If the resource name is the empty string, set it to a single "/"
+   //character (refer to RFC 7252, section 6.5)
+   if(exchange->uri[0] == '\0')
+   {
+      osStrcpy(exchange->uri, "/");
+   }
+
+   //Dispatch the request to the registered resources
+   error = coapServerDispatchResource(exchange, code, exchange->uri);
+
+   //No matching resource?
+   if(error == ERROR_NOT_FOUND)
+   {
+      //Any registered callback?
+      if(context->settings.requestCallback != NULL)
+      {
+         //Invoke user callback function
+         error = context->settings.requestCallback(exchange, code,
+            exchange->uri);
+      }
+      else
+      {
+         //Generate a 4.04 piggybacked response
+         error = coapSetCode(&exchange->response, COAP_CODE_NOT_FOUND);
       }
    }
 
@@ -248,11 +451,11 @@ error_t coapServerProcessRequest(CoapServerContext *context,
 
 /**
  * @brief Reject a CoAP request
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @return Error code
  **/
 
-error_t coapServerRejectRequest(CoapServerContext *context)
+error_t coapServerRejectRequest(CoapServerExchange *exchange)
 {
    error_t error;
    const CoapMessageHeader *header;
@@ -264,27 +467,38 @@ error_t coapServerRejectRequest(CoapServerContext *context)
    TRACE_INFO("CoAP Server: Rejecting CoAP message...\r\n");
 
    //Point to the CoAP message header
-   header = (CoapMessageHeader *) &context->request.buffer;
+   header = (CoapMessageHeader *) &exchange->request.buffer;
 
    //Check the type of the request
-   if(header->type == COAP_TYPE_CON)
+   if(COAP_SERVER_IS_TCP_EXCHANGE(exchange))
+   {
+      //Reset messages are not used over TCP (refer to RFC 8323, section 2.2)
+      exchange->response.length = 0;
+   }
+   else if(COAP_SERVER_IS_MULTICAST_EXCHANGE(exchange))
+   {
+      //A server that is aware that a request arrived via multicast must not
+      //return a Reset message (refer to RFC 7252, section 8.1)
+      exchange->response.length = 0;
+   }
+   else if(header->type == COAP_TYPE_CON)
    {
       //Rejecting a Confirmable message is effected by sending a matching
       //Reset message
-      error = coapServerFormatReset(context, ntohs(header->mid));
+      error = coapServerFormatReset(exchange, ntohs(header->mid));
    }
    else if(header->type == COAP_TYPE_NON)
    {
       //Rejecting a Non-confirmable message may involve sending a matching
       //Reset message, and apart from the Reset message the rejected message
       //must be silently ignored (refer to RFC 7252, section 4.3)
-      error = coapServerFormatReset(context, ntohs(header->mid));
+      error = coapServerFormatReset(exchange, ntohs(header->mid));
    }
    else
    {
       //Rejecting an Acknowledgment or Reset message is effected by
       //silently ignoring it (refer to RFC 7252, section 4.2)
-      context->response.length = 0;
+      exchange->response.length = 0;
    }
 
    //Return status code
@@ -294,19 +508,19 @@ error_t coapServerRejectRequest(CoapServerContext *context)
 
 /**
  * @brief Initialize CoAP response message
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @return Error code
  **/
 
-error_t coapServerInitResponse(CoapServerContext *context)
+error_t coapServerInitResponse(CoapServerExchange *exchange)
 {
    CoapMessageHeader *requestHeader;
    CoapMessageHeader *responseHeader;
 
    //Point to the CoAP request header
-   requestHeader = (CoapMessageHeader *) context->request.buffer;
+   requestHeader = (CoapMessageHeader *) exchange->request.buffer;
    //Point to the CoAP response header
-   responseHeader = (CoapMessageHeader *) context->response.buffer;
+   responseHeader = (CoapMessageHeader *) exchange->response.buffer;
 
    //Format message header
    responseHeader->version = COAP_VERSION_1;
@@ -330,8 +544,17 @@ error_t coapServerInitResponse(CoapServerContext *context)
       requestHeader->tokenLen);
 
    //Set the length of the CoAP message
-   context->response.length = sizeof(CoapMessageHeader) + responseHeader->tokenLen;
-   context->response.pos = 0;
+   exchange->response.length = sizeof(CoapMessageHeader) + responseHeader->tokenLen;
+   exchange->response.pos = 0;
+
+   //Options are appended in ascending order right after the token
+   coapInitOptionWriter(&exchange->responseWriter, &exchange->response);
+
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+   //No body is sent after the response message yet
+   exchange->body = NULL;
+   exchange->bodyLen = 0;
+#endif
 
    //Successful processing
    return NO_ERROR;
@@ -340,20 +563,29 @@ error_t coapServerInitResponse(CoapServerContext *context)
 
 /**
  * @brief Send CoAP response
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @param[in] data Pointer to a buffer containing the response message
  * @param[in] length Length of the response message, in bytes
  * @return Error code
  **/
 
-error_t coapServerSendResponse(CoapServerContext *context,
+error_t coapServerSendResponse(CoapServerExchange *exchange,
    const void *data, size_t length)
 {
    error_t error;
 
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+   //Request received over TCP?
+   if(exchange->connection != NULL)
+   {
+      //Send the message over the same connection
+      error = coapServerSendTcpResponse(exchange, data, length);
+   }
+   else
+#endif
 #if (COAP_SERVER_DTLS_SUPPORT == ENABLED)
    //DTLS-secured communication?
-   if(context->settings.dtlsInitCallback != NULL)
+   if(exchange->context->settings.dtlsInitCallback != NULL)
    {
       uint_t i;
       CoapDtlsSession *session;
@@ -362,15 +594,15 @@ error_t coapServerSendResponse(CoapServerContext *context,
       for(i = 0; i < COAP_SERVER_MAX_SESSIONS; i++)
       {
          //Point to the current DTLS session
-         session = &context->session[i];
+         session = &exchange->context->session[i];
 
          //Valid DTLS session?
          if(session->dtlsContext != NULL)
          {
             //Matching DTLS session?
-            if(ipCompAddr(&session->serverIpAddr, &context->serverIpAddr) &&
-               ipCompAddr(&session->clientIpAddr, &context->clientIpAddr) &&
-               session->clientPort == context->clientPort)
+            if(ipCompAddr(&session->serverIpAddr, &exchange->serverIpAddr) &&
+               ipCompAddr(&session->clientIpAddr, &exchange->clientIpAddr) &&
+               session->clientPort == exchange->clientPort)
             {
                break;
             }
@@ -393,8 +625,8 @@ error_t coapServerSendResponse(CoapServerContext *context,
 #endif
    {
       //Send UDP datagram
-      error = socketSendTo(context->socket, &context->clientIpAddr,
-         context->clientPort, data, length, NULL, 0);
+      error = socketSendTo(exchange->context->socket, &exchange->clientIpAddr,
+         exchange->clientPort, data, length, NULL, 0);
    }
 
    //Return status code
@@ -404,17 +636,17 @@ error_t coapServerSendResponse(CoapServerContext *context,
 
 /**
  * @brief Format Reset message
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @param[in] mid Message ID
  * @return Error code
  **/
 
-error_t coapServerFormatReset(CoapServerContext *context, uint16_t mid)
+error_t coapServerFormatReset(CoapServerExchange *exchange, uint16_t mid)
 {
    CoapMessageHeader *header;
 
    //Point to the CoAP response header
-   header = (CoapMessageHeader *) context->response.buffer;
+   header = (CoapMessageHeader *) exchange->response.buffer;
 
    //Format Reset message
    header->version = COAP_VERSION_1;
@@ -427,7 +659,7 @@ error_t coapServerFormatReset(CoapServerContext *context, uint16_t mid)
    header->mid = htons(mid);
 
    //Set the length of the CoAP message
-   context->response.length = sizeof(CoapMessageHeader);
+   exchange->response.length = sizeof(CoapMessageHeader);
 
    //Successful processing
    return NO_ERROR;
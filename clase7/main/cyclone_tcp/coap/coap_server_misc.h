@@ -46,14 +46,14 @@ void coapServerTick(CoapServerContext *context);
 error_t coapServerProcessRequest(CoapServerContext *context,
    const uint8_t *data, size_t length);
 
-error_t coapServerRejectRequest(CoapServerContext *context);
+error_t coapServerHandleRequest(CoapServerExchange *exchange, CoapCode code);
+error_t coapServerRejectRequest(CoapServerExchange *exchange);
+error_t coapServerInitResponse(CoapServerExchange *exchange);
 
-error_t coapServerInitResponse(CoapServerContext *context);
-
-error_t coapServerSendResponse(CoapServerContext *context,
+error_t coapServerSendResponse(CoapServerExchange *exchange,
    const void *data, size_t length);
 
-error_t coapServerFormatReset(CoapServerContext *context, uint16_t mid);
+error_t coapServerFormatReset(CoapServerExchange *exchange, uint16_t mid);
 
 //C++ guard
 #ifdef __cplusplus
@@ -0,0 +1,311 @@
+/**
+ * @file coap_server_multicast.c
+ * @brief CoAP multicast (server side)
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL COAP_TRACE_LEVEL
+
+//Dependencies
+#include "coap/coap_server.h"
+#include "coap/coap_server_misc.h"
+#include "coap/coap_server_multicast.h"
+#include "coap/coap_debug.h"
+#include "debug.h"
+
+//Check TCP/IP stack configuration
+#if (COAP_SERVER_SUPPORT == ENABLED && COAP_SERVER_MULTICAST_SUPPORT == ENABLED)
+
+
+/**
+ * @brief Join the multicast groups specified in the settings
+ *
+ * Membership is opt-in: multicast requests are only processed when they
+ * are sent to one of these groups. Groups are left when the UDP socket is
+ * closed
+ *
+ * @param[in] context Pointer to the CoAP server context
+ * @return Error code
+ **/
+
+error_t coapServerJoinMulticastGroups(CoapServerContext *context)
+{
+   error_t error;
+   uint_t i;
+   const IpAddr *groupAddr;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+#if (COAP_SERVER_DTLS_SUPPORT == ENABLED)
+   //DTLS cannot secure multicast communication
+   if(context->settings.dtlsInitCallback != NULL)
+      return NO_ERROR;
+#endif
+
+   //Loop through the multicast groups
+   for(i = 0; i < COAP_SERVER_MAX_MULTICAST_GROUPS && !error; i++)
+   {
+      //Point to the current group address
+      groupAddr = &context->settings.groupAddr[i];
+
+      //Valid multicast address?
+      if(groupAddr->length != 0)
+      {
+         //Make sure the address is a multicast address
+         if(ipIsMulticastAddr(groupAddr))
+         {
+            //Join the multicast group
+            error = socketJoinMulticastGroup(context->socket, groupAddr);
+         }
+         else
+         {
+            //Report an error
+            error = ERROR_INVALID_ADDRESS;
+         }
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Check whether an address is one of the groups the server has joined
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] ipAddr Destination address of the incoming datagram
+ * @return TRUE if the request must be processed, else FALSE
+ **/
+
+bool_t coapServerIsMulticastGroup(CoapServerContext *context,
+   const IpAddr *ipAddr)
+{
+   uint_t i;
+
+#if (COAP_SERVER_DTLS_SUPPORT == ENABLED)
+   //No multicast group is joined when DTLS is used
+   if(context->settings.dtlsInitCallback != NULL)
+      return FALSE;
+#endif
+
+   //Loop through the multicast groups
+   for(i = 0; i < COAP_SERVER_MAX_MULTICAST_GROUPS; i++)
+   {
+      //Matching group?
+      if(context->settings.groupAddr[i].length != 0 &&
+         ipCompAddr(&context->settings.groupAddr[i], ipAddr))
+      {
+         return TRUE;
+      }
+   }
+
+   //The datagram was sent to another multicast address
+   return FALSE;
+}
+
+
+/**
+ * @brief Queue the response to a multicast request
+ *
+ * Error responses are not sent, since they are useless to a client that
+ * addresses a whole group. Other responses are sent at a random point in
+ * time within the Leisure period, so that the members of a large group do
+ * not all answer at once (refer to RFC 7252, section 8.2). The caller must
+ * hold the mutex of the context
+ *
+ * @param[in] exchange Pointer to the request/response exchange
+ * @return Error code
+ **/
+
+error_t coapServerDeferResponse(CoapServerExchange *exchange)
+{
+   uint_t i;
+   uint_t codeClass;
+   CoapServerContext *context;
+   CoapServerDeferredResponse *entry;
+
+   //Point to the CoAP server context
+   context = exchange->context;
+
+   //Retrieve the class of the response code
+   codeClass = COAP_GET_CODE_CLASS(exchange->response.buffer[1]);
+
+   //A server may ignore a multicast request when it has nothing useful to
+   //respond, such as an error response
+   if(codeClass == COAP_CODE_CLASS_CLIENT_ERROR ||
+      codeClass == COAP_CODE_CLASS_SERVER_ERROR)
+   {
+      //Debug message
+      TRACE_DEBUG("CoAP Server: Error response to multicast request suppressed\r\n");
+
+      //Update statistics
+      context->multicastStats.suppressed++;
+      //The response is not sent
+      return NO_ERROR;
+   }
+
+   //Loop through the queue
+   for(i = 0; i < COAP_SERVER_MAX_DEFERRED_RESPONSES; i++)
+   {
+      //Free entry?
+      if(context->deferredResponses[i].length == 0)
+         break;
+   }
+
+   //The queue is full?
+   if(i >= COAP_SERVER_MAX_DEFERRED_RESPONSES)
+   {
+      //Debug message
+      TRACE_WARNING("CoAP Server: Too many deferred responses!\r\n");
+
+      //Update statistics
+      context->multicastStats.dropped++;
+      //Responses to multicast requests are not retransmitted anyway
+      return NO_ERROR;
+   }
+
+   //Point to the free entry
+   entry = &context->deferredResponses[i];
+
+   //The response is sent to the unicast address of the client
+   entry->clientIpAddr = exchange->clientIpAddr;
+   entry->clientPort = exchange->clientPort;
+
+   //Pick a random point of time within the Leisure period
+   entry->time = osGetSystemTime() + netGetRandRange(0, COAP_SERVER_LEISURE);
+
+   //Save the response
+   osMemcpy(entry->buffer, exchange->response.buffer,
+      exchange->response.length);
+
+   //The entry is now in use
+   entry->length = exchange->response.length;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Send the responses to multicast requests that are due
+ *
+ * The responses are queued by the CoAP server task and by the worker tasks.
+ * The caller must hold the mutex of the context
+ *
+ * @param[in] context Pointer to the CoAP server context
+ **/
+
+void coapServerMulticastTick(CoapServerContext *context)
+{
+   uint_t i;
+   systime_t time;
+   CoapServerDeferredResponse *entry;
+
+   //Get current time
+   time = osGetSystemTime();
+
+   //Loop through the queue
+   for(i = 0; i < COAP_SERVER_MAX_DEFERRED_RESPONSES; i++)
+   {
+      //Point to the current entry
+      entry = &context->deferredResponses[i];
+
+      //Response due?
+      if(entry->length > 0 && timeCompare(time, entry->time) >= 0)
+      {
+         //Debug message
+         TRACE_INFO("CoAP Server: Sending CoAP message (%" PRIuSIZE " bytes)...\r\n",
+            entry->length);
+
+         //Dump the contents of the message for debugging purpose
+         coapDumpMessage(entry->buffer, entry->length);
+
+         //The source address of the datagram is a unicast address of the
+         //interface, so that the client can tell the members of the group
+         //apart (refer to RFC 7252, section 8.1)
+         socketSendTo(context->socket, &entry->clientIpAddr, entry->clientPort,
+            entry->buffer, entry->length, NULL, 0);
+
+         //Update statistics
+         context->multicastStats.responses++;
+         //Release the entry
+         entry->length = 0;
+      }
+   }
+}
+
+
+/**
+ * @brief Get the time until the next deferred response is due
+ *
+ * The CoAP server task uses this value to limit its polling timeout, so
+ * that responses are sent at the time drawn within the Leisure period
+ * rather than at the next tick
+ *
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] timeout Default polling timeout
+ * @return Polling timeout
+ **/
+
+systime_t coapServerGetMulticastTimeout(CoapServerContext *context,
+   systime_t timeout)
+{
+   uint_t i;
+   systime_t time;
+   CoapServerDeferredResponse *entry;
+
+   //Get current time
+   time = osGetSystemTime();
+
+   //Loop through the queue
+   for(i = 0; i < COAP_SERVER_MAX_DEFERRED_RESPONSES; i++)
+   {
+      //Point to the current entry
+      entry = &context->deferredResponses[i];
+
+      //Pending response?
+      if(entry->length > 0)
+      {
+         //Deadline already reached?
+         if(timeCompare(time, entry->time) >= 0)
+         {
+            timeout = 0;
+         }
+         else
+         {
+            timeout = MIN(timeout, entry->time - time);
+         }
+      }
+   }
+
+   //Return the polling timeout
+   return timeout;
+}
+
+#endif
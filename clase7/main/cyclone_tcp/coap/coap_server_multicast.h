@@ -0,0 +1,69 @@
+/**
+ * @file coap_server_multicast.h
+ * @brief CoAP multicast (server side)
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+#ifndef _COAP_SERVER_MULTICAST_H
+#define _COAP_SERVER_MULTICAST_H
+
+//Dependencies
+#include "core/net.h"
+#include "coap/coap_server.h"
+
+//Check whether a request has been sent to a multicast group
+#if (COAP_SERVER_MULTICAST_SUPPORT == ENABLED)
+   #define COAP_SERVER_IS_MULTICAST_EXCHANGE(exchange) \
+      ipIsMulticastAddr(&(exchange)->serverIpAddr)
+#else
+   #define COAP_SERVER_IS_MULTICAST_EXCHANGE(exchange) FALSE
+#endif
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//CoAP server related functions
+error_t coapServerJoinMulticastGroups(CoapServerContext *context);
+
+bool_t coapServerIsMulticastGroup(CoapServerContext *context,
+   const IpAddr *ipAddr);
+
+error_t coapServerDeferResponse(CoapServerExchange *exchange);
+
+void coapServerMulticastTick(CoapServerContext *context);
+
+systime_t coapServerGetMulticastTimeout(CoapServerContext *context,
+   systime_t timeout);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
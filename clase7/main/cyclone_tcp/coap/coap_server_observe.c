@@ -0,0 +1,751 @@
+/**
+ * @file coap_server_observe.c
+ * @brief CoAP server Observe support (RFC 7641)
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL COAP_TRACE_LEVEL
+
+//Dependencies
+#include "coap/coap_server.h"
+#include "coap/coap_server_request.h"
+#include "coap/coap_server_misc.h"
+#include "coap/coap_server_resource.h"
+#include "coap/coap_server_observe.h"
+#include "coap/coap_debug.h"
+#include "debug.h"
+
+//Check TCP/IP stack configuration
+#if (COAP_SERVER_SUPPORT == ENABLED && COAP_SERVER_OBSERVE_SUPPORT == ENABLED)
+
+
+/**
+ * @brief Notify the observers of a resource
+ *
+ * The function only flags the resource and wakes up the CoAP server task,
+ * which renders the current representation once and sends it to every
+ * observer. It can be called from any task, including from a resource
+ * handler
+ *
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] resource Resource whose state has changed
+ * @return Error code
+ **/
+
+error_t coapServerNotify(CoapServerContext *context,
+   const CoapServerResource *resource)
+{
+   int_t index;
+
+   //Check parameters
+   if(context == NULL || resource == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Retrieve the registration index of the resource
+   index = coapServerGetResourceIndex(context, resource->path);
+
+   //Unknown resource?
+   if(index < 0 || context->resources[index] != resource)
+      return ERROR_NOT_FOUND;
+
+   //The per-resource flag must be set before the summary flag, so that the
+   //CoAP server task never misses a notification
+   context->notifyPending[index] = TRUE;
+   context->notify = TRUE;
+
+   //Wake up the CoAP server task
+   osSetEvent(&context->event);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Process the Observe option of a GET request
+ *
+ * This function is called once the resource handler has formatted the
+ * response. A successful response to a registration request carries the
+ * current sequence number, while a deregistration request or an error
+ * response removes the observer (refer to RFC 7641, section 4.1)
+ *
+ * @param[in] exchange Pointer to the request/response exchange
+ * @param[in] index Registration index of the requested resource
+ * @return Error code
+ **/
+
+error_t coapServerProcessObserve(CoapServerExchange *exchange, uint_t index)
+{
+   error_t error;
+   uint_t i;
+   uint32_t value;
+   uint32_t accept;
+   uint32_t seq;
+   CoapCode code;
+   const CoapMessageHeader *header;
+   CoapServerContext *context;
+   CoapServerObserver *observer;
+
+   //Search the request for an Observe option
+   error = coapServerGetUintOption(exchange, COAP_OPT_OBSERVE, 0, &value);
+
+   //Plain GET request?
+   if(error)
+      return NO_ERROR;
+
+   //Point to the CoAP server context
+   context = exchange->context;
+
+   //Retrieve the response code
+   coapGetCode(&exchange->response, &code);
+
+   //The observer table is shared with the CoAP server task
+   osAcquireMutex(&context->mutex);
+
+   //Look for an existing registration
+   observer = coapServerFindObserver(exchange, index);
+   //Sequence number of the current state
+   seq = context->observeSeq;
+
+   //Registration request?
+   if(value == 0 && COAP_GET_CODE_CLASS(code) == COAP_CODE_CLASS_SUCCESS)
+   {
+      //New observer?
+      if(observer == NULL)
+      {
+         //Loop through the observer table
+         for(i = 0; i < COAP_SERVER_MAX_OBSERVERS; i++)
+         {
+            //Free entry?
+            if(context->observers[i].resource == 0)
+            {
+               observer = &context->observers[i];
+               break;
+            }
+         }
+
+         //Any free entry?
+         if(observer != NULL)
+         {
+            //Point to the CoAP request header
+            header = (CoapMessageHeader *) exchange->request.buffer;
+
+            //Save the resource, the client endpoint and the token
+            osMemset(observer, 0, sizeof(CoapServerObserver));
+            observer->resource = (uint16_t) (index + 1);
+            observer->serverIpAddr = exchange->serverIpAddr;
+            observer->clientIpAddr = exchange->clientIpAddr;
+            observer->clientPort = exchange->clientPort;
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+            observer->connection = exchange->connection;
+            observer->connectionId = exchange->connectionId;
+#endif
+            observer->tokenLen = header->tokenLen;
+            osMemcpy(observer->token, header->token, header->tokenLen);
+
+            //Update statistics
+            context->observeStats.registrations++;
+
+            //Debug message
+            TRACE_INFO("CoAP Server: Observer registered for %s\r\n",
+               context->resources[index]->path);
+         }
+      }
+
+      //If the server cannot add the client to the list of observers, the
+      //request is processed as a plain GET request
+      if(observer != NULL)
+      {
+         //Notifications use the content format of the registration request
+         //(refer to RFC 7641, section 3.2)
+         if(coapServerGetUintOption(exchange, COAP_OPT_ACCEPT, 0, &accept))
+            observer->accept = -1;
+         else
+            observer->accept = (int32_t) accept;
+
+         //The response carries the sequence number of the current state
+         error = coapServerSetUintOption(exchange, COAP_OPT_OBSERVE, 0,
+            seq & 0xFFFFFF);
+      }
+      else
+      {
+         error = NO_ERROR;
+      }
+   }
+   else if(observer != NULL)
+   {
+      //Remove the observer
+      coapServerDeleteObserver(context, observer);
+
+      //Update statistics
+      context->observeStats.deregistrations++;
+
+      //Successful processing
+      error = NO_ERROR;
+   }
+   else
+   {
+      //Nothing to do
+      error = NO_ERROR;
+   }
+
+   //Release exclusive access to the observer table
+   osReleaseMutex(&context->mutex);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Process an Acknowledgement or Reset message
+ *
+ * An Acknowledgement completes the delivery of a confirmable notification.
+ * A Reset message rejects a notification and removes the observer (refer to
+ * RFC 7641, section 3.6)
+ *
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] type Message type
+ * @param[in] mid Message ID
+ **/
+
+void coapServerProcessObserveAck(CoapServerContext *context,
+   CoapMessageType type, uint16_t mid)
+{
+   uint_t i;
+   CoapServerObserver *observer;
+
+   //Loop through the observer table
+   for(i = 0; i < COAP_SERVER_MAX_OBSERVERS; i++)
+   {
+      //Point to the current entry
+      observer = &context->observers[i];
+
+      //Matching notification?
+      if(observer->resource != 0 && observer->mid == mid &&
+         observer->clientPort == context->clientPort &&
+         ipCompAddr(&observer->clientIpAddr, &context->clientIpAddr))
+      {
+         //Reset message?
+         if(type == COAP_TYPE_RST)
+         {
+            //Debug message
+            TRACE_INFO("CoAP Server: Notification rejected by observer\r\n");
+
+            //Remove the observer
+            coapServerDeleteObserver(context, observer);
+
+            //Update statistics
+            context->observeStats.resets++;
+         }
+         else
+         {
+            //The confirmable notification has been acknowledged
+            observer->conPending = FALSE;
+            observer->retransmitCount = 0;
+         }
+
+         //We are done
+         break;
+      }
+   }
+}
+
+
+/**
+ * @brief Handle retransmission of confirmable notifications
+ *
+ * An unacknowledged notification is not retransmitted as is: the current
+ * state of the resource is sent instead (refer to RFC 7641, section 4.5.2).
+ * The observer is removed once the retransmissions are exhausted
+ *
+ * @param[in] context Pointer to the CoAP server context
+ **/
+
+void coapServerObserveTick(CoapServerContext *context)
+{
+   uint_t i;
+   systime_t time;
+   CoapServerObserver *observer;
+
+   //Get current time
+   time = osGetSystemTime();
+
+   //Loop through the observer table
+   for(i = 0; i < COAP_SERVER_MAX_OBSERVERS; i++)
+   {
+      //Point to the current entry
+      observer = &context->observers[i];
+
+      //Confirmable notification awaiting acknowledgment?
+      if(observer->resource != 0 && observer->conPending)
+      {
+         //Acknowledgment timeout?
+         if(timeCompare(time, observer->timestamp + observer->timeout) >= 0)
+         {
+            //Any retransmission left?
+            if(observer->retransmitCount < COAP_SERVER_MAX_RETRANSMIT)
+            {
+               //The timeout is doubled after each retransmission
+               observer->retransmitCount++;
+               observer->timeout *= 2;
+               observer->timestamp = time;
+
+               //Send the current state of the resource
+               context->notifyPending[observer->resource - 1] = TRUE;
+               context->notify = TRUE;
+            }
+            else
+            {
+               //Debug message
+               TRACE_INFO("CoAP Server: Observer timeout!\r\n");
+
+               //Remove the observer
+               coapServerDeleteObserver(context, observer);
+
+               //Update statistics
+               context->observeStats.timeouts++;
+            }
+         }
+      }
+   }
+}
+
+
+/**
+ * @brief Send pending notifications
+ * @param[in] context Pointer to the CoAP server context
+ **/
+
+void coapServerProcessNotifications(CoapServerContext *context)
+{
+   uint_t i;
+
+   //Any pending notification?
+   if(context->notify)
+   {
+      //Clear the summary flag before scanning the resources
+      context->notify = FALSE;
+
+      //Loop through the registered resources
+      for(i = 0; i < context->numResources; i++)
+      {
+         //Notification requested for this resource?
+         if(context->notifyPending[i])
+         {
+            //Clear the flag before rendering, so that a state change that
+            //occurs in the meantime triggers another notification
+            context->notifyPending[i] = FALSE;
+
+            //Notify the observers of the resource
+            coapServerSendNotifications(context, i);
+         }
+      }
+   }
+}
+
+
+/**
+ * @brief Send the current state of a resource to all its observers
+ *
+ * The representation is rendered once per content format requested by the
+ * observers of the resource
+ *
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] index Registration index of the resource
+ * @return Error code
+ **/
+
+error_t coapServerSendNotifications(CoapServerContext *context, uint_t index)
+{
+   error_t error;
+   uint_t i;
+   uint_t j;
+   uint_t n;
+   bool_t found;
+   int32_t accept;
+   int32_t rendered[COAP_SERVER_MAX_OBSERVERS];
+
+   //Initialize variables
+   error = NO_ERROR;
+   found = TRUE;
+   accept = -1;
+   n = 0;
+
+   //Loop through the content formats requested by the observers
+   while(!error && found && n < COAP_SERVER_MAX_OBSERVERS)
+   {
+      //The observer table is shared with the worker tasks
+      osAcquireMutex(&context->mutex);
+
+      //Look for an observer whose content format has not been rendered yet
+      for(found = FALSE, i = 0; i < COAP_SERVER_MAX_OBSERVERS && !found; i++)
+      {
+         //Observer of the resource?
+         if(context->observers[i].resource == (index + 1))
+         {
+            //Retrieve the requested content format
+            accept = context->observers[i].accept;
+            found = TRUE;
+
+            //Check whether this content format has already been rendered
+            for(j = 0; j < n && found; j++)
+            {
+               if(rendered[j] == accept)
+                  found = FALSE;
+            }
+         }
+      }
+
+      //Release exclusive access to the observer table
+      osReleaseMutex(&context->mutex);
+
+      //Any observer left?
+      if(found)
+      {
+         //Notify the observers that requested this content format
+         rendered[n++] = accept;
+         error = coapServerNotifyObservers(context, index, accept);
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Render a notification and send it to the matching observers
+ *
+ * The resource handler is invoked once, on behalf of all the observers
+ * that requested the same content format. Only the message header and the
+ * token differ from one observer to another
+ *
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] index Registration index of the resource
+ * @param[in] accept Content format requested by the observers (-1 if none)
+ * @return Error code
+ **/
+
+error_t coapServerNotifyObservers(CoapServerContext *context, uint_t index,
+   int32_t accept)
+{
+   error_t error;
+   uint_t i;
+   CoapCode code;
+   CoapMessageHeader *header;
+   CoapServerExchange *exchange;
+   CoapServerObserver *observer;
+   const CoapServerResource *resource;
+
+   //Point to the resource definition
+   resource = context->resources[index];
+   //The representation is rendered in the exchange of the CoAP server task
+   exchange = &context->exchange;
+
+   //Point to the CoAP request header
+   header = (CoapMessageHeader *) exchange->request.buffer;
+
+   //Format a GET request with no token
+   header->version = COAP_VERSION_1;
+   header->type = COAP_TYPE_NON;
+   header->tokenLen = 0;
+   header->code = COAP_CODE_GET;
+   header->mid = 0;
+
+   //Set the length of the request
+   exchange->request.length = sizeof(CoapMessageHeader);
+   exchange->request.pos = 0;
+
+   //Ask the handler for the content format the observers registered with
+   if(accept >= 0)
+   {
+      coapSetUintOption(&exchange->request, COAP_OPT_ACCEPT, 0,
+         (uint32_t) accept);
+   }
+
+   //Terminate the request with a NULL character
+   exchange->request.buffer[exchange->request.length] = '\0';
+
+   //Index the options of the request
+   coapParseMessageEx(&exchange->request, &exchange->requestIndex);
+
+   //Save the path of the resource
+   osStrncpy(exchange->uri, resource->path, COAP_SERVER_MAX_URI_LEN);
+   exchange->uri[COAP_SERVER_MAX_URI_LEN] = '\0';
+
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+   //The representation is rendered in the datagram format, whatever the
+   //transport of the observers
+   exchange->connection = NULL;
+#endif
+
+   //Initialize the notification
+   coapServerInitResponse(exchange);
+
+   //Render the representation once for all the observers. The handler is
+   //invoked without holding the mutex. The flag lets it tell the render
+   //apart from a client GET, so that it does not apply the side effects of
+   //a read
+   exchange->notification = TRUE;
+   error = resource->callback(exchange, resource, COAP_CODE_GET);
+   exchange->notification = FALSE;
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Retrieve the response code
+   coapGetCode(&exchange->response, &code);
+
+   //The observer table is shared with the worker tasks
+   osAcquireMutex(&context->mutex);
+
+   //Update statistics
+   context->observeStats.renders++;
+
+   //Successful response?
+   if(COAP_GET_CODE_CLASS(code) == COAP_CODE_CLASS_SUCCESS)
+   {
+      //Sequence numbers are shared by all resources, which keeps them
+      //strictly increasing for each observer
+      context->observeSeq++;
+
+      //Add the Observe option
+      error = coapServerSetUintOption(exchange, COAP_OPT_OBSERVE, 0,
+         context->observeSeq & 0xFFFFFF);
+   }
+
+   //Loop through the observer table
+   for(i = 0; i < COAP_SERVER_MAX_OBSERVERS && !error; i++)
+   {
+      //Point to the current entry
+      observer = &context->observers[i];
+
+      //Observer of the resource that requested this content format?
+      if(observer->resource == (index + 1) && observer->accept == accept)
+      {
+         //Send the notification
+         error = coapServerSendNotification(context, observer);
+
+         //An error response terminates the observation (refer to RFC 7641,
+         //section 3.2)
+         if(error || COAP_GET_CODE_CLASS(code) != COAP_CODE_CLASS_SUCCESS)
+         {
+            coapServerDeleteObserver(context, observer);
+         }
+
+         //A failure only affects this observer
+         error = NO_ERROR;
+      }
+   }
+
+   //Release exclusive access to the observer table
+   osReleaseMutex(&context->mutex);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Send a notification to an observer
+ *
+ * The notification rendered in the response buffer is copied to the I/O
+ * buffer with the message ID and the token of the observer. One notification
+ * out of COAP_SERVER_OBSERVE_CON_PERIOD is confirmable, so that observers
+ * which are no longer interested are eventually detected
+ *
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] observer Pointer to the observer
+ * @return Error code
+ **/
+
+error_t coapServerSendNotification(CoapServerContext *context,
+   CoapServerObserver *observer)
+{
+   error_t error;
+   bool_t con;
+   size_t n;
+   size_t length;
+   CoapMessageHeader *header;
+   CoapServerExchange *exchange;
+
+   //Point to the exchange holding the rendered notification
+   exchange = &context->exchange;
+
+   //Length of the notification, excluding the header
+   n = exchange->response.length - sizeof(CoapMessageHeader);
+   //Length of the message sent to this observer
+   length = sizeof(CoapMessageHeader) + observer->tokenLen + n;
+
+   //Make sure the I/O buffer is large enough
+   if(length > COAP_SERVER_BUFFER_SIZE)
+      return ERROR_BUFFER_OVERFLOW;
+
+   //Count notifications
+   observer->count++;
+
+   //A notification replacing an unacknowledged confirmable notification
+   //must be confirmable too
+   con = observer->conPending ||
+      (observer->count % COAP_SERVER_OBSERVE_CON_PERIOD) == 0;
+
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+   //Messages over TCP are not acknowledged. The connection itself tells
+   //whether the observer is still there (refer to RFC 8323, section 7)
+   if(observer->connection != NULL)
+   {
+      con = FALSE;
+   }
+#endif
+
+   //Point to the message header
+   header = (CoapMessageHeader *) context->buffer;
+
+   //Each observer receives its own message ID and token
+   header->version = COAP_VERSION_1;
+   header->type = con ? COAP_TYPE_CON : COAP_TYPE_NON;
+   header->tokenLen = observer->tokenLen;
+   header->code = ((CoapMessageHeader *) exchange->response.buffer)->code;
+   header->mid = htons(++context->mid);
+   osMemcpy(header->token, observer->token, observer->tokenLen);
+
+   //Copy options and payload
+   osMemcpy(context->buffer + sizeof(CoapMessageHeader) + observer->tokenLen,
+      exchange->response.buffer + sizeof(CoapMessageHeader), n);
+
+   //Save the message ID to match the Acknowledgement or Reset message
+   observer->mid = context->mid;
+
+   //Address the observer
+   exchange->serverIpAddr = observer->serverIpAddr;
+   exchange->clientIpAddr = observer->clientIpAddr;
+   exchange->clientPort = observer->clientPort;
+
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+   //Observers registered over TCP are notified over the same connection
+   exchange->connection = observer->connection;
+   exchange->connectionId = observer->connectionId;
+#endif
+
+   //Debug message
+   TRACE_INFO("CoAP Server: Sending notification (%" PRIuSIZE " bytes)...\r\n",
+      length);
+
+   //Dump the contents of the message for debugging purpose
+   coapDumpMessage(context->buffer, length);
+
+   //Send the notification
+   error = coapServerSendResponse(exchange, context->buffer, length);
+
+   //Check status code
+   if(!error)
+   {
+      //Update statistics
+      context->observeStats.notifications++;
+
+      //Confirmable notification?
+      if(con)
+      {
+         //Update statistics
+         context->observeStats.conNotifications++;
+
+         //First transmission?
+         if(!observer->conPending)
+         {
+            observer->conPending = TRUE;
+            observer->retransmitCount = 0;
+            observer->timeout = COAP_SERVER_ACK_TIMEOUT;
+         }
+
+         //Save the time at which the notification was sent
+         observer->timestamp = osGetSystemTime();
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Find the observer matching the current request
+ * @param[in] exchange Pointer to the request/response exchange
+ * @param[in] index Registration index of the requested resource
+ * @return Pointer to the matching observer, if any
+ **/
+
+CoapServerObserver *coapServerFindObserver(CoapServerExchange *exchange,
+   uint_t index)
+{
+   uint_t i;
+   const CoapMessageHeader *header;
+   CoapServerObserver *observer;
+
+   //Point to the CoAP request header
+   header = (CoapMessageHeader *) exchange->request.buffer;
+
+   //Loop through the observer table
+   for(i = 0; i < COAP_SERVER_MAX_OBSERVERS; i++)
+   {
+      //Point to the current entry
+      observer = &exchange->context->observers[i];
+
+      //Observers are identified by the resource, the endpoint and the token
+      if(observer->resource == (index + 1) &&
+         observer->clientPort == exchange->clientPort &&
+         ipCompAddr(&observer->clientIpAddr, &exchange->clientIpAddr) &&
+         observer->tokenLen == header->tokenLen &&
+         osMemcmp(observer->token, header->token, header->tokenLen) == 0)
+      {
+         return observer;
+      }
+   }
+
+   //No matching observer
+   return NULL;
+}
+
+
+/**
+ * @brief Remove an observer
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] observer Pointer to the observer
+ **/
+
+void coapServerDeleteObserver(CoapServerContext *context,
+   CoapServerObserver *observer)
+{
+   //Debug message
+   TRACE_INFO("CoAP Server: Removing observer...\r\n");
+
+   //Release the entry
+   osMemset(observer, 0, sizeof(CoapServerObserver));
+}
+
+#endif
@@ -0,0 +1,74 @@
+/**
+ * @file coap_server_observe.h
+ * @brief CoAP server Observe support (RFC 7641)
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+#ifndef _COAP_SERVER_OBSERVE_H
+#define _COAP_SERVER_OBSERVE_H
+
+//Dependencies
+#include "core/net.h"
+#include "coap/coap_server.h"
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//CoAP server related functions
+error_t coapServerNotify(CoapServerContext *context,
+   const CoapServerResource *resource);
+
+error_t coapServerProcessObserve(CoapServerExchange *exchange, uint_t index);
+
+void coapServerProcessObserveAck(CoapServerContext *context,
+   CoapMessageType type, uint16_t mid);
+
+void coapServerObserveTick(CoapServerContext *context);
+void coapServerProcessNotifications(CoapServerContext *context);
+
+error_t coapServerSendNotifications(CoapServerContext *context, uint_t index);
+
+error_t coapServerNotifyObservers(CoapServerContext *context, uint_t index,
+   int32_t accept);
+
+error_t coapServerSendNotification(CoapServerContext *context,
+   CoapServerObserver *observer);
+
+CoapServerObserver *coapServerFindObserver(CoapServerExchange *exchange,
+   uint_t index);
+
+void coapServerDeleteObserver(CoapServerContext *context,
+   CoapServerObserver *observer);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -42,67 +42,67 @@
 
 /**
  * @brief Get request method
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @param[out] code Method code (GET, POST, PUT or DELETE)
  * @return Error code
  **/
 
-error_t coapServerGetMethodCode(CoapServerContext *context, CoapCode *code)
+error_t coapServerGetMethodCode(CoapServerExchange *exchange, CoapCode *code)
 {
    //Check parameters
-   if(context == NULL || code == NULL)
+   if(exchange == NULL || code == NULL)
       return ERROR_INVALID_PARAMETER;
 
    //Get request method
-   return coapGetCode(&context->request, code);
+   return coapGetCode(&exchange->request, code);
 }
 
 
 /**
  * @brief Get Uri-Path option
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @param[out] path Pointer to the buffer where to copy the path component
  * @param[in] maxLen Maximum number of characters the buffer can hold
  * @return Error code
  **/
 
-error_t coapServerGetUriPath(CoapServerContext *context, char_t *path,
+error_t coapServerGetUriPath(CoapServerExchange *exchange, char_t *path,
    size_t maxLen)
 {
    //Check parameters
-   if(context == NULL || path == NULL)
+   if(exchange == NULL || path == NULL)
       return ERROR_INVALID_PARAMETER;
 
    //Reconstruct the path component from Uri-Path options
-   return coapJoinRepeatableOption(&context->request, COAP_OPT_URI_PATH,
-      path, maxLen, '/');
+   return coapJoinIndexedOption(&exchange->request, &exchange->requestIndex,
+      COAP_OPT_URI_PATH, path, maxLen, '/');
 }
 
 
 /**
  * @brief Get Uri-Query option
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @param[out] queryString Pointer to the buffer where to copy the query string
  * @param[in] maxLen Maximum number of characters the buffer can hold
  * @return Error code
  **/
 
-error_t coapServerGetUriQuery(CoapServerContext *context, char_t *queryString,
+error_t coapServerGetUriQuery(CoapServerExchange *exchange, char_t *queryString,
    size_t maxLen)
 {
    //Check parameters
-   if(context == NULL || queryString == NULL)
+   if(exchange == NULL || queryString == NULL)
       return ERROR_INVALID_PARAMETER;
 
    //Reconstruct the query string from Uri-Query options
-   return coapJoinRepeatableOption(&context->request, COAP_OPT_URI_QUERY,
-      queryString, maxLen, '&');
+   return coapJoinIndexedOption(&exchange->request, &exchange->requestIndex,
+      COAP_OPT_URI_QUERY, queryString, maxLen, '&');
 }
 
 
 /**
  * @brief Read an opaque option from the CoAP request
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @param[in] optionNum Option number to search for
  * @param[in] optionIndex Occurrence index (for repeatable options only)
  * @param[out] optionValue Pointer to the first byte of the option value
@@ -110,22 +110,22 @@ error_t coapServerGetUriQuery(CoapServerContext *context, char_t *queryString,
  * @return Error code
  **/
 
-error_t coapServerGetOpaqueOption(CoapServerContext *context, uint16_t optionNum,
+error_t coapServerGetOpaqueOption(CoapServerExchange *exchange, uint16_t optionNum,
    uint_t optionIndex, const uint8_t **optionValue, size_t *optionLen)
 {
    //Check parameters
-   if(context == NULL || optionValue == NULL || optionLen == NULL)
+   if(exchange == NULL || optionValue == NULL || optionLen == NULL)
       return ERROR_INVALID_PARAMETER;
 
-   //Search the CoAP message for the specified option number
-   return coapGetOption(&context->request, optionNum, optionIndex, optionValue,
-      optionLen);
+   //Look up the option in the index built when the request was parsed
+   return coapGetIndexedOption(&exchange->request, &exchange->requestIndex,
+      optionNum, optionIndex, optionValue, optionLen);
 }
 
 
 /**
  * @brief Read a string option from the CoAP request
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @param[in] optionNum Option number to search for
  * @param[in] optionIndex Occurrence index (for repeatable options only)
  * @param[out] optionValue Pointer to the first byte of the option value
@@ -133,143 +133,196 @@ error_t coapServerGetOpaqueOption(CoapServerContext *context, uint16_t optionNum
  * @return Error code
  **/
 
-error_t coapServerGetStringOption(CoapServerContext *context, uint16_t optionNum,
+error_t coapServerGetStringOption(CoapServerExchange *exchange, uint16_t optionNum,
    uint_t optionIndex, const char_t **optionValue, size_t *optionLen)
 {
    //Check parameters
-   if(context == NULL || optionValue == NULL || optionLen == NULL)
+   if(exchange == NULL || optionValue == NULL || optionLen == NULL)
       return ERROR_INVALID_PARAMETER;
 
-   //Search the CoAP message for the specified option number
-   return coapGetOption(&context->request, optionNum, optionIndex,
-      (const uint8_t **) optionValue, optionLen);
+   //Look up the option in the index built when the request was parsed
+   return coapGetIndexedOption(&exchange->request, &exchange->requestIndex,
+      optionNum, optionIndex, (const uint8_t **) optionValue, optionLen);
 }
 
 
 /**
  * @brief Read an uint option from the CoAP request
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @param[in] optionNum Option number to search for
  * @param[in] optionIndex Occurrence index (for repeatable options only)
  * @param[out] optionValue Option value (unsigned integer)
  * @return Error code
  **/
 
-error_t coapServerGetUintOption(CoapServerContext *context, uint16_t optionNum,
+error_t coapServerGetUintOption(CoapServerExchange *exchange, uint16_t optionNum,
    uint_t optionIndex, uint32_t *optionValue)
 {
    //Check parameters
-   if(context == NULL || optionValue == NULL)
+   if(exchange == NULL || optionValue == NULL)
       return ERROR_INVALID_PARAMETER;
 
-   //Search the CoAP message for the specified option number
-   return coapGetUintOption(&context->request, optionNum, optionIndex,
-      optionValue);
+   //Look up the option in the index built when the request was parsed
+   return coapGetIndexedUintOption(&exchange->request, &exchange->requestIndex,
+      optionNum, optionIndex, optionValue);
 }
 
 
 /**
  * @brief Get request payload
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @param[out] payload Pointer to the first byte of the payload
  * @param[out] payloadLen Length of the payload, in bytes
  * @return Error code
  **/
 
-error_t coapServerGetPayload(CoapServerContext *context, const uint8_t **payload,
+error_t coapServerGetPayload(CoapServerExchange *exchange, const uint8_t **payload,
    size_t *payloadLen)
 {
+   size_t n;
+
    //Check parameters
-   if(context == NULL || payload == NULL || payloadLen == NULL)
+   if(exchange == NULL || payload == NULL || payloadLen == NULL)
       return ERROR_INVALID_PARAMETER;
 
-   //Get response payload
-   return coapGetPayload(&context->request, payload, payloadLen);
+   //The position of the payload marker was saved when the request was parsed
+   n = exchange->requestIndex.payloadPos;
+
+   //The payload is optional
+   if(n < exchange->request.length)
+   {
+      //The payload is prefixed by a fixed, one-byte payload marker
+      n++;
+   }
+
+   //Point to the first byte of the payload, if any
+   *payload = exchange->request.buffer + n;
+   //Save the length of the payload
+   *payloadLen = exchange->request.length - n;
+
+   //Successful processing
+   return NO_ERROR;
 }
 
 
 /**
  * @brief Read request payload data
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @param[out] data Buffer into which received data will be placed
  * @param[in] size Maximum number of bytes that can be received
  * @param[out] length Number of bytes that have been received
  * @return Error code
  **/
 
-error_t coapServerReadPayload(CoapServerContext *context, void *data, size_t size,
+error_t coapServerReadPayload(CoapServerExchange *exchange, void *data, size_t size,
    size_t *length)
 {
+   error_t error;
+   size_t n;
+   const uint8_t *p;
+
    //Check parameters
-   if(context == NULL || data == NULL)
+   if(exchange == NULL || data == NULL || length == NULL)
       return ERROR_INVALID_PARAMETER;
 
-   //Read payload data
-   return coapReadPayload(&context->request, data, size, length);
+   //Locate the request payload
+   coapServerGetPayload(exchange, &p, &n);
+
+   //Any data to be copied?
+   if(exchange->request.pos < n)
+   {
+      //Limit the number of bytes to copy at a time
+      n = MIN(n - exchange->request.pos, size);
+
+      //Copy data
+      osMemcpy(data, p + exchange->request.pos, n);
+
+      //Advance current position
+      exchange->request.pos += n;
+      //Total number of data that have been read
+      *length = n;
+
+      //Successful processing
+      error = NO_ERROR;
+   }
+   else
+   {
+      //No more data available
+      error = ERROR_END_OF_STREAM;
+   }
+
+   //Return status code
+   return error;
 }
 
 
 /**
  * @brief Set response method
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @param[in] code Response code
  * @return Error code
  **/
 
-error_t coapServerSetResponseCode(CoapServerContext *context, CoapCode code)
+error_t coapServerSetResponseCode(CoapServerExchange *exchange, CoapCode code)
 {
    //Make sure the CoAP message is valid
-   if(context == NULL)
+   if(exchange == NULL)
       return ERROR_INVALID_PARAMETER;
 
    //Set response code
-   return coapSetCode(&context->response, code);
+   return coapSetCode(&exchange->response, code);
 }
 
 
 /**
  * @brief Set Location-Path option
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @param[in] path NULL-terminated string that contains the path component
  * @return Error code
  **/
 
-error_t coapServerSetLocationPath(CoapServerContext *context,
+error_t coapServerSetLocationPath(CoapServerExchange *exchange,
    const char_t *path)
 {
    //Check parameters
-   if(context == NULL || path == NULL)
+   if(exchange == NULL || path == NULL)
       return ERROR_INVALID_PARAMETER;
 
+   //Options are no longer appended by the option writer
+   exchange->responseWriter.length = 0;
+
    //Encode the path component into multiple Location-Path options
-   return coapSplitRepeatableOption(&context->response, COAP_OPT_LOCATION_PATH,
+   return coapSplitRepeatableOption(&exchange->response, COAP_OPT_LOCATION_PATH,
       path, '/');
 }
 
 
 /**
  * @brief Set Location-Query option
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @param[in] queryString NULL-terminated string that contains the query string
  * @return Error code
  **/
 
-error_t coapServerSetLocationQuery(CoapServerContext *context,
+error_t coapServerSetLocationQuery(CoapServerExchange *exchange,
    const char_t *queryString)
 {
    //Check parameters
-   if(context == NULL || queryString == NULL)
+   if(exchange == NULL || queryString == NULL)
       return ERROR_INVALID_PARAMETER;
 
+   //Options are no longer appended by the option writer
+   exchange->responseWriter.length = 0;
+
    //Encode the query string into multiple Location-Query options
-   return coapSplitRepeatableOption(&context->response, COAP_OPT_LOCATION_QUERY,
+   return coapSplitRepeatableOption(&exchange->response, COAP_OPT_LOCATION_QUERY,
       queryString, '&');
 }
 
 
 /**
  * @brief Add an opaque option to the CoAP response
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @param[in] optionNum Option number
  * @param[in] optionIndex Occurrence index (for repeatable options only)
  * @param[in] optionValue Pointer to the first byte of the option value
@@ -277,11 +330,11 @@ error_t coapServerSetLocationQuery(CoapServerContext *context,
  * @return Error code
  **/
 
-error_t coapServerSetOpaqueOption(CoapServerContext *context, uint16_t optionNum,
+error_t coapServerSetOpaqueOption(CoapServerExchange *exchange, uint16_t optionNum,
    uint_t optionIndex, const uint8_t *optionValue, size_t optionLen)
 {
    //Make sure the CoAP message is valid
-   if(context == NULL)
+   if(exchange == NULL)
       return ERROR_INVALID_PARAMETER;
 
    //Inconsistent option value?
@@ -289,121 +342,130 @@ error_t coapServerSetOpaqueOption(CoapServerContext *context, uint16_t optionNum
       return ERROR_INVALID_PARAMETER;
 
    //Add the specified option to the CoAP message
-   return coapSetOption(&context->response, optionNum, optionIndex,
-      optionValue, optionLen);
+   return coapAppendOption(&exchange->responseWriter, &exchange->response,
+      optionNum, optionIndex, optionValue, optionLen);
 }
 
 
 /**
  * @brief Add a string option to the CoAP response
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @param[in] optionNum Option number
  * @param[in] optionIndex Occurrence index (for repeatable options only)
  * @param[in] optionValue NULL-terminated string that contains the option value
  * @return Error code
  **/
 
-error_t coapServerSetStringOption(CoapServerContext *context, uint16_t optionNum,
+error_t coapServerSetStringOption(CoapServerExchange *exchange, uint16_t optionNum,
    uint_t optionIndex, const char_t *optionValue)
 {
    size_t n;
 
    //Check parameters
-   if(context == NULL || optionValue == NULL)
+   if(exchange == NULL || optionValue == NULL)
       return ERROR_INVALID_PARAMETER;
 
    //Retrieve the length of the string
    n = osStrlen(optionValue);
 
    //Add the specified option to the CoAP message
-   return coapSetOption(&context->response, optionNum, optionIndex,
-      (const uint8_t *) optionValue, n);
+   return coapAppendOption(&exchange->responseWriter, &exchange->response,
+      optionNum, optionIndex, (const uint8_t *) optionValue, n);
 }
 
 
 /**
  * @brief Add a uint option to the CoAP response
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @param[in] optionNum Option number
  * @param[in] optionIndex Occurrence index (for repeatable options only)
  * @param[in] optionValue Option value (unsigned integer)
  * @return Error code
  **/
 
-error_t coapServerSetUintOption(CoapServerContext *context, uint16_t optionNum,
+error_t coapServerSetUintOption(CoapServerExchange *exchange, uint16_t optionNum,
    uint_t optionIndex, uint32_t optionValue)
 {
    //Make sure the CoAP message is valid
-   if(context == NULL)
+   if(exchange == NULL)
       return ERROR_INVALID_PARAMETER;
 
    //Add the specified option to the CoAP message
-   return coapSetUintOption(&context->response, optionNum, optionIndex,
-      optionValue);
+   return coapAppendUintOption(&exchange->responseWriter, &exchange->response,
+      optionNum, optionIndex, optionValue);
 }
 
 
 /**
  * @brief Remove an option from the CoAP response
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @param[in] optionNum Option number
  * @param[in] optionIndex Occurrence index (for repeatable options only)
  * @return Error code
  **/
 
-error_t coapServerDeleteOption(CoapServerContext *context, uint16_t optionNum,
+error_t coapServerDeleteOption(CoapServerExchange *exchange, uint16_t optionNum,
    uint_t optionIndex)
 {
    //Make sure the CoAP message is valid
-   if(context == NULL)
+   if(exchange == NULL)
       return ERROR_INVALID_PARAMETER;
 
+   //Options are no longer appended by the option writer
+   exchange->responseWriter.length = 0;
+
    //Remove the specified option from the CoAP message
-   return coapDeleteOption(&context->response, optionNum, optionIndex);
+   return coapDeleteOption(&exchange->response, optionNum, optionIndex);
 }
 
 
 /**
  * @brief Set response payload
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @param[out] payload Pointer to request payload
  * @param[out] payloadLen Length of the payload, in bytes
  * @return Error code
  **/
 
-error_t coapServerSetPayload(CoapServerContext *context, const void *payload,
+error_t coapServerSetPayload(CoapServerExchange *exchange, const void *payload,
    size_t payloadLen)
 {
    //Make sure the CoAP message is valid
-   if(context == NULL)
+   if(exchange == NULL)
       return ERROR_INVALID_PARAMETER;
 
    //Check parameters
    if(payload == NULL && payloadLen != 0)
       return ERROR_INVALID_PARAMETER;
 
+   //Options cannot be appended after the payload
+   exchange->responseWriter.length = 0;
+
    //Set message payload
-   return coapSetPayload(&context->response, payload, payloadLen);
+   return coapSetPayload(&exchange->response, payload, payloadLen);
 }
 
 
 /**
  * @brief Write payload data
- * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Pointer to the request/response exchange
  * @param[in] data Pointer to a buffer containing the data to be written
  * @param[in] length Number of bytes to written
  * @return Error code
  **/
 
-error_t coapServerWritePayload(CoapServerContext *context, const void *data,
+error_t coapServerWritePayload(CoapServerExchange *exchange, const void *data,
    size_t length)
 {
    //Check parameters
-   if(context == NULL || data == NULL)
+   if(exchange == NULL || data == NULL)
       return ERROR_INVALID_PARAMETER;
 
+   //Options cannot be appended after the payload
+   exchange->responseWriter.length = 0;
+
    //Write payload data
-   return coapWritePayload(&context->response, data, length);
+   return coapWritePayload(&exchange->response, data, length);
 }
 
 #endif
@@ -41,53 +41,53 @@
 extern "C" {
 #endif
 
-error_t coapServerGetMethodCode(CoapServerContext *context, CoapCode *code);
+error_t coapServerGetMethodCode(CoapServerExchange *exchange, CoapCode *code);
 
-error_t coapServerGetUriPath(CoapServerContext *context, char_t *path,
+error_t coapServerGetUriPath(CoapServerExchange *exchange, char_t *path,
    size_t maxLen);
 
-error_t coapServerGetUriQuery(CoapServerContext *context, char_t *queryString,
+error_t coapServerGetUriQuery(CoapServerExchange *exchange, char_t *queryString,
    size_t maxLen);
 
-error_t coapServerGetOpaqueOption(CoapServerContext *context, uint16_t optionNum,
+error_t coapServerGetOpaqueOption(CoapServerExchange *exchange, uint16_t optionNum,
    uint_t optionIndex, const uint8_t **optionValue, size_t *optionLen);
 
-error_t coapServerGetStringOption(CoapServerContext *context, uint16_t optionNum,
+error_t coapServerGetStringOption(CoapServerExchange *exchange, uint16_t optionNum,
    uint_t optionIndex, const char_t **optionValue, size_t *optionLen);
 
-error_t coapServerGetUintOption(CoapServerContext *context, uint16_t optionNum,
+error_t coapServerGetUintOption(CoapServerExchange *exchange, uint16_t optionNum,
    uint_t optionIndex, uint32_t *optionValue);
 
-error_t coapServerGetPayload(CoapServerContext *context, const uint8_t **payload,
+error_t coapServerGetPayload(CoapServerExchange *exchange, const uint8_t **payload,
    size_t *payloadLen);
 
-error_t coapServerReadPayload(CoapServerContext *context, void *data, size_t size,
+error_t coapServerReadPayload(CoapServerExchange *exchange, void *data, size_t size,
    size_t *length);
 
-error_t coapServerSetResponseCode(CoapServerContext *context, CoapCode code);
+error_t coapServerSetResponseCode(CoapServerExchange *exchange, CoapCode code);
 
-error_t coapServerSetLocationPath(CoapServerContext *context,
+error_t coapServerSetLocationPath(CoapServerExchange *exchange,
    const char_t *path);
 
-error_t coapServerSetLocationQuery(CoapServerContext *context,
+error_t coapServerSetLocationQuery(CoapServerExchange *exchange,
    const char_t *queryString);
 
-error_t coapServerSetOpaqueOption(CoapServerContext *context, uint16_t optionNum,
+error_t coapServerSetOpaqueOption(CoapServerExchange *exchange, uint16_t optionNum,
    uint_t optionIndex, const uint8_t *optionValue, size_t optionLen);
 
-error_t coapServerSetStringOption(CoapServerContext *context, uint16_t optionNum,
+error_t coapServerSetStringOption(CoapServerExchange *exchange, uint16_t optionNum,
    uint_t optionIndex, const char_t *optionValue);
 
-error_t coapServerSetUintOption(CoapServerContext *context, uint16_t optionNum,
+error_t coapServerSetUintOption(CoapServerExchange *exchange, uint16_t optionNum,
    uint_t optionIndex, uint32_t optionValue);
 
-error_t coapServerDeleteOption(CoapServerContext *context, uint16_t optionNum,
+error_t coapServerDeleteOption(CoapServerExchange *exchange, uint16_t optionNum,
    uint_t optionIndex);
 
-error_t coapServerSetPayload(CoapServerContext *context, const void *payload,
+error_t coapServerSetPayload(CoapServerExchange *exchange, const void *payload,
    size_t payloadLen);
 
-error_t coapServerWritePayload(CoapServerContext *context, const void *data,
+error_t coapServerWritePayload(CoapServerExchange *exchange, const void *data,
    size_t length);
 
 //C++ guard
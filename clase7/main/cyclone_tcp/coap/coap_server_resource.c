@@ -0,0 +1,612 @@
+/**
+ * @file coap_server_resource.c
+ * @brief CoAP server resource registry
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL COAP_TRACE_LEVEL
+
+//Dependencies
+#include "coap/coap_server.h"
+#include "coap/coap_server_request.h"
+#include "coap/coap_server_resource.h"
+#include "coap/coap_server_observe.h"
+#include "coap/coap_server_block.h"
+#include "debug.h"
+
+//Check TCP/IP stack configuration
+#if (COAP_SERVER_SUPPORT == ENABLED)
+
+//Path of the resource discovery document (refer to RFC 6690, section 4)
+#define COAP_SERVER_WELL_KNOWN_CORE "/.well-known/core"
+
+
+/**
+ * @brief Register a resource
+ *
+ * The path is looked up in a hash table, so that the cost of dispatching a
+ * request does not depend on the number of registered resources. Resources
+ * must be registered before the CoAP server is started
+ *
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] resource Resource definition
+ * @return Error code
+ **/
+
+error_t coapServerRegisterResource(CoapServerContext *context,
+   const CoapServerResource *resource)
+{
+   uint_t i;
+   uint_t n;
+   uint16_t index;
+
+   //Check parameters
+   if(context == NULL || resource == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Resource paths are absolute
+   if(resource->path == NULL || resource->path[0] != '/')
+      return ERROR_INVALID_PATH;
+
+   //Make sure the definition is consistent
+   if(resource->callback == NULL ||
+      (resource->methods & COAP_SERVER_METHOD_ANY) == 0 ||
+      resource->numContentFormats > COAP_SERVER_MAX_CONTENT_FORMATS)
+   {
+      return ERROR_INVALID_PARAMETER;
+   }
+
+   //The registry is read by the CoAP server task without any locking
+   if(context->running)
+      return ERROR_WRONG_STATE;
+
+   //Make sure there is room for the new resource
+   if(context->numResources >= COAP_SERVER_MAX_RESOURCES)
+      return ERROR_OUT_OF_RESOURCES;
+
+   //Start probing at the slot designated by the hash of the path
+   i = coapServerHashPath(resource->path) & (COAP_SERVER_RESOURCE_HASH_SIZE - 1);
+
+   //Linear probing (the table always has at least one free slot)
+   for(n = 0; n < COAP_SERVER_RESOURCE_HASH_SIZE; n++)
+   {
+      //Retrieve the resource stored in the current slot
+      index = context->resourceTable[i];
+
+      //Free slot?
+      if(index == 0)
+         break;
+
+      //A path can only be registered once
+      if(osStrcasecmp(context->resources[index - 1]->path, resource->path) == 0)
+         return ERROR_ALREADY_CONFIGURED;
+
+      //Next slot
+      i = (i + 1) & (COAP_SERVER_RESOURCE_HASH_SIZE - 1);
+   }
+
+   //Hash table full?
+   if(n >= COAP_SERVER_RESOURCE_HASH_SIZE)
+      return ERROR_OUT_OF_RESOURCES;
+
+   //Save the definition
+   context->resources[context->numResources] = resource;
+   //Link the slot to the definition
+   context->resourceTable[i] = (uint16_t) (context->numResources + 1);
+   context->numResources++;
+
+   //The /.well-known/core document must be rebuilt
+   context->linkFormatValid = FALSE;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Register a table of resources
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] resources Array of resource definitions
+ * @param[in] count Number of entries in the array
+ * @return Error code
+ **/
+
+error_t coapServerRegisterResources(CoapServerContext *context,
+   const CoapServerResource *resources, uint_t count)
+{
+   error_t error;
+   uint_t i;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Register each resource in turn
+   for(i = 0; i < count && !error; i++)
+   {
+      error = coapServerRegisterResource(context, &resources[i]);
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Look up the resource registered for a given path
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] path NULL-terminated resource path
+ * @return Resource definition, or NULL if no resource matches the path
+ **/
+
+const CoapServerResource *coapServerFindResource(CoapServerContext *context,
+   const char_t *path)
+{
+   int_t index;
+
+   //Look up the path in the hash table
+   index = coapServerGetResourceIndex(context, path);
+
+   //Return the matching definition, if any
+   return (index >= 0) ? context->resources[index] : NULL;
+}
+
+
+/**
+ * @brief Get the registration index of the resource matching a given path
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] path NULL-terminated resource path
+ * @return Index of the resource, or -1 if no resource matches the path
+ **/
+
+int_t coapServerGetResourceIndex(CoapServerContext *context,
+   const char_t *path)
+{
+   uint_t i;
+   uint_t n;
+   uint16_t index;
+
+   //Empty registry?
+   if(context->numResources == 0)
+      return -1;
+
+   //Start probing at the slot designated by the hash of the path
+   i = coapServerHashPath(path) & (COAP_SERVER_RESOURCE_HASH_SIZE - 1);
+
+   //Follow the probe sequence until a free slot is reached
+   for(n = 0; n < COAP_SERVER_RESOURCE_HASH_SIZE; n++)
+   {
+      //Retrieve the resource stored in the current slot
+      index = context->resourceTable[i];
+
+      //Free slot?
+      if(index == 0)
+         break;
+
+      //Matching path?
+      if(osStrcasecmp(context->resources[index - 1]->path, path) == 0)
+         return index - 1;
+
+      //Next slot
+      i = (i + 1) & (COAP_SERVER_RESOURCE_HASH_SIZE - 1);
+   }
+
+   //No matching resource
+   return -1;
+}
+
+
+/**
+ * @brief Dispatch a request to the registered resources
+ *
+ * A 4.05 response is generated when the resource exists but does not accept
+ * the method, and a 4.06 response when the client requests a content format
+ * the resource cannot produce. /.well-known/core is served from the registry
+ * unless a resource has been registered with that path
+ *
+ * @param[in] exchange Pointer to the request/response exchange
+ * @param[in] method Method code
+ * @param[in] uri NULL-terminated resource path
+ * @return Error code (ERROR_NOT_FOUND if no resource matches the path)
+ **/
+
+error_t coapServerDispatchResource(CoapServerExchange *exchange,
+   CoapCode method, const char_t *uri)
+{
+   error_t error;
+   uint_t i;
+   int_t index;
+   uint32_t accept;
+   bool_t acceptable;
+   CoapServerContext *context;
+   const CoapServerResource *resource;
+
+   //Point to the CoAP server context
+   context = exchange->context;
+
+   //Look up the requested resource
+   index = coapServerGetResourceIndex(context, uri);
+
+   //Any matching resource?
+   if(index >= 0)
+   {
+      //Point to the resource definition
+      resource = context->resources[index];
+
+      //Check whether the resource accepts the method
+      if((resource->methods & coapServerGetMethodFlag(method)) == 0)
+      {
+         //Generate a 4.05 piggybacked response
+         error = coapServerSetResponseCode(exchange,
+            COAP_CODE_METHOD_NOT_ALLOWED);
+      }
+      else
+      {
+         //Any Accept option in the request?
+         error = coapServerGetUintOption(exchange, COAP_OPT_ACCEPT, 0, &accept);
+
+         //Check whether the resource can produce the preferred format
+         if(!error && resource->numContentFormats > 0)
+         {
+            //Loop through the formats produced by the resource
+            for(acceptable = FALSE, i = 0; i < resource->numContentFormats; i++)
+            {
+               //Matching format?
+               if(resource->contentFormats[i] == accept)
+                  acceptable = TRUE;
+            }
+         }
+         else
+         {
+            //Any format is acceptable
+            acceptable = TRUE;
+         }
+
+         //Acceptable format?
+         if(acceptable)
+         {
+            //Invoke the resource handler
+            error = resource->callback(exchange, resource, method);
+
+#if (COAP_SERVER_OBSERVE_SUPPORT == ENABLED)
+            //Observe registration or deregistration (refer to RFC 7641,
+            //section 4.1)
+            if(!error && method == COAP_CODE_GET && resource->observable)
+            {
+               error = coapServerProcessObserve(exchange, index);
+            }
+#endif
+         }
+         else
+         {
+            //The preferred format cannot be returned (refer to RFC 7252,
+            //section 5.10.4)
+            error = coapServerSetResponseCode(exchange,
+               COAP_CODE_NOT_ACCEPTABLE);
+         }
+      }
+   }
+   else if(context->numResources > 0 &&
+      osStrcasecmp(uri, COAP_SERVER_WELL_KNOWN_CORE) == 0)
+   {
+      //The discovery document is read-only
+      if(method == COAP_CODE_GET)
+      {
+         //Send the link-format description of the registered resources
+         error = coapServerSendLinkFormat(exchange);
+      }
+      else
+      {
+         //Generate a 4.05 piggybacked response
+         error = coapServerSetResponseCode(exchange,
+            COAP_CODE_METHOD_NOT_ALLOWED);
+      }
+   }
+   else
+   {
+      //No registered resource matches the path
+      error = ERROR_NOT_FOUND;
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Send the /.well-known/core document
+ * @param[in] exchange Pointer to the request/response exchange
+ * @return Error code
+ **/
+
+error_t coapServerSendLinkFormat(CoapServerExchange *exchange)
+{
+   error_t error;
+   uint32_t accept;
+   CoapServerContext *context;
+
+   //Point to the CoAP server context
+   context = exchange->context;
+
+   //The document is only available in link format
+   error = coapServerGetUintOption(exchange, COAP_OPT_ACCEPT, 0, &accept);
+
+   //Any other format requested?
+   if(!error && accept != COAP_CONTENT_FORMAT_APP_LINK_FORMAT)
+   {
+      //Generate a 4.06 piggybacked response
+      return coapServerSetResponseCode(exchange, COAP_CODE_NOT_ACCEPTABLE);
+   }
+
+   //Requests may be processed by several worker tasks at the same time
+   osAcquireMutex(&context->mutex);
+
+   //The document is built once, then reused until the registry changes
+   if(!context->linkFormatValid)
+   {
+      error = coapServerFormatLinkFormat(context);
+   }
+   else
+   {
+      error = NO_ERROR;
+   }
+
+   //Release exclusive access to the document
+   osReleaseMutex(&context->mutex);
+
+   //Failed to build the document?
+   if(error)
+   {
+      //Debug message
+      TRACE_WARNING("CoAP Server: /.well-known/core document too large!\r\n");
+
+      //Report an internal error to the client
+      return coapServerSetResponseCode(exchange, COAP_CODE_INTERNAL_SERVER);
+   }
+
+   //Format the response
+   error = coapServerSetResponseCode(exchange, COAP_CODE_CONTENT);
+
+   //Check status code
+   if(!error)
+   {
+      //Set Content-Format option
+      error = coapServerSetUintOption(exchange, COAP_OPT_CONTENT_FORMAT, 0,
+         COAP_CONTENT_FORMAT_APP_LINK_FORMAT);
+   }
+
+   //Check status code
+   if(!error)
+   {
+#if (COAP_SERVER_BLOCK_SUPPORT == ENABLED)
+      //Large documents are sent block-wise
+      error = coapServerSetBody(exchange, context->linkFormat,
+         context->linkFormatLen);
+#else
+      //Set payload
+      error = coapServerSetPayload(exchange, context->linkFormat,
+         context->linkFormatLen);
+#endif
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Build the /.well-known/core document from the registry
+ *
+ * Each resource is described by its path followed by the rt, if, title, obs
+ * and ct attributes (refer to RFC 6690 and RFC 7252, section 7.2)
+ *
+ * @param[in] context Pointer to the CoAP server context
+ * @return Error code
+ **/
+
+error_t coapServerFormatLinkFormat(CoapServerContext *context)
+{
+   error_t error;
+   uint_t i;
+   uint_t j;
+   size_t n;
+   char_t *p;
+   size_t size;
+   char_t temp[8];
+   const CoapServerResource *resource;
+
+   //Initialize variables
+   error = NO_ERROR;
+   p = context->linkFormat;
+   size = COAP_SERVER_LINK_FORMAT_SIZE;
+   n = 0;
+
+   //Resources are listed in registration order
+   for(i = 0; i < context->numResources && !error; i++)
+   {
+      //Point to the current resource
+      resource = context->resources[i];
+
+      //Links are separated by commas
+      if(i > 0)
+         error = coapServerAppendLinkFormat(p, size, &n, ",");
+
+      //Target URI
+      if(!error)
+         error = coapServerAppendLinkFormat(p, size, &n, "<");
+      if(!error)
+         error = coapServerAppendLinkFormat(p, size, &n, resource->path);
+      if(!error)
+         error = coapServerAppendLinkFormat(p, size, &n, ">");
+
+      //Resource type attribute
+      if(!error && resource->rt != NULL)
+      {
+         error = coapServerAppendLinkFormat(p, size, &n, ";rt=\"");
+         if(!error)
+            error = coapServerAppendLinkFormat(p, size, &n, resource->rt);
+         if(!error)
+            error = coapServerAppendLinkFormat(p, size, &n, "\"");
+      }
+
+      //Interface description attribute
+      if(!error && resource->iface != NULL)
+      {
+         error = coapServerAppendLinkFormat(p, size, &n, ";if=\"");
+         if(!error)
+            error = coapServerAppendLinkFormat(p, size, &n, resource->iface);
+         if(!error)
+            error = coapServerAppendLinkFormat(p, size, &n, "\"");
+      }
+
+      //Title attribute
+      if(!error && resource->title != NULL)
+      {
+         error = coapServerAppendLinkFormat(p, size, &n, ";title=\"");
+         if(!error)
+            error = coapServerAppendLinkFormat(p, size, &n, resource->title);
+         if(!error)
+            error = coapServerAppendLinkFormat(p, size, &n, "\"");
+      }
+
+      //Observable resources are flagged with the obs attribute (refer to
+      //RFC 7641, section 6)
+      if(!error && resource->observable)
+         error = coapServerAppendLinkFormat(p, size, &n, ";obs");
+
+      //Content-Format code attribute. Several formats are given as a quoted,
+      //space-separated list (refer to RFC 7252, section 7.2.1)
+      if(!error && resource->numContentFormats > 0)
+      {
+         error = coapServerAppendLinkFormat(p, size, &n,
+            (resource->numContentFormats > 1) ? ";ct=\"" : ";ct=");
+
+         //Loop through the content formats
+         for(j = 0; j < resource->numContentFormats && !error; j++)
+         {
+            //Format the current code
+            osSprintf(temp, (j > 0) ? " %u" : "%u",
+               resource->contentFormats[j]);
+
+            //Append it to the document
+            error = coapServerAppendLinkFormat(p, size, &n, temp);
+         }
+
+         //Close the list
+         if(!error && resource->numContentFormats > 1)
+            error = coapServerAppendLinkFormat(p, size, &n, "\"");
+      }
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Save the length of the document
+      context->linkFormatLen = n;
+      context->linkFormatValid = TRUE;
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Append a string to the /.well-known/core document
+ * @param[in] buffer Output buffer
+ * @param[in] size Size of the output buffer
+ * @param[in,out] length Number of bytes already written
+ * @param[in] s NULL-terminated string to append
+ * @return Error code
+ **/
+
+error_t coapServerAppendLinkFormat(char_t *buffer, size_t size, size_t *length,
+   const char_t *s)
+{
+   size_t n;
+
+   //Get the length of the string
+   n = osStrlen(s);
+
+   //Make sure the output buffer is large enough
+   if((*length + n) > size)
+      return ERROR_BUFFER_OVERFLOW;
+
+   //Copy the string
+   osMemcpy(buffer + *length, s, n);
+   *length += n;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Convert a method code to the corresponding CoapServerMethod flag
+ * @param[in] method Method code
+ * @return Method flag (COAP_SERVER_METHOD_NONE for non-request codes)
+ **/
+
+uint_t coapServerGetMethodFlag(CoapCode method)
+{
+   //Request codes 0.01 to 0.07 map to consecutive flags
+   if(method >= COAP_CODE_GET && method <= COAP_CODE_IPATCH)
+      return 1U << (method - COAP_CODE_GET);
+   else
+      return COAP_SERVER_METHOD_NONE;
+}
+
+
+/**
+ * @brief Hash a resource path
+ *
+ * FNV-1a over the lowercased path, consistent with the case-insensitive
+ * comparison of resource paths
+ *
+ * @param[in] path NULL-terminated resource path
+ * @return Hash value
+ **/
+
+uint32_t coapServerHashPath(const char_t *path)
+{
+   uint32_t h;
+
+   //FNV offset basis
+   h = 2166136261UL;
+
+   //Process the path
+   while(*path != '\0')
+   {
+      h ^= (uint8_t) osTolower(*path++);
+      h *= 16777619UL;
+   }
+
+   //Return the hash value
+   return h;
+}
+
+#endif
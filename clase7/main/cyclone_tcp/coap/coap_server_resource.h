@@ -0,0 +1,73 @@
+/**
+ * @file coap_server_resource.h
+ * @brief CoAP server resource registry
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+#ifndef _COAP_SERVER_RESOURCE_H
+#define _COAP_SERVER_RESOURCE_H
+
+//Dependencies
+#include "core/net.h"
+#include "coap/coap_server.h"
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//CoAP server related functions
+error_t coapServerRegisterResource(CoapServerContext *context,
+   const CoapServerResource *resource);
+
+error_t coapServerRegisterResources(CoapServerContext *context,
+   const CoapServerResource *resources, uint_t count);
+
+const CoapServerResource *coapServerFindResource(CoapServerContext *context,
+   const char_t *path);
+
+int_t coapServerGetResourceIndex(CoapServerContext *context,
+   const char_t *path);
+
+error_t coapServerDispatchResource(CoapServerExchange *exchange,
+   CoapCode method, const char_t *uri);
+
+error_t coapServerSendLinkFormat(CoapServerExchange *exchange);
+error_t coapServerFormatLinkFormat(CoapServerContext *context);
+
+error_t coapServerAppendLinkFormat(char_t *buffer, size_t size, size_t *length,
+   const char_t *s);
+
+uint_t coapServerGetMethodFlag(CoapCode method);
+uint32_t coapServerHashPath(const char_t *path);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,984 @@
+/**
+ * @file coap_server_tcp.c
+ * @brief CoAP over TCP (server side)
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL COAP_TRACE_LEVEL
+
+//Dependencies
+#include "coap/coap_server.h"
+#include "coap/coap_server_misc.h"
+#include "coap/coap_server_observe.h"
+#include "coap/coap_server_tcp.h"
+#include "debug.h"
+
+//Check TCP/IP stack configuration
+#if (COAP_SERVER_SUPPORT == ENABLED && COAP_SERVER_TCP_SUPPORT == ENABLED)
+
+
+/**
+ * @brief Open the listening TCP socket
+ * @param[in] context Pointer to the CoAP server context
+ * @return Error code
+ **/
+
+error_t coapServerOpenTcpSocket(CoapServerContext *context)
+{
+   error_t error;
+
+   //Open a TCP socket
+   context->tcpSocket = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+   //Failed to open socket?
+   if(context->tcpSocket == NULL)
+      return ERROR_OPEN_FAILED;
+
+   //Force the socket to operate in non-blocking mode
+   error = socketSetTimeout(context->tcpSocket, 0);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Associate the socket with the relevant interface
+   error = socketBindToInterface(context->tcpSocket,
+      context->settings.interface);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //The CoAP server listens for connections on port 5683
+   error = socketBind(context->tcpSocket, &IP_ADDR_ANY,
+      context->settings.tcpPort);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Place the socket in listening state
+   error = socketListen(context->tcpSocket, 0);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Close the listening TCP socket and all the TCP connections
+ * @param[in] context Pointer to the CoAP server context
+ **/
+
+void coapServerCloseTcpSockets(CoapServerContext *context)
+{
+   uint_t i;
+
+   //Loop through the TCP connections
+   for(i = 0; i < COAP_SERVER_MAX_CONNECTIONS; i++)
+   {
+      //Active connection?
+      if(context->connections[i].socket != NULL)
+      {
+         //Close the connection
+         coapServerCloseConnection(context, &context->connections[i]);
+      }
+   }
+
+   //Close the listening socket
+   socketClose(context->tcpSocket);
+   context->tcpSocket = NULL;
+}
+
+
+/**
+ * @brief Accept an incoming TCP connection
+ *
+ * The server announces the largest message it accepts in a CSM message,
+ * which must be the first message sent on the connection (refer to RFC 8323,
+ * section 5.3)
+ *
+ * @param[in] context Pointer to the CoAP server context
+ **/
+
+void coapServerAcceptConnection(CoapServerContext *context)
+{
+   error_t error;
+   uint_t i;
+   uint16_t clientPort;
+   IpAddr clientIpAddr;
+   Socket *socket;
+   CoapServerConnection *connection;
+
+   //Accept an incoming connection
+   socket = socketAccept(context->tcpSocket, &clientIpAddr, &clientPort);
+   //Failure detected?
+   if(socket == NULL)
+      return;
+
+   //Debug message
+   TRACE_INFO("CoAP Server: TCP connection with client %s port %" PRIu16 "...\r\n",
+      ipAddrToString(&clientIpAddr, NULL), clientPort);
+
+   //No free entry found so far
+   connection = NULL;
+
+   //Loop through the TCP connections
+   for(i = 0; i < COAP_SERVER_MAX_CONNECTIONS; i++)
+   {
+      //Free entry?
+      if(context->connections[i].socket == NULL)
+      {
+         connection = &context->connections[i];
+         break;
+      }
+   }
+
+   //No room for another connection?
+   if(connection == NULL)
+   {
+      //Debug message
+      TRACE_WARNING("CoAP Server: Too many TCP connections!\r\n");
+
+      //Reject the connection
+      socketClose(socket);
+      return;
+   }
+
+   //Force the socket to operate in non-blocking mode. Messages that do not
+   //fit in the send buffer are queued by the connection
+   error = socketSetTimeout(socket, 0);
+
+   //Check status code
+   if(!error)
+   {
+      //The worker tasks check the connection before sending a message
+      osAcquireMutex(&context->tcpMutex);
+
+      //Initialize the connection
+      osMemset(connection, 0, sizeof(CoapServerConnection));
+      connection->socket = socket;
+      connection->id = ++context->connectionId;
+      connection->clientIpAddr = clientIpAddr;
+      connection->clientPort = clientPort;
+      connection->peerMaxMsgSize = COAP_TCP_DEFAULT_MAX_MSG_SIZE;
+      connection->timestamp = osGetSystemTime();
+
+      //Save the local address of the connection
+      socketGetLocalAddr(socket, &connection->serverIpAddr, NULL);
+
+      //Release exclusive access
+      osReleaseMutex(&context->tcpMutex);
+
+      //Send a CSM message
+      error = coapServerSendSignal(context, connection, COAP_CODE_CSM, NULL);
+
+      //Any error to report?
+      if(error)
+      {
+         //Close the connection
+         coapServerCloseConnection(context, connection);
+      }
+   }
+   else
+   {
+      //Reject the connection
+      socketClose(socket);
+   }
+}
+
+
+/**
+ * @brief Close a TCP connection
+ *
+ * Observations registered over the connection end with it (refer to
+ * RFC 8323, section 7)
+ *
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] connection Pointer to the TCP connection
+ **/
+
+void coapServerCloseConnection(CoapServerContext *context,
+   CoapServerConnection *connection)
+{
+#if (COAP_SERVER_OBSERVE_SUPPORT == ENABLED)
+   uint_t i;
+   uint_t id;
+   CoapServerObserver *observer;
+
+   //Save the identifier of the connection
+   id = connection->id;
+#endif
+
+   //Debug message
+   TRACE_INFO("CoAP Server: Closing TCP connection...\r\n");
+
+   //A message being sent by a worker task is completed first
+   osAcquireMutex(&context->tcpMutex);
+
+   //Close the socket
+   socketClose(connection->socket);
+
+   //Release the entry
+   connection->socket = NULL;
+   connection->bufferLen = 0;
+   connection->txBufferLen = 0;
+   connection->aborting = FALSE;
+
+   //Release exclusive access
+   osReleaseMutex(&context->tcpMutex);
+
+#if (COAP_SERVER_OBSERVE_SUPPORT == ENABLED)
+   //The observer table is shared with the worker tasks
+   osAcquireMutex(&context->mutex);
+
+   //Loop through the observer table
+   for(i = 0; i < COAP_SERVER_MAX_OBSERVERS; i++)
+   {
+      //Point to the current entry
+      observer = &context->observers[i];
+
+      //Observer registered over this connection?
+      if(observer->resource != 0 && observer->connection == connection &&
+         observer->connectionId == id)
+      {
+         //Remove the observer
+         coapServerDeleteObserver(context, observer);
+      }
+   }
+
+   //Release exclusive access to the observer table
+   osReleaseMutex(&context->mutex);
+#endif
+}
+
+
+/**
+ * @brief Abort a TCP connection
+ *
+ * An Abort message carrying a diagnostic payload is sent to the client, and
+ * the connection is closed once the message has been transmitted (refer to
+ * RFC 8323, section 5.6). Incoming data is discarded in the meantime
+ *
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] connection Pointer to the TCP connection
+ * @param[in] diagnostic Diagnostic message (optional parameter)
+ **/
+
+void coapServerAbortConnection(CoapServerContext *context,
+   CoapServerConnection *connection, const char_t *diagnostic)
+{
+   error_t error;
+
+   //Debug message
+   TRACE_WARNING("CoAP Server: Aborting TCP connection (%s)...\r\n",
+      (diagnostic != NULL) ? diagnostic : "");
+
+   //Send an Abort message
+   error = coapServerSendSignal(context, connection, COAP_CODE_ABORT,
+      diagnostic);
+
+   //Check status code
+   if(!error)
+   {
+      //No other message can be sent on the connection
+      osAcquireMutex(&context->tcpMutex);
+      connection->aborting = TRUE;
+      connection->bufferLen = 0;
+      osReleaseMutex(&context->tcpMutex);
+   }
+   else
+   {
+      //The Abort message cannot be sent
+      coapServerCloseConnection(context, connection);
+   }
+}
+
+
+/**
+ * @brief Receive data on a TCP connection
+ *
+ * Data is accumulated in the receive buffer of the connection, and each
+ * complete message is processed in turn
+ *
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] connection Pointer to the TCP connection
+ **/
+
+void coapServerReceiveTcpData(CoapServerContext *context,
+   CoapServerConnection *connection)
+{
+   error_t error;
+   size_t n;
+   size_t length;
+
+   //Read as much data as the receive buffer can hold
+   error = socketReceive(connection->socket, connection->buffer +
+      connection->bufferLen, COAP_MAX_MSG_SIZE - connection->bufferLen, &n,
+      SOCKET_FLAG_DONT_WAIT);
+
+   //The connection is being aborted?
+   if(!error && connection->aborting)
+   {
+      //Incoming data is discarded
+      connection->bufferLen = 0;
+      return;
+   }
+
+   //No data available?
+   if(error == ERROR_WOULD_BLOCK || error == ERROR_TIMEOUT)
+      return;
+
+   //The connection has been closed or reset by the client?
+   if(error)
+   {
+      coapServerCloseConnection(context, connection);
+      return;
+   }
+
+   //Update the length of the receive buffer
+   connection->bufferLen += n;
+   //Save the time of the last activity
+   connection->timestamp = osGetSystemTime();
+
+   //Process the complete messages
+   while(connection->socket != NULL && connection->bufferLen > 0)
+   {
+      //Retrieve the length of the next message
+      error = coapParseTcpMessageHeader(connection->buffer,
+         connection->bufferLen, &n, &length);
+
+      //Incomplete header?
+      if(error == ERROR_BUFFER_UNDERFLOW)
+         break;
+
+      //Malformed or oversized message?
+      if(error || length > COAP_SERVER_TCP_MAX_MSG_SIZE)
+      {
+         //Debug message
+         TRACE_WARNING("CoAP Server: Invalid message received over TCP!\r\n");
+
+         //The connection cannot be used anymore, since the boundary of the
+         //next message is unknown (refer to RFC 8323, section 5.6)
+         coapServerAbortConnection(context, connection, error ?
+            "Malformed message header" : "Message too large");
+         break;
+      }
+
+      //Incomplete message?
+      if(length > connection->bufferLen)
+         break;
+
+      //Convert the message to the datagram format
+      error = coapDecodeTcpMessage(connection->buffer, length,
+         context->exchange.request.buffer, COAP_MAX_MSG_SIZE,
+         &context->exchange.request.length);
+
+      //Discard the message from the receive buffer
+      connection->bufferLen -= length;
+      osMemmove(connection->buffer, connection->buffer + length,
+         connection->bufferLen);
+
+      //Malformed message?
+      if(error)
+      {
+         //Debug message
+         TRACE_WARNING("CoAP Server: Malformed message received over TCP!\r\n");
+
+         //The message cannot be processed nor rejected with a response, so
+         //the connection is aborted (refer to RFC 8323, section 5.6)
+         coapServerAbortConnection(context, connection, "Malformed message");
+         break;
+      }
+
+      //Process the message
+      coapServerProcessTcpMessage(context, connection);
+   }
+}
+
+
+/**
+ * @brief Process a message received over TCP
+ *
+ * The message has been converted to the datagram format in the request
+ * message of the CoAP server task. Requests are then processed exactly like
+ * requests received over UDP
+ *
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] connection Pointer to the TCP connection
+ * @return Error code
+ **/
+
+error_t coapServerProcessTcpMessage(CoapServerContext *context,
+   CoapServerConnection *connection)
+{
+   error_t error;
+   CoapCode code;
+   CoapServerExchange *exchange;
+
+   //Point to the exchange of the CoAP server task
+   exchange = &context->exchange;
+
+   //Retrieve message code
+   coapGetCode(&exchange->request, &code);
+
+   //Check message code
+   if(COAP_GET_CODE_CLASS(code) == COAP_CODE_CLASS_SIGNALING)
+   {
+      //Process signaling message
+      error = coapServerProcessSignal(context, connection);
+   }
+   else if(code == COAP_CODE_EMPTY)
+   {
+      //Empty messages can be used as keepalives and must be silently
+      //ignored (refer to RFC 8323, section 3.4)
+      error = NO_ERROR;
+   }
+   else
+   {
+      //Save the endpoints of the connection
+      context->serverIpAddr = connection->serverIpAddr;
+      context->clientIpAddr = connection->clientIpAddr;
+      context->clientPort = connection->clientPort;
+      context->connection = connection;
+
+      //The message has been converted in place, so that it does not need
+      //to be copied again
+      error = coapServerProcessRequest(context, exchange->request.buffer,
+         exchange->request.length);
+
+      //Subsequent datagrams are not bound to any connection
+      context->connection = NULL;
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Process a signaling message
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] connection Pointer to the TCP connection
+ * @return Error code
+ **/
+
+error_t coapServerProcessSignal(CoapServerContext *context,
+   CoapServerConnection *connection)
+{
+   error_t error;
+   uint32_t value;
+   CoapCode code;
+   const CoapMessage *message;
+
+   //Point to the signaling message
+   message = &context->exchange.request;
+
+   //Debug message
+   TRACE_DEBUG("CoAP Server: Signaling message received (%" PRIuSIZE " bytes)...\r\n",
+      message->length);
+
+   //Check the options of the message
+   error = coapParseMessage(message);
+
+   //Malformed message?
+   if(error)
+   {
+      //Abort the connection
+      coapServerAbortConnection(context, connection,
+         "Malformed signaling message");
+      return error;
+   }
+
+   //Retrieve message code
+   coapGetCode(message, &code);
+
+   //Check message code
+   if(code == COAP_CODE_CSM)
+   {
+      //The Max-Message-Size option indicates the largest message the client
+      //can receive (refer to RFC 8323, section 5.3.1)
+      error = coapGetUintOption(message, COAP_SIGNAL_OPT_MAX_MESSAGE_SIZE, 0,
+         &value);
+
+      //Option found?
+      if(!error)
+      {
+         connection->peerMaxMsgSize = value;
+      }
+
+      //Other capabilities are not used by the server
+      error = NO_ERROR;
+   }
+   else if(code == COAP_CODE_PING)
+   {
+      //A Ping message is answered with a Pong message (refer to RFC 8323,
+      //section 5.4)
+      error = coapServerSendSignal(context, connection, COAP_CODE_PONG, NULL);
+   }
+   else if(code == COAP_CODE_RELEASE || code == COAP_CODE_ABORT)
+   {
+      //The client does not want to use the connection anymore (refer to
+      //RFC 8323, sections 5.5 and 5.6)
+      coapServerCloseConnection(context, connection);
+   }
+   else
+   {
+      //Pong messages, as well as signaling messages with an unknown code,
+      //are silently ignored
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Send a signaling message
+ *
+ * The message is formatted in the response message of the CoAP server task.
+ * A Pong message echoes the token of the Ping message it answers, and an
+ * Abort message may carry a diagnostic payload
+ *
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] connection Pointer to the TCP connection
+ * @param[in] code Signaling code
+ * @param[in] diagnostic Diagnostic payload (optional parameter)
+ * @return Error code
+ **/
+
+error_t coapServerSendSignal(CoapServerContext *context,
+   CoapServerConnection *connection, CoapCode code, const char_t *diagnostic)
+{
+   error_t error;
+   CoapMessage *message;
+   CoapMessageHeader *header;
+   const CoapMessageHeader *requestHeader;
+
+   //Point to the response message of the CoAP server task
+   message = &context->exchange.response;
+   //Point to the CoAP message header
+   header = (CoapMessageHeader *) message->buffer;
+
+   //Format message header
+   header->version = COAP_VERSION_1;
+   header->type = COAP_TYPE_NON;
+   header->tokenLen = 0;
+   header->code = code;
+   header->mid = 0;
+
+   //Pong message?
+   if(code == COAP_CODE_PONG)
+   {
+      //Point to the Ping message
+      requestHeader = (CoapMessageHeader *) context->exchange.request.buffer;
+
+      //Copy the token of the Ping message
+      header->tokenLen = requestHeader->tokenLen;
+      osMemcpy(header->token, requestHeader->token, requestHeader->tokenLen);
+   }
+
+   //Set the length of the CoAP message
+   message->length = sizeof(CoapMessageHeader) + header->tokenLen;
+   message->pos = 0;
+
+   //CSM message?
+   if(code == COAP_CODE_CSM)
+   {
+      //Announce the largest message the server can receive
+      error = coapSetUintOption(message, COAP_SIGNAL_OPT_MAX_MESSAGE_SIZE, 0,
+         COAP_SERVER_TCP_MAX_MSG_SIZE);
+   }
+   else
+   {
+      //Other signaling messages are sent without options
+      error = NO_ERROR;
+   }
+
+   //Any diagnostic payload?
+   if(!error && diagnostic != NULL)
+   {
+      //The payload is a human-readable diagnostic message (refer to RFC 8323,
+      //section 5.6)
+      error = coapSetPayload(message, diagnostic, osStrlen(diagnostic));
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Send the signaling message
+      error = coapServerSendTcpMessage(context, connection, connection->id,
+         message->buffer, message->length, NULL, 0);
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Send a response over TCP
+ *
+ * A body set by coapServerSetBody() is sent right after the response,
+ * without being copied to the response message
+ *
+ * @param[in] exchange Pointer to the request/response exchange
+ * @param[in] data Pointer to the CoAP message
+ * @param[in] length Length of the CoAP message, in bytes
+ * @return Error code
+ **/
+
+error_t coapServerSendTcpResponse(CoapServerExchange *exchange,
+   const void *data, size_t length)
+{
+   const uint8_t *body;
+   size_t bodyLen;
+
+   //The body only follows the response message of the exchange
+   if(data == exchange->response.buffer && exchange->body != NULL)
+   {
+      body = exchange->body;
+      bodyLen = exchange->bodyLen;
+   }
+   else
+   {
+      body = NULL;
+      bodyLen = 0;
+   }
+
+   //Send the message over the connection the request was received on
+   return coapServerSendTcpMessage(exchange->context, exchange->connection,
+      exchange->connectionId, data, length, body, bodyLen);
+}
+
+
+/**
+ * @brief Send a message over TCP
+ *
+ * The message is stored in the datagram format. Its header is replaced by
+ * the TCP header, and the body, if any, is appended after the options with a
+ * payload marker. The whole message is added to the transmit queue of the
+ * connection, which is then flushed without blocking. Messages sent by the
+ * CoAP server task and by the worker tasks are serialized, so that they are
+ * not interleaved
+ *
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] connection Pointer to the TCP connection
+ * @param[in] id Identifier of the connection
+ * @param[in] data Pointer to the CoAP message
+ * @param[in] length Length of the CoAP message, in bytes
+ * @param[in] body Body sent after the message (optional parameter)
+ * @param[in] bodyLen Length of the body, in bytes
+ * @return Error code
+ **/
+
+error_t coapServerSendTcpMessage(CoapServerContext *context,
+   CoapServerConnection *connection, uint_t id, const void *data,
+   size_t length, const uint8_t *body, size_t bodyLen)
+{
+   error_t error;
+   size_t n;
+   size_t extraLen;
+   size_t totalLen;
+   uint8_t *p;
+   bool_t pending;
+   uint8_t header[COAP_TCP_MAX_HEADER_SIZE];
+
+   //The body is preceded by a payload marker
+   extraLen = (bodyLen > 0) ? bodyLen + 1 : 0;
+
+   //Format the TCP header
+   error = coapFormatTcpMessageHeader(data, length, extraLen, header, &n);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Total length of the message over TCP
+   totalLen = n + length - sizeof(CoapMessageHeader) + extraLen;
+   //No data left in the transmit queue so far
+   pending = FALSE;
+
+   //Acquire exclusive access to the connections
+   osAcquireMutex(&context->tcpMutex);
+
+   //The connection may have been closed or aborted since the request was
+   //received
+   if(connection->socket != NULL && connection->id == id &&
+      !connection->closing && !connection->aborting)
+   {
+      //A message is queued as a whole or not at all, so that the stream
+      //never ends in the middle of a message
+      if(totalLen <= (COAP_SERVER_TCP_TX_BUFFER_SIZE - connection->txBufferLen))
+      {
+         //Debug message
+         TRACE_DEBUG("CoAP Server: Sending message over TCP (%" PRIuSIZE " bytes)...\r\n",
+            totalLen);
+
+         //Point to the end of the transmit queue
+         p = connection->txBuffer + connection->txBufferLen;
+
+         //Copy the TCP header
+         osMemcpy(p, header, n);
+         p += n;
+
+         //Copy the token, the options and the payload, if any
+         osMemcpy(p, (const uint8_t *) data + sizeof(CoapMessageHeader),
+            length - sizeof(CoapMessageHeader));
+         p += length - sizeof(CoapMessageHeader);
+
+         //Any body to send?
+         if(extraLen > 0)
+         {
+            //Copy the payload marker and the body
+            *(p++) = COAP_PAYLOAD_MARKER;
+            osMemcpy(p, body, bodyLen);
+         }
+
+         //Update the length of the transmit queue
+         connection->txBufferLen += totalLen;
+
+         //Send as much data as the socket accepts
+         error = coapServerFlushTcpData(connection);
+      }
+      else
+      {
+         //The client does not read its messages fast enough
+         error = ERROR_BUFFER_OVERFLOW;
+      }
+
+      //Check status code
+      if(!error)
+      {
+         //Save the time of the last activity
+         connection->timestamp = osGetSystemTime();
+         //The rest of the queue is sent when the socket becomes writable
+         pending = (connection->txBufferLen > 0);
+      }
+      else
+      {
+         //A message is missing from the stream. The CoAP server task closes
+         //the connection
+         connection->closing = TRUE;
+      }
+   }
+   else
+   {
+      //Report an error
+      error = ERROR_NOT_CONNECTED;
+   }
+
+   //Release exclusive access
+   osReleaseMutex(&context->tcpMutex);
+
+   //Any data left in the transmit queue?
+   if(pending)
+   {
+      //Wake up the CoAP server task, so that it polls the socket for
+      //writability
+      osSetEvent(&context->event);
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Send the contents of the transmit queue of a TCP connection
+ *
+ * As much data as the send buffer of the socket can hold is sent, and the
+ * rest is kept in the queue. The caller must hold the TCP mutex of the
+ * context
+ *
+ * @param[in] connection Pointer to the TCP connection
+ * @return Error code
+ **/
+
+error_t coapServerFlushTcpData(CoapServerConnection *connection)
+{
+   error_t error;
+   size_t n;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Any data pending in the transmit queue?
+   if(connection->txBufferLen > 0)
+   {
+      //No data has been sent yet
+      n = 0;
+
+      //Copy as much data as possible to the socket send buffer
+      error = socketSend(connection->socket, connection->txBuffer,
+         connection->txBufferLen, &n, SOCKET_FLAG_NO_DELAY);
+
+      //The send buffer is full?
+      if(error == ERROR_TIMEOUT || error == ERROR_WOULD_BLOCK)
+      {
+         error = NO_ERROR;
+      }
+
+      //Check status code
+      if(!error && n > 0)
+      {
+         //Remove the data that has been sent from the queue
+         connection->txBufferLen -= n;
+         osMemmove(connection->txBuffer, connection->txBuffer + n,
+            connection->txBufferLen);
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Resume transmission on a writable TCP connection
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] connection Pointer to the TCP connection
+ **/
+
+void coapServerSendTcpData(CoapServerContext *context,
+   CoapServerConnection *connection)
+{
+   error_t error;
+
+   //Acquire exclusive access to the connections
+   osAcquireMutex(&context->tcpMutex);
+
+   //Send the data pending in the transmit queue
+   error = coapServerFlushTcpData(connection);
+
+   //Any error to report?
+   if(error)
+   {
+      //The CoAP server task closes the connection
+      connection->closing = TRUE;
+   }
+
+   //Release exclusive access
+   osReleaseMutex(&context->tcpMutex);
+}
+
+
+/**
+ * @brief Get the size of the largest body sent after a response
+ *
+ * The response message and its body must not exceed the Max-Message-Size
+ * announced by the client (refer to RFC 8323, section 5.3.1)
+ *
+ * @param[in] exchange Pointer to the request/response exchange
+ * @return Maximum length of the body (0 for datagrams)
+ **/
+
+size_t coapServerGetMaxTcpBodySize(CoapServerExchange *exchange)
+{
+   size_t n;
+   size_t maxMsgSize;
+
+   //Datagrams cannot carry a body larger than the response message
+   if(exchange->connection == NULL)
+      return 0;
+
+   //Largest message the client accepts. The whole message must also fit in
+   //the transmit queue
+   maxMsgSize = MIN(exchange->connection->peerMaxMsgSize,
+      COAP_SERVER_TCP_TX_BUFFER_SIZE);
+
+   //Length of the message without the body, including the largest TCP
+   //header and the payload marker
+   n = exchange->response.length - sizeof(CoapMessageHeader) +
+      COAP_TCP_MAX_HEADER_SIZE + 1;
+
+   //Return the maximum length of the body
+   return (maxMsgSize > n) ? maxMsgSize - n : 0;
+}
+
+
+/**
+ * @brief Close idle, broken and aborted TCP connections
+ *
+ * An aborted connection is shut down gracefully once its transmit queue is
+ * empty, so that the Abort message reaches the client, and is closed when
+ * the shutdown completes or COAP_SERVER_TCP_ABORT_TIMEOUT elapses
+ *
+ * @param[in] context Pointer to the CoAP server context
+ **/
+
+void coapServerTcpTick(CoapServerContext *context)
+{
+   error_t error;
+   uint_t i;
+   systime_t time;
+   CoapServerConnection *connection;
+
+   //Get current time
+   time = osGetSystemTime();
+
+   //Loop through the TCP connections
+   for(i = 0; i < COAP_SERVER_MAX_CONNECTIONS; i++)
+   {
+      //Point to the current connection
+      connection = &context->connections[i];
+
+      //Connection being aborted?
+      if(connection->socket != NULL && connection->aborting)
+      {
+         //Initialize status code
+         error = ERROR_TIMEOUT;
+
+         //The Abort message has been handed over to the socket?
+         if(connection->txBufferLen == 0)
+         {
+            //Send a FIN segment after the pending data (the socket operates
+            //in non-blocking mode)
+            error = socketShutdown(connection->socket, SOCKET_SD_SEND);
+         }
+
+         //Shutdown complete or deadline exceeded?
+         if(!error || timeCompare(time, connection->timestamp +
+            COAP_SERVER_TCP_ABORT_TIMEOUT) >= 0)
+         {
+            //Close the connection
+            coapServerCloseConnection(context, connection);
+         }
+      }
+      else if(connection->socket != NULL)
+      {
+         //Broken or idle connection?
+         if(connection->closing || timeCompare(time, connection->timestamp +
+            COAP_SERVER_CONNECTION_TIMEOUT) >= 0)
+         {
+            //Debug message
+            TRACE_INFO("CoAP Server: TCP connection timeout!\r\n");
+
+            //Close the connection
+            coapServerCloseConnection(context, connection);
+         }
+      }
+   }
+}
+
+#endif
@@ -0,0 +1,99 @@
+/**
+ * @file coap_server_tcp.h
+ * @brief CoAP over TCP (server side)
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+#ifndef _COAP_SERVER_TCP_H
+#define _COAP_SERVER_TCP_H
+
+//Dependencies
+#include "core/net.h"
+#include "coap/coap_server.h"
+
+//Largest message accepted over TCP. Once converted to the datagram format,
+//a message grows by up to two bytes and is terminated by a NULL character
+#define COAP_SERVER_TCP_MAX_MSG_SIZE (COAP_MAX_MSG_SIZE - 3)
+
+//Check whether an exchange takes place over a TCP connection
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+   #define COAP_SERVER_IS_TCP_EXCHANGE(exchange) ((exchange)->connection != NULL)
+#else
+   #define COAP_SERVER_IS_TCP_EXCHANGE(exchange) FALSE
+#endif
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//CoAP server related functions
+error_t coapServerOpenTcpSocket(CoapServerContext *context);
+void coapServerCloseTcpSockets(CoapServerContext *context);
+
+void coapServerAcceptConnection(CoapServerContext *context);
+
+void coapServerCloseConnection(CoapServerContext *context,
+   CoapServerConnection *connection);
+
+void coapServerAbortConnection(CoapServerContext *context,
+   CoapServerConnection *connection, const char_t *diagnostic);
+
+void coapServerReceiveTcpData(CoapServerContext *context,
+   CoapServerConnection *connection);
+
+error_t coapServerProcessTcpMessage(CoapServerContext *context,
+   CoapServerConnection *connection);
+
+error_t coapServerProcessSignal(CoapServerContext *context,
+   CoapServerConnection *connection);
+
+error_t coapServerSendSignal(CoapServerContext *context,
+   CoapServerConnection *connection, CoapCode code, const char_t *diagnostic);
+
+error_t coapServerSendTcpResponse(CoapServerExchange *exchange,
+   const void *data, size_t length);
+
+error_t coapServerSendTcpMessage(CoapServerContext *context,
+   CoapServerConnection *connection, uint_t id, const void *data,
+   size_t length, const uint8_t *body, size_t bodyLen);
+
+error_t coapServerFlushTcpData(CoapServerConnection *connection);
+
+void coapServerSendTcpData(CoapServerContext *context,
+   CoapServerConnection *connection);
+
+size_t coapServerGetMaxTcpBodySize(CoapServerExchange *exchange);
+
+void coapServerTcpTick(CoapServerContext *context);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
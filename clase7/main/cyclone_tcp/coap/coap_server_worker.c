@@ -0,0 +1,706 @@
+/**
+ * @file coap_server_worker.c
+ * @brief CoAP server worker pool
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL COAP_TRACE_LEVEL
+
+//Dependencies
+#include "coap/coap_server.h"
+#include "coap/coap_server_misc.h"
+#include "coap/coap_server_dedup.h"
+#include "coap/coap_server_worker.h"
+#include "coap/coap_server_multicast.h"
+#include "coap/coap_server_tcp.h"
+#include "coap/coap_debug.h"
+#include "debug.h"
+
+//Check TCP/IP stack configuration
+#if (COAP_SERVER_SUPPORT == ENABLED && COAP_SERVER_WORKER_SUPPORT == ENABLED)
+
+
+/**
+ * @brief Worker task
+ *
+ * The worker waits for a request handed over by the CoAP server task,
+ * invokes the request handler and sends the response. A slow handler only
+ * delays its own client
+ *
+ * @param[in] exchange Pointer to the exchange owned by the worker
+ **/
+
+void coapServerWorkerTask(CoapServerExchange *exchange)
+{
+   error_t error;
+   CoapCode code;
+   CoapServerContext *context;
+
+   //Task prologue
+   osEnterTask();
+
+   //Point to the CoAP server context
+   context = exchange->context;
+
+   //Process requests
+   while(1)
+   {
+      //Wait for a request
+      osWaitForEvent(&exchange->startEvent, INFINITE_DELAY);
+
+      //Stop request?
+      if(context->stop)
+      {
+         //The worker task is about to terminate
+         exchange->taskId = OS_INVALID_TASK_ID;
+         //Task epilogue
+         osExitTask();
+         //Kill ourselves
+         osDeleteTask(OS_SELF_TASK_ID);
+      }
+
+      //Any request to process?
+      if(exchange->state == COAP_SERVER_WORKER_STATE_BUSY)
+      {
+         //Retrieve the method code
+         coapGetCode(&exchange->request, &code);
+
+         //Invoke the request handler (the mutex is not held, so that other
+         //requests can be processed in the meantime)
+         error = coapServerHandleRequest(exchange, code);
+
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+         //Request received over TCP?
+         if(exchange->connection != NULL)
+         {
+            //Check status code
+            if(!error)
+            {
+               //Debug message
+               TRACE_INFO("CoAP Server: Sending CoAP message (%" PRIuSIZE " bytes)...\r\n",
+                  exchange->response.length);
+
+               //Dump the contents of the message for debugging purpose
+               coapDumpMessage(exchange->response.buffer,
+                  exchange->response.length);
+
+               //The mutex is not held while sending the response, since the
+               //transmission may have to wait for the client to open its
+               //receive window
+               coapServerSendResponse(exchange, exchange->response.buffer,
+                  exchange->response.length);
+            }
+
+            //The worker is available again
+            osAcquireMutex(&context->mutex);
+            exchange->state = COAP_SERVER_WORKER_STATE_IDLE;
+            osReleaseMutex(&context->mutex);
+         }
+         else
+#endif
+         {
+            //Acquire exclusive access
+            osAcquireMutex(&context->mutex);
+
+            //Check status code
+            if(!error)
+            {
+               //Send the response
+               error = coapServerSendWorkerResponse(exchange);
+            }
+
+            //Any error to report?
+            if(error)
+            {
+               //The worker is available again
+               exchange->state = COAP_SERVER_WORKER_STATE_IDLE;
+            }
+
+            //Release exclusive access
+            osReleaseMutex(&context->mutex);
+         }
+      }
+   }
+}
+
+
+/**
+ * @brief Terminate the worker tasks
+ *
+ * Each running worker is woken up and completes the request it is
+ * processing, if any, before deleting itself. The event objects are kept,
+ * since they are created by coapServerInit and released by coapServerDeinit.
+ * The caller must have set the stop flag of the context
+ *
+ * @param[in] context Pointer to the CoAP server context
+ **/
+
+void coapServerStopWorkers(CoapServerContext *context)
+{
+   uint_t i;
+   CoapServerExchange *worker;
+
+   //Loop through the worker pool
+   for(i = 0; i < COAP_SERVER_MAX_WORKERS; i++)
+   {
+      //Point to the current worker
+      worker = &context->workers[i];
+
+      //Running worker task?
+      if(worker->taskId != OS_INVALID_TASK_ID)
+      {
+         //Wake up the worker task
+         osSetEvent(&worker->startEvent);
+
+         //Wait for the task to terminate
+         while(worker->taskId != OS_INVALID_TASK_ID)
+         {
+            osDelayTask(1);
+         }
+      }
+
+      //Discard any pending signal, so that a new task does not wake up
+      //for nothing
+      osResetEvent(&worker->startEvent);
+
+      //Release the worker
+      worker->state = COAP_SERVER_WORKER_STATE_IDLE;
+   }
+}
+
+
+/**
+ * @brief Hand a request over to an idle worker
+ *
+ * The request has been parsed in the exchange of the CoAP server task. A
+ * retransmission of a request that is still being processed is not handed
+ * over again: it is answered with an empty ACK if the request has already
+ * been acknowledged, and ignored otherwise. The caller must hold the mutex
+ * of the context
+ *
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] exchange Exchange holding the request
+ **/
+
+void coapServerStartWorker(CoapServerContext *context,
+   CoapServerExchange *exchange)
+{
+   uint_t i;
+   CoapServerExchange *worker;
+   CoapServerExchange *idleWorker;
+   const CoapMessageHeader *header;
+
+   //Point to the CoAP request header
+   header = (CoapMessageHeader *) exchange->request.buffer;
+   //No idle worker found so far
+   idleWorker = NULL;
+
+   //Loop through the worker pool
+   for(i = 0; i < COAP_SERVER_MAX_WORKERS; i++)
+   {
+      //Point to the current worker
+      worker = &context->workers[i];
+
+      //Idle worker?
+      if(worker->state == COAP_SERVER_WORKER_STATE_IDLE)
+      {
+         //Keep track of the first idle worker
+         if(idleWorker == NULL)
+         {
+            idleWorker = worker;
+         }
+      }
+      else
+      {
+         //Same request? (messages over TCP are never retransmitted)
+         if(!COAP_SERVER_IS_TCP_EXCHANGE(exchange) &&
+            !COAP_SERVER_IS_TCP_EXCHANGE(worker) &&
+            ((CoapMessageHeader *) worker->request.buffer)->mid == header->mid &&
+            worker->clientPort == exchange->clientPort &&
+            ipCompAddr(&worker->clientIpAddr, &exchange->clientIpAddr))
+         {
+            //Debug message
+            TRACE_INFO("CoAP Server: Request is being processed (MID 0x%04" PRIX16 ")\r\n",
+               ntohs(header->mid));
+
+            //Request already acknowledged?
+            if(worker->separate)
+            {
+               //Send the empty ACK again
+               coapServerFormatEmptyAck(exchange, exchange->response.buffer);
+               exchange->response.length = sizeof(CoapMessageHeader);
+            }
+            else
+            {
+               //The response will be sent by the worker
+               exchange->response.length = 0;
+            }
+
+            //Do not process the request twice
+            return;
+         }
+      }
+   }
+
+   //No room for another request?
+   if(idleWorker == NULL)
+   {
+      //Debug message
+      TRACE_WARNING("CoAP Server: No worker available!\r\n");
+
+      //Request received over TCP?
+      if(COAP_SERVER_IS_TCP_EXCHANGE(exchange))
+      {
+         //Messages over TCP are not retransmitted, so the client is told to
+         //try again later
+         coapSetCode(&exchange->response, COAP_CODE_SERVICE_UNAVAILABLE);
+      }
+      else
+      {
+         //The request is dropped. A confirmable request will be retransmitted
+         //by the client
+         exchange->response.length = 0;
+      }
+
+      //The request is not processed
+      return;
+   }
+
+   //Save the endpoints of the exchange
+   idleWorker->serverIpAddr = exchange->serverIpAddr;
+   idleWorker->clientIpAddr = exchange->clientIpAddr;
+   idleWorker->clientPort = exchange->clientPort;
+
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+   //Save the TCP connection the request was received on, if any
+   idleWorker->connection = exchange->connection;
+   idleWorker->connectionId = exchange->connectionId;
+#endif
+
+   //Copy the request, including the terminating NULL character
+   osMemcpy(idleWorker->request.buffer, exchange->request.buffer,
+      exchange->request.length + 1);
+
+   //Save the length of the request message
+   idleWorker->request.length = exchange->request.length;
+   idleWorker->request.pos = 0;
+
+   //Option offsets are relative to the message, so the index can be copied
+   //rather than built again
+   idleWorker->requestIndex = exchange->requestIndex;
+
+   //Initialize the response
+   coapServerInitResponse(idleWorker);
+
+   //Start processing
+   idleWorker->state = COAP_SERVER_WORKER_STATE_BUSY;
+   idleWorker->separate = FALSE;
+   idleWorker->timestamp = osGetSystemTime();
+
+   //Wake up the worker task
+   osSetEvent(&idleWorker->startEvent);
+
+   //The response will be sent by the worker
+   exchange->response.length = 0;
+}
+
+
+/**
+ * @brief Send the response formatted by a worker
+ *
+ * The response is piggybacked in the ACK when the request has not been
+ * acknowledged yet. Otherwise, it is sent as a separate Confirmable message
+ * with a new Message ID, and is matched to the request by its token (refer
+ * to RFC 7252, section 5.2.2). A separate response is copied to a transmit
+ * slot, from which the CoAP server task retransmits it, so that the worker
+ * is available again right away. The response to a multicast request is
+ * queued for the CoAP server task, which sends it after a random delay.
+ * The caller must hold the mutex of the context
+ *
+ * @param[in] exchange Pointer to the exchange owned by the worker
+ * @return Error code
+ **/
+
+error_t coapServerSendWorkerResponse(CoapServerExchange *exchange)
+{
+   error_t error;
+   uint_t i;
+   CoapMessageHeader *header;
+   CoapServerContext *context;
+   CoapServerSeparateResponse *entry;
+#if (COAP_SERVER_DEDUP_SUPPORT == ENABLED)
+   uint8_t buffer[sizeof(CoapMessageHeader)];
+#endif
+
+   //Point to the CoAP server context
+   context = exchange->context;
+   //Point to the CoAP response header
+   header = (CoapMessageHeader *) exchange->response.buffer;
+
+   //No transmit slot so far
+   entry = NULL;
+
+   //Has an empty ACK already been sent?
+   if(exchange->separate)
+   {
+      //The separate response is a new Confirmable message
+      header->type = COAP_TYPE_CON;
+      header->mid = htons(++context->mid);
+
+      //Loop through the transmit slots
+      for(i = 0; i < COAP_SERVER_MAX_SEPARATE_RESPONSES; i++)
+      {
+         //Free entry?
+         if(context->separateResponses[i].length == 0)
+         {
+            entry = &context->separateResponses[i];
+            break;
+         }
+      }
+
+      //No free transmit slot?
+      if(entry == NULL)
+      {
+         //Debug message
+         TRACE_WARNING("CoAP Server: Separate response will not be retransmitted!\r\n");
+      }
+   }
+
+#if (COAP_SERVER_MULTICAST_SUPPORT == ENABLED)
+   //Request sent to a multicast group? (such requests are Non-confirmable,
+   //so they are never acknowledged with an empty ACK)
+   if(COAP_SERVER_IS_MULTICAST_EXCHANGE(exchange))
+   {
+      //The response is sent by the CoAP server task, after a random delay
+      error = coapServerDeferResponse(exchange);
+
+      //Wake up the CoAP server task, so that it updates its polling timeout
+      osSetEvent(&context->event);
+   }
+   else
+#endif
+   {
+      //Debug message
+      TRACE_INFO("CoAP Server: Sending CoAP message (%" PRIuSIZE " bytes)...\r\n",
+         exchange->response.length);
+
+      //Dump the contents of the message for debugging purpose
+      coapDumpMessage(exchange->response.buffer, exchange->response.length);
+
+      //Send CoAP response message
+      error = coapServerSendResponse(exchange, exchange->response.buffer,
+         exchange->response.length);
+   }
+
+   //Any error to report?
+   if(error)
+      return error;
+
+#if (COAP_SERVER_DEDUP_SUPPORT == ENABLED)
+   //Separate response?
+   if(exchange->separate)
+   {
+      //A retransmission of the request receives the empty ACK again
+      coapServerFormatEmptyAck(exchange, buffer);
+      coapServerAddDedupEntry(exchange, buffer, sizeof(CoapMessageHeader));
+   }
+   else
+   {
+      //A retransmission of the request receives the same response
+      coapServerAddDedupEntry(exchange, exchange->response.buffer,
+         exchange->response.length);
+   }
+#endif
+
+   //Separate response to be retransmitted until it is acknowledged?
+   if(entry != NULL)
+   {
+      //Save the endpoints of the exchange
+      entry->serverIpAddr = exchange->serverIpAddr;
+      entry->clientIpAddr = exchange->clientIpAddr;
+      entry->clientPort = exchange->clientPort;
+
+      //Save the message ID to match the Acknowledgement
+      entry->mid = context->mid;
+
+      //Initialize retransmission state
+      entry->retransmitCount = 0;
+      entry->timeout = COAP_SERVER_ACK_TIMEOUT;
+      entry->timestamp = osGetSystemTime();
+
+      //Save the response
+      osMemcpy(entry->buffer, exchange->response.buffer,
+         exchange->response.length);
+
+      //The entry is now in use
+      entry->length = exchange->response.length;
+   }
+
+   //The worker is available again
+   exchange->state = COAP_SERVER_WORKER_STATE_IDLE;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Format an empty ACK matching the request of an exchange
+ * @param[in] exchange Pointer to the request/response exchange
+ * @param[out] buffer Output buffer (sizeof(CoapMessageHeader) bytes)
+ **/
+
+void coapServerFormatEmptyAck(const CoapServerExchange *exchange,
+   uint8_t *buffer)
+{
+   CoapMessageHeader *header;
+
+   //Point to the message header
+   header = (CoapMessageHeader *) buffer;
+
+   //An empty ACK carries no token, no option and no payload, and echoes the
+   //message ID of the request (refer to RFC 7252, section 4.2)
+   header->version = COAP_VERSION_1;
+   header->type = COAP_TYPE_ACK;
+   header->tokenLen = 0;
+   header->code = COAP_CODE_EMPTY;
+   header->mid = ((CoapMessageHeader *) exchange->request.buffer)->mid;
+}
+
+
+/**
+ * @brief Handle slow requests and separate responses
+ *
+ * A Confirmable request whose handler has been running for more than
+ * COAP_SERVER_SEPARATE_RESPONSE_DELAY is acknowledged with an empty ACK,
+ * so that the client stops retransmitting it. Unacknowledged separate
+ * responses are retransmitted with an exponential back-off. The caller
+ * must hold the mutex of the context
+ *
+ * @param[in] context Pointer to the CoAP server context
+ **/
+
+void coapServerWorkerTick(CoapServerContext *context)
+{
+   uint_t i;
+   systime_t time;
+   CoapServerExchange *worker;
+   CoapServerExchange *exchange;
+   CoapServerSeparateResponse *entry;
+   uint8_t buffer[sizeof(CoapMessageHeader)];
+
+   //Get current time
+   time = osGetSystemTime();
+
+   //Loop through the worker pool
+   for(i = 0; i < COAP_SERVER_MAX_WORKERS; i++)
+   {
+      //Point to the current worker
+      worker = &context->workers[i];
+
+      //Confirmable request being processed and not yet acknowledged?
+      if(worker->state == COAP_SERVER_WORKER_STATE_BUSY && !worker->separate &&
+         ((CoapMessageHeader *) worker->request.buffer)->type == COAP_TYPE_CON)
+      {
+         //Deadline exceeded?
+         if(timeCompare(time, worker->timestamp +
+            COAP_SERVER_SEPARATE_RESPONSE_DELAY) >= 0)
+         {
+            //Debug message
+            TRACE_INFO("CoAP Server: Sending empty ACK...\r\n");
+
+            //The response will be sent later as a separate message. The
+            //response buffer is still being used by the handler
+            coapServerFormatEmptyAck(worker, buffer);
+            coapServerSendResponse(worker, buffer, sizeof(CoapMessageHeader));
+
+            //The request has been acknowledged
+            worker->separate = TRUE;
+         }
+      }
+   }
+
+   //Point to the exchange of the CoAP server task
+   exchange = &context->exchange;
+
+   //Loop through the transmit slots
+   for(i = 0; i < COAP_SERVER_MAX_SEPARATE_RESPONSES; i++)
+   {
+      //Point to the current entry
+      entry = &context->separateResponses[i];
+
+      //Separate response awaiting acknowledgment?
+      if(entry->length > 0 &&
+         timeCompare(time, entry->timestamp + entry->timeout) >= 0)
+      {
+         //Any retransmission left?
+         if(entry->retransmitCount < COAP_SERVER_MAX_RETRANSMIT)
+         {
+            //Debug message
+            TRACE_INFO("CoAP Server: Retransmitting separate response...\r\n");
+
+            //Address the client
+            exchange->serverIpAddr = entry->serverIpAddr;
+            exchange->clientIpAddr = entry->clientIpAddr;
+            exchange->clientPort = entry->clientPort;
+
+#if (COAP_SERVER_TCP_SUPPORT == ENABLED)
+            //Separate responses are only sent over datagrams
+            exchange->connection = NULL;
+#endif
+
+            //Retransmit the separate response
+            coapServerSendResponse(exchange, entry->buffer, entry->length);
+
+            //The timeout is doubled after each retransmission
+            entry->retransmitCount++;
+            entry->timeout *= 2;
+            entry->timestamp = time;
+         }
+         else
+         {
+            //Debug message
+            TRACE_INFO("CoAP Server: Separate response not acknowledged!\r\n");
+
+            //Release the entry
+            entry->length = 0;
+         }
+      }
+   }
+}
+
+
+/**
+ * @brief Process an Acknowledgement or Reset message
+ *
+ * The message completes the delivery of a separate response, which releases
+ * its transmit slot. The caller must hold the mutex of the context
+ *
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] mid Message ID
+ **/
+
+void coapServerProcessWorkerAck(CoapServerContext *context, uint16_t mid)
+{
+   uint_t i;
+   CoapServerSeparateResponse *entry;
+
+   //Loop through the transmit slots
+   for(i = 0; i < COAP_SERVER_MAX_SEPARATE_RESPONSES; i++)
+   {
+      //Point to the current entry
+      entry = &context->separateResponses[i];
+
+      //Matching separate response?
+      if(entry->length > 0 && entry->mid == mid &&
+         entry->clientPort == context->clientPort &&
+         ipCompAddr(&entry->clientIpAddr, &context->clientIpAddr))
+      {
+         //Release the entry
+         entry->length = 0;
+         break;
+      }
+   }
+}
+
+
+/**
+ * @brief Get the time until the next worker deadline
+ *
+ * The CoAP server task uses this value to limit its polling timeout, so
+ * that empty ACKs and retransmissions are sent on time
+ *
+ * @param[in] context Pointer to the CoAP server context
+ * @param[in] timeout Default polling timeout
+ * @return Polling timeout
+ **/
+
+systime_t coapServerGetWorkerTimeout(CoapServerContext *context,
+   systime_t timeout)
+{
+   uint_t i;
+   systime_t time;
+   systime_t deadline;
+   CoapServerExchange *worker;
+   CoapServerSeparateResponse *entry;
+
+   //Get current time
+   time = osGetSystemTime();
+
+   //Loop through the worker pool
+   for(i = 0; i < COAP_SERVER_MAX_WORKERS; i++)
+   {
+      //Point to the current worker
+      worker = &context->workers[i];
+
+      //Confirmable request awaiting acknowledgment?
+      if(worker->state == COAP_SERVER_WORKER_STATE_BUSY && !worker->separate &&
+         ((CoapMessageHeader *) worker->request.buffer)->type == COAP_TYPE_CON)
+      {
+         deadline = worker->timestamp + COAP_SERVER_SEPARATE_RESPONSE_DELAY;
+
+         //Deadline already reached?
+         if(timeCompare(time, deadline) >= 0)
+         {
+            timeout = 0;
+         }
+         else
+         {
+            timeout = MIN(timeout, deadline - time);
+         }
+      }
+   }
+
+   //Loop through the transmit slots
+   for(i = 0; i < COAP_SERVER_MAX_SEPARATE_RESPONSES; i++)
+   {
+      //Point to the current entry
+      entry = &context->separateResponses[i];
+
+      //Separate response awaiting acknowledgment?
+      if(entry->length > 0)
+      {
+         deadline = entry->timestamp + entry->timeout;
+
+         //Deadline already reached?
+         if(timeCompare(time, deadline) >= 0)
+         {
+            timeout = 0;
+         }
+         else
+         {
+            timeout = MIN(timeout, deadline - time);
+         }
+      }
+   }
+
+   //Return the polling timeout
+   return timeout;
+}
+
+#endif
@@ -0,0 +1,66 @@
+/**
+ * @file coap_server_worker.h
+ * @brief CoAP server worker pool
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+#ifndef _COAP_SERVER_WORKER_H
+#define _COAP_SERVER_WORKER_H
+
+//Dependencies
+#include "core/net.h"
+#include "coap/coap_server.h"
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//CoAP server related functions
+void coapServerWorkerTask(CoapServerExchange *exchange);
+void coapServerStopWorkers(CoapServerContext *context);
+
+void coapServerStartWorker(CoapServerContext *context,
+   CoapServerExchange *exchange);
+
+error_t coapServerSendWorkerResponse(CoapServerExchange *exchange);
+
+void coapServerFormatEmptyAck(const CoapServerExchange *exchange,
+   uint8_t *buffer);
+
+void coapServerWorkerTick(CoapServerContext *context);
+void coapServerProcessWorkerAck(CoapServerContext *context, uint16_t mid);
+
+systime_t coapServerGetWorkerTimeout(CoapServerContext *context,
+   systime_t timeout);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -18,11 +18,18 @@ extern "C"
 {
 #include "core/net.h" // Para ipv4AddrToString y tipos de red (MacAddr, Eui64, etc.)
 #include "debug.h"
+#include "coap/coap_client.h"
 #include "coap/coap_server.h"
+#include "coap/coap_server_block.h"
+#include "coap/coap_server_observe.h"
 #include "coap/coap_server_request.h"
+#include "coap/coap_server_resource.h"
+#include "cbor.h"
 #include "include/wifi_config.h"
+#include "json_writer.h"
 #include "path.h"
 #include "resource_manager.h"
+#include "resp_cache.h"
 #include "wifi_manager.h"
 }
 
@@ -32,23 +39,35 @@ extern "C"
 static const char *TAG = "Main";
 
 #define APP_COAP_SERVER_PORT 5683
+#define APP_COAP_CLIENT_SERVER_NAME "coap.me"
+#define APP_COAP_CLIENT_SERVER_PORT 5683
+#define APP_COAP_CLIENT_TIMEOUT 20000
 
 /* ========================================================================== */
 /*                          VARIABLES GLOBALES                                */
 /* ========================================================================== */
 CoapServerSettings coapServerSettings;
 CoapServerContext coapServerContext;
+CoapClientContext coapClientContext;
 WifiManagerContext_t wifi_context;
 SemaphoreHandle_t dhcpFlag;
 
 /* Estado mutable de recursos CoAP */
 static bool s_led_on = false;  /**< Estado del LED simulado */
 static uint32_t s_counter = 0; /**< Contador accesible vía CoAP */
+static uint32_t s_led_version = 0; /**< Cambia con cada PUT /led efectivo */
+static RespCache s_resp_cache;      /**< Respuestas de /info y /led (JSON y CBOR) */
+static OsMutex s_state_mutex;       /**< Protege LED y contador (varios workers) */
+static uint_t s_client_pending = 0; /**< Peticiones del cliente sin terminar */
+
+/* Recursos que el cliente CoAP pide a la vez al arrancar */
+static const char_t *const s_client_paths[] = {"/test", "/hello",
+                                               "/seg1/seg2/seg3"};
 /* ========================================================================== */
 /*                      PROTOTIPOS DE FUNCIONES                               */
 /* ========================================================================== */
-error_t coapServerRequestCallback(CoapServerContext *context,
-                                  CoapCode method, const char_t *uri);
+static error_t init_coap_resources(void);
+static void run_coap_client(void);
 
 #ifdef __cplusplus
 extern "C" void dhcpClientStateChangeCallback(DhcpClientContext *context,
@@ -188,17 +207,35 @@ void app_main(void)
   /*wait for flag*/
   xSemaphoreTake(dhcpFlag, portMAX_DELAY);
 
+  // Cache de las respuestas que cambian poco
+  error = respCacheInit(&s_resp_cache);
+  if (error)
+  {
+    ESP_LOGE(TAG, "Error inicializando la cache de respuestas: %d", error);
+  }
+
+  // Los handlers CoAP se ejecutan en varios workers a la vez
+  if (!osCreateMutex(&s_state_mutex))
+  {
+    ESP_LOGE(TAG, "Error creando el mutex de estado");
+    return;
+  }
+
   ESP_LOGI(TAG, "Starting CoAP server...");
   // Get default settings
   coapServerGetDefaultSettings(&coapServerSettings);
   coapServerSettings.task.stackSize = 1024*8;
+  // Los workers usan COAP_SERVER_WORKER_STACK_SIZE (Kconfig, en palabras)
   // Bind CoAP server to the desired interface
   coapServerSettings.interface = &netInterface[0];
   // Listen to port
   coapServerSettings.port = APP_COAP_SERVER_PORT;
-  // Callback functions
-  coapServerSettings.requestCallback = coapServerRequestCallback;
-
+#if (COAP_SERVER_MULTICAST_SUPPORT == ENABLED)
+  // Responder al descubrimiento enviado al grupo All CoAP Nodes. Solo si se
+  // habilita en Kconfig: el grupo expone todos los recursos a la red local
+  coapServerSettings.groupAddr[0].length = sizeof(Ipv4Addr);
+  coapServerSettings.groupAddr[0].ipv4Addr = COAP_IPV4_ALL_COAP_NODES_ADDR;
+#endif
   // CoAP server initialization
   error = coapServerInit(&coapServerContext, &coapServerSettings);
   // Failed to initialize CoAP server?
@@ -208,6 +245,15 @@ void app_main(void)
     ESP_LOGE(TAG, "Failed to initialize CoAP server!\r\n");
   }
 
+  // Register resources (dispatch, 4.05 and /.well-known/core)
+  error = init_coap_resources();
+  // Failed to register resources?
+  if (error)
+  {
+    // Debug message
+    ESP_LOGE(TAG, "Failed to register CoAP resources!\r\n");
+  }
+
   // Start CoAP server
   error = coapServerStart(&coapServerContext);
   // Failed to start CoAP server?
@@ -219,284 +265,960 @@ void app_main(void)
 
   ESP_LOGI(TAG, "CoAP server started on port %d", APP_COAP_SERVER_PORT);
 
+  // Varias peticiones simultáneas desde el cliente CoAP
+  run_coap_client();
+
+  /* /info cambia continuamente: se notifica a sus observadores cada 5 s */
+  const CoapServerResource *info =
+      coapServerFindResource(&coapServerContext, "/info");
+
   while (1)
   {
     osDelayTask(5000);
+    coapServerNotify(&coapServerContext, info);
+
+#if (COAP_SERVER_WORKER_SUPPORT == ENABLED)
+    // Margen de pila de los workers, para ajustar su tamaño en Kconfig
+    for (uint_t i = 0; i < COAP_SERVER_MAX_WORKERS; i++)
+    {
+      TaskHandle_t task = coapServerContext.workers[i].taskId;
+
+      if (task != OS_INVALID_TASK_ID)
+        ESP_LOGD(TAG, "Worker %u: %u bytes de pila sin usar", i,
+                 (unsigned)uxTaskGetStackHighWaterMark(task));
+    }
+#endif
   }
 }
 
+/* ========================================================================== */
+/*                            CLIENTE CoAP                                    */
+/* ========================================================================== */
+
+/**
+ * @brief  Callback de las peticiones asíncronas del cliente CoAP.
+ * @param[in] context  Contexto del cliente CoAP.
+ * @param[in] request  Petición que ha terminado.
+ * @param[in] status   Resultado de la petición.
+ * @param[in] param    Ruta pedida (para el log).
+ * @return error_t
+ */
+static error_t client_response_callback(CoapClientContext *context,
+                                        CoapClientRequest *request,
+                                        CoapRequestStatus status, void *param)
+{
+  const char_t *path = (const char_t *)param;
+  const CoapMessage *response;
+  const uint8_t *payload;
+  size_t length;
+  CoapCode code;
+
+  if (status == COAP_REQUEST_STATUS_SUCCESS)
+  {
+    response = coapClientGetResponseMessage(request);
+    coapClientGetResponseCode(response, &code);
+    coapClientGetPayload(response, &payload, &length);
+
+    ESP_LOGI(TAG, "CoAP GET %s -> %u.%02u (%u bytes)", path,
+             (unsigned)COAP_GET_CODE_CLASS(code),
+             (unsigned)COAP_GET_CODE_SUBCLASS(code), (unsigned)length);
+  }
+  else
+  {
+    ESP_LOGW(TAG, "CoAP GET %s sin respuesta (estado %d)", path, status);
+  }
+
+  // La petición se libera sola al volver del callback
+  s_client_pending--;
+  return NO_ERROR;
+}
+
+/**
+ * @brief  Lanza a la vez un GET por cada ruta de s_client_paths.
+ *
+ * Solo COAP_CLIENT_NSTART peticiones quedan en vuelo; el resto espera en la
+ * tabla del cliente hasta que alguna termina (RFC 7252, sección 4.7).
+ */
+static void run_coap_client(void)
+{
+  error_t error;
+  uint_t i;
+  IpAddr serverIpAddr;
+  CoapClientRequest *request;
+  systime_t start;
+
+  // Resolver el nombre del servidor
+  error = getHostByName(&netInterface[0], APP_COAP_CLIENT_SERVER_NAME,
+                        &serverIpAddr, HOST_TYPE_IPV4);
+  if (error)
+  {
+    ESP_LOGE(TAG, "No se pudo resolver %s: %d", APP_COAP_CLIENT_SERVER_NAME,
+             error);
+    return;
+  }
+
+  error = coapClientInit(&coapClientContext);
+  if (error)
+  {
+    ESP_LOGE(TAG, "Error inicializando el cliente CoAP: %d", error);
+    return;
+  }
+
+  coapClientSetTransportProtocol(&coapClientContext,
+                                 COAP_TRANSPORT_PROTOCOL_UDP);
+  coapClientBindToInterface(&coapClientContext, &netInterface[0]);
+  coapClientSetTimeout(&coapClientContext, APP_COAP_CLIENT_TIMEOUT);
+
+  error = coapClientConnect(&coapClientContext, &serverIpAddr,
+                            APP_COAP_CLIENT_SERVER_PORT);
+  if (error)
+  {
+    ESP_LOGE(TAG, "Error conectando con %s: %d", APP_COAP_CLIENT_SERVER_NAME,
+             error);
+  }
+  else
+  {
+    ESP_LOGI(TAG, "CoAP client: %u peticiones, NSTART = %u",
+             (unsigned)arraysize(s_client_paths), (unsigned)COAP_CLIENT_NSTART);
+
+    // Todas las peticiones se envían sin esperar respuesta
+    for (i = 0; i < arraysize(s_client_paths); i++)
+    {
+      request = coapClientCreateRequest(&coapClientContext);
+      if (request == NULL)
+      {
+        ESP_LOGW(TAG, "Tabla de peticiones llena (COAP_CLIENT_MAX_REQUESTS)");
+        break;
+      }
+
+      error = coapClientSetUriPath(coapClientGetRequestMessage(request),
+                                   s_client_paths[i]);
+      if (!error)
+      {
+        error = coapClientSendRequest(request, client_response_callback,
+                                      (void *)s_client_paths[i]);
+      }
+      if (error)
+      {
+        coapClientDeleteRequest(request);
+        break;
+      }
+
+      s_client_pending++;
+    }
+
+    // Procesar eventos hasta que todas terminen (o venza el plazo)
+    start = osGetSystemTime();
+    while (s_client_pending > 0 &&
+           timeCompare(osGetSystemTime(), start + APP_COAP_CLIENT_TIMEOUT) < 0)
+    {
+      coapClientTask(&coapClientContext, COAP_CLIENT_TICK_INTERVAL);
+    }
+
+    coapClientDisconnect(&coapClientContext);
+  }
+
+  coapClientDeinit(&coapClientContext);
+}
+
 /* ========================================================================== */
 /*              HELPERS INTERNOS DEL CALLBACK CoAP                           */
 /* ========================================================================== */
 
 /**
  * @brief  Envía una respuesta JSON al cliente CoAP.
- * @param[in] context       Contexto CoAP.
+ * @param[in] exchange      Intercambio CoAP (petición/respuesta).
  * @param[in] code          Código de respuesta CoAP (ej. COAP_CODE_CONTENT).
  * @param[in] json_payload  Buffer con el JSON serializado (null-terminated).
  * @return error_t
  */
-static error_t send_json_response(CoapServerContext *context,
+static error_t send_json_response(CoapServerExchange *exchange,
                                   CoapCode code,
                                   const char *json_payload)
 {
   error_t err;
-  err = coapServerSetResponseCode(context, code);
+  err = coapServerSetResponseCode(exchange, code);
   if (err)
     return err;
-  err = coapServerSetUintOption(context, COAP_OPT_CONTENT_FORMAT, 0,
+  err = coapServerSetUintOption(exchange, COAP_OPT_CONTENT_FORMAT, 0,
                                 COAP_CONTENT_FORMAT_APP_JSON);
   if (err)
     return err;
-  return coapServerSetPayload(context, json_payload, strlen(json_payload));
+  return coapServerSetPayload(exchange, json_payload, strlen(json_payload));
+}
+
+/**
+ * @brief  Escritor de documentos: serializa el mismo contenido en JSON o en
+ *         CBOR (RFC 8949) según el formato negociado con el cliente.
+ *
+ * Los mapas CBOR se codifican con longitud definida, por lo que quien abre
+ * un objeto indica su número de miembros.
+ */
+typedef struct
+{
+  uint16_t format; /**< COAP_CONTENT_FORMAT_APP_JSON o _APP_CBOR */
+  union
+  {
+    JsonWriter json;
+    CborWriter cbor;
+  };
+} DocWriter;
+
+/**
+ * @brief  Salida de un escritor: recibe cada bloque serializado.
+ */
+typedef error_t (*DocOutput)(void *param, const void *data, size_t length);
+
+static void doc_init(DocWriter *writer, uint16_t format, DocOutput output,
+                     void *param)
+{
+  writer->format = format;
+  if (format == COAP_CONTENT_FORMAT_APP_CBOR)
+    cborWriterInit(&writer->cbor, output, param);
+  else
+    jsonWriterInit(&writer->json, output, param);
+}
+
+static void doc_begin_object(DocWriter *writer, uint_t count)
+{
+  if (writer->format == COAP_CONTENT_FORMAT_APP_CBOR)
+    cborWriterBeginMap(&writer->cbor, count);
+  else
+    jsonWriterBeginObject(&writer->json);
+}
+
+static void doc_end_object(DocWriter *writer)
+{
+  /* Un mapa CBOR de longitud definida no lleva marca de cierre */
+  if (writer->format != COAP_CONTENT_FORMAT_APP_CBOR)
+    jsonWriterEndObject(&writer->json);
+}
+
+static void doc_string_member(DocWriter *writer, const char_t *name,
+                              const char_t *value)
+{
+  if (writer->format == COAP_CONTENT_FORMAT_APP_CBOR)
+    cborWriterStringMember(&writer->cbor, name, value);
+  else
+    jsonWriterStringMember(&writer->json, name, value);
+}
+
+static void doc_int_member(DocWriter *writer, const char_t *name, int32_t value)
+{
+  if (writer->format == COAP_CONTENT_FORMAT_APP_CBOR)
+    cborWriterIntMember(&writer->cbor, name, value);
+  else
+    jsonWriterIntMember(&writer->json, name, value);
+}
+
+static void doc_uint_member(DocWriter *writer, const char_t *name,
+                            uint32_t value)
+{
+  if (writer->format == COAP_CONTENT_FORMAT_APP_CBOR)
+    cborWriterUintMember(&writer->cbor, name, value);
+  else
+    jsonWriterUintMember(&writer->json, name, value);
+}
+
+static void doc_bool_member(DocWriter *writer, const char_t *name, bool_t value)
+{
+  if (writer->format == COAP_CONTENT_FORMAT_APP_CBOR)
+    cborWriterBoolMember(&writer->cbor, name, value);
+  else
+    jsonWriterBoolMember(&writer->json, name, value);
+}
+
+static error_t doc_flush(DocWriter *writer)
+{
+  if (writer->format == COAP_CONTENT_FORMAT_APP_CBOR)
+    return cborWriterFlush(&writer->cbor);
+  return jsonWriterFlush(&writer->json);
 }
 
-/* ========================================================================== */
-/*                      IMPLEMENTACIÓN DE FUNCIONES                           */
-/* ========================================================================== */
 /**
- * @brief CoAP request callback — maneja todos los recursos del servidor.
+ * @brief  Formato de la respuesta según la opción Accept de la petición.
  *
- * Recursos disponibles:
- *   GET  /.well-known/core  → Descubrimiento de recursos (RFC 6690)
- *   GET  /test              → Texto plano "Hello World!"
- *   GET  /info              → JSON con uptime, heap libre y chip_id
- *   GET  /led               → JSON estado actual del LED simulado
- *   PUT  /led               → Modifica estado del LED (body JSON: {"state":"on"})
- *   GET  /counter           → JSON con valor del contador (auto-incrementa)
- *   POST /counter/reset     → Reinicia el contador a 0
- *   DELETE /counter         → Reinicia el contador a 0 (alias)
- *   POST /echo              → Repite el payload recibido
+ * El servidor ya responde 4.06 si Accept no figura entre los formatos del
+ * recurso; sin Accept se responde en JSON.
+ */
+static uint16_t doc_format(CoapServerExchange *exchange)
+{
+  uint32_t accept;
+
+  if (!coapServerGetUintOption(exchange, COAP_OPT_ACCEPT, 0, &accept) &&
+      accept == COAP_CONTENT_FORMAT_APP_CBOR)
+    return COAP_CONTENT_FORMAT_APP_CBOR;
+  return COAP_CONTENT_FORMAT_APP_JSON;
+}
+
+/**
+ * @brief  Salida del escritor: añade cada bloque al payload CoAP.
+ */
+static error_t doc_coap_output(void *param, const void *data, size_t length)
+{
+  return coapServerWritePayload((CoapServerExchange *)param, data, length);
+}
+
+/**
+ * @brief  Prepara una respuesta en el formato negociado que se serializa
+ *         directamente en el payload, sin documento ni buffer intermedio.
+ * @param[in]  exchange Intercambio CoAP (petición/respuesta).
+ * @param[in]  code     Código de respuesta CoAP.
+ * @param[out] writer   Escritor a inicializar.
+ * @return error_t
+ */
+static error_t begin_doc_response(CoapServerExchange *exchange, CoapCode code,
+                                  DocWriter *writer)
+{
+  error_t err;
+  uint16_t format = doc_format(exchange);
+
+  err = coapServerSetResponseCode(exchange, code);
+  if (err)
+    return err;
+  err = coapServerSetUintOption(exchange, COAP_OPT_CONTENT_FORMAT, 0, format);
+  if (err)
+    return err;
+  doc_init(writer, format, doc_coap_output, exchange);
+  return NO_ERROR;
+}
+
+/**
+ * @brief  Salida del escritor hacia un buffer en memoria.
+ */
+typedef struct
+{
+  uint8_t *data;
+  size_t size;
+  size_t length;
+} DocBuffer;
+
+static error_t doc_buffer_output(void *param, const void *data, size_t length)
+{
+  DocBuffer *buffer = (DocBuffer *)param;
+
+  if (length > buffer->size - buffer->length)
+    return ERROR_BUFFER_OVERFLOW;
+  memcpy(buffer->data + buffer->length, data, length);
+  buffer->length += length;
+  return NO_ERROR;
+}
+
+/**
+ * @brief  Genera el documento de un recurso sobre el escritor dado.
+ */
+typedef void (*DocRenderer)(DocWriter *writer);
+
+/**
+ * @brief  Envía un recurso desde la cache de respuestas.
  *
- * @param[in] context  Contexto del servidor CoAP.
- * @param[in] method   Código de método CoAP.
- * @param[in] uri      Ruta del recurso solicitado.
+ * La cache guarda una copia por formato (JSON y CBOR). Si no tiene una
+ * construida con la versión actual de los datos, el documento se regenera y
+ * se guarda. Si el cliente presenta la misma ETag se responde 2.03 Valid sin
+ * payload (RFC 7252, 5.10.6.2).
+ *
+ * @param[in] exchange Intercambio CoAP (petición/respuesta).
+ * @param[in] uri      Clave del recurso en la cache.
+ * @param[in] version  Versión actual de los datos (leída antes de generar).
+ * @param[in] render   Generador del documento.
  * @return error_t
- **/
-error_t coapServerRequestCallback(CoapServerContext *context,
-                                  CoapCode method, const char_t *uri)
+ */
+static error_t send_cached_doc(CoapServerExchange *exchange, const char_t *uri,
+                               uint32_t version, DocRenderer render)
 {
-  error_t error = NO_ERROR;
-  /* Buffer de trabajo para respuestas JSON (sin alloc dinámico) */
-  static char s_json_buf[256];
+  uint8_t body[RESP_CACHE_MAX_SIZE];
+  char_t etag[RESP_CACHE_ETAG_SIZE];
+  size_t length;
+  const uint8_t *value;
+  size_t n;
+  CoapCode code = COAP_CODE_CONTENT;
+  uint16_t format = doc_format(exchange);
+  error_t error;
 
-  /* ------------------------------------------------------------------ */
-  /*  GET                                                                */
-  /* ------------------------------------------------------------------ */
-  if (method == COAP_CODE_GET)
+  error = respCacheGet(&s_resp_cache, uri, format, version, body, sizeof(body),
+                       &length, etag);
+  if (error)
   {
-    /* --- /.well-known/core : descubrimiento de recursos --- */
-    if (!strcasecmp(uri, "/.well-known/core"))
-    {
-      const char_t core[] =
-          "</test>;rt=\"demo\";title=\"Hello World\","
-          "</info>;rt=\"info\";title=\"Device info (JSON)\","
-          "</led>;rt=\"actuator\";title=\"LED simulado (GET/PUT)\","
-          "</counter>;rt=\"sensor\";title=\"Contador (GET/DELETE)\","
-          "</counter/reset>;rt=\"control\";title=\"Reinicia contador (POST)\","
-          "</echo>;rt=\"debug\";title=\"Echo payload (POST)\"";
-
-      error = coapServerSetResponseCode(context, COAP_CODE_CONTENT);
-      if (!error)
-        error = coapServerSetUintOption(context, COAP_OPT_CONTENT_FORMAT,
-                                        0, COAP_CONTENT_FORMAT_APP_LINK_FORMAT);
-      if (!error)
-        error = coapServerSetPayload(context, core, strlen(core));
-    }
+    DocWriter writer;
+    DocBuffer buffer = {body, sizeof(body), 0};
 
-    /* --- /test : texto plano --- */
-    else if (!strcasecmp(uri, "/test"))
-    {
-      const char_t msg[] = "Hello World! CoAP server running on ESP32.";
-      error = coapServerSetResponseCode(context, COAP_CODE_CONTENT);
-      if (!error)
-        error = coapServerSetUintOption(context, COAP_OPT_CONTENT_FORMAT,
-                                        0, COAP_CONTENT_FORMAT_TEXT_PLAIN);
-      if (!error)
-        error = coapServerSetPayload(context, msg, strlen(msg));
-    }
+    doc_init(&writer, format, doc_buffer_output, &buffer);
+    render(&writer);
+    error = doc_flush(&writer);
+    if (error)
+      return coapServerSetResponseCode(exchange, COAP_CODE_INTERNAL_SERVER);
 
-    /* --- /info : información del dispositivo --- */
-    else if (!strcasecmp(uri, "/info"))
-    {
-      uint64_t uptime_us = (uint64_t)esp_timer_get_time();
-      uint32_t uptime_s = (uint32_t)(uptime_us / 1000000ULL);
-      uint32_t free_heap = esp_get_free_heap_size();
+    length = buffer.length;
+    respCachePut(&s_resp_cache, uri, format, version, body, length, etag);
+  }
 
-      JsonDocument doc;
-      doc["uptime_s"] = uptime_s;
-      doc["free_heap"] = free_heap;
-      doc["chip"] = "ESP32";
-      serializeJson(doc, s_json_buf, sizeof(s_json_buf));
+  /* La ETag CoAP es opaca (1-8 bytes): se usan los 8 dígitos hex sin comillas */
+  for (uint_t i = 0; !coapServerGetOpaqueOption(exchange, COAP_OPT_ETAG, i,
+                                                &value, &n); i++)
+  {
+    if (n == 8 && !memcmp(value, etag + 1, 8))
+      code = COAP_CODE_VALID;
+  }
 
-      error = send_json_response(context, COAP_CODE_CONTENT, s_json_buf);
-    }
+  error = coapServerSetResponseCode(exchange, code);
+  if (!error)
+    error = coapServerSetOpaqueOption(exchange, COAP_OPT_ETAG, 0,
+                                      (const uint8_t *)etag + 1, 8);
+  if (!error && code == COAP_CODE_CONTENT)
+    error = coapServerSetUintOption(exchange, COAP_OPT_CONTENT_FORMAT, 0,
+                                    format);
+  if (!error && code == COAP_CODE_CONTENT)
+    error = coapServerSetPayload(exchange, body, length);
 
-    /* --- /led : leer estado del LED simulado --- */
-    else if (!strcasecmp(uri, "/led"))
-    {
-      JsonDocument doc;
-      doc["led"] = s_led_on ? "on" : "off";
-      doc["gpio"] = 2; /* GPIO del LED built-in en muchas placas ESP32 */
-      serializeJson(doc, s_json_buf, sizeof(s_json_buf));
+  return error;
+}
 
-      error = send_json_response(context, COAP_CODE_CONTENT, s_json_buf);
-    }
+/**
+ * @brief  Genera el documento de GET /info.
+ */
+static void render_info(DocWriter *writer)
+{
+  uint64_t uptime_us = (uint64_t)esp_timer_get_time();
+  uint32_t uptime_s = (uint32_t)(uptime_us / 1000000ULL);
+  uint32_t free_heap = esp_get_free_heap_size();
 
-    /* --- /counter : leer (e incrementar) el contador --- */
-    else if (!strcasecmp(uri, "/counter"))
-    {
-      s_counter++;
+  doc_begin_object(writer, 3);
+  doc_uint_member(writer, "uptime_s", uptime_s);
+  doc_uint_member(writer, "free_heap", free_heap);
+  doc_string_member(writer, "chip", "ESP32");
+  doc_end_object(writer);
+}
 
-      JsonDocument doc;
-      doc["count"] = s_counter;
-      serializeJson(doc, s_json_buf, sizeof(s_json_buf));
+/**
+ * @brief  Genera el documento de GET /led.
+ */
+static void render_led(DocWriter *writer)
+{
+  doc_begin_object(writer, 2);
+  doc_string_member(writer, "led", s_led_on ? "on" : "off");
+  doc_int_member(writer, "gpio", 2); /* GPIO del LED built-in en muchas placas ESP32 */
+  doc_end_object(writer);
+}
 
-      error = send_json_response(context, COAP_CODE_CONTENT, s_json_buf);
-    }
+/**
+ * @brief  Responde con el contador recién reiniciado ({"count":0,"reset":true}).
+ */
+static error_t send_counter_reset(CoapServerExchange *exchange, CoapCode code)
+{
+  error_t error;
+  DocWriter writer;
 
-    else
-    {
-      error = coapServerSetResponseCode(context, COAP_CODE_NOT_FOUND);
-    }
+  error = begin_doc_response(exchange, code, &writer);
+  if (!error)
+  {
+    doc_begin_object(&writer, 2);
+    doc_uint_member(&writer, "count", 0);
+    doc_bool_member(&writer, "reset", TRUE);
+    doc_end_object(&writer);
+    error = doc_flush(&writer);
   }
+  return error;
+}
+
+/* ========================================================================== */
+/*                        MANEJADORES DE RECURSOS CoAP                        */
+/* ========================================================================== */
+/**
+ * @brief  GET /test → texto plano "Hello World!".
+ */
+static error_t handle_test(CoapServerExchange *exchange,
+                           const CoapServerResource *resource, CoapCode method)
+{
+  error_t error;
+  const char_t msg[] = "Hello World! CoAP server running on ESP32.";
+
+  error = coapServerSetResponseCode(exchange, COAP_CODE_CONTENT);
+  if (!error)
+    error = coapServerSetUintOption(exchange, COAP_OPT_CONTENT_FORMAT,
+                                    0, COAP_CONTENT_FORMAT_TEXT_PLAIN);
+  if (!error)
+    error = coapServerSetPayload(exchange, msg, strlen(msg));
+  return error;
+}
 
-  /* ------------------------------------------------------------------ */
-  /*  PUT                                                                */
-  /* ------------------------------------------------------------------ */
-  else if (method == COAP_CODE_PUT)
+/**
+ * @brief  GET /info → uptime, heap libre y chip (JSON o CBOR).
+ */
+static error_t handle_info(CoapServerExchange *exchange,
+                           const CoapServerResource *resource, CoapCode method)
+{
+  /* Los datos cambian como mucho una vez por segundo: el segundo de
+     uptime hace de versión */
+  uint32_t version = (uint32_t)(esp_timer_get_time() / 1000000ULL);
+
+  return send_cached_doc(exchange, "/info", version, render_info);
+}
+
+/**
+ * @brief  Extrae el campo "state" del cuerpo de PUT /led.
+ * @param[in]  exchange Intercambio CoAP (petición/respuesta).
+ * @param[out] state    TRUE para "on", FALSE para "off".
+ * @return Código de respuesta CoAP: 2.04 si el cuerpo es válido, 4.00 si es
+ *         incorrecto o 4.15 si su Content-Format no es JSON ni CBOR.
+ */
+static CoapCode parse_led_state(CoapServerExchange *exchange, bool_t *state)
+{
+  error_t error;
+  const uint8_t *p;
+  size_t n;
+  uint32_t format;
+  /* Copia terminada en nulo del payload JSON recibido */
+  char json_buf[256];
+
+  error = coapServerGetUintOption(exchange, COAP_OPT_CONTENT_FORMAT, 0,
+                                  &format);
+  if (error)
+    format = COAP_CONTENT_FORMAT_APP_JSON;
+
+  error = coapServerGetPayload(exchange, &p, &n);
+  if (error || n == 0)
+    return COAP_CODE_BAD_REQUEST;
+
+  if (format == COAP_CONTENT_FORMAT_APP_CBOR)
   {
-    /* --- PUT /led : cambiar estado del LED --- */
-    if (!strcasecmp(uri, "/led"))
-    {
-      const uint8_t *p;
-      size_t n;
-      error = coapServerGetPayload(context, &p, &n);
+    /* El texto se compara en el propio payload, sin copiarlo */
+    CborReader reader;
+    CborItem item;
 
-      if (!error && n > 0 && n < sizeof(s_json_buf))
-      {
-        memcpy(s_json_buf, p, n);
-        s_json_buf[n] = '\0';
-
-        JsonDocument req;
-        DeserializationError de_err = deserializeJson(req, s_json_buf);
-
-        if (de_err == DeserializationError::Ok &&
-            req["state"].is<const char *>())
-        {
-          const char *state_str = req["state"];
-          bool changed = false;
-
-          if (!strcasecmp(state_str, "on") && !s_led_on)
-          {
-            s_led_on = true;
-            changed = true;
-            ESP_LOGI(TAG, "CoAP PUT /led → ON");
-          }
-          else if (!strcasecmp(state_str, "off") && s_led_on)
-          {
-            s_led_on = false;
-            changed = true;
-            ESP_LOGI(TAG, "CoAP PUT /led → OFF");
-          }
-
-          JsonDocument resp;
-          resp["led"] = s_led_on ? "on" : "off";
-          resp["changed"] = changed;
-          serializeJson(resp, s_json_buf, sizeof(s_json_buf));
-
-          error = send_json_response(context, COAP_CODE_CHANGED, s_json_buf);
-        }
-        else
-        {
-          /* JSON malformado o campo ausente */
-          const char bad[] = "{\"error\":\"campo state requerido: on|off\"}";
-          error = send_json_response(context, COAP_CODE_BAD_REQUEST, bad);
-        }
-      }
-      else
-      {
-        const char bad[] = "{\"error\":\"payload vacio o demasiado grande\"}";
-        error = send_json_response(context, COAP_CODE_BAD_REQUEST, bad);
-      }
-    }
+    cborReaderInit(&reader, p, n);
+    if (cborFindMapKey(&reader, "state", &item))
+      return COAP_CODE_BAD_REQUEST;
+    if (cborCompareText(&item, "on"))
+      *state = TRUE;
+    else if (cborCompareText(&item, "off"))
+      *state = FALSE;
     else
-    {
-      error = coapServerSetResponseCode(context, COAP_CODE_NOT_FOUND);
-    }
+      return COAP_CODE_BAD_REQUEST;
+    return COAP_CODE_CHANGED;
   }
 
-  /* ------------------------------------------------------------------ */
-  /*  POST                                                               */
-  /* ------------------------------------------------------------------ */
-  else if (method == COAP_CODE_POST)
-  {
-    /* --- POST /echo : devuelve el mismo payload --- */
-    if (!strcasecmp(uri, "/echo"))
-    {
-      const uint8_t *p;
-      size_t n;
-      uint32_t contentFormat;
-      bool_t contentFormatFound;
+  if (format != COAP_CONTENT_FORMAT_APP_JSON)
+    return COAP_CODE_UNSUPPORTED_CONTENT_FORMAT;
+  if (n >= sizeof(json_buf))
+    return COAP_CODE_BAD_REQUEST;
 
-      error = coapServerGetUintOption(context, COAP_OPT_CONTENT_FORMAT,
-                                      0, &contentFormat);
-      contentFormatFound = (error == NO_ERROR) ? TRUE : FALSE;
+  memcpy(json_buf, p, n);
+  json_buf[n] = '\0';
 
-      error = coapServerGetPayload(context, &p, &n);
-      if (!error)
-        error = coapServerSetResponseCode(context, COAP_CODE_CHANGED);
-      if (!error && contentFormatFound)
-        error = coapServerSetUintOption(context, COAP_OPT_CONTENT_FORMAT,
-                                        0, contentFormat);
-      if (!error)
-        error = coapServerSetPayload(context, p, n);
-    }
+  JsonDocument req;
+  DeserializationError de_err = deserializeJson(req, json_buf);
 
-    /* --- POST /counter/reset : reinicia el contador --- */
-    else if (!strcasecmp(uri, "/counter/reset"))
-    {
-      s_counter = 0;
-      ESP_LOGI(TAG, "CoAP POST /counter/reset → contador reiniciado");
+  if (de_err != DeserializationError::Ok || !req["state"].is<const char *>())
+    return COAP_CODE_BAD_REQUEST;
+
+  const char *state_str = req["state"];
+  if (!strcasecmp(state_str, "on"))
+    *state = TRUE;
+  else if (!strcasecmp(state_str, "off"))
+    *state = FALSE;
+  else
+    return COAP_CODE_BAD_REQUEST;
+  return COAP_CODE_CHANGED;
+}
 
-      const char resp[] = "{\"count\":0,\"reset\":true}";
-      error = send_json_response(context, COAP_CODE_CHANGED, resp);
+/**
+ * @brief  GET /led → estado del LED simulado.
+ *         PUT /led → modifica el estado (body {"state":"on"} en JSON o CBOR).
+ */
+static error_t handle_led(CoapServerExchange *exchange,
+                          const CoapServerResource *resource, CoapCode method)
+{
+  error_t error;
+  CoapCode code;
+  bool_t state;
+
+  if (method == COAP_CODE_GET)
+    return send_cached_doc(exchange, "/led", s_led_version, render_led);
+
+  code = parse_led_state(exchange, &state);
+
+  if (code == COAP_CODE_CHANGED)
+  {
+    bool changed = false;
+    bool led_on;
+
+    osAcquireMutex(&s_state_mutex);
+    if (state && !s_led_on)
+    {
+      s_led_on = true;
+      changed = true;
+      ESP_LOGI(TAG, "CoAP PUT /led → ON");
+    }
+    else if (!state && s_led_on)
+    {
+      s_led_on = false;
+      changed = true;
+      ESP_LOGI(TAG, "CoAP PUT /led → OFF");
     }
+    if (changed)
+      s_led_version++; /* Invalida la respuesta cacheada de GET /led */
+    led_on = s_led_on;
+    osReleaseMutex(&s_state_mutex);
 
-    else
+    if (changed)
+      coapServerNotify(exchange->context, resource);
+
+    DocWriter writer;
+    error = begin_doc_response(exchange, COAP_CODE_CHANGED, &writer);
+    if (!error)
     {
-      error = coapServerSetResponseCode(context, COAP_CODE_NOT_FOUND);
+      doc_begin_object(&writer, 2);
+      doc_string_member(&writer, "led", led_on ? "on" : "off");
+      doc_bool_member(&writer, "changed", changed);
+      doc_end_object(&writer);
+      error = doc_flush(&writer);
     }
   }
+  else if (code == COAP_CODE_UNSUPPORTED_CONTENT_FORMAT)
+  {
+    error = coapServerSetResponseCode(exchange, code);
+  }
+  else
+  {
+    /* Cuerpo vacío, demasiado grande, malformado o sin campo state */
+    const char bad[] = "{\"error\":\"campo state requerido: on|off\"}";
+    error = send_json_response(exchange, COAP_CODE_BAD_REQUEST, bad);
+  }
+
+  return error;
+}
 
-  /* ------------------------------------------------------------------ */
-  /*  DELETE                                                             */
-  /* ------------------------------------------------------------------ */
-  else if (method == COAP_CODE_DELETE)
+/**
+ * @brief  GET /counter    → valor del contador (auto-incrementa).
+ *         DELETE /counter → reinicia el contador a 0.
+ * @note   Las notificaciones Observe solo leen el valor: un reinicio se
+ *         notifica con count = 0 y no cuenta como lectura.
+ */
+static error_t handle_counter(CoapServerExchange *exchange,
+                              const CoapServerResource *resource, CoapCode method)
+{
+  error_t error;
+  uint32_t count;
+
+  if (method == COAP_CODE_DELETE)
   {
-    /* --- DELETE /counter : reinicia el contador (semántica de borrado) --- */
-    if (!strcasecmp(uri, "/counter"))
-    {
-      s_counter = 0;
-      ESP_LOGI(TAG, "CoAP DELETE /counter → contador reiniciado");
+    osAcquireMutex(&s_state_mutex);
+    s_counter = 0;
+    osReleaseMutex(&s_state_mutex);
+    ESP_LOGI(TAG, "CoAP DELETE /counter → contador reiniciado");
+    coapServerNotify(exchange->context, resource);
+
+    return send_counter_reset(exchange, COAP_CODE_DELETED);
+  }
+
+  osAcquireMutex(&s_state_mutex);
+  count = exchange->notification ? s_counter : ++s_counter;
+  osReleaseMutex(&s_state_mutex);
 
-      const char resp[] = "{\"count\":0,\"reset\":true}";
-      error = send_json_response(context, COAP_CODE_DELETED, resp);
+  DocWriter writer;
+  error = begin_doc_response(exchange, COAP_CODE_CONTENT, &writer);
+  if (!error)
+  {
+    doc_begin_object(&writer, 1);
+    doc_uint_member(&writer, "count", count);
+    doc_end_object(&writer);
+    error = doc_flush(&writer);
+  }
+  return error;
+}
+
+/**
+ * @brief  POST /counter/reset → reinicia el contador a 0.
+ */
+static error_t handle_counter_reset(CoapServerExchange *exchange,
+                                    const CoapServerResource *resource,
+                                    CoapCode method)
+{
+  osAcquireMutex(&s_state_mutex);
+  s_counter = 0;
+  osReleaseMutex(&s_state_mutex);
+  ESP_LOGI(TAG, "CoAP POST /counter/reset → contador reiniciado");
+  coapServerNotify(exchange->context,
+                   coapServerFindResource(exchange->context, "/counter"));
+
+  return send_counter_reset(exchange, COAP_CODE_CHANGED);
+}
+
+/**
+ * @brief  POST /echo → devuelve el mismo payload y Content-Format.
+ */
+static error_t handle_echo(CoapServerExchange *exchange,
+                           const CoapServerResource *resource, CoapCode method)
+{
+  error_t error;
+  const uint8_t *p;
+  size_t n;
+  uint32_t contentFormat;
+  bool_t contentFormatFound;
+
+  error = coapServerGetUintOption(exchange, COAP_OPT_CONTENT_FORMAT,
+                                  0, &contentFormat);
+  contentFormatFound = (error == NO_ERROR) ? TRUE : FALSE;
+
+  error = coapServerGetPayload(exchange, &p, &n);
+  if (!error)
+    error = coapServerSetResponseCode(exchange, COAP_CODE_CHANGED);
+  if (!error && contentFormatFound)
+    error = coapServerSetUintOption(exchange, COAP_OPT_CONTENT_FORMAT,
+                                    0, contentFormat);
+  if (!error)
+    error = coapServerSetPayload(exchange, p, n);
+  return error;
+}
+
+/**
+ * @brief  GET /www/index.html → página empaquetada en res[].
+ *
+ * La página ocupa varios KB: el servidor envía solo el bloque pedido
+ * (Block2) directamente desde la flash, sin copiarla entera.
+ */
+static error_t handle_page(CoapServerExchange *exchange,
+                           const CoapServerResource *resource, CoapCode method)
+{
+  error_t error;
+  const uint8_t *data;
+  size_t length;
+
+  error = resGetData(resource->path, &data, &length);
+  if (error)
+    return coapServerSetResponseCode(exchange, COAP_CODE_NOT_FOUND);
+
+  error = coapServerSetResponseCode(exchange, COAP_CODE_CONTENT);
+  if (!error)
+    error = coapServerSetUintOption(exchange, COAP_OPT_CONTENT_FORMAT,
+                                    0, COAP_CONTENT_FORMAT_TEXT_PLAIN);
+  if (!error)
+    error = coapServerSetBody(exchange, data, length);
+  return error;
+}
+
+/**
+ * @brief  Estado de una subida a PUT /upload.
+ *
+ * Los bloques de una subida pueden llegar a workers distintos y varias
+ * subidas avanzan a la vez, así que el estado va por cliente, con la misma
+ * clave que usa el servidor para sus transferencias Block1.
+ */
+typedef struct
+{
+  bool_t used;         /**< Subida en curso */
+  bool_t busy;         /**< Un worker está procesando uno de sus bloques */
+  IpAddr clientIpAddr; /**< Dirección del cliente */
+  uint16_t clientPort; /**< Puerto del cliente */
+  systime_t timestamp; /**< Último bloque recibido */
+  size_t size;         /**< Bytes recibidos */
+  uint32_t hash;       /**< FNV-1a de los bytes recibidos */
+} UploadState;
+
+/* Una subida por transferencia Block1 del servidor y otra para los cuerpos
+ * de un solo mensaje */
+#define APP_UPLOAD_SLOTS (COAP_SERVER_MAX_BLOCK_TRANSFERS + 1)
+
+static UploadState s_uploads[APP_UPLOAD_SLOTS];
+
+/**
+ * @brief  Reserva el estado de subida del cliente de la petición.
+ * @return Estado reservado, o NULL si todos están ocupados o si otro worker
+ *         procesa ya un bloque del mismo cliente.
+ * @note   Una subida abandonada se reutiliza cuando no queda ninguna libre:
+ *         se elige la que lleva más tiempo sin recibir bloques.
+ */
+static UploadState *upload_acquire(CoapServerExchange *exchange)
+{
+  UploadState *state = NULL;
+  UploadState *victim = NULL;
+
+  osAcquireMutex(&s_state_mutex);
+
+  for (uint_t i = 0; i < APP_UPLOAD_SLOTS && state == NULL; i++)
+  {
+    UploadState *entry = &s_uploads[i];
+
+    if (entry->used && entry->clientPort == exchange->clientPort &&
+        ipCompAddr(&entry->clientIpAddr, &exchange->clientIpAddr))
+    {
+      state = entry;
     }
-    else
+    else if (!entry->busy &&
+             (victim == NULL || !entry->used ||
+              (victim->used &&
+               timeCompare(entry->timestamp, victim->timestamp) < 0)))
     {
-      error = coapServerSetResponseCode(context, COAP_CODE_NOT_FOUND);
+      victim = entry;
     }
   }
 
-  else
+  if (state == NULL && victim != NULL)
+  {
+    state = victim;
+    state->used = TRUE;
+    state->clientIpAddr = exchange->clientIpAddr;
+    state->clientPort = exchange->clientPort;
+    state->size = 0;
+  }
+
+  if (state != NULL && state->busy)
+    state = NULL;
+
+  if (state != NULL)
   {
-    error = coapServerSetResponseCode(context, COAP_CODE_METHOD_NOT_ALLOWED);
+    state->busy = TRUE;
+    state->timestamp = osGetSystemTime();
   }
 
+  osReleaseMutex(&s_state_mutex);
+  return state;
+}
+
+/**
+ * @brief  Libera el estado reservado con upload_acquire().
+ * @param  done La subida ha terminado (cuerpo completo o error).
+ */
+static void upload_release(UploadState *state, bool_t done)
+{
+  osAcquireMutex(&s_state_mutex);
+  state->busy = FALSE;
+  if (done)
+    state->used = FALSE;
+  osReleaseMutex(&s_state_mutex);
+}
+
+/**
+ * @brief  Recibe cada bloque de PUT /upload (Block1) y calcula su FNV-1a,
+ *         sin guardar el cuerpo en memoria.
+ */
+static error_t upload_write(void *param, size_t offset, const uint8_t *data,
+                            size_t length, bool_t last)
+{
+  UploadState *state = (UploadState *)param;
+
+  if (offset == 0)
+  {
+    state->size = 0;
+    state->hash = 2166136261UL;
+  }
+  else if (offset != state->size)
+  {
+    /* El estado se reutilizó para otro cliente: la subida se aborta */
+    return ERROR_WRONG_STATE;
+  }
+  for (size_t i = 0; i < length; i++)
+  {
+    state->hash ^= data[i];
+    state->hash *= 16777619UL;
+  }
+  state->size += length;
+  return NO_ERROR;
+}
+
+/**
+ * @brief  PUT /upload → recibe un cuerpo de hasta 64 KB por bloques y
+ *         responde con su tamaño y su hash.
+ */
+static error_t handle_upload(CoapServerExchange *exchange,
+                             const CoapServerResource *resource, CoapCode method)
+{
+  error_t error;
+  bool_t complete;
+  UploadState *state;
+  size_t size;
+  char hash[9];
+
+  state = upload_acquire(exchange);
+  if (state == NULL)
+    return coapServerSetResponseCode(exchange, COAP_CODE_SERVICE_UNAVAILABLE);
+
+  error = coapServerReceiveBody(exchange, upload_write, state, 65536,
+                                &complete);
+  size = state->size;
+  snprintf(hash, sizeof(hash), "%08" PRIX32, state->hash);
+  upload_release(state, error || complete);
+
+  /* Bloque intermedio (2.31) o cuerpo rechazado: respuesta ya preparada */
+  if (error || !complete)
+    return error;
+
+  ESP_LOGI(TAG, "CoAP PUT /upload → %u bytes", (unsigned)size);
+
+  DocWriter writer;
+  error = begin_doc_response(exchange, COAP_CODE_CHANGED, &writer);
+  if (!error)
+  {
+    doc_begin_object(&writer, 2);
+    doc_uint_member(&writer, "size", (uint32_t)size);
+    doc_string_member(&writer, "fnv1a", hash);
+    doc_end_object(&writer);
+    error = doc_flush(&writer);
+  }
   return error;
 }
 
+/* ========================================================================== */
+/*                      IMPLEMENTACIÓN DE FUNCIONES                           */
+/* ========================================================================== */
+/**
+ * @brief Tabla de recursos del servidor CoAP.
+ *
+ * El servidor despacha por la ruta (tabla hash), responde 4.05 a los
+ * métodos no declarados y genera /.well-known/core (RFC 6690) a partir de
+ * los atributos rt/if/title/ct de cada entrada.
+ *
+ * Los recursos de datos responden en JSON o en CBOR (RFC 8949) según la
+ * opción Accept; sin ella responden en JSON.
+ *
+ * /info, /led y /counter admiten Observe (RFC 7641): cada notificación se
+ * genera una sola vez por formato con el mismo manejador que atiende GET, con
+ * exchange->notification activo para que /counter no la cuente como lectura.
+ *
+ * Los manejadores se ejecutan en el pool de workers del servidor, por lo que
+ * el estado compartido (LED, contador) se protege con s_state_mutex.
+ */
+static const CoapServerResource s_coap_resources[] = {
+    {"/test", COAP_SERVER_METHOD_GET, "demo", NULL, "Hello World",
+     1, {COAP_CONTENT_FORMAT_TEXT_PLAIN}, FALSE, handle_test, NULL},
+    {"/info", COAP_SERVER_METHOD_GET, "info", NULL, "Device info",
+     2, {COAP_CONTENT_FORMAT_APP_JSON, COAP_CONTENT_FORMAT_APP_CBOR}, TRUE,
+     handle_info, NULL},
+    {"/led", COAP_SERVER_METHOD_GET | COAP_SERVER_METHOD_PUT, "actuator", NULL,
+     "LED simulado (GET/PUT)",
+     2, {COAP_CONTENT_FORMAT_APP_JSON, COAP_CONTENT_FORMAT_APP_CBOR}, TRUE,
+     handle_led, NULL},
+    {"/counter", COAP_SERVER_METHOD_GET | COAP_SERVER_METHOD_DELETE, "sensor",
+     NULL, "Contador (GET/DELETE)",
+     2, {COAP_CONTENT_FORMAT_APP_JSON, COAP_CONTENT_FORMAT_APP_CBOR}, TRUE,
+     handle_counter, NULL},
+    {"/counter/reset", COAP_SERVER_METHOD_POST, "control", NULL,
+     "Reinicia contador (POST)",
+     2, {COAP_CONTENT_FORMAT_APP_JSON, COAP_CONTENT_FORMAT_APP_CBOR}, FALSE,
+     handle_counter_reset, NULL},
+    {"/www/index.html", COAP_SERVER_METHOD_GET, "page", NULL,
+     "Pagina empaquetada (Block2)", 1, {COAP_CONTENT_FORMAT_TEXT_PLAIN}, FALSE,
+     handle_page, NULL},
+    {"/upload", COAP_SERVER_METHOD_PUT, "upload", NULL,
+     "Subida por bloques (Block1)",
+     2, {COAP_CONTENT_FORMAT_APP_JSON, COAP_CONTENT_FORMAT_APP_CBOR}, FALSE,
+     handle_upload, NULL},
+    /* /echo devuelve el formato que reciba: no se anuncia ct */
+    {"/echo", COAP_SERVER_METHOD_POST, "debug", NULL, "Echo payload (POST)",
+     0, {0}, FALSE, handle_echo, NULL},
+};
+
+/**
+ * @brief Registra los recursos CoAP. Debe llamarse entre coapServerInit()
+ *        y coapServerStart().
+ * @return error_t
+ */
+static error_t init_coap_resources(void)
+{
+  return coapServerRegisterResources(&coapServerContext, s_coap_resources,
+                                     arraysize(s_coap_resources));
+}
+
 void dhcpClientStateChangeCallback(DhcpClientContext *context,
                                    NetInterface *interface, DhcpState state)
 {
@@ -460,4 +460,27 @@
 #define HTTP_SERVER_SSI_SUPPORT DISABLED
 #endif
 
+// CoAP over TCP support
+#if CONFIG_COAP_SERVER_TCP_SUPPORT
+#define COAP_SERVER_TCP_SUPPORT ENABLED
+#else
+#define COAP_SERVER_TCP_SUPPORT DISABLED
+#endif
+
+// CoAP multicast support
+#if CONFIG_COAP_SERVER_MULTICAST_SUPPORT
+#define COAP_SERVER_MULTICAST_SUPPORT ENABLED
+#else
+#define COAP_SERVER_MULTICAST_SUPPORT DISABLED
+#endif
+
+// Stack size of the CoAP worker tasks, in words
+#define COAP_SERVER_WORKER_STACK_SIZE CONFIG_COAP_SERVER_WORKER_STACK_SIZE
+
+// Number of simultaneous outstanding CoAP requests
+#define COAP_CLIENT_NSTART CONFIG_COAP_CLIENT_NSTART
+
+// Number of CoAP requests (outstanding or waiting to be sent)
+#define COAP_CLIENT_MAX_REQUESTS CONFIG_COAP_CLIENT_MAX_REQUESTS
+
 #endif
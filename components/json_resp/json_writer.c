@@ -0,0 +1,453 @@
+/**
+ * @file json_writer.c
+ * @brief Streaming JSON writer
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ * @section Description
+ *
+ * The writer serializes a JSON document as its members are produced.
+ * Output is staged in a small buffer and handed over to a user-supplied
+ * function (typically a chunked HTTP stream or a CoAP payload), so that
+ * the size of the document is not limited by the memory of the device
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+//Dependencies
+#include <stdio.h>
+#include <string.h>
+#include "json_writer.h"
+
+
+/**
+ * @brief Initialize a JSON writer
+ * @param[in] writer Pointer to the JSON writer context
+ * @param[in] callback Function that receives the serialized data
+ * @param[in] param User-defined parameter passed to the callback
+ **/
+
+void jsonWriterInit(JsonWriter *writer, JsonWriterCallback callback,
+   void *param)
+{
+   //Initialize context
+   writer->callback = callback;
+   writer->param = param;
+   writer->error = NO_ERROR;
+   writer->depth = 0;
+   writer->nonEmpty = 0;
+   writer->afterKey = FALSE;
+   writer->length = 0;
+}
+
+
+/**
+ * @brief Open an object
+ * @param[in] writer Pointer to the JSON writer context
+ **/
+
+void jsonWriterBeginObject(JsonWriter *writer)
+{
+   //Check nesting level
+   if(writer->depth >= JSON_WRITER_MAX_DEPTH)
+   {
+      writer->error = ERROR_OUT_OF_RESOURCES;
+   }
+   else
+   {
+      //Insert a separator if necessary
+      jsonWriterBeginValue(writer);
+      jsonWriterWrite(writer, "{", 1);
+
+      //The new object is empty
+      writer->depth++;
+      writer->nonEmpty &= ~(1U << (writer->depth - 1));
+   }
+}
+
+
+/**
+ * @brief Close the current object
+ * @param[in] writer Pointer to the JSON writer context
+ **/
+
+void jsonWriterEndObject(JsonWriter *writer)
+{
+   //Check nesting level
+   if(writer->depth == 0)
+   {
+      writer->error = ERROR_WRONG_STATE;
+   }
+   else
+   {
+      writer->depth--;
+      jsonWriterWrite(writer, "}", 1);
+   }
+}
+
+
+/**
+ * @brief Open an array
+ * @param[in] writer Pointer to the JSON writer context
+ **/
+
+void jsonWriterBeginArray(JsonWriter *writer)
+{
+   //Check nesting level
+   if(writer->depth >= JSON_WRITER_MAX_DEPTH)
+   {
+      writer->error = ERROR_OUT_OF_RESOURCES;
+   }
+   else
+   {
+      //Insert a separator if necessary
+      jsonWriterBeginValue(writer);
+      jsonWriterWrite(writer, "[", 1);
+
+      //The new array is empty
+      writer->depth++;
+      writer->nonEmpty &= ~(1U << (writer->depth - 1));
+   }
+}
+
+
+/**
+ * @brief Close the current array
+ * @param[in] writer Pointer to the JSON writer context
+ **/
+
+void jsonWriterEndArray(JsonWriter *writer)
+{
+   //Check nesting level
+   if(writer->depth == 0)
+   {
+      writer->error = ERROR_WRONG_STATE;
+   }
+   else
+   {
+      writer->depth--;
+      jsonWriterWrite(writer, "]", 1);
+   }
+}
+
+
+/**
+ * @brief Write the name of an object member
+ * @param[in] writer Pointer to the JSON writer context
+ * @param[in] name NULL-terminated string containing the member name
+ **/
+
+void jsonWriterKey(JsonWriter *writer, const char_t *name)
+{
+   //The name is written as a string, followed by a colon
+   jsonWriterString(writer, name);
+   jsonWriterWrite(writer, ":", 1);
+
+   //The next value belongs to this member
+   writer->afterKey = TRUE;
+}
+
+
+/**
+ * @brief Write a string value
+ * @param[in] writer Pointer to the JSON writer context
+ * @param[in] value NULL-terminated string (a NULL pointer is written as null)
+ **/
+
+void jsonWriterString(JsonWriter *writer, const char_t *value)
+{
+   size_t i;
+   size_t n;
+   char_t c;
+   char_t temp[8];
+
+   //Null pointer?
+   if(value == NULL)
+   {
+      jsonWriterNull(writer);
+      return;
+   }
+
+   //Insert a separator if necessary
+   jsonWriterBeginValue(writer);
+   jsonWriterWrite(writer, "\"", 1);
+
+   //Parse the string
+   for(i = 0, n = 0; value[i] != '\0'; i++)
+   {
+      //Get current character
+      c = value[i];
+
+      //Characters that must be escaped (RFC 8259, section 7)
+      if(c == '\"' || c == '\\' || (uint8_t) c < 0x20)
+      {
+         //Write the characters that precede the escape sequence
+         jsonWriterWrite(writer, value + n, i - n);
+         n = i + 1;
+
+         //Format the escape sequence
+         if(c == '\"')
+            osStrcpy(temp, "\\\"");
+         else if(c == '\\')
+            osStrcpy(temp, "\\\\");
+         else if(c == '\n')
+            osStrcpy(temp, "\\n");
+         else if(c == '\r')
+            osStrcpy(temp, "\\r");
+         else if(c == '\t')
+            osStrcpy(temp, "\\t");
+         else
+            osSprintf(temp, "\\u%04X", (uint8_t) c);
+
+         //Write the escape sequence
+         jsonWriterWrite(writer, temp, osStrlen(temp));
+      }
+   }
+
+   //Write the remaining characters
+   jsonWriterWrite(writer, value + n, i - n);
+   jsonWriterWrite(writer, "\"", 1);
+}
+
+
+/**
+ * @brief Write a signed integer value
+ * @param[in] writer Pointer to the JSON writer context
+ * @param[in] value Integer value
+ **/
+
+void jsonWriterInt(JsonWriter *writer, int32_t value)
+{
+   int_t n;
+   char_t temp[12];
+
+   //Insert a separator if necessary
+   jsonWriterBeginValue(writer);
+
+   //Format the number
+   n = osSprintf(temp, "%" PRId32, value);
+   jsonWriterWrite(writer, temp, n);
+}
+
+
+/**
+ * @brief Write an unsigned integer value
+ * @param[in] writer Pointer to the JSON writer context
+ * @param[in] value Integer value
+ **/
+
+void jsonWriterUint(JsonWriter *writer, uint32_t value)
+{
+   int_t n;
+   char_t temp[12];
+
+   //Insert a separator if necessary
+   jsonWriterBeginValue(writer);
+
+   //Format the number
+   n = osSprintf(temp, "%" PRIu32, value);
+   jsonWriterWrite(writer, temp, n);
+}
+
+
+/**
+ * @brief Write a boolean value
+ * @param[in] writer Pointer to the JSON writer context
+ * @param[in] value Boolean value
+ **/
+
+void jsonWriterBool(JsonWriter *writer, bool_t value)
+{
+   //Insert a separator if necessary
+   jsonWriterBeginValue(writer);
+
+   //Write literal name
+   if(value)
+      jsonWriterWrite(writer, "true", 4);
+   else
+      jsonWriterWrite(writer, "false", 5);
+}
+
+
+/**
+ * @brief Write a null value
+ * @param[in] writer Pointer to the JSON writer context
+ **/
+
+void jsonWriterNull(JsonWriter *writer)
+{
+   //Insert a separator if necessary
+   jsonWriterBeginValue(writer);
+   jsonWriterWrite(writer, "null", 4);
+}
+
+
+/**
+ * @brief Write an object member whose value is a string
+ * @param[in] writer Pointer to the JSON writer context
+ * @param[in] name Member name
+ * @param[in] value Member value
+ **/
+
+void jsonWriterStringMember(JsonWriter *writer, const char_t *name,
+   const char_t *value)
+{
+   jsonWriterKey(writer, name);
+   jsonWriterString(writer, value);
+}
+
+
+/**
+ * @brief Write an object member whose value is a signed integer
+ * @param[in] writer Pointer to the JSON writer context
+ * @param[in] name Member name
+ * @param[in] value Member value
+ **/
+
+void jsonWriterIntMember(JsonWriter *writer, const char_t *name,
+   int32_t value)
+{
+   jsonWriterKey(writer, name);
+   jsonWriterInt(writer, value);
+}
+
+
+/**
+ * @brief Write an object member whose value is an unsigned integer
+ * @param[in] writer Pointer to the JSON writer context
+ * @param[in] name Member name
+ * @param[in] value Member value
+ **/
+
+void jsonWriterUintMember(JsonWriter *writer, const char_t *name,
+   uint32_t value)
+{
+   jsonWriterKey(writer, name);
+   jsonWriterUint(writer, value);
+}
+
+
+/**
+ * @brief Write an object member whose value is a boolean
+ * @param[in] writer Pointer to the JSON writer context
+ * @param[in] name Member name
+ * @param[in] value Member value
+ **/
+
+void jsonWriterBoolMember(JsonWriter *writer, const char_t *name,
+   bool_t value)
+{
+   jsonWriterKey(writer, name);
+   jsonWriterBool(writer, value);
+}
+
+
+/**
+ * @brief Hand the buffered data over to the output function
+ * @param[in] writer Pointer to the JSON writer context
+ * @return Error code (first error encountered while serializing the document)
+ **/
+
+error_t jsonWriterFlush(JsonWriter *writer)
+{
+   //Any data pending?
+   if(!writer->error && writer->length > 0)
+   {
+      //Invoke the output function
+      writer->error = writer->callback(writer->param, writer->buffer,
+         writer->length);
+   }
+
+   //Flush the buffer
+   writer->length = 0;
+
+   //Return status code
+   return writer->error;
+}
+
+
+/**
+ * @brief Insert a separator before a value, if necessary
+ * @param[in] writer Pointer to the JSON writer context
+ **/
+
+void jsonWriterBeginValue(JsonWriter *writer)
+{
+   uint32_t mask;
+
+   //Value of an object member?
+   if(writer->afterKey)
+   {
+      //The separator precedes the member name
+      writer->afterKey = FALSE;
+   }
+   else if(writer->depth > 0)
+   {
+      //Point to the current nesting level
+      mask = 1U << (writer->depth - 1);
+
+      //Values are separated by commas
+      if((writer->nonEmpty & mask) != 0)
+         jsonWriterWrite(writer, ",", 1);
+
+      //The current object or array is no longer empty
+      writer->nonEmpty |= mask;
+   }
+   else
+   {
+      //Top-level value
+   }
+}
+
+
+/**
+ * @brief Append raw data to the output buffer
+ * @param[in] writer Pointer to the JSON writer context
+ * @param[in] data Data to be written
+ * @param[in] length Number of bytes to write
+ **/
+
+void jsonWriterWrite(JsonWriter *writer, const char_t *data, size_t length)
+{
+   size_t n;
+
+   //Process the data
+   while(!writer->error && length > 0)
+   {
+      //Flush the buffer when it is full
+      if(writer->length >= JSON_WRITER_BUFFER_SIZE)
+         jsonWriterFlush(writer);
+
+      //Limit the number of bytes to copy at a time
+      n = MIN(length, JSON_WRITER_BUFFER_SIZE - writer->length);
+
+      //Copy data to the buffer
+      osMemcpy(writer->buffer + writer->length, data, n);
+      writer->length += n;
+
+      //Advance data pointer
+      data += n;
+      length -= n;
+   }
+}
@@ -0,0 +1,130 @@
+/**
+ * @file json_writer.h
+ * @brief Streaming JSON writer
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+
+#ifndef _JSON_WRITER_H
+#define _JSON_WRITER_H
+
+//Dependencies
+#include "compiler_port.h"
+#include "os_port.h"
+#include "error.h"
+
+//Size of the buffer used to coalesce small writes
+#ifndef JSON_WRITER_BUFFER_SIZE
+   #define JSON_WRITER_BUFFER_SIZE 128
+#elif (JSON_WRITER_BUFFER_SIZE < 16)
+   #error JSON_WRITER_BUFFER_SIZE parameter is not valid
+#endif
+
+//Maximum nesting level of objects and arrays
+#ifndef JSON_WRITER_MAX_DEPTH
+   #define JSON_WRITER_MAX_DEPTH 8
+#elif (JSON_WRITER_MAX_DEPTH < 1 || JSON_WRITER_MAX_DEPTH > 32)
+   #error JSON_WRITER_MAX_DEPTH parameter is not valid
+#endif
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Output function
+ *
+ * Invoked each time the internal buffer is full, and once more when the
+ * document is flushed
+ *
+ **/
+
+typedef error_t (*JsonWriterCallback)(void *param, const void *data,
+   size_t length);
+
+
+/**
+ * @brief JSON writer context
+ *
+ * The writer does not allocate memory. Errors are sticky: once a write
+ * fails, subsequent calls do nothing and jsonWriterFlush() reports the
+ * first error
+ *
+ **/
+
+typedef struct
+{
+   JsonWriterCallback callback;            ///<Output function
+   void *param;                            ///<User-defined parameter
+   error_t error;                          ///<First error encountered
+   uint_t depth;                           ///<Current nesting level
+   uint32_t nonEmpty;                      ///<Nesting levels that already hold a value
+   bool_t afterKey;                        ///<A member name has just been written
+   size_t length;                          ///<Number of bytes in the buffer
+   char_t buffer[JSON_WRITER_BUFFER_SIZE]; ///<Output buffer
+} JsonWriter;
+
+
+//JSON writer related functions
+void jsonWriterInit(JsonWriter *writer, JsonWriterCallback callback,
+   void *param);
+
+void jsonWriterBeginObject(JsonWriter *writer);
+void jsonWriterEndObject(JsonWriter *writer);
+void jsonWriterBeginArray(JsonWriter *writer);
+void jsonWriterEndArray(JsonWriter *writer);
+
+void jsonWriterKey(JsonWriter *writer, const char_t *name);
+void jsonWriterString(JsonWriter *writer, const char_t *value);
+void jsonWriterInt(JsonWriter *writer, int32_t value);
+void jsonWriterUint(JsonWriter *writer, uint32_t value);
+void jsonWriterBool(JsonWriter *writer, bool_t value);
+void jsonWriterNull(JsonWriter *writer);
+
+void jsonWriterStringMember(JsonWriter *writer, const char_t *name,
+   const char_t *value);
+
+void jsonWriterIntMember(JsonWriter *writer, const char_t *name,
+   int32_t value);
+
+void jsonWriterUintMember(JsonWriter *writer, const char_t *name,
+   uint32_t value);
+
+void jsonWriterBoolMember(JsonWriter *writer, const char_t *name,
+   bool_t value);
+
+error_t jsonWriterFlush(JsonWriter *writer);
+
+void jsonWriterBeginValue(JsonWriter *writer);
+void jsonWriterWrite(JsonWriter *writer, const char_t *data, size_t length);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
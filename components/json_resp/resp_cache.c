@@ -0,0 +1,265 @@
+/**
+ * @file resp_cache.c
+ * @brief Cache of serialized dynamic responses
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ * @section Description
+ *
+ * Dynamic resources whose content changes rarely (configuration, status)
+ * can be served from this cache instead of being rebuilt on every request.
+ * A cached body is returned as long as the caller presents the same data
+ * version it was built from
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+//Dependencies
+#include <stdio.h>
+#include <string.h>
+#include "resp_cache.h"
+
+
+/**
+ * @brief Initialize the response cache
+ * @param[in] cache Pointer to the response cache
+ * @return Error code
+ **/
+
+error_t respCacheInit(RespCache *cache)
+{
+   //Check parameters
+   if(cache == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Clear the cache
+   osMemset(cache, 0, sizeof(RespCache));
+
+   //Create a mutex to prevent simultaneous access to the cache
+   if(!osCreateMutex(&cache->mutex))
+      return ERROR_OUT_OF_RESOURCES;
+
+   //Successful initialization
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Retrieve a cached response
+ * @param[in] cache Pointer to the response cache
+ * @param[in] uri URI of the resource
+ * @param[in] format Content format
+ * @param[in] version Current version of the underlying data
+ * @param[out] data Buffer where to copy the body
+ * @param[in] size Size of the buffer
+ * @param[out] length Length of the body
+ * @param[out] etag Entity tag of the body (RESP_CACHE_ETAG_SIZE bytes)
+ * @return Error code (ERROR_NOT_FOUND if no up-to-date response is cached)
+ **/
+
+error_t respCacheGet(RespCache *cache, const char_t *uri, uint_t format,
+   uint32_t version, void *data, size_t size, size_t *length, char_t *etag)
+{
+   error_t error;
+   RespCacheEntry *entry;
+
+   //Acquire exclusive access to the cache
+   osAcquireMutex(&cache->mutex);
+
+   //Search the cache for the specified resource
+   entry = respCacheFindEntry(cache, uri, format);
+
+   //Check whether the body was built from the current data
+   if(entry == NULL || entry->version != version)
+   {
+      error = ERROR_NOT_FOUND;
+   }
+   else if(entry->length > size)
+   {
+      error = ERROR_BUFFER_OVERFLOW;
+   }
+   else
+   {
+      //Copy the body
+      osMemcpy(data, entry->data, entry->length);
+      *length = entry->length;
+      osStrcpy(etag, entry->etag);
+
+      //Save the time of last use
+      entry->timestamp = osGetSystemTime();
+
+      //Successful processing
+      error = NO_ERROR;
+   }
+
+   //Release exclusive access to the cache
+   osReleaseMutex(&cache->mutex);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Save a response in the cache
+ * @param[in] cache Pointer to the response cache
+ * @param[in] uri URI of the resource
+ * @param[in] format Content format
+ * @param[in] version Version of the data the body was built from. It must
+ *   be read before building the body, so that a concurrent update is never
+ *   masked
+ * @param[in] data Body of the response
+ * @param[in] length Length of the body
+ * @param[out] etag Entity tag of the body (RESP_CACHE_ETAG_SIZE bytes). It
+ *   is computed even if the response cannot be cached
+ * @return Error code
+ **/
+
+error_t respCachePut(RespCache *cache, const char_t *uri, uint_t format,
+   uint32_t version, const void *data, size_t length, char_t *etag)
+{
+   uint_t i;
+   uint32_t h;
+   const uint8_t *p;
+   RespCacheEntry *entry;
+   RespCacheEntry *oldestEntry;
+
+   //Compute a FNV-1a hash of the body
+   for(p = (const uint8_t *) data, h = 2166136261U, i = 0; i < length; i++)
+   {
+      h = (h ^ p[i]) * 16777619U;
+   }
+
+   //The entity tag identifies the body itself, so that it remains valid
+   //across reboots and version number resets
+   osSprintf(etag, "\"%08" PRIX32 "\"", h);
+
+   //Make sure the response fits in a cache entry
+   if(osStrlen(uri) > RESP_CACHE_MAX_URI_LEN || length > RESP_CACHE_MAX_SIZE)
+      return ERROR_BUFFER_OVERFLOW;
+
+   //Acquire exclusive access to the cache
+   osAcquireMutex(&cache->mutex);
+
+   //Search the cache for the specified resource
+   entry = respCacheFindEntry(cache, uri, format);
+
+   //No matching entry?
+   if(entry == NULL)
+   {
+      //Keep track of the least recently used entry
+      oldestEntry = &cache->entries[0];
+
+      //Loop through the cache entries
+      for(i = 0; i < RESP_CACHE_MAX_ENTRIES; i++)
+      {
+         //Free entry?
+         if(!cache->entries[i].valid)
+         {
+            oldestEntry = &cache->entries[i];
+            break;
+         }
+
+         //Least recently used entry?
+         if(timeCompare(cache->entries[i].timestamp, oldestEntry->timestamp) < 0)
+            oldestEntry = &cache->entries[i];
+      }
+
+      //Reuse the selected entry
+      entry = oldestEntry;
+      osStrcpy(entry->uri, uri);
+      entry->format = format;
+   }
+
+   //Save the response
+   osMemcpy(entry->data, data, length);
+   entry->length = length;
+   entry->version = version;
+   osStrcpy(entry->etag, etag);
+   entry->timestamp = osGetSystemTime();
+   entry->valid = TRUE;
+
+   //Release exclusive access to the cache
+   osReleaseMutex(&cache->mutex);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Remove all entries from the cache
+ * @param[in] cache Pointer to the response cache
+ **/
+
+void respCacheFlush(RespCache *cache)
+{
+   uint_t i;
+
+   //Acquire exclusive access to the cache
+   osAcquireMutex(&cache->mutex);
+
+   //Loop through the cache entries
+   for(i = 0; i < RESP_CACHE_MAX_ENTRIES; i++)
+   {
+      //Invalidate the current entry
+      cache->entries[i].valid = FALSE;
+   }
+
+   //Release exclusive access to the cache
+   osReleaseMutex(&cache->mutex);
+}
+
+
+/**
+ * @brief Search the cache for a given resource
+ * @param[in] cache Pointer to the response cache
+ * @param[in] uri URI of the resource
+ * @param[in] format Content format
+ * @return Pointer to the matching entry, if any
+ **/
+
+RespCacheEntry *respCacheFindEntry(RespCache *cache, const char_t *uri,
+   uint_t format)
+{
+   uint_t i;
+   RespCacheEntry *entry;
+
+   //Loop through the cache entries
+   for(i = 0; i < RESP_CACHE_MAX_ENTRIES; i++)
+   {
+      //Point to the current entry
+      entry = &cache->entries[i];
+
+      //Matching entry?
+      if(entry->valid && entry->format == format &&
+         osStrcmp(entry->uri, uri) == 0)
+      {
+         return entry;
+      }
+   }
+
+   //No matching entry
+   return NULL;
+}
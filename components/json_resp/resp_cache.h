@@ -0,0 +1,120 @@
+/**
+ * @file resp_cache.h
+ * @brief Cache of serialized dynamic responses
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+
+#ifndef _RESP_CACHE_H
+#define _RESP_CACHE_H
+
+//Dependencies
+#include "compiler_port.h"
+#include "os_port.h"
+#include "error.h"
+
+//Number of entries in the response cache
+#ifndef RESP_CACHE_MAX_ENTRIES
+   #define RESP_CACHE_MAX_ENTRIES 4
+#elif (RESP_CACHE_MAX_ENTRIES < 1)
+   #error RESP_CACHE_MAX_ENTRIES parameter is not valid
+#endif
+
+//Maximum size of a cached response body
+#ifndef RESP_CACHE_MAX_SIZE
+   #define RESP_CACHE_MAX_SIZE 1024
+#elif (RESP_CACHE_MAX_SIZE < 16)
+   #error RESP_CACHE_MAX_SIZE parameter is not valid
+#endif
+
+//Maximum length of the URI used as a key
+#ifndef RESP_CACHE_MAX_URI_LEN
+   #define RESP_CACHE_MAX_URI_LEN 31
+#elif (RESP_CACHE_MAX_URI_LEN < 1)
+   #error RESP_CACHE_MAX_URI_LEN parameter is not valid
+#endif
+
+//Size of the buffer holding an entity tag (quoted, NULL-terminated)
+#define RESP_CACHE_ETAG_SIZE 11
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Response cache entry
+ **/
+
+typedef struct
+{
+   bool_t valid;                           ///<The entry holds a response
+   char_t uri[RESP_CACHE_MAX_URI_LEN + 1]; ///<URI of the resource
+   uint_t format;                          ///<Content format
+   uint32_t version;                       ///<Version of the data the body was built from
+   systime_t timestamp;                    ///<Time of last use
+   char_t etag[RESP_CACHE_ETAG_SIZE];      ///<Strong entity tag derived from the body
+   size_t length;                          ///<Length of the body
+   uint8_t data[RESP_CACHE_MAX_SIZE];      ///<Serialized body
+} RespCacheEntry;
+
+
+/**
+ * @brief Response cache
+ *
+ * Each entry is keyed by URI and content format and records the version
+ * of the underlying data. Producers bump their version number whenever the
+ * data changes, which invalidates every response built from older data
+ *
+ **/
+
+typedef struct
+{
+   OsMutex mutex;                                 ///<Mutex preventing simultaneous access to the cache
+   RespCacheEntry entries[RESP_CACHE_MAX_ENTRIES]; ///<Cache entries
+} RespCache;
+
+
+//Response cache related functions
+error_t respCacheInit(RespCache *cache);
+
+error_t respCacheGet(RespCache *cache, const char_t *uri, uint_t format,
+   uint32_t version, void *data, size_t size, size_t *length, char_t *etag);
+
+error_t respCachePut(RespCache *cache, const char_t *uri, uint_t format,
+   uint32_t version, const void *data, size_t length, char_t *etag);
+
+void respCacheFlush(RespCache *cache);
+
+RespCacheEntry *respCacheFindEntry(RespCache *cache, const char_t *uri,
+   uint_t format);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,346 @@
+/**
+ * @file coro_bench.cpp
+ * @brief Benchmark de host: sesiones TCP con corrutinas frente a una tarea
+ *        por conexión
+ *
+ * Sirve el protocolo de eco (RFC 862) de dos formas sobre los sockets en
+ * memoria de host/socket_host.c:
+ * - Corrutinas: echo_acceptor() y echo_session() sobre socket_coro.hpp y el
+ *   ejecutor real de core/socket_async.c (una sola tarea para todas las
+ *   conexiones).
+ * - Tarea por conexión: un aceptor bloqueante que crea una tarea con
+ *   socketReceive()/socketSend() bloqueantes por cliente.
+ *
+ * Para cada número de clientes concurrentes mide las idas y vueltas por
+ * segundo y estima la RAM de cada modelo en el ESP32: pila del ejecutor más
+ * un marco por corrutina, frente a una pila por tarea. Comprueba además que
+ * cada cliente recibe el último eco antes del fin de flujo, es decir, que el
+ * servidor cierra sin RST.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+// Marcos: el aceptor y hasta BENCH_MAX_CLIENTS sesiones simultáneas.
+// echo_session() pide 784 bytes en un host de 64 bits con -O2 (el tamaño
+// real se imprime al final)
+#define BENCH_MAX_CLIENTS 16
+#define SOCKET_CORO_FRAME_SIZE 832
+#define SOCKET_CORO_FRAME_COUNT (BENCH_MAX_CLIENTS + 1)
+#include "include/socket_coro.hpp"
+
+/* Puertos de los dos servidores de eco */
+#define BENCH_CORO_PORT 7
+#define BENCH_TASK_PORT 8
+/* Tiempo máximo de inactividad de una sesión de eco (ms) */
+#define APP_ECHO_IDLE_TIMEOUT 30000
+/* Idas y vueltas de cada medida, repartidas entre los clientes */
+#define BENCH_ROUND_TRIPS 40000
+/* Tamaño del mensaje de cada ida y vuelta */
+#define BENCH_MESSAGE_SIZE 32
+/* Pila de cada tarea de conexión (palabras), la de HTTP_SERVER_STACK_SIZE */
+#define BENCH_TASK_STACK_SIZE 650
+
+/* Último mensaje de cada cliente, enviado justo antes de su FIN */
+static const char s_last_message[] = "ultimo";
+
+/* ========================================================================== */
+/*                       SERVIDOR DE ECO CON CORRUTINAS                       */
+/* ========================================================================== */
+
+static net::Executor s_executor;
+static net::TcpServer s_echoServer(s_executor);
+static unsigned s_spawn_errors;
+
+/**
+ * @brief Sesión de eco: devuelve al cliente todo lo que recibe
+ * @note Se ejecuta en la tarea del ejecutor; cada co_await cede la tarea al
+ *       resto de sesiones mientras el socket no está listo
+ */
+static net::Task echo_session(net::TcpSocket sock) {
+  uint8_t buffer[64];
+
+  for (;;) {
+    net::IoResult rx =
+        co_await sock.recv(buffer, sizeof(buffer), 0, APP_ECHO_IDLE_TIMEOUT);
+    if (rx.error) {
+      break;
+    }
+    net::IoResult tx = co_await sock.send(buffer, rx.length, 0,
+                                          APP_ECHO_IDLE_TIMEOUT);
+    if (tx.error) {
+      break;
+    }
+  }
+
+  co_await sock.close();
+}
+
+/**
+ * @brief Acepta conexiones de eco y lanza una sesión por cliente
+ * @note Si el pool de marcos está agotado la conexión se cierra sin atender
+ */
+static net::Task echo_acceptor(void) {
+  for (;;) {
+    net::AcceptResult result = co_await s_echoServer.accept();
+    if (result.error) {
+      co_await s_executor.sleep(1000);
+    } else {
+      net::TcpSocket sock = s_echoServer.adopt(result);
+      if (s_executor.spawn(echo_session(sock))) {
+        s_spawn_errors++;
+        sock.abort();
+      }
+    }
+  }
+}
+
+static error_t start_coro_server(void) {
+  error_t error = s_executor.start();
+  if (!error) {
+    error = s_echoServer.listen(BENCH_CORO_PORT);
+  }
+  if (!error) {
+    error = s_executor.spawn(echo_acceptor());
+  }
+  return error;
+}
+
+/* ========================================================================== */
+/*                    SERVIDOR DE ECO CON TAREA POR CONEXIÓN                  */
+/* ========================================================================== */
+
+static Socket *s_task_listener;
+static unsigned s_task_errors;
+
+/**
+ * @brief Sesión de eco bloqueante: una tarea (y una pila) por cliente
+ */
+static void task_session(void *param) {
+  Socket *socket = static_cast<Socket *>(param);
+  uint8_t buffer[64];
+  size_t n;
+
+  socketSetTimeout(socket, APP_ECHO_IDLE_TIMEOUT);
+
+  while (!socketReceive(socket, buffer, sizeof(buffer), &n, 0)) {
+    if (socketSend(socket, buffer, n, NULL, 0)) {
+      break;
+    }
+  }
+
+  // Mismo cierre ordenado que TcpSocket::close()
+  socketShutdown(socket, SOCKET_SD_BOTH);
+  socketClose(socket);
+  osDeleteTask(OS_SELF_TASK_ID);
+}
+
+static void task_acceptor(void *) {
+  OsTaskParameters params = OS_TASK_DEFAULT_PARAMS;
+  params.stackSize = BENCH_TASK_STACK_SIZE;
+
+  for (;;) {
+    Socket *socket = socketAccept(s_task_listener, NULL, NULL);
+    if (socket == NULL) {
+      continue;
+    }
+    if (osCreateTask("Echo", task_session, socket, &params) ==
+        OS_INVALID_TASK_ID) {
+      s_task_errors++;
+      socketClose(socket);
+    }
+  }
+}
+
+static error_t start_task_server(void) {
+  error_t error = NO_ERROR;
+
+  s_task_listener = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+  if (s_task_listener == NULL) {
+    return ERROR_OPEN_FAILED;
+  }
+
+  error = socketBind(s_task_listener, &IP_ADDR_ANY, BENCH_TASK_PORT);
+  if (!error) {
+    error = socketListen(s_task_listener, 0);
+  }
+  if (!error &&
+      osCreateTask("Echo acceptor", task_acceptor, NULL,
+                   &OS_TASK_DEFAULT_PARAMS) == OS_INVALID_TASK_ID) {
+    error = ERROR_OUT_OF_RESOURCES;
+  }
+  return error;
+}
+
+/* ========================================================================== */
+/*                                 CLIENTES                                   */
+/* ========================================================================== */
+
+typedef struct {
+  uint16_t port;
+  unsigned roundTrips;
+  OsSemaphore *done;
+  bool ok;
+} BenchClient;
+
+/* Recibe exactamente length bytes */
+static error_t receive_all(Socket *socket, uint8_t *data, size_t length) {
+  size_t total = 0;
+
+  while (total < length) {
+    size_t n;
+    error_t error = socketReceive(socket, data + total, length - total, &n, 0);
+    if (error) {
+      return error;
+    }
+    total += n;
+  }
+  return NO_ERROR;
+}
+
+/**
+ * @brief Cliente de eco: idas y vueltas, último mensaje, FIN y espera del
+ *        fin de flujo
+ */
+static void client_task(void *param) {
+  BenchClient *client = static_cast<BenchClient *>(param);
+  uint8_t tx[BENCH_MESSAGE_SIZE];
+  uint8_t rx[BENCH_MESSAGE_SIZE];
+  Socket *socket;
+  size_t n;
+  error_t error;
+
+  client->ok = false;
+  memset(tx, 'x', sizeof(tx));
+
+  socket = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+  error = (socket != NULL) ? NO_ERROR : ERROR_OPEN_FAILED;
+
+  if (!error) {
+    socketSetTimeout(socket, 5000);
+    error = socketConnect(socket, &IP_ADDR_ANY, client->port);
+  }
+
+  for (unsigned i = 0; !error && i < client->roundTrips; i++) {
+    tx[0] = (uint8_t)i;
+    error = socketSend(socket, tx, sizeof(tx), NULL, 0);
+    if (!error) {
+      error = receive_all(socket, rx, sizeof(rx));
+    }
+    if (!error && memcmp(tx, rx, sizeof(tx)) != 0) {
+      error = ERROR_INVALID_MESSAGE;
+    }
+  }
+
+  // El último eco debe llegar antes del FIN del servidor, sin RST
+  if (!error) {
+    error = socketSend(socket, s_last_message, sizeof(s_last_message), NULL,
+                       0);
+  }
+  if (!error) {
+    error = socketShutdown(socket, SOCKET_SD_SEND);
+  }
+  if (!error) {
+    error = receive_all(socket, rx, sizeof(s_last_message));
+  }
+  if (!error && memcmp(rx, s_last_message, sizeof(s_last_message)) != 0) {
+    error = ERROR_INVALID_MESSAGE;
+  }
+  if (!error &&
+      socketReceive(socket, rx, sizeof(rx), &n, 0) == ERROR_END_OF_STREAM) {
+    client->ok = true;
+  }
+
+  if (socket != NULL) {
+    socketClose(socket);
+  }
+
+  osReleaseSemaphore(client->done);
+  osDeleteTask(OS_SELF_TASK_ID);
+}
+
+/**
+ * @brief Tiempo monotónico en segundos.
+ */
+static double now_s(void) {
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Lanza count clientes contra el puerto indicado
+ * @return Idas y vueltas por segundo, o un valor negativo si algún cliente
+ *         falla
+ */
+static double run_clients(uint16_t port, unsigned count) {
+  static BenchClient clients[BENCH_MAX_CLIENTS];
+  OsSemaphore done;
+  bool ok = true;
+  double t0, elapsed;
+
+  osCreateSemaphore(&done, 0);
+  t0 = now_s();
+
+  for (unsigned i = 0; i < count; i++) {
+    clients[i].port = port;
+    clients[i].roundTrips = BENCH_ROUND_TRIPS / count;
+    clients[i].done = &done;
+    osCreateTask("Client", client_task, &clients[i], &OS_TASK_DEFAULT_PARAMS);
+  }
+
+  for (unsigned i = 0; i < count; i++) {
+    osWaitForSemaphore(&done, INFINITE_DELAY);
+  }
+
+  elapsed = now_s() - t0;
+  osDeleteSemaphore(&done);
+
+  for (unsigned i = 0; i < count; i++) {
+    ok = ok && clients[i].ok;
+  }
+
+  return ok ? (BENCH_ROUND_TRIPS / count) * count / elapsed : -1.0;
+}
+
+int main(void) {
+  static const unsigned counts[] = {1, 4, 16};
+
+  if (start_coro_server() || start_task_server()) {
+    printf("No se pudieron arrancar los servidores de eco\n");
+    return 1;
+  }
+
+  printf("Eco de %d bytes, %d idas y vueltas por medida\n", BENCH_MESSAGE_SIZE,
+         BENCH_ROUND_TRIPS);
+
+  for (unsigned count : counts) {
+    double coro = run_clients(BENCH_CORO_PORT, count);
+    double task = run_clients(BENCH_TASK_PORT, count);
+
+    if (coro < 0 || task < 0 || s_spawn_errors || s_task_errors) {
+      printf("%2u clientes: último eco perdido o conexión fallida "
+             "(corrutinas %s, tareas %s)\n",
+             count, coro < 0 ? "FALLO" : "ok", task < 0 ? "FALLO" : "ok");
+      return 1;
+    }
+
+    // RAM en el ESP32: pilas en palabras de 4 bytes
+    unsigned coroRam = SOCKET_ASYNC_STACK_SIZE * 4 +
+                       (count + 1) * SOCKET_CORO_FRAME_SIZE;
+    unsigned taskRam = (count + 1) * BENCH_TASK_STACK_SIZE * 4;
+
+    printf("%2u clientes: corrutinas %.0f idas/s (%u B), "
+           "tarea por conexión %.0f idas/s (%u B)\n",
+           count, coro, coroRam, task, taskRam);
+  }
+
+  printf("Marcos de corrutina: %u en uso como máximo, el mayor de %u bytes\n",
+         (unsigned)net::FramePool::highWatermark(),
+         (unsigned)net::FramePool::largestFrame());
+
+  s_executor.stop();
+  return 0;
+}
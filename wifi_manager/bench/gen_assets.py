@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+# Árbol de recursos sintético para res_bench: el resultado típico de
+# compilar una aplicación web (index.html, 300 recursos repartidos en
+# subcarpetas con nombres con huella).
+#
+#   python3 gen_assets.py build/assets
+#
+# Crea <salida>/www/... y <salida>/paths.h con la lista de rutas.
+
+import hashlib
+import os
+import sys
+
+DIRS = [('assets/js', 'chunk', '.js', 180),
+        ('assets/css', 'style', '.css', 40),
+        ('assets/img', 'icon', '.svg', 60),
+        ('assets/fonts', 'font', '.woff2', 16),
+        ('locales', 'lang', '.json', 4)]
+
+
+def main():
+    out = sys.argv[1] if len(sys.argv) > 1 else 'build/assets'
+    paths = ['www/index.html']
+
+    for folder, stem, ext, count in DIRS:
+        for i in range(count):
+            tag = hashlib.sha256(f'{folder}{i}'.encode()).hexdigest()[:8]
+            paths.append(f'www/{folder}/{stem}-{i:03d}.{tag}{ext}')
+
+    for path in paths:
+        full = os.path.join(out, path)
+        os.makedirs(os.path.dirname(full), exist_ok=True)
+        with open(full, 'w', newline='\n') as f:
+            f.write(f'/* {path} */\n')
+
+    with open(os.path.join(out, 'paths.h'), 'w', newline='\n') as f:
+        f.write('/* Generado por gen_assets.py */\n')
+        f.write('static const char *const s_asset_paths[] = {\n')
+        for path in paths:
+            f.write(f'    "/{path}",\n')
+        f.write('};\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,242 @@
+/**
+ * @file header_bench.c
+ * @brief Benchmark de host: lectura de las cabeceras de petición HTTP
+ *
+ * Arranca el servidor HTTP real sobre los sockets en memoria y le envía, por
+ * una conexión persistente, peticiones con las cabeceras que manda un
+ * navegador (361 bytes, 9 campos), de cuatro en cuatro encadenadas.
+ *
+ * El Makefile lo compila dos veces:
+ * - header_bench: HTTP_SERVER_RX_BUFFER_SUPPORT habilitado, las cabeceras se
+ *   analizan desde el buffer de recepción de la conexión, llenado con
+ *   lecturas grandes del socket.
+ * - header_bench_norx: sin buffer, una lectura del socket (con su mutex) por
+ *   línea de cabecera, como antes de HTTP_SERVER_RX_BUFFER_SUPPORT.
+ *
+ * Cada lectura de host/socket_host.c toma un mutex global, igual que
+ * socketReceive() toma el de la pila TCP/IP en el ESP32.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "core/net.h"
+#include "http/http_server.h"
+
+/* Puerto del servidor HTTP */
+#define BENCH_HTTP_PORT 80
+/* Peticiones encadenadas en cada envío */
+#define BENCH_BATCH 4
+/* Envíos de cada medida */
+#define BENCH_BATCHES 20000
+
+/* Cuerpo de /api/status */
+static const char s_status_json[] = "{\"connected\":true,\"rssi\":-52}";
+
+/* Petición de la página a la API, con las cabeceras de un navegador */
+static const char s_request[] =
+    "GET /api/status HTTP/1.1\r\n"
+    "Host: 192.168.4.1\r\n"
+    "User-Agent: Mozilla/5.0 (X11; Linux x86_64; rv:128.0) Gecko/20100101 "
+    "Firefox/128.0\r\n"
+    "Accept: application/json, text/plain, */*\r\n"
+    "Accept-Language: es-ES,es;q=0.8,en-US;q=0.5,en;q=0.3\r\n"
+    "Accept-Encoding: gzip, deflate, br\r\n"
+    "Referer: http://192.168.4.1/\r\n"
+    "Connection: keep-alive\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Pragma: no-cache\r\n"
+    "\r\n";
+
+static HttpServerSettings s_settings;
+static HttpServerContext s_context;
+static HttpConnection s_connections[1];
+
+/* ========================================================================== */
+/*                                 SERVIDOR                                   */
+/* ========================================================================== */
+
+static error_t bench_request_callback(HttpConnection *connection,
+                                      const char_t *uri)
+{
+  error_t error;
+
+  connection->response.version = connection->request.version;
+
+  if (strcmp(uri, "/api/status") != 0)
+    return ERROR_NOT_FOUND;
+
+  connection->response.statusCode = 200;
+  connection->response.contentType = "application/json";
+  connection->response.chunkedEncoding = FALSE;
+  connection->response.contentLength = sizeof(s_status_json) - 1;
+
+  error = httpWriteHeader(connection);
+  if (!error)
+    error = httpWriteStream(connection, s_status_json,
+                            sizeof(s_status_json) - 1);
+  if (!error)
+    error = httpCloseStream(connection);
+
+  return error;
+}
+
+static error_t start_http_server(void)
+{
+  error_t error;
+
+  httpServerGetDefaultSettings(&s_settings);
+  s_settings.port = BENCH_HTTP_PORT;
+  s_settings.maxConnections = arraysize(s_connections);
+  s_settings.connections = s_connections;
+  s_settings.requestCallback = bench_request_callback;
+
+  error = httpServerInit(&s_context, &s_settings);
+  if (!error)
+    error = httpServerStart(&s_context);
+
+  return error;
+}
+
+/* ========================================================================== */
+/*                                  CLIENTE                                   */
+/* ========================================================================== */
+
+/**
+ * @brief Lee una respuesta con Content-Length y comprueba el estado 200
+ * @param[in,out] buffer Datos recibidos y aún no consumidos
+ * @param[in,out] length Longitud de esos datos
+ */
+static error_t read_response(Socket *socket, char *buffer, size_t *length)
+{
+  char *end;
+  char *field;
+  size_t total;
+  size_t n;
+  error_t error;
+
+  // Cabecera completa en el buffer
+  while ((end = strstr(buffer, "\r\n\r\n")) == NULL)
+  {
+    if (*length >= 1023)
+      return ERROR_BUFFER_OVERFLOW;
+
+    error = socketReceive(socket, buffer + *length, 1023 - *length, &n, 0);
+    if (error)
+      return error;
+
+    *length += n;
+    buffer[*length] = '\0';
+  }
+
+  field = strstr(buffer, "Content-Length: ");
+  if (strncmp(buffer, "HTTP/1.1 200 ", 13) != 0 || field == NULL ||
+      field > end || strstr(buffer, "Connection: close\r\n") != NULL)
+    return ERROR_UNEXPECTED_RESPONSE;
+
+  total = (size_t)(end + 4 - buffer) + strtoul(field + 16, NULL, 10);
+
+  // Cuerpo
+  while (*length < total)
+  {
+    error = socketReceive(socket, buffer + *length, 1023 - *length, &n, 0);
+    if (error)
+      return error;
+
+    *length += n;
+    buffer[*length] = '\0';
+  }
+
+  // Lo que sobra pertenece a la respuesta siguiente
+  *length -= total;
+  memmove(buffer, buffer + total, *length + 1);
+  return NO_ERROR;
+}
+
+/**
+ * @brief Tiempo monotónico en segundos.
+ */
+static double now_s(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+int main(void)
+{
+  static char batch[BENCH_BATCH * sizeof(s_request)];
+  static char buffer[1024];
+  size_t batchLength = 0;
+  size_t length = 0;
+  Socket *socket;
+  error_t error = NO_ERROR;
+  double t0, elapsed;
+  uint_t requests = 0;
+
+  if (resInit() || start_http_server())
+  {
+    printf("No se pudo arrancar el servidor HTTP\n");
+    return 1;
+  }
+
+  for (uint_t i = 0; i < BENCH_BATCH; i++)
+  {
+    memcpy(batch + batchLength, s_request, sizeof(s_request) - 1);
+    batchLength += sizeof(s_request) - 1;
+  }
+
+  socket = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+  if (socket == NULL)
+    return 1;
+
+  socketSetTimeout(socket, 5000);
+  t0 = now_s();
+
+  for (uint_t i = 0; !error && i < BENCH_BATCHES; i++)
+  {
+    // El servidor cierra con la respuesta HTTP_SERVER_MAX_REQUESTS
+    if (requests + BENCH_BATCH >= HTTP_SERVER_MAX_REQUESTS || i == 0)
+    {
+      if (i > 0)
+      {
+        socketShutdown(socket, SOCKET_SD_BOTH);
+        socketClose(socket);
+        socket = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+        socketSetTimeout(socket, 5000);
+      }
+      error = socketConnect(socket, &IP_ADDR_ANY, BENCH_HTTP_PORT);
+      requests = 0;
+      length = 0;
+      buffer[0] = '\0';
+    }
+
+    if (!error)
+      error = socketSend(socket, batch, batchLength, NULL, 0);
+
+    for (uint_t j = 0; !error && j < BENCH_BATCH; j++)
+      error = read_response(socket, buffer, &length);
+
+    requests += BENCH_BATCH;
+  }
+
+  elapsed = now_s() - t0;
+
+  if (error)
+  {
+    printf("Respuesta incorrecta o conexión fallida (error %d)\n", error);
+    return 1;
+  }
+
+  printf("Cabeceras de %u bytes, buffer de recepción %s: %.2f us por "
+         "petición\n",
+         (unsigned)sizeof(s_request) - 1,
+         HTTP_SERVER_RX_BUFFER_SUPPORT == ENABLED ? "habilitado" : "deshabilitado",
+         elapsed * 1e6 / (BENCH_BATCHES * BENCH_BATCH));
+
+  socketShutdown(socket, SOCKET_SD_BOTH);
+  socketClose(socket);
+  return 0;
+}
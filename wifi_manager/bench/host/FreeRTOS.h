@@ -0,0 +1,25 @@
+/**
+ * @file FreeRTOS.h
+ * @brief Tipos mínimos de FreeRTOS para compilar los benchmarks en el host
+ *
+ * Solo lo que necesita os_port_freertos.h para declarar sus tipos. Las
+ * funciones os*() se implementan con pthreads en os_port_host.c.
+ */
+
+#ifndef _BENCH_FREERTOS_H
+#define _BENCH_FREERTOS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint32_t TickType_t;
+typedef void *TaskHandle_t;
+typedef void *SemaphoreHandle_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define tskIDLE_PRIORITY 0
+#define portMAX_DELAY 0xFFFFFFFF
+#define configSUPPORT_STATIC_ALLOCATION 0
+
+#endif
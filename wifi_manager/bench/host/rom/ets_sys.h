@@ -0,0 +1,13 @@
+/**
+ * @file ets_sys.h
+ * @brief Las trazas de CycloneTCP salen por printf() en el host
+ */
+
+#ifndef _BENCH_ETS_SYS_H
+#define _BENCH_ETS_SYS_H
+
+#include <stdio.h>
+
+#define ets_printf printf
+
+#endif
@@ -0,0 +1,609 @@
+/**
+ * @file socket_host.c
+ * @brief Sockets TCP en memoria para los benchmarks de host
+ *
+ * Sustituye a core/socket.c con las funciones que usan socket_async.c, el
+ * servidor HTTP y los benchmarks. Cada conexión es un par de sockets de socketTable[] unidos
+ * entre sí: socketSend() copia los datos directamente en el buffer de
+ * recepción del otro extremo, y socketConnect() deja el socket del servidor
+ * en la cola de socketAccept() del socket en escucha.
+ *
+ * El cierre sigue la semántica de TCP que importa para el benchmark:
+ * - socketShutdown() entrega un FIN (fin de flujo) al otro extremo; con
+ *   SOCKET_SD_BOTH espera además el FIN del otro extremo.
+ * - socketClose() sin cierre ordenado previo equivale a un RST: el otro
+ *   extremo pierde los datos que aún no ha leído y recibe
+ *   ERROR_CONNECTION_RESET.
+ *
+ * Todo el estado se protege con un único mutex; socketPoll() espera en una
+ * variable de condición que también despierta osSetEvent(). socketReceive()
+ * admite SOCKET_FLAG_BREAK(), que copia byte a byte como tcpReceive(), y
+ * SOCKET_FLAG_WAIT_ALL.
+ */
+
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+#include "core/net.h"
+#include "core/socket.h"
+
+/* Capacidad del buffer de recepción de cada socket (ventana TCP) */
+#define HOST_SOCKET_BUFFER_SIZE 2048
+
+/* Estado de cada entrada de socketTable[] */
+typedef struct
+{
+  bool_t used;
+  Socket *peer;
+  uint8_t rxBuffer[HOST_SOCKET_BUFFER_SIZE];
+  size_t rxStart;
+  size_t rxLength;
+  bool_t rxShutdown;
+  bool_t txShutdown;
+  bool_t reset;
+  Socket *acceptQueue[SOCKET_MAX_COUNT];
+  uint_t acceptCount;
+} HostSocket;
+
+Socket socketTable[SOCKET_MAX_COUNT];
+const IpAddr IP_ADDR_ANY = {0};
+
+static HostSocket s_hosts[SOCKET_MAX_COUNT];
+static pthread_mutex_t s_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t s_cond = PTHREAD_COND_INITIALIZER;
+static uint16_t s_next_port = 49152;
+
+static HostSocket *host_of(Socket *socket)
+{
+  return &s_hosts[socket - socketTable];
+}
+
+/**
+ * @brief Despierta a los hilos bloqueados en socketPoll(), que también
+ *        espera el evento externo. Se llama desde osSetEvent().
+ */
+void hostSocketNotify(void)
+{
+  pthread_mutex_lock(&s_lock);
+  pthread_cond_broadcast(&s_cond);
+  pthread_mutex_unlock(&s_lock);
+}
+
+/* Plazo absoluto para pthread_cond_timedwait() */
+static void host_deadline(struct timespec *deadline, systime_t timeout)
+{
+  clock_gettime(CLOCK_REALTIME, deadline);
+  deadline->tv_sec += timeout / 1000;
+  deadline->tv_nsec += (long)(timeout % 1000) * 1000000L;
+  if (deadline->tv_nsec >= 1000000000L)
+  {
+    deadline->tv_sec++;
+    deadline->tv_nsec -= 1000000000L;
+  }
+}
+
+/* Espera un cambio de estado; FALSE si vence el plazo (s_lock tomado) */
+static bool_t host_wait(systime_t timeout, const struct timespec *deadline)
+{
+  if (timeout == 0)
+    return FALSE;
+  if (timeout == INFINITE_DELAY)
+    return pthread_cond_wait(&s_cond, &s_lock) == 0;
+  return pthread_cond_timedwait(&s_cond, &s_lock, deadline) == 0;
+}
+
+static Socket *host_alloc(uint_t type, uint_t protocol)
+{
+  uint_t i;
+
+  for (i = 0; i < SOCKET_MAX_COUNT; i++)
+  {
+    if (!s_hosts[i].used)
+    {
+      memset(&socketTable[i], 0, sizeof(Socket));
+      memset(&s_hosts[i], 0, sizeof(HostSocket));
+      s_hosts[i].used = TRUE;
+      socketTable[i].descriptor = i;
+      socketTable[i].type = type;
+      socketTable[i].protocol = protocol;
+      socketTable[i].timeout = INFINITE_DELAY;
+      socketTable[i].state = TCP_STATE_CLOSED;
+      return &socketTable[i];
+    }
+  }
+  return NULL;
+}
+
+/* Aplica el FIN recibido del otro extremo (s_lock tomado) */
+static void host_receive_fin(Socket *socket)
+{
+  host_of(socket)->rxShutdown = TRUE;
+  socket->state = (socket->state == TCP_STATE_FIN_WAIT_2)
+                      ? TCP_STATE_TIME_WAIT
+                      : TCP_STATE_CLOSE_WAIT;
+}
+
+Socket *socketOpen(uint_t type, uint_t protocol)
+{
+  Socket *socket;
+
+  if (type != SOCKET_TYPE_STREAM)
+    return NULL;
+
+  pthread_mutex_lock(&s_lock);
+  socket = host_alloc(type, protocol);
+  pthread_mutex_unlock(&s_lock);
+
+  return socket;
+}
+
+error_t socketSetTimeout(Socket *socket, systime_t timeout)
+{
+  if (socket == NULL)
+    return ERROR_INVALID_PARAMETER;
+
+  socket->timeout = timeout;
+  return NO_ERROR;
+}
+
+error_t socketSetInterface(Socket *socket, NetInterface *interface)
+{
+  // Una sola "interfaz": la memoria del proceso
+  (void)interface;
+
+  return (socket != NULL) ? NO_ERROR : ERROR_INVALID_PARAMETER;
+}
+
+error_t socketBind(Socket *socket, const IpAddr *localIpAddr,
+                   uint16_t localPort)
+{
+  if (socket == NULL || localIpAddr == NULL)
+    return ERROR_INVALID_PARAMETER;
+
+  socket->localIpAddr = *localIpAddr;
+  socket->localPort = localPort;
+  return NO_ERROR;
+}
+
+error_t socketListen(Socket *socket, uint_t backlog)
+{
+  (void)backlog;
+
+  if (socket == NULL)
+    return ERROR_INVALID_PARAMETER;
+
+  pthread_mutex_lock(&s_lock);
+  socket->state = TCP_STATE_LISTEN;
+  pthread_mutex_unlock(&s_lock);
+
+  return NO_ERROR;
+}
+
+error_t socketConnect(Socket *socket, const IpAddr *remoteIpAddr,
+                      uint16_t remotePort)
+{
+  Socket *listener = NULL;
+  Socket *server;
+  HostSocket *host;
+  uint_t i;
+
+  if (socket == NULL || remoteIpAddr == NULL)
+    return ERROR_INVALID_PARAMETER;
+
+  pthread_mutex_lock(&s_lock);
+
+  // Ya conectado (comprobación de un intento anterior)
+  if (host_of(socket)->peer != NULL)
+  {
+    pthread_mutex_unlock(&s_lock);
+    return NO_ERROR;
+  }
+
+  for (i = 0; i < SOCKET_MAX_COUNT; i++)
+  {
+    if (s_hosts[i].used && socketTable[i].state == TCP_STATE_LISTEN &&
+        socketTable[i].localPort == remotePort)
+    {
+      listener = &socketTable[i];
+      break;
+    }
+  }
+
+  if (listener == NULL)
+  {
+    pthread_mutex_unlock(&s_lock);
+    return ERROR_CONNECTION_FAILED;
+  }
+
+  server = host_alloc(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+  if (server == NULL)
+  {
+    pthread_mutex_unlock(&s_lock);
+    return ERROR_OUT_OF_RESOURCES;
+  }
+
+  // El handshake se completa al instante
+  socket->localPort = s_next_port++;
+  socket->remotePort = remotePort;
+  socket->state = TCP_STATE_ESTABLISHED;
+  server->localPort = remotePort;
+  server->remotePort = socket->localPort;
+  server->state = TCP_STATE_ESTABLISHED;
+  host_of(socket)->peer = server;
+  host_of(server)->peer = socket;
+
+  host = host_of(listener);
+  host->acceptQueue[host->acceptCount++] = server;
+
+  pthread_cond_broadcast(&s_cond);
+  pthread_mutex_unlock(&s_lock);
+
+  return NO_ERROR;
+}
+
+Socket *socketAccept(Socket *socket, IpAddr *clientIpAddr,
+                     uint16_t *clientPort)
+{
+  HostSocket *host;
+  Socket *client = NULL;
+  struct timespec deadline;
+
+  if (socket == NULL)
+    return NULL;
+
+  host_deadline(&deadline, socket->timeout);
+  host = host_of(socket);
+
+  pthread_mutex_lock(&s_lock);
+  while (host->acceptCount == 0)
+  {
+    if (!host_wait(socket->timeout, &deadline))
+      break;
+  }
+
+  if (host->acceptCount > 0)
+  {
+    client = host->acceptQueue[0];
+    host->acceptCount--;
+    memmove(&host->acceptQueue[0], &host->acceptQueue[1],
+            host->acceptCount * sizeof(Socket *));
+
+    if (clientIpAddr != NULL)
+      *clientIpAddr = IP_ADDR_ANY;
+    if (clientPort != NULL)
+      *clientPort = client->remotePort;
+  }
+  pthread_mutex_unlock(&s_lock);
+
+  return client;
+}
+
+error_t socketSend(Socket *socket, const void *data, size_t length,
+                   size_t *written, uint_t flags)
+{
+  const uint8_t *p = (const uint8_t *)data;
+  struct timespec deadline;
+  error_t error = NO_ERROR;
+  size_t total = 0;
+
+  (void)flags;
+
+  if (socket == NULL)
+    return ERROR_INVALID_PARAMETER;
+
+  host_deadline(&deadline, socket->timeout);
+
+  pthread_mutex_lock(&s_lock);
+  while (total < length)
+  {
+    HostSocket *host = host_of(socket);
+    HostSocket *peer;
+    size_t n, end;
+
+    if (host->reset)
+    {
+      error = ERROR_CONNECTION_RESET;
+      break;
+    }
+    if (host->txShutdown || host->peer == NULL)
+    {
+      error = ERROR_NOT_CONNECTED;
+      break;
+    }
+
+    // Copia en el buffer de recepción del otro extremo
+    peer = host_of(host->peer);
+    n = MIN(length - total, HOST_SOCKET_BUFFER_SIZE - peer->rxLength);
+    if (n == 0)
+    {
+      if (!host_wait(socket->timeout, &deadline))
+      {
+        error = ERROR_TIMEOUT;
+        break;
+      }
+      continue;
+    }
+
+    end = (peer->rxStart + peer->rxLength) % HOST_SOCKET_BUFFER_SIZE;
+    if (end + n <= HOST_SOCKET_BUFFER_SIZE)
+    {
+      memcpy(peer->rxBuffer + end, p + total, n);
+    }
+    else
+    {
+      size_t first = HOST_SOCKET_BUFFER_SIZE - end;
+      memcpy(peer->rxBuffer + end, p + total, first);
+      memcpy(peer->rxBuffer, p + total + first, n - first);
+    }
+    peer->rxLength += n;
+    total += n;
+    pthread_cond_broadcast(&s_cond);
+  }
+  pthread_mutex_unlock(&s_lock);
+
+  if (written != NULL)
+    *written = total;
+
+  return error;
+}
+
+error_t socketReceiveEx(Socket *socket, IpAddr *srcIpAddr, uint16_t *srcPort,
+                        IpAddr *destIpAddr, void *data, size_t size,
+                        size_t *received, uint_t flags)
+{
+  HostSocket *host;
+  struct timespec deadline;
+  error_t error = NO_ERROR;
+  size_t n = 0;
+
+  (void)srcIpAddr;
+  (void)srcPort;
+  (void)destIpAddr;
+
+  if (socket == NULL || data == NULL)
+    return ERROR_INVALID_PARAMETER;
+
+  host_deadline(&deadline, socket->timeout);
+  host = host_of(socket);
+
+  pthread_mutex_lock(&s_lock);
+  do
+  {
+    size_t m;
+
+    while (host->rxLength == 0 && !host->rxShutdown && !host->reset)
+    {
+      if (!host_wait(socket->timeout, &deadline))
+        break;
+    }
+
+    if (host->reset)
+    {
+      error = ERROR_CONNECTION_RESET;
+    }
+    else if (host->rxLength > 0)
+    {
+      uint8_t *p = (uint8_t *)data + n;
+      bool_t found = FALSE;
+
+      m = MIN(size - n, host->rxLength);
+
+      // Como tcpReceive(), copia byte a byte si hay carácter de corte
+      if ((flags & SOCKET_FLAG_BREAK_CHAR) != 0)
+      {
+        size_t i;
+
+        for (i = 0; i < m && !found; i++)
+        {
+          p[i] = host->rxBuffer[(host->rxStart + i) % HOST_SOCKET_BUFFER_SIZE];
+          found = (p[i] == LSB(flags)) ? TRUE : FALSE;
+        }
+        m = i;
+      }
+      else
+      {
+        size_t first = MIN(m, HOST_SOCKET_BUFFER_SIZE - host->rxStart);
+
+        memcpy(p, host->rxBuffer + host->rxStart, first);
+        memcpy(p + first, host->rxBuffer, m - first);
+      }
+
+      host->rxStart = (host->rxStart + m) % HOST_SOCKET_BUFFER_SIZE;
+      host->rxLength -= m;
+      n += m;
+      pthread_cond_broadcast(&s_cond);
+
+      // SOCKET_FLAG_WAIT_ALL: seguir hasta llenar el buffer
+      if (found || (flags & SOCKET_FLAG_WAIT_ALL) == 0)
+        break;
+    }
+    else if (n > 0)
+    {
+      // Fin de flujo o plazo vencido con datos ya copiados
+      break;
+    }
+    else if (host->rxShutdown)
+    {
+      error = ERROR_END_OF_STREAM;
+    }
+    else
+    {
+      error = ERROR_TIMEOUT;
+    }
+  } while (!error && n < size);
+  pthread_mutex_unlock(&s_lock);
+
+  if (received != NULL)
+    *received = n;
+
+  return error;
+}
+
+error_t socketReceive(Socket *socket, void *data, size_t size,
+                      size_t *received, uint_t flags)
+{
+  return socketReceiveEx(socket, NULL, NULL, NULL, data, size, received,
+                         flags);
+}
+
+error_t socketShutdown(Socket *socket, uint_t how)
+{
+  HostSocket *host;
+  struct timespec deadline;
+  error_t error = NO_ERROR;
+
+  if (socket == NULL)
+    return ERROR_INVALID_PARAMETER;
+
+  host_deadline(&deadline, socket->timeout);
+  host = host_of(socket);
+
+  pthread_mutex_lock(&s_lock);
+
+  // Envío del FIN (reconocido al instante)
+  if (how != SOCKET_SD_RECEIVE && !host->txShutdown && !host->reset)
+  {
+    host->txShutdown = TRUE;
+    socket->state = host->rxShutdown ? TCP_STATE_TIME_WAIT
+                                     : TCP_STATE_FIN_WAIT_2;
+    if (host->peer != NULL)
+      host_receive_fin(host->peer);
+    pthread_cond_broadcast(&s_cond);
+  }
+
+  // Espera del FIN del otro extremo
+  if (how != SOCKET_SD_SEND)
+  {
+    while (!host->rxShutdown && !host->reset)
+    {
+      if (!host_wait(socket->timeout, &deadline))
+        break;
+    }
+
+    if (host->reset)
+      error = ERROR_CONNECTION_RESET;
+    else if (!host->rxShutdown)
+      error = ERROR_TIMEOUT;
+  }
+
+  pthread_mutex_unlock(&s_lock);
+
+  return error;
+}
+
+void socketClose(Socket *socket)
+{
+  HostSocket *host;
+  uint_t i;
+
+  if (socket == NULL)
+    return;
+
+  pthread_mutex_lock(&s_lock);
+  host = host_of(socket);
+
+  if (host->peer != NULL)
+  {
+    HostSocket *peer = host_of(host->peer);
+
+    // Sin FIN previo, o con datos sin leer, el cierre es un RST
+    if (!host->txShutdown || host->rxLength > 0)
+    {
+      peer->reset = TRUE;
+      peer->rxStart = 0;
+      peer->rxLength = 0;
+    }
+    peer->peer = NULL;
+  }
+
+  // Conexiones pendientes de un socket en escucha
+  for (i = 0; i < host->acceptCount; i++)
+  {
+    HostSocket *pending = host_of(host->acceptQueue[i]);
+    if (pending->peer != NULL)
+      host_of(pending->peer)->reset = TRUE;
+    pending->used = FALSE;
+  }
+
+  host->used = FALSE;
+  socket->state = TCP_STATE_CLOSED;
+  pthread_cond_broadcast(&s_cond);
+  pthread_mutex_unlock(&s_lock);
+}
+
+/* Eventos activos de un socket (s_lock tomado) */
+static uint_t host_event_flags(Socket *socket)
+{
+  HostSocket *host = host_of(socket);
+  uint_t flags = 0;
+
+  if (host->acceptCount > 0)
+    flags |= SOCKET_EVENT_ACCEPT;
+  if (socket->state != TCP_STATE_CLOSED && socket->state != TCP_STATE_LISTEN)
+    flags |= SOCKET_EVENT_CONNECTED | SOCKET_EVENT_TX_DONE;
+  if (host->reset || (host->txShutdown && host->rxShutdown))
+    flags |= SOCKET_EVENT_CLOSED;
+
+  // socketSend() no bloquea: hay espacio o devolverá un error
+  if (host->reset || host->txShutdown || host->peer == NULL ||
+      host_of(host->peer)->rxLength < HOST_SOCKET_BUFFER_SIZE)
+    flags |= SOCKET_EVENT_TX_READY;
+  if (host->txShutdown)
+    flags |= SOCKET_EVENT_TX_SHUTDOWN;
+
+  if (host->rxLength > 0 || host->rxShutdown || host->reset)
+    flags |= SOCKET_EVENT_RX_READY;
+  if (host->rxShutdown || host->reset)
+    flags |= SOCKET_EVENT_RX_SHUTDOWN;
+
+  return flags;
+}
+
+error_t socketPoll(SocketEventDesc *eventDesc, uint_t size, OsEvent *extEvent,
+                   systime_t timeout)
+{
+  struct timespec deadline;
+  bool_t ready = FALSE;
+  uint_t i;
+
+  host_deadline(&deadline, timeout);
+
+  pthread_mutex_lock(&s_lock);
+  while (1)
+  {
+    for (i = 0; i < size; i++)
+    {
+      eventDesc[i].eventFlags =
+          host_event_flags(eventDesc[i].socket) & eventDesc[i].eventMask;
+      if (eventDesc[i].eventFlags != 0)
+        ready = TRUE;
+    }
+
+    // osSetEvent() despierta a este hilo a través de hostSocketNotify()
+    if (ready || (extEvent != NULL && osWaitForEvent(extEvent, 0)))
+    {
+      ready = TRUE;
+      break;
+    }
+
+    if (!host_wait(timeout, &deadline))
+      break;
+  }
+  pthread_mutex_unlock(&s_lock);
+
+  return ready ? NO_ERROR : ERROR_TIMEOUT;
+}
+
+/* Sustituye a core/ip.c para las trazas y el SSI del servidor HTTP */
+char_t *ipAddrToString(const IpAddr *ipAddr, char_t *str)
+{
+  static char_t buffer[40];
+
+  (void)ipAddr;
+
+  if (str == NULL)
+    str = buffer;
+
+  strcpy(str, "127.0.0.1");
+  return str;
+}
@@ -0,0 +1,4 @@
+/**
+ * @file task.h
+ * @brief Vacío: los tipos necesarios están en FreeRTOS.h
+ */
@@ -0,0 +1,407 @@
+/**
+ * @file http_bench.c
+ * @brief Benchmark de host: conexiones persistentes del servidor HTTP
+ *
+ * Arranca el servidor HTTP real (http_server.c, una tarea por conexión) sobre
+ * los sockets en memoria de host/socket_host.c, con la imagen de recursos del
+ * firmware (main/res.c), y carga la página como lo hace el navegador:
+ * index.html y cinco peticiones a la API. Mide tres modos:
+ * - Una conexión por petición (Connection: close).
+ * - Una conexión persistente, petición a petición (keep-alive).
+ * - Una conexión persistente con las seis peticiones encadenadas
+ *   (pipelining).
+ *
+ * Comprueba además que la respuesta número HTTP_SERVER_MAX_REQUESTS de una
+ * conexión lleva Connection: close y que el servidor cierra después. Un
+ * callback que copie request.keepAlive en response.keepAlive anula ese
+ * límite y hace fallar la comprobación.
+ *
+ * Los sockets en memoria no modelan el RTT del establecimiento TCP ni el
+ * arranque lento, así que en el host los tres modos cuestan parecido; en la
+ * red cada conexión nueva añade al menos un RTT.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "core/net.h"
+#include "http/http_server.h"
+
+/* Puerto del servidor HTTP */
+#define BENCH_HTTP_PORT 80
+/* Conexiones simultáneas, las de main.cpp en modo multitarea */
+#define BENCH_HTTP_MAX_CONNECTIONS 2
+/* Páginas cargadas en cada medida */
+#define BENCH_PAGE_LOADS 2000
+/* Peticiones de cada carga de página */
+#define BENCH_PAGE_REQUESTS 6
+/* Tamaño máximo de una respuesta */
+#define BENCH_RESPONSE_SIZE 32768
+
+/* Cuerpo de /api/status */
+static const char s_status_json[] =
+    "{\"connected\":true,\"ssid\":\"bench\",\"ip\":\"192.168.1.10\","
+    "\"rssi\":-52}";
+
+/* Peticiones de una carga de página */
+static const char *const s_page_uris[BENCH_PAGE_REQUESTS] = {
+    "/", "/api/status", "/api/status", "/api/status", "/api/status",
+    "/api/status"};
+
+static HttpServerSettings s_settings;
+static HttpServerContext s_context;
+static HttpConnection s_connections[BENCH_HTTP_MAX_CONNECTIONS];
+
+/* Respuesta recibida por el cliente */
+typedef struct
+{
+  char data[BENCH_RESPONSE_SIZE];
+  size_t length;
+  size_t headerLength;
+  uint_t statusCode;
+  bool_t close;
+} BenchResponse;
+
+/* ========================================================================== */
+/*                                 SERVIDOR                                   */
+/* ========================================================================== */
+
+/**
+ * @brief Igual que httpServerRequestCallback() en main.cpp: solo copia la
+ *        versión y deja la persistencia a httpInitResponseHeader()
+ */
+static error_t bench_request_callback(HttpConnection *connection,
+                                      const char_t *uri)
+{
+  error_t error;
+
+  connection->response.version = connection->request.version;
+
+  if (strcmp(uri, "/api/status") != 0)
+    return ERROR_NOT_FOUND;
+
+  connection->response.statusCode = 200;
+  connection->response.contentType = "application/json";
+  connection->response.chunkedEncoding = FALSE;
+  connection->response.contentLength = sizeof(s_status_json) - 1;
+
+  error = httpWriteHeader(connection);
+  if (!error)
+    error = httpWriteStream(connection, s_status_json,
+                            sizeof(s_status_json) - 1);
+  if (!error)
+    error = httpCloseStream(connection);
+
+  return error;
+}
+
+static error_t bench_uri_not_found_callback(HttpConnection *connection,
+                                            const char_t *uri)
+{
+  return ERROR_NOT_FOUND;
+}
+
+static error_t start_http_server(void)
+{
+  error_t error;
+
+  httpServerGetDefaultSettings(&s_settings);
+  s_settings.port = BENCH_HTTP_PORT;
+  s_settings.maxConnections = BENCH_HTTP_MAX_CONNECTIONS;
+  s_settings.connections = s_connections;
+  strcpy(s_settings.rootDirectory, "/www/");
+  strcpy(s_settings.defaultDocument, "index.html");
+  s_settings.requestCallback = bench_request_callback;
+  s_settings.uriNotFoundCallback = bench_uri_not_found_callback;
+
+  error = httpServerInit(&s_context, &s_settings);
+  if (!error)
+    error = httpServerStart(&s_context);
+
+  return error;
+}
+
+/* ========================================================================== */
+/*                                  CLIENTE                                   */
+/* ========================================================================== */
+
+static Socket *client_connect(void)
+{
+  Socket *socket = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+
+  if (socket != NULL)
+  {
+    socketSetTimeout(socket, 5000);
+    if (socketConnect(socket, &IP_ADDR_ANY, BENCH_HTTP_PORT))
+    {
+      socketClose(socket);
+      socket = NULL;
+    }
+  }
+  return socket;
+}
+
+/* Formatea una petición GET y devuelve su longitud */
+static size_t format_request(char *buffer, const char *uri, bool_t keepAlive)
+{
+  return (size_t)sprintf(buffer,
+                         "GET %s HTTP/1.1\r\n"
+                         "Host: 192.168.4.1\r\n"
+                         "Connection: %s\r\n"
+                         "\r\n",
+                         uri, keepAlive ? "keep-alive" : "close");
+}
+
+/**
+ * @brief Lee una respuesta completa: la cabecera y, según ella,
+ *        Content-Length bytes o hasta el fin de flujo
+ */
+static error_t read_response(Socket *socket, BenchResponse *response)
+{
+  char *end;
+  char *field;
+  size_t total;
+  size_t n;
+  error_t error;
+
+  response->length = 0;
+  response->headerLength = 0;
+
+  // Cabecera: se lee byte a byte para no consumir la respuesta siguiente
+  while (response->headerLength == 0)
+  {
+    if (response->length >= sizeof(response->data) - 1)
+      return ERROR_BUFFER_OVERFLOW;
+
+    error = socketReceive(socket, response->data + response->length, 1, &n,
+                          0);
+    if (error)
+      return error;
+
+    response->length++;
+    response->data[response->length] = '\0';
+
+    if (response->length >= 4 &&
+        !memcmp(response->data + response->length - 4, "\r\n\r\n", 4))
+      response->headerLength = response->length;
+  }
+
+  response->statusCode = (uint_t)strtoul(response->data + 9, NULL, 10);
+  response->close = strstr(response->data, "Connection: close\r\n") != NULL;
+  field = strstr(response->data, "Content-Length: ");
+
+  if (field != NULL)
+  {
+    total = response->headerLength + strtoul(field + 16, &end, 10);
+    if (total > sizeof(response->data))
+      return ERROR_BUFFER_OVERFLOW;
+
+    while (response->length < total)
+    {
+      error = socketReceive(socket, response->data + response->length,
+                            total - response->length, &n, 0);
+      if (error)
+        return error;
+      response->length += n;
+    }
+  }
+  else if (response->close)
+  {
+    // Sin Content-Length el cuerpo termina con la conexión
+    while (!socketReceive(socket, response->data + response->length,
+                          sizeof(response->data) - response->length, &n, 0))
+    {
+      response->length += n;
+    }
+  }
+  else
+  {
+    return ERROR_INVALID_SYNTAX;
+  }
+
+  return (response->statusCode == 200) ? NO_ERROR : ERROR_UNEXPECTED_RESPONSE;
+}
+
+/* Espera el fin de flujo tras una respuesta con Connection: close */
+static error_t wait_end_of_stream(Socket *socket)
+{
+  char c;
+  size_t n;
+
+  if (socketReceive(socket, &c, 1, &n, 0) != ERROR_END_OF_STREAM)
+    return ERROR_INVALID_SYNTAX;
+
+  return NO_ERROR;
+}
+
+/* Cierre ordenado del lado del cliente */
+static void client_close(Socket *socket)
+{
+  socketShutdown(socket, SOCKET_SD_BOTH);
+  socketClose(socket);
+}
+
+/**
+ * @brief Carga de página con una conexión por petición
+ */
+static error_t load_page_close(BenchResponse *response)
+{
+  char request[128];
+  error_t error = NO_ERROR;
+
+  for (uint_t i = 0; !error && i < BENCH_PAGE_REQUESTS; i++)
+  {
+    Socket *socket = client_connect();
+    size_t length = format_request(request, s_page_uris[i], FALSE);
+
+    if (socket == NULL)
+      return ERROR_CONNECTION_FAILED;
+
+    error = socketSend(socket, request, length, NULL, 0);
+    if (!error)
+      error = read_response(socket, response);
+    if (!error && !response->close)
+      error = ERROR_INVALID_SYNTAX;
+
+    client_close(socket);
+  }
+
+  return error;
+}
+
+/**
+ * @brief Carga de página sobre una conexión persistente
+ * @param[in] pipelined Envía todas las peticiones antes de leer respuestas
+ */
+static error_t load_page_keep_alive(BenchResponse *response,
+                                    bool_t pipelined)
+{
+  char request[BENCH_PAGE_REQUESTS * 128];
+  size_t length = 0;
+  error_t error = NO_ERROR;
+  Socket *socket = client_connect();
+
+  if (socket == NULL)
+    return ERROR_CONNECTION_FAILED;
+
+  if (pipelined)
+  {
+    for (uint_t i = 0; i < BENCH_PAGE_REQUESTS; i++)
+      length += format_request(request + length, s_page_uris[i], TRUE);
+
+    error = socketSend(socket, request, length, NULL, 0);
+  }
+
+  for (uint_t i = 0; !error && i < BENCH_PAGE_REQUESTS; i++)
+  {
+    if (!pipelined)
+    {
+      length = format_request(request, s_page_uris[i], TRUE);
+      error = socketSend(socket, request, length, NULL, 0);
+    }
+    if (!error)
+      error = read_response(socket, response);
+    if (!error && response->close)
+      error = ERROR_INVALID_SYNTAX;
+  }
+
+  client_close(socket);
+  return error;
+}
+
+/**
+ * @brief Agota una conexión persistente: la respuesta número
+ *        HTTP_SERVER_MAX_REQUESTS debe cerrar la conexión
+ */
+static error_t check_max_requests(BenchResponse *response)
+{
+  char request[128];
+  size_t length = format_request(request, "/api/status", TRUE);
+  error_t error = NO_ERROR;
+  Socket *socket = client_connect();
+
+  if (socket == NULL)
+    return ERROR_CONNECTION_FAILED;
+
+  for (uint_t i = 1; !error && i <= HTTP_SERVER_MAX_REQUESTS; i++)
+  {
+    error = socketSend(socket, request, length, NULL, 0);
+    if (!error)
+      error = read_response(socket, response);
+    // Solo la última respuesta anuncia el cierre
+    if (!error && response->close != (i == HTTP_SERVER_MAX_REQUESTS))
+      error = ERROR_INVALID_SYNTAX;
+  }
+
+  if (!error)
+    error = wait_end_of_stream(socket);
+
+  client_close(socket);
+  return error;
+}
+
+/**
+ * @brief Tiempo monotónico en segundos.
+ */
+static double now_s(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+int main(void)
+{
+  static const char *const names[] = {"Connection: close", "keep-alive",
+                                      "pipelining"};
+  static BenchResponse response;
+  error_t error;
+  double t0, elapsed;
+
+  if (resInit() || start_http_server())
+  {
+    printf("No se pudo arrancar el servidor HTTP\n");
+    return 1;
+  }
+
+  error = check_max_requests(&response);
+  if (error)
+  {
+    printf("La respuesta %d de una conexión no la cierra (error %d)\n",
+           HTTP_SERVER_MAX_REQUESTS, error);
+    return 1;
+  }
+  printf("Respuesta %d de una conexión: Connection: close\n",
+         HTTP_SERVER_MAX_REQUESTS);
+
+  printf("Carga de página: %d peticiones, %d cargas por medida\n",
+         BENCH_PAGE_REQUESTS, BENCH_PAGE_LOADS);
+
+  for (uint_t mode = 0; mode < arraysize(names); mode++)
+  {
+    t0 = now_s();
+
+    for (uint_t i = 0; i < BENCH_PAGE_LOADS; i++)
+    {
+      if (mode == 0)
+        error = load_page_close(&response);
+      else
+        error = load_page_keep_alive(&response, mode == 2);
+
+      if (error)
+      {
+        printf("%s: error %d en la carga %u\n", names[mode], error, i);
+        return 1;
+      }
+    }
+
+    elapsed = now_s() - t0;
+    printf("%-18s %7.1f us por página, %6.0f peticiones/s\n", names[mode],
+           elapsed * 1e6 / BENCH_PAGE_LOADS,
+           BENCH_PAGE_LOADS * BENCH_PAGE_REQUESTS / elapsed);
+  }
+
+  return 0;
+}
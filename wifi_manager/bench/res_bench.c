@@ -0,0 +1,141 @@
+/**
+ * @file res_bench.c
+ * @brief Benchmark de host: búsqueda de recursos con y sin índice de rutas
+ *
+ * gen_assets.py crea un árbol de 301 recursos y pack.py lo empaqueta dos
+ * veces: con el índice .resindex (res_bench) y con --no-index (res_bench_walk),
+ * que resource_manager.c resuelve recorriendo los directorios como antes.
+ *
+ * Mide resGetData() y resSearchFile() para todas las rutas del árbol y para
+ * las mismas rutas con una extensión que no existe (las búsquedas fallidas
+ * del servidor). Antes de medir comprueba que cada ruta se encuentra con el
+ * tamaño que tiene en la imagen y que las inexistentes no.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "core/net.h"
+#include "resource_manager.h"
+#include "paths.h"
+
+/* Vueltas a la lista de rutas de cada medida */
+#define BENCH_ROUNDS 2000
+
+/* Rutas inexistentes: la ruta de un recurso más esta extensión */
+static char s_missing_paths[arraysize(s_asset_paths)][128];
+
+/**
+ * @brief Tiempo monotónico en nanosegundos.
+ */
+static double now_ns(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+/**
+ * @brief Comprueba las búsquedas de todas las rutas
+ * @return Número de discrepancias
+ */
+static int check_lookups(void)
+{
+  const uint8_t *data;
+  size_t length;
+  DirEntry entry;
+  int bad = 0;
+  size_t i;
+
+  for (i = 0; i < arraysize(s_asset_paths); i++)
+  {
+    if (resGetData(s_asset_paths[i], &data, &length) ||
+        resSearchFile(s_asset_paths[i], &entry) ||
+        entry.dataLength != length)
+    {
+      printf("No se encuentra %s\n", s_asset_paths[i]);
+      bad++;
+    }
+
+    if (!resGetData(s_missing_paths[i], &data, &length) ||
+        !resSearchFile(s_missing_paths[i], &entry))
+    {
+      printf("Se encuentra %s\n", s_missing_paths[i]);
+      bad++;
+    }
+  }
+
+  return bad;
+}
+
+/**
+ * @brief Tiempo medio de búsqueda de una lista de rutas
+ * @param[in] searchFile Usa resSearchFile() en lugar de resGetData()
+ */
+static double time_lookups(const char *const *paths, bool_t searchFile)
+{
+  volatile size_t sink = 0;
+  const uint8_t *data;
+  size_t length;
+  DirEntry entry;
+  double t0;
+  int round;
+  size_t i;
+
+  t0 = now_ns();
+  for (round = 0; round < BENCH_ROUNDS; round++)
+  {
+    for (i = 0; i < arraysize(s_asset_paths); i++)
+    {
+      if (searchFile)
+      {
+        if (!resSearchFile(paths[i], &entry))
+          sink += entry.dataLength;
+      }
+      else
+      {
+        if (!resGetData(paths[i], &data, &length))
+          sink += length;
+      }
+    }
+  }
+
+  return (now_ns() - t0) / (BENCH_ROUNDS * arraysize(s_asset_paths));
+}
+
+int main(void)
+{
+  static const char *missing[arraysize(s_asset_paths)];
+  size_t i;
+  int bad;
+
+  for (i = 0; i < arraysize(s_asset_paths); i++)
+  {
+    snprintf(s_missing_paths[i], sizeof(s_missing_paths[i]), "%s.map",
+             s_asset_paths[i]);
+    missing[i] = s_missing_paths[i];
+  }
+
+  if (resInit())
+  {
+    printf("Imagen de recursos no válida\n");
+    return 1;
+  }
+
+  bad = check_lookups();
+  if (bad)
+  {
+    printf("Comprobación: %d discrepancias\n", bad);
+    return 1;
+  }
+
+  printf("%u recursos, %s: resGetData %.0f ns (existe) / %.0f ns (no existe), "
+         "resSearchFile %.0f ns (existe)\n",
+         (unsigned)arraysize(s_asset_paths), BENCH_IMAGE,
+         time_lookups(s_asset_paths, FALSE),
+         time_lookups(missing, FALSE),
+         time_lookups(s_asset_paths, TRUE));
+
+  return 0;
+}
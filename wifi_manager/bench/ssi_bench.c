@@ -0,0 +1,307 @@
+/**
+ * @file ssi_bench.c
+ * @brief Benchmark de host: plantillas SSI compiladas frente a releídas
+ *
+ * Arranca el servidor HTTP real sobre los sockets en memoria con la imagen
+ * de ssi/www: status.shtm, una página de estado de 2,3 KB con doce
+ * directivas exec y un include de header.html. Un cliente la pide una y otra
+ * vez por una conexión persistente y lee la respuesta fragmentada entera.
+ *
+ * El Makefile lo compila dos veces:
+ * - ssi_bench: HTTP_SERVER_SSI_CACHE_SIZE por defecto, la página se compila
+ *   en segmentos la primera vez y las siguientes solo se recorren.
+ * - ssi_bench_nocache: HTTP_SERVER_SSI_CACHE_SIZE = 0, la página se busca
+ *   byte a byte con ssiSearchTag() en cada petición, como antes de la caché.
+ *
+ * Antes de medir comprueba que el cuerpo no conserva ninguna directiva y que
+ * lleva los valores del callback CGI y el contenido de header.html.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "core/net.h"
+#include "http/http_server.h"
+
+/* Puerto del servidor HTTP */
+#define BENCH_HTTP_PORT 80
+/* Páginas servidas en cada medida */
+#define BENCH_PAGE_LOADS 20000
+/* Tamaño máximo de una respuesta */
+#define BENCH_RESPONSE_SIZE 8192
+
+/* Valores que devuelve el callback CGI */
+typedef struct
+{
+  const char *name;
+  const char *value;
+} BenchCgiValue;
+
+static const BenchCgiValue s_cgi_values[] = {
+    {"wifi_state", "Conectado"},
+    {"wifi_ssid", "bench"},
+    {"wifi_rssi", "-52"},
+    {"wifi_channel", "6"},
+    {"ip_addr", "192.168.1.10"},
+    {"ip_mask", "255.255.255.0"},
+    {"ip_gateway", "192.168.1.1"},
+    {"mac_addr", "24:0A:C4:12:34:56"},
+    {"uptime", "3 d 04:12:55"},
+    {"free_heap", "187432"},
+    {"fw_version", "1.4.0"},
+    {"res_version", "2026-10-18"}};
+
+static HttpServerSettings s_settings;
+static HttpServerContext s_context;
+static HttpConnection s_connections[1];
+
+/* ========================================================================== */
+/*                                 SERVIDOR                                   */
+/* ========================================================================== */
+
+static error_t bench_request_callback(HttpConnection *connection,
+                                      const char_t *uri)
+{
+  connection->response.version = connection->request.version;
+  return ERROR_NOT_FOUND;
+}
+
+static error_t bench_cgi_callback(HttpConnection *connection,
+                                  const char_t *param)
+{
+  size_t i;
+
+  for (i = 0; i < arraysize(s_cgi_values); i++)
+  {
+    if (strcmp(param, s_cgi_values[i].name) == 0)
+      return httpWriteStream(connection, s_cgi_values[i].value,
+                             strlen(s_cgi_values[i].value));
+  }
+
+  return ERROR_INVALID_TAG;
+}
+
+static error_t bench_uri_not_found_callback(HttpConnection *connection,
+                                            const char_t *uri)
+{
+  return ERROR_NOT_FOUND;
+}
+
+static error_t start_http_server(void)
+{
+  error_t error;
+
+  httpServerGetDefaultSettings(&s_settings);
+  s_settings.port = BENCH_HTTP_PORT;
+  s_settings.maxConnections = arraysize(s_connections);
+  s_settings.connections = s_connections;
+  strcpy(s_settings.rootDirectory, "/");
+  s_settings.requestCallback = bench_request_callback;
+  s_settings.cgiCallback = bench_cgi_callback;
+  s_settings.uriNotFoundCallback = bench_uri_not_found_callback;
+
+  error = httpServerInit(&s_context, &s_settings);
+  if (!error)
+    error = httpServerStart(&s_context);
+
+  return error;
+}
+
+/* ========================================================================== */
+/*                                  CLIENTE                                   */
+/* ========================================================================== */
+
+/* Respuesta recibida por el cliente */
+typedef struct
+{
+  char data[BENCH_RESPONSE_SIZE];
+  size_t length;
+  char body[BENCH_RESPONSE_SIZE];
+  size_t bodyLength;
+  bool_t close;
+} BenchResponse;
+
+/**
+ * @brief Lee una respuesta fragmentada completa y reconstruye el cuerpo
+ * @note La petición siguiente solo se envía después, así que todo lo
+ *       recibido pertenece a esta respuesta
+ */
+static error_t read_response(Socket *socket, BenchResponse *response)
+{
+  static const char last_chunk[] = "\r\n0\r\n\r\n";
+  char *p;
+  char *end;
+  size_t size;
+  size_t n;
+  error_t error;
+
+  response->length = 0;
+  response->bodyLength = 0;
+
+  // Hasta el último fragmento vacío
+  while (response->length < sizeof(last_chunk) - 1 ||
+         memcmp(response->data + response->length - (sizeof(last_chunk) - 1),
+                last_chunk, sizeof(last_chunk) - 1) != 0)
+  {
+    if (response->length >= sizeof(response->data) - 1)
+      return ERROR_BUFFER_OVERFLOW;
+
+    error = socketReceive(socket, response->data + response->length,
+                          sizeof(response->data) - 1 - response->length, &n,
+                          0);
+    if (error)
+      return error;
+
+    response->length += n;
+  }
+
+  response->data[response->length] = '\0';
+
+  p = strstr(response->data, "\r\n\r\n");
+  if (strncmp(response->data, "HTTP/1.1 200 ", 13) != 0 || p == NULL ||
+      strstr(response->data, "Transfer-Encoding: chunked\r\n") == NULL)
+    return ERROR_UNEXPECTED_RESPONSE;
+
+  response->close = strstr(response->data, "Connection: close\r\n") != NULL;
+  p += 4;
+
+  // Fragmentos: tamaño en hexadecimal, CRLF, datos, CRLF
+  while ((size = strtoul(p, &end, 16)) != 0)
+  {
+    if (strncmp(end, "\r\n", 2) != 0 ||
+        end + 2 + size + 2 > response->data + response->length)
+      return ERROR_INVALID_SYNTAX;
+
+    memcpy(response->body + response->bodyLength, end + 2, size);
+    response->bodyLength += size;
+    p = end + 2 + size + 2;
+  }
+
+  response->body[response->bodyLength] = '\0';
+  return NO_ERROR;
+}
+
+/**
+ * @brief Comprueba que las directivas se han sustituido
+ * @return Número de discrepancias
+ */
+static int check_body(const BenchResponse *response)
+{
+  char cell[64];
+  int bad = 0;
+  size_t i;
+
+  if (strstr(response->body, "<!--#") != NULL)
+  {
+    printf("El cuerpo conserva directivas SSI\n");
+    bad++;
+  }
+
+  if (strstr(response->body, "<h1>ESP32 Wi-Fi Manager</h1>") == NULL)
+  {
+    printf("Falta el contenido de header.html\n");
+    bad++;
+  }
+
+  for (i = 0; i < arraysize(s_cgi_values); i++)
+  {
+    // Cada valor abre una celda de la tabla
+    snprintf(cell, sizeof(cell), ">%s", s_cgi_values[i].value);
+    if (strstr(response->body, cell) == NULL)
+    {
+      printf("Falta el valor de %s\n", s_cgi_values[i].name);
+      bad++;
+    }
+  }
+
+  return bad;
+}
+
+/**
+ * @brief Tiempo monotónico en segundos.
+ */
+static double now_s(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+int main(void)
+{
+  static const char request[] = "GET /status.shtm HTTP/1.1\r\n"
+                                "Host: 192.168.4.1\r\n"
+                                "Connection: keep-alive\r\n"
+                                "\r\n";
+  static BenchResponse response;
+  Socket *socket = NULL;
+  error_t error = NO_ERROR;
+  double t0, elapsed;
+  int bad;
+
+  if (resInit() || start_http_server())
+  {
+    printf("No se pudo arrancar el servidor HTTP\n");
+    return 1;
+  }
+
+  t0 = now_s();
+
+  // La primera vuelta es la comprobación y no cuenta en la medida
+  for (uint_t i = 0; !error && i <= BENCH_PAGE_LOADS; i++)
+  {
+    if (socket == NULL)
+    {
+      socket = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+      if (socket == NULL)
+        return 1;
+
+      socketSetTimeout(socket, 5000);
+      error = socketConnect(socket, &IP_ADDR_ANY, BENCH_HTTP_PORT);
+    }
+
+    if (!error)
+      error = socketSend(socket, request, sizeof(request) - 1, NULL, 0);
+    if (!error)
+      error = read_response(socket, &response);
+
+    if (!error && i == 0)
+    {
+      bad = check_body(&response);
+      if (bad)
+      {
+        printf("Comprobación: %d discrepancias\n", bad);
+        return 1;
+      }
+      t0 = now_s();
+    }
+
+    // El servidor cierra con la respuesta HTTP_SERVER_MAX_REQUESTS
+    if (!error && response.close)
+    {
+      socketShutdown(socket, SOCKET_SD_BOTH);
+      socketClose(socket);
+      socket = NULL;
+    }
+  }
+
+  elapsed = now_s() - t0;
+
+  if (error)
+  {
+    printf("Respuesta incorrecta o conexión fallida (error %d)\n", error);
+    return 1;
+  }
+
+  printf("Página SSI de %u bytes servidos, %u directivas, caché de "
+         "plantillas %d: %.2f us por página\n",
+         (unsigned)response.bodyLength,
+         (unsigned)arraysize(s_cgi_values) + 1, HTTP_SERVER_SSI_CACHE_SIZE,
+         elapsed * 1e6 / BENCH_PAGE_LOADS);
+
+  socketShutdown(socket, SOCKET_SD_BOTH);
+  socketClose(socket);
+  return 0;
+}
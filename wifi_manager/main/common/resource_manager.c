@@ -33,9 +33,247 @@
 #include "resource_manager.h"
 #include "debug.h"
 
-//Resource data
+//Resource partition support?
+#if (RES_PARTITION_SUPPORT == ENABLED)
+   #if defined(ESP_PLATFORM)
+      #include "esp_partition.h"
+   #else
+      #include <fcntl.h>
+      #include <unistd.h>
+      #include <sys/mman.h>
+      #include <sys/stat.h>
+   #endif
+#endif
+
+//Resource data linked into the application
 extern const uint8_t res[];
 
+//Resource image currently in use
+static const uint8_t *resData = res;
+
+#if (RES_INDEX_SUPPORT == ENABLED)
+
+//Hex digits used to encode fingerprints
+static const char_t hexDigit[] = "0123456789abcdef";
+
+//Path index of the resource image
+static const ResIndexHeader *resIndex = NULL;
+//The resource image has already been checked for a path index
+static bool_t resIndexChecked = FALSE;
+
+
+/**
+ * @brief Locate the path index of the resource image
+ *
+ * The index is stored as a hidden file in the root directory. Images built
+ * by older versions of pack.py do not carry one, in which case lookups walk
+ * the directory tree
+ *
+ * @return Pointer to the path index, or NULL if the image has no index
+ **/
+
+static const ResIndexHeader *resGetIndex(void)
+{
+   uint_t n;
+   uint32_t totalSize;
+   uint32_t length;
+   const ResHeader *resHeader;
+   const ResEntry *resEntry;
+   const ResIndexHeader *index;
+
+   //The root directory is only scanned once
+   if(resIndexChecked)
+      return resIndex;
+
+   //Point to the resource header
+   resHeader = (const ResHeader *) resData;
+   //Retrieve the total size of the resource image
+   totalSize = letoh32(resHeader->totalSize);
+
+   //Make sure the resource data is valid
+   if(totalSize >= sizeof(ResHeader))
+   {
+      //Retrieve the length of the root directory
+      length = letoh32(resHeader->rootEntry.dataLength);
+      //Point to the contents of the root directory
+      resEntry = (const ResEntry *) (resData +
+         letoh32(resHeader->rootEntry.dataStart));
+
+      //Length of the index name
+      n = osStrlen(RES_INDEX_NAME);
+
+      //Loop through the root directory
+      while(length >= sizeof(ResEntry) &&
+         length >= (sizeof(ResEntry) + resEntry->nameLength))
+      {
+         //Path index?
+         if(resEntry->type == RES_TYPE_FILE && resEntry->nameLength == n &&
+            !osStrncmp(resEntry->name, RES_INDEX_NAME, n))
+         {
+            //Point to the index header
+            index = (const ResIndexHeader *) (resData +
+               letoh32(resEntry->dataStart));
+
+            //Check the consistency of the index before using it
+            if(letoh32(resEntry->dataLength) >= sizeof(ResIndexHeader) &&
+               letoh32(index->magic) == RES_INDEX_MAGIC &&
+               letoh32(index->bucketCount) > 0 &&
+               (letoh32(index->bucketCount) &
+               (letoh32(index->bucketCount) - 1)) == 0 &&
+               letoh32(resEntry->dataLength) >= (sizeof(ResIndexHeader) +
+               letoh32(index->bucketCount) * sizeof(ResIndexBucket)))
+            {
+               resIndex = index;
+            }
+
+            //Stop scanning the root directory
+            break;
+         }
+
+         //Remaining bytes to process
+         length -= sizeof(ResEntry) + resEntry->nameLength;
+
+         //Point to the next entry
+         resEntry = (const ResEntry *) ((const uint8_t *) resEntry +
+            sizeof(ResEntry) + resEntry->nameLength);
+      }
+   }
+
+   //Do not scan the root directory again
+   resIndexChecked = TRUE;
+
+   //Return a pointer to the path index, if any
+   return resIndex;
+}
+
+
+/**
+ * @brief Get the next character of a normalized path
+ *
+ * Paths are compared case-insensitively, backslashes are treated as forward
+ * slashes and leading or repeated separators are ignored, which matches the
+ * way the directory walk splits a path into tokens
+ *
+ * @param[in,out] path Pointer to the remaining part of the path
+ * @param[in,out] prev Previous normalized character ('/' at the beginning)
+ * @return Next normalized character, or '\0' at the end of the path
+ **/
+
+static char_t resGetNextPathChar(const char_t **path, char_t *prev)
+{
+   char_t c;
+
+   //Loop through the path
+   while((c = **path) != '\0')
+   {
+      //Advance data pointer
+      (*path)++;
+
+      //Separator character?
+      if(c == '/' || c == '\\')
+      {
+         //Skip leading and repeated separators
+         if(*prev != '/')
+         {
+            *prev = '/';
+            return '/';
+         }
+      }
+      else
+      {
+         //Case-insensitive comparison (ASCII letters, as tolower does in
+         //the C locale, without a library call for every character)
+         if(c >= 'A' && c <= 'Z')
+            c += 'a' - 'A';
+
+         *prev = c;
+         return c;
+      }
+   }
+
+   //End of path
+   return '\0';
+}
+
+
+/**
+ * @brief Search the path index for a given file
+ * @param[in] index Pointer to the path index
+ * @param[in] path NULL-terminated string specifying the path
+ * @param[out] resBucket Index bucket that refers to the file
+ * @return Error code
+ **/
+
+static error_t resSearchIndex(const ResIndexHeader *index, const char_t *path,
+   const ResIndexBucket **resBucket)
+{
+   uint_t i;
+   uint_t n;
+   char_t c;
+   char_t prev;
+   uint32_t h;
+   uint32_t offset;
+   const char_t *p;
+   const char_t *s;
+   const ResIndexBucket *bucket;
+
+   //Compute the FNV-1a hash of the normalized path
+   h = 2166136261U;
+   p = path;
+   prev = '/';
+
+   while((c = resGetNextPathChar(&p, &prev)) != '\0')
+   {
+      h = (h ^ (uint8_t) c) * 16777619U;
+   }
+
+   //Number of buckets
+   n = letoh32(index->bucketCount);
+
+   //Linear probing (the table is at most half full)
+   for(i = 0; i < n; i++)
+   {
+      //Point to the current bucket
+      bucket = &index->buckets[(h + i) & (n - 1)];
+      //Retrieve the offset of the resource entry
+      offset = letoh32(bucket->entryOffset);
+
+      //An empty bucket terminates the search
+      if(offset == 0)
+         break;
+
+      //Matching hash value?
+      if(letoh32(bucket->hash) == h)
+      {
+         //Point to the normalized path stored in the index
+         s = (const char_t *) (resData + letoh32(bucket->pathOffset));
+
+         //Compare paths
+         p = path;
+         prev = '/';
+
+         do
+         {
+            c = resGetNextPathChar(&p, &prev);
+         } while(c != '\0' && c == *(s++));
+
+         //Full match?
+         if(c == '\0' && *s == '\0')
+         {
+            //Return the matching bucket
+            *resBucket = bucket;
+            //The file has been found
+            return NO_ERROR;
+         }
+      }
+   }
+
+   //The specified file does not exist
+   return ERROR_NOT_FOUND;
+}
+
+#endif
+
 
 error_t resGetData(const char_t *path, const uint8_t **data, size_t *length)
 {
@@ -44,18 +282,42 @@ error_t resGetData(const char_t *path, const uint8_t **data, size_t *length)
    uint_t n;
    uint_t dirLength;
    ResEntry *resEntry;
+#if (RES_INDEX_SUPPORT == ENABLED)
+   const ResIndexBucket *resBucket;
+#endif
 
    //Point to the resource header
-   ResHeader *resHeader = (ResHeader *) res;
+   ResHeader *resHeader = (ResHeader *) resData;
 
    //Make sure the resource data is valid
    if(letoh32(resHeader->totalSize) < sizeof(ResHeader))
       return ERROR_INVALID_RESOURCE;
 
+#if (RES_INDEX_SUPPORT == ENABLED)
+   //Images that carry a path index are resolved with a single lookup
+   if(resGetIndex() != NULL)
+   {
+      //Search the path index
+      if(resSearchIndex(resIndex, path, &resBucket))
+         return ERROR_NOT_FOUND;
+
+      //Point to the resource entry
+      resEntry = (ResEntry *) (resData + letoh32(resBucket->entryOffset));
+
+      //Return the location of the specified resource
+      *data = resData + letoh32(resEntry->dataStart);
+      //Return the length of the resource
+      *length = letoh32(resEntry->dataLength);
+
+      //Successful processing
+      return NO_ERROR;
+   }
+#endif
+
    //Retrieve the length of the root directory
    dirLength = letoh32(resHeader->rootEntry.dataLength);
    //Point to the contents of the root directory
-   resEntry = (ResEntry *) (res + letoh32(resHeader->rootEntry.dataStart));
+   resEntry = (ResEntry *) (resData + letoh32(resHeader->rootEntry.dataStart));
 
    //Parse the entire path
    for(found = FALSE; !found && path[0] != '\0'; path += n + 1)
@@ -93,7 +355,7 @@ error_t resGetData(const char_t *path, const uint8_t **data, size_t *length)
                //Save the length of the directory
                dirLength = letoh32(resEntry->dataLength);
                //Point to the contents of the directory
-               resEntry = (ResEntry *) (res + letoh32(resEntry->dataStart));
+               resEntry = (ResEntry *) (resData + letoh32(resEntry->dataStart));
             }
             else
             {
@@ -131,7 +393,7 @@ error_t resGetData(const char_t *path, const uint8_t **data, size_t *length)
       return ERROR_NOT_FOUND;
 
    //Return the location of the specified resource
-   *data = res + letoh32(resEntry->dataStart);
+   *data = resData + letoh32(resEntry->dataStart);
    //Return the length of the resource
    *length = letoh32(resEntry->dataLength);
 
@@ -140,6 +402,203 @@ error_t resGetData(const char_t *path, const uint8_t **data, size_t *length)
 }
 
 
+#if (RES_INDEX_SUPPORT == ENABLED)
+
+/**
+ * @brief Strip the fingerprint from a path
+ *
+ * A fingerprinted path has the form "name.<fingerprint>.ext" (or
+ * "name.<fingerprint>"), where the fingerprint is the hex-encoded content
+ * hash of the file, as listed in the manifest written by pack.py
+ *
+ * @param[in] path NULL-terminated string specifying the path
+ * @param[out] buffer Buffer where to store the path without fingerprint
+ * @param[out] fingerprint Pointer to the fingerprint within the path
+ * @return Error code
+ **/
+
+static error_t resStripFingerprint(const char_t *path, char_t *buffer,
+   const char_t **fingerprint)
+{
+   size_t n;
+   const char_t *p;
+   const char_t *name;
+   const char_t *ext;
+
+   //Point to the last component of the path and to its last dot
+   for(name = path, ext = NULL, p = path; *p != '\0'; p++)
+   {
+      if(*p == '/' || *p == '\\')
+      {
+         name = p + 1;
+         ext = NULL;
+      }
+      else if(*p == '.')
+      {
+         ext = p;
+      }
+   }
+
+   //Check the length of the path
+   if((size_t) (p - path) > RES_MAX_PATH_LEN)
+      return ERROR_NOT_FOUND;
+
+   //Fingerprint followed by an extension?
+   if(ext != NULL && (ext - name) > RES_FINGERPRINT_LEN &&
+      *(ext - RES_FINGERPRINT_LEN - 1) == '.')
+   {
+      p = ext;
+   }
+   //Otherwise the fingerprint must end the path
+   else if((p - name) <= RES_FINGERPRINT_LEN ||
+      *(p - RES_FINGERPRINT_LEN - 1) != '.')
+   {
+      return ERROR_NOT_FOUND;
+   }
+
+   //Point to the fingerprint
+   *fingerprint = p - RES_FINGERPRINT_LEN;
+
+   //Copy the path, except the fingerprint and the preceding dot
+   n = *fingerprint - 1 - path;
+   osMemcpy(buffer, path, n);
+   osStrcpy(buffer + n, p);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+#endif
+
+
+/**
+ * @brief Get the best encoded variant of a resource
+ *
+ * Precompressed variants are recorded in the path index by pack.py. The
+ * smallest variant whose encoding is acceptable is returned, or the original
+ * data when no such variant exists. Images without a path index only provide
+ * the original data
+ *
+ * @param[in] path NULL-terminated string specifying the path
+ * @param[in] acceptedEncodings Set of encodings accepted by the client
+ * @param[out] info Information about the selected representation
+ * @return Error code
+ **/
+
+error_t resGetEncodedData(const char_t *path, uint_t acceptedEncodings,
+   ResInfo *info)
+{
+#if (RES_INDEX_SUPPORT == ENABLED)
+   error_t error;
+   uint_t i;
+   uint32_t offset;
+   const char_t *fingerprint;
+   const ResHeader *resHeader;
+   const ResEntry *resEntry;
+   const ResIndexBucket *resBucket;
+   const ResVariantList *resVariantList;
+   const ResVariant *resVariant;
+   char_t buffer[RES_MAX_PATH_LEN + 1];
+
+   //Point to the resource header
+   resHeader = (const ResHeader *) resData;
+
+   //Make sure the resource data is valid
+   if(letoh32(resHeader->totalSize) < sizeof(ResHeader))
+      return ERROR_INVALID_RESOURCE;
+
+   //Images that carry a path index are resolved with a single lookup
+   if(resGetIndex() != NULL)
+   {
+      //Search the path index
+      error = resSearchIndex(resIndex, path, &resBucket);
+      //The path is not listed in the index
+      info->fingerprinted = FALSE;
+
+      //Fingerprinted paths are only looked up again when the plain lookup
+      //fails, so that regular requests still cost a single probe
+      if(error)
+      {
+         //Strip the fingerprint from the path
+         if(resStripFingerprint(path, buffer, &fingerprint))
+            return ERROR_NOT_FOUND;
+
+         //Search the path index again
+         if(resSearchIndex(resIndex, buffer, &resBucket))
+            return ERROR_NOT_FOUND;
+
+         //Make sure the fingerprint refers to the current contents
+         for(i = 0; i < RES_DIGEST_SIZE; i++)
+         {
+            if(osTolower(fingerprint[2 * i]) != hexDigit[resBucket->digest[i] >> 4] ||
+               osTolower(fingerprint[2 * i + 1]) != hexDigit[resBucket->digest[i] & 0x0F])
+            {
+               return ERROR_NOT_FOUND;
+            }
+         }
+
+         //The representation will never change under this path
+         info->fingerprinted = TRUE;
+      }
+
+      //Point to the resource entry
+      resEntry = (const ResEntry *) (resData + letoh32(resBucket->entryOffset));
+
+      //Default to the original data
+      info->encoding = RES_ENCODING_IDENTITY;
+      info->availableEncodings = RES_ENCODING_FLAG(RES_ENCODING_IDENTITY);
+      info->digest = resBucket->digest;
+      info->mimeType = resBucket->mimeType;
+      info->data = resData + letoh32(resEntry->dataStart);
+      info->length = letoh32(resEntry->dataLength);
+
+      //Retrieve the offset of the variant list
+      offset = letoh32(resBucket->varOffset);
+
+      //Any precompressed variant?
+      if(offset != 0)
+      {
+         //Point to the variant list
+         resVariantList = (const ResVariantList *) (resData + offset);
+
+         //Variants are sorted by increasing size
+         for(i = 0; i < resVariantList->count; i++)
+         {
+            //Point to the current variant
+            resVariant = &resVariantList->variants[i];
+
+            //Acceptable encoding that has not been selected yet?
+            if((acceptedEncodings & RES_ENCODING_FLAG(resVariant->encoding)) != 0 &&
+               info->encoding == RES_ENCODING_IDENTITY)
+            {
+               //Select the smallest acceptable variant
+               info->encoding = (ResEncoding) resVariant->encoding;
+               info->data = resData + letoh32(resVariant->dataStart);
+               info->length = letoh32(resVariant->dataLength);
+            }
+
+            //Keep track of the available encodings
+            info->availableEncodings |= RES_ENCODING_FLAG(resVariant->encoding);
+         }
+      }
+
+      //Successful processing
+      return NO_ERROR;
+   }
+#endif
+
+   //Only the original data is available
+   info->encoding = RES_ENCODING_IDENTITY;
+   info->availableEncodings = RES_ENCODING_FLAG(RES_ENCODING_IDENTITY);
+   info->digest = NULL;
+   info->fingerprinted = FALSE;
+   info->mimeType = 0;
+
+   //Get the resource data
+   return resGetData(path, &info->data, &info->length);
+}
+
+
 error_t resSearchFile(const char_t *path, DirEntry *dirEntry)
 {
    bool_t found;
@@ -147,18 +606,44 @@ error_t resSearchFile(const char_t *path, DirEntry *dirEntry)
    uint_t n;
    uint_t length;
    ResEntry *resEntry;
+#if (RES_INDEX_SUPPORT == ENABLED)
+   const ResIndexBucket *resBucket;
+#endif
 
    //Point to the resource header
-   ResHeader *resHeader = (ResHeader *) res;
+   ResHeader *resHeader = (ResHeader *) resData;
 
    //Make sure the resource data is valid
    if(letoh32(resHeader->totalSize) < sizeof(ResHeader))
       return ERROR_INVALID_RESOURCE;
 
+#if (RES_INDEX_SUPPORT == ENABLED)
+   //Images that carry a path index are resolved with a single lookup
+   if(resGetIndex() != NULL)
+   {
+      //Search the path index
+      if(resSearchIndex(resIndex, path, &resBucket))
+         return ERROR_NOT_FOUND;
+
+      //Point to the resource entry
+      resEntry = (ResEntry *) (resData + letoh32(resBucket->entryOffset));
+
+      //Return information about the file
+      dirEntry->type = resEntry->type;
+      dirEntry->volume = 0;
+      dirEntry->dataStart = letoh32(resEntry->dataStart);
+      dirEntry->dataLength = letoh32(resEntry->dataLength);
+      dirEntry->nameLength = 0;
+
+      //Successful processing
+      return NO_ERROR;
+   }
+#endif
+
    //Retrieve the length of the root directory
    length = letoh32(resHeader->rootEntry.dataLength);
    //Point to the contents of the root directory
-   resEntry = (ResEntry *) (res + letoh32(resHeader->rootEntry.dataStart));
+   resEntry = (ResEntry *) (resData + letoh32(resHeader->rootEntry.dataStart));
 
    //Parse the entire path
    for(found = FALSE; !found && path[0] != '\0'; path += n + 1)
@@ -196,7 +681,7 @@ error_t resSearchFile(const char_t *path, DirEntry *dirEntry)
                //Save the length of the directory
                length = letoh32(resEntry->dataLength);
                //Point to the contents of the directory
-               resEntry = (ResEntry *) (res + letoh32(resEntry->dataStart));
+               resEntry = (ResEntry *) (resData + letoh32(resEntry->dataStart));
             }
             else
             {
@@ -245,6 +730,547 @@ error_t resSearchFile(const char_t *path, DirEntry *dirEntry)
    return NO_ERROR;
 }
 
+#if (RES_PARTITION_SUPPORT == ENABLED)
+
+/**
+ * @brief Update a CRC-32 value
+ * @param[in] crc Current CRC value (0 for the first block)
+ * @param[in] data Pointer to the data
+ * @param[in] length Length of the data
+ * @return Updated CRC value, compatible with zlib's crc32
+ **/
+
+static uint32_t resComputeCrc32(uint32_t crc, const void *data, size_t length)
+{
+   uint_t i;
+   const uint8_t *p;
+
+   //Point to the data
+   p = (const uint8_t *) data;
+   //Pre-conditioning
+   crc = ~crc;
+
+   //Process the data bit by bit (only headers are checked at boot time)
+   while(length-- > 0)
+   {
+      crc ^= *(p++);
+
+      for(i = 0; i < 8; i++)
+      {
+         crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+      }
+   }
+
+   //Post-conditioning
+   return ~crc;
+}
+
+
+/**
+ * @brief Find a resource partition
+ * @param[in] label Partition label (file name in host builds)
+ * @param[out] size Size of the partition, in bytes
+ * @return Partition handle, or NULL if the partition does not exist
+ **/
+
+static const void *resFindPartition(const char_t *label, uint32_t *size)
+{
+#if defined(ESP_PLATFORM)
+   const esp_partition_t *partition;
+
+   //Search the partition table
+   partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+      ESP_PARTITION_SUBTYPE_ANY, label);
+
+   //Partition found?
+   if(partition != NULL)
+      *size = partition->size;
+
+   //Return the partition handle
+   return partition;
+#else
+   struct stat st;
+
+   //Image files can grow as needed
+   *size = UINT32_MAX;
+
+   //Host builds only use files that already exist
+   return (stat(label, &st) == 0) ? label : NULL;
+#endif
+}
+
+
+/**
+ * @brief Read data from a resource partition
+ * @param[in] partition Partition handle
+ * @param[in] offset Offset from the beginning of the partition
+ * @param[out] data Buffer where to store the data
+ * @param[in] length Number of bytes to read
+ * @return Error code
+ **/
+
+static error_t resReadPartition(const void *partition, uint32_t offset,
+   void *data, size_t length)
+{
+#if defined(ESP_PLATFORM)
+   //Read data from flash
+   if(esp_partition_read(partition, offset, data, length) != ESP_OK)
+      return ERROR_READ_FAILED;
+#else
+   int fd;
+   ssize_t n;
+
+   //Open the image file
+   fd = open(partition, O_RDONLY);
+   //Failed to open the file?
+   if(fd < 0)
+      return ERROR_READ_FAILED;
+
+   //Read data
+   n = pread(fd, data, length, offset);
+   close(fd);
+
+   //Check the number of bytes actually read
+   if(n < 0 || (size_t) n != length)
+      return ERROR_READ_FAILED;
+#endif
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Write data to a resource partition
+ * @param[in] partition Partition handle
+ * @param[in] offset Offset from the beginning of the partition
+ * @param[in] data Pointer to the data
+ * @param[in] length Number of bytes to write
+ * @return Error code
+ **/
+
+static error_t resWritePartition(const void *partition, uint32_t offset,
+   const void *data, size_t length)
+{
+#if defined(ESP_PLATFORM)
+   //Write data to flash
+   if(esp_partition_write(partition, offset, data, length) != ESP_OK)
+      return ERROR_WRITE_FAILED;
+#else
+   int fd;
+   ssize_t n;
+
+   //Open the image file
+   fd = open(partition, O_WRONLY);
+   //Failed to open the file?
+   if(fd < 0)
+      return ERROR_WRITE_FAILED;
+
+   //Write data
+   n = pwrite(fd, data, length, offset);
+   close(fd);
+
+   //Check the number of bytes actually written
+   if(n < 0 || (size_t) n != length)
+      return ERROR_WRITE_FAILED;
+#endif
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Erase a resource partition
+ * @param[in] partition Partition handle
+ * @return Error code
+ **/
+
+static error_t resErasePartition(const void *partition)
+{
+#if defined(ESP_PLATFORM)
+   const esp_partition_t *p;
+
+   //Point to the partition
+   p = (const esp_partition_t *) partition;
+
+   //Erase the whole partition, including the header
+   if(esp_partition_erase_range(p, 0, p->size) != ESP_OK)
+      return ERROR_WRITE_FAILED;
+#else
+   //Discard the contents of the image file
+   if(truncate(partition, 0) != 0)
+      return ERROR_WRITE_FAILED;
+#endif
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Map a resource partition into the address space
+ * @param[in] partition Partition handle
+ * @param[in] length Number of bytes to map
+ * @return Pointer to the mapped data, or NULL on failure
+ **/
+
+static const uint8_t *resMapPartition(const void *partition, uint32_t length)
+{
+#if defined(ESP_PLATFORM)
+   const void *p;
+   esp_partition_mmap_handle_t handle;
+
+   //Map the partition into the data address space. The mapping is never
+   //released since the HTTP server keeps pointers to the resource data
+   if(esp_partition_mmap(partition, 0, length, ESP_PARTITION_MMAP_DATA, &p,
+      &handle) != ESP_OK)
+   {
+      return NULL;
+   }
+
+   //Return a pointer to the mapped data
+   return p;
+#else
+   int fd;
+   void *p;
+
+   //Open the image file
+   fd = open(partition, O_RDONLY);
+   //Failed to open the file?
+   if(fd < 0)
+      return NULL;
+
+   //Map the file into memory
+   p = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+   close(fd);
+
+   //Return a pointer to the mapped data
+   return (p != MAP_FAILED) ? p : NULL;
+#endif
+}
+
+
+/**
+ * @brief Check the header of a resource partition
+ * @param[in] header Pointer to the partition header
+ * @param[in] size Size of the partition, in bytes
+ * @return TRUE if the header is valid, else FALSE
+ **/
+
+static bool_t resCheckPartitionHeader(const ResPartitionHeader *header,
+   uint32_t size)
+{
+   //Check magic number and version
+   if(letoh32(header->magic) != RES_PARTITION_MAGIC ||
+      letoh16(header->version) != RES_PARTITION_VERSION ||
+      letoh16(header->headerSize) != sizeof(ResPartitionHeader))
+   {
+      return FALSE;
+   }
+
+   //Check the size of the image
+   if(letoh32(header->imageSize) < sizeof(ResHeader) ||
+      letoh32(header->imageSize) > (size - sizeof(ResPartitionHeader)))
+   {
+      return FALSE;
+   }
+
+   //Check the integrity of the header. The image itself is verified when the
+   //partition is written, not at boot time
+   if(letoh32(header->headerCrc) != resComputeCrc32(0, header,
+      sizeof(ResPartitionHeader) - sizeof(uint32_t)))
+   {
+      return FALSE;
+   }
+
+   //The header is valid
+   return TRUE;
+}
+
+
+/**
+ * @brief Select the active resource partition
+ * @param[out] header Header of the active partition
+ * @return Handle of the active partition, or NULL if no partition is valid
+ **/
+
+static const void *resGetActivePartition(ResPartitionHeader *header)
+{
+   uint_t i;
+   uint32_t size;
+   const void *partition;
+   const void *active;
+   ResPartitionHeader temp;
+   const char_t *labels[] = {RES_PARTITION_A_LABEL, RES_PARTITION_B_LABEL};
+
+   //No valid partition found so far
+   active = NULL;
+
+   //Loop through the A/B partitions
+   for(i = 0; i < arraysize(labels); i++)
+   {
+      //Find the partition
+      partition = resFindPartition(labels[i], &size);
+      //Not present in the partition table?
+      if(partition == NULL)
+         continue;
+
+      //Read the partition header
+      if(resReadPartition(partition, 0, &temp, sizeof(ResPartitionHeader)))
+         continue;
+
+      //Skip partitions that do not hold a complete image
+      if(!resCheckPartitionHeader(&temp, size))
+         continue;
+
+      //The image with the highest sequence number is the most recent one
+      if(active == NULL || (int32_t) (letoh32(temp.sequence) -
+         letoh32(header->sequence)) > 0)
+      {
+         active = partition;
+         *header = temp;
+      }
+   }
+
+   //Return the active partition
+   return active;
+}
+
+
+/**
+ * @brief Initialize resource management
+ *
+ * The resource image is looked up in the A/B resource partitions and mapped
+ * in place, without being copied. The image linked into the application is
+ * used when neither partition holds a valid image
+ *
+ * @return Error code
+ **/
+
+error_t resInit(void)
+{
+   const void *partition;
+   const uint8_t *p;
+   ResPartitionHeader header;
+
+   //Select the most recent valid partition
+   partition = resGetActivePartition(&header);
+
+   //No valid partition?
+   if(partition == NULL)
+   {
+      //Debug message
+      TRACE_INFO("Using the built-in resource image\r\n");
+      //Keep using the resource image linked into the application
+      return NO_ERROR;
+   }
+
+   //Map the header and the image
+   p = resMapPartition(partition, sizeof(ResPartitionHeader) +
+      letoh32(header.imageSize));
+   //Mapping failed?
+   if(p == NULL)
+      return ERROR_FAILURE;
+
+   //Point to the resource image
+   p += sizeof(ResPartitionHeader);
+
+   //Consistency check
+   if(letoh32(((const ResHeader *) p)->totalSize) != letoh32(header.imageSize))
+      return ERROR_INVALID_RESOURCE;
+
+   //Debug message
+   TRACE_INFO("Using resource partition (sequence %" PRIu32 ", %" PRIu32 " bytes)\r\n",
+      letoh32(header.sequence), letoh32(header.imageSize));
+
+   //Switch to the mapped image
+   resData = p;
+
+#if (RES_INDEX_SUPPORT == ENABLED)
+   //The path index must be located again
+   resIndex = NULL;
+   resIndexChecked = FALSE;
+#endif
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Start writing a new resource image
+ *
+ * The image is written to the inactive partition, which is erased first.
+ * The active partition is left untouched until the next call to resInit
+ *
+ * @param[out] context Update context
+ * @return Error code
+ **/
+
+error_t resUpdateBegin(ResUpdateContext *context)
+{
+   error_t error;
+   uint32_t size;
+   const void *active;
+   const void *partition;
+   ResPartitionHeader header;
+
+   //Clear the update context
+   osMemset(context, 0, sizeof(ResUpdateContext));
+
+   //Retrieve the active partition
+   active = resGetActivePartition(&header);
+
+   //Select the other partition
+   partition = resFindPartition(RES_PARTITION_A_LABEL, &size);
+
+   //The first partition is currently active?
+   if(partition == NULL || partition == active)
+   {
+      partition = resFindPartition(RES_PARTITION_B_LABEL, &size);
+   }
+
+   //No partition available?
+   if(partition == NULL || partition == active)
+      return ERROR_NOT_FOUND;
+
+   //Erase the partition, including any previous header
+   error = resErasePartition(partition);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Save the partition handle
+   context->partition = partition;
+   context->size = size;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Write the next chunk of a resource image
+ *
+ * The data must be a partition binary generated by pack.py. Its header is
+ * kept in memory and only written by resUpdateEnd
+ *
+ * @param[in] context Update context
+ * @param[in] data Pointer to the data
+ * @param[in] length Number of bytes to write
+ * @return Error code
+ **/
+
+error_t resUpdateWrite(ResUpdateContext *context, const void *data,
+   size_t length)
+{
+   error_t error;
+   size_t n;
+   const uint8_t *p;
+
+   //Make sure the update has been started
+   if(context->partition == NULL)
+      return ERROR_WRONG_STATE;
+
+   //Point to the data
+   p = (const uint8_t *) data;
+
+   //The header comes first
+   if(context->headerLen < sizeof(ResPartitionHeader))
+   {
+      //Limit the number of bytes to copy
+      n = MIN(length, sizeof(ResPartitionHeader) - context->headerLen);
+
+      //Save the header
+      osMemcpy((uint8_t *) &context->header + context->headerLen, p, n);
+      context->headerLen += n;
+
+      //Advance data pointer
+      p += n;
+      length -= n;
+   }
+
+   //Any image data?
+   if(length > 0)
+   {
+      //Write the image right after the (not yet written) header
+      error = resWritePartition(context->partition,
+         sizeof(ResPartitionHeader) + context->offset, p, length);
+      //Any error to report?
+      if(error)
+         return error;
+
+      //Update the CRC of the image
+      context->crc = resComputeCrc32(context->crc, p, length);
+      context->offset += length;
+   }
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Complete the update of a resource image
+ *
+ * The image is checked against the header generated by pack.py. The header is
+ * then written with a sequence number higher than the active one, which makes
+ * the new image the active one at the next call to resInit
+ *
+ * @param[in] context Update context
+ * @return Error code
+ **/
+
+error_t resUpdateEnd(ResUpdateContext *context)
+{
+   ResPartitionHeader header;
+
+   //Make sure the update has been started
+   if(context->partition == NULL)
+      return ERROR_WRONG_STATE;
+
+   //Check the header generated by pack.py
+   if(!resCheckPartitionHeader(&context->header, context->size))
+      return ERROR_INVALID_RESOURCE;
+
+   //Make sure the whole image has been received intact
+   if(context->offset != letoh32(context->header.imageSize) ||
+      context->crc != letoh32(context->header.imageCrc))
+   {
+      return ERROR_INVALID_RESOURCE;
+   }
+
+   //The new image supersedes the active one
+   if(resGetActivePartition(&header) != NULL)
+   {
+      context->header.sequence = htole32(letoh32(header.sequence) + 1);
+   }
+
+   //Update the CRC of the header
+   context->header.headerCrc = htole32(resComputeCrc32(0, &context->header,
+      sizeof(ResPartitionHeader) - sizeof(uint32_t)));
+
+   //Writing the header commits the update
+   return resWritePartition(context->partition, 0, &context->header,
+      sizeof(ResPartitionHeader));
+}
+
+#else
+
+/**
+ * @brief Initialize resource management
+ * @return Error code
+ **/
+
+error_t resInit(void)
+{
+   //The resource image is linked into the application
+   return NO_ERROR;
+}
+
+#endif
+
 #if 0
 
 error_t resOpenFile(FsFile *file, const DirEntry *dirEntry, uint_t mode)
@@ -267,7 +1293,7 @@ error_t resSeekFile(FsFile *file, uint32_t *position)
 uint_t resReadFile(FsFile *file, void *data, size_t length)
 {
    length = MIN(length, file->size - file->offset);
-   osMemcpy(data, res + file->start + file->offset, length);
+   osMemcpy(data, resData + file->start + file->offset, length);
    file->offset += length;
    return length;
 }
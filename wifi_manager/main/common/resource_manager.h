@@ -31,8 +31,56 @@
 
 //Dependencies
 #include "compiler_port.h"
+#include "os_port.h"
+#include "net_config.h"
 #include "error.h"
 
+//Path index support
+#ifndef RES_INDEX_SUPPORT
+   #define RES_INDEX_SUPPORT ENABLED
+#elif (RES_INDEX_SUPPORT != ENABLED && RES_INDEX_SUPPORT != DISABLED)
+   #error RES_INDEX_SUPPORT parameter is not valid
+#endif
+
+//Maximum length of a path that carries a fingerprint
+#ifndef RES_MAX_PATH_LEN
+   #define RES_MAX_PATH_LEN 128
+#elif (RES_MAX_PATH_LEN < 16)
+   #error RES_MAX_PATH_LEN parameter is not valid
+#endif
+
+//Size of the content hash stored for each file
+#define RES_DIGEST_SIZE 8
+//Length of a fingerprint (hex-encoded content hash)
+#define RES_FINGERPRINT_LEN (2 * RES_DIGEST_SIZE)
+
+//Resource partition support
+#ifndef RES_PARTITION_SUPPORT
+   #define RES_PARTITION_SUPPORT DISABLED
+#elif (RES_PARTITION_SUPPORT != ENABLED && RES_PARTITION_SUPPORT != DISABLED)
+   #error RES_PARTITION_SUPPORT parameter is not valid
+#endif
+
+//Label of the first resource partition
+#ifndef RES_PARTITION_A_LABEL
+   #define RES_PARTITION_A_LABEL "res_a"
+#endif
+
+//Label of the second resource partition
+#ifndef RES_PARTITION_B_LABEL
+   #define RES_PARTITION_B_LABEL "res_b"
+#endif
+
+//Magic number identifying a resource partition ("RESP")
+#define RES_PARTITION_MAGIC 0x50534552
+//Version of the resource partition header
+#define RES_PARTITION_VERSION 1
+
+//Name of the root entry that holds the path index
+#define RES_INDEX_NAME ".resindex"
+//Magic number identifying the path index ("RID2")
+#define RES_INDEX_MAGIC 0x32444952
+
 //C++ guard
 #ifdef __cplusplus
 extern "C" {
@@ -50,6 +98,22 @@ typedef enum
 } ResType;
 
 
+/**
+ * @brief Content encoding of a resource variant
+ **/
+
+typedef enum
+{
+   RES_ENCODING_IDENTITY = 0,
+   RES_ENCODING_GZIP     = 1,
+   RES_ENCODING_BROTLI   = 2
+} ResEncoding;
+
+
+//Flags used to specify the set of acceptable encodings
+#define RES_ENCODING_FLAG(encoding) (1U << (encoding))
+
+
 //CC-RX, CodeWarrior or Win32 compiler?
 #if defined(__CCRX__)
    #pragma pack
@@ -96,6 +160,78 @@ typedef __packed_struct
 } ResHeader;
 
 
+/**
+ * @brief Resource partition header
+ *
+ * The header is written last when a partition is updated, so that a partially
+ * written image is never selected
+ *
+ **/
+
+typedef __packed_struct
+{
+   uint32_t magic;      ///<Magic number
+   uint16_t version;    ///<Header version
+   uint16_t headerSize; ///<Size of the header, in bytes
+   uint32_t imageSize;  ///<Size of the resource image that follows the header
+   uint32_t imageCrc;   ///<CRC-32 of the resource image
+   uint32_t sequence;   ///<Sequence number (the highest valid one is active)
+   uint32_t headerCrc;  ///<CRC-32 of the preceding header fields
+} ResPartitionHeader;
+
+
+/**
+ * @brief Path index bucket
+ **/
+
+typedef __packed_struct
+{
+   uint32_t hash;        ///<FNV-1a hash of the normalized path
+   uint32_t entryOffset; ///<Offset of the resource entry (0 for empty buckets)
+   uint32_t pathOffset;  ///<Offset of the normalized path
+   uint32_t varOffset;   ///<Offset of the precompressed variants (0 if none)
+   uint8_t digest[RES_DIGEST_SIZE]; ///<Truncated SHA-256 of the original data
+   uint8_t mimeType;     ///<MIME type identifier (0 if unknown)
+   uint8_t reserved[3];  ///<Reserved field
+} ResIndexBucket;
+
+
+/**
+ * @brief Precompressed variant of a resource
+ **/
+
+typedef __packed_struct
+{
+   uint8_t encoding;    ///<Content encoding
+   uint32_t dataStart;  ///<Offset of the encoded data
+   uint32_t dataLength; ///<Length of the encoded data
+} ResVariant;
+
+
+/**
+ * @brief List of precompressed variants, sorted by increasing size
+ **/
+
+typedef __packed_struct
+{
+   uint8_t count;         ///<Number of variants
+   ResVariant variants[]; ///<Variants
+} ResVariantList;
+
+
+/**
+ * @brief Path index header
+ **/
+
+typedef __packed_struct
+{
+   uint32_t magic;            ///<Magic number
+   uint32_t bucketCount;      ///<Number of buckets (power of two)
+   uint32_t entryCount;       ///<Number of indexed files
+   ResIndexBucket buckets[];  ///<Hash table
+} ResIndexHeader;
+
+
 //CC-RX, CodeWarrior or Win32 compiler?
 #if defined(__CCRX__)
    #pragma unpack
@@ -104,6 +240,37 @@ typedef __packed_struct
 #endif
 
 
+/**
+ * @brief Information about a resource representation
+ **/
+
+typedef struct
+{
+   ResEncoding encoding;        ///<Encoding of the returned data
+   uint_t availableEncodings;   ///<Set of encodings available for the resource
+   const uint8_t *digest;       ///<Content hash (NULL if the image has no index)
+   bool_t fingerprinted;        ///<The path carried the current fingerprint
+   uint_t mimeType;             ///<MIME type identifier stored by pack.py (0 if unknown)
+   const uint8_t *data;         ///<Resource data
+   size_t length;               ///<Length of the resource data
+} ResInfo;
+
+
+/**
+ * @brief Resource partition update context
+ **/
+
+typedef struct
+{
+   const void *partition;      ///<Partition being written
+   uint32_t size;              ///<Size of the partition, in bytes
+   ResPartitionHeader header;  ///<Header of the new image
+   size_t headerLen;           ///<Number of header bytes received so far
+   uint32_t offset;            ///<Number of image bytes written so far
+   uint32_t crc;               ///<Running CRC-32 of the image
+} ResUpdateContext;
+
+
 typedef struct
 {
    uint_t type;
@@ -116,10 +283,20 @@ typedef struct
 
 
 //Resource management
+error_t resInit(void);
+
 error_t resGetData(const char_t *path, const uint8_t **data, size_t *length);
 
+error_t resGetEncodedData(const char_t *path, uint_t acceptedEncodings,
+   ResInfo *info);
+
 error_t resSearchFile(const char_t *path, DirEntry *dirEntry);
 
+error_t resUpdateBegin(ResUpdateContext *context);
+error_t resUpdateWrite(ResUpdateContext *context, const void *data,
+   size_t length);
+error_t resUpdateEnd(ResUpdateContext *context);
+
 //error_t resOpenDirectory(Directory *directory, const DirEntry *entry);
 //error_t resReadDirectory(Directory *directory, DirEntry *entry);
 
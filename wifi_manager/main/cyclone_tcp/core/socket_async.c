@@ -0,0 +1,1163 @@
+/**
+ * @file socket_async.c
+ * @brief Completion-based asynchronous socket API
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * The asynchronous socket API lets any number of connections share a single
+ * executor task. Operations (connect, accept, send, receive, shutdown and
+ * timers) are submitted together with a completion callback. The executor
+ * multiplexes all the pending operations through socketPoll(), performs the
+ * I/O in non-blocking mode as soon as the underlying socket is ready, and
+ * invokes the completion callbacks from its own context
+ *
+ * A socket must be handed over to the executor with socketAsyncAttach()
+ * before it is used in an asynchronous operation. Attaching switches the
+ * socket to non-blocking mode once and for all
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL SOCKET_TRACE_LEVEL
+
+//Dependencies
+#include "core/net.h"
+#include "core/socket.h"
+#include "core/socket_async.h"
+#include "debug.h"
+
+//Check TCP/IP stack configuration
+#if (SOCKET_ASYNC_SUPPORT == ENABLED)
+
+//Local functions
+static error_t socketAsyncSubmit(SocketAsyncContext *context,
+   SocketAsyncOp *op);
+
+static bool_t socketAsyncProcessOp(SocketAsyncOp *op);
+static uint_t socketAsyncGetEventMask(SocketAsyncOp *op);
+static void socketAsyncComplete(SocketAsyncContext *context, SocketAsyncOp *op);
+static void socketAsyncDispatch(SocketAsyncContext *context);
+
+
+/**
+ * @brief Initialize settings with default values
+ * @param[out] settings Structure that contains executor settings
+ **/
+
+void socketAsyncGetDefaultSettings(SocketAsyncSettings *settings)
+{
+   //Default task parameters
+   settings->task = OS_TASK_DEFAULT_PARAMS;
+   settings->task.stackSize = SOCKET_ASYNC_STACK_SIZE;
+   settings->task.priority = SOCKET_ASYNC_PRIORITY;
+}
+
+
+/**
+ * @brief Executor initialization
+ * @param[in] context Pointer to the executor context
+ * @param[in] settings Executor specific settings
+ * @return Error code
+ **/
+
+error_t socketAsyncInit(SocketAsyncContext *context,
+   const SocketAsyncSettings *settings)
+{
+   error_t error;
+
+   //Debug message
+   TRACE_INFO("Initializing asynchronous socket executor...\r\n");
+
+   //Ensure the parameters are valid
+   if(context == NULL || settings == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Clear the executor context
+   osMemset(context, 0, sizeof(SocketAsyncContext));
+
+   //Initialize task parameters
+   context->taskParams = settings->task;
+   context->taskId = OS_INVALID_TASK_ID;
+
+   //Save user settings
+   context->settings = *settings;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Create a mutex to protect the operation lists
+   if(!osCreateMutex(&context->mutex))
+   {
+      //Failed to create mutex
+      error = ERROR_OUT_OF_RESOURCES;
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Create an event object used to wake up the executor
+      if(!osCreateEvent(&context->event))
+      {
+         //Failed to create event
+         error = ERROR_OUT_OF_RESOURCES;
+      }
+   }
+
+   //Check status code
+   if(error)
+   {
+      //Clean up side effects
+      socketAsyncDeinit(context);
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Start the executor task
+ * @param[in] context Pointer to the executor context
+ * @return Error code
+ **/
+
+error_t socketAsyncStart(SocketAsyncContext *context)
+{
+   //Make sure the executor context is valid
+   if(context == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Debug message
+   TRACE_INFO("Starting asynchronous socket executor...\r\n");
+
+   //Make sure the executor is not already running
+   if(context->running)
+      return ERROR_ALREADY_RUNNING;
+
+   //Start the executor
+   context->stop = FALSE;
+   context->running = TRUE;
+
+   //Create a task
+   context->taskId = osCreateTask("Socket Async", (OsTaskCode) socketAsyncTask,
+      context, &context->taskParams);
+
+   //Failed to create task?
+   if(context->taskId == OS_INVALID_TASK_ID)
+   {
+      //Clean up side effects
+      context->running = FALSE;
+      //Report an error
+      return ERROR_OUT_OF_RESOURCES;
+   }
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Stop the executor task
+ *
+ * Pending operations are left untouched and resume when the executor
+ * is restarted
+ *
+ * @param[in] context Pointer to the executor context
+ * @return Error code
+ **/
+
+error_t socketAsyncStop(SocketAsyncContext *context)
+{
+   //Make sure the executor context is valid
+   if(context == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Debug message
+   TRACE_INFO("Stopping asynchronous socket executor...\r\n");
+
+   //Check whether the executor is running
+   if(context->running)
+   {
+      //Stop the executor
+      context->stop = TRUE;
+      //Send a signal to the task to abort any blocking operation
+      osSetEvent(&context->event);
+
+      //Wait for the task to terminate
+      while(context->running)
+      {
+         osDelayTask(1);
+      }
+   }
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Hand a socket over to the executor
+ *
+ * The socket is switched to non-blocking mode (timeout of zero) so that the
+ * executor never blocks on it. The change is permanent: blocking calls made
+ * on the socket afterwards return ERROR_TIMEOUT instead of waiting. Sockets
+ * returned by an asynchronous accept operation are already attached
+ *
+ * @param[in] context Pointer to the executor context
+ * @param[in] socket Handle referencing the socket
+ * @return Error code
+ **/
+
+error_t socketAsyncAttach(SocketAsyncContext *context, Socket *socket)
+{
+   //Check parameters
+   if(context == NULL || socket == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Switch the socket to non-blocking mode
+   return socketSetTimeout(socket, 0);
+}
+
+
+/**
+ * @brief Initiate a connection asynchronously
+ *
+ * The SYN segment is sent immediately. The callback is invoked once the
+ * connection is established, refused or timed out
+ *
+ * @param[in] context Pointer to the executor context
+ * @param[in] op Caller-owned operation descriptor
+ * @param[in] socket Handle referencing the socket
+ * @param[in] remoteIpAddr IP address of the remote host
+ * @param[in] remotePort Remote port number that will be used to establish
+ *   the connection
+ * @param[in] timeout Maximum time to wait (INFINITE_DELAY to wait forever)
+ * @param[in] callback Completion callback
+ * @param[in] param User-defined parameter
+ * @return Error code
+ **/
+
+error_t socketAsyncConnect(SocketAsyncContext *context, SocketAsyncOp *op,
+   Socket *socket, const IpAddr *remoteIpAddr, uint16_t remotePort,
+   systime_t timeout, SocketAsyncCallback callback, void *param)
+{
+   //Check parameters
+   if(context == NULL || op == NULL || socket == NULL || remoteIpAddr == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Make sure the descriptor is not already in use
+   if(op->pending)
+      return ERROR_IN_PROGRESS;
+
+   //Initialize operation
+   osMemset(op, 0, sizeof(SocketAsyncOp));
+   op->type = SOCKET_ASYNC_OP_CONNECT;
+   op->socket = socket;
+   op->ipAddr = *remoteIpAddr;
+   op->port = remotePort;
+   op->timeout = timeout;
+   op->callback = callback;
+   op->param = param;
+
+   //Submit the operation
+   return socketAsyncSubmit(context, op);
+}
+
+
+/**
+ * @brief Accept an incoming connection asynchronously
+ * @param[in] context Pointer to the executor context
+ * @param[in] op Caller-owned operation descriptor
+ * @param[in] socket Handle referencing a socket in the listening state
+ * @param[in] timeout Maximum time to wait (INFINITE_DELAY to wait forever)
+ * @param[in] callback Completion callback. The new socket is available in
+ *   op->newSocket, and the client address in op->ipAddr and op->port
+ * @param[in] param User-defined parameter
+ * @return Error code
+ **/
+
+error_t socketAsyncAccept(SocketAsyncContext *context, SocketAsyncOp *op,
+   Socket *socket, systime_t timeout, SocketAsyncCallback callback,
+   void *param)
+{
+   //Check parameters
+   if(context == NULL || op == NULL || socket == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Make sure the descriptor is not already in use
+   if(op->pending)
+      return ERROR_IN_PROGRESS;
+
+   //Initialize operation
+   osMemset(op, 0, sizeof(SocketAsyncOp));
+   op->type = SOCKET_ASYNC_OP_ACCEPT;
+   op->socket = socket;
+   op->timeout = timeout;
+   op->callback = callback;
+   op->param = param;
+
+   //Submit the operation
+   return socketAsyncSubmit(context, op);
+}
+
+
+/**
+ * @brief Send data asynchronously
+ *
+ * The operation completes once the whole buffer has been copied to the
+ * socket's send buffer. The buffer must remain valid until then
+ *
+ * @param[in] context Pointer to the executor context
+ * @param[in] op Caller-owned operation descriptor
+ * @param[in] socket Handle referencing a connected socket
+ * @param[in] data Pointer to a buffer containing the data to be transmitted
+ * @param[in] length Number of data bytes to send
+ * @param[in] flags Set of flags that influences the behavior of this function
+ * @param[in] timeout Maximum time to wait (INFINITE_DELAY to wait forever)
+ * @param[in] callback Completion callback
+ * @param[in] param User-defined parameter
+ * @return Error code
+ **/
+
+error_t socketAsyncSend(SocketAsyncContext *context, SocketAsyncOp *op,
+   Socket *socket, const void *data, size_t length, uint_t flags,
+   systime_t timeout, SocketAsyncCallback callback, void *param)
+{
+   //Check parameters
+   if(context == NULL || op == NULL || socket == NULL)
+      return ERROR_INVALID_PARAMETER;
+   if(data == NULL && length != 0)
+      return ERROR_INVALID_PARAMETER;
+
+   //Make sure the descriptor is not already in use
+   if(op->pending)
+      return ERROR_IN_PROGRESS;
+
+   //Initialize operation
+   osMemset(op, 0, sizeof(SocketAsyncOp));
+   op->type = SOCKET_ASYNC_OP_SEND;
+   op->socket = socket;
+   op->data = (uint8_t *) data;
+   op->size = length;
+   //Waiting for the acknowledgment is not supported in asynchronous mode
+   op->flags = flags & ~SOCKET_FLAG_WAIT_ACK;
+   op->timeout = timeout;
+   op->callback = callback;
+   op->param = param;
+
+   //Submit the operation
+   return socketAsyncSubmit(context, op);
+}
+
+
+/**
+ * @brief Receive data asynchronously
+ *
+ * The operation completes as soon as some data is available. The
+ * SOCKET_FLAG_WAIT_ALL and SOCKET_FLAG_BREAK_CHAR flags can be used to
+ * delay completion until the buffer is full or the break character has
+ * been received
+ *
+ * @param[in] context Pointer to the executor context
+ * @param[in] op Caller-owned operation descriptor
+ * @param[in] socket Handle referencing a socket
+ * @param[out] data Buffer where to store the incoming data
+ * @param[in] size Maximum number of bytes that can be received
+ * @param[in] flags Set of flags that influences the behavior of this function
+ * @param[in] timeout Maximum time to wait (INFINITE_DELAY to wait forever)
+ * @param[in] callback Completion callback. The number of bytes received is
+ *   available in op->length
+ * @param[in] param User-defined parameter
+ * @return Error code
+ **/
+
+error_t socketAsyncReceive(SocketAsyncContext *context, SocketAsyncOp *op,
+   Socket *socket, void *data, size_t size, uint_t flags,
+   systime_t timeout, SocketAsyncCallback callback, void *param)
+{
+   //Check parameters
+   if(context == NULL || op == NULL || socket == NULL || data == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Make sure the descriptor is not already in use
+   if(op->pending)
+      return ERROR_IN_PROGRESS;
+
+   //Initialize operation
+   osMemset(op, 0, sizeof(SocketAsyncOp));
+   op->type = SOCKET_ASYNC_OP_RECEIVE;
+   op->socket = socket;
+   op->data = data;
+   op->size = size;
+   op->flags = flags;
+   op->timeout = timeout;
+   op->callback = callback;
+   op->param = param;
+
+   //Submit the operation
+   return socketAsyncSubmit(context, op);
+}
+
+
+/**
+ * @brief Shut down a connection asynchronously
+ *
+ * The FIN segment is sent once all the data in the send buffer has been
+ * transmitted. The operation completes when the FIN has been acknowledged
+ * (SOCKET_SD_SEND), or when the peer's FIN has been received as well
+ * (SOCKET_SD_BOTH). The socket can then be closed without resetting the
+ * connection
+ *
+ * @param[in] context Pointer to the executor context
+ * @param[in] op Caller-owned operation descriptor
+ * @param[in] socket Handle referencing a connected TCP socket
+ * @param[in] how Flag that describes what types of operation will no longer
+ *   be allowed
+ * @param[in] timeout Maximum time to wait (INFINITE_DELAY to wait forever)
+ * @param[in] callback Completion callback
+ * @param[in] param User-defined parameter
+ * @return Error code
+ **/
+
+error_t socketAsyncShutdown(SocketAsyncContext *context, SocketAsyncOp *op,
+   Socket *socket, uint_t how, systime_t timeout,
+   SocketAsyncCallback callback, void *param)
+{
+   //Check parameters
+   if(context == NULL || op == NULL || socket == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Only stream sockets can be shut down gracefully
+   if(socket->type != SOCKET_TYPE_STREAM)
+      return ERROR_INVALID_SOCKET;
+
+   //Make sure the descriptor is not already in use
+   if(op->pending)
+      return ERROR_IN_PROGRESS;
+
+   //Initialize operation
+   osMemset(op, 0, sizeof(SocketAsyncOp));
+   op->type = SOCKET_ASYNC_OP_SHUTDOWN;
+   op->socket = socket;
+   op->flags = how;
+   op->timeout = timeout;
+   op->callback = callback;
+   op->param = param;
+
+   //Submit the operation
+   return socketAsyncSubmit(context, op);
+}
+
+
+/**
+ * @brief Start a one-shot timer
+ * @param[in] context Pointer to the executor context
+ * @param[in] op Caller-owned operation descriptor
+ * @param[in] delay Time after which the callback is invoked
+ * @param[in] callback Completion callback
+ * @param[in] param User-defined parameter
+ * @return Error code
+ **/
+
+error_t socketAsyncStartTimer(SocketAsyncContext *context, SocketAsyncOp *op,
+   systime_t delay, SocketAsyncCallback callback, void *param)
+{
+   //Check parameters
+   if(context == NULL || op == NULL || delay == INFINITE_DELAY)
+      return ERROR_INVALID_PARAMETER;
+
+   //Make sure the descriptor is not already in use
+   if(op->pending)
+      return ERROR_IN_PROGRESS;
+
+   //Initialize operation
+   osMemset(op, 0, sizeof(SocketAsyncOp));
+   op->type = SOCKET_ASYNC_OP_TIMER;
+   op->timeout = delay;
+   op->callback = callback;
+   op->param = param;
+
+   //Submit the operation
+   return socketAsyncSubmit(context, op);
+}
+
+
+/**
+ * @brief Defer the execution of a callback to the executor task
+ * @param[in] context Pointer to the executor context
+ * @param[in] op Caller-owned operation descriptor
+ * @param[in] callback Function to be invoked by the executor
+ * @param[in] param User-defined parameter
+ * @return Error code
+ **/
+
+error_t socketAsyncPost(SocketAsyncContext *context, SocketAsyncOp *op,
+   SocketAsyncCallback callback, void *param)
+{
+   //Check parameters
+   if(context == NULL || op == NULL || callback == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Make sure the descriptor is not already in use
+   if(op->pending)
+      return ERROR_IN_PROGRESS;
+
+   //Initialize operation
+   osMemset(op, 0, sizeof(SocketAsyncOp));
+   op->type = SOCKET_ASYNC_OP_POST;
+   op->timeout = INFINITE_DELAY;
+   op->callback = callback;
+   op->param = param;
+
+   //Submit the operation
+   return socketAsyncSubmit(context, op);
+}
+
+
+/**
+ * @brief Cancel a pending operation
+ *
+ * The completion callback is invoked with ERROR_ABORTED. Operations whose
+ * completion has already been queued are not affected
+ *
+ * @param[in] context Pointer to the executor context
+ * @param[in] op Operation to be cancelled
+ * @return Error code
+ **/
+
+error_t socketAsyncCancel(SocketAsyncContext *context, SocketAsyncOp *op)
+{
+   error_t error;
+   SocketAsyncOp **p;
+
+   //Check parameters
+   if(context == NULL || op == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Initialize status code
+   error = ERROR_NOT_FOUND;
+
+   //Acquire exclusive access to the operation lists
+   osAcquireMutex(&context->mutex);
+
+   //Search the list of pending operations
+   for(p = &context->pendingList; *p != NULL; p = &(*p)->next)
+   {
+      //Matching entry?
+      if(*p == op)
+      {
+         //Remove the operation from the list
+         *p = op->next;
+
+         //Report the cancellation to the user
+         op->error = ERROR_ABORTED;
+         socketAsyncComplete(context, op);
+
+         //Successful processing
+         error = NO_ERROR;
+         break;
+      }
+   }
+
+   //Release exclusive access to the operation lists
+   osReleaseMutex(&context->mutex);
+
+   //Wake up the executor so that the callback is invoked
+   if(!error)
+   {
+      osSetEvent(&context->event);
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Executor task
+ * @param[in] context Pointer to the executor context
+ **/
+
+void socketAsyncTask(SocketAsyncContext *context)
+{
+   uint_t i;
+   uint_t n;
+   uint_t mask;
+   systime_t time;
+   systime_t timeout;
+   systime_t deadline;
+   bool_t completed;
+   SocketAsyncOp *op;
+   SocketAsyncOp **p;
+
+   //Task prologue
+   osEnterTask();
+
+   //Process events
+   while(1)
+   {
+      //Get current time
+      time = osGetSystemTime();
+      //Maximum time to wait for an event
+      timeout = SOCKET_ASYNC_TICK_INTERVAL;
+      //Number of socket descriptors
+      n = 0;
+
+      //Acquire exclusive access to the operation lists
+      osAcquireMutex(&context->mutex);
+
+      //Loop through the pending operations
+      for(p = &context->pendingList; *p != NULL; )
+      {
+         //Point to the current operation
+         op = *p;
+
+         //Bounded operation?
+         if(op->timeout != INFINITE_DELAY)
+         {
+            //Compute the time at which the operation expires
+            deadline = op->timestamp + op->timeout;
+
+            //Expired operation?
+            if(timeCompare(time, deadline) >= 0)
+            {
+               //Remove the operation from the list
+               *p = op->next;
+
+               //Timers complete successfully while I/O operations time out
+               op->error = (op->type == SOCKET_ASYNC_OP_TIMER) ?
+                  NO_ERROR : ERROR_TIMEOUT;
+
+               //Queue the completion
+               socketAsyncComplete(context, op);
+               continue;
+            }
+
+            //Wake up in time to handle the expiration
+            timeout = MIN(timeout, deadline - time);
+         }
+
+         //Operation bound to a socket?
+         if(op->socket != NULL)
+         {
+            //Retrieve the events the operation is waiting for
+            mask = socketAsyncGetEventMask(op);
+
+            //Several operations may share the same socket
+            for(i = 0; i < n; i++)
+            {
+               if(context->eventDesc[i].socket == op->socket)
+                  break;
+            }
+
+            //New socket?
+            if(i == n && n < SOCKET_MAX_COUNT)
+            {
+               context->eventDesc[n].socket = op->socket;
+               context->eventDesc[n].eventMask = 0;
+               context->eventDesc[n].eventFlags = 0;
+               n++;
+            }
+
+            //Merge the event masks
+            if(i < n)
+            {
+               context->eventDesc[i].eventMask |= mask;
+            }
+         }
+
+         //Point to the next operation
+         p = &op->next;
+      }
+
+      //Any completion waiting to be dispatched?
+      completed = (context->completedList != NULL) ? TRUE : FALSE;
+
+      //Release exclusive access to the operation lists
+      osReleaseMutex(&context->mutex);
+
+      //Completions are dispatched without further delay
+      if(!completed)
+      {
+         //Any socket to monitor?
+         if(n > 0)
+         {
+            //Wait for an event
+            socketPoll(context->eventDesc, n, &context->event, timeout);
+         }
+         else
+         {
+            //Wait for a new operation to be submitted
+            osWaitForEvent(&context->event, timeout);
+         }
+      }
+
+      //Stop request?
+      if(context->stop)
+      {
+         //Stop executor operation
+         context->running = FALSE;
+         //Task epilogue
+         osExitTask();
+         //Kill ourselves
+         osDeleteTask(OS_SELF_TASK_ID);
+      }
+
+      //Acquire exclusive access to the operation lists
+      osAcquireMutex(&context->mutex);
+
+      //Loop through the pending operations
+      for(p = &context->pendingList; *p != NULL; )
+      {
+         //Point to the current operation
+         op = *p;
+
+         //Operation bound to a socket?
+         if(op->socket != NULL)
+         {
+            //Search for the matching descriptor
+            for(i = 0; i < n; i++)
+            {
+               if(context->eventDesc[i].socket == op->socket)
+                  break;
+            }
+
+            //Is the socket ready to perform the requested I/O?
+            if(i < n && (context->eventDesc[i].eventFlags &
+               socketAsyncGetEventMask(op)) != 0)
+            {
+               //Perform the I/O in non-blocking mode
+               if(socketAsyncProcessOp(op))
+               {
+                  //Remove the operation from the list
+                  *p = op->next;
+                  //Queue the completion
+                  socketAsyncComplete(context, op);
+                  continue;
+               }
+            }
+         }
+
+         //Point to the next operation
+         p = &op->next;
+      }
+
+      //Release exclusive access to the operation lists
+      osReleaseMutex(&context->mutex);
+
+      //Invoke completion callbacks
+      socketAsyncDispatch(context);
+   }
+}
+
+
+/**
+ * @brief Release executor context
+ * @param[in] context Pointer to the executor context
+ **/
+
+void socketAsyncDeinit(SocketAsyncContext *context)
+{
+   //Make sure the executor context is valid
+   if(context != NULL)
+   {
+      //Free previously allocated resources
+      osDeleteMutex(&context->mutex);
+      osDeleteEvent(&context->event);
+
+      //Clear executor context
+      osMemset(context, 0, sizeof(SocketAsyncContext));
+   }
+}
+
+
+/**
+ * @brief Submit an operation to the executor
+ * @param[in] context Pointer to the executor context
+ * @param[in] op Operation to be submitted
+ * @return Error code
+ **/
+
+static error_t socketAsyncSubmit(SocketAsyncContext *context,
+   SocketAsyncOp *op)
+{
+   SocketAsyncOp **p;
+
+   //The executor must never block on the socket. The socket has to be
+   //attached beforehand (refer to socketAsyncAttach)
+   if(op->socket != NULL && op->socket->timeout != 0)
+      return ERROR_WRONG_STATE;
+
+   //Save the time at which the operation was submitted
+   op->timestamp = osGetSystemTime();
+   //The operation is now in progress
+   op->error = ERROR_IN_PROGRESS;
+
+   //A connection attempt or a shutdown must be initiated immediately so
+   //that the executor can wait for its outcome
+   if(op->type == SOCKET_ASYNC_OP_CONNECT ||
+      op->type == SOCKET_ASYNC_OP_SHUTDOWN)
+   {
+      socketAsyncProcessOp(op);
+   }
+   else if(op->type == SOCKET_ASYNC_OP_POST)
+   {
+      //Posted callbacks complete immediately
+      op->error = NO_ERROR;
+   }
+
+   //Acquire exclusive access to the operation lists
+   osAcquireMutex(&context->mutex);
+
+   //The descriptor belongs to the executor until completion
+   op->pending = TRUE;
+
+   //Check whether the operation is still in progress
+   if(op->error == ERROR_IN_PROGRESS)
+   {
+      //Append the operation to the pending list
+      for(p = &context->pendingList; *p != NULL; p = &(*p)->next)
+      {
+      }
+
+      op->next = NULL;
+      *p = op;
+   }
+   else
+   {
+      //Queue the completion
+      socketAsyncComplete(context, op);
+   }
+
+   //Release exclusive access to the operation lists
+   osReleaseMutex(&context->mutex);
+
+   //Wake up the executor
+   osSetEvent(&context->event);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Perform a non-blocking attempt to complete an operation
+ * @param[in] op Operation to be processed
+ * @return TRUE if the operation has completed, else FALSE
+ **/
+
+static bool_t socketAsyncProcessOp(SocketAsyncOp *op)
+{
+   error_t error;
+   size_t n;
+   bool_t completed;
+
+   //Initialize variables
+   n = 0;
+   completed = FALSE;
+
+   //Check operation type
+   switch(op->type)
+   {
+   //Connect operation?
+   case SOCKET_ASYNC_OP_CONNECT:
+      //Establish the connection (or check the outcome of a previous attempt)
+      error = socketConnect(op->socket, &op->ipAddr, op->port);
+
+      //The connection is still being established?
+      if(error == ERROR_TIMEOUT || error == ERROR_WOULD_BLOCK)
+      {
+      }
+      else
+      {
+         op->error = error;
+         completed = TRUE;
+      }
+
+      break;
+
+   //Accept operation?
+   case SOCKET_ASYNC_OP_ACCEPT:
+      //Extract the first connection request from the queue
+      op->newSocket = socketAccept(op->socket, &op->ipAddr, &op->port);
+
+      //Any connection request pending?
+      if(op->newSocket != NULL)
+      {
+         //The new socket is attached to the executor
+         socketSetTimeout(op->newSocket, 0);
+
+         op->error = NO_ERROR;
+         completed = TRUE;
+      }
+
+      break;
+
+   //Send operation?
+   case SOCKET_ASYNC_OP_SEND:
+      //Copy as much data as possible to the send buffer
+      error = socketSend(op->socket, op->data + op->length,
+         op->size - op->length, &n, op->flags);
+
+      //Total number of bytes written
+      op->length += n;
+
+      //The send buffer is full?
+      if(error == ERROR_TIMEOUT || error == ERROR_WOULD_BLOCK)
+      {
+         error = NO_ERROR;
+      }
+
+      //Check status code
+      if(error)
+      {
+         op->error = error;
+         completed = TRUE;
+      }
+      else if(op->length >= op->size)
+      {
+         op->error = NO_ERROR;
+         completed = TRUE;
+      }
+
+      break;
+
+   //Receive operation?
+   case SOCKET_ASYNC_OP_RECEIVE:
+      //Read the data that is currently available
+      error = socketReceiveEx(op->socket, &op->ipAddr, &op->port, NULL,
+         op->data + op->length, op->size - op->length, &n,
+         op->flags & ~SOCKET_FLAG_WAIT_ALL);
+
+      //Total number of bytes read
+      op->length += n;
+
+      //No more data available for the moment?
+      if(error == ERROR_TIMEOUT || error == ERROR_WOULD_BLOCK)
+      {
+         error = NO_ERROR;
+      }
+      //The peer has closed the connection?
+      else if(error == ERROR_END_OF_STREAM && op->length > 0)
+      {
+         //The user must be satisfied with data already on hand
+         op->error = NO_ERROR;
+         completed = TRUE;
+         break;
+      }
+
+      //Check status code
+      if(error)
+      {
+         op->error = error;
+         completed = TRUE;
+      }
+      else if(op->length >= op->size)
+      {
+         //The buffer is full
+         op->error = NO_ERROR;
+         completed = TRUE;
+      }
+      else if((op->flags & SOCKET_FLAG_BREAK_CHAR) != 0)
+      {
+         //Check whether the break character has been received
+         if(n > 0 && op->data[op->length - 1] == LSB(op->flags))
+         {
+            op->error = NO_ERROR;
+            completed = TRUE;
+         }
+      }
+      else if((op->flags & SOCKET_FLAG_WAIT_ALL) == 0 && op->length > 0)
+      {
+         //Return as soon as some data is available
+         op->error = NO_ERROR;
+         completed = TRUE;
+      }
+      else
+      {
+         //Wait for more data
+      }
+
+      break;
+
+   //Shutdown operation?
+   case SOCKET_ASYNC_OP_SHUTDOWN:
+      //Send the FIN segment as soon as the send buffer is empty (or check
+      //whether the shutdown sequence has progressed)
+      error = socketShutdown(op->socket, op->flags);
+
+      //The shutdown sequence is still in progress?
+      if(error == ERROR_TIMEOUT || error == ERROR_WOULD_BLOCK)
+      {
+      }
+      else
+      {
+         op->error = error;
+         completed = TRUE;
+      }
+
+      break;
+
+   //Timers and posted callbacks?
+   default:
+      //These operations are not driven by socket events
+      break;
+   }
+
+   //Return TRUE if the operation has completed
+   return completed;
+}
+
+
+/**
+ * @brief Retrieve the socket events an operation is waiting for
+ * @param[in] op Pending operation
+ * @return Event mask
+ **/
+
+static uint_t socketAsyncGetEventMask(SocketAsyncOp *op)
+{
+   uint_t mask;
+
+   //Check operation type
+   switch(op->type)
+   {
+   case SOCKET_ASYNC_OP_CONNECT:
+      mask = SOCKET_EVENT_CONNECTED | SOCKET_EVENT_CLOSED;
+      break;
+   case SOCKET_ASYNC_OP_ACCEPT:
+      mask = SOCKET_EVENT_ACCEPT;
+      break;
+   case SOCKET_ASYNC_OP_SEND:
+      mask = SOCKET_EVENT_TX_READY;
+      break;
+   case SOCKET_ASYNC_OP_RECEIVE:
+      mask = SOCKET_EVENT_RX_READY;
+      break;
+#if (TCP_SUPPORT == ENABLED)
+   case SOCKET_ASYNC_OP_SHUTDOWN:
+      //Data still waiting in the send buffer?
+      if(op->socket->sndUser > 0)
+      {
+         mask = SOCKET_EVENT_TX_DONE;
+      }
+      //FIN segment not yet acknowledged?
+      else if(op->socket->state == TCP_STATE_FIN_WAIT_1 ||
+         op->socket->state == TCP_STATE_CLOSING ||
+         op->socket->state == TCP_STATE_LAST_ACK)
+      {
+         mask = SOCKET_EVENT_TX_SHUTDOWN;
+      }
+      //Waiting for the peer's FIN segment
+      else
+      {
+         mask = SOCKET_EVENT_RX_SHUTDOWN;
+      }
+
+      //A reset also terminates the shutdown sequence
+      mask |= SOCKET_EVENT_CLOSED;
+      break;
+#endif
+   default:
+      mask = SOCKET_EVENT_NONE;
+      break;
+   }
+
+   //Return the event mask
+   return mask;
+}
+
+
+/**
+ * @brief Queue the completion of an operation
+ *
+ * This function must be called with the executor mutex held
+ *
+ * @param[in] context Pointer to the executor context
+ * @param[in] op Completed operation
+ **/
+
+static void socketAsyncComplete(SocketAsyncContext *context, SocketAsyncOp *op)
+{
+   SocketAsyncOp **p;
+
+   //Completions are dispatched in the order they occur
+   for(p = &context->completedList; *p != NULL; p = &(*p)->next)
+   {
+   }
+
+   //Append the operation to the completion list
+   op->next = NULL;
+   *p = op;
+}
+
+
+/**
+ * @brief Invoke the callbacks of completed operations
+ * @param[in] context Pointer to the executor context
+ **/
+
+static void socketAsyncDispatch(SocketAsyncContext *context)
+{
+   SocketAsyncOp *op;
+
+   //Process all the completed operations
+   while(1)
+   {
+      //Acquire exclusive access to the operation lists
+      osAcquireMutex(&context->mutex);
+
+      //Extract the first completed operation
+      op = context->completedList;
+
+      //Any operation in the list?
+      if(op != NULL)
+      {
+         context->completedList = op->next;
+         op->next = NULL;
+
+         //The descriptor is given back to the user
+         op->pending = FALSE;
+      }
+
+      //Release exclusive access to the operation lists
+      osReleaseMutex(&context->mutex);
+
+      //The list is empty?
+      if(op == NULL)
+         break;
+
+      //Invoke the completion callback outside of the critical section, so
+      //that new operations can be submitted from the callback
+      if(op->callback != NULL)
+      {
+         op->callback(context, op, op->error);
+      }
+   }
+}
+
+#endif
@@ -0,0 +1,214 @@
+/**
+ * @file socket_async.h
+ * @brief Completion-based asynchronous socket API
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+#ifndef _SOCKET_ASYNC_H
+#define _SOCKET_ASYNC_H
+
+//Dependencies
+#include "core/net.h"
+#include "core/socket.h"
+
+//Asynchronous socket API support
+#ifndef SOCKET_ASYNC_SUPPORT
+   #define SOCKET_ASYNC_SUPPORT DISABLED
+#elif (SOCKET_ASYNC_SUPPORT != ENABLED && SOCKET_ASYNC_SUPPORT != DISABLED)
+   #error SOCKET_ASYNC_SUPPORT parameter is not valid
+#endif
+
+//Stack size required to run the executor task
+#ifndef SOCKET_ASYNC_STACK_SIZE
+   #define SOCKET_ASYNC_STACK_SIZE 650
+#elif (SOCKET_ASYNC_STACK_SIZE < 1)
+   #error SOCKET_ASYNC_STACK_SIZE parameter is not valid
+#endif
+
+//Priority at which the executor task should run
+#ifndef SOCKET_ASYNC_PRIORITY
+   #define SOCKET_ASYNC_PRIORITY OS_TASK_PRIORITY_NORMAL
+#endif
+
+//Maximum time the executor sleeps when no operation is pending
+#ifndef SOCKET_ASYNC_TICK_INTERVAL
+   #define SOCKET_ASYNC_TICK_INTERVAL 1000
+#elif (SOCKET_ASYNC_TICK_INTERVAL < 10)
+   #error SOCKET_ASYNC_TICK_INTERVAL parameter is not valid
+#endif
+
+//Forward declaration of SocketAsyncContext structure
+struct _SocketAsyncContext;
+#define SocketAsyncContext struct _SocketAsyncContext
+
+//Forward declaration of SocketAsyncOp structure
+struct _SocketAsyncOp;
+#define SocketAsyncOp struct _SocketAsyncOp
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Asynchronous operation types
+ **/
+
+typedef enum
+{
+   SOCKET_ASYNC_OP_NONE     = 0,
+   SOCKET_ASYNC_OP_CONNECT  = 1,
+   SOCKET_ASYNC_OP_ACCEPT   = 2,
+   SOCKET_ASYNC_OP_SEND     = 3,
+   SOCKET_ASYNC_OP_RECEIVE  = 4,
+   SOCKET_ASYNC_OP_TIMER    = 5,
+   SOCKET_ASYNC_OP_POST     = 6,
+   SOCKET_ASYNC_OP_SHUTDOWN = 7
+} SocketAsyncOpType;
+
+
+/**
+ * @brief Completion callback function
+ *
+ * Completion callbacks are always invoked from the executor task, never
+ * from the task that submitted the operation. A callback may submit new
+ * operations, including reusing the operation that has just completed
+ *
+ **/
+
+typedef void (*SocketAsyncCallback)(SocketAsyncContext *context,
+   SocketAsyncOp *op, error_t error);
+
+
+/**
+ * @brief Asynchronous operation
+ *
+ * The memory backing an operation is owned by the caller and must remain
+ * valid until the completion callback has been invoked
+ *
+ **/
+
+struct _SocketAsyncOp
+{
+   SocketAsyncOp *next;          ///<Next operation in the list
+   SocketAsyncOpType type;       ///<Operation type
+   bool_t pending;               ///<The operation has been submitted and not yet completed
+   Socket *socket;               ///<Underlying socket
+   SocketAsyncCallback callback; ///<Completion callback
+   void *param;                  ///<User-defined parameter
+   IpAddr ipAddr;                ///<Remote IP address (connect, accept, receive)
+   uint16_t port;                ///<Remote port number (connect, accept, receive)
+   Socket *newSocket;            ///<Newly accepted socket
+   uint8_t *data;                ///<Data buffer (send, receive)
+   size_t size;                  ///<Size of the data buffer, in bytes
+   size_t length;                ///<Number of bytes actually transferred
+   uint_t flags;                 ///<Send/receive flags
+   systime_t timestamp;          ///<Time at which the operation was submitted
+   systime_t timeout;            ///<Maximum time to complete the operation
+   error_t error;                ///<Completion status
+};
+
+
+/**
+ * @brief Executor settings
+ **/
+
+typedef struct
+{
+   OsTaskParameters task; ///<Task parameters
+} SocketAsyncSettings;
+
+
+/**
+ * @brief Executor context
+ **/
+
+struct _SocketAsyncContext
+{
+   SocketAsyncSettings settings;                ///<User settings
+   bool_t running;                              ///<Operational state of the executor
+   bool_t stop;                                 ///<Stop request
+   OsMutex mutex;                               ///<Mutex protecting the operation lists
+   OsEvent event;                               ///<Event object used to wake up the executor
+   OsTaskParameters taskParams;                 ///<Task parameters
+   OsTaskId taskId;                             ///<Task identifier
+   SocketAsyncOp *pendingList;                  ///<Operations waiting for an event
+   SocketAsyncOp *completedList;                ///<Operations whose callback has not yet run
+   SocketEventDesc eventDesc[SOCKET_MAX_COUNT]; ///<Socket event descriptors
+};
+
+
+//Asynchronous socket API
+void socketAsyncGetDefaultSettings(SocketAsyncSettings *settings);
+
+error_t socketAsyncInit(SocketAsyncContext *context,
+   const SocketAsyncSettings *settings);
+
+error_t socketAsyncStart(SocketAsyncContext *context);
+error_t socketAsyncStop(SocketAsyncContext *context);
+
+error_t socketAsyncAttach(SocketAsyncContext *context, Socket *socket);
+
+error_t socketAsyncConnect(SocketAsyncContext *context, SocketAsyncOp *op,
+   Socket *socket, const IpAddr *remoteIpAddr, uint16_t remotePort,
+   systime_t timeout, SocketAsyncCallback callback, void *param);
+
+error_t socketAsyncAccept(SocketAsyncContext *context, SocketAsyncOp *op,
+   Socket *socket, systime_t timeout, SocketAsyncCallback callback,
+   void *param);
+
+error_t socketAsyncSend(SocketAsyncContext *context, SocketAsyncOp *op,
+   Socket *socket, const void *data, size_t length, uint_t flags,
+   systime_t timeout, SocketAsyncCallback callback, void *param);
+
+error_t socketAsyncReceive(SocketAsyncContext *context, SocketAsyncOp *op,
+   Socket *socket, void *data, size_t size, uint_t flags,
+   systime_t timeout, SocketAsyncCallback callback, void *param);
+
+error_t socketAsyncShutdown(SocketAsyncContext *context, SocketAsyncOp *op,
+   Socket *socket, uint_t how, systime_t timeout,
+   SocketAsyncCallback callback, void *param);
+
+error_t socketAsyncStartTimer(SocketAsyncContext *context, SocketAsyncOp *op,
+   systime_t delay, SocketAsyncCallback callback, void *param);
+
+error_t socketAsyncPost(SocketAsyncContext *context, SocketAsyncOp *op,
+   SocketAsyncCallback callback, void *param);
+
+error_t socketAsyncCancel(SocketAsyncContext *context, SocketAsyncOp *op);
+
+void socketAsyncTask(SocketAsyncContext *context);
+
+void socketAsyncDeinit(SocketAsyncContext *context);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
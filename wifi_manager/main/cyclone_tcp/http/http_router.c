@@ -0,0 +1,683 @@
+/**
+ * @file http_router.c
+ * @brief HTTP request router
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * The router maps a request method and path to an application handler.
+ * Route patterns are stored in a trie keyed on path segments, so the cost
+ * of a lookup depends on the depth of the requested path and not on the
+ * number of registered routes. Segments can be literals, parameters
+ * (":name") capturing one segment, or a trailing wildcard ("*name")
+ * capturing the rest of the path
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL HTTP_TRACE_LEVEL
+
+//Dependencies
+#include "core/net.h"
+#include "http/http_server.h"
+#include "http/http_router.h"
+#include "str.h"
+#include "debug.h"
+
+//Check TCP/IP stack configuration
+#if (HTTP_SERVER_SUPPORT == ENABLED)
+
+
+/**
+ * @brief Request methods known to the router
+ **/
+
+static const struct
+{
+   const char_t *name;
+   uint_t flag;
+} httpRouteMethodList[] =
+{
+   {"GET",     HTTP_ROUTE_METHOD_GET},
+   {"HEAD",    HTTP_ROUTE_METHOD_HEAD},
+   {"POST",    HTTP_ROUTE_METHOD_POST},
+   {"PUT",     HTTP_ROUTE_METHOD_PUT},
+   {"DELETE",  HTTP_ROUTE_METHOD_DELETE},
+   {"PATCH",   HTTP_ROUTE_METHOD_PATCH},
+   {"OPTIONS", HTTP_ROUTE_METHOD_OPTIONS}
+};
+
+
+/**
+ * @brief Initialize a router
+ * @param[in] router Pointer to the router
+ **/
+
+void httpRouterInit(HttpRouter *router)
+{
+   //Clear the routing trie
+   osMemset(router, 0, sizeof(HttpRouter));
+
+   //The root node stands for the "/" path
+   router->nodeCount = 1;
+}
+
+
+/**
+ * @brief Register a route
+ *
+ * The route definition is not copied and must remain valid as long as the
+ * router is in use
+ *
+ * @param[in] router Pointer to the router
+ * @param[in] route Route definition
+ * @return Error code
+ **/
+
+error_t httpRouterAddRoute(HttpRouter *router, const HttpRoute *route)
+{
+   error_t error;
+   uint_t i;
+   uint_t index;
+   uint_t depth;
+   uint_t paramCount;
+   size_t n;
+   const char_t *p;
+   HttpRouterNode *node;
+
+   //Check parameters
+   if(router == NULL || route == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Make sure the route definition is valid
+   if(route->path == NULL || route->callback == NULL ||
+      (route->methods & HTTP_ROUTE_METHOD_ANY) == 0)
+   {
+      return ERROR_INVALID_PARAMETER;
+   }
+
+   //Make sure there is room for a new route
+   if(router->routeCount >= HTTP_ROUTER_MAX_ROUTES)
+      return ERROR_OUT_OF_RESOURCES;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Start from the root node
+   index = 0;
+   depth = 0;
+   paramCount = 0;
+
+   //Point to the route pattern
+   p = route->path;
+
+   //Parse the pattern segment by segment
+   while(!error)
+   {
+      //Skip separators
+      while(*p == '/')
+      {
+         p++;
+      }
+
+      //End of pattern?
+      if(*p == '\0')
+         break;
+
+      //Compute the length of the current segment
+      for(n = 0; p[n] != '\0' && p[n] != '/'; n++)
+      {
+      }
+
+      //A wildcard must be the last segment of the pattern
+      if(router->nodes[index].type == HTTP_ROUTER_NODE_WILDCARD)
+      {
+         error = ERROR_INVALID_SYNTAX;
+      }
+      else if(depth >= HTTP_ROUTER_MAX_DEPTH)
+      {
+         error = ERROR_INVALID_SYNTAX;
+      }
+      else
+      {
+         //Parameters and wildcards capture a value
+         if(p[0] == ':' || p[0] == '*')
+            paramCount++;
+
+         //Make sure a match can hold all the captured values
+         if(paramCount > HTTP_ROUTER_MAX_PARAMS)
+         {
+            error = ERROR_INVALID_SYNTAX;
+         }
+         else
+         {
+            //Retrieve the corresponding child node
+            error = httpRouterGetNode(router, index, p, n, &index);
+         }
+      }
+
+      //Next segment
+      p += n;
+      depth++;
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Point to the node the pattern ends at
+      node = &router->nodes[index];
+
+      //A given method can only be handled by one route per pattern
+      if((node->methods & route->methods) != 0)
+      {
+         error = ERROR_ALREADY_CONFIGURED;
+      }
+      else
+      {
+         //Save the route
+         i = router->routeCount++;
+         router->routes[i] = route;
+
+         //Attach the route to the node
+         router->nextRoute[i] = node->firstRoute;
+         node->firstRoute = i + 1;
+         node->methods |= route->methods & HTTP_ROUTE_METHOD_ANY;
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Register a table of routes
+ * @param[in] router Pointer to the router
+ * @param[in] routes Route definitions (typically a constant table)
+ * @param[in] count Number of entries in the table
+ * @return Error code
+ **/
+
+error_t httpRouterAddRoutes(HttpRouter *router, const HttpRoute *routes,
+   uint_t count)
+{
+   error_t error;
+   uint_t i;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Register each route in turn
+   for(i = 0; i < count && !error; i++)
+   {
+      error = httpRouterAddRoute(router, &routes[i]);
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Dispatch a request to the matching route
+ *
+ * A path that matches a route for another method is answered with a
+ * 405 status code. ERROR_NOT_FOUND is returned when no route matches the
+ * path, so that the caller can fall back to static resources
+ *
+ * @param[in] router Pointer to the router
+ * @param[in] connection Structure representing an HTTP connection
+ * @param[in] uri NULL-terminated string containing the path to the requested resource
+ * @return Error code
+ **/
+
+error_t httpRouterDispatch(HttpRouter *router, HttpConnection *connection,
+   const char_t *uri)
+{
+   error_t error;
+   uint_t i;
+   uint_t method;
+   uint_t allowed;
+   char_t *p;
+   HttpRouteMatch match;
+   char_t allow[48];
+
+   //Check parameters
+   if(router == NULL || connection == NULL || uri == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Identify the request method
+   method = httpRouterGetMethod(connection->request.method);
+
+   //Search the routing trie
+   error = httpRouterLookup(router, method, uri, &match, &allowed);
+
+   //Check status code
+   if(!error)
+   {
+      //Invoke the route handler
+      error = match.route->callback(connection, &match, match.route->param);
+   }
+   else if(allowed != 0)
+   {
+      //Debug message
+      TRACE_DEBUG("HTTP router: method %s not allowed for %s\r\n",
+         connection->request.method, uri);
+
+      //Point to the beginning of the buffer
+      p = allow;
+      p[0] = '\0';
+
+      //List the methods supported by the target resource
+      for(i = 0; i < arraysize(httpRouteMethodList); i++)
+      {
+         //Method supported?
+         if((allowed & httpRouteMethodList[i].flag) != 0)
+         {
+            p += osSprintf(p, "%s%s", (p == allow) ? "" : ", ",
+               httpRouteMethodList[i].name);
+         }
+      }
+
+      //Set Allow field
+      connection->response.allow = allow;
+
+      //Send an error 405
+      error = httpSendErrorResponse(connection, 405,
+         "The requested method is not allowed");
+   }
+   else
+   {
+      //No route matches the path
+      error = ERROR_NOT_FOUND;
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Find the route that matches a request
+ * @param[in] router Pointer to the router
+ * @param[in] method Request method (HttpRouteMethod flag)
+ * @param[in] uri NULL-terminated string containing the path to match
+ * @param[out] match Matching route and captured parameters
+ * @param[out] allowed Methods accepted for this path when the requested
+ *   method is not
+ * @return Error code
+ **/
+
+error_t httpRouterLookup(HttpRouter *router, uint_t method, const char_t *uri,
+   HttpRouteMatch *match, uint_t *allowed)
+{
+   error_t error;
+   uint_t i;
+   uint_t index;
+
+   //Initialize the result
+   match->route = NULL;
+   match->paramCount = 0;
+   *allowed = 0;
+
+   //Walk down the trie, starting from the root node
+   error = httpRouterMatchNode(router, 0, uri, method, match, allowed, &index);
+
+   //Check status code
+   if(!error)
+   {
+      //Loop through the routes ending at the matching node
+      for(i = router->nodes[index].firstRoute; i != 0;
+         i = router->nextRoute[i - 1])
+      {
+         //Does the route accept the request method?
+         if((router->routes[i - 1]->methods & method) != 0)
+         {
+            match->route = router->routes[i - 1];
+            break;
+         }
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Convert a request method to the corresponding route flag
+ * @param[in] method NULL-terminated string containing the request method
+ * @return HttpRouteMethod flag (HTTP_ROUTE_METHOD_NONE if the method is unknown)
+ **/
+
+uint_t httpRouterGetMethod(const char_t *method)
+{
+   uint_t i;
+
+   //Loop through the known methods
+   for(i = 0; i < arraysize(httpRouteMethodList); i++)
+   {
+      //Matching method?
+      if(osStrcasecmp(method, httpRouteMethodList[i].name) == 0)
+         return httpRouteMethodList[i].flag;
+   }
+
+   //Unknown method
+   return HTTP_ROUTE_METHOD_NONE;
+}
+
+
+/**
+ * @brief Retrieve the value of a path parameter
+ * @param[in] match Result of the route lookup
+ * @param[in] name Parameter name ("*" for an unnamed wildcard)
+ * @param[out] value Buffer where to copy the NULL-terminated value
+ * @param[in] maxLen Maximum number of characters the buffer can hold
+ * @return Error code
+ **/
+
+error_t httpRouterGetParam(const HttpRouteMatch *match, const char_t *name,
+   char_t *value, size_t maxLen)
+{
+   uint_t i;
+   size_t n;
+
+   //Calculate the length of the parameter name
+   n = osStrlen(name);
+
+   //Loop through the captured parameters
+   for(i = 0; i < match->paramCount; i++)
+   {
+      //Matching name?
+      if(match->params[i].nameLen == n &&
+         osStrncmp(match->params[i].name, name, n) == 0)
+      {
+         //Make sure the buffer is large enough
+         if(match->params[i].length > maxLen)
+            return ERROR_BUFFER_OVERFLOW;
+
+         //Copy the value
+         osMemcpy(value, match->params[i].value, match->params[i].length);
+         //Properly terminate the string with a NULL character
+         value[match->params[i].length] = '\0';
+
+         //Successful processing
+         return NO_ERROR;
+      }
+   }
+
+   //The parameter cannot be found
+   return ERROR_NOT_FOUND;
+}
+
+
+/**
+ * @brief Retrieve (or create) the child node for a pattern segment
+ * @param[in] router Pointer to the router
+ * @param[in] parent Index of the parent node
+ * @param[in] segment Pattern segment
+ * @param[in] length Length of the segment
+ * @param[out] index Index of the child node
+ * @return Error code
+ **/
+
+error_t httpRouterGetNode(HttpRouter *router, uint_t parent,
+   const char_t *segment, size_t length, uint_t *index)
+{
+   uint_t i;
+   uint_t type;
+   uint8_t *link;
+   HttpRouterNode *node;
+
+   //Parameter or wildcard segment?
+   if(segment[0] == ':')
+   {
+      //Parameters must be named
+      if(length < 2)
+         return ERROR_INVALID_SYNTAX;
+
+      //Strip the leading colon
+      segment++;
+      length--;
+
+      //A node has at most one parameter child
+      type = HTTP_ROUTER_NODE_PARAM;
+      link = &router->nodes[parent].paramChild;
+   }
+   else if(segment[0] == '*')
+   {
+      //Strip the leading asterisk of a named wildcard
+      if(length > 1)
+      {
+         segment++;
+         length--;
+      }
+
+      //A node has at most one wildcard child
+      type = HTTP_ROUTER_NODE_WILDCARD;
+      link = &router->nodes[parent].wildcardChild;
+   }
+   else
+   {
+      //Loop through the literal children
+      for(i = router->nodes[parent].firstChild; i != 0;
+         i = router->nodes[i].nextSibling)
+      {
+         //Matching segment?
+         if(router->nodes[i].length == length &&
+            osStrncasecmp(router->nodes[i].segment, segment, length) == 0)
+         {
+            *index = i;
+            return NO_ERROR;
+         }
+      }
+
+      //The new node is inserted at the head of the list
+      type = HTTP_ROUTER_NODE_LITERAL;
+      link = &router->nodes[parent].firstChild;
+   }
+
+   //Parameter or wildcard child already present?
+   if(type != HTTP_ROUTER_NODE_LITERAL && *link != 0)
+   {
+      //Point to the existing node
+      node = &router->nodes[*link];
+
+      //Conflicting routes must use the same parameter name
+      if(node->length != length ||
+         osStrncmp(node->segment, segment, length) != 0)
+      {
+         return ERROR_INVALID_SYNTAX;
+      }
+
+      //Reuse the existing node
+      *index = *link;
+      return NO_ERROR;
+   }
+
+   //Check the length of the segment
+   if(length > UINT8_MAX)
+      return ERROR_INVALID_SYNTAX;
+
+   //Make sure there is room for a new node
+   if(router->nodeCount >= HTTP_ROUTER_MAX_NODES)
+      return ERROR_OUT_OF_RESOURCES;
+
+   //Allocate a new node
+   i = router->nodeCount++;
+   node = &router->nodes[i];
+
+   //Initialize the node
+   osMemset(node, 0, sizeof(HttpRouterNode));
+   node->segment = segment;
+   node->length = (uint8_t) length;
+   node->type = (uint8_t) type;
+
+   //Literal nodes are chained to their siblings
+   if(type == HTTP_ROUTER_NODE_LITERAL)
+      node->nextSibling = *link;
+
+   //Attach the node to its parent
+   *link = (uint8_t) i;
+
+   //Return the index of the new node
+   *index = i;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Match the remainder of a path against a subtree
+ *
+ * Literal children are tried first, then the parameter child and finally the
+ * wildcard child. A wildcard is not considered once another route has
+ * matched the whole path for a different method, so that such requests are
+ * answered with a 405 status code rather than being caught by the wildcard
+ *
+ * @param[in] router Pointer to the router
+ * @param[in] index Index of the current node
+ * @param[in] path Remainder of the path
+ * @param[in] method Request method (HttpRouteMethod flag)
+ * @param[in,out] match Captured parameters
+ * @param[in,out] allowed Methods accepted by routes matching the whole path
+ * @param[out] node Index of the matching node
+ * @return Error code
+ **/
+
+error_t httpRouterMatchNode(HttpRouter *router, uint_t index,
+   const char_t *path, uint_t method, HttpRouteMatch *match, uint_t *allowed,
+   uint_t *node)
+{
+   error_t error;
+   uint_t i;
+   uint_t paramCount;
+   size_t n;
+   HttpRouterNode *p;
+   HttpRouteParam *param;
+
+   //Point to the current node
+   p = &router->nodes[index];
+
+   //Skip separators
+   while(*path == '/')
+   {
+      path++;
+   }
+
+   //Initialize status code
+   error = ERROR_NOT_FOUND;
+
+   //End of path?
+   if(*path == '\0')
+   {
+      //Does a route ending at this node accept the request method?
+      if((p->methods & method) != 0)
+      {
+         *node = index;
+         error = NO_ERROR;
+      }
+      else
+      {
+         //Remember which methods the path supports
+         *allowed |= p->methods;
+      }
+   }
+   else
+   {
+      //Compute the length of the current segment
+      for(n = 0; path[n] != '\0' && path[n] != '/'; n++)
+      {
+      }
+
+      //Loop through the literal children
+      for(i = p->firstChild; i != 0 && error; i = router->nodes[i].nextSibling)
+      {
+         //Matching segment?
+         if(router->nodes[i].length == n &&
+            osStrncasecmp(router->nodes[i].segment, path, n) == 0)
+         {
+            //Match the rest of the path
+            error = httpRouterMatchNode(router, i, path + n, method, match,
+               allowed, node);
+         }
+      }
+
+      //Try the parameter child, if any
+      if(error && p->paramChild != 0 &&
+         match->paramCount < HTTP_ROUTER_MAX_PARAMS)
+      {
+         //Save the number of captured parameters
+         paramCount = match->paramCount++;
+
+         //Capture the current segment
+         param = &match->params[paramCount];
+         param->name = router->nodes[p->paramChild].segment;
+         param->nameLen = router->nodes[p->paramChild].length;
+         param->value = path;
+         param->length = n;
+
+         //Match the rest of the path
+         error = httpRouterMatchNode(router, p->paramChild, path + n, method,
+            match, allowed, node);
+
+         //Discard the capture if the subtree does not match
+         if(error)
+            match->paramCount = paramCount;
+      }
+   }
+
+   //Try the wildcard child, if any
+   if(error && p->wildcardChild != 0 && *allowed == 0)
+   {
+      //Does the wildcard route accept the request method?
+      if((router->nodes[p->wildcardChild].methods & method) != 0 &&
+         match->paramCount < HTTP_ROUTER_MAX_PARAMS)
+      {
+         //Capture the rest of the path
+         param = &match->params[match->paramCount++];
+         param->name = router->nodes[p->wildcardChild].segment;
+         param->nameLen = router->nodes[p->wildcardChild].length;
+         param->value = path;
+         param->length = osStrlen(path);
+
+         //Successful match
+         *node = p->wildcardChild;
+         error = NO_ERROR;
+      }
+      else
+      {
+         //Remember which methods the path supports
+         *allowed |= router->nodes[p->wildcardChild].methods;
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+#endif
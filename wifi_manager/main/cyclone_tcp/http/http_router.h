@@ -0,0 +1,228 @@
+/**
+ * @file http_router.h
+ * @brief HTTP request router
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2025 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.5.4
+ **/
+
+#ifndef _HTTP_ROUTER_H
+#define _HTTP_ROUTER_H
+
+//Dependencies
+#include "http/http_server.h"
+
+//Maximum number of nodes in the routing trie
+#ifndef HTTP_ROUTER_MAX_NODES
+   #define HTTP_ROUTER_MAX_NODES 24
+#elif (HTTP_ROUTER_MAX_NODES < 1 || HTTP_ROUTER_MAX_NODES > 255)
+   #error HTTP_ROUTER_MAX_NODES parameter is not valid
+#endif
+
+//Maximum number of routes
+#ifndef HTTP_ROUTER_MAX_ROUTES
+   #define HTTP_ROUTER_MAX_ROUTES 16
+#elif (HTTP_ROUTER_MAX_ROUTES < 1 || HTTP_ROUTER_MAX_ROUTES > 255)
+   #error HTTP_ROUTER_MAX_ROUTES parameter is not valid
+#endif
+
+//Maximum number of path parameters captured by a route
+#ifndef HTTP_ROUTER_MAX_PARAMS
+   #define HTTP_ROUTER_MAX_PARAMS 4
+#elif (HTTP_ROUTER_MAX_PARAMS < 1)
+   #error HTTP_ROUTER_MAX_PARAMS parameter is not valid
+#endif
+
+//Maximum number of segments in a route pattern
+#ifndef HTTP_ROUTER_MAX_DEPTH
+   #define HTTP_ROUTER_MAX_DEPTH 8
+#elif (HTTP_ROUTER_MAX_DEPTH < 1)
+   #error HTTP_ROUTER_MAX_DEPTH parameter is not valid
+#endif
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Request methods a route applies to
+ **/
+
+typedef enum
+{
+   HTTP_ROUTE_METHOD_NONE    = 0x00,
+   HTTP_ROUTE_METHOD_GET     = 0x01,
+   HTTP_ROUTE_METHOD_HEAD    = 0x02,
+   HTTP_ROUTE_METHOD_POST    = 0x04,
+   HTTP_ROUTE_METHOD_PUT     = 0x08,
+   HTTP_ROUTE_METHOD_DELETE  = 0x10,
+   HTTP_ROUTE_METHOD_PATCH   = 0x20,
+   HTTP_ROUTE_METHOD_OPTIONS = 0x40,
+   HTTP_ROUTE_METHOD_ANY     = 0x7F
+} HttpRouteMethod;
+
+
+/**
+ * @brief Routing trie node types
+ **/
+
+typedef enum
+{
+   HTTP_ROUTER_NODE_LITERAL  = 0, ///<Segment matched literally (case-insensitive)
+   HTTP_ROUTER_NODE_PARAM    = 1, ///<":name" segment capturing one path segment
+   HTTP_ROUTER_NODE_WILDCARD = 2  ///<"*" or "*name" segment capturing the rest of the path
+} HttpRouterNodeType;
+
+
+/**
+ * @brief Path parameter captured while matching a route
+ *
+ * The value points into the request URI and is not NUL-terminated
+ *
+ **/
+
+typedef struct
+{
+   const char_t *name;  ///<Parameter name, as written in the route pattern
+   size_t nameLen;      ///<Length of the parameter name
+   const char_t *value; ///<Captured value
+   size_t length;       ///<Length of the captured value
+} HttpRouteParam;
+
+
+//Forward declaration of HttpRouteMatch structure
+struct _HttpRouteMatch;
+#define HttpRouteMatch struct _HttpRouteMatch
+
+
+/**
+ * @brief Route handler
+ **/
+
+typedef error_t (*HttpRouteCallback)(HttpConnection *connection,
+   const HttpRouteMatch *match, void *param);
+
+
+/**
+ * @brief Route definition
+ *
+ * Route patterns are made of '/'-separated segments. A segment is either a
+ * literal, a parameter (":name") or a trailing wildcard ("*" or "*name").
+ * The router keeps pointers to the definition and to its pattern, which must
+ * therefore remain valid (typically a constant table)
+ *
+ **/
+
+typedef struct
+{
+   uint_t methods;             ///<Accepted methods (combination of HttpRouteMethod flags)
+   const char_t *path;         ///<Route pattern
+   HttpRouteCallback callback; ///<Handler
+   void *param;                ///<User-defined parameter passed to the handler
+} HttpRoute;
+
+
+/**
+ * @brief Result of a successful route lookup
+ **/
+
+struct _HttpRouteMatch
+{
+   const HttpRoute *route;                       ///<Matching route
+   uint_t paramCount;                            ///<Number of captured parameters
+   HttpRouteParam params[HTTP_ROUTER_MAX_PARAMS]; ///<Captured parameters
+};
+
+
+/**
+ * @brief Routing trie node
+ *
+ * Children are referenced by index. Index 0 is the root node, which can
+ * never be a child, so 0 also stands for "no node"
+ *
+ **/
+
+typedef struct
+{
+   const char_t *segment; ///<Literal text or parameter name (points into the pattern)
+   uint8_t length;        ///<Length of the segment
+   uint8_t type;          ///<Node type
+   uint8_t firstChild;    ///<First literal child
+   uint8_t nextSibling;   ///<Next literal sibling
+   uint8_t paramChild;    ///<Parameter child
+   uint8_t wildcardChild; ///<Wildcard child
+   uint8_t firstRoute;    ///<First route ending at this node (index + 1)
+   uint8_t methods;       ///<Methods accepted by the routes ending at this node
+} HttpRouterNode;
+
+
+/**
+ * @brief HTTP request router
+ **/
+
+typedef struct
+{
+   uint_t nodeCount;                                ///<Number of nodes in use
+   HttpRouterNode nodes[HTTP_ROUTER_MAX_NODES];     ///<Routing trie
+   uint_t routeCount;                               ///<Number of registered routes
+   const HttpRoute *routes[HTTP_ROUTER_MAX_ROUTES]; ///<Registered routes
+   uint8_t nextRoute[HTTP_ROUTER_MAX_ROUTES];       ///<Next route ending at the same node (index + 1)
+} HttpRouter;
+
+
+//HTTP router related functions
+void httpRouterInit(HttpRouter *router);
+
+error_t httpRouterAddRoute(HttpRouter *router, const HttpRoute *route);
+
+error_t httpRouterAddRoutes(HttpRouter *router, const HttpRoute *routes,
+   uint_t count);
+
+error_t httpRouterDispatch(HttpRouter *router, HttpConnection *connection,
+   const char_t *uri);
+
+error_t httpRouterLookup(HttpRouter *router, uint_t method, const char_t *uri,
+   HttpRouteMatch *match, uint_t *allowed);
+
+uint_t httpRouterGetMethod(const char_t *method);
+
+error_t httpRouterGetNode(HttpRouter *router, uint_t parent,
+   const char_t *segment, size_t length, uint_t *index);
+
+error_t httpRouterMatchNode(HttpRouter *router, uint_t index,
+   const char_t *path, uint_t method, HttpRouteMatch *match, uint_t *allowed,
+   uint_t *node);
+
+error_t httpRouterGetParam(const HttpRouteMatch *match, const char_t *name,
+   char_t *value, size_t maxLen);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
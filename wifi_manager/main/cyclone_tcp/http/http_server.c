@@ -160,6 +160,12 @@ error_t httpServerInit(HttpServerContext *context, const HttpServerSettings *set
    if(!osCreateSemaphore(&context->semaphore, context->settings.maxConnections))
       return ERROR_OUT_OF_RESOURCES;
 
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
+   //Create an event object to poll the sockets
+   if(!osCreateEvent(&context->event))
+      return ERROR_OUT_OF_RESOURCES;
+#endif
+
    //Loop through client connections
    for(i = 0; i < context->settings.maxConnections; i++)
    {
@@ -192,14 +198,25 @@ error_t httpServerInit(HttpServerContext *context, const HttpServerSettings *set
       return ERROR_OUT_OF_RESOURCES;
 #endif
 
+#if (HTTP_SERVER_SSI_SUPPORT == ENABLED && HTTP_SERVER_FS_SUPPORT == DISABLED && HTTP_SERVER_SSI_CACHE_SIZE > 0)
+   //Create a mutex to prevent simultaneous access to the SSI cache
+   if(!osCreateMutex(&context->ssiCacheMutex))
+      return ERROR_OUT_OF_RESOURCES;
+#endif
+
    //Open a TCP socket
    context->socket = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
    //Failed to open socket?
    if(context->socket == NULL)
       return ERROR_OPEN_FAILED;
 
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
+   //The listening socket is polled and must never block
+   error = socketSetTimeout(context->socket, 0);
+#else
    //Set timeout for blocking functions
    error = socketSetTimeout(context->socket, INFINITE_DELAY);
+#endif
    //Any error to report?
    if(error)
       return error;
@@ -235,8 +252,10 @@ error_t httpServerInit(HttpServerContext *context, const HttpServerSettings *set
 
 error_t httpServerStart(HttpServerContext *context)
 {
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == DISABLED)
    uint_t i;
    HttpConnection *connection;
+#endif
 
    //Make sure the HTTP server context is valid
    if(context == NULL)
@@ -245,6 +264,15 @@ error_t httpServerStart(HttpServerContext *context)
    //Debug message
    TRACE_INFO("Starting HTTP server...\r\n");
 
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
+   //A single task services all the client connections
+   context->taskId = osCreateTask("HTTP Server", httpServerTask,
+      context, &context->taskParams);
+
+   //Unable to create the task?
+   if(context->taskId == OS_INVALID_TASK_ID)
+      return ERROR_OUT_OF_RESOURCES;
+#else
    //Loop through client connections
    for(i = 0; i < context->settings.maxConnections; i++)
    {
@@ -267,6 +295,7 @@ error_t httpServerStart(HttpServerContext *context)
    //Unable to create the task?
    if(context->taskId == OS_INVALID_TASK_ID)
       return ERROR_OUT_OF_RESOURCES;
+#endif
 
    //The HTTP server has successfully started
    return NO_ERROR;
@@ -332,6 +361,11 @@ void httpListenerTask(void *param)
                //Reference to the new socket
                connection->socket = socket;
 
+#if (HTTP_SERVER_RX_BUFFER_SUPPORT == ENABLED)
+               //Flush the receive buffer
+               connection->rxBufferPos = 0;
+               connection->rxBufferLen = 0;
+#endif
                //Set timeout for blocking functions
                socketSetTimeout(connection->socket, HTTP_SERVER_TIMEOUT);
 
@@ -464,6 +498,9 @@ void httpConnectionTask(void *param)
             //Debug message
             TRACE_INFO("Waiting for request...\r\n");
 
+            //Number of requests already served over the connection
+            connection->requestCount = counter;
+
             //Clear request header
             osMemset(&connection->request, 0, sizeof(HttpRequest));
             //Clear response header
@@ -479,137 +516,8 @@ void httpConnectionTask(void *param)
                break;
             }
 
-#if (HTTP_SERVER_BASIC_AUTH_SUPPORT == ENABLED || HTTP_SERVER_DIGEST_AUTH_SUPPORT == ENABLED)
-            //No Authorization header found?
-            if(!connection->request.auth.found)
-            {
-               //Invoke user-defined callback, if any
-               if(connection->settings->authCallback != NULL)
-               {
-                  //Check whether the access to the specified URI is authorized
-                  connection->status = connection->settings->authCallback(connection,
-                     connection->request.auth.user, connection->request.uri);
-               }
-               else
-               {
-                  //Access to the specified URI is allowed
-                  connection->status = HTTP_ACCESS_ALLOWED;
-               }
-            }
-
-            //Check access status
-            if(connection->status == HTTP_ACCESS_ALLOWED)
-            {
-               //Access to the specified URI is allowed
-               error = NO_ERROR;
-            }
-            else if(connection->status == HTTP_ACCESS_BASIC_AUTH_REQUIRED)
-            {
-               //Basic access authentication is required
-               connection->response.auth.mode = HTTP_AUTH_MODE_BASIC;
-               //Report an error
-               error = ERROR_AUTH_REQUIRED;
-            }
-            else if(connection->status == HTTP_ACCESS_DIGEST_AUTH_REQUIRED)
-            {
-               //Digest access authentication is required
-               connection->response.auth.mode = HTTP_AUTH_MODE_DIGEST;
-               //Report an error
-               error = ERROR_AUTH_REQUIRED;
-            }
-            else
-            {
-               //Access to the specified URI is denied
-               error = ERROR_NOT_FOUND;
-            }
-#endif
-            //Debug message
-            TRACE_INFO("Sending HTTP response to the client...\r\n");
-
-            //Check status code
-            if(!error)
-            {
-               //Default HTTP header fields
-               httpInitResponseHeader(connection);
-
-               //Invoke user-defined callback, if any
-               if(connection->settings->requestCallback != NULL)
-               {
-                  error = connection->settings->requestCallback(connection,
-                     connection->request.uri);
-               }
-               else
-               {
-                  //Keep processing...
-                  error = ERROR_NOT_FOUND;
-               }
-
-               //Check status code
-               if(error == ERROR_NOT_FOUND)
-               {
-#if (HTTP_SERVER_SSI_SUPPORT == ENABLED)
-                  //Use server-side scripting to dynamically generate HTML code?
-                  if(httpCompExtension(connection->request.uri, ".stm") ||
-                     httpCompExtension(connection->request.uri, ".shtm") ||
-                     httpCompExtension(connection->request.uri, ".shtml"))
-                  {
-                     //SSI processing (Server Side Includes)
-                     error = ssiExecuteScript(connection, connection->request.uri, 0);
-                  }
-                  else
-#endif
-                  {
-                     //Set the maximum age for static resources
-                     connection->response.maxAge = HTTP_SERVER_MAX_AGE;
-
-                     //Send the contents of the requested page
-                     error = httpSendResponse(connection, connection->request.uri);
-                  }
-               }
-
-               //The requested resource is not available?
-               if(error == ERROR_NOT_FOUND)
-               {
-                  //Default HTTP header fields
-                  httpInitResponseHeader(connection);
-
-                  //Invoke user-defined callback, if any
-                  if(connection->settings->uriNotFoundCallback != NULL)
-                  {
-                     error = connection->settings->uriNotFoundCallback(connection,
-                        connection->request.uri);
-                  }
-               }
-            }
-
-            //Check status code
-            if(error)
-            {
-               //Default HTTP header fields
-               httpInitResponseHeader(connection);
-
-               //Bad request?
-               if(error == ERROR_INVALID_REQUEST)
-               {
-                  //Send an error 400 and close the connection immediately
-                  httpSendErrorResponse(connection, 400,
-                     "The request is badly formed");
-               }
-               //Authorization required?
-               else if(error == ERROR_AUTH_REQUIRED)
-               {
-                  //Send an error 401 and keep the connection alive
-                  error = httpSendErrorResponse(connection, 401,
-                     "Authorization required");
-               }
-               //Page not found?
-               else if(error == ERROR_NOT_FOUND)
-               {
-                  //Send an error 404 and keep the connection alive
-                  error = httpSendErrorResponse(connection, 404,
-                     "The requested page could not be found");
-               }
-            }
+            //Process the HTTP request and send the response
+            error = httpProcessRequest(connection);
 
             //Internal error?
             if(error)
@@ -624,6 +532,12 @@ void httpConnectionTask(void *param)
                //Close the connection immediately
                break;
             }
+
+            //The next request follows the body of the current one
+            error = httpDiscardRequestBody(connection);
+            //Any error to report?
+            if(error)
+               break;
          }
       }
 
@@ -663,6 +577,105 @@ void httpConnectionTask(void *param)
 }
 
 
+/**
+ * @brief HTTP server task (event-driven mode)
+ *
+ * A single task multiplexes the listening socket and all the client
+ * connections. Each connection is driven by a state machine that only
+ * performs I/O when the underlying socket is ready
+ *
+ * @param[in] param Pointer to the HTTP server context
+ **/
+
+void httpServerTask(void *param)
+{
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
+   error_t error;
+   uint_t i;
+   uint_t n;
+   bool_t acceptEnabled;
+   HttpServerContext *context;
+   HttpConnection *connection;
+   SocketEventDesc *eventDesc;
+
+   //Task prologue
+   osEnterTask();
+
+   //Retrieve the HTTP server context
+   context = (HttpServerContext *) param;
+   //Number of client connections
+   n = context->settings.maxConnections;
+
+   //Process events
+   while(1)
+   {
+      //New connections are accepted only if a slot is available
+      acceptEnabled = FALSE;
+
+      //Loop through the connection table
+      for(i = 0; i < n; i++)
+      {
+         //Point to the current connection
+         connection = &context->connections[i];
+         //Point to the corresponding event descriptor
+         eventDesc = &context->eventDesc[i];
+
+         //Check whether the connection has timed out
+         httpCheckConnectionTimeout(connection);
+
+         //Active connection?
+         if(connection->state != HTTP_CONN_STATE_IDLE)
+         {
+            //Register the events the connection is waiting for
+            eventDesc->socket = connection->socket;
+            eventDesc->eventMask = httpGetConnectionEvents(connection);
+         }
+         else
+         {
+            //Unused slot
+            eventDesc->socket = NULL;
+            eventDesc->eventMask = 0;
+            acceptEnabled = TRUE;
+         }
+
+         //Clear event flags
+         eventDesc->eventFlags = 0;
+      }
+
+      //The listening socket is the last entry of the descriptor set
+      eventDesc = &context->eventDesc[n];
+      eventDesc->socket = context->socket;
+      eventDesc->eventMask = acceptEnabled ? SOCKET_EVENT_ACCEPT : 0;
+      eventDesc->eventFlags = 0;
+
+      //Wait for one of the sockets to become ready
+      error = socketPoll(context->eventDesc, n + 1, &context->event,
+         HTTP_SERVER_TICK_INTERVAL);
+
+      //Any socket event?
+      if(!error)
+      {
+         //Loop through the connection table
+         for(i = 0; i < n; i++)
+         {
+            //Advance the state machine of the ready connections
+            if(context->eventDesc[i].eventFlags != 0)
+            {
+               httpProcessConnectionEvents(&context->connections[i]);
+            }
+         }
+
+         //Any connection request pending?
+         if(context->eventDesc[n].eventFlags != 0)
+         {
+            httpAcceptConnection(context);
+         }
+      }
+   }
+#endif
+}
+
+
 /**
  * @brief Send HTTP response header
  * @param[in] connection Structure representing an HTTP connection
@@ -911,6 +924,8 @@ error_t httpSendResponse(HttpConnection *connection, const char_t *uri)
 {
 #if (HTTP_SERVER_FS_SUPPORT == ENABLED)
    error_t error;
+   uint_t i;
+   uint_t count;
    size_t n;
    uint32_t length;
    FsFile *file;
@@ -945,6 +960,7 @@ error_t httpSendResponse(HttpConnection *connection, const char_t *uri)
       {
          //Use gzip format
          connection->response.gzipEncoding = TRUE;
+         connection->response.varyAcceptEncoding = TRUE;
       }
       else
       {
@@ -977,18 +993,87 @@ error_t httpSendResponse(HttpConnection *connection, const char_t *uri)
    error_t error;
    size_t length;
    const uint8_t *data;
+   uint_t accepted;
+   const char_t *contentType;
+   ResInfo info;
 
    //Retrieve the full pathname
    httpGetAbsolutePath(connection, uri, connection->buffer,
       HTTP_SERVER_BUFFER_SIZE);
 
+   //The original representation is always acceptable
+   accepted = RES_ENCODING_FLAG(RES_ENCODING_IDENTITY);
+
 #if (HTTP_SERVER_GZIP_TYPE_SUPPORT == ENABLED)
    //Check whether gzip compression is supported by the client
    if(connection->request.acceptGzipEncoding)
+      accepted |= RES_ENCODING_FLAG(RES_ENCODING_GZIP);
+#endif
+#if (HTTP_SERVER_BROTLI_TYPE_SUPPORT == ENABLED)
+   //Check whether Brotli compression is supported by the client
+   if(connection->request.acceptBrotliEncoding)
+      accepted |= RES_ENCODING_FLAG(RES_ENCODING_BROTLI);
+#endif
+
+   //The media type is derived from the URI unless the index provides it
+   contentType = NULL;
+
+   //Select the smallest acceptable variant in a single lookup
+   error = resGetEncodedData(connection->buffer, accepted, &info);
+
+   //Check status code
+   if(!error)
+   {
+      //Point to the selected representation
+      data = info.data;
+      length = info.length;
+      //Media type identifier recorded by pack.py, if any
+      contentType = mimeGetTypeById(info.mimeType);
+
+#if (HTTP_SERVER_GZIP_TYPE_SUPPORT == ENABLED)
+      //Use gzip format?
+      connection->response.gzipEncoding = (info.encoding == RES_ENCODING_GZIP);
+#endif
+#if (HTTP_SERVER_BROTLI_TYPE_SUPPORT == ENABLED)
+      //Use Brotli format?
+      connection->response.brotliEncoding = (info.encoding == RES_ENCODING_BROTLI);
+#endif
+#if (HTTP_SERVER_GZIP_TYPE_SUPPORT == ENABLED || HTTP_SERVER_BROTLI_TYPE_SUPPORT == ENABLED)
+      //Precompressed variants exist for this resource?
+      connection->response.varyAcceptEncoding =
+         (info.availableEncodings != RES_ENCODING_FLAG(RES_ENCODING_IDENTITY));
+#endif
+
+#if (HTTP_SERVER_ETAG_SUPPORT == ENABLED)
+      //The content hash computed by pack.py is available?
+      if(info.digest != NULL)
+      {
+         //Format a strong entity tag. Each encoding is a distinct
+         //representation and therefore gets its own tag
+         connection->response.etag[0] = '"';
+         httpConvertArrayToHexString(info.digest, RES_DIGEST_SIZE,
+            connection->response.etag + 1);
+
+         //Append a suffix that identifies the encoding
+         if(info.encoding == RES_ENCODING_GZIP)
+            osStrcat(connection->response.etag, "-gz\"");
+         else if(info.encoding == RES_ENCODING_BROTLI)
+            osStrcat(connection->response.etag, "-br\"");
+         else
+            osStrcat(connection->response.etag, "\"");
+
+         //Fingerprinted resources never change under the requested URI
+         connection->response.immutable = info.fingerprinted;
+      }
+#endif
+   }
+#if (HTTP_SERVER_GZIP_TYPE_SUPPORT == ENABLED)
+   else if(connection->request.acceptGzipEncoding)
    {
       size_t n;
 
-      //Calculate the length of the pathname
+      //Images generated without a path index only contain the gzip-compressed
+      //copy of the resource, stored under a name with a .gz extension
       n = osStrlen(connection->buffer);
 
       //Sanity check
@@ -998,11 +1083,8 @@ error_t httpSendResponse(HttpConnection *connection, const char_t *uri)
          osStrcpy(connection->buffer + n, ".gz");
          //Get the compressed resource data associated with the URI, if any
          error = resGetData(connection->buffer, &data, &length);
-      }
-      else
-      {
-         //Report an error
-         error = ERROR_NOT_FOUND;
+         //Strip the gzip extension
+         connection->buffer[n] = '\0';
       }
 
       //Check whether the gzip-compressed resource exists
@@ -1010,36 +1092,52 @@ error_t httpSendResponse(HttpConnection *connection, const char_t *uri)
       {
          //Use gzip format
          connection->response.gzipEncoding = TRUE;
-      }
-      else
-      {
-         //Strip the gzip extension
-         connection->buffer[n] = '\0';
-
-         //Get the non-compressed resource data associated with the URI
-         error = resGetData(connection->buffer, &data, &length);
-         //The specified URI cannot be found?
-         if(error)
-            return error;
+         connection->response.varyAcceptEncoding = TRUE;
       }
    }
-   else
 #endif
-   {
-      //Get the resource data associated with the URI
-      error = resGetData(connection->buffer, &data, &length);
-      //The specified URI cannot be found?
-      if(error)
-         return error;
-   }
+
+   //The specified URI cannot be found?
+   if(error)
+      return error;
+
+   //No media type identifier available?
+   if(contentType == NULL)
+      contentType = mimeGetType(uri);
 #endif
 
    //Format HTTP response header
    connection->response.statusCode = 200;
+#if (HTTP_SERVER_FS_SUPPORT == ENABLED)
    connection->response.contentType = mimeGetType(uri);
+#else
+   connection->response.contentType = contentType;
+#endif
    connection->response.chunkedEncoding = FALSE;
    connection->response.contentLength = length;
 
+#if (HTTP_SERVER_FS_SUPPORT == DISABLED && HTTP_SERVER_ETAG_SUPPORT == ENABLED)
+   //The client already holds the selected representation?
+   if(connection->response.etag[0] != '\0' &&
+      httpMatchEntityTag(connection->request.ifNoneMatch,
+      connection->response.etag))
+   {
+      //The 304 response carries the same header fields as a 200 response
+      //would, but the body is never sent
+      connection->response.statusCode = 304;
+      length = 0;
+   }
+#endif
+
+#if (HTTP_SERVER_RANGE_SUPPORT == ENABLED)
+   //Partial content can only be served instead of a 200 response
+   if(connection->response.statusCode == 200)
+   {
+      //Select the byte ranges to be sent, if any
+      httpSelectRanges(connection, length);
+   }
+#endif
+
    //Send the header to the client
    error = httpWriteHeader(connection);
    //Any error to report?
@@ -1054,27 +1152,86 @@ error_t httpSendResponse(HttpConnection *connection, const char_t *uri)
    }
 
 #if (HTTP_SERVER_FS_SUPPORT == ENABLED)
+   //The whole file is sent as a single range
+   count = 1;
+
+#if (HTTP_SERVER_RANGE_SUPPORT == ENABLED)
+   //Partial content?
+   if(connection->response.statusCode == 206)
+   {
+      //Send the selected ranges only
+      count = connection->response.rangeCount;
+   }
+   else if(connection->response.statusCode == 416)
+   {
+      //The response has no body
+      length = 0;
+   }
+#endif
+
    //Send response body
-   while(length > 0)
+   for(i = 0; i < count && !error; i++)
    {
-      //Limit the number of bytes to read at a time
-      n = MIN(length, HTTP_SERVER_BUFFER_SIZE);
+#if (HTTP_SERVER_RANGE_SUPPORT == ENABLED)
+      //Partial content?
+      if(connection->response.statusCode == 206)
+      {
+         //Multipart body?
+         if(count > 1)
+         {
+            //Send the header of the part
+            n = httpFormatRangePart(connection, i, connection->buffer);
+            error = httpWriteStream(connection, connection->buffer, n);
+            //Any error to report?
+            if(error)
+               break;
+         }
 
-      //Read data from the specified file
-      error = fsReadFile(file, connection->buffer, n, &n);
-      //End of input stream?
-      if(error)
-         break;
+         //Jump to the beginning of the range
+         error = fsSeekFile(file, connection->response.ranges[i].first,
+            FS_SEEK_SET);
+         //Any error to report?
+         if(error)
+            break;
 
-      //Send data to the client
-      error = httpWriteStream(connection, connection->buffer, n);
-      //Any error to report?
-      if(error)
-         break;
+         //Number of bytes in the range
+         length = connection->response.ranges[i].last -
+            connection->response.ranges[i].first + 1;
+      }
+#endif
 
-      //Decrement the count of remaining bytes to be transferred
-      length -= n;
+      //Stream the data through the connection buffer
+      while(length > 0)
+      {
+         //Limit the number of bytes to read at a time
+         n = MIN(length, HTTP_SERVER_BUFFER_SIZE);
+
+         //Read data from the specified file
+         error = fsReadFile(file, connection->buffer, n, &n);
+         //End of input stream?
+         if(error)
+            break;
+
+         //Send data to the client
+         error = httpWriteStream(connection, connection->buffer, n);
+         //Any error to report?
+         if(error)
+            break;
+
+         //Decrement the count of remaining bytes to be transferred
+         length -= n;
+      }
+   }
+
+#if (HTTP_SERVER_RANGE_SUPPORT == ENABLED)
+   //Multipart body?
+   if(!error && count > 1)
+   {
+      //Send the close delimiter
+      n = httpFormatRangePart(connection, count, connection->buffer);
+      error = httpWriteStream(connection, connection->buffer, n);
    }
+#endif
 
    //Close the file
    fsCloseFile(file);
@@ -1088,15 +1245,61 @@ error_t httpSendResponse(HttpConnection *connection, const char_t *uri)
          error = httpCloseStream(connection);
       }
    }
+#else
+#if (HTTP_SERVER_RANGE_SUPPORT == ENABLED)
+   //Partial content?
+   if(connection->response.statusCode == 206)
+   {
+      //Single range?
+      if(connection->response.rangeCount == 1)
+      {
+         //The range is sent straight from the resource data
+         data += connection->response.ranges[0].first;
+         length = connection->response.contentLength;
+      }
+      else
+      {
+         //The parts are interleaved with their headers, one segment at a time
+         connection->rangeData = data;
+         connection->rangeSegment = 0;
+
+         //Retrieve the first segment
+         httpGetNextRangeSegment(connection, &data, &length);
+      }
+   }
+   else if(connection->response.statusCode == 416)
+   {
+      //The response has no body
+      length = 0;
+   }
+#endif
+
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
+   //The response body is streamed by the server task as soon as the
+   //socket is ready to accept more data
+   connection->bodyStart = (uint8_t *) data;
+   connection->bodyPos = 0;
+   connection->bodyLen = length;
 #else
    //Send response body
    error = httpWriteStream(connection, data, length);
+
+#if (HTTP_SERVER_RANGE_SUPPORT == ENABLED)
+   //Send the remaining segments of a multipart body
+   while(!error && connection->response.rangeCount > 1 &&
+      httpGetNextRangeSegment(connection, &data, &length))
+   {
+      error = httpWriteStream(connection, data, length);
+   }
+#endif
+
    //Any error to report?
    if(error)
       return error;
 
    //Properly close output stream
    error = httpCloseStream(connection);
+#endif
 #endif
 
    //Return status code
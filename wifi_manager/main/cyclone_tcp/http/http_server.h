@@ -51,6 +51,13 @@
    #error HTTP_SERVER_PERSISTENT_CONN_SUPPORT parameter is not valid
 #endif
 
+//Event-driven operation (single task)
+#ifndef HTTP_SERVER_EVENT_DRIVEN_SUPPORT
+   #define HTTP_SERVER_EVENT_DRIVEN_SUPPORT DISABLED
+#elif (HTTP_SERVER_EVENT_DRIVEN_SUPPORT != ENABLED && HTTP_SERVER_EVENT_DRIVEN_SUPPORT != DISABLED)
+   #error HTTP_SERVER_EVENT_DRIVEN_SUPPORT parameter is not valid
+#endif
+
 //File system support
 #ifndef HTTP_SERVER_FS_SUPPORT
    #define HTTP_SERVER_FS_SUPPORT DISABLED
@@ -107,6 +114,13 @@
    #error HTTP_SERVER_GZIP_TYPE_SUPPORT parameter is not valid
 #endif
 
+//Brotli content type support
+#ifndef HTTP_SERVER_BROTLI_TYPE_SUPPORT
+   #define HTTP_SERVER_BROTLI_TYPE_SUPPORT DISABLED
+#elif (HTTP_SERVER_BROTLI_TYPE_SUPPORT != ENABLED && HTTP_SERVER_BROTLI_TYPE_SUPPORT != DISABLED)
+   #error HTTP_SERVER_BROTLI_TYPE_SUPPORT parameter is not valid
+#endif
+
 //Multipart content type support
 #ifndef HTTP_SERVER_MULTIPART_TYPE_SUPPORT
    #define HTTP_SERVER_MULTIPART_TYPE_SUPPORT DISABLED
@@ -155,6 +169,13 @@
    #error HTTP_SERVER_IDLE_TIMEOUT parameter is not valid
 #endif
 
+//Polling interval used to check connection timeouts (event-driven mode)
+#ifndef HTTP_SERVER_TICK_INTERVAL
+   #define HTTP_SERVER_TICK_INTERVAL 500
+#elif (HTTP_SERVER_TICK_INTERVAL < 10)
+   #error HTTP_SERVER_TICK_INTERVAL parameter is not valid
+#endif
+
 //Maximum length of the pending connection queue
 #ifndef HTTP_SERVER_BACKLOG
    #define HTTP_SERVER_BACKLOG 4
@@ -176,6 +197,27 @@
    #error HTTP_SERVER_BUFFER_SIZE parameter is not valid
 #endif
 
+//Buffered reader (request headers are parsed from a per-connection buffer)
+#ifndef HTTP_SERVER_RX_BUFFER_SUPPORT
+   #define HTTP_SERVER_RX_BUFFER_SUPPORT DISABLED
+#elif (HTTP_SERVER_RX_BUFFER_SUPPORT != ENABLED && HTTP_SERVER_RX_BUFFER_SUPPORT != DISABLED)
+   #error HTTP_SERVER_RX_BUFFER_SUPPORT parameter is not valid
+#endif
+
+//Size of the receive buffer
+#ifndef HTTP_SERVER_RX_BUFFER_SIZE
+   #define HTTP_SERVER_RX_BUFFER_SIZE 1024
+#elif (HTTP_SERVER_RX_BUFFER_SIZE < 128)
+   #error HTTP_SERVER_RX_BUFFER_SIZE parameter is not valid
+#endif
+
+//Size of the per-connection transmit queue (event-driven mode)
+#ifndef HTTP_SERVER_TX_BUFFER_SIZE
+   #define HTTP_SERVER_TX_BUFFER_SIZE 1024
+#elif (HTTP_SERVER_TX_BUFFER_SIZE < 128)
+   #error HTTP_SERVER_TX_BUFFER_SIZE parameter is not valid
+#endif
+
 //Maximum size of root directory
 #ifndef HTTP_SERVER_ROOT_DIR_MAX_LEN
    #define HTTP_SERVER_ROOT_DIR_MAX_LEN 31
@@ -246,6 +288,20 @@
    #error HTTP_SERVER_SSI_MAX_RECURSION parameter is not valid
 #endif
 
+//Number of compiled SSI templates kept in cache
+#ifndef HTTP_SERVER_SSI_CACHE_SIZE
+   #define HTTP_SERVER_SSI_CACHE_SIZE 4
+#elif (HTTP_SERVER_SSI_CACHE_SIZE < 0)
+   #error HTTP_SERVER_SSI_CACHE_SIZE parameter is not valid
+#endif
+
+//Maximum number of segments in a compiled SSI template
+#ifndef HTTP_SERVER_SSI_MAX_SEGMENTS
+   #define HTTP_SERVER_SSI_MAX_SEGMENTS 32
+#elif (HTTP_SERVER_SSI_MAX_SEGMENTS < 2)
+   #error HTTP_SERVER_SSI_MAX_SEGMENTS parameter is not valid
+#endif
+
 //Maximum age for static resources
 #ifndef HTTP_SERVER_MAX_AGE
    #define HTTP_SERVER_MAX_AGE 0
@@ -253,6 +309,56 @@
    #error HTTP_SERVER_MAX_AGE parameter is not valid
 #endif
 
+//Entity tag support for static resources
+#ifndef HTTP_SERVER_ETAG_SUPPORT
+   #define HTTP_SERVER_ETAG_SUPPORT DISABLED
+#elif (HTTP_SERVER_ETAG_SUPPORT != ENABLED && HTTP_SERVER_ETAG_SUPPORT != DISABLED)
+   #error HTTP_SERVER_ETAG_SUPPORT parameter is not valid
+#endif
+
+//Maximum age for fingerprinted static resources
+#ifndef HTTP_SERVER_IMMUTABLE_MAX_AGE
+   #define HTTP_SERVER_IMMUTABLE_MAX_AGE 31536000
+#elif (HTTP_SERVER_IMMUTABLE_MAX_AGE < 0)
+   #error HTTP_SERVER_IMMUTABLE_MAX_AGE parameter is not valid
+#endif
+
+//Maximum length for the If-None-Match header field
+#ifndef HTTP_SERVER_IF_NONE_MATCH_MAX_LEN
+   #define HTTP_SERVER_IF_NONE_MATCH_MAX_LEN 64
+#elif (HTTP_SERVER_IF_NONE_MATCH_MAX_LEN < 1)
+   #error HTTP_SERVER_IF_NONE_MATCH_MAX_LEN parameter is not valid
+#endif
+
+//Maximum length for entity tags
+#define HTTP_SERVER_ETAG_MAX_LEN 24
+
+//Byte range support for static resources
+#ifndef HTTP_SERVER_RANGE_SUPPORT
+   #define HTTP_SERVER_RANGE_SUPPORT DISABLED
+#elif (HTTP_SERVER_RANGE_SUPPORT != ENABLED && HTTP_SERVER_RANGE_SUPPORT != DISABLED)
+   #error HTTP_SERVER_RANGE_SUPPORT parameter is not valid
+#endif
+
+//Maximum number of ranges in a multipart/byteranges response
+#ifndef HTTP_SERVER_MAX_RANGES
+   #define HTTP_SERVER_MAX_RANGES 4
+#elif (HTTP_SERVER_MAX_RANGES < 1 || HTTP_SERVER_MAX_RANGES > 16)
+   #error HTTP_SERVER_MAX_RANGES parameter is not valid
+#endif
+
+//Maximum length for the Range header field
+#ifndef HTTP_SERVER_RANGE_MAX_LEN
+   #define HTTP_SERVER_RANGE_MAX_LEN 64
+#elif (HTTP_SERVER_RANGE_MAX_LEN < 8)
+   #error HTTP_SERVER_RANGE_MAX_LEN parameter is not valid
+#endif
+
+//Boundary string delimiting the parts of a multipart/byteranges response
+#ifndef HTTP_SERVER_RANGE_BOUNDARY
+   #define HTTP_SERVER_RANGE_BOUNDARY "3d6b6a416f9b5"
+#endif
+
 //Nonce cache size
 #ifndef HTTP_SERVER_NONCE_CACHE_SIZE
    #define HTTP_SERVER_NONCE_CACHE_SIZE 8
@@ -303,6 +409,21 @@
    #define HTTP_RESPONSE_PRIVATE_HEADER_FIELDS
 #endif
 
+//The event-driven mode relies on the buffered reader
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED && HTTP_SERVER_RX_BUFFER_SUPPORT == DISABLED)
+   #error HTTP_SERVER_EVENT_DRIVEN_SUPPORT requires HTTP_SERVER_RX_BUFFER_SUPPORT
+#endif
+
+//The event-driven mode cannot block on TLS handshakes
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED && HTTP_SERVER_TLS_SUPPORT == ENABLED)
+   #error HTTP_SERVER_EVENT_DRIVEN_SUPPORT cannot be used with HTTP_SERVER_TLS_SUPPORT
+#endif
+
+//The event-driven mode cannot block on file system reads
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED && HTTP_SERVER_FS_SUPPORT == ENABLED)
+   #error HTTP_SERVER_EVENT_DRIVEN_SUPPORT cannot be used with HTTP_SERVER_FS_SUPPORT
+#endif
+
 //File system support?
 #if (HTTP_SERVER_FS_SUPPORT == ENABLED)
    #include "fs_port.h"
@@ -384,6 +505,29 @@ typedef enum
 } HttpConnState;
 
 
+/**
+ * @brief Well-known request header fields
+ **/
+
+typedef enum
+{
+   HTTP_HEADER_FIELD_UNKNOWN           = 0,
+   HTTP_HEADER_FIELD_HOST              = 1,
+   HTTP_HEADER_FIELD_CONNECTION        = 2,
+   HTTP_HEADER_FIELD_TRANSFER_ENCODING = 3,
+   HTTP_HEADER_FIELD_CONTENT_TYPE      = 4,
+   HTTP_HEADER_FIELD_CONTENT_LENGTH    = 5,
+   HTTP_HEADER_FIELD_ACCEPT_ENCODING   = 6,
+   HTTP_HEADER_FIELD_AUTHORIZATION     = 7,
+   HTTP_HEADER_FIELD_UPGRADE           = 8,
+   HTTP_HEADER_FIELD_SEC_WEBSOCKET_KEY = 9,
+   HTTP_HEADER_FIELD_COOKIE            = 10,
+   HTTP_HEADER_FIELD_IF_NONE_MATCH     = 11,
+   HTTP_HEADER_FIELD_RANGE             = 12,
+   HTTP_HEADER_FIELD_IF_RANGE          = 13
+} HttpHeaderFieldId;
+
+
 //The HTTP_FLAG_BREAK macro causes the httpReadStream() function to stop
 //reading data whenever the specified break character is encountered
 #define HTTP_FLAG_BREAK(c) (HTTP_FLAG_BREAK_CHAR | LSB(c))
@@ -490,6 +634,17 @@ typedef struct
 } HttpAuthenticateHeader;
 
 
+/**
+ * @brief Byte range (both offsets are inclusive)
+ **/
+
+typedef struct
+{
+   size_t first; ///<Offset of the first byte
+   size_t last;  ///<Offset of the last byte
+} HttpRange;
+
+
 /**
  * @brief HTTP request
  **/
@@ -521,6 +676,16 @@ typedef struct
 #if (HTTP_SERVER_GZIP_TYPE_SUPPORT == ENABLED)
    bool_t acceptGzipEncoding;
 #endif
+#if (HTTP_SERVER_BROTLI_TYPE_SUPPORT == ENABLED)
+   bool_t acceptBrotliEncoding;
+#endif
+#if (HTTP_SERVER_ETAG_SUPPORT == ENABLED)
+   char_t ifNoneMatch[HTTP_SERVER_IF_NONE_MATCH_MAX_LEN + 1]; ///<If-None-Match header field
+#endif
+#if (HTTP_SERVER_RANGE_SUPPORT == ENABLED)
+   char_t range[HTTP_SERVER_RANGE_MAX_LEN + 1];              ///<Range header field
+   char_t ifRange[HTTP_SERVER_ETAG_MAX_LEN + 1];             ///<If-Range header field
+#endif
 #if (HTTP_SERVER_MULTIPART_TYPE_SUPPORT == ENABLED)
    char_t boundary[HTTP_SERVER_BOUNDARY_MAX_LEN + 1];        ///<Boundary string
    size_t boundaryLength;                                    ///<Boundary string length
@@ -544,6 +709,7 @@ typedef struct
    bool_t noCache;
    uint_t maxAge;
    const char_t *location;
+   const char_t *allow;
    const char_t *contentType;
    bool_t chunkedEncoding;
    size_t contentLength;
@@ -554,6 +720,22 @@ typedef struct
 #if (HTTP_SERVER_GZIP_TYPE_SUPPORT == ENABLED)
    bool_t gzipEncoding;
 #endif
+#if (HTTP_SERVER_BROTLI_TYPE_SUPPORT == ENABLED)
+   bool_t brotliEncoding;
+#endif
+#if (HTTP_SERVER_GZIP_TYPE_SUPPORT == ENABLED || HTTP_SERVER_BROTLI_TYPE_SUPPORT == ENABLED)
+   bool_t varyAcceptEncoding;                        ///<The response depends on Accept-Encoding
+#endif
+#if (HTTP_SERVER_ETAG_SUPPORT == ENABLED)
+   char_t etag[HTTP_SERVER_ETAG_MAX_LEN + 1];        ///<ETag header field
+   bool_t immutable;                                 ///<The representation never changes
+#endif
+#if (HTTP_SERVER_RANGE_SUPPORT == ENABLED)
+   bool_t acceptRanges;                              ///<Byte range requests are supported
+   size_t totalLength;                               ///<Length of the complete representation
+   uint_t rangeCount;                                ///<Number of ranges being sent
+   HttpRange ranges[HTTP_SERVER_MAX_RANGES];         ///<Ranges being sent
+#endif
 #if (HTTP_SERVER_COOKIE_SUPPORT == ENABLED)
    char_t setCookie[HTTP_SERVER_COOKIE_MAX_LEN + 1]; ///<Set-Cookie header field
 #endif
@@ -603,6 +785,49 @@ typedef struct
 } HttpNonceCacheEntry;
 
 
+/**
+ * @brief SSI template segment types
+ **/
+
+typedef enum
+{
+   HTTP_SSI_SEGMENT_STATIC  = 0, ///<Static data, sent as is
+   HTTP_SSI_SEGMENT_INCLUDE = 1, ///<Include directive
+   HTTP_SSI_SEGMENT_ECHO    = 2, ///<Echo directive
+   HTTP_SSI_SEGMENT_EXEC    = 3, ///<Exec directive
+   HTTP_SSI_SEGMENT_INVALID = 4  ///<Unknown directive
+} HttpSsiSegmentType;
+
+
+/**
+ * @brief SSI template segment
+ *
+ * Static segments refer to a span of the resource data. Directive segments
+ * refer to the contents of the tag, between the opening identifier and the
+ * comment terminator
+ *
+ **/
+
+typedef struct
+{
+   uint8_t type;    ///<Segment type
+   uint32_t offset; ///<Offset of the segment in the resource data
+   uint32_t length; ///<Length of the segment
+} HttpSsiSegment;
+
+
+/**
+ * @brief Compiled SSI template
+ **/
+
+typedef struct
+{
+   const char_t *data;                                   ///<Resource data the template was compiled from
+   uint_t segmentCount;                                  ///<Number of segments (0 if the page is too complex)
+   HttpSsiSegment segments[HTTP_SERVER_SSI_MAX_SEGMENTS]; ///<Segments
+} HttpSsiTemplate;
+
+
 /**
  * @brief HTTP server context
  **/
@@ -615,6 +840,10 @@ struct _HttpServerContext
    OsTaskId taskId;                                              ///<Task identifier
    Socket *socket;                                               ///<Listening socket
    HttpConnection *connections;                                  ///<Client connections
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
+   OsEvent event;                                                ///<Event object used to poll the sockets
+   SocketEventDesc eventDesc[HTTP_SERVER_MAX_CONNECTIONS + 1];   ///<The events the server is interested in
+#endif
 #if (HTTP_SERVER_TLS_SUPPORT == ENABLED && TLS_TICKET_SUPPORT == ENABLED)
    TlsTicketContext tlsTicketContext;                            ///<TLS ticket encryption context
 #endif
@@ -622,6 +851,10 @@ struct _HttpServerContext
    OsMutex nonceCacheMutex;                                      ///<Mutex preventing simultaneous access to the nonce cache
    HttpNonceCacheEntry nonceCache[HTTP_SERVER_NONCE_CACHE_SIZE]; ///<Nonce cache
 #endif
+#if (HTTP_SERVER_SSI_SUPPORT == ENABLED && HTTP_SERVER_FS_SUPPORT == DISABLED && HTTP_SERVER_SSI_CACHE_SIZE > 0)
+   OsMutex ssiCacheMutex;                                        ///<Mutex preventing simultaneous access to the SSI cache
+   HttpSsiTemplate ssiCache[HTTP_SERVER_SSI_CACHE_SIZE];         ///<Compiled SSI templates
+#endif
 };
 
 
@@ -651,7 +884,7 @@ struct _HttpConnection
    char_t cgiParam[HTTP_SERVER_CGI_PARAM_MAX_LEN + 1]; ///<CGI parameter
    uint32_t dummy;                                     ///<Force alignment of the buffer on 32-bit boundaries
    char_t buffer[HTTP_SERVER_BUFFER_SIZE];             ///<Memory buffer for input/output operations
-#if (NET_RTOS_SUPPORT == DISABLED)
+#if (NET_RTOS_SUPPORT == DISABLED || HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
    HttpConnState state;                                ///<Connection state
    systime_t timestamp;
    size_t bufferPos;
@@ -659,6 +892,20 @@ struct _HttpConnection
    uint8_t *bodyStart;
    size_t bodyPos;
    size_t bodyLen;
+#endif
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
+   size_t txBufferLen;                                 ///<Number of bytes waiting in the transmit queue
+   uint8_t txBuffer[HTTP_SERVER_TX_BUFFER_SIZE];       ///<Transmit queue
+#endif
+#if (HTTP_SERVER_RANGE_SUPPORT == ENABLED)
+   const uint8_t *rangeData;                           ///<Representation the ranges are taken from
+   uint_t rangeSegment;                                ///<Next segment of the multipart/byteranges body
+#endif
+   uint_t requestCount;                                ///<Number of requests served over the connection
+#if (HTTP_SERVER_RX_BUFFER_SUPPORT == ENABLED)
+   size_t rxBufferPos;                                 ///<Current read position in the receive buffer
+   size_t rxBufferLen;                                 ///<Number of bytes in the receive buffer
+   char_t rxBuffer[HTTP_SERVER_RX_BUFFER_SIZE];        ///<Receive buffer
 #endif
    HTTP_SERVER_PRIVATE_CONTEXT                         ///<Application specific context
 };
@@ -671,6 +918,7 @@ error_t httpServerStart(HttpServerContext *context);
 
 void httpListenerTask(void *param);
 void httpConnectionTask(void *param);
+void httpServerTask(void *param);
 
 error_t httpWriteHeader(HttpConnection *connection);
 
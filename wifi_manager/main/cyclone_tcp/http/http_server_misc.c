@@ -34,10 +34,12 @@
 //Dependencies
 #include <limits.h>
 #include "core/net.h"
+#include "core/socket_misc.h"
 #include "http/http_server.h"
 #include "http/http_server_auth.h"
 #include "http/http_server_misc.h"
 #include "http/mime.h"
+#include "http/ssi.h"
 #include "str.h"
 #include "path.h"
 #include "debug.h"
@@ -45,6 +47,50 @@
 //Check TCP/IP stack configuration
 #if (HTTP_SERVER_SUPPORT == ENABLED)
 
+//Size of the header field name hash table (must be a power of two)
+#define HTTP_HEADER_FIELD_HASH_SIZE 32
+
+
+/**
+ * @brief Header field name hash table entry
+ **/
+
+typedef struct
+{
+   const char_t *name;
+   HttpHeaderFieldId id;
+} HttpHeaderFieldEntry;
+
+
+/**
+ * @brief Perfect hash table of the well-known header field names
+ *
+ * Each name is stored at the slot computed by httpGetHeaderFieldId (length
+ * plus twice the first character plus the last character, both lowercased,
+ * modulo the table size). The hash is collision-free over this set of names,
+ * so that a lookup costs a single case-insensitive comparison. Check that
+ * every name still lands in a distinct slot when adding an entry
+ *
+ **/
+
+static const HttpHeaderFieldEntry httpHeaderFieldTable[HTTP_HEADER_FIELD_HASH_SIZE] =
+{
+   [0]  = {"Transfer-Encoding", HTTP_HEADER_FIELD_TRANSFER_ENCODING},
+   [7]  = {"If-None-Match", HTTP_HEADER_FIELD_IF_NONE_MATCH},
+   [8]  = {"Host", HTTP_HEADER_FIELD_HOST},
+   [14] = {"Range", HTTP_HEADER_FIELD_RANGE},
+   [16] = {"Sec-WebSocket-Key", HTTP_HEADER_FIELD_SEC_WEBSOCKET_KEY},
+   [17] = {"Cookie", HTTP_HEADER_FIELD_COOKIE},
+   [22] = {"Upgrade", HTTP_HEADER_FIELD_UPGRADE},
+   [23] = {"Content-Type", HTTP_HEADER_FIELD_CONTENT_TYPE},
+   [24] = {"Accept-Encoding", HTTP_HEADER_FIELD_ACCEPT_ENCODING},
+   [28] = {"Content-Length", HTTP_HEADER_FIELD_CONTENT_LENGTH},
+   [29] = {"Authorization", HTTP_HEADER_FIELD_AUTHORIZATION},
+   [30] = {"Connection", HTTP_HEADER_FIELD_CONNECTION},
+   [31] = {"If-Range", HTTP_HEADER_FIELD_IF_RANGE}
+};
+
+
 
 /**
  * @brief HTTP status codes
@@ -57,6 +103,7 @@ static const HttpStatusCodeDesc statusCodeList[] =
    {201, "Created"},
    {202, "Accepted"},
    {204, "No Content"},
+   {206, "Partial Content"},
    //Redirection
    {301, "Moved Permanently"},
    {302, "Found"},
@@ -66,6 +113,10 @@ static const HttpStatusCodeDesc statusCodeList[] =
    {401, "Unauthorized"},
    {403, "Forbidden"},
    {404, "Not Found"},
+   {405, "Method Not Allowed"},
+   {411, "Length Required"},
+   {413, "Payload Too Large"},
+   {416, "Range Not Satisfiable"},
    //Server error
    {500, "Internal Server Error"},
    {501, "Not Implemented"},
@@ -85,12 +136,14 @@ error_t httpReadRequestHeader(HttpConnection *connection)
    error_t error;
    size_t length;
 
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == DISABLED)
    //Set the maximum time the server will wait for an HTTP
    //request before closing the connection
    error = socketSetTimeout(connection->socket, HTTP_SERVER_IDLE_TIMEOUT);
    //Any error to report?
    if(error)
       return error;
+#endif
 
    //Read the first line of the request
    error = httpReceive(connection, connection->buffer,
@@ -99,11 +152,13 @@ error_t httpReadRequestHeader(HttpConnection *connection)
    if(error)
       return error;
 
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == DISABLED)
    //Revert to default timeout
    error = socketSetTimeout(connection->socket, HTTP_SERVER_TIMEOUT);
    //Any error to report?
    if(error)
       return error;
+#endif
 
    //Properly terminate the string with a NULL character
    connection->buffer[length] = '\0';
@@ -124,6 +179,13 @@ error_t httpReadRequestHeader(HttpConnection *connection)
    connection->request.connectionUpgrade = FALSE;
    osStrcpy(connection->request.clientKey, "");
 #endif
+#if (HTTP_SERVER_ETAG_SUPPORT == ENABLED)
+   osStrcpy(connection->request.ifNoneMatch, "");
+#endif
+#if (HTTP_SERVER_RANGE_SUPPORT == ENABLED)
+   osStrcpy(connection->request.range, "");
+   osStrcpy(connection->request.ifRange, "");
+#endif
 
    //HTTP 0.9 does not support Full-Request
    if(connection->request.version >= HTTP_VERSION_1_0)
@@ -151,7 +213,7 @@ error_t httpReadRequestHeader(HttpConnection *connection)
          TRACE_DEBUG("%s", connection->buffer);
 
          //An empty line indicates the end of the header fields
-         if(osStrcmp(connection->buffer, "\r\n") == 0)
+         if(httpIsEmptyLine(connection->buffer))
             break;
 
          //Check whether a separator is present
@@ -190,6 +252,192 @@ error_t httpReadRequestHeader(HttpConnection *connection)
 }
 
 
+/**
+ * @brief Process HTTP request and send the response
+ *
+ * The request header must have been read and parsed beforehand
+ *
+ * @param[in] connection Structure representing an HTTP connection
+ * @return Error code
+ **/
+
+error_t httpProcessRequest(HttpConnection *connection)
+{
+   error_t error;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+#if (HTTP_SERVER_BASIC_AUTH_SUPPORT == ENABLED || HTTP_SERVER_DIGEST_AUTH_SUPPORT == ENABLED)
+   //No Authorization header found?
+   if(!connection->request.auth.found)
+   {
+      //Invoke user-defined callback, if any
+      if(connection->settings->authCallback != NULL)
+      {
+         //Check whether the access to the specified URI is authorized
+         connection->status = connection->settings->authCallback(connection,
+            connection->request.auth.user, connection->request.uri);
+      }
+      else
+      {
+         //Access to the specified URI is allowed
+         connection->status = HTTP_ACCESS_ALLOWED;
+      }
+   }
+
+   //Check access status
+   if(connection->status == HTTP_ACCESS_ALLOWED)
+   {
+      //Access to the specified URI is allowed
+      error = NO_ERROR;
+   }
+   else if(connection->status == HTTP_ACCESS_BASIC_AUTH_REQUIRED)
+   {
+      //Basic access authentication is required
+      connection->response.auth.mode = HTTP_AUTH_MODE_BASIC;
+      //Report an error
+      error = ERROR_AUTH_REQUIRED;
+   }
+   else if(connection->status == HTTP_ACCESS_DIGEST_AUTH_REQUIRED)
+   {
+      //Digest access authentication is required
+      connection->response.auth.mode = HTTP_AUTH_MODE_DIGEST;
+      //Report an error
+      error = ERROR_AUTH_REQUIRED;
+   }
+   else
+   {
+      //Access to the specified URI is denied
+      error = ERROR_NOT_FOUND;
+   }
+#endif
+   //Debug message
+   TRACE_INFO("Sending HTTP response to the client...\r\n");
+
+   //Check status code
+   if(!error)
+   {
+      //Default HTTP header fields
+      httpInitResponseHeader(connection);
+
+      //Invoke user-defined callback, if any
+      if(connection->settings->requestCallback != NULL)
+      {
+         error = connection->settings->requestCallback(connection,
+            connection->request.uri);
+      }
+      else
+      {
+         //Keep processing...
+         error = ERROR_NOT_FOUND;
+      }
+
+      //Check status code
+      if(error == ERROR_NOT_FOUND)
+      {
+#if (HTTP_SERVER_SSI_SUPPORT == ENABLED)
+         //Use server-side scripting to dynamically generate HTML code?
+         if(httpCompExtension(connection->request.uri, ".stm") ||
+            httpCompExtension(connection->request.uri, ".shtm") ||
+            httpCompExtension(connection->request.uri, ".shtml"))
+         {
+            //SSI processing (Server Side Includes)
+            error = ssiExecuteScript(connection, connection->request.uri, 0);
+         }
+         else
+#endif
+         {
+            //Set the maximum age for static resources
+            connection->response.maxAge = HTTP_SERVER_MAX_AGE;
+
+            //Send the contents of the requested page
+            error = httpSendResponse(connection, connection->request.uri);
+         }
+      }
+
+      //The requested resource is not available?
+      if(error == ERROR_NOT_FOUND)
+      {
+         //Default HTTP header fields
+         httpInitResponseHeader(connection);
+
+         //Invoke user-defined callback, if any
+         if(connection->settings->uriNotFoundCallback != NULL)
+         {
+            error = connection->settings->uriNotFoundCallback(connection,
+               connection->request.uri);
+         }
+      }
+   }
+
+   //Check status code
+   if(error)
+   {
+      //Default HTTP header fields
+      httpInitResponseHeader(connection);
+
+      //Bad request?
+      if(error == ERROR_INVALID_REQUEST)
+      {
+         //Send an error 400 and close the connection immediately
+         httpSendErrorResponse(connection, 400,
+            "The request is badly formed");
+      }
+      //Authorization required?
+      else if(error == ERROR_AUTH_REQUIRED)
+      {
+         //Send an error 401 and keep the connection alive
+         error = httpSendErrorResponse(connection, 401,
+            "Authorization required");
+      }
+      //Page not found?
+      else if(error == ERROR_NOT_FOUND)
+      {
+         //Send an error 404 and keep the connection alive
+         error = httpSendErrorResponse(connection, 404,
+            "The requested page could not be found");
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Discard the part of the request body the application did not read
+ *
+ * The body must be consumed before the next request of a persistent
+ * connection can be located in the stream
+ *
+ * @param[in] connection Structure representing an HTTP connection
+ * @return Error code
+ **/
+
+error_t httpDiscardRequestBody(HttpConnection *connection)
+{
+   error_t error;
+   size_t n;
+
+   //Read the remaining data, if any
+   do
+   {
+      error = httpReadStream(connection, connection->buffer,
+         HTTP_SERVER_BUFFER_SIZE, &n, 0);
+   } while(!error);
+
+   //The end of the request body has been reached?
+   if(error == ERROR_END_OF_STREAM)
+   {
+      error = NO_ERROR;
+   }
+
+   //Return status code
+   return error;
+}
+
+
 /**
  * @brief Parse Request-Line
  * @param[in] connection Structure representing an HTTP connection
@@ -321,6 +569,8 @@ error_t httpReadHeaderField(HttpConnection *connection,
    size_t n;
    size_t length;
 
+   //Initialize status code
+   error = NO_ERROR;
    //This is the actual length of the header field
    length = 0;
 
@@ -361,6 +611,15 @@ error_t httpReadHeaderField(HttpConnection *connection,
          length = 1;
       }
 
+      //A bare LF may terminate the empty line that ends the header fields
+      if(length == 1 && buffer[0] == '\n')
+      {
+         //Properly terminate the string with a NULL character
+         buffer[length] = '\0';
+         //The line is complete
+         break;
+      }
+
       //Read data until a CLRF character is encountered
       error = httpReceive(connection, buffer + length,
          size - 1 - length, &n, SOCKET_FLAG_BREAK_CRLF);
@@ -374,7 +633,7 @@ error_t httpReadHeaderField(HttpConnection *connection,
       buffer[length] = '\0';
 
       //An empty line indicates the end of the header fields
-      if(osStrcmp(buffer, "\r\n") == 0)
+      if(httpIsEmptyLine(buffer))
          break;
 
       //Read the next character to detect if the CRLF is immediately
@@ -389,15 +648,18 @@ error_t httpReadHeaderField(HttpConnection *connection,
       if(*firstChar == ' ' || *firstChar == '\t')
       {
          //CRLF immediately followed by LWSP as equivalent to the LWSP character
-         if(length >= 2)
+         if(length >= 1 && buffer[length - 1] == '\n')
          {
-            if(buffer[length - 2] == '\r' || buffer[length - 1] == '\n')
+            //Remove trailing CRLF sequence (or bare LF)
+            length--;
+
+            if(length >= 1 && buffer[length - 1] == '\r')
             {
-               //Remove trailing CRLF sequence
-               length -= 2;
-               //Properly terminate the string with a NULL character
-               buffer[length] = '\0';
+               length--;
             }
+
+            //Properly terminate the string with a NULL character
+            buffer[length] = '\0';
          }
       }
 
@@ -409,6 +671,23 @@ error_t httpReadHeaderField(HttpConnection *connection,
 }
 
 
+/**
+ * @brief Check whether a header line is empty
+ *
+ * Header lines are terminated by CRLF, but a bare LF is accepted as well
+ * (refer to RFC 9112, section 2.2)
+ *
+ * @param[in] line NULL-terminated line, including its terminator
+ * @return TRUE if the line is empty, else FALSE
+ **/
+
+bool_t httpIsEmptyLine(const char_t *line)
+{
+   //An empty line only consists of its line terminator
+   return (osStrcmp(line, "\r\n") == 0 || osStrcmp(line, "\n") == 0);
+}
+
+
 /**
  * @brief Parse HTTP header field
  * @param[in] connection Structure representing an HTTP connection
@@ -419,75 +698,114 @@ error_t httpReadHeaderField(HttpConnection *connection,
 void httpParseHeaderField(HttpConnection *connection,
    const char_t *name, char_t *value)
 {
-   //Host header field?
-   if(osStrcasecmp(name, "Host") == 0)
+   //Check header field name
+   switch(httpGetHeaderFieldId(name))
    {
+   //Host header field?
+   case HTTP_HEADER_FIELD_HOST:
       //Save host name
       strSafeCopy(connection->request.host, value,
          HTTP_SERVER_HOST_MAX_LEN);
-   }
+      break;
+
    //Connection header field?
-   else if(osStrcasecmp(name, "Connection") == 0)
-   {
+   case HTTP_HEADER_FIELD_CONNECTION:
       //Parse Connection header field
       httpParseConnectionField(connection, value);
-   }
+      break;
+
    //Transfer-Encoding header field?
-   else if(osStrcasecmp(name, "Transfer-Encoding") == 0)
-   {
+   case HTTP_HEADER_FIELD_TRANSFER_ENCODING:
       //Check whether chunked encoding is used
       if(osStrcasecmp(value, "chunked") == 0)
          connection->request.chunkedEncoding = TRUE;
-   }
+      break;
+
    //Content-Type field header?
-   else if(osStrcasecmp(name, "Content-Type") == 0)
-   {
+   case HTTP_HEADER_FIELD_CONTENT_TYPE:
       //Parse Content-Type header field
       httpParseContentTypeField(connection, value);
-   }
+      break;
+
    //Content-Length header field?
-   else if(osStrcasecmp(name, "Content-Length") == 0)
-   {
+   case HTTP_HEADER_FIELD_CONTENT_LENGTH:
       //Get the length of the body data
       connection->request.contentLength = atoi(value);
-   }
+      break;
+
    //Accept-Encoding field header?
-   else if(osStrcasecmp(name, "Accept-Encoding") == 0)
-   {
+   case HTTP_HEADER_FIELD_ACCEPT_ENCODING:
       //Parse Content-Type header field
       httpParseAcceptEncodingField(connection, value);
-   }
+      break;
+
    //Authorization header field?
-   else if(osStrcasecmp(name, "Authorization") == 0)
-   {
+   case HTTP_HEADER_FIELD_AUTHORIZATION:
       //Parse Authorization header field
       httpParseAuthorizationField(connection, value);
-   }
+      break;
+
 #if (HTTP_SERVER_WEB_SOCKET_SUPPORT == ENABLED)
    //Upgrade header field?
-   else if(osStrcasecmp(name, "Upgrade") == 0)
-   {
+   case HTTP_HEADER_FIELD_UPGRADE:
       //WebSocket support?
       if(osStrcasecmp(value, "websocket") == 0)
          connection->request.upgradeWebSocket = TRUE;
-   }
+      break;
+
    //Sec-WebSocket-Key header field?
-   else if(osStrcasecmp(name, "Sec-WebSocket-Key") == 0)
-   {
+   case HTTP_HEADER_FIELD_SEC_WEBSOCKET_KEY:
       //Save the contents of the Sec-WebSocket-Key header field
       strSafeCopy(connection->request.clientKey, value,
          WEB_SOCKET_CLIENT_KEY_SIZE + 1);
-   }
+      break;
 #endif
+
 #if (HTTP_SERVER_COOKIE_SUPPORT == ENABLED)
    //Cookie header field?
-   else if(osStrcasecmp(name, "Cookie") == 0)
-   {
+   case HTTP_HEADER_FIELD_COOKIE:
       //Parse Cookie header field
       httpParseCookieField(connection, value);
-   }
+      break;
+#endif
+
+#if (HTTP_SERVER_ETAG_SUPPORT == ENABLED)
+   //If-None-Match header field?
+   case HTTP_HEADER_FIELD_IF_NONE_MATCH:
+      //Save the list of entity tags
+      strSafeCopy(connection->request.ifNoneMatch, value,
+         HTTP_SERVER_IF_NONE_MATCH_MAX_LEN);
+      break;
+#endif
+
+#if (HTTP_SERVER_RANGE_SUPPORT == ENABLED)
+   //Range header field?
+   case HTTP_HEADER_FIELD_RANGE:
+      //Save the list of byte ranges
+      strSafeCopy(connection->request.range, value,
+         HTTP_SERVER_RANGE_MAX_LEN);
+      break;
+
+   //If-Range header field?
+   case HTTP_HEADER_FIELD_IF_RANGE:
+      //Entity tags longer than ours and HTTP dates can never match
+      if(osStrlen(value) <= HTTP_SERVER_ETAG_MAX_LEN)
+      {
+         osStrcpy(connection->request.ifRange, value);
+      }
+      else
+      {
+         osStrcpy(connection->request.ifRange, "-");
+      }
+      break;
 #endif
 
+   //Unknown header field?
+   default:
+      //Discard unknown header fields
+      break;
+   }
+
 #if defined(HTTP_PARSE_REQUEST_HEADER_FIELD_HOOK)
    //Parse custom header fields
    HTTP_PARSE_REQUEST_HEADER_FIELD_HOOK(connection, name, value);
@@ -495,6 +813,44 @@ void httpParseHeaderField(HttpConnection *connection,
 }
 
 
+/**
+ * @brief Identify a well-known header field
+ * @param[in] name NULL-terminated name of the header field
+ * @return Header field identifier (HTTP_HEADER_FIELD_UNKNOWN if the name
+ *   does not match any of the header fields the server cares about)
+ **/
+
+HttpHeaderFieldId httpGetHeaderFieldId(const char_t *name)
+{
+   size_t n;
+   uint_t h;
+   const HttpHeaderFieldEntry *entry;
+
+   //Retrieve the length of the name
+   n = osStrlen(name);
+
+   //Empty names cannot match any entry
+   if(n == 0)
+      return HTTP_HEADER_FIELD_UNKNOWN;
+
+   //Hash the length together with the first and last characters, which is
+   //enough to tell the well-known header fields apart
+   h = (uint_t) n + 2 * osTolower(name[0]) + osTolower(name[n - 1]);
+   //Point to the matching slot
+   entry = &httpHeaderFieldTable[h & (HTTP_HEADER_FIELD_HASH_SIZE - 1)];
+
+   //A single comparison confirms the match
+   if(entry->name != NULL && osStrcasecmp(name, entry->name) == 0)
+   {
+      return entry->id;
+   }
+   else
+   {
+      return HTTP_HEADER_FIELD_UNKNOWN;
+   }
+}
+
+
 /**
  * @brief Parse Connection header field
  * @param[in] connection Structure representing an HTTP connection
@@ -627,8 +983,9 @@ void httpParseContentTypeField(HttpConnection *connection,
 void httpParseAcceptEncodingField(HttpConnection *connection,
    char_t *value)
 {
-#if (HTTP_SERVER_GZIP_TYPE_SUPPORT == ENABLED)
+#if (HTTP_SERVER_GZIP_TYPE_SUPPORT == ENABLED || HTTP_SERVER_BROTLI_TYPE_SUPPORT == ENABLED)
    char_t *p;
+   char_t *q;
    char_t *token;
 
    //Get the first value of the list
@@ -637,15 +994,53 @@ void httpParseAcceptEncodingField(HttpConnection *connection,
    //Parse the comma-separated list
    while(token != NULL)
    {
+      //Check whether a quality value is present
+      q = osStrchr(token, ';');
+
+      //Quality value found?
+      if(q != NULL)
+      {
+         //Split the value
+         *(q++) = '\0';
+         //Trim whitespace characters
+         q = strTrimWhitespace(q);
+
+         //Skip the "q=" prefix and any leading zeroes
+         if((q[0] == 'q' || q[0] == 'Q') && q[1] == '=')
+         {
+            for(q += 2; *q == '0' || *q == '.'; q++)
+            {
+            }
+         }
+
+         //A quality value of zero means "not acceptable"
+         if(*q == '\0')
+         {
+            //Skip the current value
+            token = osStrtok_r(NULL, ",", &p);
+            continue;
+         }
+      }
+
       //Trim whitespace characters
       value = strTrimWhitespace(token);
 
+#if (HTTP_SERVER_GZIP_TYPE_SUPPORT == ENABLED)
       //Check current value
       if(osStrcasecmp(value, "gzip") == 0)
       {
          //gzip compression is supported
          connection->request.acceptGzipEncoding = TRUE;
       }
+#endif
+#if (HTTP_SERVER_BROTLI_TYPE_SUPPORT == ENABLED)
+      //Check current value
+      if(osStrcasecmp(value, "br") == 0)
+      {
+         //Brotli compression is supported
+         connection->request.acceptBrotliEncoding = TRUE;
+      }
+#endif
 
       //Get next value
       token = osStrtok_r(NULL, ",", &p);
@@ -763,6 +1158,7 @@ void httpInitResponseHeader(HttpConnection *connection)
    connection->response.noCache = FALSE;
    connection->response.maxAge = 0;
    connection->response.location = NULL;
+   connection->response.allow = NULL;
    connection->response.contentType = mimeGetType(connection->request.uri);
    connection->response.chunkedEncoding = TRUE;
 
@@ -770,10 +1166,35 @@ void httpInitResponseHeader(HttpConnection *connection)
    //Do not use gzip encoding
    connection->response.gzipEncoding = FALSE;
 #endif
+#if (HTTP_SERVER_BROTLI_TYPE_SUPPORT == ENABLED)
+   //Do not use Brotli encoding
+   connection->response.brotliEncoding = FALSE;
+#endif
+#if (HTTP_SERVER_GZIP_TYPE_SUPPORT == ENABLED || HTTP_SERVER_BROTLI_TYPE_SUPPORT == ENABLED)
+   //The response does not depend on Accept-Encoding
+   connection->response.varyAcceptEncoding = FALSE;
+#endif
+#if (HTTP_SERVER_ETAG_SUPPORT == ENABLED)
+   //No entity tag
+   connection->response.etag[0] = '\0';
+   connection->response.immutable = FALSE;
+#endif
+#if (HTTP_SERVER_RANGE_SUPPORT == ENABLED)
+   //The whole representation is sent
+   connection->response.acceptRanges = FALSE;
+   connection->response.totalLength = 0;
+   connection->response.rangeCount = 0;
+#endif
 
 #if (HTTP_SERVER_PERSISTENT_CONN_SUPPORT == ENABLED)
    //Persistent connections are accepted
    connection->response.keepAlive = connection->request.keepAlive;
+
+   //Limit the number of requests per connection
+   if((connection->requestCount + 1) >= HTTP_SERVER_MAX_REQUESTS)
+   {
+      connection->response.keepAlive = FALSE;
+   }
 #else
    //Connections are not persistent by default
    connection->response.keepAlive = FALSE;
@@ -854,6 +1275,13 @@ error_t httpFormatResponseHeader(HttpConnection *connection, char_t *buffer)
       p += osSprintf(p, "Location: %s\r\n", connection->response.location);
    }
 
+   //Valid list of allowed methods?
+   if(connection->response.allow != NULL)
+   {
+      //Set Allow field
+      p += osSprintf(p, "Allow: %s\r\n", connection->response.allow);
+   }
+
    //Persistent connection?
    if(connection->response.keepAlive)
    {
@@ -862,7 +1290,8 @@ error_t httpFormatResponseHeader(HttpConnection *connection, char_t *buffer)
 
       //Set Keep-Alive field
       p += osSprintf(p, "Keep-Alive: timeout=%u, max=%u\r\n",
-         HTTP_SERVER_IDLE_TIMEOUT / 1000, HTTP_SERVER_MAX_REQUESTS);
+         HTTP_SERVER_IDLE_TIMEOUT / 1000,
+         HTTP_SERVER_MAX_REQUESTS - connection->requestCount - 1);
    }
    else
    {
@@ -879,12 +1308,29 @@ error_t httpFormatResponseHeader(HttpConnection *connection, char_t *buffer)
       p += osSprintf(p, "Cache-Control: no-store, no-cache, must-revalidate\r\n");
       p += osSprintf(p, "Cache-Control: max-age=0, post-check=0, pre-check=0\r\n");
    }
+#if (HTTP_SERVER_ETAG_SUPPORT == ENABLED)
+   else if(connection->response.immutable)
+   {
+      //Fingerprinted resources can be cached for as long as possible
+      p += osSprintf(p, "Cache-Control: max-age=%u, immutable\r\n",
+         HTTP_SERVER_IMMUTABLE_MAX_AGE);
+   }
+#endif
    else if(connection->response.maxAge != 0)
    {
       //Set Cache-Control field
       p += osSprintf(p, "Cache-Control: max-age=%u\r\n", connection->response.maxAge);
    }
 
+#if (HTTP_SERVER_ETAG_SUPPORT == ENABLED)
+   //Valid entity tag?
+   if(connection->response.etag[0] != '\0')
+   {
+      //Set ETag field
+      p += osSprintf(p, "ETag: %s\r\n", connection->response.etag);
+   }
+#endif
+
 #if (HTTP_SERVER_TLS_SUPPORT == ENABLED && HTTP_SERVER_HSTS_SUPPORT == ENABLED)
    //TLS-secured connection?
    if(connection->serverContext->settings.tlsInitCallback != NULL)
@@ -912,8 +1358,44 @@ error_t httpFormatResponseHeader(HttpConnection *connection, char_t *buffer)
    }
 #endif
 
+#if (HTTP_SERVER_RANGE_SUPPORT == ENABLED)
+   //Byte range requests are supported for this resource?
+   if(connection->response.acceptRanges)
+   {
+      //Set Accept-Ranges field
+      p += osSprintf(p, "Accept-Ranges: bytes\r\n");
+   }
+
+   //Unsatisfiable range?
+   if(connection->response.statusCode == 416)
+   {
+      //Indicate the current length of the representation
+      p += osSprintf(p, "Content-Range: bytes */%" PRIuSIZE "\r\n",
+         connection->response.totalLength);
+   }
+   //Single range?
+   else if(connection->response.rangeCount == 1)
+   {
+      //Set Content-Range field
+      p += osSprintf(p, "Content-Range: bytes %" PRIuSIZE "-%" PRIuSIZE
+         "/%" PRIuSIZE "\r\n", connection->response.ranges[0].first,
+         connection->response.ranges[0].last, connection->response.totalLength);
+   }
+   //Multiple ranges?
+   else if(connection->response.rangeCount > 1)
+   {
+      //Each part carries its own Content-Type and Content-Range fields
+      p += osSprintf(p, "Content-Type: multipart/byteranges; boundary="
+         HTTP_SERVER_RANGE_BOUNDARY "\r\n");
+   }
+
+   //The content type of a multipart response has already been set
+   if(connection->response.contentType != NULL &&
+      connection->response.rangeCount <= 1)
+#else
    //Valid content type?
    if(connection->response.contentType != NULL)
+#endif
    {
       //Content type
       p += osSprintf(p, "Content-Type: %s\r\n", connection->response.contentType);
@@ -928,6 +1410,24 @@ error_t httpFormatResponseHeader(HttpConnection *connection, char_t *buffer)
    }
 #endif
 
+#if (HTTP_SERVER_BROTLI_TYPE_SUPPORT == ENABLED)
+   //Use Brotli encoding?
+   if(connection->response.brotliEncoding)
+   {
+      //Set Content-Encoding field
+      p += osSprintf(p, "Content-Encoding: br\r\n");
+   }
+#endif
+
+#if (HTTP_SERVER_GZIP_TYPE_SUPPORT == ENABLED || HTTP_SERVER_BROTLI_TYPE_SUPPORT == ENABLED)
+   //The representation was selected according to Accept-Encoding?
+   if(connection->response.varyAcceptEncoding)
+   {
+      //Caches must take the Accept-Encoding field into account
+      p += osSprintf(p, "Vary: Accept-Encoding\r\n");
+   }
+#endif
+
    //Use chunked encoding transfer?
    if(connection->response.chunkedEncoding)
    {
@@ -965,7 +1465,10 @@ error_t httpFormatResponseHeader(HttpConnection *connection, char_t *buffer)
 error_t httpSend(HttpConnection *connection,
    const void *data, size_t length, uint_t flags)
 {
-#if (NET_RTOS_SUPPORT == ENABLED)
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
+   //The server task must never wait for the client
+   return httpQueueData(connection, data, length, flags);
+#elif (NET_RTOS_SUPPORT == ENABLED)
    error_t error;
 
 #if (HTTP_SERVER_TLS_SUPPORT == ENABLED)
@@ -1001,37 +1504,238 @@ error_t httpSend(HttpConnection *connection,
 
 
 /**
- * @brief Receive data from the client
+ * @brief Send data without blocking (event-driven mode)
+ *
+ * The data that do not fit in the socket send buffer are kept in the
+ * transmit queue of the connection and sent by the server task as soon as
+ * the socket is ready. A client that does not read its responses fills the
+ * queue, in which case the connection is dropped
+ *
  * @param[in] connection Structure representing an HTTP connection
- * @param[out] data Buffer into which received data will be placed
- * @param[in] size Maximum number of bytes that can be received
- * @param[out] received Actual number of bytes that have been received
+ * @param[in] data Pointer to a buffer containing the data to be transmitted
+ * @param[in] length Number of bytes to be transmitted
  * @param[in] flags Set of flags that influences the behavior of this function
  * @return Error code
  **/
 
-error_t httpReceive(HttpConnection *connection,
-   void *data, size_t size, size_t *received, uint_t flags)
+error_t httpQueueData(HttpConnection *connection,
+   const void *data, size_t length, uint_t flags)
 {
-#if (NET_RTOS_SUPPORT == ENABLED)
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
    error_t error;
+   size_t n;
+   const uint8_t *p;
 
-#if (HTTP_SERVER_TLS_SUPPORT == ENABLED)
-   //Check whether a secure connection is being used
-   if(connection->tlsContext != NULL)
+   //Point to the data to be transmitted
+   p = (const uint8_t *) data;
+   //No data has been sent yet
+   n = 0;
+
+   //Queued data must be sent first
+   error = httpFlushTxBuffer(connection);
+
+   //Check whether the transmit queue is empty
+   if(!error && connection->txBufferLen == 0)
    {
-      //Use TLS to receive data from the client
-      error = tlsRead(connection->tlsContext, data, size, received, flags);
+      //Copy as much data as possible to the socket send buffer
+      error = socketSend(connection->socket, p, length, &n, flags);
+
+      //The send buffer is full?
+      if(error == ERROR_TIMEOUT || error == ERROR_WOULD_BLOCK)
+      {
+         error = NO_ERROR;
+      }
    }
-   else
+
+   //Check status code
+   if(!error)
+   {
+      //Number of bytes that could not be sent
+      p += n;
+      length -= n;
+
+      //Any data left?
+      if(length > 0)
+      {
+         //Make sure the transmit queue is large enough
+         if(length <= (HTTP_SERVER_TX_BUFFER_SIZE - connection->txBufferLen))
+         {
+            //Queue the remaining data
+            osMemcpy(connection->txBuffer + connection->txBufferLen, p, length);
+            connection->txBufferLen += length;
+         }
+         else
+         {
+            //The client does not read the response fast enough
+            error = ERROR_BUFFER_OVERFLOW;
+         }
+      }
+   }
+
+   //Return status code
+   return error;
+#else
+   //Not implemented
+   return ERROR_NOT_IMPLEMENTED;
 #endif
+}
+
+
+/**
+ * @brief Send the contents of the transmit queue (event-driven mode)
+ * @param[in] connection Structure representing an HTTP connection
+ * @return Error code
+ **/
+
+error_t httpFlushTxBuffer(HttpConnection *connection)
+{
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
+   error_t error;
+   size_t n;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Any data pending in the transmit queue?
+   if(connection->txBufferLen > 0)
    {
-      //Receive data from the client
-      error = socketReceive(connection->socket, data, size, received, flags);
+      //Copy as much data as possible to the socket send buffer
+      error = socketSend(connection->socket, connection->txBuffer,
+         connection->txBufferLen, &n, SOCKET_FLAG_NO_DELAY);
+
+      //The send buffer is full?
+      if(error == ERROR_TIMEOUT || error == ERROR_WOULD_BLOCK)
+      {
+         error = NO_ERROR;
+      }
+
+      //Check status code
+      if(!error && n > 0)
+      {
+         //Remove the data that have been sent from the queue
+         connection->txBufferLen -= n;
+
+         osMemmove(connection->txBuffer, connection->txBuffer + n,
+            connection->txBufferLen);
+      }
+   }
+
+   //Return status code
+   return error;
+#else
+   //Not implemented
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
+/**
+ * @brief Receive data from the client
+ * @param[in] connection Structure representing an HTTP connection
+ * @param[out] data Buffer into which received data will be placed
+ * @param[in] size Maximum number of bytes that can be received
+ * @param[out] received Actual number of bytes that have been received
+ * @param[in] flags Set of flags that influences the behavior of this function
+ * @return Error code
+ **/
+
+error_t httpReceive(HttpConnection *connection,
+   void *data, size_t size, size_t *received, uint_t flags)
+{
+#if (NET_RTOS_SUPPORT == ENABLED && HTTP_SERVER_RX_BUFFER_SUPPORT == ENABLED)
+   error_t error;
+   size_t i;
+   size_t n;
+   bool_t found;
+   char_t *p;
+
+   //Initialize variables
+   error = NO_ERROR;
+   found = FALSE;
+
+   //Point to the output buffer
+   p = (char_t *) data;
+   //No data has been read yet
+   *received = 0;
+
+   //Read as much data as requested
+   while(*received < size && !found)
+   {
+      //Number of data bytes that are pending in the receive buffer
+      n = connection->rxBufferLen - connection->rxBufferPos;
+
+      //The receive buffer is empty?
+      if(n == 0)
+      {
+         //Large reads bypass the receive buffer
+         if((size - *received) >= HTTP_SERVER_RX_BUFFER_SIZE &&
+            (flags & HTTP_FLAG_BREAK_CHAR) == 0)
+         {
+            //Read data directly into the user buffer
+            error = httpReceiveData(connection, p, size - *received, &n, flags);
+            //Total number of data that have been read
+            *received += n;
+            //We are done
+            break;
+         }
+
+         //Rewind to the beginning of the receive buffer
+         connection->rxBufferPos = 0;
+         connection->rxBufferLen = 0;
+
+         //Fetch as much data as available in a single call
+         error = httpReceiveData(connection, connection->rxBuffer,
+            HTTP_SERVER_RX_BUFFER_SIZE, &n, 0);
+         //Any error to report?
+         if(error)
+            break;
+
+         //Update the length of the receive buffer
+         connection->rxBufferLen = n;
+      }
+      else
+      {
+         //Limit the number of bytes to read at a time
+         n = MIN(n, size - *received);
+
+         //The HTTP_FLAG_BREAK_CHAR flag causes the function to stop reading
+         //data as soon as the specified break character is encountered
+         if((flags & HTTP_FLAG_BREAK_CHAR) != 0)
+         {
+            //Search for the specified break character
+            i = httpFindChar(connection->rxBuffer + connection->rxBufferPos,
+               n, LSB(flags));
+
+            //Break character found?
+            if(i < n)
+            {
+               n = i + 1;
+               found = TRUE;
+            }
+         }
+
+         //Copy data to user buffer
+         osMemcpy(p, connection->rxBuffer + connection->rxBufferPos, n);
+
+         //Advance current position
+         connection->rxBufferPos += n;
+         //Total number of data that have been read
+         *received += n;
+         //Advance data pointer
+         p += n;
+
+         //Return as soon as some data is available unless the
+         //HTTP_FLAG_WAIT_ALL or HTTP_FLAG_BREAK_CHAR flag is set
+         if((flags & (HTTP_FLAG_WAIT_ALL | HTTP_FLAG_BREAK_CHAR)) == 0)
+            break;
+      }
    }
 
    //Return status code
    return error;
+#elif (NET_RTOS_SUPPORT == ENABLED)
+   //Receive data from the client
+   return httpReceiveData(connection, data, size, received, flags);
 #else
    error_t error;
    char_t c;
@@ -1055,9 +1759,7 @@ error_t httpReceive(HttpConnection *connection,
          c = LSB(flags);
 
          //Search for the specified break character
-         for(i = 0; i < n && connection->buffer[connection->bufferPos + i] != c; i++)
-         {
-         }
+         i = httpFindChar(connection->buffer + connection->bufferPos, n, c);
 
          //Adjust the number of data to read
          n = MIN(n, i + 1);
@@ -1087,27 +1789,1053 @@ error_t httpReceive(HttpConnection *connection,
 
 
 /**
- * @brief Retrieve the full pathname to the specified resource
+ * @brief Receive data from the underlying transport
+ *
+ * This function bypasses the receive buffer
+ *
  * @param[in] connection Structure representing an HTTP connection
- * @param[in] relative String containing the relative path to the resource
- * @param[out] absolute Resulting string containing the absolute path
- * @param[in] maxLen Maximum acceptable path length
+ * @param[out] data Buffer into which received data will be placed
+ * @param[in] size Maximum number of bytes that can be received
+ * @param[out] received Actual number of bytes that have been received
+ * @param[in] flags Set of flags that influences the behavior of this function
+ * @return Error code
  **/
 
-void httpGetAbsolutePath(HttpConnection *connection,
-   const char_t *relative, char_t *absolute, size_t maxLen)
+error_t httpReceiveData(HttpConnection *connection,
+   void *data, size_t size, size_t *received, uint_t flags)
 {
-   //Copy the root directory
-   osStrcpy(absolute, connection->settings->rootDirectory);
+   error_t error;
 
-   //Append the specified path
-   pathCombine(absolute, relative, maxLen);
+#if (HTTP_SERVER_TLS_SUPPORT == ENABLED)
+   //Check whether a secure connection is being used
+   if(connection->tlsContext != NULL)
+   {
+      //Use TLS to receive data from the client
+      error = tlsRead(connection->tlsContext, data, size, received, flags);
+   }
+   else
+#endif
+   {
+      //Receive data from the client
+      error = socketReceive(connection->socket, data, size, received, flags);
+   }
 
-   //Clean the resulting path
-   pathCanonicalize(absolute);
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Accept an incoming connection (event-driven mode)
+ * @param[in] context Pointer to the HTTP server context
+ **/
+
+void httpAcceptConnection(HttpServerContext *context)
+{
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
+   uint_t i;
+   uint16_t clientPort;
+   IpAddr clientIpAddr;
+   HttpConnection *connection;
+   Socket *socket;
+
+   //Accept an incoming connection
+   socket = socketAccept(context->socket, &clientIpAddr, &clientPort);
+   //Make sure the socket handle is valid
+   if(socket == NULL)
+      return;
+
+   //Loop through the connection table
+   for(i = 0; i < context->settings.maxConnections; i++)
+   {
+      //Point to the current connection
+      connection = &context->connections[i];
+
+      //Unused slot?
+      if(connection->state == HTTP_CONN_STATE_IDLE)
+      {
+         //Debug message
+         TRACE_INFO("Connection established with client %s port %" PRIu16 "...\r\n",
+            ipAddrToString(&clientIpAddr, NULL), clientPort);
+
+         //Reference to the HTTP server settings
+         connection->settings = &context->settings;
+         //Reference to the HTTP server context
+         connection->serverContext = context;
+         //Reference to the new socket
+         connection->socket = socket;
+
+         //The server task must never block on the socket
+         socketSetTimeout(connection->socket, 0);
+
+         //Flush the receive buffer
+         connection->rxBufferPos = 0;
+         connection->rxBufferLen = 0;
+         //Flush the transmit queue
+         connection->txBufferLen = 0;
+         //No response body is pending
+         connection->bodyStart = NULL;
+         connection->bodyPos = 0;
+         connection->bodyLen = 0;
+         //Number of requests served over the connection
+         connection->requestCount = 0;
+
+         //Wait for the first request
+         connection->state = HTTP_CONN_STATE_REQ_LINE;
+         connection->timestamp = osGetSystemTime();
+
+         //We are done
+         return;
+      }
+   }
+
+   //The connection table is full
+   socketClose(socket);
+#endif
+}
+
+
+/**
+ * @brief Retrieve the socket events a connection is waiting for
+ * @param[in] connection Structure representing an HTTP connection
+ * @return Event mask
+ **/
+
+uint_t httpGetConnectionEvents(HttpConnection *connection)
+{
+   uint_t eventMask;
+
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
+   //Check current state
+   if(connection->state == HTTP_CONN_STATE_REQ_LINE ||
+      connection->state == HTTP_CONN_STATE_REQ_HEADER ||
+      connection->state == HTTP_CONN_STATE_REQ_BODY)
+   {
+      //Wait for incoming data
+      eventMask = SOCKET_EVENT_RX_READY;
+   }
+   else if(connection->state == HTTP_CONN_STATE_RESP_BODY)
+   {
+      //Wait for room in the send buffer
+      eventMask = SOCKET_EVENT_TX_READY;
+   }
+   else if(connection->state == HTTP_CONN_STATE_SHUTDOWN)
+   {
+      //Only wait for the shutdown steps that have not completed yet
+      eventMask = SOCKET_EVENT_TX_DONE | SOCKET_EVENT_TX_SHUTDOWN |
+         SOCKET_EVENT_RX_SHUTDOWN;
+
+      eventMask &= ~socketGetEvents(connection->socket);
+
+      //Both directions are already shut down?
+      if(eventMask == 0)
+      {
+         //Wake up immediately so that the connection gets closed
+         eventMask = SOCKET_EVENT_RX_SHUTDOWN;
+      }
+   }
+   else
+#endif
+   {
+      //No event
+      eventMask = 0;
+   }
+
+   //Return the event mask
+   return eventMask;
 }
 
 
+/**
+ * @brief Advance the state machine of a connection (event-driven mode)
+ * @param[in] connection Structure representing an HTTP connection
+ **/
+
+void httpProcessConnectionEvents(HttpConnection *connection)
+{
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
+   error_t error;
+   size_t n;
+#if (HTTP_SERVER_RANGE_SUPPORT == ENABLED)
+   const uint8_t *data;
+#endif
+
+   //Update time stamp
+   connection->timestamp = osGetSystemTime();
+
+   //Check current state
+   if(connection->state == HTTP_CONN_STATE_REQ_LINE ||
+      connection->state == HTTP_CONN_STATE_REQ_HEADER ||
+      connection->state == HTTP_CONN_STATE_REQ_BODY)
+   {
+      //Move the unread data to the beginning of the receive buffer
+      if(connection->rxBufferPos > 0)
+      {
+         connection->rxBufferLen -= connection->rxBufferPos;
+
+         osMemmove(connection->rxBuffer, connection->rxBuffer +
+            connection->rxBufferPos, connection->rxBufferLen);
+
+         connection->rxBufferPos = 0;
+      }
+
+      //The request header must fit in the receive buffer
+      if(connection->rxBufferLen < HTTP_SERVER_RX_BUFFER_SIZE)
+      {
+         //Read as much data as possible
+         error = socketReceive(connection->socket, connection->rxBuffer +
+            connection->rxBufferLen, HTTP_SERVER_RX_BUFFER_SIZE -
+            connection->rxBufferLen, &n, 0);
+
+         //Check status code
+         if(!error)
+         {
+            //Update the length of the buffer
+            connection->rxBufferLen += n;
+            //Process the requests available in the receive buffer
+            error = httpProcessRxBuffer(connection);
+         }
+         else if(error == ERROR_TIMEOUT || error == ERROR_WOULD_BLOCK)
+         {
+            //No data available for the moment
+            error = NO_ERROR;
+         }
+         else
+         {
+            //The connection has been closed or reset by the peer
+         }
+      }
+      else
+      {
+         //The request header is too large
+         error = ERROR_INVALID_REQUEST;
+      }
+   }
+   else if(connection->state == HTTP_CONN_STATE_RESP_BODY)
+   {
+      //The data written by the callbacks precede the response body
+      error = httpFlushTxBuffer(connection);
+
+      //Check whether the transmit queue has been drained
+      if(!error && connection->txBufferLen == 0)
+      {
+         //Copy as much data as possible to the send buffer
+         error = socketSend(connection->socket, connection->bodyStart +
+            connection->bodyPos, connection->bodyLen - connection->bodyPos,
+            &n, 0);
+
+         //The send buffer is full?
+         if(error == ERROR_TIMEOUT || error == ERROR_WOULD_BLOCK)
+         {
+            error = NO_ERROR;
+         }
+      }
+
+      //Check status code
+      if(!error && connection->txBufferLen == 0)
+      {
+         //Advance data pointer
+         connection->bodyPos += n;
+
+         //The whole response body has been written?
+         if(connection->bodyPos >= connection->bodyLen)
+         {
+#if (HTTP_SERVER_RANGE_SUPPORT == ENABLED)
+            //A multipart/byteranges body is sent one segment at a time
+            if(connection->response.rangeCount > 1 &&
+               httpGetNextRangeSegment(connection, &data, &n))
+            {
+               //Send the next segment as soon as the socket is ready
+               connection->bodyStart = (uint8_t *) data;
+               connection->bodyPos = 0;
+               connection->bodyLen = n;
+            }
+            else
+#endif
+            {
+               //Flush the send buffer
+               socketSend(connection->socket, "", 0, NULL, SOCKET_FLAG_NO_DELAY);
+
+               //The current request is complete
+               httpCompleteRequest(connection);
+
+               //Pipelined requests may already be waiting in the receive buffer
+               if(connection->state == HTTP_CONN_STATE_REQ_LINE)
+               {
+                  error = httpProcessRxBuffer(connection);
+               }
+            }
+         }
+      }
+   }
+   else if(connection->state == HTTP_CONN_STATE_SHUTDOWN)
+   {
+      //Make progress with the graceful shutdown
+      error = socketShutdown(connection->socket, SOCKET_SD_BOTH);
+
+      //Check status code
+      if(!error)
+      {
+         //Debug message
+         TRACE_INFO("Graceful shutdown...\r\n");
+         //The connection can be safely closed
+         httpCloseConnection(connection);
+      }
+      else if(error == ERROR_TIMEOUT || error == ERROR_WOULD_BLOCK)
+      {
+         //The shutdown is still in progress
+         error = NO_ERROR;
+      }
+      else
+      {
+         //The connection has been reset
+      }
+   }
+   else
+   {
+      //Just for sanity
+      error = NO_ERROR;
+   }
+
+   //Any error to report?
+   if(error)
+   {
+      //Close the connection immediately
+      httpCloseConnection(connection);
+   }
+#endif
+}
+
+
+/**
+ * @brief Process the requests available in the receive buffer
+ *
+ * A request is only dispatched to the application once its header and its
+ * whole body have been received, so that the callbacks never wait for data.
+ * Bodies that cannot be buffered (chunked, or larger than the receive
+ * buffer) are rejected with a 411 or 413 error
+ *
+ * @param[in] connection Structure representing an HTTP connection
+ * @return Error code
+ **/
+
+error_t httpProcessRxBuffer(HttpConnection *connection)
+{
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
+   error_t error;
+   size_t i;
+   size_t n;
+   const char_t *p;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Several pipelined requests may be queued in the receive buffer
+   while(!error)
+   {
+      //Point to the unread data
+      p = connection->rxBuffer + connection->rxBufferPos;
+      n = connection->rxBufferLen - connection->rxBufferPos;
+
+      //Waiting for a request header?
+      if(connection->state == HTTP_CONN_STATE_REQ_LINE ||
+         connection->state == HTTP_CONN_STATE_REQ_HEADER)
+      {
+         //An empty line indicates the end of the header fields. Jump from
+         //one line feed to the next rather than testing every position
+         for(i = httpFindChar(p, n, '\n'); i < n;
+            i += httpFindChar(p + i + 1, n - i - 1, '\n') + 1)
+         {
+            //Same rules as httpReadHeaderField: lines end with CRLF or LF
+            if(i >= 1 && p[i - 1] == '\n')
+               break;
+            if(i >= 2 && p[i - 1] == '\r' && p[i - 2] == '\n')
+               break;
+         }
+
+         //Incomplete header?
+         if(i >= n)
+         {
+            //The rest of the header is expected shortly
+            if(n > 0)
+            {
+               connection->state = HTTP_CONN_STATE_REQ_HEADER;
+            }
+
+            //Wait for more data
+            break;
+         }
+
+         //Clear request header
+         osMemset(&connection->request, 0, sizeof(HttpRequest));
+         //Clear response header
+         osMemset(&connection->response, 0, sizeof(HttpResponse));
+
+         //The whole header is available, so that parsing cannot block
+         error = httpReadRequestHeader(connection);
+         //Any error to report?
+         if(error)
+         {
+            //Debug message
+            TRACE_INFO("Parsing error...\r\n");
+            break;
+         }
+
+         //The header has been consumed
+         connection->state = HTTP_CONN_STATE_REQ_BODY;
+      }
+      else if(connection->state == HTTP_CONN_STATE_REQ_BODY)
+      {
+         //The callbacks cannot wait for the request body, which must
+         //therefore be fully buffered before they are invoked
+         if(connection->request.chunkedEncoding)
+         {
+            //The length of a chunked body is not known in advance
+            httpInitResponseHeader(connection);
+
+            //Send an error 411 and close the connection
+            error = httpSendErrorResponse(connection, 411,
+               "A Content-Length header is required");
+         }
+         else if(connection->request.byteCount > HTTP_SERVER_RX_BUFFER_SIZE)
+         {
+            //The body cannot fit in the receive buffer
+            httpInitResponseHeader(connection);
+
+            //Send an error 413 and close the connection
+            error = httpSendErrorResponse(connection, 413,
+               "The request body is too large");
+         }
+         else if(connection->request.byteCount > n)
+         {
+            //Move the unread data to the beginning of the receive buffer
+            if(connection->rxBufferPos > 0)
+            {
+               osMemmove(connection->rxBuffer, p, n);
+               connection->rxBufferPos = 0;
+               connection->rxBufferLen = n;
+            }
+
+            //Wait for the rest of the body
+            break;
+         }
+         else
+         {
+            //Invoke the user callbacks and send the response
+            error = httpProcessRequest(connection);
+         }
+
+         //Internal error?
+         if(error)
+            break;
+
+         //Update the number of requests served over the connection
+         connection->requestCount++;
+
+         //Any queued data or response body to be sent?
+         if(connection->txBufferLen > 0 || connection->bodyLen > 0)
+         {
+            //Send the body as soon as the socket is ready
+            connection->state = HTTP_CONN_STATE_RESP_BODY;
+            break;
+         }
+
+         //The current request is complete
+         httpCompleteRequest(connection);
+      }
+      else
+      {
+         //No request can be processed in the current state
+         break;
+      }
+   }
+
+   //Return status code
+   return error;
+#else
+   //Not implemented
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
+/**
+ * @brief Terminate the current request (event-driven mode)
+ * @param[in] connection Structure representing an HTTP connection
+ **/
+
+void httpCompleteRequest(HttpConnection *connection)
+{
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
+   size_t n;
+
+   //No response body is pending anymore
+   connection->bodyStart = NULL;
+   connection->bodyPos = 0;
+   connection->bodyLen = 0;
+
+   //Discard the part of the request body the application did not read
+   if(!connection->request.chunkedEncoding)
+   {
+      n = connection->rxBufferLen - connection->rxBufferPos;
+      n = MIN(n, connection->request.byteCount);
+
+      connection->rxBufferPos += n;
+      connection->request.byteCount -= n;
+   }
+
+   //The next request cannot be located if the body was not fully consumed
+   if(connection->request.byteCount > 0 || (connection->request.chunkedEncoding &&
+      !connection->request.lastChunk))
+   {
+      connection->response.keepAlive = FALSE;
+   }
+
+   //Check whether the connection is persistent or not
+   if(connection->request.keepAlive && connection->response.keepAlive &&
+      connection->requestCount < HTTP_SERVER_MAX_REQUESTS)
+   {
+      //Wait for the next request
+      connection->state = HTTP_CONN_STATE_REQ_LINE;
+   }
+   else
+   {
+      //Send a FIN segment as soon as the send buffer is drained
+      connection->state = HTTP_CONN_STATE_SHUTDOWN;
+      socketShutdown(connection->socket, SOCKET_SD_BOTH);
+   }
+
+   //Update time stamp
+   connection->timestamp = osGetSystemTime();
+#endif
+}
+
+
+/**
+ * @brief Close the connection if it has been inactive for too long
+ * @param[in] connection Structure representing an HTTP connection
+ **/
+
+void httpCheckConnectionTimeout(HttpConnection *connection)
+{
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
+   systime_t time;
+   systime_t timeout;
+
+   //Active connection?
+   if(connection->state != HTTP_CONN_STATE_IDLE)
+   {
+      //Get current time
+      time = osGetSystemTime();
+
+      //Maximum time the server will wait for a subsequent request
+      if(connection->state == HTTP_CONN_STATE_REQ_LINE)
+      {
+         timeout = HTTP_SERVER_IDLE_TIMEOUT;
+      }
+      else
+      {
+         timeout = HTTP_SERVER_TIMEOUT;
+      }
+
+      //Check whether the timeout has elapsed
+      if(timeCompare(time, connection->timestamp + timeout) >= 0)
+      {
+         //Debug message
+         TRACE_INFO("HTTP connection timeout...\r\n");
+         //Close the connection
+         httpCloseConnection(connection);
+      }
+   }
+#endif
+}
+
+
+/**
+ * @brief Close a client connection (event-driven mode)
+ * @param[in] connection Structure representing an HTTP connection
+ **/
+
+void httpCloseConnection(HttpConnection *connection)
+{
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
+   //Valid socket handle?
+   if(connection->socket != NULL)
+   {
+      //Debug message
+      TRACE_INFO("Closing socket...\r\n");
+      //Close socket
+      socketClose(connection->socket);
+      connection->socket = NULL;
+   }
+
+   //Mark the connection as unused
+   connection->state = HTTP_CONN_STATE_IDLE;
+#endif
+}
+
+
+/**
+ * @brief Retrieve the full pathname to the specified resource
+ * @param[in] connection Structure representing an HTTP connection
+ * @param[in] relative String containing the relative path to the resource
+ * @param[out] absolute Resulting string containing the absolute path
+ * @param[in] maxLen Maximum acceptable path length
+ **/
+
+void httpGetAbsolutePath(HttpConnection *connection,
+   const char_t *relative, char_t *absolute, size_t maxLen)
+{
+   //Copy the root directory
+   osStrcpy(absolute, connection->settings->rootDirectory);
+
+   //Append the specified path
+   pathCombine(absolute, relative, maxLen);
+
+   //Clean the resulting path
+   pathCanonicalize(absolute);
+}
+
+
+/**
+ * @brief Search a buffer for a given character
+ *
+ * The buffer is scanned one 32-bit word at a time, using the classic
+ * "has zero byte" test on the word XORed with the repeated character. Words
+ * are copied with osMemcpy rather than dereferenced through a cast, so that
+ * the scan does not break strict aliasing rules
+ *
+ * @param[in] data Pointer to the buffer
+ * @param[in] length Length of the buffer, in bytes
+ * @param[in] c Character to search for
+ * @return Offset of the first occurrence of the character, or length if
+ *   the character does not appear in the buffer
+ **/
+
+size_t httpFindChar(const char_t *data, size_t length, char_t c)
+{
+   size_t i;
+   uint32_t word;
+   uint32_t pattern;
+
+   //Process leading bytes until the pointer is word-aligned
+   for(i = 0; i < length && ((uintptr_t) (data + i) & 3) != 0; i++)
+   {
+      if(data[i] == c)
+         return i;
+   }
+
+   //Repeat the character in each byte of a word
+   pattern = (uint8_t) c * 0x01010101U;
+
+   //Process the aligned part of the buffer one word at a time
+   while((i + 4) <= length)
+   {
+      //Load the next word (the pointer is aligned, so the copy compiles
+      //down to a single load)
+      osMemcpy(&word, data + i, sizeof(uint32_t));
+
+      //Bytes that match the character become zero
+      word ^= pattern;
+
+      //Check whether the word contains a zero byte
+      if(((word - 0x01010101U) & ~word & 0x80808080U) != 0)
+         break;
+
+      //Next word
+      i += 4;
+   }
+
+   //Locate the matching byte within the word, then process trailing bytes
+   for(; i < length; i++)
+   {
+      if(data[i] == c)
+         return i;
+   }
+
+   //The character was not found
+   return length;
+}
+
+
+/**
+ * @brief Check whether an entity tag appears in an If-None-Match list
+ *
+ * If-None-Match uses the weak comparison function, so that a "W/" prefix
+ * is ignored on both sides
+ *
+ * @param[in] list Comma-separated list of entity tags, or "*"
+ * @param[in] etag Entity tag of the selected representation
+ * @return TRUE if the list matches the entity tag, else FALSE
+ **/
+
+bool_t httpMatchEntityTag(const char_t *list, const char_t *etag)
+{
+   size_t n;
+   const char_t *p;
+
+   //Skip the weak indicator
+   if(etag[0] == 'W' && etag[1] == '/')
+      etag += 2;
+
+   //Retrieve the length of the entity tag
+   n = osStrlen(etag);
+
+   //Parse the comma-separated list
+   for(p = list; *p != '\0'; )
+   {
+      //Skip separators and whitespace characters
+      while(*p == ',' || *p == ' ' || *p == '\t')
+         p++;
+
+      //The "*" value matches any current representation
+      if(*p == '*')
+         return TRUE;
+
+      //Skip the weak indicator
+      if(p[0] == 'W' && p[1] == '/')
+         p += 2;
+
+      //Compare entity tags (opaque-tags are case-sensitive)
+      if(n > 0 && !osStrncmp(p, etag, n) &&
+         (p[n] == '\0' || p[n] == ',' || p[n] == ' ' || p[n] == '\t'))
+      {
+         return TRUE;
+      }
+
+      //Jump to the next entity tag
+      while(*p != '\0' && *p != ',')
+         p++;
+   }
+
+   //The entity tag does not appear in the list
+   return FALSE;
+}
+
+
+#if (HTTP_SERVER_RANGE_SUPPORT == ENABLED)
+
+/**
+ * @brief Parse Range header field
+ *
+ * Only the "bytes" unit is supported. Ranges that start beyond the end of
+ * the representation are dropped, and the remaining ones are clipped to its
+ * length
+ *
+ * @param[in] value Range field value
+ * @param[in] length Length of the complete representation
+ * @param[out] ranges Array where to store the satisfiable ranges
+ * @param[out] count Number of satisfiable ranges
+ * @return Error code (ERROR_OUT_OF_RANGE if no range is satisfiable)
+ **/
+
+error_t httpParseRangeField(const char_t *value, size_t length,
+   HttpRange *ranges, uint_t *count)
+{
+   uint_t n;
+   size_t first;
+   size_t last;
+   bool_t suffix;
+   const char_t *p;
+
+   //Only byte ranges are supported
+   if(osStrncasecmp(value, "bytes=", 6))
+      return ERROR_INVALID_SYNTAX;
+
+   //Number of satisfiable ranges
+   n = 0;
+
+   //Parse the comma-separated list of ranges
+   for(p = value + 6; ; p++)
+   {
+      //Skip whitespace characters
+      while(*p == ' ' || *p == '\t')
+         p++;
+
+      //A suffix range specifies the length of the final part
+      suffix = (*p == '-');
+      //Skip the hyphen
+      if(suffix)
+         p++;
+
+      //The first value is mandatory
+      if(!osIsdigit(*p))
+         return ERROR_INVALID_SYNTAX;
+
+      //Convert the first value (saturating on overflow)
+      for(first = 0; osIsdigit(*p); p++)
+      {
+         first = (first < (SIZE_MAX / 10)) ? (first * 10) + (*p - '0') : SIZE_MAX;
+      }
+
+      //Suffix range?
+      if(suffix)
+      {
+         //A suffix of zero bytes cannot be satisfied
+         if(first > 0 && length > 0)
+         {
+            first = length - MIN(first, length);
+            last = length - 1;
+         }
+         else
+         {
+            first = length;
+            last = length;
+         }
+      }
+      else
+      {
+         //The hyphen is mandatory
+         if(*(p++) != '-')
+            return ERROR_INVALID_SYNTAX;
+
+         //The last value is optional
+         if(osIsdigit(*p))
+         {
+            //Convert the last value (saturating on overflow)
+            for(last = 0; osIsdigit(*p); p++)
+            {
+               last = (last < (SIZE_MAX / 10)) ? (last * 10) + (*p - '0') : SIZE_MAX;
+            }
+
+            //The range is not valid if the last position is lower
+            if(last < first)
+               return ERROR_INVALID_SYNTAX;
+         }
+         else
+         {
+            //The range extends to the end of the representation
+            last = SIZE_MAX;
+         }
+      }
+
+      //Satisfiable range?
+      if(first < length)
+      {
+         //Too many ranges?
+         if(n >= HTTP_SERVER_MAX_RANGES)
+            return ERROR_BUFFER_OVERFLOW;
+
+         //Save the range, clipped to the length of the representation
+         ranges[n].first = first;
+         ranges[n].last = MIN(last, length - 1);
+         n++;
+      }
+
+      //Skip whitespace characters
+      while(*p == ' ' || *p == '\t')
+         p++;
+
+      //End of list?
+      if(*p == '\0')
+         break;
+
+      //Ranges are separated by commas
+      if(*p != ',')
+         return ERROR_INVALID_SYNTAX;
+   }
+
+   //Return the number of satisfiable ranges
+   *count = n;
+
+   //At least one range must be satisfiable
+   return (n > 0) ? NO_ERROR : ERROR_OUT_OF_RANGE;
+}
+
+
+/**
+ * @brief Select the byte ranges of a static resource to be sent
+ *
+ * The Range field is ignored when it is malformed, when it holds too many
+ * ranges, or when the If-Range validator does not match the current entity
+ * tag. Otherwise the response becomes a 206 (one range or multipart/byteranges)
+ * or a 416 response, and its Content-Length is updated accordingly
+ *
+ * @param[in] connection Structure representing an HTTP connection
+ * @param[in] length Length of the complete representation
+ **/
+
+void httpSelectRanges(HttpConnection *connection, size_t length)
+{
+   error_t error;
+   uint_t i;
+   size_t n;
+
+   //Byte range requests can be issued for this resource
+   connection->response.acceptRanges = TRUE;
+   connection->response.totalLength = length;
+   connection->response.rangeCount = 0;
+
+   //Only GET requests can be answered with partial content
+   if(connection->request.range[0] == '\0' ||
+      osStrcasecmp(connection->request.method, "GET"))
+   {
+      return;
+   }
+
+   //If-Range field present?
+   if(connection->request.ifRange[0] != '\0')
+   {
+#if (HTTP_SERVER_ETAG_SUPPORT == ENABLED)
+      //If-Range uses the strong comparison function, so that weak entity
+      //tags and dates never match
+      if(connection->response.etag[0] == '\0' ||
+         osStrcmp(connection->request.ifRange, connection->response.etag))
+      {
+         return;
+      }
+#else
+      //The validator cannot be checked without entity tags
+      return;
+#endif
+   }
+
+   //Parse the list of ranges
+   error = httpParseRangeField(connection->request.range, length,
+      connection->response.ranges, &connection->response.rangeCount);
+
+   //Check status code
+   if(!error)
+   {
+      //Partial content
+      connection->response.statusCode = 206;
+
+      //Single range?
+      if(connection->response.rangeCount == 1)
+      {
+         //The body is the selected range
+         connection->response.contentLength =
+            connection->response.ranges[0].last -
+            connection->response.ranges[0].first + 1;
+      }
+      else
+      {
+         //Compute the length of the multipart body, delimiters included
+         n = httpFormatRangePart(connection, connection->response.rangeCount,
+            connection->buffer);
+
+         //Add the length of each part
+         for(i = 0; i < connection->response.rangeCount; i++)
+         {
+            n += httpFormatRangePart(connection, i, connection->buffer);
+            n += connection->response.ranges[i].last -
+               connection->response.ranges[i].first + 1;
+         }
+
+         //Save the length of the multipart body
+         connection->response.contentLength = n;
+      }
+   }
+   else if(error == ERROR_OUT_OF_RANGE)
+   {
+      //None of the ranges overlap the current representation
+      connection->response.statusCode = 416;
+      connection->response.contentLength = 0;
+   }
+   else
+   {
+      //Malformed or too complex Range fields are ignored, and the whole
+      //representation is sent
+      connection->response.rangeCount = 0;
+   }
+}
+
+
+/**
+ * @brief Format the header of a multipart/byteranges body part
+ * @param[in] connection Structure representing an HTTP connection
+ * @param[in] index Index of the range (the last index formats the final
+ *   delimiter)
+ * @param[out] buffer Output buffer
+ * @return Length of the formatted header
+ **/
+
+size_t httpFormatRangePart(HttpConnection *connection, uint_t index,
+   char_t *buffer)
+{
+   int_t n;
+   HttpRange *range;
+
+   //Final delimiter?
+   if(index >= connection->response.rangeCount)
+   {
+      //The last part is followed by the close delimiter
+      n = osSprintf(buffer, "\r\n--" HTTP_SERVER_RANGE_BOUNDARY "--\r\n");
+   }
+   else
+   {
+      //Point to the range
+      range = &connection->response.ranges[index];
+
+      //Each part starts with a delimiter line, followed by its own header
+      n = osSprintf(buffer, "\r\n--" HTTP_SERVER_RANGE_BOUNDARY "\r\n"
+         "Content-Type: %s\r\n"
+         "Content-Range: bytes %" PRIuSIZE "-%" PRIuSIZE "/%" PRIuSIZE "\r\n\r\n",
+         (connection->response.contentType != NULL) ?
+         connection->response.contentType : "application/octet-stream",
+         range->first, range->last, connection->response.totalLength);
+   }
+
+   //Return the length of the header
+   return n;
+}
+
+
+/**
+ * @brief Get the next segment of a multipart/byteranges body
+ *
+ * The body alternates between part headers, formatted in the connection
+ * buffer, and ranges taken directly from the resource data
+ *
+ * @param[in] connection Structure representing an HTTP connection
+ * @param[out] data Pointer to the segment
+ * @param[out] length Length of the segment
+ * @return FALSE if the whole body has been sent, else TRUE
+ **/
+
+bool_t httpGetNextRangeSegment(HttpConnection *connection,
+   const uint8_t **data, size_t *length)
+{
+   uint_t i;
+   HttpRange *range;
+
+   //Index of the range the segment belongs to
+   i = connection->rangeSegment / 2;
+
+   //The final delimiter is the last segment
+   if(i > connection->response.rangeCount ||
+      (i == connection->response.rangeCount && (connection->rangeSegment & 1)))
+   {
+      return FALSE;
+   }
+
+   //Even segments are part headers, odd segments are data
+   if((connection->rangeSegment & 1) == 0)
+   {
+      //Format the header of the part (or the final delimiter)
+      *length = httpFormatRangePart(connection, i, connection->buffer);
+      *data = (const uint8_t *) connection->buffer;
+   }
+   else
+   {
+      //Point to the range
+      range = &connection->response.ranges[i];
+
+      //The data is sent without being copied
+      *data = connection->rangeData + range->first;
+      *length = range->last - range->first + 1;
+   }
+
+   //Move to the next segment
+   connection->rangeSegment++;
+
+   //A segment is available
+   return TRUE;
+}
+
+#endif
+
+
 /**
  * @brief Compare filename extension
  * @param[in] filename Filename whose extension is to be checked
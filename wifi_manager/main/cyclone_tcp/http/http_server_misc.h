@@ -41,14 +41,20 @@ extern "C" {
 
 //HTTP server related functions
 error_t httpReadRequestHeader(HttpConnection *connection);
+error_t httpProcessRequest(HttpConnection *connection);
+error_t httpDiscardRequestBody(HttpConnection *connection);
 error_t httpParseRequestLine(HttpConnection *connection, char_t *requestLine);
 
 error_t httpReadHeaderField(HttpConnection *connection,
    char_t *buffer, size_t size, char_t *firstChar);
 
+bool_t httpIsEmptyLine(const char_t *line);
+
 void httpParseHeaderField(HttpConnection *connection,
    const char_t *name, char_t *value);
 
+HttpHeaderFieldId httpGetHeaderFieldId(const char_t *name);
+
 void httpParseConnectionField(HttpConnection *connection,
    char_t *value);
 
@@ -68,12 +74,42 @@ error_t httpFormatResponseHeader(HttpConnection *connection, char_t *buffer);
 error_t httpSend(HttpConnection *connection,
    const void *data, size_t length, uint_t flags);
 
+error_t httpQueueData(HttpConnection *connection,
+   const void *data, size_t length, uint_t flags);
+
+error_t httpFlushTxBuffer(HttpConnection *connection);
+
 error_t httpReceive(HttpConnection *connection,
    void *data, size_t size, size_t *received, uint_t flags);
 
+error_t httpReceiveData(HttpConnection *connection,
+   void *data, size_t size, size_t *received, uint_t flags);
+
 void httpGetAbsolutePath(HttpConnection *connection,
    const char_t *relative, char_t *absolute, size_t maxLen);
 
+void httpAcceptConnection(HttpServerContext *context);
+uint_t httpGetConnectionEvents(HttpConnection *connection);
+void httpProcessConnectionEvents(HttpConnection *connection);
+error_t httpProcessRxBuffer(HttpConnection *connection);
+void httpCompleteRequest(HttpConnection *connection);
+void httpCheckConnectionTimeout(HttpConnection *connection);
+void httpCloseConnection(HttpConnection *connection);
+
+bool_t httpMatchEntityTag(const char_t *list, const char_t *etag);
+
+error_t httpParseRangeField(const char_t *value, size_t length,
+   HttpRange *ranges, uint_t *count);
+
+void httpSelectRanges(HttpConnection *connection, size_t length);
+
+size_t httpFormatRangePart(HttpConnection *connection, uint_t index,
+   char_t *buffer);
+
+bool_t httpGetNextRangeSegment(HttpConnection *connection,
+   const uint8_t **data, size_t *length);
+
+size_t httpFindChar(const char_t *data, size_t length, char_t c);
 bool_t httpCompExtension(const char_t *filename, const char_t *extension);
 
 error_t httpDecodePercentEncodedString(const char_t *input,
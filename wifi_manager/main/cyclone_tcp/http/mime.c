@@ -36,71 +36,99 @@
 #include "http/mime.h"
 #include "debug.h"
 
-//MIME type list
-static const MimeType mimeTypeList[] =
+//Custom MIME types (searched first, terminated by an empty entry)
+static const MimeType mimeCustomTypeList[] =
 {
-   //Custom MIME types
    MIME_CUSTOM_TYPES
+   {NULL, NULL}
+};
+
+
+/**
+ * @brief Perfect hash table of the built-in MIME types
+ *
+ * Each extension is stored at the slot given by mimeHashExtension. The seed
+ * is chosen so that the hash function is collision-free over this set of
+ * extensions, and a lookup costs a single case-insensitive comparison.
+ * pack.py reads this table to store the slot of each resource in the path
+ * index. Check that every extension still lands in a distinct slot (and
+ * regenerate the seed otherwise) when adding an entry
+ *
+ **/
 
-   //Text MIME types
-   {".css",   "text/css"},
-   {".csv",   "text/csv"},
-   {".htc",   "text/x-component"},
-   {".htm",   "text/html"},
-   {".html",  "text/html"},
-   {".shtm",  "text/html"},
-   {".shtml", "text/html"},
-   {".stm",   "text/html"},
-   {".txt",   "text/plain"},
-   {".vcf",   "text/vcard"},
-   {".vcard", "text/vcard"},
-   {".xml",   "text/xml"},
-
-   //Image MIME types
-   {".gif",   "image/gif"},
-   {".ico",   "image/x-icon"},
-   {".jpg",   "image/jpeg"},
-   {".jpeg",  "image/jpeg"},
-   {".png",   "image/png"},
-   {".svg",   "image/svg+xml"},
-   {".tif",   "image/tiff"},
-
-   //Audio MIME types
-   {".aac",   "audio/x-aac"},
-   {".aif",   "audio/x-aiff"},
-   {".mp3",   "audio/mpeg"},
-   {".wav",   "audio/x-wav"},
-   {".wma",   "audio/x-ms-wma"},
-
-   //Video MIME types
-   {".avi",   "video/x-msvideo"},
-   {".flv",   "video/x-flv"},
-   {".mov",   "video/quicktime"},
-   {".mp4",   "video/mp4"},
-   {".mpg",   "video/mpeg"},
-   {".mpeg",  "video/mpeg"},
-   {".wmv",   "video/x-ms-wmv"},
-
-   //Application MIME types
-   {".doc",   "application/msword"},
-   {".gz",    "application/x-gzip"},
-   {".gzip",  "application/x-gzip"},
-   {".js",    "application/javascript"},
-   {".json",  "application/json"},
-   {".ogg",   "application/ogg"},
-   {".pdf",   "application/pdf"},
-   {".ppt",   "application/vnd.ms-powerpoint"},
-   {".rar",   "application/x-rar-compressed"},
-   {".rtf",   "application/rtf"},
-   {".tar",   "application/x-tar"},
-   {".tgz",   "application/x-gzip"},
-   {".xht",   "application/xhtml+xml"},
-   {".xhtml", "application/xhtml+xml"},
-   {".xls",   "application/vnd.ms-excel"},
-   {".zip",   "application/zip"}
+static const MimeType mimeTypeTable[MIME_HASH_SIZE] =
+{
+   [0]   = {".gzip",  "application/x-gzip"},
+   [4]   = {".css",   "text/css"},
+   [5]   = {".csv",   "text/csv"},
+   [11]  = {".jpg",   "image/jpeg"},
+   [13]  = {".vcard", "text/vcard"},
+   [14]  = {".svg",   "image/svg+xml"},
+   [15]  = {".doc",   "application/msword"},
+   [17]  = {".stm",   "text/html"},
+   [24]  = {".mov",   "video/quicktime"},
+   [32]  = {".mpg",   "video/mpeg"},
+   [33]  = {".xht",   "application/xhtml+xml"},
+   [35]  = {".xls",   "application/vnd.ms-excel"},
+   [36]  = {".xml",   "text/xml"},
+   [37]  = {".tar",   "application/x-tar"},
+   [39]  = {".txt",   "text/plain"},
+   [40]  = {".flv",   "video/x-flv"},
+   [45]  = {".tgz",   "application/x-gzip"},
+   [50]  = {".vcf",   "text/vcard"},
+   [51]  = {".ogg",   "application/ogg"},
+   [52]  = {".zip",   "application/zip"},
+   [54]  = {".mpeg",  "video/mpeg"},
+   [55]  = {".tif",   "image/tiff"},
+   [57]  = {".mp4",   "video/mp4"},
+   [58]  = {".mp3",   "audio/mpeg"},
+   [59]  = {".jpeg",  "image/jpeg"},
+   [67]  = {".ico",   "image/x-icon"},
+   [72]  = {".xhtml", "application/xhtml+xml"},
+   [73]  = {".json",  "application/json"},
+   [76]  = {".pdf",   "application/pdf"},
+   [84]  = {".png",   "image/png"},
+   [85]  = {".ppt",   "application/vnd.ms-powerpoint"},
+   [86]  = {".gif",   "image/gif"},
+   [87]  = {".rtf",   "application/rtf"},
+   [95]  = {".shtm",  "text/html"},
+   [96]  = {".aac",   "audio/x-aac"},
+   [97]  = {".js",    "application/javascript"},
+   [102] = {".rar",   "application/x-rar-compressed"},
+   [105] = {".gz",    "application/x-gzip"},
+   [108] = {".html",  "text/html"},
+   [112] = {".wav",   "audio/x-wav"},
+   [115] = {".wma",   "audio/x-ms-wma"},
+   [119] = {".avi",   "video/x-msvideo"},
+   [120] = {".wmv",   "video/x-ms-wmv"},
+   [122] = {".aif",   "audio/x-aiff"},
+   [123] = {".htc",   "text/x-component"},
+   [125] = {".shtml", "text/html"},
+   [126] = {".htm",   "text/html"}
 };
 
 
+/**
+ * @brief Hash a file extension
+ * @param[in] extension File extension, without the leading dot
+ * @return Slot of the extension in the MIME type table
+ **/
+
+static uint_t mimeHashExtension(const char_t *extension)
+{
+   uint32_t h;
+
+   //Case-insensitive FNV-1a, seeded to be collision-free over the table
+   for(h = MIME_HASH_SEED; *extension != '\0'; extension++)
+   {
+      h = (h ^ (uint8_t) osTolower(*extension)) * 16777619;
+   }
+
+   //Keep the most significant bits, which are the best mixed
+   return h >> (32 - MIME_HASH_BITS);
+}
+
+
 /**
  * @brief Get the MIME type from a given extension
  *
@@ -115,6 +143,9 @@ const char_t *mimeGetType(const char_t *filename)
    uint_t i;
    uint_t n;
    uint_t m;
+   const char_t *p;
+   const char_t *extension;
+   const MimeType *entry;
 
    //MIME type for unknown extensions
    static const char_t defaultMimeType[] = "application/octet-stream";
@@ -125,24 +156,74 @@ const char_t *mimeGetType(const char_t *filename)
       //Get the length of the specified filename
       n = osStrlen(filename);
 
-      //Search the MIME type that matches the specified extension
-      for(i = 0; i < arraysize(mimeTypeList); i++)
+      //Custom MIME types take precedence over the built-in ones
+      for(i = 0; mimeCustomTypeList[i].extension != NULL; i++)
       {
          //Length of the extension
-         m = osStrlen(mimeTypeList[i].extension);
+         m = osStrlen(mimeCustomTypeList[i].extension);
 
          //Check the length of the filename
          if(m <= n)
          {
             //Compare file extensions
-            if(osStrcasecmp(filename + n - m, mimeTypeList[i].extension) == 0)
+            if(osStrcasecmp(filename + n - m, mimeCustomTypeList[i].extension) == 0)
             {
-               return mimeTypeList[i].type;
+               return mimeCustomTypeList[i].type;
             }
          }
       }
+
+      //Locate the extension of the last path segment
+      for(extension = NULL, p = filename; *p != '\0'; p++)
+      {
+         if(*p == '.')
+            extension = p;
+         else if(*p == '/' || *p == '\\')
+            extension = NULL;
+      }
+
+      //Any extension?
+      if(extension != NULL)
+      {
+         //Point to the matching slot
+         entry = &mimeTypeTable[mimeHashExtension(extension + 1)];
+
+         //A single comparison confirms the match
+         if(entry->extension != NULL && osStrcasecmp(extension,
+            entry->extension) == 0)
+         {
+            return entry->type;
+         }
+      }
    }
 
    //Return the default MIME type when an unknown extension is encountered
    return defaultMimeType;
 }
+
+
+/**
+ * @brief Get the MIME type from an identifier stored by pack.py
+ *
+ * The identifier is the slot of the extension in the MIME type table, plus
+ * one. It is ignored when custom MIME types are defined, since they may
+ * override the built-in ones
+ *
+ * @param[in] id MIME type identifier (0 if unknown)
+ * @return NULL-terminated string containing the associated MIME type, or
+ *   NULL if the identifier cannot be used
+ **/
+
+const char_t *mimeGetTypeById(uint_t id)
+{
+   //Custom MIME types are defined?
+   if(mimeCustomTypeList[0].extension != NULL)
+      return NULL;
+
+   //Check the identifier
+   if(id == 0 || id > MIME_HASH_SIZE)
+      return NULL;
+
+   //Return the MIME type stored in the corresponding slot
+   return mimeTypeTable[id - 1].type;
+}
@@ -39,6 +39,13 @@
    #define MIME_CUSTOM_TYPES
 #endif
 
+//Size of the MIME type hash table, in bits
+#define MIME_HASH_BITS 7
+//Size of the MIME type hash table
+#define MIME_HASH_SIZE (1U << MIME_HASH_BITS)
+//Seed of the MIME type hash function
+#define MIME_HASH_SEED 34618
+
 //C++ guard
 #ifdef __cplusplus
 extern "C" {
@@ -58,6 +65,7 @@ typedef struct
 
 //MIME related functions
 const char_t *mimeGetType(const char_t *filename);
+const char_t *mimeGetTypeById(uint_t id);
 
 //C++ guard
 #ifdef __cplusplus
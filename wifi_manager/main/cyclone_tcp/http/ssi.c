@@ -79,6 +79,10 @@ error_t ssiExecuteScript(HttpConnection *connection, const char_t *uri, uint_t l
    size_t i;
    size_t j;
    const char_t *data;
+#if (HTTP_SERVER_SSI_CACHE_SIZE > 0)
+   const HttpSsiTemplate *page;
+   const HttpSsiSegment *segment;
+#endif
 #endif
 
    //Recursion limit exceeded?
@@ -291,6 +295,43 @@ error_t ssiExecuteScript(HttpConnection *connection, const char_t *uri, uint_t l
    if(!level && error == NO_ERROR)
       error = httpCloseStream(connection);
 #else
+#if (HTTP_SERVER_SSI_CACHE_SIZE > 0)
+   //Retrieve the compiled form of the page
+   page = ssiGetTemplate(connection, data, length);
+
+   //Compiled template available?
+   if(page != NULL)
+   {
+      //Walk through the segments
+      for(i = 0; i < page->segmentCount; i++)
+      {
+         //Point to the current segment
+         segment = &page->segments[i];
+
+         //Static data?
+         if(segment->type == HTTP_SSI_SEGMENT_STATIC)
+         {
+            //Send the data without copying it
+            error = httpWriteStream(connection, data + segment->offset,
+               segment->length);
+         }
+         else
+         {
+            //Execute the directive
+            error = ssiDispatchCommand(connection, segment->type,
+               data + segment->offset, segment->length, uri, level);
+         }
+
+         //Any error to report?
+         if(error)
+            return error;
+      }
+
+      //The whole page has been processed
+      length = 0;
+   }
+#endif
+
    //Parse the specified file
    while(length > 0)
    {
@@ -364,27 +405,76 @@ error_t ssiExecuteScript(HttpConnection *connection, const char_t *uri, uint_t l
 error_t ssiProcessCommand(HttpConnection *connection,
    const char_t *tag, size_t length, const char_t *uri, uint_t level)
 {
-   error_t error;
+   //Identify the directive and execute it
+   return ssiDispatchCommand(connection, ssiGetCommandType(tag, length),
+      tag, length, uri, level);
+}
+
+
+/**
+ * @brief Identify an SSI directive
+ * @param[in] tag Pointer to the SSI tag
+ * @param[in] length Total length of the SSI tag
+ * @return Segment type corresponding to the directive
+ **/
 
+HttpSsiSegmentType ssiGetCommandType(const char_t *tag, size_t length)
+{
    //Include command found?
    if(length > 7 && osStrncasecmp(tag, "include", 7) == 0)
    {
-      //Process SSI include directive
-      error = ssiProcessIncludeCommand(connection, tag, length, uri, level);
+      return HTTP_SSI_SEGMENT_INCLUDE;
    }
    //Echo command found?
    else if(length > 4 && osStrncasecmp(tag, "echo", 4) == 0)
    {
-      //Process SSI echo directive
-      error = ssiProcessEchoCommand(connection, tag, length);
+      return HTTP_SSI_SEGMENT_ECHO;
    }
    //Exec command found?
    else if(length > 4 && osStrncasecmp(tag, "exec", 4) == 0)
+   {
+      return HTTP_SSI_SEGMENT_EXEC;
+   }
+   //Unknown command?
+   else
+   {
+      return HTTP_SSI_SEGMENT_INVALID;
+   }
+}
+
+
+/**
+ * @brief Execute an SSI directive whose type is already known
+ * @param[in] connection Structure representing an HTTP connection
+ * @param[in] type Directive type
+ * @param[in] tag Pointer to the SSI tag
+ * @param[in] length Total length of the SSI tag
+ * @param[in] uri NULL-terminated string containing the file being processed
+ * @param[in] level Current level of recursion
+ * @return Error code
+ **/
+
+error_t ssiDispatchCommand(HttpConnection *connection, uint_t type,
+   const char_t *tag, size_t length, const char_t *uri, uint_t level)
+{
+   error_t error;
+
+   //Check directive type
+   if(type == HTTP_SSI_SEGMENT_INCLUDE)
+   {
+      //Process SSI include directive
+      error = ssiProcessIncludeCommand(connection, tag, length, uri, level);
+   }
+   else if(type == HTTP_SSI_SEGMENT_ECHO)
+   {
+      //Process SSI echo directive
+      error = ssiProcessEchoCommand(connection, tag, length);
+   }
+   else if(type == HTTP_SSI_SEGMENT_EXEC)
    {
       //Process SSI exec directive
       error = ssiProcessExecCommand(connection, tag, length);
    }
-   //Unknown command?
    else
    {
       //The server is unable to decode the SSI tag
@@ -845,6 +935,151 @@ error_t ssiProcessExecCommand(HttpConnection *connection, const char_t *tag,
 }
 
 
+#if (HTTP_SERVER_FS_SUPPORT == DISABLED && HTTP_SERVER_SSI_CACHE_SIZE > 0)
+
+/**
+ * @brief Retrieve the compiled form of an SSI page
+ *
+ * Resource data never changes while the server is running, so each page is
+ * compiled on first use into a list of static spans and directives. Pages
+ * with too many segments are remembered as such and parsed on every request
+ *
+ * @param[in] connection Structure representing an HTTP connection
+ * @param[in] data Resource data
+ * @param[in] length Length of the resource data
+ * @return Compiled template, or NULL if the page must be parsed
+ **/
+
+const HttpSsiTemplate *ssiGetTemplate(HttpConnection *connection,
+   const char_t *data, size_t length)
+{
+   uint_t i;
+   HttpServerContext *context;
+   HttpSsiTemplate *page;
+
+   //Point to the HTTP server context
+   context = connection->serverContext;
+   //No matching entry found so far
+   page = NULL;
+
+   //Acquire exclusive access to the SSI cache
+   osAcquireMutex(&context->ssiCacheMutex);
+
+   //Loop through the cache entries
+   for(i = 0; i < HTTP_SERVER_SSI_CACHE_SIZE; i++)
+   {
+      //Page already compiled?
+      if(context->ssiCache[i].data == data)
+      {
+         page = &context->ssiCache[i];
+         break;
+      }
+      //Free entry?
+      else if(context->ssiCache[i].data == NULL)
+      {
+         //Compile the page. Entries are never evicted, so that other
+         //connections can walk them without holding the mutex
+         page = &context->ssiCache[i];
+         ssiCompileTemplate(data, length, page);
+         break;
+      }
+      else
+      {
+         //Check the next entry
+      }
+   }
+
+   //Release exclusive access to the SSI cache
+   osReleaseMutex(&context->ssiCacheMutex);
+
+   //Pages that could not be compiled are parsed on every request
+   if(page != NULL && page->segmentCount == 0)
+      page = NULL;
+
+   //Return the compiled template
+   return page;
+}
+
+
+/**
+ * @brief Compile an SSI page into a list of segments
+ * @param[in] data Resource data
+ * @param[in] length Length of the resource data
+ * @param[out] page Compiled template
+ **/
+
+void ssiCompileTemplate(const char_t *data, size_t length,
+   HttpSsiTemplate *page)
+{
+   error_t error;
+   uint_t n;
+   size_t pos;
+   size_t i;
+   size_t j;
+
+   //Initialize the template
+   page->data = data;
+   page->segmentCount = 0;
+
+   //Parse the page
+   for(n = 0, pos = 0; pos < length; )
+   {
+      //Search for any SSI tags
+      error = ssiSearchTag(data + pos, length - pos, "<!--#", 5, &i);
+
+      //Opening identifier found?
+      if(!error)
+      {
+         //Search for the comment terminator
+         error = ssiSearchTag(data + pos + i + 5, length - pos - i - 5,
+            "-->", 3, &j);
+      }
+
+      //The page cannot be described with the available segments?
+      if((n + 2) > HTTP_SERVER_SSI_MAX_SEGMENTS)
+         return;
+
+      //Check whether a valid SSI tag has been found?
+      if(!error)
+      {
+         //The part of the page that precedes the tag is static
+         if(i > 0)
+         {
+            page->segments[n].type = HTTP_SSI_SEGMENT_STATIC;
+            page->segments[n].offset = pos;
+            page->segments[n++].length = i;
+         }
+
+         //Advance data pointer over the opening identifier
+         pos += i + 5;
+
+         //Save the directive
+         page->segments[n].type = ssiGetCommandType(data + pos, j);
+         page->segments[n].offset = pos;
+         page->segments[n++].length = j;
+
+         //Advance data pointer over the SSI tag
+         pos += j + 3;
+      }
+      else
+      {
+         //The rest of the page is static
+         page->segments[n].type = HTTP_SSI_SEGMENT_STATIC;
+         page->segments[n].offset = pos;
+         page->segments[n++].length = length - pos;
+
+         //End of page
+         pos = length;
+      }
+   }
+
+   //The template is ready for use
+   page->segmentCount = n;
+}
+
+#endif
+
+
 /**
  * @brief Search a string for a given tag
  * @param[in] s String to search
@@ -45,6 +45,11 @@ error_t ssiExecuteScript(HttpConnection *connection, const char_t *uri, uint_t l
 error_t ssiProcessCommand(HttpConnection *connection,
    const char_t *tag, size_t length, const char_t *uri, uint_t level);
 
+HttpSsiSegmentType ssiGetCommandType(const char_t *tag, size_t length);
+
+error_t ssiDispatchCommand(HttpConnection *connection, uint_t type,
+   const char_t *tag, size_t length, const char_t *uri, uint_t level);
+
 error_t ssiProcessIncludeCommand(HttpConnection *connection,
    const char_t *tag, size_t length, const char_t *uri, uint_t level);
 
@@ -54,6 +59,12 @@ error_t ssiProcessEchoCommand(HttpConnection *connection, const char_t *tag,
 error_t ssiProcessExecCommand(HttpConnection *connection, const char_t *tag,
    size_t length);
 
+const HttpSsiTemplate *ssiGetTemplate(HttpConnection *connection,
+   const char_t *data, size_t length);
+
+void ssiCompileTemplate(const char_t *data, size_t length,
+   HttpSsiTemplate *page);
+
 error_t ssiSearchTag(const char_t *s, size_t sLen, const char_t *tag,
    size_t tagLen, size_t *pos);
 
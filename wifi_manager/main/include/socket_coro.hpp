@@ -0,0 +1,552 @@
+/**
+ * @file socket_coro.hpp
+ * @brief Envoltorios C++20 con corrutinas sobre la API asíncrona de sockets
+ *
+ * Permite escribir sesiones TCP de forma secuencial:
+ *
+ *   net::Task echo(net::TcpSocket sock) {
+ *     uint8_t buf[64];
+ *     for (;;) {
+ *       auto rx = co_await sock.recv(buf, sizeof(buf));
+ *       if (rx.error) break;
+ *       co_await sock.send(buf, rx.length);
+ *     }
+ *     co_await sock.close();
+ *   }
+ *
+ * Todas las corrutinas se ejecutan en la única tarea del ejecutor
+ * (socketAsyncTask), por lo que muchas sesiones concurrentes comparten una
+ * sola pila. Los marcos de las corrutinas se reservan en un pool estático:
+ * no hay uso del heap y, si el pool se agota, spawn() devuelve
+ * ERROR_OUT_OF_MEMORY en lugar de abortar.
+ *
+ * Requiere SOCKET_ASYNC_SUPPORT habilitado y compilar con -std=gnu++20.
+ */
+#ifndef SOCKET_CORO_HPP
+#define SOCKET_CORO_HPP
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+extern "C" {
+#include "core/net.h"
+#include "core/socket.h"
+#include "core/socket_async.h"
+}
+
+#if (SOCKET_ASYNC_SUPPORT != ENABLED)
+#error socket_coro.hpp requires SOCKET_ASYNC_SUPPORT
+#endif
+
+/* ========================================================================== */
+/*                                CONSTANTES                                  */
+/* ========================================================================== */
+
+// Tamaño máximo de un marco de corrutina (bytes)
+#ifndef SOCKET_CORO_FRAME_SIZE
+#define SOCKET_CORO_FRAME_SIZE 512
+#endif
+
+// Número de marcos disponibles (corrutinas vivas simultáneamente)
+#ifndef SOCKET_CORO_FRAME_COUNT
+#define SOCKET_CORO_FRAME_COUNT 8
+#endif
+
+// Tiempo máximo de un cierre ordenado antes de abortar la conexión (ms)
+#ifndef SOCKET_CORO_CLOSE_TIMEOUT
+#define SOCKET_CORO_CLOSE_TIMEOUT 5000
+#endif
+
+namespace net {
+
+/* ========================================================================== */
+/*                         POOL DE MARCOS DE CORRUTINA                        */
+/* ========================================================================== */
+
+/**
+ * @brief Pool de bloques de tamaño fijo para los marcos de corrutina
+ * @details Lista libre intrusiva; la reserva y liberación se protegen
+ * suspendiendo el planificador, ya que spawn() puede llamarse desde
+ * cualquier tarea.
+ */
+class FramePool {
+public:
+  static void *allocate(std::size_t size) noexcept {
+    Block *block = nullptr;
+
+    osSuspendAllTasks();
+    if (size > largestFrame_)
+      largestFrame_ = size;
+    if (size <= SOCKET_CORO_FRAME_SIZE) {
+      init();
+      block = freeList_;
+      if (block != nullptr) {
+        freeList_ = block->next;
+        used_++;
+        if (used_ > highWatermark_)
+          highWatermark_ = used_;
+      }
+    }
+    osResumeAllTasks();
+
+    return block;
+  }
+
+  static void release(void *p) noexcept {
+    if (p == nullptr)
+      return;
+
+    osSuspendAllTasks();
+    Block *block = static_cast<Block *>(p);
+    block->next = freeList_;
+    freeList_ = block;
+    used_--;
+    osResumeAllTasks();
+  }
+
+  // Marcos en uso y máximo histórico (para dimensionar el pool)
+  static std::size_t used() noexcept { return used_; }
+  static std::size_t highWatermark() noexcept { return highWatermark_; }
+  // Mayor marco pedido, también los rechazados (para SOCKET_CORO_FRAME_SIZE)
+  static std::size_t largestFrame() noexcept { return largestFrame_; }
+
+private:
+  union Block {
+    Block *next;
+    alignas(std::max_align_t) std::uint8_t data[SOCKET_CORO_FRAME_SIZE];
+  };
+
+  static void init() noexcept {
+    if (initialized_)
+      return;
+    for (std::size_t i = 0; i < SOCKET_CORO_FRAME_COUNT; i++) {
+      blocks_[i].next = (i + 1 < SOCKET_CORO_FRAME_COUNT) ? &blocks_[i + 1]
+                                                          : nullptr;
+    }
+    freeList_ = &blocks_[0];
+    initialized_ = true;
+  }
+
+  static inline Block blocks_[SOCKET_CORO_FRAME_COUNT];
+  static inline Block *freeList_ = nullptr;
+  static inline bool initialized_ = false;
+  static inline std::size_t used_ = 0;
+  static inline std::size_t highWatermark_ = 0;
+  static inline std::size_t largestFrame_ = 0;
+};
+
+/* ========================================================================== */
+/*                              TAREA (CORRUTINA)                             */
+/* ========================================================================== */
+
+/**
+ * @brief Corrutina "fire and forget" ejecutada por el ejecutor
+ * @details Se crea suspendida y arranca cuando se pasa a Executor::spawn().
+ * El marco se libera automáticamente al terminar.
+ */
+class Task {
+public:
+  struct promise_type {
+    SocketAsyncOp startOp{};
+
+    static void *operator new(std::size_t size) noexcept {
+      return FramePool::allocate(size);
+    }
+    static void operator delete(void *p) noexcept { FramePool::release(p); }
+
+    // Sin excepciones: si el pool está agotado la tarea queda vacía
+    static Task get_return_object_on_allocation_failure() noexcept {
+      return Task{};
+    }
+
+    Task get_return_object() noexcept {
+      return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept {}
+  };
+
+  Task() noexcept = default;
+  Task(Task &&other) noexcept : handle_(other.handle_) {
+    other.handle_ = nullptr;
+  }
+  Task(const Task &) = delete;
+  Task &operator=(const Task &) = delete;
+  ~Task() {
+    // Una tarea nunca lanzada se destruye aquí
+    if (handle_)
+      handle_.destroy();
+  }
+
+  bool valid() const noexcept { return static_cast<bool>(handle_); }
+
+private:
+  explicit Task(std::coroutine_handle<promise_type> h) noexcept : handle_(h) {}
+
+  std::coroutine_handle<promise_type> release() noexcept {
+    auto h = handle_;
+    handle_ = nullptr;
+    return h;
+  }
+
+  std::coroutine_handle<promise_type> handle_{};
+
+  friend class Executor;
+};
+
+/* ========================================================================== */
+/*                              RESULTADOS                                    */
+/* ========================================================================== */
+
+struct IoResult {
+  error_t error;
+  std::size_t length;
+};
+
+struct AcceptResult {
+  error_t error;
+  Socket *socket;
+  IpAddr ipAddr;
+  uint16_t port;
+};
+
+/* ========================================================================== */
+/*                                 AWAITERS                                   */
+/* ========================================================================== */
+
+/**
+ * @brief Base común: reanuda la corrutina desde el callback de finalización
+ */
+class AsyncAwaiter {
+public:
+  explicit AsyncAwaiter(SocketAsyncContext *context) noexcept
+      : context_(context) {}
+
+  bool await_ready() const noexcept { return false; }
+
+protected:
+  // Puntero pasado como parámetro del callback
+  void *self() noexcept { return static_cast<AsyncAwaiter *>(this); }
+
+  // Devuelve false si la operación no pudo enviarse (no se suspende)
+  bool submitted(error_t error) noexcept {
+    if (error) {
+      error_ = error;
+      return false;
+    }
+    return true;
+  }
+
+  static void onComplete(SocketAsyncContext *, SocketAsyncOp *op,
+                         error_t error) {
+    AsyncAwaiter *self = static_cast<AsyncAwaiter *>(op->param);
+    self->error_ = error;
+    self->handle_.resume();
+  }
+
+  SocketAsyncContext *context_;
+  SocketAsyncOp op_{};
+  std::coroutine_handle<> handle_{};
+  error_t error_ = NO_ERROR;
+};
+
+class RecvAwaiter : public AsyncAwaiter {
+public:
+  RecvAwaiter(SocketAsyncContext *context, Socket *socket, void *data,
+              std::size_t size, uint_t flags, systime_t timeout) noexcept
+      : AsyncAwaiter(context), socket_(socket), data_(data), size_(size),
+        flags_(flags), timeout_(timeout) {}
+
+  bool await_suspend(std::coroutine_handle<> h) noexcept {
+    handle_ = h;
+    return submitted(socketAsyncReceive(context_, &op_, socket_, data_, size_,
+                                        flags_, timeout_, onComplete, self()));
+  }
+  IoResult await_resume() const noexcept { return {error_, op_.length}; }
+
+private:
+  Socket *socket_;
+  void *data_;
+  std::size_t size_;
+  uint_t flags_;
+  systime_t timeout_;
+};
+
+class SendAwaiter : public AsyncAwaiter {
+public:
+  SendAwaiter(SocketAsyncContext *context, Socket *socket, const void *data,
+              std::size_t length, uint_t flags, systime_t timeout) noexcept
+      : AsyncAwaiter(context), socket_(socket), data_(data), length_(length),
+        flags_(flags), timeout_(timeout) {}
+
+  bool await_suspend(std::coroutine_handle<> h) noexcept {
+    handle_ = h;
+    return submitted(socketAsyncSend(context_, &op_, socket_, data_, length_,
+                                     flags_, timeout_, onComplete, self()));
+  }
+  IoResult await_resume() const noexcept { return {error_, op_.length}; }
+
+private:
+  Socket *socket_;
+  const void *data_;
+  std::size_t length_;
+  uint_t flags_;
+  systime_t timeout_;
+};
+
+class ConnectAwaiter : public AsyncAwaiter {
+public:
+  ConnectAwaiter(SocketAsyncContext *context, Socket *socket,
+                 const IpAddr &ipAddr, uint16_t port,
+                 systime_t timeout) noexcept
+      : AsyncAwaiter(context), socket_(socket), ipAddr_(ipAddr), port_(port),
+        timeout_(timeout) {}
+
+  bool await_suspend(std::coroutine_handle<> h) noexcept {
+    handle_ = h;
+    return submitted(socketAsyncConnect(context_, &op_, socket_, &ipAddr_,
+                                        port_, timeout_, onComplete, self()));
+  }
+  error_t await_resume() const noexcept { return error_; }
+
+private:
+  Socket *socket_;
+  IpAddr ipAddr_;
+  uint16_t port_;
+  systime_t timeout_;
+};
+
+class AcceptAwaiter : public AsyncAwaiter {
+public:
+  AcceptAwaiter(SocketAsyncContext *context, Socket *socket,
+                systime_t timeout) noexcept
+      : AsyncAwaiter(context), socket_(socket), timeout_(timeout) {}
+
+  bool await_suspend(std::coroutine_handle<> h) noexcept {
+    handle_ = h;
+    return submitted(socketAsyncAccept(context_, &op_, socket_, timeout_,
+                                       onComplete, self()));
+  }
+  AcceptResult await_resume() const noexcept {
+    return {error_, error_ ? nullptr : op_.newSocket, op_.ipAddr, op_.port};
+  }
+
+private:
+  Socket *socket_;
+  systime_t timeout_;
+};
+
+/**
+ * @brief Cierre ordenado: espera el intercambio de FIN y libera el socket
+ * @details socketClose() se llama siempre al reanudar, también si el cierre
+ * ordenado falla o vence el plazo (en ese caso la conexión se aborta).
+ */
+class CloseAwaiter : public AsyncAwaiter {
+public:
+  CloseAwaiter(SocketAsyncContext *context, Socket *socket,
+               systime_t timeout) noexcept
+      : AsyncAwaiter(context), socket_(socket), timeout_(timeout) {}
+
+  bool await_ready() const noexcept { return socket_ == nullptr; }
+
+  bool await_suspend(std::coroutine_handle<> h) noexcept {
+    handle_ = h;
+    return submitted(socketAsyncShutdown(context_, &op_, socket_,
+                                         SOCKET_SD_BOTH, timeout_, onComplete,
+                                         self()));
+  }
+  error_t await_resume() noexcept {
+    if (socket_ != nullptr)
+      socketClose(socket_);
+    return error_;
+  }
+
+private:
+  Socket *socket_;
+  systime_t timeout_;
+};
+
+class SleepAwaiter : public AsyncAwaiter {
+public:
+  SleepAwaiter(SocketAsyncContext *context, systime_t delay) noexcept
+      : AsyncAwaiter(context), delay_(delay) {}
+
+  bool await_suspend(std::coroutine_handle<> h) noexcept {
+    handle_ = h;
+    return submitted(
+        socketAsyncStartTimer(context_, &op_, delay_, onComplete, self()));
+  }
+  void await_resume() const noexcept {}
+
+private:
+  systime_t delay_;
+};
+
+/* ========================================================================== */
+/*                                 EJECUTOR                                   */
+/* ========================================================================== */
+
+/**
+ * @brief Envoltorio del contexto SocketAsyncContext
+ */
+class Executor {
+public:
+  error_t start() noexcept {
+    SocketAsyncSettings settings;
+    socketAsyncGetDefaultSettings(&settings);
+    error_t error = socketAsyncInit(&context_, &settings);
+    if (!error)
+      error = socketAsyncStart(&context_);
+    return error;
+  }
+
+  error_t stop() noexcept { return socketAsyncStop(&context_); }
+
+  // Lanza la corrutina; su primer tramo se ejecuta en la tarea del ejecutor
+  error_t spawn(Task task) noexcept {
+    if (!task.valid())
+      return ERROR_OUT_OF_MEMORY;
+
+    auto h = task.release();
+    error_t error = socketAsyncPost(&context_, &h.promise().startOp, onStart,
+                                    h.address());
+    if (error)
+      h.destroy();
+    return error;
+  }
+
+  // Pasa el socket a modo no bloqueante (definitivo) para usarlo con co_await
+  error_t attach(Socket *socket) noexcept {
+    return socketAsyncAttach(&context_, socket);
+  }
+
+  SleepAwaiter sleep(systime_t delay) noexcept {
+    return SleepAwaiter(&context_, delay);
+  }
+
+  SocketAsyncContext *context() noexcept { return &context_; }
+
+private:
+  static void onStart(SocketAsyncContext *, SocketAsyncOp *op, error_t) {
+    std::coroutine_handle<>::from_address(op->param).resume();
+  }
+
+  SocketAsyncContext context_{};
+};
+
+/* ========================================================================== */
+/*                                  SOCKETS                                   */
+/* ========================================================================== */
+
+/**
+ * @brief Socket TCP conectado (no propietario: close() explícito)
+ */
+class TcpSocket {
+public:
+  TcpSocket() noexcept = default;
+  TcpSocket(Executor &executor, Socket *socket) noexcept
+      : context_(executor.context()), socket_(socket) {}
+
+  // Abre un socket TCP nuevo (para uso como cliente), ya asociado al
+  // ejecutor: queda en modo no bloqueante
+  static TcpSocket open(Executor &executor) noexcept {
+    Socket *socket = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+    if (socket != nullptr && executor.attach(socket)) {
+      socketClose(socket);
+      socket = nullptr;
+    }
+    return TcpSocket(executor, socket);
+  }
+
+  bool valid() const noexcept { return socket_ != nullptr; }
+  Socket *handle() const noexcept { return socket_; }
+
+  ConnectAwaiter connect(const IpAddr &ipAddr, uint16_t port,
+                         systime_t timeout = INFINITE_DELAY) noexcept {
+    return ConnectAwaiter(context_, socket_, ipAddr, port, timeout);
+  }
+
+  RecvAwaiter recv(void *data, std::size_t size, uint_t flags = 0,
+                   systime_t timeout = INFINITE_DELAY) noexcept {
+    return RecvAwaiter(context_, socket_, data, size, flags, timeout);
+  }
+
+  SendAwaiter send(const void *data, std::size_t length, uint_t flags = 0,
+                   systime_t timeout = INFINITE_DELAY) noexcept {
+    return SendAwaiter(context_, socket_, data, length, flags, timeout);
+  }
+
+  // Cierre ordenado: los datos ya enviados con send() llegan al cliente
+  // antes del FIN. El socket queda liberado al terminar el co_await
+  CloseAwaiter close(systime_t timeout = SOCKET_CORO_CLOSE_TIMEOUT) noexcept {
+    Socket *socket = socket_;
+    socket_ = nullptr;
+    return CloseAwaiter(context_, socket, timeout);
+  }
+
+  // Cierre inmediato (RST): descarta los datos pendientes de envío
+  void abort() noexcept {
+    if (socket_ != nullptr) {
+      socketClose(socket_);
+      socket_ = nullptr;
+    }
+  }
+
+private:
+  SocketAsyncContext *context_ = nullptr;
+  Socket *socket_ = nullptr;
+};
+
+/**
+ * @brief Socket TCP en escucha
+ */
+class TcpServer {
+public:
+  explicit TcpServer(Executor &executor) noexcept : executor_(executor) {}
+
+  error_t listen(uint16_t port, uint_t backlog = 0) noexcept {
+    socket_ = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+    if (socket_ == nullptr)
+      return ERROR_OPEN_FAILED;
+
+    error_t error = executor_.attach(socket_);
+    if (!error)
+      error = socketBind(socket_, &IP_ADDR_ANY, port);
+    if (!error)
+      error = socketListen(socket_, backlog);
+    if (error) {
+      socketClose(socket_);
+      socket_ = nullptr;
+    }
+    return error;
+  }
+
+  AcceptAwaiter accept(systime_t timeout = INFINITE_DELAY) noexcept {
+    return AcceptAwaiter(executor_.context(), socket_, timeout);
+  }
+
+  // Convierte el resultado de accept() en un TcpSocket (el socket aceptado
+  // ya está asociado al ejecutor)
+  TcpSocket adopt(const AcceptResult &result) noexcept {
+    return TcpSocket(executor_, result.socket);
+  }
+
+  void close() noexcept {
+    if (socket_ != nullptr) {
+      socketClose(socket_);
+      socket_ = nullptr;
+    }
+  }
+
+private:
+  Executor &executor_;
+  Socket *socket_ = nullptr;
+};
+
+} // namespace net
+
+#endif // SOCKET_CORO_HPP
@@ -16,11 +16,15 @@ extern "C" {
 #include "core/ethernet.h" // Para ipv4AddrToString
 #include "debug.h"
 #include "http/http_common.h"
+#include "http/http_router.h"
 #include "http/http_server.h"
+#include "http/http_server_misc.h"
 #include "http/mime.h"
 #include "include/wifi_config.h"
+#include "json_writer.h"
 #include "path.h"
 #include "resource_manager.h"
+#include "resp_cache.h"
 #include "wifi_manager.h"
 }
 
@@ -28,7 +32,17 @@ extern "C" {
 /*                               CONSTANTES                                   */
 /* ========================================================================== */
 static const char *TAG = "Main";
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
+// Sin pila por conexión: se pueden atender más clientes con menos RAM
+#define APP_HTTP_MAX_CONNECTIONS 8
+// Antigüedad máxima de un escaneo para servirlo sin escanear de nuevo (ms)
+#define APP_SCAN_MAX_AGE 10000
+#else
 #define APP_HTTP_MAX_CONNECTIONS 2
+#endif
+// Formato de las respuestas JSON en la cache (mismo número que el
+// Content-Format application/json de CoAP)
+#define APP_FORMAT_JSON 50
 
 /* ========================================================================== */
 /*                          VARIABLES GLOBALES                                */
@@ -36,8 +50,9 @@ static const char *TAG = "Main";
 HttpServerSettings httpServerSettings;
 HttpServerContext httpServerContext;
 HttpConnection httpConnections[APP_HTTP_MAX_CONNECTIONS];
+HttpRouter httpRouter;
+RespCache respCache;
 WifiManagerContext_t wifi_context;
-SemaphoreHandle_t xHttpBufferMutex = NULL;
 
 /* ========================================================================== */
 /*                      PROTOTIPOS DE FUNCIONES                               */
@@ -48,6 +63,7 @@ error_t httpServerRequestCallback(HttpConnection *connection,
                                   const char_t *uri);
 error_t httpServerUriNotFoundCallback(HttpConnection *connection,
                                       const char_t *uri);
+static error_t init_http_routes(void);
 
 /* ========================================================================== */
 /*                      IMPLEMENTACIÓN DE FUNCIONES                           */
@@ -166,18 +182,35 @@ void app_main(void) {
     ESP_LOGE(TAG, "Error inicializando WiFi: %d", error);
   }
 
-  // Crear Mutex para proteger buffers JSON compartidos
-  xHttpBufferMutex = xSemaphoreCreateMutex();
-  if (xHttpBufferMutex == NULL) {
-    ESP_LOGE(TAG, "Error: No se pudo crear el Mutex HTTP");
+  // Seleccionar la imagen de recursos (partición A/B o la imagen enlazada)
+  error = resInit();
+  if (error) {
+    ESP_LOGE(TAG, "Error montando la partición de recursos: %d", error);
+  }
+
+  // Cache de las respuestas JSON que cambian poco (configuración y estado)
+  error = respCacheInit(&respCache);
+  if (error) {
+    ESP_LOGE(TAG, "Error inicializando la cache de respuestas: %d", error);
+  }
+
+  // Construir el trie de rutas de la API
+  error = init_http_routes();
+  if (error) {
+    ESP_LOGE(TAG, "Error registrando las rutas HTTP: %d", error);
   }
 
   // Configuración Servidor HTTP
   httpServerGetDefaultSettings(&httpServerSettings);
 
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
+  // Una única tarea atiende todas las conexiones y ejecuta los callbacks
+  httpServerSettings.listenerTask.stackSize = 4096;
+#else
   for (uint8_t i = 0; i < APP_HTTP_MAX_CONNECTIONS; i++) {
     httpServerSettings.connectionTask[i].stackSize = 4096;
   }
+#endif
   httpServerSettings.maxConnections = APP_HTTP_MAX_CONNECTIONS;
   httpServerSettings.connections = httpConnections;
   strcpy(httpServerSettings.rootDirectory, "/www/");
@@ -198,29 +231,140 @@ void app_main(void) {
 }
 
 /* ========================================================================== */
-/*                    DOCUMENTOS JSON ESTÁTICOS (BSS)                        */
+/*                         RESPUESTAS JSON EN STREAMING                       */
 /* ========================================================================== */
-// StaticJsonDocument<N> usa memoria estática (BSS) en vez de heap/stack
-// Nota: ArduinoJson v7 marca StaticJsonDocument como deprecated, pero sigue
-//       siendo la ÚNICA forma de evitar heap en embedded sin custom allocator
-static StaticJsonDocument<512> s_json_doc_status;
-static StaticJsonDocument<1536> s_json_doc_config;
-static StaticJsonDocument<2048> s_json_doc_scan;
-static StaticJsonDocument<1024> s_json_doc_post;
-static char s_response_buffer[2048]; // Buffer de serialización HTTP
+// El JSON se serializa a medida que se generan los campos y se envía en chunks
+// HTTP a través de un buffer de JSON_WRITER_BUFFER_SIZE bytes en la pila de la
+// conexión: no hay documentos ni buffers compartidos, ni mutex entre peticiones
 
 /**
- * @brief Helper: Construye respuesta JSON para GET /api/wifi/status
- * @note Sin alocación dinámica, sin stack overflow (usa BSS global)
+ * @brief Salida del escritor JSON: envía cada bloque por la conexión HTTP
  */
-static error_t handle_get_status(HttpConnection *connection) {
-  if (xSemaphoreTake(xHttpBufferMutex, pdMS_TO_TICKS(1000)) != pdTRUE) {
-    connection->response.statusCode = 503; // Service Unavailable
-    httpWriteHeader(connection);
-    return httpCloseStream(connection);
+static error_t json_http_output(void *param, const void *data, size_t length) {
+  return httpWriteStream((HttpConnection *)param, data, length);
+}
+
+/**
+ * @brief Helper: Envía la cabecera de una respuesta JSON de longitud
+ *        desconocida (chunked) y prepara el escritor
+ */
+static error_t begin_json_response(HttpConnection *connection,
+                                   JsonWriter *writer) {
+  connection->response.statusCode = 200;
+  connection->response.contentType = "application/json";
+  connection->response.chunkedEncoding = TRUE;
+  jsonWriterInit(writer, json_http_output, connection);
+  return httpWriteHeader(connection);
+}
+
+/**
+ * @brief Helper: Vacía el escritor JSON y cierra la respuesta
+ * @note La cabecera ya se ha enviado: un error solo puede cortar la conexión
+ */
+static error_t end_json_response(HttpConnection *connection,
+                                 JsonWriter *writer) {
+  error_t error = jsonWriterFlush(writer);
+  if (error) {
+    ESP_LOGE(TAG, "Error enviando JSON: %d", error);
+    return error;
+  }
+  return httpCloseStream(connection);
+}
+
+/**
+ * @brief Salida del escritor JSON hacia un buffer en memoria
+ */
+typedef struct {
+  uint8_t *data;
+  size_t size;
+  size_t length;
+} JsonBuffer;
+
+static error_t json_buffer_output(void *param, const void *data,
+                                  size_t length) {
+  JsonBuffer *buffer = (JsonBuffer *)param;
+
+  if (length > buffer->size - buffer->length) {
+    return ERROR_BUFFER_OVERFLOW;
+  }
+  memcpy(buffer->data + buffer->length, data, length);
+  buffer->length += length;
+  return NO_ERROR;
+}
+
+/**
+ * @brief Genera el documento JSON de un recurso sobre el escritor dado
+ */
+typedef void (*JsonRenderer)(JsonWriter *writer);
+
+/**
+ * @brief Helper: Envía un recurso JSON desde la cache de respuestas
+ * @param[in] uri     Clave del recurso en la cache
+ * @param[in] version Versión actual de los datos (leída antes de generar)
+ * @param[in] render  Generador del documento, usado solo si la cache no tiene
+ *                    una copia de esta versión
+ * @note Un acierto cuesta un memcpy; con If-None-Match coincidente se responde
+ *       304 sin cuerpo
+ */
+static error_t send_cached_json(HttpConnection *connection, const char *uri,
+                                uint32_t version, JsonRenderer render) {
+  uint8_t body[RESP_CACHE_MAX_SIZE];
+  char etag[RESP_CACHE_ETAG_SIZE];
+  size_t length;
+  JsonWriter writer;
+
+  error_t error = respCacheGet(&respCache, uri, APP_FORMAT_JSON, version, body,
+                               sizeof(body), &length, etag);
+  if (error) {
+    // Regenerar el documento en memoria y guardarlo en la cache
+    JsonBuffer buffer = {body, sizeof(body), 0};
+    jsonWriterInit(&writer, json_buffer_output, &buffer);
+    render(&writer);
+    error = jsonWriterFlush(&writer);
+
+    if (error) {
+      // No cabe en una entrada de la cache: enviarlo en streaming
+      error = begin_json_response(connection, &writer);
+      if (error) {
+        return error;
+      }
+      render(&writer);
+      return end_json_response(connection, &writer);
+    }
+
+    length = buffer.length;
+    respCachePut(&respCache, uri, APP_FORMAT_JSON, version, body, length,
+                 etag);
+  }
+
+  connection->response.statusCode = 200;
+  connection->response.contentType = "application/json";
+  connection->response.chunkedEncoding = FALSE;
+  connection->response.contentLength = length;
+
+#if (HTTP_SERVER_ETAG_SUPPORT == ENABLED)
+  // El cliente ya tiene esta versión del documento?
+  strcpy(connection->response.etag, etag);
+  if (httpMatchEntityTag(connection->request.ifNoneMatch, etag)) {
+    connection->response.statusCode = 304;
+    length = 0;
+  }
+#endif
+
+  error = httpWriteHeader(connection);
+  if (!error && length > 0) {
+    error = httpWriteStream(connection, body, length);
+  }
+  if (error) {
+    return error;
   }
+  return httpCloseStream(connection);
+}
 
-  s_json_doc_status.clear();
+/**
+ * @brief Genera el JSON de GET /api/wifi/status
+ */
+static void render_status(JsonWriter *writer) {
   char ip_str[16] = "0.0.0.0";
 
   // Obtener estado de interfaz STA
@@ -234,117 +378,121 @@ static error_t handle_get_status(HttpConnection *connection) {
   }
 
   // Construir JSON
-  s_json_doc_status["sta_connected"] = (bool)sta_connected;
-  s_json_doc_status["sta_ssid"] = wifi_context.config.sta_ssid;
-  s_json_doc_status["sta_ip"] = ip_str;
-  s_json_doc_status["ap_clients"] = 0;
-  s_json_doc_status["current_mode"] = (int)wifi_context.config.current_mode;
-
-  // Serializar y enviar
-  size_t n = serializeJson(s_json_doc_status, s_response_buffer,
-                           sizeof(s_response_buffer));
-  if (n == 0 || n >= sizeof(s_response_buffer)) {
-    ESP_LOGE(TAG, "Error serializando JSON status");
-    connection->response.statusCode = 500;
-    httpWriteHeader(connection);
-    return httpCloseStream(connection);
-  }
-
-  connection->response.contentType = "application/json";
-  connection->response.contentLength = n;
-  connection->response.statusCode = 200;
-  httpWriteHeader(connection);
-  httpWriteStream(connection, s_response_buffer, n);
-  xSemaphoreGive(xHttpBufferMutex);
-  return httpCloseStream(connection);
+  jsonWriterBeginObject(writer);
+  jsonWriterBoolMember(writer, "sta_connected", sta_connected);
+  jsonWriterStringMember(writer, "sta_ssid", wifi_context.config.sta_ssid);
+  jsonWriterStringMember(writer, "sta_ip", ip_str);
+  jsonWriterIntMember(writer, "ap_clients", 0);
+  jsonWriterIntMember(writer, "current_mode",
+                      (int)wifi_context.config.current_mode);
+  jsonWriterEndObject(writer);
 }
 
 /**
- * @brief Helper: Construye respuesta JSON para GET /api/wifi/config
- * @note Sin alocación dinámica, sin stack overflow (usa BSS global)
+ * @brief Helper: Responde GET /api/wifi/status
+ * @note Se regenera solo cuando cambian el enlace, DHCP o la configuración
  */
-static error_t handle_get_config(HttpConnection *connection) {
-  if (xSemaphoreTake(xHttpBufferMutex, pdMS_TO_TICKS(1000)) != pdTRUE) {
-    connection->response.statusCode = 503;
-    httpWriteHeader(connection);
-    return httpCloseStream(connection);
-  }
+static error_t handle_get_status(HttpConnection *connection,
+                                 const HttpRouteMatch *match, void *param) {
+  return send_cached_json(connection, "/api/wifi/status",
+                          wifi_context.status_version, render_status);
+}
 
-  s_json_doc_config.clear();
+/**
+ * @brief Helper: Escribe un miembro con una dirección IPv4
+ */
+static void json_write_ipv4(JsonWriter *writer, const char *name,
+                            Ipv4Addr addr) {
+  char ip_str[16];
 
-  // Buffers temporales para conversión de IPs (en stack, pero son pequeños)
-  char sta_ip[16], sta_mask[16], sta_gw[16], sta_dns1[16], sta_dns2[16];
-  char ap_ip[16], ap_mask[16], ap_gw[16], ap_dns1[16], ap_dns2[16];
-  char ap_dhcp_min[16], ap_dhcp_max[16];
+  ipv4AddrToString(addr, ip_str);
+  jsonWriterStringMember(writer, name, ip_str);
+}
 
-  // Convertir direcciones IP a strings
-  ipv4AddrToString(wifi_context.config.sta_ipv4_addr, sta_ip);
-  ipv4AddrToString(wifi_context.config.sta_subnet_mask, sta_mask);
-  ipv4AddrToString(wifi_context.config.sta_gateway, sta_gw);
-  ipv4AddrToString(wifi_context.config.sta_dns1, sta_dns1);
-  ipv4AddrToString(wifi_context.config.sta_dns2, sta_dns2);
-
-  ipv4AddrToString(wifi_context.config.ap_ipv4_addr, ap_ip);
-  ipv4AddrToString(wifi_context.config.ap_subnet_mask, ap_mask);
-  ipv4AddrToString(wifi_context.config.ap_gateway, ap_gw);
-  ipv4AddrToString(wifi_context.config.ap_dns1, ap_dns1);
-  ipv4AddrToString(wifi_context.config.ap_dns2, ap_dns2);
-  ipv4AddrToString(wifi_context.config.ap_dhcp_range_min, ap_dhcp_min);
-  ipv4AddrToString(wifi_context.config.ap_dhcp_range_max, ap_dhcp_max);
+/**
+ * @brief Genera el JSON de GET /api/wifi/config
+ */
+static void render_config(JsonWriter *writer) {
+  jsonWriterBeginObject(writer);
 
   // Construir objeto STA
-  JsonObject sta_obj = s_json_doc_config["sta"].to<JsonObject>();
-  sta_obj["ssid"] = wifi_context.config.sta_ssid;
-  sta_obj["password"] = wifi_context.config.sta_password;
-  sta_obj["use_dhcp"] = wifi_context.config.sta_use_dhcp;
-  sta_obj["ip"] = sta_ip;
-  sta_obj["mask"] = sta_mask;
-  sta_obj["gw"] = sta_gw;
-  sta_obj["dns1"] = sta_dns1;
-  sta_obj["dns2"] = sta_dns2;
+  jsonWriterKey(writer, "sta");
+  jsonWriterBeginObject(writer);
+  jsonWriterStringMember(writer, "ssid", wifi_context.config.sta_ssid);
+  jsonWriterStringMember(writer, "password", wifi_context.config.sta_password);
+  jsonWriterBoolMember(writer, "use_dhcp", wifi_context.config.sta_use_dhcp);
+  json_write_ipv4(writer, "ip", wifi_context.config.sta_ipv4_addr);
+  json_write_ipv4(writer, "mask", wifi_context.config.sta_subnet_mask);
+  json_write_ipv4(writer, "gw", wifi_context.config.sta_gateway);
+  json_write_ipv4(writer, "dns1", wifi_context.config.sta_dns1);
+  json_write_ipv4(writer, "dns2", wifi_context.config.sta_dns2);
+  jsonWriterEndObject(writer);
 
   // Construir objeto AP
-  JsonObject ap_obj = s_json_doc_config["ap"].to<JsonObject>();
-  ap_obj["ssid"] = wifi_context.config.ap_ssid;
-  ap_obj["password"] = wifi_context.config.ap_password;
-  ap_obj["max_connections"] = wifi_context.config.ap_max_connections;
-  ap_obj["use_dhcp_server"] = wifi_context.config.ap_use_dhcp_server;
-  ap_obj["ip"] = ap_ip;
-  ap_obj["mask"] = ap_mask;
-  ap_obj["gw"] = ap_gw;
-  ap_obj["dns1"] = ap_dns1;
-  ap_obj["dns2"] = ap_dns2;
-  ap_obj["dhcp_range_min"] = ap_dhcp_min;
-  ap_obj["dhcp_range_max"] = ap_dhcp_max;
-
-  s_json_doc_config["current_mode"] = (int)wifi_context.config.current_mode;
-
-  // Serializar y enviar
-  size_t n = serializeJson(s_json_doc_config, s_response_buffer,
-                           sizeof(s_response_buffer));
-  if (n == 0 || n >= sizeof(s_response_buffer)) {
-    ESP_LOGE(TAG, "Error serializando JSON config");
-    connection->response.statusCode = 500;
-    httpWriteHeader(connection);
-    return httpCloseStream(connection);
-  }
+  jsonWriterKey(writer, "ap");
+  jsonWriterBeginObject(writer);
+  jsonWriterStringMember(writer, "ssid", wifi_context.config.ap_ssid);
+  jsonWriterStringMember(writer, "password", wifi_context.config.ap_password);
+  jsonWriterUintMember(writer, "max_connections",
+                       wifi_context.config.ap_max_connections);
+  jsonWriterBoolMember(writer, "use_dhcp_server",
+                       wifi_context.config.ap_use_dhcp_server);
+  json_write_ipv4(writer, "ip", wifi_context.config.ap_ipv4_addr);
+  json_write_ipv4(writer, "mask", wifi_context.config.ap_subnet_mask);
+  json_write_ipv4(writer, "gw", wifi_context.config.ap_gateway);
+  json_write_ipv4(writer, "dns1", wifi_context.config.ap_dns1);
+  json_write_ipv4(writer, "dns2", wifi_context.config.ap_dns2);
+  json_write_ipv4(writer, "dhcp_range_min",
+                  wifi_context.config.ap_dhcp_range_min);
+  json_write_ipv4(writer, "dhcp_range_max",
+                  wifi_context.config.ap_dhcp_range_max);
+  jsonWriterEndObject(writer);
+
+  jsonWriterIntMember(writer, "current_mode",
+                      (int)wifi_context.config.current_mode);
+  jsonWriterEndObject(writer);
+}
 
-  connection->response.contentType = "application/json";
-  connection->response.contentLength = n;
-  connection->response.statusCode = 200;
-  httpWriteHeader(connection);
-  httpWriteStream(connection, s_response_buffer, n);
-  xSemaphoreGive(xHttpBufferMutex);
-  return httpCloseStream(connection);
+/**
+ * @brief Helper: Responde GET /api/wifi/config
+ * @note Se regenera solo tras WifiManager_SetConfig o un cambio de modo
+ */
+static error_t handle_get_config(HttpConnection *connection,
+                                 const HttpRouteMatch *match, void *param) {
+  return send_cached_json(connection, "/api/wifi/config",
+                          wifi_context.config_version, render_config);
 }
 
 /**
  * @brief Helper: Maneja GET /api/wifi/scan
- * @note Sin alocación dinámica, sin stack overflow (usa BSS global)
+ * @note Cada red se envía según se recorre la lista: el tamaño de la respuesta
+ *       no depende de ningún buffer
+ * @note En modo event-driven el escaneo (varios segundos) no puede bloquear la
+ *       única tarea del servidor: se inicia en segundo plano y se responde 202
+ *       hasta que hay resultados recientes, que el cliente vuelve a pedir
  */
-static error_t handle_get_scan(HttpConnection *connection) {
+static error_t handle_get_scan(HttpConnection *connection,
+                               const HttpRouteMatch *match, void *param) {
+  JsonWriter writer;
+
+#if (HTTP_SERVER_EVENT_DRIVEN_SUPPORT == ENABLED)
+  // Resultados ausentes o antiguos: escanear en segundo plano
+  error_t error = NO_ERROR;
+  if (wifi_context.scan_in_progress || wifi_context.scan_version == 0 ||
+      timeCompare(osGetSystemTime(),
+                  wifi_context.scan_timestamp + APP_SCAN_MAX_AGE) >= 0) {
+    error = WifiManager_StartScan(&wifi_context);
+    if (!error) {
+      connection->response.statusCode = 202;
+      connection->response.contentLength = 0;
+      httpWriteHeader(connection);
+      return httpCloseStream(connection);
+    }
+  }
+#else
   // Ejecutar escaneo
   error_t error = WifiManager_ScanNetworks(&wifi_context);
+#endif
   if (error != NO_ERROR) {
     ESP_LOGE(TAG, "Error al escanear redes (error_t: %d)", error);
     connection->response.statusCode = 500;
@@ -355,24 +503,14 @@ static error_t handle_get_scan(HttpConnection *connection) {
   ESP_LOGI(TAG, "Escaneo exitoso. Redes encontradas: %d",
            wifi_context.scanned_networks_count);
 
-  ESP_LOGI(TAG, "Escaneo exitoso. Redes encontradas: %d",
-           wifi_context.scanned_networks_count);
-
-  if (xSemaphoreTake(xHttpBufferMutex, pdMS_TO_TICKS(1000)) != pdTRUE) {
-    connection->response.statusCode = 503;
-    httpWriteHeader(connection);
-    return httpCloseStream(connection);
+  error = begin_json_response(connection, &writer);
+  if (error) {
+    return error;
   }
 
-  s_json_doc_scan.clear();
-  JsonArray arr = s_json_doc_scan.to<JsonArray>();
-
   // Construir array de redes escaneadas
+  jsonWriterBeginArray(&writer);
   for (int i = 0; i < wifi_context.scanned_networks_count; i++) {
-    JsonObject net = arr.add<JsonObject>();
-    net["ssid"] = wifi_context.scanned_networks[i].ssid;
-    net["rssi"] = wifi_context.scanned_networks[i].rssi;
-
     // Mapear authmode a string legible
     const char *authmode_str = "UNKNOWN";
     switch (wifi_context.scanned_networks[i].authmode) {
@@ -403,35 +541,29 @@ static error_t handle_get_scan(HttpConnection *connection) {
     default:
       break;
     }
-    net["authmode"] = authmode_str;
-  }
 
-  // Serializar y enviar
-  size_t n = serializeJson(s_json_doc_scan, s_response_buffer,
-                           sizeof(s_response_buffer));
-  if (n == 0 || n >= sizeof(s_response_buffer)) {
-    ESP_LOGE(TAG, "Error serializando JSON scan");
-    connection->response.statusCode = 500;
-    httpWriteHeader(connection);
-    return httpCloseStream(connection);
+    jsonWriterBeginObject(&writer);
+    jsonWriterStringMember(&writer, "ssid",
+                           wifi_context.scanned_networks[i].ssid);
+    jsonWriterIntMember(&writer, "rssi", wifi_context.scanned_networks[i].rssi);
+    jsonWriterStringMember(&writer, "authmode", authmode_str);
+    jsonWriterEndObject(&writer);
   }
+  jsonWriterEndArray(&writer);
 
-  connection->response.contentType = "application/json";
-  connection->response.contentLength = n;
-  connection->response.statusCode = 200;
-  httpWriteHeader(connection);
-  httpWriteStream(connection, s_response_buffer, n);
-  xSemaphoreGive(xHttpBufferMutex);
-  return httpCloseStream(connection);
+  return end_json_response(connection, &writer);
 }
 
 /**
  * @brief Helper: Maneja POST /api/wifi/config
- * @note Sin alocación dinámica, sin stack overflow (usa BSS global)
+ * @note El documento de lectura vive en la pila de la conexión, así que las
+ *       peticiones concurrentes no comparten estado
  */
-static error_t handle_post_config(HttpConnection *connection) {
+static error_t handle_post_config(HttpConnection *connection,
+                                  const HttpRouteMatch *match, void *param) {
   char recv_buffer[1024];
   size_t received = 0;
+  StaticJsonDocument<1024> doc;
 
   // Leer body de la petición POST
   error_t error = httpReadStream(connection, recv_buffer, sizeof(recv_buffer),
@@ -444,18 +576,9 @@ static error_t handle_post_config(HttpConnection *connection) {
   }
 
   // Parsear JSON
-  if (xSemaphoreTake(xHttpBufferMutex, pdMS_TO_TICKS(1000)) != pdTRUE) {
-    connection->response.statusCode = 503;
-    httpWriteHeader(connection);
-    return httpCloseStream(connection);
-  }
-
-  s_json_doc_post.clear();
-  DeserializationError err =
-      deserializeJson(s_json_doc_post, recv_buffer, received);
+  DeserializationError err = deserializeJson(doc, recv_buffer, received);
   if (err) {
     ESP_LOGE(TAG, "Error parsing JSON: %s", err.c_str());
-    xSemaphoreGive(xHttpBufferMutex); // Liberar antes de salir
     connection->response.statusCode = 400;
     httpWriteHeader(connection);
     return httpCloseStream(connection);
@@ -465,8 +588,8 @@ static error_t handle_post_config(HttpConnection *connection) {
   WifiManagerConfig_t new_config = wifi_context.config;
 
   // Actualizar configuración STA
-  if (s_json_doc_post["sta"].is<JsonObject>()) {
-    JsonObject sta_json = s_json_doc_post["sta"];
+  if (doc["sta"].is<JsonObject>()) {
+    JsonObject sta_json = doc["sta"];
     strlcpy(new_config.sta_ssid, sta_json["ssid"] | "",
             WIFI_MANAGER_SSID_MAX_LEN);
     strlcpy(new_config.sta_password, sta_json["password"] | "",
@@ -485,8 +608,8 @@ static error_t handle_post_config(HttpConnection *connection) {
   }
 
   // Actualizar configuración AP
-  if (s_json_doc_post["ap"].is<JsonObject>()) {
-    JsonObject ap_json = s_json_doc_post["ap"];
+  if (doc["ap"].is<JsonObject>()) {
+    JsonObject ap_json = doc["ap"];
     strlcpy(new_config.ap_ssid, ap_json["ssid"] | "",
             WIFI_MANAGER_SSID_MAX_LEN);
     strlcpy(new_config.ap_password, ap_json["password"] | "",
@@ -506,9 +629,8 @@ static error_t handle_post_config(HttpConnection *connection) {
   }
 
   // Actualizar modo operativo
-  if (s_json_doc_post["current_mode"].is<int>()) {
-    new_config.current_mode =
-        (wm_wifi_mode_t)(int)(s_json_doc_post["current_mode"]);
+  if (doc["current_mode"].is<int>()) {
+    new_config.current_mode = (wm_wifi_mode_t)(int)(doc["current_mode"]);
   }
 
   ESP_LOGI(TAG, "Aplicando nueva configuración. Modo: %d, STA SSID: %s",
@@ -520,14 +642,87 @@ static error_t handle_post_config(HttpConnection *connection) {
 
   connection->response.statusCode = 200;
   httpWriteHeader(connection);
-  xSemaphoreGive(xHttpBufferMutex);
   return httpCloseStream(connection);
 }
 
+#if (RES_PARTITION_SUPPORT == ENABLED && \
+     HTTP_SERVER_EVENT_DRIVEN_SUPPORT == DISABLED)
+/**
+ * @brief Helper: Maneja POST /api/resources
+ * @note El cuerpo es el binario generado por pack.py --partition. Se graba en
+ *       la partición inactiva y se activa en el próximo arranque
+ */
+static error_t handle_post_resources(HttpConnection *connection,
+                                     const HttpRouteMatch *match, void *param) {
+  static ResUpdateContext s_res_update;
+  char recv_buffer[512];
+  size_t received;
+
+  error_t error = resUpdateBegin(&s_res_update);
+
+  // Copiar el cuerpo de la petición a la partición por bloques
+  while (!error) {
+    error = httpReadStream(connection, recv_buffer, sizeof(recv_buffer),
+                           &received, 0);
+    if (error == ERROR_END_OF_STREAM) {
+      error = resUpdateEnd(&s_res_update);
+      break;
+    }
+    if (!error) {
+      error = resUpdateWrite(&s_res_update, recv_buffer, received);
+    }
+  }
+
+  if (error) {
+    ESP_LOGE(TAG, "Error actualizando recursos: %d", error);
+  }
+
+  connection->response.statusCode = error ? 400 : 204;
+  connection->response.contentLength = 0;
+  httpWriteHeader(connection);
+  return httpCloseStream(connection);
+}
+#endif
+
+/**
+ * @brief Helper: Responde 404 a cualquier ruta /api/ desconocida
+ * @note Evita que las rutas de la API caigan en la búsqueda de recursos
+ */
+static error_t handle_api_not_found(HttpConnection *connection,
+                                    const HttpRouteMatch *match, void *param) {
+  return httpSendErrorResponse(connection, 404,
+                               "The requested page could not be found");
+}
+
+/* ========================================================================== */
+/*                             TABLA DE RUTAS                                 */
+/* ========================================================================== */
+// Tabla constante: el router guarda punteros a las entradas, no las copia.
+// Segmentos ":nombre" capturan un segmento y "*" el resto de la ruta
+static constexpr HttpRoute s_api_routes[] = {
+    {HTTP_ROUTE_METHOD_GET, "/api/wifi/status", handle_get_status, NULL},
+    {HTTP_ROUTE_METHOD_GET, "/api/wifi/config", handle_get_config, NULL},
+    {HTTP_ROUTE_METHOD_POST, "/api/wifi/config", handle_post_config, NULL},
+    {HTTP_ROUTE_METHOD_GET, "/api/wifi/scan", handle_get_scan, NULL},
+#if (RES_PARTITION_SUPPORT == ENABLED && \
+     HTTP_SERVER_EVENT_DRIVEN_SUPPORT == DISABLED)
+    {HTTP_ROUTE_METHOD_POST, "/api/resources", handle_post_resources, NULL},
+#endif
+    {HTTP_ROUTE_METHOD_ANY, "/api/*", handle_api_not_found, NULL},
+};
+
+/**
+ * @brief Registra la tabla de rutas en el router
+ */
+static error_t init_http_routes(void) {
+  httpRouterInit(&httpRouter);
+  return httpRouterAddRoutes(&httpRouter, s_api_routes,
+                             arraysize(s_api_routes));
+}
+
 /**
  * @brief Callback principal para peticiones HTTP
- * @note Refactorizado para ArduinoJson v7 con buffers estáticos (sin heap/stack
- * overflow)
+ * @note Las rutas de la API se resuelven en el trie de httpRouter
  */
 error_t httpServerRequestCallback(HttpConnection *connection,
                                   const char_t *uri) {
@@ -536,33 +731,10 @@ error_t httpServerRequestCallback(HttpConnection *connection,
   }
 
   connection->response.version = connection->request.version;
-  connection->response.keepAlive = connection->request.keepAlive;
 
-  // --- Endpoint: GET /api/wifi/status ---
-  if (strcasecmp(uri, "/api/wifi/status") == 0 &&
-      strcasecmp(connection->request.method, "GET") == 0) {
-    return handle_get_status(connection);
-  }
-
-  // --- Endpoint: GET /api/wifi/config ---
-  if (strcasecmp(uri, "/api/wifi/config") == 0 &&
-      strcasecmp(connection->request.method, "GET") == 0) {
-    return handle_get_config(connection);
-  }
-
-  // --- Endpoint: GET /api/wifi/scan ---
-  if (strcasecmp(uri, "/api/wifi/scan") == 0 &&
-      strcasecmp(connection->request.method, "GET") == 0) {
-    return handle_get_scan(connection);
-  }
-
-  // --- Endpoint: POST /api/wifi/config ---
-  if (strcasecmp(uri, "/api/wifi/config") == 0 &&
-      strcasecmp(connection->request.method, "POST") == 0) {
-    return handle_post_config(connection);
-  }
-
-  return ERROR_NOT_FOUND;
+  // Búsqueda en el trie de rutas. ERROR_NOT_FOUND deja paso a los recursos
+  // estáticos
+  return httpRouterDispatch(&httpRouter, connection, uri);
 }
 
 error_t httpServerUriNotFoundCallback(HttpConnection *connection,
@@ -439,6 +439,13 @@
 // Number of sockets that can be opened simultaneously
 #define SOCKET_MAX_COUNT CONFIG_SOCKET_MAX_COUNT
 
+// Asynchronous socket API support
+#if CONFIG_SOCKET_ASYNC_SUPPORT
+#define SOCKET_ASYNC_SUPPORT ENABLED
+#else
+#define SOCKET_ASYNC_SUPPORT DISABLED
+#endif
+
 // LLMNR responder support
 #if CONFIG_LLMNR_RESPONDER_SUPPORT
 #define LLMNR_RESPONDER_SUPPORT ENABLED
@@ -453,6 +460,29 @@
 #define HTTP_SERVER_SUPPORT DISABLED
 #endif
 
+// HTTP persistent connections (keep-alive)
+#if CONFIG_HTTP_SERVER_PERSISTENT_CONN_SUPPORT
+#define HTTP_SERVER_PERSISTENT_CONN_SUPPORT ENABLED
+#define HTTP_SERVER_MAX_REQUESTS CONFIG_HTTP_SERVER_MAX_REQUESTS
+#define HTTP_SERVER_IDLE_TIMEOUT CONFIG_HTTP_SERVER_IDLE_TIMEOUT
+#else
+#define HTTP_SERVER_PERSISTENT_CONN_SUPPORT DISABLED
+#endif
+
+// Event-driven HTTP server (single task)
+#if CONFIG_HTTP_SERVER_EVENT_DRIVEN_SUPPORT
+#define HTTP_SERVER_EVENT_DRIVEN_SUPPORT ENABLED
+#else
+#define HTTP_SERVER_EVENT_DRIVEN_SUPPORT DISABLED
+#endif
+
+// Buffered reader for HTTP request headers
+#if CONFIG_HTTP_SERVER_RX_BUFFER_SUPPORT
+#define HTTP_SERVER_RX_BUFFER_SUPPORT ENABLED
+#else
+#define HTTP_SERVER_RX_BUFFER_SUPPORT DISABLED
+#endif
+
 // Server Side Includes support
 #if CONFIG_HTTP_SERVER_SSI_SUPPORT
 #define HTTP_SERVER_SSI_SUPPORT ENABLED
@@ -460,4 +490,38 @@
 #define HTTP_SERVER_SSI_SUPPORT DISABLED
 #endif
 
+// Precompressed resource variants
+#if CONFIG_HTTP_SERVER_GZIP_TYPE_SUPPORT
+#define HTTP_SERVER_GZIP_TYPE_SUPPORT ENABLED
+#else
+#define HTTP_SERVER_GZIP_TYPE_SUPPORT DISABLED
+#endif
+
+#if CONFIG_HTTP_SERVER_BROTLI_TYPE_SUPPORT
+#define HTTP_SERVER_BROTLI_TYPE_SUPPORT ENABLED
+#else
+#define HTTP_SERVER_BROTLI_TYPE_SUPPORT DISABLED
+#endif
+
+// ETag validation of static resources
+#if CONFIG_HTTP_SERVER_ETAG_SUPPORT
+#define HTTP_SERVER_ETAG_SUPPORT ENABLED
+#else
+#define HTTP_SERVER_ETAG_SUPPORT DISABLED
+#endif
+
+// Byte range requests for static resources
+#if CONFIG_HTTP_SERVER_RANGE_SUPPORT
+#define HTTP_SERVER_RANGE_SUPPORT ENABLED
+#else
+#define HTTP_SERVER_RANGE_SUPPORT DISABLED
+#endif
+
+// Web resources from A/B flash partitions
+#if CONFIG_RES_PARTITION_SUPPORT
+#define RES_PARTITION_SUPPORT ENABLED
+#else
+#define RES_PARTITION_SUPPORT DISABLED
+#endif
+
 #endif
@@ -1,1606 +1,1958 @@
-
-
 #include <stdint.h>
 
-
- const uint8_t res[] =
+const uint8_t res[] =
 {
-    0xD9, 0x63, 0x00, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0E,
-    0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x01, 0x2E, 0x02, 0x38, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x08, 0x74, 0x65, 0x78, 0x74, 0x2E, 0x74, 0x78, 0x74, 0x01, 0x44, 0x00, 0x00, 0x00,
-    0x3B, 0x00, 0x00, 0x00, 0x03, 0x77, 0x77, 0x77, 0x68, 0x6F, 0x6C, 0x61, 0x20, 0x6D, 0x75, 0x6E,
-    0x64, 0x6F, 0x00, 0x00, 0x01, 0x44, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x01, 0x2E, 0x01,
-    0x0E, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x02, 0x2E, 0x2E, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x17, 0x00, 0x00, 0x00, 0x06, 0x61, 0x73, 0x73, 0x65, 0x74, 0x73, 0x02, 0x98, 0x00, 0x00, 0x00,
-    0x41, 0x63, 0x00, 0x00, 0x0A, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x2E, 0x01, 0x44, 0x00, 0x00, 0x00,
-    0x3B, 0x00, 0x00, 0x00, 0x02, 0x2E, 0x2E, 0x00, 0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54, 0x59, 0x50,
-    0x45, 0x20, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A, 0x3C, 0x68, 0x74, 0x6D, 0x6C, 0x20, 0x6C, 0x61,
-    0x6E, 0x67, 0x3D, 0x22, 0x65, 0x73, 0x22, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x6D, 0x65, 0x74, 0x61, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65,
-    0x74, 0x3D, 0x22, 0x55, 0x54, 0x46, 0x2D, 0x38, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x6D, 0x65, 0x74, 0x61, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x22, 0x76, 0x69, 0x65, 0x77, 0x70,
-    0x6F, 0x72, 0x74, 0x22, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3D, 0x22, 0x77, 0x69,
-    0x64, 0x74, 0x68, 0x3D, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68,
-    0x2C, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x61, 0x6C, 0x2D, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x3D,
-    0x31, 0x2E, 0x30, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x74, 0x69, 0x74, 0x6C, 0x65,
-    0x3E, 0x45, 0x53, 0x50, 0x33, 0x32, 0x20, 0x57, 0x69, 0x2D, 0x46, 0x69, 0x20, 0x4D, 0x61, 0x6E,
-    0x61, 0x67, 0x65, 0x72, 0x3C, 0x2F, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3A, 0x72, 0x6F, 0x6F, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x3A, 0x20,
-    0x23, 0x32, 0x35, 0x36, 0x33, 0x65, 0x62, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x62, 0x67, 0x3A, 0x20, 0x23, 0x66, 0x38, 0x66, 0x61,
-    0x66, 0x63, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x2D, 0x2D, 0x63, 0x61, 0x72, 0x64, 0x3A, 0x20, 0x23, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x74,
-    0x65, 0x78, 0x74, 0x3A, 0x20, 0x23, 0x31, 0x65, 0x32, 0x39, 0x33, 0x62, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74,
-    0x2D, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x23, 0x36, 0x34, 0x37, 0x34, 0x38, 0x62, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x62,
-    0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x23, 0x65, 0x32, 0x65, 0x38, 0x66, 0x30, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x73, 0x75,
-    0x63, 0x63, 0x65, 0x73, 0x73, 0x3A, 0x20, 0x23, 0x32, 0x32, 0x63, 0x35, 0x35, 0x65, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x65, 0x72,
-    0x72, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x65, 0x66, 0x34, 0x34, 0x34, 0x34, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x77, 0x61, 0x72, 0x6E,
-    0x69, 0x6E, 0x67, 0x3A, 0x20, 0x23, 0x66, 0x35, 0x39, 0x65, 0x30, 0x62, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x66, 0x61, 0x6D, 0x69, 0x6C, 0x79, 0x3A,
-    0x20, 0x27, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x27, 0x2C, 0x20, 0x73, 0x61, 0x6E, 0x73, 0x2D, 0x73,
-    0x65, 0x72, 0x69, 0x66, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C,
-    0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x67, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
-    0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x2D,
-    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x31, 0x2E, 0x35, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67,
-    0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x63, 0x6F, 0x6E, 0x74,
-    0x61, 0x69, 0x6E, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x78, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x37,
-    0x30, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A, 0x20, 0x32, 0x72, 0x65, 0x6D, 0x20, 0x61,
-    0x75, 0x74, 0x6F, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F,
-    0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x63, 0x61, 0x72, 0x64, 0x29, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64,
-    0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x30, 0x2E, 0x37, 0x35, 0x72,
-    0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x62, 0x6F, 0x78, 0x2D, 0x73, 0x68, 0x61, 0x64, 0x6F, 0x77, 0x3A, 0x20, 0x30, 0x20, 0x31, 0x30,
-    0x70, 0x78, 0x20, 0x31, 0x35, 0x70, 0x78, 0x20, 0x2D, 0x33, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62,
-    0x61, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x31, 0x29, 0x2C,
-    0x20, 0x30, 0x20, 0x34, 0x70, 0x78, 0x20, 0x36, 0x70, 0x78, 0x20, 0x2D, 0x32, 0x70, 0x78, 0x20,
-    0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2E,
-    0x30, 0x35, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x32, 0x72, 0x65, 0x6D, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x61, 0x6C, 0x69,
-    0x67, 0x6E, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62,
-    0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x32, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D,
-    0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69,
-    0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64,
-    0x64, 0x69, 0x6E, 0x67, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x31, 0x72, 0x65,
-    0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x68, 0x31, 0x20,
-    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F,
-    0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20, 0x32, 0x2E, 0x32, 0x35, 0x72, 0x65, 0x6D,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F,
-    0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61,
-    0x72, 0x79, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20,
-    0x30, 0x2E, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65,
-    0x72, 0x20, 0x70, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74,
-    0x65, 0x78, 0x74, 0x2D, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A,
-    0x65, 0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x61, 0x62,
-    0x73, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69,
-    0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x31, 0x2E, 0x35, 0x72, 0x65, 0x6D,
+    0x05, 0x7A, 0x00, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0E,
+    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0x2E, 0x02, 0x4C, 0x00, 0x00, 0x00, 0x9E, 0x00,
+    0x00, 0x00, 0x09, 0x2E, 0x72, 0x65, 0x73, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x02, 0xEC, 0x00, 0x00,
+    0x00, 0x0A, 0x00, 0x00, 0x00, 0x08, 0x74, 0x65, 0x78, 0x74, 0x2E, 0x74, 0x78, 0x74, 0x01, 0xF8,
+    0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x03, 0x77, 0x77, 0x77, 0x00, 0x52, 0x49, 0x44, 0x32,
+    0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x38, 0x53, 0x49, 0x5B, 0x2C, 0x00, 0x00, 0x00,
+    0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x89, 0x41, 0x66, 0xD3, 0x33, 0x64, 0x35,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x15, 0xB6, 0x37, 0x0F, 0x01, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0x66, 0xD5, 0xF6, 0xBA, 0x64, 0x6A, 0x41, 0xE4, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x65, 0x78, 0x74, 0x2E, 0x74, 0x78, 0x74,
+    0x00, 0x77, 0x77, 0x77, 0x2F, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x00,
+    0x01, 0x01, 0x6C, 0x65, 0x00, 0x00, 0x99, 0x14, 0x00, 0x00, 0x00, 0x00, 0x68, 0x6F, 0x6C, 0x61,
+    0x20, 0x6D, 0x75, 0x6E, 0x64, 0x6F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00,
+    0x00, 0x01, 0x2E, 0x01, 0x0E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x02, 0x2E, 0x2E, 0x02,
+    0x24, 0x01, 0x00, 0x00, 0x47, 0x64, 0x00, 0x00, 0x0A, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x2E, 0x68,
+    0x74, 0x6D, 0x6C, 0x00, 0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74,
+    0x6D, 0x6C, 0x3E, 0x0A, 0x3C, 0x68, 0x74, 0x6D, 0x6C, 0x20, 0x6C, 0x61, 0x6E, 0x67, 0x3D, 0x22,
+    0x65, 0x73, 0x22, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x6D, 0x65, 0x74, 0x61, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3D, 0x22, 0x55,
+    0x54, 0x46, 0x2D, 0x38, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6D, 0x65, 0x74, 0x61,
+    0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x22, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6F, 0x72, 0x74, 0x22,
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3D, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D,
+    0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x69, 0x6E,
+    0x69, 0x74, 0x69, 0x61, 0x6C, 0x2D, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x3D, 0x31, 0x2E, 0x30, 0x22,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x45, 0x53, 0x50,
+    0x33, 0x32, 0x20, 0x57, 0x69, 0x2D, 0x46, 0x69, 0x20, 0x4D, 0x61, 0x6E, 0x61, 0x67, 0x65, 0x72,
+    0x3C, 0x2F, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74,
+    0x79, 0x6C, 0x65, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x72, 0x6F,
+    0x6F, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x3A, 0x20, 0x23, 0x32, 0x35, 0x36,
+    0x33, 0x65, 0x62, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x2D, 0x2D, 0x62, 0x67, 0x3A, 0x20, 0x23, 0x66, 0x38, 0x66, 0x61, 0x66, 0x63, 0x3B, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x63, 0x61,
+    0x72, 0x64, 0x3A, 0x20, 0x23, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3B, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x3A,
+    0x20, 0x23, 0x31, 0x65, 0x32, 0x39, 0x33, 0x62, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x6C, 0x69, 0x67,
+    0x68, 0x74, 0x3A, 0x20, 0x23, 0x36, 0x34, 0x37, 0x34, 0x38, 0x62, 0x3B, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65,
+    0x72, 0x3A, 0x20, 0x23, 0x65, 0x32, 0x65, 0x38, 0x66, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73,
+    0x73, 0x3A, 0x20, 0x23, 0x32, 0x32, 0x63, 0x35, 0x35, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x3A,
+    0x20, 0x23, 0x65, 0x66, 0x34, 0x34, 0x34, 0x34, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x77, 0x61, 0x72, 0x6E, 0x69, 0x6E, 0x67, 0x3A,
+    0x20, 0x23, 0x66, 0x35, 0x39, 0x65, 0x30, 0x62, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x64,
+    0x79, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x66, 0x61, 0x6D, 0x69, 0x6C, 0x79, 0x3A, 0x20, 0x27, 0x49, 0x6E,
+    0x74, 0x65, 0x72, 0x27, 0x2C, 0x20, 0x73, 0x61, 0x6E, 0x73, 0x2D, 0x73, 0x65, 0x72, 0x69, 0x66,
     0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61,
     0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20,
     0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x67, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61,
-    0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x30, 0x2E, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E,
-    0x67, 0x3A, 0x20, 0x30, 0x2E, 0x32, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x78, 0x2D, 0x73, 0x68, 0x61, 0x64,
-    0x6F, 0x77, 0x3A, 0x20, 0x69, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x30, 0x20, 0x31, 0x70, 0x78, 0x20,
-    0x32, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30,
-    0x2C, 0x20, 0x30, 0x2E, 0x30, 0x35, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x61, 0x62,
-    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
-    0x6C, 0x65, 0x78, 0x3A, 0x20, 0x31, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x30, 0x2E, 0x37,
-    0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x3A, 0x20, 0x63, 0x65,
-    0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6F, 0x72, 0x3A, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65,
-    0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
-    0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x30, 0x2E,
-    0x33, 0x37, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20,
-    0x61, 0x6C, 0x6C, 0x20, 0x30, 0x2E, 0x32, 0x73, 0x20, 0x65, 0x61, 0x73, 0x65, 0x2D, 0x69, 0x6E,
-    0x2D, 0x6F, 0x75, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x35,
-    0x30, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65, 0x78,
-    0x74, 0x2D, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x73, 0x65, 0x72, 0x2D, 0x73, 0x65, 0x6C, 0x65, 0x63,
-    0x74, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x61, 0x62,
-    0x3A, 0x68, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D,
-    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x6F, 0x72,
-    0x64, 0x65, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x61, 0x62, 0x2E, 0x61, 0x63,
-    0x74, 0x69, 0x76, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F,
-    0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x63, 0x61, 0x72, 0x64, 0x29,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F,
-    0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61,
-    0x72, 0x79, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x62, 0x6F, 0x78, 0x2D, 0x73, 0x68, 0x61, 0x64, 0x6F, 0x77, 0x3A, 0x20, 0x30, 0x20, 0x31,
-    0x70, 0x78, 0x20, 0x33, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2C, 0x20, 0x30,
-    0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x31, 0x29, 0x2C, 0x20, 0x30, 0x20, 0x31, 0x70, 0x78,
-    0x20, 0x32, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20,
-    0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x36, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x61,
-    0x62, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A,
-    0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D,
-    0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x61, 0x62, 0x2D, 0x63, 0x6F, 0x6E, 0x74,
-    0x65, 0x6E, 0x74, 0x2E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79,
-    0x3A, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x63, 0x61, 0x72,
-    0x64, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28,
-    0x2D, 0x2D, 0x63, 0x61, 0x72, 0x64, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69,
-    0x75, 0x73, 0x3A, 0x20, 0x30, 0x2E, 0x37, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A,
-    0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D,
-    0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x78, 0x2D, 0x73, 0x68, 0x61, 0x64, 0x6F, 0x77,
-    0x3A, 0x20, 0x30, 0x20, 0x31, 0x70, 0x78, 0x20, 0x33, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61,
-    0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x31, 0x29, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64,
-    0x69, 0x6E, 0x67, 0x3A, 0x20, 0x31, 0x2E, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D,
-    0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x31, 0x2E, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x68, 0x33, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D,
-    0x2D, 0x74, 0x65, 0x78, 0x74, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20, 0x31,
-    0x2E, 0x32, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61,
+    0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x2D, 0x68, 0x65, 0x69, 0x67,
+    0x68, 0x74, 0x3A, 0x20, 0x31, 0x2E, 0x35, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x31, 0x72,
+    0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x65,
+    0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x6D, 0x61, 0x78, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x37, 0x30, 0x30, 0x70, 0x78,
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61,
+    0x72, 0x67, 0x69, 0x6E, 0x3A, 0x20, 0x32, 0x72, 0x65, 0x6D, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x3B,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63,
+    0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76,
+    0x61, 0x72, 0x28, 0x2D, 0x2D, 0x63, 0x61, 0x72, 0x64, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72,
+    0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x30, 0x2E, 0x37, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x78, 0x2D,
+    0x73, 0x68, 0x61, 0x64, 0x6F, 0x77, 0x3A, 0x20, 0x30, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x31,
+    0x35, 0x70, 0x78, 0x20, 0x2D, 0x33, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2C,
+    0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x31, 0x29, 0x2C, 0x20, 0x30, 0x20, 0x34,
+    0x70, 0x78, 0x20, 0x36, 0x70, 0x78, 0x20, 0x2D, 0x32, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61,
+    0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x35, 0x29, 0x3B,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64,
+    0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x32, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68,
+    0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x3A, 0x20,
+    0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F,
-    0x6D, 0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x66, 0x6F, 0x72,
-    0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74,
-    0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x61,
-    0x62, 0x65, 0x6C, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F,
-    0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20, 0x30, 0x2E, 0x38, 0x37, 0x35, 0x72, 0x65,
-    0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
-    0x6F, 0x6E, 0x74, 0x2D, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x35, 0x30, 0x30, 0x3B,
+    0x6D, 0x3A, 0x20, 0x32, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x62, 0x6F, 0x74, 0x74,
+    0x6F, 0x6D, 0x3A, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61,
+    0x72, 0x28, 0x2D, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67,
+    0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x68, 0x31, 0x20, 0x7B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73,
+    0x69, 0x7A, 0x65, 0x3A, 0x20, 0x32, 0x2E, 0x32, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
+    0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x29, 0x3B,
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72,
-    0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x30, 0x2E, 0x32, 0x35,
-    0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65,
-    0x78, 0x74, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x5B, 0x74, 0x79,
-    0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22,
-    0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x22, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22,
-    0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x31, 0x30,
-    0x30, 0x25, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x30, 0x2E, 0x37, 0x35, 0x72, 0x65, 0x6D,
-    0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73,
-    0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65,
-    0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x30,
-    0x2E, 0x33, 0x37, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20,
-    0x31, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C,
-    0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x67, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
-    0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73,
-    0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F,
-    0x6C, 0x6F, 0x72, 0x20, 0x30, 0x2E, 0x32, 0x73, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x70,
-    0x75, 0x74, 0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x5D, 0x3A,
-    0x66, 0x6F, 0x63, 0x75, 0x73, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
-    0x6E, 0x70, 0x75, 0x74, 0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x70, 0x61, 0x73, 0x73, 0x77,
-    0x6F, 0x72, 0x64, 0x22, 0x5D, 0x3A, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x2C, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D,
-    0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x5D, 0x3A, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x2C,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x3A,
-    0x66, 0x6F, 0x63, 0x75, 0x73, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x6F, 0x75, 0x74, 0x6C, 0x69, 0x6E, 0x65, 0x3A, 0x20, 0x6E, 0x6F, 0x6E,
-    0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
-    0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72,
-    0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x78, 0x2D, 0x73, 0x68, 0x61,
-    0x64, 0x6F, 0x77, 0x3A, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x70, 0x78, 0x20, 0x72,
-    0x67, 0x62, 0x61, 0x28, 0x33, 0x37, 0x2C, 0x20, 0x39, 0x39, 0x2C, 0x20, 0x32, 0x33, 0x35, 0x2C,
-    0x20, 0x30, 0x2E, 0x32, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D,
-    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x5B,
-    0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x5D,
-    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D,
-    0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x30, 0x2E, 0x35,
+    0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x30, 0x2E, 0x35, 0x72,
+    0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x70, 0x20,
+    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F,
+    0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x2D,
+    0x6C, 0x69, 0x67, 0x68, 0x74, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20, 0x31,
     0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x72, 0x6F, 0x77, 0x20, 0x7B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C,
-    0x61, 0x79, 0x3A, 0x20, 0x67, 0x72, 0x69, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x72, 0x69, 0x64, 0x2D, 0x74, 0x65, 0x6D, 0x70, 0x6C,
-    0x61, 0x74, 0x65, 0x2D, 0x63, 0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x73, 0x3A, 0x20, 0x31, 0x66, 0x72,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x61,
-    0x70, 0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x6D, 0x65, 0x64,
-    0x69, 0x61, 0x20, 0x28, 0x6D, 0x69, 0x6E, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x36,
-    0x30, 0x30, 0x70, 0x78, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x2E, 0x72, 0x6F, 0x77, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x72, 0x69, 0x64, 0x2D,
-    0x74, 0x65, 0x6D, 0x70, 0x6C, 0x61, 0x74, 0x65, 0x2D, 0x63, 0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x73,
-    0x3A, 0x20, 0x31, 0x66, 0x72, 0x20, 0x31, 0x66, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x74, 0x74,
-    0x6F, 0x6E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E,
-    0x67, 0x3A, 0x20, 0x30, 0x2E, 0x37, 0x35, 0x72, 0x65, 0x6D, 0x20, 0x31, 0x2E, 0x35, 0x72, 0x65,
-    0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x61, 0x62, 0x73, 0x20, 0x7B, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70,
+    0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F,
+    0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x31, 0x2E, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72,
+    0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28,
+    0x2D, 0x2D, 0x62, 0x67, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73,
+    0x3A, 0x20, 0x30, 0x2E, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x30,
+    0x2E, 0x32, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x78, 0x2D, 0x73, 0x68, 0x61, 0x64, 0x6F, 0x77, 0x3A, 0x20,
+    0x69, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x30, 0x20, 0x31, 0x70, 0x78, 0x20, 0x32, 0x70, 0x78, 0x20,
+    0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2E,
+    0x30, 0x35, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x61, 0x62, 0x20, 0x7B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3A,
+    0x20, 0x31, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x30, 0x2E, 0x37, 0x35, 0x72, 0x65, 0x6D,
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65,
+    0x78, 0x74, 0x2D, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72,
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75,
+    0x72, 0x73, 0x6F, 0x72, 0x3A, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65,
+    0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x30, 0x2E, 0x33, 0x37, 0x35, 0x72,
+    0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x61, 0x6C, 0x6C, 0x20,
+    0x30, 0x2E, 0x32, 0x73, 0x20, 0x65, 0x61, 0x73, 0x65, 0x2D, 0x69, 0x6E, 0x2D, 0x6F, 0x75, 0x74,
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F,
+    0x6E, 0x74, 0x2D, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x35, 0x30, 0x30, 0x3B, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F,
+    0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x6C, 0x69,
+    0x67, 0x68, 0x74, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x75, 0x73, 0x65, 0x72, 0x2D, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x3A, 0x20, 0x6E,
+    0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x61, 0x62, 0x3A, 0x68, 0x6F, 0x76,
+    0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F,
+    0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x29,
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x61, 0x62, 0x2E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65,
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
     0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
+    0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x63, 0x61, 0x72, 0x64, 0x29, 0x3B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
     0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C,
-    0x6F, 0x72, 0x3A, 0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x6E,
-    0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x78,
+    0x2D, 0x73, 0x68, 0x61, 0x64, 0x6F, 0x77, 0x3A, 0x20, 0x30, 0x20, 0x31, 0x70, 0x78, 0x20, 0x33,
+    0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C,
+    0x20, 0x30, 0x2E, 0x31, 0x29, 0x2C, 0x20, 0x30, 0x20, 0x31, 0x70, 0x78, 0x20, 0x32, 0x70, 0x78,
+    0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30,
+    0x2E, 0x30, 0x36, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x61, 0x62, 0x2D, 0x63, 0x6F,
+    0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x6E, 0x6F, 0x6E,
+    0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70,
+    0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D, 0x20, 0x30, 0x3B, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x2E, 0x74, 0x61, 0x62, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2E,
+    0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x62, 0x6C,
+    0x6F, 0x63, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x63, 0x61, 0x72, 0x64, 0x20, 0x7B, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B,
+    0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x63, 0x61,
+    0x72, 0x64, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20,
-    0x30, 0x2E, 0x33, 0x37, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x77, 0x65, 0x69, 0x67, 0x68,
-    0x74, 0x3A, 0x20, 0x36, 0x30, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6F, 0x72, 0x3A, 0x20, 0x70, 0x6F, 0x69, 0x6E,
-    0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x62, 0x61, 0x63,
-    0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x30, 0x2E,
-    0x32, 0x73, 0x20, 0x65, 0x61, 0x73, 0x65, 0x2D, 0x69, 0x6E, 0x2D, 0x6F, 0x75, 0x74, 0x2C, 0x20,
-    0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x30, 0x2E, 0x31, 0x73, 0x20, 0x65,
-    0x61, 0x73, 0x65, 0x2D, 0x69, 0x6E, 0x2D, 0x6F, 0x75, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x74,
-    0x6F, 0x70, 0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x74,
-    0x74, 0x6F, 0x6E, 0x3A, 0x68, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75,
-    0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x31, 0x65, 0x34, 0x30, 0x61,
-    0x66, 0x3B, 0x20, 0x2F, 0x2A, 0x20, 0x44, 0x61, 0x72, 0x6B, 0x65, 0x72, 0x20, 0x70, 0x72, 0x69,
-    0x6D, 0x61, 0x72, 0x79, 0x20, 0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x20, 0x74,
-    0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x59, 0x28, 0x2D, 0x31, 0x70, 0x78, 0x29, 0x3B,
+    0x30, 0x2E, 0x37, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x31, 0x70, 0x78,
+    0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x6F, 0x72,
+    0x64, 0x65, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x62, 0x6F, 0x78, 0x2D, 0x73, 0x68, 0x61, 0x64, 0x6F, 0x77, 0x3A, 0x20, 0x30, 0x20,
+    0x31, 0x70, 0x78, 0x20, 0x33, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2C, 0x20,
+    0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x31, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A,
+    0x20, 0x31, 0x2E, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74,
+    0x6F, 0x6D, 0x3A, 0x20, 0x31, 0x2E, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68,
+    0x33, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65, 0x78,
+    0x74, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20, 0x31, 0x2E, 0x32, 0x35, 0x72,
+    0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x31,
+    0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72,
+    0x6F, 0x75, 0x70, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A,
+    0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D,
+    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20,
+    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69,
+    0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x3B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73,
+    0x69, 0x7A, 0x65, 0x3A, 0x20, 0x30, 0x2E, 0x38, 0x37, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D,
+    0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x35, 0x30, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D,
+    0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x30, 0x2E, 0x32, 0x35, 0x72, 0x65, 0x6D, 0x3B,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C,
+    0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x29, 0x3B,
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3A, 0x64, 0x69, 0x73, 0x61, 0x62,
-    0x6C, 0x65, 0x64, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3A, 0x20, 0x30, 0x2E, 0x36, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73,
-    0x6F, 0x72, 0x3A, 0x20, 0x6E, 0x6F, 0x74, 0x2D, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x65, 0x64, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63,
-    0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76,
-    0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73,
-    0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
-    0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2E, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x61, 0x72, 0x79, 0x20,
-    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61,
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22,
+    0x74, 0x65, 0x78, 0x74, 0x22, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x69, 0x6E, 0x70, 0x75, 0x74, 0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x70, 0x61, 0x73, 0x73,
+    0x77, 0x6F, 0x72, 0x64, 0x22, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x69, 0x6E, 0x70, 0x75, 0x74, 0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x6E, 0x75, 0x6D, 0x62,
+    0x65, 0x72, 0x22, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65,
+    0x6C, 0x65, 0x63, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3B, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64,
+    0x69, 0x6E, 0x67, 0x3A, 0x20, 0x30, 0x2E, 0x37, 0x35, 0x72, 0x65, 0x6D, 0x20, 0x31, 0x72, 0x65,
+    0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
+    0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64,
+    0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x29, 0x3B, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64,
+    0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x30, 0x2E, 0x33, 0x37, 0x35,
+    0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D,
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61,
     0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20,
-    0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x6C, 0x69, 0x67, 0x68, 0x74,
+    0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x67, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61,
+    0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F,
+    0x6E, 0x3A, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20,
+    0x30, 0x2E, 0x32, 0x73, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x5B, 0x74,
+    0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x5D, 0x3A, 0x66, 0x6F, 0x63, 0x75,
+    0x73, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74,
+    0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x22,
+    0x5D, 0x3A, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x6E, 0x75, 0x6D,
+    0x62, 0x65, 0x72, 0x22, 0x5D, 0x3A, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x2C, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x3A, 0x66, 0x6F, 0x63, 0x75,
+    0x73, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x6F, 0x75, 0x74, 0x6C, 0x69, 0x6E, 0x65, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65,
+    0x72, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70,
+    0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x78, 0x2D, 0x73, 0x68, 0x61, 0x64, 0x6F, 0x77, 0x3A,
+    0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28,
+    0x33, 0x37, 0x2C, 0x20, 0x39, 0x39, 0x2C, 0x20, 0x32, 0x33, 0x35, 0x2C, 0x20, 0x30, 0x2E, 0x32,
     0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2E, 0x73, 0x65, 0x63,
-    0x6F, 0x6E, 0x64, 0x61, 0x72, 0x79, 0x3A, 0x68, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x5B, 0x74, 0x79, 0x70, 0x65,
+    0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x5D, 0x20, 0x7B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69,
+    0x6E, 0x2D, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x30, 0x2E, 0x35, 0x72, 0x65, 0x6D, 0x3B,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x2E, 0x72, 0x6F, 0x77, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20,
+    0x67, 0x72, 0x69, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x67, 0x72, 0x69, 0x64, 0x2D, 0x74, 0x65, 0x6D, 0x70, 0x6C, 0x61, 0x74, 0x65, 0x2D,
+    0x63, 0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x73, 0x3A, 0x20, 0x31, 0x66, 0x72, 0x3B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3A, 0x20, 0x31,
+    0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x20, 0x28,
+    0x6D, 0x69, 0x6E, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x36, 0x30, 0x30, 0x70, 0x78,
+    0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x2E, 0x72, 0x6F, 0x77, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x72, 0x69, 0x64, 0x2D, 0x74, 0x65, 0x6D, 0x70,
+    0x6C, 0x61, 0x74, 0x65, 0x2D, 0x63, 0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x73, 0x3A, 0x20, 0x31, 0x66,
+    0x72, 0x20, 0x31, 0x66, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x7B,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64,
+    0x74, 0x68, 0x3A, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x30,
+    0x2E, 0x37, 0x35, 0x72, 0x65, 0x6D, 0x20, 0x31, 0x2E, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67,
-    0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x34, 0x62,
-    0x35, 0x35, 0x36, 0x33, 0x3B, 0x20, 0x2F, 0x2A, 0x20, 0x44, 0x61, 0x72, 0x6B, 0x65, 0x72, 0x20,
-    0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x61, 0x72, 0x79, 0x20, 0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20,
+    0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72,
+    0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20,
+    0x77, 0x68, 0x69, 0x74, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72,
+    0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x30, 0x2E, 0x33, 0x37,
+    0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x36,
+    0x30, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x63, 0x75, 0x72, 0x73, 0x6F, 0x72, 0x3A, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x3B,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61,
+    0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F,
+    0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x30, 0x2E, 0x32, 0x73, 0x20, 0x65,
+    0x61, 0x73, 0x65, 0x2D, 0x69, 0x6E, 0x2D, 0x6F, 0x75, 0x74, 0x2C, 0x20, 0x74, 0x72, 0x61, 0x6E,
+    0x73, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x30, 0x2E, 0x31, 0x73, 0x20, 0x65, 0x61, 0x73, 0x65, 0x2D,
+    0x69, 0x6E, 0x2D, 0x6F, 0x75, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x74, 0x6F, 0x70, 0x3A, 0x20,
+    0x31, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3A,
+    0x68, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63,
+    0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x31, 0x65, 0x34, 0x30, 0x61, 0x66, 0x3B, 0x20, 0x2F,
+    0x2A, 0x20, 0x44, 0x61, 0x72, 0x6B, 0x65, 0x72, 0x20, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79,
+    0x20, 0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73,
+    0x6C, 0x61, 0x74, 0x65, 0x59, 0x28, 0x2D, 0x31, 0x70, 0x78, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x2E, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2D, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x7B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67,
-    0x69, 0x6E, 0x2D, 0x74, 0x6F, 0x70, 0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72,
-    0x3A, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28,
-    0x2D, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61,
-    0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x30, 0x2E, 0x33, 0x37, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x78, 0x2D,
-    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x32, 0x35, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x66,
-    0x6C, 0x6F, 0x77, 0x2D, 0x79, 0x3A, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x3B, 0x0A, 0x20, 0x20, 0x20,
+    0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3A, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20,
+    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x70,
+    0x61, 0x63, 0x69, 0x74, 0x79, 0x3A, 0x20, 0x30, 0x2E, 0x36, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6F, 0x72, 0x3A, 0x20,
+    0x6E, 0x6F, 0x74, 0x2D, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F,
     0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D,
-    0x2D, 0x62, 0x67, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72,
-    0x6B, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x30, 0x2E,
-    0x37, 0x35, 0x72, 0x65, 0x6D, 0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x62,
-    0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64,
-    0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x29, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73,
-    0x6F, 0x72, 0x3A, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79,
-    0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2D, 0x63, 0x6F, 0x6E, 0x74,
-    0x65, 0x6E, 0x74, 0x3A, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x2D, 0x62, 0x65, 0x74, 0x77, 0x65,
-    0x65, 0x6E, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x3A, 0x20, 0x63, 0x65, 0x6E,
-    0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x62, 0x61, 0x63,
-    0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x30, 0x2E,
-    0x31, 0x73, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2D,
-    0x69, 0x74, 0x65, 0x6D, 0x3A, 0x6C, 0x61, 0x73, 0x74, 0x2D, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x20,
-    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F,
-    0x72, 0x64, 0x65, 0x72, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x6E, 0x6F, 0x6E,
-    0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2D, 0x69,
-    0x74, 0x65, 0x6D, 0x3A, 0x68, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75,
-    0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D,
-    0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D,
+    0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F,
+    0x6E, 0x2E, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x61, 0x72, 0x79, 0x20, 0x7B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72,
+    0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28,
+    0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x29, 0x3B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2E, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x61,
+    0x72, 0x79, 0x3A, 0x68, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E,
+    0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x34, 0x62, 0x35, 0x35, 0x36, 0x33,
+    0x3B, 0x20, 0x2F, 0x2A, 0x20, 0x44, 0x61, 0x72, 0x6B, 0x65, 0x72, 0x20, 0x73, 0x65, 0x63, 0x6F,
+    0x6E, 0x64, 0x61, 0x72, 0x79, 0x20, 0x2A, 0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x6E, 0x65, 0x74,
-    0x77, 0x6F, 0x72, 0x6B, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x73, 0x70, 0x61, 0x6E, 0x3A, 0x66,
-    0x69, 0x72, 0x73, 0x74, 0x2D, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x77, 0x65,
-    0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x35, 0x30, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x6E,
-    0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x73, 0x70, 0x61, 0x6E,
+    0x77, 0x6F, 0x72, 0x6B, 0x2D, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x74,
+    0x6F, 0x70, 0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x31, 0x70,
+    0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x6F,
+    0x72, 0x64, 0x65, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73,
+    0x3A, 0x20, 0x30, 0x2E, 0x33, 0x37, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x78, 0x2D, 0x68, 0x65, 0x69, 0x67,
+    0x68, 0x74, 0x3A, 0x20, 0x32, 0x35, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x2D,
+    0x79, 0x3A, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D,
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x67, 0x29,
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2D, 0x69, 0x74,
+    0x65, 0x6D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x30, 0x2E, 0x37, 0x35, 0x72, 0x65,
+    0x6D, 0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F,
+    0x6D, 0x3A, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72,
+    0x28, 0x2D, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6F, 0x72, 0x3A, 0x20,
+    0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C,
+    0x65, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x6A, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3A,
+    0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x2D, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x3B, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x69, 0x67,
+    0x6E, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61,
+    0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F,
+    0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x30, 0x2E, 0x31, 0x73, 0x3B, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x2E, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2D, 0x69, 0x74, 0x65, 0x6D,
     0x3A, 0x6C, 0x61, 0x73, 0x74, 0x2D, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x20, 0x7B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73,
-    0x69, 0x7A, 0x65, 0x3A, 0x20, 0x30, 0x2E, 0x38, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20,
-    0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x6C, 0x69, 0x67, 0x68, 0x74,
-    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x74, 0x6F, 0x61, 0x73, 0x74, 0x20, 0x7B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74,
-    0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x66, 0x69, 0x78, 0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20,
-    0x32, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x6C, 0x65, 0x66, 0x74, 0x3A, 0x20, 0x35, 0x30, 0x25, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F,
-    0x72, 0x6D, 0x3A, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x58, 0x28, 0x2D,
-    0x35, 0x30, 0x25, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x30, 0x2E, 0x37, 0x35, 0x72,
-    0x65, 0x6D, 0x20, 0x31, 0x2E, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61,
-    0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x30, 0x2E, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-    0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A,
-    0x20, 0x35, 0x30, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6E, 0x69,
-    0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x73, 0x6C, 0x69, 0x64, 0x65, 0x55, 0x70, 0x20,
-    0x30, 0x2E, 0x33, 0x73, 0x20, 0x65, 0x61, 0x73, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7A, 0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x3A, 0x20,
-    0x31, 0x30, 0x30, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x74, 0x6F, 0x61, 0x73, 0x74, 0x2E,
-    0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x7B, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72,
-    0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28,
-    0x2D, 0x2D, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x29, 0x3B, 0x20, 0x7D, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x74, 0x6F, 0x61, 0x73, 0x74, 0x2E, 0x65, 0x72, 0x72,
-    0x6F, 0x72, 0x20, 0x7B, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D,
-    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x65, 0x72, 0x72,
-    0x6F, 0x72, 0x29, 0x3B, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23,
-    0x74, 0x6F, 0x61, 0x73, 0x74, 0x2E, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x7B, 0x20,
-    0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
-    0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x77, 0x61, 0x72, 0x6E, 0x69, 0x6E, 0x67, 0x29,
-    0x3B, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x6B, 0x65,
-    0x79, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x20, 0x73, 0x6C, 0x69, 0x64, 0x65, 0x55, 0x70, 0x20,
-    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x72,
-    0x6F, 0x6D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72,
+    0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x2E, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x3A,
+    0x68, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63,
+    0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x6F, 0x72, 0x64,
+    0x65, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B,
+    0x2D, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x73, 0x70, 0x61, 0x6E, 0x3A, 0x66, 0x69, 0x72, 0x73, 0x74,
+    0x2D, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74,
+    0x3A, 0x20, 0x35, 0x30, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D,
+    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x6E, 0x65, 0x74, 0x77, 0x6F,
+    0x72, 0x6B, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x73, 0x70, 0x61, 0x6E, 0x3A, 0x6C, 0x61, 0x73,
+    0x74, 0x2D, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A,
+    0x20, 0x30, 0x2E, 0x38, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28,
+    0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x29, 0x3B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x23, 0x74, 0x6F, 0x61, 0x73, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A,
+    0x20, 0x66, 0x69, 0x78, 0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x32, 0x72, 0x65, 0x6D,
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x65,
+    0x66, 0x74, 0x3A, 0x20, 0x35, 0x30, 0x25, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x20,
-    0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x28, 0x2D, 0x35, 0x30, 0x25, 0x2C, 0x20,
-    0x31, 0x30, 0x30, 0x25, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3A, 0x20,
-    0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x20,
-    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x20, 0x74, 0x72, 0x61,
-    0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x28, 0x2D, 0x35, 0x30, 0x25, 0x2C, 0x20, 0x30, 0x29, 0x3B,
+    0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x58, 0x28, 0x2D, 0x35, 0x30, 0x25, 0x29,
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61,
+    0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x30, 0x2E, 0x37, 0x35, 0x72, 0x65, 0x6D, 0x20, 0x31,
+    0x2E, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73,
+    0x3A, 0x20, 0x30, 0x2E, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x77, 0x68, 0x69,
+    0x74, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x35, 0x30, 0x30,
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69,
+    0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6E, 0x69, 0x6D, 0x61, 0x74, 0x69,
+    0x6F, 0x6E, 0x3A, 0x20, 0x73, 0x6C, 0x69, 0x64, 0x65, 0x55, 0x70, 0x20, 0x30, 0x2E, 0x33, 0x73,
+    0x20, 0x65, 0x61, 0x73, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x7A, 0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x3A, 0x20, 0x31, 0x30, 0x30, 0x30,
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x74, 0x6F, 0x61, 0x73, 0x74, 0x2E, 0x73, 0x75, 0x63, 0x63,
+    0x65, 0x73, 0x73, 0x20, 0x7B, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64,
+    0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x73, 0x75,
+    0x63, 0x63, 0x65, 0x73, 0x73, 0x29, 0x3B, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x23, 0x74, 0x6F, 0x61, 0x73, 0x74, 0x2E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x7B,
+    0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F,
+    0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x3B,
+    0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x74, 0x6F, 0x61, 0x73,
+    0x74, 0x2E, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x7B, 0x20, 0x62, 0x61, 0x63, 0x6B,
+    0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61,
+    0x72, 0x28, 0x2D, 0x2D, 0x77, 0x61, 0x72, 0x6E, 0x69, 0x6E, 0x67, 0x29, 0x3B, 0x20, 0x7D, 0x0A,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x6B, 0x65, 0x79, 0x66, 0x72, 0x61,
+    0x6D, 0x65, 0x73, 0x20, 0x73, 0x6C, 0x69, 0x64, 0x65, 0x55, 0x70, 0x20, 0x7B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x7B,
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3A, 0x20, 0x31, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x74, 0x79, 0x6C, 0x65,
-    0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x0A, 0x3C, 0x62, 0x6F, 0x64, 0x79, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
-    0x22, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x65, 0x72, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x31, 0x3E, 0xF0, 0x9F,
-    0x93, 0xA1, 0x20, 0x45, 0x53, 0x50, 0x33, 0x32, 0x20, 0x57, 0x69, 0x2D, 0x46, 0x69, 0x20, 0x4D,
-    0x61, 0x6E, 0x61, 0x67, 0x65, 0x72, 0x3C, 0x2F, 0x68, 0x31, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x70, 0x3E, 0x43, 0x6F, 0x6E, 0x66, 0x69,
-    0x67, 0x75, 0x72, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x61, 0x76, 0x61, 0x6E, 0x7A, 0x61,
-    0x64, 0x61, 0x20, 0x64, 0x65, 0x20, 0x72, 0x65, 0x64, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3E, 0x0A,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C,
-    0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x61, 0x62, 0x73, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61,
-    0x73, 0x73, 0x3D, 0x22, 0x74, 0x61, 0x62, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x22, 0x20,
-    0x64, 0x61, 0x74, 0x61, 0x2D, 0x74, 0x61, 0x62, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
-    0x22, 0x3E, 0x45, 0x73, 0x74, 0x61, 0x64, 0x6F, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20,
-    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x61, 0x62, 0x22, 0x20, 0x64, 0x61, 0x74, 0x61,
-    0x2D, 0x74, 0x61, 0x62, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x22, 0x3E, 0x45, 0x73, 0x74, 0x61, 0x63,
-    0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x28, 0x53, 0x54, 0x41, 0x29, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69,
-    0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x61, 0x62, 0x22, 0x20, 0x64, 0x61,
-    0x74, 0x61, 0x2D, 0x74, 0x61, 0x62, 0x3D, 0x22, 0x61, 0x70, 0x22, 0x3E, 0x50, 0x75, 0x6E, 0x74,
-    0x6F, 0x20, 0x64, 0x65, 0x20, 0x41, 0x63, 0x63, 0x65, 0x73, 0x6F, 0x20, 0x28, 0x41, 0x50, 0x29,
-    0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74,
-    0x61, 0x62, 0x22, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2D, 0x74, 0x61, 0x62, 0x3D, 0x22, 0x67, 0x65,
-    0x6E, 0x65, 0x72, 0x61, 0x6C, 0x22, 0x3E, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C, 0x3C, 0x2F,
-    0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64,
-    0x69, 0x76, 0x3E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x21, 0x2D,
-    0x2D, 0x20, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E,
-    0x67, 0x73, 0x20, 0x54, 0x61, 0x62, 0x20, 0x2D, 0x2D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x67, 0x65, 0x6E, 0x65,
-    0x72, 0x61, 0x6C, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x61, 0x62, 0x2D,
-    0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73,
-    0x3D, 0x22, 0x63, 0x61, 0x72, 0x64, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x33, 0x3E, 0x4D, 0x6F, 0x64,
-    0x6F, 0x20, 0x64, 0x65, 0x20, 0x4F, 0x70, 0x65, 0x72, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20,
-    0x57, 0x69, 0x2D, 0x46, 0x69, 0x3C, 0x2F, 0x68, 0x33, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20,
-    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75,
-    0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66,
-    0x6F, 0x72, 0x3D, 0x22, 0x77, 0x69, 0x66, 0x69, 0x4D, 0x6F, 0x64, 0x65, 0x22, 0x3E, 0x53, 0x65,
-    0x6C, 0x65, 0x63, 0x63, 0x69, 0x6F, 0x6E, 0x61, 0x72, 0x20, 0x4D, 0x6F, 0x64, 0x6F, 0x3A, 0x3C,
-    0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x65, 0x6C,
-    0x65, 0x63, 0x74, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x77, 0x69, 0x66, 0x69, 0x4D, 0x6F, 0x64, 0x65,
-    0x22, 0x20, 0x6F, 0x6E, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x3D, 0x22, 0x75, 0x70, 0x64, 0x61,
-    0x74, 0x65, 0x4D, 0x6F, 0x64, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x28, 0x29, 0x22, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76,
-    0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x30, 0x22, 0x3E, 0x41, 0x70, 0x61, 0x67, 0x61, 0x64, 0x6F,
-    0x20, 0x28, 0x4F, 0x46, 0x46, 0x29, 0x3C, 0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0A,
+    0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x20, 0x74, 0x72, 0x61, 0x6E,
+    0x73, 0x6C, 0x61, 0x74, 0x65, 0x28, 0x2D, 0x35, 0x30, 0x25, 0x2C, 0x20, 0x31, 0x30, 0x30, 0x25,
+    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x20, 0x7B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72,
+    0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61,
+    0x74, 0x65, 0x28, 0x2D, 0x35, 0x30, 0x25, 0x2C, 0x20, 0x30, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x70, 0x61,
+    0x63, 0x69, 0x74, 0x79, 0x3A, 0x20, 0x31, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3E, 0x0A, 0x3C, 0x2F,
+    0x68, 0x65, 0x61, 0x64, 0x3E, 0x0A, 0x3C, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x6F, 0x6E,
+    0x74, 0x61, 0x69, 0x6E, 0x65, 0x72, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x31, 0x3E, 0xF0, 0x9F, 0x93, 0xA1, 0x20, 0x45,
+    0x53, 0x50, 0x33, 0x32, 0x20, 0x57, 0x69, 0x2D, 0x46, 0x69, 0x20, 0x4D, 0x61, 0x6E, 0x61, 0x67,
+    0x65, 0x72, 0x3C, 0x2F, 0x68, 0x31, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x70, 0x3E, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61,
+    0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x61, 0x76, 0x61, 0x6E, 0x7A, 0x61, 0x64, 0x61, 0x20, 0x64,
+    0x65, 0x20, 0x72, 0x65, 0x64, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3E, 0x0A, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
+    0x22, 0x74, 0x61, 0x62, 0x73, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
+    0x74, 0x61, 0x62, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x22, 0x20, 0x64, 0x61, 0x74, 0x61,
+    0x2D, 0x74, 0x61, 0x62, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22, 0x3E, 0x45, 0x73,
+    0x74, 0x61, 0x64, 0x6F, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73,
+    0x73, 0x3D, 0x22, 0x74, 0x61, 0x62, 0x22, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2D, 0x74, 0x61, 0x62,
+    0x3D, 0x22, 0x73, 0x74, 0x61, 0x22, 0x3E, 0x45, 0x73, 0x74, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E,
+    0x20, 0x28, 0x53, 0x54, 0x41, 0x29, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C,
+    0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x61, 0x62, 0x22, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2D, 0x74,
+    0x61, 0x62, 0x3D, 0x22, 0x61, 0x70, 0x22, 0x3E, 0x50, 0x75, 0x6E, 0x74, 0x6F, 0x20, 0x64, 0x65,
+    0x20, 0x41, 0x63, 0x63, 0x65, 0x73, 0x6F, 0x20, 0x28, 0x41, 0x50, 0x29, 0x3C, 0x2F, 0x64, 0x69,
+    0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x61, 0x62, 0x22, 0x20,
+    0x64, 0x61, 0x74, 0x61, 0x2D, 0x74, 0x61, 0x62, 0x3D, 0x22, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61,
+    0x6C, 0x22, 0x3E, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x47, 0x65,
+    0x6E, 0x65, 0x72, 0x61, 0x6C, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x54,
+    0x61, 0x62, 0x20, 0x2D, 0x2D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C, 0x22,
+    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x61, 0x62, 0x2D, 0x63, 0x6F, 0x6E, 0x74,
+    0x65, 0x6E, 0x74, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x61,
+    0x72, 0x64, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x33, 0x3E, 0x4D, 0x6F, 0x64, 0x6F, 0x20, 0x64, 0x65,
+    0x20, 0x4F, 0x70, 0x65, 0x72, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x57, 0x69, 0x2D, 0x46,
+    0x69, 0x3C, 0x2F, 0x68, 0x33, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73,
+    0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20,
-    0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x31, 0x22, 0x3E, 0x45, 0x73, 0x74, 0x61, 0x63, 0x69,
-    0xC3, 0xB3, 0x6E, 0x20, 0x28, 0x53, 0x54, 0x41, 0x29, 0x3C, 0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F,
-    0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74, 0x69,
-    0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x32, 0x22, 0x3E, 0x50, 0x75, 0x6E,
-    0x74, 0x6F, 0x20, 0x64, 0x65, 0x20, 0x41, 0x63, 0x63, 0x65, 0x73, 0x6F, 0x20, 0x28, 0x41, 0x50,
-    0x29, 0x3C, 0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22,
+    0x77, 0x69, 0x66, 0x69, 0x4D, 0x6F, 0x64, 0x65, 0x22, 0x3E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x63,
+    0x69, 0x6F, 0x6E, 0x61, 0x72, 0x20, 0x4D, 0x6F, 0x64, 0x6F, 0x3A, 0x3C, 0x2F, 0x6C, 0x61, 0x62,
+    0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20,
+    0x69, 0x64, 0x3D, 0x22, 0x77, 0x69, 0x66, 0x69, 0x4D, 0x6F, 0x64, 0x65, 0x22, 0x20, 0x6F, 0x6E,
+    0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x3D, 0x22, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x4D, 0x6F,
+    0x64, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x28, 0x29, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
-    0x3D, 0x22, 0x33, 0x22, 0x3E, 0x41, 0x50, 0x20, 0x2B, 0x20, 0x45, 0x73, 0x74, 0x61, 0x63, 0x69,
-    0xC3, 0xB3, 0x6E, 0x20, 0x28, 0x41, 0x50, 0x53, 0x54, 0x41, 0x29, 0x3C, 0x2F, 0x6F, 0x70, 0x74,
-    0x69, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x65, 0x6C, 0x65, 0x63,
-    0x74, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69,
-    0x64, 0x3D, 0x22, 0x6D, 0x6F, 0x64, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x22, 0x20, 0x73, 0x74, 0x79,
-    0x6C, 0x65, 0x3D, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x74, 0x6F, 0x70, 0x3A, 0x20,
-    0x31, 0x72, 0x65, 0x6D, 0x3B, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72,
-    0x28, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x29, 0x3B, 0x22,
-    0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x54,
-    0x61, 0x62, 0x20, 0x2D, 0x2D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22, 0x20,
-    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x61, 0x62, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65,
-    0x6E, 0x74, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61,
-    0x73, 0x73, 0x3D, 0x22, 0x63, 0x61, 0x72, 0x64, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x33, 0x3E, 0x49,
-    0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x64, 0x65, 0x20, 0x43,
-    0x6F, 0x6E, 0x65, 0x78, 0x69, 0xC3, 0xB3, 0x6E, 0x3C, 0x2F, 0x68, 0x33, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64,
-    0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F,
-    0x6E, 0x49, 0x6E, 0x66, 0x6F, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x6D, 0x61,
-    0x72, 0x67, 0x69, 0x6E, 0x2D, 0x74, 0x6F, 0x70, 0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x20,
-    0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x67, 0x72, 0x69, 0x64, 0x3B, 0x20, 0x67,
-    0x61, 0x70, 0x3A, 0x20, 0x30, 0x2E, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x20, 0x66, 0x6F, 0x6E, 0x74,
-    0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20, 0x30, 0x2E, 0x39, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x22,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x70, 0x3E, 0x43, 0x61, 0x72, 0x67, 0x61, 0x6E, 0x64,
-    0x6F, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x2E, 0x2E,
-    0x2E, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x62, 0x75,
-    0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x66, 0x65,
-    0x74, 0x63, 0x68, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 0x22, 0x20, 0x63, 0x6C, 0x61,
-    0x73, 0x73, 0x3D, 0x22, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x61, 0x72, 0x79, 0x22, 0x3E, 0x41,
-    0x63, 0x74, 0x75, 0x61, 0x6C, 0x69, 0x7A, 0x61, 0x72, 0x20, 0x45, 0x73, 0x74, 0x61, 0x64, 0x6F,
-    0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x53, 0x54, 0x41, 0x20, 0x54, 0x61,
-    0x62, 0x20, 0x2D, 0x2D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64,
-    0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73,
-    0x73, 0x3D, 0x22, 0x74, 0x61, 0x62, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69,
-    0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x61, 0x72, 0x64, 0x22, 0x3E, 0x0A,
+    0x3D, 0x22, 0x30, 0x22, 0x3E, 0x41, 0x70, 0x61, 0x67, 0x61, 0x64, 0x6F, 0x20, 0x28, 0x4F, 0x46,
+    0x46, 0x29, 0x3C, 0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x68, 0x33, 0x3E, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x63, 0x69, 0xC3,
-    0xB3, 0x6E, 0x20, 0x64, 0x65, 0x20, 0x45, 0x73, 0x74, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20,
-    0x28, 0x53, 0x54, 0x41, 0x29, 0x3C, 0x2F, 0x68, 0x33, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x62, 0x75, 0x74, 0x74,
-    0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x73, 0x63, 0x61, 0x6E,
-    0x4E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x73, 0x28, 0x29, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22,
-    0x73, 0x63, 0x61, 0x6E, 0x42, 0x74, 0x6E, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
-    0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x61, 0x72, 0x79, 0x22, 0x3E, 0x45, 0x73, 0x63, 0x61, 0x6E,
-    0x65, 0x61, 0x72, 0x20, 0x52, 0x65, 0x64, 0x65, 0x73, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F,
-    0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6E, 0x65, 0x74, 0x77,
-    0x6F, 0x72, 0x6B, 0x4C, 0x69, 0x73, 0x74, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
-    0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2D, 0x6C, 0x69, 0x73, 0x74, 0x22, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x3D, 0x22, 0x31, 0x22, 0x3E, 0x45, 0x73, 0x74, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20,
+    0x28, 0x53, 0x54, 0x41, 0x29, 0x3C, 0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0A, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x70, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x70, 0x61, 0x64,
-    0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x20, 0x63, 0x6F, 0x6C, 0x6F,
-    0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x6C, 0x69,
-    0x67, 0x68, 0x74, 0x29, 0x3B, 0x22, 0x3E, 0x48, 0x61, 0x7A, 0x20, 0x63, 0x6C, 0x69, 0x63, 0x20,
-    0x65, 0x6E, 0x20, 0x22, 0x45, 0x73, 0x63, 0x61, 0x6E, 0x65, 0x61, 0x72, 0x20, 0x52, 0x65, 0x64,
-    0x65, 0x73, 0x22, 0x20, 0x70, 0x61, 0x72, 0x61, 0x20, 0x62, 0x75, 0x73, 0x63, 0x61, 0x72, 0x2E,
-    0x2E, 0x2E, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x32, 0x22, 0x3E, 0x50, 0x75, 0x6E, 0x74, 0x6F, 0x20, 0x64,
+    0x65, 0x20, 0x41, 0x63, 0x63, 0x65, 0x73, 0x6F, 0x20, 0x28, 0x41, 0x50, 0x29, 0x3C, 0x2F, 0x6F,
+    0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x46, 0x6F, 0x72, 0x6D,
-    0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D,
-    0x74, 0x6F, 0x70, 0x3A, 0x20, 0x31, 0x2E, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x22, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66,
-    0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22,
-    0x73, 0x74, 0x61, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x22, 0x3E, 0x53, 0x53, 0x49, 0x44, 0x3C, 0x2F,
-    0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x33, 0x22,
+    0x3E, 0x41, 0x50, 0x20, 0x2B, 0x20, 0x45, 0x73, 0x74, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20,
+    0x28, 0x41, 0x50, 0x53, 0x54, 0x41, 0x29, 0x3C, 0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x3E, 0x0A, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74,
-    0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x22, 0x20,
-    0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F,
-    0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C,
-    0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C,
-    0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F,
-    0x72, 0x64, 0x22, 0x3E, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x61, 0x73, 0x65, 0xC3, 0xB1, 0x61, 0x3C,
-    0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6D,
+    0x6F, 0x64, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22,
+    0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x74, 0x6F, 0x70, 0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D,
+    0x3B, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74,
+    0x65, 0x78, 0x74, 0x2D, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x29, 0x3B, 0x22, 0x3E, 0x3C, 0x2F, 0x64,
+    0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x21, 0x2D, 0x2D, 0x20, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x54, 0x61, 0x62, 0x20, 0x2D,
+    0x2D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20,
+    0x69, 0x64, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73,
+    0x73, 0x3D, 0x22, 0x74, 0x61, 0x62, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x61,
+    0x63, 0x74, 0x69, 0x76, 0x65, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
+    0x63, 0x61, 0x72, 0x64, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x33, 0x3E, 0x49, 0x6E, 0x66, 0x6F, 0x72,
+    0x6D, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x64, 0x65, 0x20, 0x43, 0x6F, 0x6E, 0x65, 0x78,
+    0x69, 0xC3, 0xB3, 0x6E, 0x3C, 0x2F, 0x68, 0x33, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69,
+    0x64, 0x3D, 0x22, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x49, 0x6E, 0x66,
+    0x6F, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E,
+    0x2D, 0x74, 0x6F, 0x70, 0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x20, 0x64, 0x69, 0x73, 0x70,
+    0x6C, 0x61, 0x79, 0x3A, 0x20, 0x67, 0x72, 0x69, 0x64, 0x3B, 0x20, 0x67, 0x61, 0x70, 0x3A, 0x20,
+    0x30, 0x2E, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A,
+    0x65, 0x3A, 0x20, 0x30, 0x2E, 0x39, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x22, 0x3E, 0x0A, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x70, 0x61, 0x73,
-    0x73, 0x77, 0x6F, 0x72, 0x64, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x70,
-    0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F,
-    0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C,
-    0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22,
+    0x20, 0x20, 0x3C, 0x70, 0x3E, 0x43, 0x61, 0x72, 0x67, 0x61, 0x6E, 0x64, 0x6F, 0x20, 0x69, 0x6E,
+    0x66, 0x6F, 0x72, 0x6D, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x2E, 0x2E, 0x2E, 0x3C, 0x2F, 0x70,
     0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69,
-    0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B,
-    0x62, 0x6F, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x68, 0x63,
-    0x70, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x3D, 0x22, 0x74, 0x6F, 0x67,
-    0x67, 0x6C, 0x65, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x49, 0x50, 0x28, 0x27, 0x73, 0x74, 0x61,
-    0x27, 0x29, 0x22, 0x3E, 0x20, 0x55, 0x73, 0x61, 0x72, 0x20, 0x44, 0x48, 0x43, 0x50, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E,
+    0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x66, 0x65, 0x74, 0x63, 0x68, 0x53,
+    0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
+    0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x61, 0x72, 0x79, 0x22, 0x3E, 0x41, 0x63, 0x74, 0x75, 0x61,
+    0x6C, 0x69, 0x7A, 0x61, 0x72, 0x20, 0x45, 0x73, 0x74, 0x61, 0x64, 0x6F, 0x3C, 0x2F, 0x62, 0x75,
+    0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x53, 0x54, 0x41, 0x20, 0x54, 0x61, 0x62, 0x20, 0x2D, 0x2D,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69,
+    0x64, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74,
+    0x61, 0x62, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C,
+    0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x61, 0x72, 0x64, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x33, 0x3E,
+    0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x64,
+    0x65, 0x20, 0x45, 0x73, 0x74, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x28, 0x53, 0x54, 0x41,
+    0x29, 0x3C, 0x2F, 0x68, 0x33, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F,
+    0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x73, 0x63, 0x61, 0x6E, 0x4E, 0x65, 0x74, 0x77,
+    0x6F, 0x72, 0x6B, 0x73, 0x28, 0x29, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x63, 0x61, 0x6E,
+    0x42, 0x74, 0x6E, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x73, 0x65, 0x63, 0x6F,
+    0x6E, 0x64, 0x61, 0x72, 0x79, 0x22, 0x3E, 0x45, 0x73, 0x63, 0x61, 0x6E, 0x65, 0x61, 0x72, 0x20,
+    0x52, 0x65, 0x64, 0x65, 0x73, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x73, 0x74, 0x61, 0x74,
-    0x69, 0x63, 0x5F, 0x69, 0x70, 0x5F, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x22, 0x20, 0x73, 0x74,
-    0x79, 0x6C, 0x65, 0x3D, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x6E, 0x6F,
-    0x6E, 0x65, 0x3B, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64,
-    0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67,
-    0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72,
-    0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x69, 0x70, 0x22, 0x3E, 0x44, 0x69, 0x72, 0x65, 0x63, 0x63,
-    0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x49, 0x50, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C,
-    0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74,
-    0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x69, 0x70, 0x22, 0x3E, 0x3C, 0x2F,
-    0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69,
-    0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x72, 0x6F, 0x77, 0x22, 0x3E, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20,
-    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75,
-    0x70, 0x22, 0x3E, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x73,
-    0x74, 0x61, 0x5F, 0x6D, 0x61, 0x73, 0x6B, 0x22, 0x3E, 0x4D, 0xC3, 0xA1, 0x73, 0x63, 0x61, 0x72,
-    0x61, 0x20, 0x64, 0x65, 0x20, 0x53, 0x75, 0x62, 0x72, 0x65, 0x64, 0x3C, 0x2F, 0x6C, 0x61, 0x62,
-    0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22,
-    0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x6D, 0x61,
-    0x73, 0x6B, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x4C,
+    0x69, 0x73, 0x74, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x6E, 0x65, 0x74, 0x77,
+    0x6F, 0x72, 0x6B, 0x2D, 0x6C, 0x69, 0x73, 0x74, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x70, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67,
+    0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76,
+    0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x29,
+    0x3B, 0x22, 0x3E, 0x48, 0x61, 0x7A, 0x20, 0x63, 0x6C, 0x69, 0x63, 0x20, 0x65, 0x6E, 0x20, 0x22,
+    0x45, 0x73, 0x63, 0x61, 0x6E, 0x65, 0x61, 0x72, 0x20, 0x52, 0x65, 0x64, 0x65, 0x73, 0x22, 0x20,
+    0x70, 0x61, 0x72, 0x61, 0x20, 0x62, 0x75, 0x73, 0x63, 0x61, 0x72, 0x2E, 0x2E, 0x2E, 0x3C, 0x2F,
+    0x70, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x66, 0x6F, 0x72, 0x6D,
+    0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x46, 0x6F, 0x72, 0x6D, 0x22, 0x20, 0x73, 0x74,
+    0x79, 0x6C, 0x65, 0x3D, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x74, 0x6F, 0x70, 0x3A,
+    0x20, 0x31, 0x2E, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D,
+    0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73,
-    0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x3C,
-    0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x67,
-    0x77, 0x22, 0x3E, 0x50, 0x75, 0x65, 0x72, 0x74, 0x61, 0x20, 0x64, 0x65, 0x20, 0x45, 0x6E, 0x6C,
-    0x61, 0x63, 0x65, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75,
+    0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F,
+    0x73, 0x73, 0x69, 0x64, 0x22, 0x3E, 0x53, 0x53, 0x49, 0x44, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65,
+    0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69, 0x6E, 0x70, 0x75,
     0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64,
-    0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x67, 0x77, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E,
+    0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x22, 0x20, 0x72, 0x65, 0x71, 0x75,
+    0x69, 0x72, 0x65, 0x64, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E,
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
+    0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61,
-    0x73, 0x73, 0x3D, 0x22, 0x72, 0x6F, 0x77, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72,
+    0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x22, 0x3E,
+    0x43, 0x6F, 0x6E, 0x74, 0x72, 0x61, 0x73, 0x65, 0xC3, 0xB1, 0x61, 0x3C, 0x2F, 0x6C, 0x61, 0x62,
+    0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69, 0x6E, 0x70,
+    0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72,
+    0x64, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x70, 0x61, 0x73, 0x73, 0x77,
+    0x6F, 0x72, 0x64, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
+    0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73,
-    0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x3C, 0x6C,
-    0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x6E,
-    0x73, 0x31, 0x22, 0x3E, 0x44, 0x4E, 0x53, 0x20, 0x50, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x69, 0x6F,
-    0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74,
-    0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73,
-    0x74, 0x61, 0x5F, 0x64, 0x6E, 0x73, 0x31, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76,
-    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F,
-    0x75, 0x70, 0x22, 0x3E, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22,
-    0x73, 0x74, 0x61, 0x5F, 0x64, 0x6E, 0x73, 0x32, 0x22, 0x3E, 0x44, 0x4E, 0x53, 0x20, 0x53, 0x65,
-    0x63, 0x75, 0x6E, 0x64, 0x61, 0x72, 0x69, 0x6F, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E,
-    0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78,
-    0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x6E, 0x73, 0x32, 0x22,
-    0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74,
+    0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22,
+    0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x22, 0x20, 0x6F,
+    0x6E, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x3D, 0x22, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x53,
+    0x74, 0x61, 0x74, 0x69, 0x63, 0x49, 0x50, 0x28, 0x27, 0x73, 0x74, 0x61, 0x27, 0x29, 0x22, 0x3E,
+    0x20, 0x55, 0x73, 0x61, 0x72, 0x20, 0x44, 0x48, 0x43, 0x50, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x2F, 0x66, 0x6F, 0x72, 0x6D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x41, 0x50, 0x20, 0x54, 0x61, 0x62,
-    0x20, 0x2D, 0x2D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69,
-    0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x61, 0x70, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
-    0x22, 0x74, 0x61, 0x62, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22, 0x3E, 0x0A, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20,
-    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x61, 0x72, 0x64, 0x22, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68,
-    0x33, 0x3E, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E,
-    0x20, 0x64, 0x65, 0x20, 0x50, 0x75, 0x6E, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x20, 0x41, 0x63, 0x63,
-    0x65, 0x73, 0x6F, 0x20, 0x28, 0x41, 0x50, 0x29, 0x3C, 0x2F, 0x68, 0x33, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x66,
-    0x6F, 0x72, 0x6D, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x61, 0x70, 0x46, 0x6F, 0x72, 0x6D, 0x22, 0x3E,
+    0x69, 0x64, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x5F, 0x69,
+    0x70, 0x5F, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D,
+    0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x22,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63,
+    0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70,
+    0x22, 0x3E, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x73, 0x74,
+    0x61, 0x5F, 0x69, 0x70, 0x22, 0x3E, 0x44, 0x69, 0x72, 0x65, 0x63, 0x63, 0x69, 0xC3, 0xB3, 0x6E,
+    0x20, 0x49, 0x50, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75,
+    0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64,
+    0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x69, 0x70, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E,
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
-    0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C,
+    0x61, 0x73, 0x73, 0x3D, 0x22, 0x72, 0x6F, 0x77, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72,
-    0x3D, 0x22, 0x61, 0x70, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x22, 0x3E, 0x53, 0x53, 0x49, 0x44, 0x20,
-    0x64, 0x65, 0x6C, 0x20, 0x41, 0x50, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73,
+    0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x3C,
+    0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x6D,
+    0x61, 0x73, 0x6B, 0x22, 0x3E, 0x4D, 0xC3, 0xA1, 0x73, 0x63, 0x61, 0x72, 0x61, 0x20, 0x64, 0x65,
+    0x20, 0x53, 0x75, 0x62, 0x72, 0x65, 0x64, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C,
+    0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74,
+    0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x6D, 0x61, 0x73, 0x6B, 0x22, 0x3E,
+    0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66,
+    0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x3C, 0x6C, 0x61, 0x62, 0x65,
+    0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x67, 0x77, 0x22, 0x3E, 0x50,
+    0x75, 0x65, 0x72, 0x74, 0x61, 0x20, 0x64, 0x65, 0x20, 0x45, 0x6E, 0x6C, 0x61, 0x63, 0x65, 0x3C,
+    0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79,
+    0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x74,
+    0x61, 0x5F, 0x67, 0x77, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79,
-    0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x61, 0x70,
-    0x5F, 0x73, 0x73, 0x69, 0x64, 0x22, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D,
-    0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
+    0x72, 0x6F, 0x77, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x61, 0x70, 0x5F,
-    0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x22, 0x3E, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x61,
-    0x73, 0x65, 0xC3, 0xB1, 0x61, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F,
+    0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C,
+    0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x6E, 0x73, 0x31, 0x22, 0x3E,
+    0x44, 0x4E, 0x53, 0x20, 0x50, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x69, 0x6F, 0x3C, 0x2F, 0x6C, 0x61,
+    0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D,
+    0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x64,
+    0x6E, 0x73, 0x31, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70,
-    0x65, 0x3D, 0x22, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x22, 0x20, 0x69, 0x64, 0x3D,
-    0x22, 0x61, 0x70, 0x5F, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x22, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61,
+    0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E,
+    0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F,
+    0x64, 0x6E, 0x73, 0x32, 0x22, 0x3E, 0x44, 0x4E, 0x53, 0x20, 0x53, 0x65, 0x63, 0x75, 0x6E, 0x64,
+    0x61, 0x72, 0x69, 0x6F, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70,
+    0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69,
+    0x64, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x6E, 0x73, 0x32, 0x22, 0x3E, 0x3C, 0x2F, 0x64,
+    0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69,
+    0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F,
+    0x66, 0x6F, 0x72, 0x6D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x41, 0x50, 0x20, 0x54, 0x61, 0x62, 0x20, 0x2D, 0x2D, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64,
+    0x3D, 0x22, 0x61, 0x70, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x61, 0x62,
+    0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73,
+    0x73, 0x3D, 0x22, 0x63, 0x61, 0x72, 0x64, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x33, 0x3E, 0x43, 0x6F,
+    0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x64, 0x65, 0x20,
+    0x50, 0x75, 0x6E, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x20, 0x41, 0x63, 0x63, 0x65, 0x73, 0x6F, 0x20,
+    0x28, 0x41, 0x50, 0x29, 0x3C, 0x2F, 0x68, 0x33, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x66, 0x6F, 0x72, 0x6D, 0x20,
+    0x69, 0x64, 0x3D, 0x22, 0x61, 0x70, 0x46, 0x6F, 0x72, 0x6D, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64,
-    0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67,
-    0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x6D, 0x61,
-    0x78, 0x5F, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x22, 0x3E, 0x4D,
-    0x61, 0x78, 0x2E, 0x20, 0x43, 0x6F, 0x6E, 0x65, 0x78, 0x69, 0x6F, 0x6E, 0x65, 0x73, 0x3C, 0x2F,
-    0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x6E, 0x75, 0x6D, 0x62,
-    0x65, 0x72, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x6D, 0x61, 0x78, 0x5F, 0x63,
-    0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x22, 0x20, 0x6D, 0x69, 0x6E, 0x3D,
-    0x22, 0x31, 0x22, 0x20, 0x6D, 0x61, 0x78, 0x3D, 0x22, 0x31, 0x30, 0x22, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72,
+    0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64,
-    0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67,
-    0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x61, 0x70,
+    0x5F, 0x73, 0x73, 0x69, 0x64, 0x22, 0x3E, 0x53, 0x53, 0x49, 0x44, 0x20, 0x64, 0x65, 0x6C, 0x20,
+    0x41, 0x50, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22,
-    0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x61, 0x70,
-    0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x22, 0x20, 0x6F, 0x6E,
-    0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x3D, 0x22, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x44, 0x48,
-    0x43, 0x50, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 0x28, 0x27, 0x61, 0x70, 0x27, 0x29, 0x22, 0x3E,
-    0x20, 0x48, 0x61, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x61, 0x72, 0x20, 0x53, 0x65, 0x72, 0x76, 0x69,
-    0x64, 0x6F, 0x72, 0x20, 0x44, 0x48, 0x43, 0x50, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x73, 0x73, 0x69,
+    0x64, 0x22, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76,
+    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F,
+    0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61,
+    0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x70, 0x61, 0x73, 0x73,
+    0x77, 0x6F, 0x72, 0x64, 0x22, 0x3E, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x61, 0x73, 0x65, 0xC3, 0xB1,
+    0x61, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x70,
+    0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x61, 0x70, 0x5F,
+    0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63,
+    0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70,
+    0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65,
+    0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x6D, 0x61, 0x78, 0x5F, 0x63, 0x6F,
+    0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x22, 0x3E, 0x4D, 0x61, 0x78, 0x2E, 0x20,
+    0x43, 0x6F, 0x6E, 0x65, 0x78, 0x69, 0x6F, 0x6E, 0x65, 0x73, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65,
+    0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69, 0x6E, 0x70, 0x75,
+    0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x20,
+    0x69, 0x64, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x6D, 0x61, 0x78, 0x5F, 0x63, 0x6F, 0x6E, 0x6E, 0x65,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x22, 0x20, 0x6D, 0x69, 0x6E, 0x3D, 0x22, 0x31, 0x22, 0x20,
+    0x6D, 0x61, 0x78, 0x3D, 0x22, 0x31, 0x30, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F,
     0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64,
-    0x3D, 0x22, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72,
-    0x5F, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22,
-    0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x22, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C,
-    0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22,
-    0x3E, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x61, 0x70, 0x5F,
-    0x69, 0x70, 0x22, 0x3E, 0x49, 0x50, 0x20, 0x64, 0x65, 0x6C, 0x20, 0x41, 0x50, 0x3C, 0x2F, 0x6C,
-    0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65,
-    0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x69,
-    0x70, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x72, 0x6F,
-    0x77, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D,
-    0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66,
-    0x6F, 0x72, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x6D, 0x61, 0x73, 0x6B, 0x22, 0x3E, 0x4D, 0xC3, 0xA1,
-    0x73, 0x63, 0x61, 0x72, 0x61, 0x20, 0x64, 0x65, 0x20, 0x53, 0x75, 0x62, 0x72, 0x65, 0x64, 0x3C,
-    0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79,
-    0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x61, 0x70,
-    0x5F, 0x6D, 0x61, 0x73, 0x6B, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63,
     0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70,
-    0x22, 0x3E, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x61, 0x70,
-    0x5F, 0x67, 0x77, 0x22, 0x3E, 0x50, 0x75, 0x65, 0x72, 0x74, 0x61, 0x20, 0x64, 0x65, 0x20, 0x45,
-    0x6E, 0x6C, 0x61, 0x63, 0x65, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E,
-    0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20,
-    0x69, 0x64, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x67, 0x77, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65,
+    0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63,
+    0x6B, 0x62, 0x6F, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63,
+    0x70, 0x5F, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x68, 0x61, 0x6E,
+    0x67, 0x65, 0x3D, 0x22, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x44, 0x48, 0x43, 0x50, 0x53, 0x65,
+    0x72, 0x76, 0x65, 0x72, 0x28, 0x27, 0x61, 0x70, 0x27, 0x29, 0x22, 0x3E, 0x20, 0x48, 0x61, 0x62,
+    0x69, 0x6C, 0x69, 0x74, 0x61, 0x72, 0x20, 0x53, 0x65, 0x72, 0x76, 0x69, 0x64, 0x6F, 0x72, 0x20,
+    0x44, 0x48, 0x43, 0x50, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C,
+    0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E,
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C,
-    0x61, 0x73, 0x73, 0x3D, 0x22, 0x72, 0x6F, 0x77, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x61, 0x70,
+    0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x5F, 0x66, 0x69, 0x65,
+    0x6C, 0x64, 0x73, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x64, 0x69, 0x73, 0x70,
+    0x6C, 0x61, 0x79, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
+    0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x3C, 0x6C, 0x61,
+    0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x69, 0x70, 0x22, 0x3E,
+    0x49, 0x50, 0x20, 0x64, 0x65, 0x6C, 0x20, 0x41, 0x50, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C,
+    0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65,
+    0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x69, 0x70, 0x22, 0x3E, 0x3C,
+    0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64,
+    0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x72, 0x6F, 0x77, 0x22, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76,
+    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F,
+    0x75, 0x70, 0x22, 0x3E, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22,
+    0x61, 0x70, 0x5F, 0x6D, 0x61, 0x73, 0x6B, 0x22, 0x3E, 0x4D, 0xC3, 0xA1, 0x73, 0x63, 0x61, 0x72,
+    0x61, 0x20, 0x64, 0x65, 0x20, 0x53, 0x75, 0x62, 0x72, 0x65, 0x64, 0x3C, 0x2F, 0x6C, 0x61, 0x62,
+    0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22,
+    0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x6D, 0x61, 0x73,
+    0x6B, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73,
+    0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x3C, 0x6C,
+    0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x67, 0x77, 0x22,
+    0x3E, 0x50, 0x75, 0x65, 0x72, 0x74, 0x61, 0x20, 0x64, 0x65, 0x20, 0x45, 0x6E, 0x6C, 0x61, 0x63,
+    0x65, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20,
+    0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22,
+    0x61, 0x70, 0x5F, 0x67, 0x77, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
+    0x22, 0x72, 0x6F, 0x77, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66,
+    0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x3C, 0x6C, 0x61, 0x62, 0x65,
+    0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x64, 0x6E, 0x73, 0x31, 0x22, 0x3E,
+    0x44, 0x4E, 0x53, 0x20, 0x50, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x69, 0x6F, 0x3C, 0x2F, 0x6C, 0x61,
+    0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D,
+    0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x64, 0x6E,
+    0x73, 0x31, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73,
     0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x3C,
     0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x64, 0x6E,
-    0x73, 0x31, 0x22, 0x3E, 0x44, 0x4E, 0x53, 0x20, 0x50, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x69, 0x6F,
-    0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74,
-    0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x61,
-    0x70, 0x5F, 0x64, 0x6E, 0x73, 0x31, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20,
+    0x73, 0x32, 0x22, 0x3E, 0x44, 0x4E, 0x53, 0x20, 0x53, 0x65, 0x63, 0x75, 0x6E, 0x64, 0x61, 0x72,
+    0x69, 0x6F, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74,
+    0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3D,
+    0x22, 0x61, 0x70, 0x5F, 0x64, 0x6E, 0x73, 0x32, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20,
-    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75,
-    0x70, 0x22, 0x3E, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x61,
-    0x70, 0x5F, 0x64, 0x6E, 0x73, 0x32, 0x22, 0x3E, 0x44, 0x4E, 0x53, 0x20, 0x53, 0x65, 0x63, 0x75,
-    0x6E, 0x64, 0x61, 0x72, 0x69, 0x6F, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69,
-    0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22,
-    0x20, 0x69, 0x64, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x64, 0x6E, 0x73, 0x32, 0x22, 0x3E, 0x3C, 0x2F,
-    0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61,
+    0x73, 0x73, 0x3D, 0x22, 0x72, 0x6F, 0x77, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73,
+    0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x3C, 0x6C,
+    0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63,
+    0x70, 0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x69, 0x6E, 0x22, 0x3E, 0x52, 0x61, 0x6E,
+    0x67, 0x6F, 0x20, 0x44, 0x48, 0x43, 0x50, 0x20, 0x4D, 0x69, 0x6E, 0x3C, 0x2F, 0x6C, 0x61, 0x62,
+    0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22,
+    0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63,
+    0x70, 0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x69, 0x6E, 0x22, 0x3E, 0x3C, 0x2F, 0x64,
     0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76,
-    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x72, 0x6F, 0x77, 0x22, 0x3E, 0x0A, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63,
-    0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70,
-    0x22, 0x3E, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x61, 0x70,
-    0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x69, 0x6E, 0x22,
-    0x3E, 0x52, 0x61, 0x6E, 0x67, 0x6F, 0x20, 0x44, 0x48, 0x43, 0x50, 0x20, 0x4D, 0x69, 0x6E, 0x3C,
-    0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79,
-    0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x61, 0x70,
-    0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x69, 0x6E, 0x22,
-    0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D,
+    0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66,
+    0x6F, 0x72, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x72, 0x61, 0x6E, 0x67,
+    0x65, 0x5F, 0x6D, 0x61, 0x78, 0x22, 0x3E, 0x52, 0x61, 0x6E, 0x67, 0x6F, 0x20, 0x44, 0x48, 0x43,
+    0x50, 0x20, 0x4D, 0x61, 0x78, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x3C, 0x69, 0x6E,
+    0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20,
+    0x69, 0x64, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x72, 0x61, 0x6E, 0x67,
+    0x65, 0x5F, 0x6D, 0x61, 0x78, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
-    0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x3C, 0x6C, 0x61, 0x62,
-    0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F,
-    0x72, 0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x61, 0x78, 0x22, 0x3E, 0x52, 0x61, 0x6E, 0x67, 0x6F,
-    0x20, 0x44, 0x48, 0x43, 0x50, 0x20, 0x4D, 0x61, 0x78, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C,
-    0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65,
-    0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F,
-    0x72, 0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x61, 0x78, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x66, 0x6F,
-    0x72, 0x6D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
-    0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x61, 0x76, 0x65, 0x43,
-    0x6F, 0x6E, 0x66, 0x69, 0x67, 0x42, 0x74, 0x6E, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63,
-    0x6B, 0x3D, 0x22, 0x73, 0x61, 0x76, 0x65, 0x41, 0x6C, 0x6C, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67,
-    0x28, 0x29, 0x22, 0x3E, 0x47, 0x75, 0x61, 0x72, 0x64, 0x61, 0x72, 0x20, 0x43, 0x6F, 0x6E, 0x66,
-    0x69, 0x67, 0x75, 0x72, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x79, 0x20, 0x52, 0x65, 0x69,
-    0x6E, 0x69, 0x63, 0x69, 0x61, 0x72, 0x20, 0x57, 0x69, 0x46, 0x69, 0x3C, 0x2F, 0x62, 0x75, 0x74,
-    0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x74, 0x6F,
-    0x61, 0x73, 0x74, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x68, 0x69, 0x64, 0x64,
-    0x65, 0x6E, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20,
-    0x3D, 0x20, 0x7B, 0x7D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x27,
-    0x77, 0x69, 0x66, 0x69, 0x4D, 0x6F, 0x64, 0x65, 0x27, 0x2C, 0x20, 0x27, 0x6D, 0x6F, 0x64, 0x65,
-    0x49, 0x6E, 0x66, 0x6F, 0x27, 0x2C, 0x20, 0x27, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69,
-    0x6F, 0x6E, 0x49, 0x6E, 0x66, 0x6F, 0x27, 0x2C, 0x20, 0x27, 0x73, 0x63, 0x61, 0x6E, 0x42, 0x74,
-    0x6E, 0x27, 0x2C, 0x20, 0x27, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x4C, 0x69, 0x73, 0x74,
-    0x27, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x73, 0x74, 0x61,
-    0x5F, 0x73, 0x73, 0x69, 0x64, 0x27, 0x2C, 0x20, 0x27, 0x73, 0x74, 0x61, 0x5F, 0x70, 0x61, 0x73,
-    0x73, 0x77, 0x6F, 0x72, 0x64, 0x27, 0x2C, 0x20, 0x27, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x68, 0x63,
-    0x70, 0x27, 0x2C, 0x20, 0x27, 0x73, 0x74, 0x61, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x5F,
-    0x69, 0x70, 0x5F, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x27, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x73, 0x74, 0x61, 0x5F, 0x69, 0x70, 0x27, 0x2C, 0x20, 0x27,
-    0x73, 0x74, 0x61, 0x5F, 0x6D, 0x61, 0x73, 0x6B, 0x27, 0x2C, 0x20, 0x27, 0x73, 0x74, 0x61, 0x5F,
-    0x67, 0x77, 0x27, 0x2C, 0x20, 0x27, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x6E, 0x73, 0x31, 0x27, 0x2C,
-    0x20, 0x27, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x6E, 0x73, 0x32, 0x27, 0x2C, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x61, 0x70, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x27, 0x2C,
-    0x20, 0x27, 0x61, 0x70, 0x5F, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x27, 0x2C, 0x20,
-    0x27, 0x61, 0x70, 0x5F, 0x6D, 0x61, 0x78, 0x5F, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69,
-    0x6F, 0x6E, 0x73, 0x27, 0x2C, 0x20, 0x27, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x73,
-    0x65, 0x72, 0x76, 0x65, 0x72, 0x27, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x27, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72,
-    0x5F, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x27, 0x2C, 0x20, 0x27, 0x61, 0x70, 0x5F, 0x69, 0x70,
-    0x27, 0x2C, 0x20, 0x27, 0x61, 0x70, 0x5F, 0x6D, 0x61, 0x73, 0x6B, 0x27, 0x2C, 0x20, 0x27, 0x61,
-    0x70, 0x5F, 0x67, 0x77, 0x27, 0x2C, 0x20, 0x27, 0x61, 0x70, 0x5F, 0x64, 0x6E, 0x73, 0x31, 0x27,
-    0x2C, 0x20, 0x27, 0x61, 0x70, 0x5F, 0x64, 0x6E, 0x73, 0x32, 0x27, 0x2C, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x72,
-    0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x69, 0x6E, 0x27, 0x2C, 0x20, 0x27, 0x61, 0x70, 0x5F, 0x64,
-    0x68, 0x63, 0x70, 0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x61, 0x78, 0x27, 0x2C, 0x20,
-    0x27, 0x73, 0x61, 0x76, 0x65, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x42, 0x74, 0x6E, 0x27, 0x2C,
-    0x20, 0x27, 0x74, 0x6F, 0x61, 0x73, 0x74, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x5D, 0x2E, 0x66, 0x6F, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x69, 0x64, 0x20, 0x3D, 0x3E,
-    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65,
-    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x5B, 0x69, 0x64, 0x5D, 0x20, 0x3D, 0x20, 0x64, 0x6F,
-    0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-    0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x69, 0x64, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x7D, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x6C, 0x65, 0x74, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69,
-    0x67, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x3B, 0x20, 0x2F, 0x2F, 0x20, 0x41, 0x6C, 0x6D, 0x61, 0x63,
-    0x65, 0x6E, 0x61, 0x20, 0x6C, 0x61, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61,
-    0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x61, 0x63, 0x74, 0x75, 0x61, 0x6C, 0x20, 0x64, 0x65, 0x6C,
-    0x20, 0x45, 0x53, 0x50, 0x33, 0x32, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x54,
-    0x61, 0x62, 0x28, 0x74, 0x61, 0x62, 0x49, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
-    0x2E, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x41, 0x6C,
-    0x6C, 0x28, 0x27, 0x2E, 0x74, 0x61, 0x62, 0x27, 0x29, 0x2E, 0x66, 0x6F, 0x72, 0x45, 0x61, 0x63,
-    0x68, 0x28, 0x74, 0x20, 0x3D, 0x3E, 0x20, 0x74, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69,
-    0x73, 0x74, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x27, 0x61, 0x63, 0x74, 0x69, 0x76,
-    0x65, 0x27, 0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x71, 0x75, 0x65, 0x72, 0x79,
-    0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x41, 0x6C, 0x6C, 0x28, 0x27, 0x2E, 0x74, 0x61,
-    0x62, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x27, 0x29, 0x2E, 0x66, 0x6F, 0x72, 0x45,
-    0x61, 0x63, 0x68, 0x28, 0x63, 0x20, 0x3D, 0x3E, 0x20, 0x63, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73,
-    0x4C, 0x69, 0x73, 0x74, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x27, 0x61, 0x63, 0x74,
-    0x69, 0x76, 0x65, 0x27, 0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x66, 0x6F, 0x72, 0x6D, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69,
+    0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76,
+    0x3E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x62, 0x75, 0x74, 0x74,
+    0x6F, 0x6E, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x61, 0x76, 0x65, 0x43, 0x6F, 0x6E, 0x66, 0x69,
+    0x67, 0x42, 0x74, 0x6E, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x73,
+    0x61, 0x76, 0x65, 0x41, 0x6C, 0x6C, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x28, 0x29, 0x22, 0x3E,
+    0x47, 0x75, 0x61, 0x72, 0x64, 0x61, 0x72, 0x20, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72,
+    0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x79, 0x20, 0x52, 0x65, 0x69, 0x6E, 0x69, 0x63, 0x69,
+    0x61, 0x72, 0x20, 0x57, 0x69, 0x46, 0x69, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x74, 0x6F, 0x61, 0x73, 0x74, 0x22,
+    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x22, 0x3E,
+    0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x63, 0x72,
+    0x69, 0x70, 0x74, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E,
+    0x73, 0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D,
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x27, 0x77, 0x69, 0x66, 0x69,
+    0x4D, 0x6F, 0x64, 0x65, 0x27, 0x2C, 0x20, 0x27, 0x6D, 0x6F, 0x64, 0x65, 0x49, 0x6E, 0x66, 0x6F,
+    0x27, 0x2C, 0x20, 0x27, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x49, 0x6E,
+    0x66, 0x6F, 0x27, 0x2C, 0x20, 0x27, 0x73, 0x63, 0x61, 0x6E, 0x42, 0x74, 0x6E, 0x27, 0x2C, 0x20,
+    0x27, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x4C, 0x69, 0x73, 0x74, 0x27, 0x2C, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x73, 0x74, 0x61, 0x5F, 0x73, 0x73, 0x69,
+    0x64, 0x27, 0x2C, 0x20, 0x27, 0x73, 0x74, 0x61, 0x5F, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72,
+    0x64, 0x27, 0x2C, 0x20, 0x27, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x27, 0x2C, 0x20,
+    0x27, 0x73, 0x74, 0x61, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x5F, 0x69, 0x70, 0x5F, 0x66,
+    0x69, 0x65, 0x6C, 0x64, 0x73, 0x27, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x27, 0x73, 0x74, 0x61, 0x5F, 0x69, 0x70, 0x27, 0x2C, 0x20, 0x27, 0x73, 0x74, 0x61, 0x5F,
+    0x6D, 0x61, 0x73, 0x6B, 0x27, 0x2C, 0x20, 0x27, 0x73, 0x74, 0x61, 0x5F, 0x67, 0x77, 0x27, 0x2C,
+    0x20, 0x27, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x6E, 0x73, 0x31, 0x27, 0x2C, 0x20, 0x27, 0x73, 0x74,
+    0x61, 0x5F, 0x64, 0x6E, 0x73, 0x32, 0x27, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x27, 0x61, 0x70, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x27, 0x2C, 0x20, 0x27, 0x61, 0x70,
+    0x5F, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x27, 0x2C, 0x20, 0x27, 0x61, 0x70, 0x5F,
+    0x6D, 0x61, 0x78, 0x5F, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x27,
+    0x2C, 0x20, 0x27, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x73, 0x65, 0x72, 0x76, 0x65,
+    0x72, 0x27, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x61, 0x70,
+    0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x5F, 0x66, 0x69, 0x65,
+    0x6C, 0x64, 0x73, 0x27, 0x2C, 0x20, 0x27, 0x61, 0x70, 0x5F, 0x69, 0x70, 0x27, 0x2C, 0x20, 0x27,
+    0x61, 0x70, 0x5F, 0x6D, 0x61, 0x73, 0x6B, 0x27, 0x2C, 0x20, 0x27, 0x61, 0x70, 0x5F, 0x67, 0x77,
+    0x27, 0x2C, 0x20, 0x27, 0x61, 0x70, 0x5F, 0x64, 0x6E, 0x73, 0x31, 0x27, 0x2C, 0x20, 0x27, 0x61,
+    0x70, 0x5F, 0x64, 0x6E, 0x73, 0x32, 0x27, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x27, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65,
+    0x5F, 0x6D, 0x69, 0x6E, 0x27, 0x2C, 0x20, 0x27, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F,
+    0x72, 0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x61, 0x78, 0x27, 0x2C, 0x20, 0x27, 0x73, 0x61, 0x76,
+    0x65, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x42, 0x74, 0x6E, 0x27, 0x2C, 0x20, 0x27, 0x74, 0x6F,
+    0x61, 0x73, 0x74, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x2E, 0x66,
+    0x6F, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x69, 0x64, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x73, 0x5B, 0x69, 0x64, 0x5D, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65,
+    0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49,
+    0x64, 0x28, 0x69, 0x64, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D,
+    0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x65, 0x74, 0x20,
+    0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x20, 0x3D, 0x20,
+    0x7B, 0x7D, 0x3B, 0x20, 0x2F, 0x2F, 0x20, 0x41, 0x6C, 0x6D, 0x61, 0x63, 0x65, 0x6E, 0x61, 0x20,
+    0x6C, 0x61, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x63, 0x69, 0xC3, 0xB3,
+    0x6E, 0x20, 0x61, 0x63, 0x74, 0x75, 0x61, 0x6C, 0x20, 0x64, 0x65, 0x6C, 0x20, 0x45, 0x53, 0x50,
+    0x33, 0x32, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x54, 0x61, 0x62, 0x28, 0x74,
+    0x61, 0x62, 0x49, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x71, 0x75, 0x65,
+    0x72, 0x79, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x41, 0x6C, 0x6C, 0x28, 0x27, 0x2E,
+    0x74, 0x61, 0x62, 0x27, 0x29, 0x2E, 0x66, 0x6F, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x74, 0x20,
+    0x3D, 0x3E, 0x20, 0x74, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x72,
+    0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x27, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x27, 0x29, 0x29,
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F,
+    0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6C, 0x65,
+    0x63, 0x74, 0x6F, 0x72, 0x41, 0x6C, 0x6C, 0x28, 0x27, 0x2E, 0x74, 0x61, 0x62, 0x2D, 0x63, 0x6F,
+    0x6E, 0x74, 0x65, 0x6E, 0x74, 0x27, 0x29, 0x2E, 0x66, 0x6F, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28,
+    0x63, 0x20, 0x3D, 0x3E, 0x20, 0x63, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74,
+    0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x27, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x27,
+    0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E,
+    0x73, 0x74, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x54, 0x61, 0x62, 0x20, 0x3D,
+    0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53,
+    0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x28, 0x60, 0x2E, 0x74, 0x61, 0x62, 0x5B, 0x64, 0x61,
+    0x74, 0x61, 0x2D, 0x74, 0x61, 0x62, 0x3D, 0x22, 0x24, 0x7B, 0x74, 0x61, 0x62, 0x49, 0x64, 0x7D,
+    0x22, 0x5D, 0x60, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x54, 0x61,
+    0x62, 0x29, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x54, 0x61, 0x62, 0x2E, 0x63,
+    0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x27, 0x61, 0x63,
+    0x74, 0x69, 0x76, 0x65, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x54,
-    0x61, 0x62, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x71, 0x75,
-    0x65, 0x72, 0x79, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x28, 0x60, 0x2E, 0x74, 0x61,
-    0x62, 0x5B, 0x64, 0x61, 0x74, 0x61, 0x2D, 0x74, 0x61, 0x62, 0x3D, 0x22, 0x24, 0x7B, 0x74, 0x61,
-    0x62, 0x49, 0x64, 0x7D, 0x22, 0x5D, 0x60, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74,
-    0x65, 0x64, 0x54, 0x61, 0x62, 0x29, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x54,
-    0x61, 0x62, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61, 0x64, 0x64,
-    0x28, 0x27, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63,
-    0x74, 0x65, 0x64, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63,
-    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
-    0x42, 0x79, 0x49, 0x64, 0x28, 0x74, 0x61, 0x62, 0x49, 0x64, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x65, 0x6C,
-    0x65, 0x63, 0x74, 0x65, 0x64, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x29, 0x20, 0x73, 0x65,
-    0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x6C,
-    0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x27, 0x61, 0x63, 0x74,
-    0x69, 0x76, 0x65, 0x27, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x61, 0x62, 0x49, 0x64, 0x20, 0x3D, 0x3D,
-    0x3D, 0x20, 0x27, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x27, 0x29, 0x20, 0x66, 0x65, 0x74, 0x63,
-    0x68, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x61, 0x62, 0x49, 0x64,
-    0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x27, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C, 0x27, 0x29, 0x20,
-    0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x4D, 0x6F, 0x64, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x28, 0x29,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
-    0x20, 0x28, 0x74, 0x61, 0x62, 0x49, 0x64, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x27, 0x73, 0x74, 0x61,
-    0x27, 0x29, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x28, 0x29,
-    0x3B, 0x20, 0x2F, 0x2F, 0x20, 0x43, 0x61, 0x72, 0x67, 0x61, 0x72, 0x20, 0x6C, 0x61, 0x20, 0x63,
-    0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x61, 0x63,
-    0x74, 0x75, 0x61, 0x6C, 0x20, 0x61, 0x6C, 0x20, 0x63, 0x61, 0x6D, 0x62, 0x69, 0x61, 0x72, 0x20,
-    0x61, 0x20, 0x53, 0x54, 0x41, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x61, 0x62, 0x49, 0x64, 0x20, 0x3D, 0x3D, 0x3D, 0x20,
-    0x27, 0x61, 0x70, 0x27, 0x29, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x43, 0x6F, 0x6E, 0x66, 0x69,
-    0x67, 0x28, 0x29, 0x3B, 0x20, 0x2F, 0x2F, 0x20, 0x43, 0x61, 0x72, 0x67, 0x61, 0x72, 0x20, 0x6C,
-    0x61, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E,
-    0x20, 0x61, 0x63, 0x74, 0x75, 0x61, 0x6C, 0x20, 0x61, 0x6C, 0x20, 0x63, 0x61, 0x6D, 0x62, 0x69,
-    0x61, 0x72, 0x20, 0x61, 0x20, 0x41, 0x50, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
-    0x69, 0x6F, 0x6E, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x54, 0x6F, 0x61, 0x73, 0x74, 0x28, 0x6D, 0x73,
-    0x67, 0x2C, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x27, 0x73, 0x75, 0x63, 0x63, 0x65,
-    0x73, 0x73, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x74, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65,
-    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x74, 0x6F, 0x61, 0x73, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43,
-    0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x6D, 0x73, 0x67, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x2E, 0x63, 0x6C, 0x61, 0x73,
-    0x73, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x60, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2D,
-    0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x24, 0x7B, 0x74, 0x79, 0x70, 0x65, 0x7D, 0x60,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x2E,
-    0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x3D, 0x20,
-    0x27, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x28,
-    0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E,
-    0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x27, 0x6E, 0x6F, 0x6E, 0x65, 0x27,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x2C,
-    0x20, 0x33, 0x30, 0x30, 0x30, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
-    0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63,
-    0x49, 0x50, 0x28, 0x74, 0x79, 0x70, 0x65, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x69, 0x73, 0x44,
-    0x68, 0x63, 0x70, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x5B, 0x60,
-    0x24, 0x7B, 0x74, 0x79, 0x70, 0x65, 0x7D, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x60, 0x5D, 0x2E, 0x63,
-    0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x5B, 0x60, 0x24, 0x7B,
-    0x74, 0x79, 0x70, 0x65, 0x7D, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x5F, 0x69, 0x70, 0x5F,
-    0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x60, 0x5D, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x64,
-    0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x69, 0x73, 0x44, 0x68, 0x63, 0x70, 0x20,
-    0x3F, 0x20, 0x27, 0x6E, 0x6F, 0x6E, 0x65, 0x27, 0x20, 0x3A, 0x20, 0x27, 0x62, 0x6C, 0x6F, 0x63,
-    0x6B, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20,
+    0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x43,
+    0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
+    0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64,
+    0x28, 0x74, 0x61, 0x62, 0x49, 0x64, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65,
+    0x64, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x29, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74,
+    0x65, 0x64, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C,
+    0x69, 0x73, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x27, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x27,
+    0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x69, 0x66, 0x20, 0x28, 0x74, 0x61, 0x62, 0x49, 0x64, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x27, 0x73,
+    0x74, 0x61, 0x74, 0x75, 0x73, 0x27, 0x29, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x53, 0x74, 0x61,
+    0x74, 0x75, 0x73, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x61, 0x62, 0x49, 0x64, 0x20, 0x3D, 0x3D, 0x3D,
+    0x20, 0x27, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C, 0x27, 0x29, 0x20, 0x75, 0x70, 0x64, 0x61,
+    0x74, 0x65, 0x4D, 0x6F, 0x64, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x61,
+    0x62, 0x49, 0x64, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x27, 0x73, 0x74, 0x61, 0x27, 0x29, 0x20, 0x66,
+    0x65, 0x74, 0x63, 0x68, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x28, 0x29, 0x3B, 0x20, 0x2F, 0x2F,
+    0x20, 0x43, 0x61, 0x72, 0x67, 0x61, 0x72, 0x20, 0x6C, 0x61, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69,
+    0x67, 0x75, 0x72, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x61, 0x63, 0x74, 0x75, 0x61, 0x6C,
+    0x20, 0x61, 0x6C, 0x20, 0x63, 0x61, 0x6D, 0x62, 0x69, 0x61, 0x72, 0x20, 0x61, 0x20, 0x53, 0x54,
+    0x41, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+    0x20, 0x28, 0x74, 0x61, 0x62, 0x49, 0x64, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x27, 0x61, 0x70, 0x27,
+    0x29, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x28, 0x29, 0x3B,
+    0x20, 0x2F, 0x2F, 0x20, 0x43, 0x61, 0x72, 0x67, 0x61, 0x72, 0x20, 0x6C, 0x61, 0x20, 0x63, 0x6F,
+    0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x61, 0x63, 0x74,
+    0x75, 0x61, 0x6C, 0x20, 0x61, 0x6C, 0x20, 0x63, 0x61, 0x6D, 0x62, 0x69, 0x61, 0x72, 0x20, 0x61,
+    0x20, 0x41, 0x50, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x73, 0x68, 0x6F, 0x77, 0x54, 0x6F, 0x61, 0x73, 0x74, 0x28, 0x6D, 0x73, 0x67, 0x2C, 0x20, 0x74,
+    0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x27, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x27, 0x29,
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
+    0x6F, 0x6E, 0x73, 0x74, 0x20, 0x74, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+    0x73, 0x2E, 0x74, 0x6F, 0x61, 0x73, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65,
+    0x6E, 0x74, 0x20, 0x3D, 0x20, 0x6D, 0x73, 0x67, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D,
+    0x65, 0x20, 0x3D, 0x20, 0x60, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2D, 0x6D, 0x65, 0x73, 0x73,
+    0x61, 0x67, 0x65, 0x20, 0x24, 0x7B, 0x74, 0x79, 0x70, 0x65, 0x7D, 0x60, 0x3B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x2E, 0x73, 0x74, 0x79, 0x6C,
+    0x65, 0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x27, 0x62, 0x6C, 0x6F,
+    0x63, 0x6B, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x28, 0x28, 0x29, 0x20, 0x3D,
+    0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x74, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x64, 0x69, 0x73, 0x70,
+    0x6C, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x27, 0x6E, 0x6F, 0x6E, 0x65, 0x27, 0x3B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x2C, 0x20, 0x33, 0x30, 0x30,
+    0x30, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
-    0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x44, 0x48, 0x43, 0x50, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72,
-    0x28, 0x74, 0x79, 0x70, 0x65, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x73, 0x65, 0x44, 0x68,
-    0x63, 0x70, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
-    0x6E, 0x74, 0x73, 0x5B, 0x60, 0x24, 0x7B, 0x74, 0x79, 0x70, 0x65, 0x7D, 0x5F, 0x64, 0x68, 0x63,
-    0x70, 0x5F, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x60, 0x5D, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B,
+    0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x49, 0x50, 0x28, 0x74,
+    0x79, 0x70, 0x65, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x69, 0x73, 0x44, 0x68, 0x63, 0x70, 0x20,
+    0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x5B, 0x60, 0x24, 0x7B, 0x74, 0x79,
+    0x70, 0x65, 0x7D, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x60, 0x5D, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B,
     0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x5B, 0x60, 0x24, 0x7B, 0x74, 0x79, 0x70, 0x65,
-    0x7D, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x5F, 0x66, 0x69,
-    0x65, 0x6C, 0x64, 0x73, 0x60, 0x5D, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x64, 0x69, 0x73,
-    0x70, 0x6C, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x75, 0x73, 0x65, 0x44, 0x68, 0x63, 0x70, 0x53, 0x65,
-    0x72, 0x76, 0x65, 0x72, 0x20, 0x3F, 0x20, 0x27, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x27, 0x20, 0x3A,
-    0x20, 0x27, 0x6E, 0x6F, 0x6E, 0x65, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x43,
-    0x61, 0x72, 0x67, 0x61, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x63,
-    0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x69, 0x6E, 0x69, 0x63, 0x69, 0x61, 0x6C, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
-    0x69, 0x6F, 0x6E, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x28,
-    0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x74, 0x72, 0x79, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20,
-    0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F,
-    0x61, 0x70, 0x69, 0x2F, 0x77, 0x69, 0x66, 0x69, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x27,
-    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x72, 0x65, 0x73, 0x2E, 0x6F, 0x6B, 0x29, 0x20,
-    0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x28,
-    0x60, 0x48, 0x54, 0x54, 0x50, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x21, 0x20, 0x73, 0x74, 0x61,
-    0x74, 0x75, 0x73, 0x3A, 0x20, 0x24, 0x7B, 0x72, 0x65, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75,
-    0x73, 0x7D, 0x60, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E,
-    0x66, 0x69, 0x67, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x2E,
-    0x6A, 0x73, 0x6F, 0x6E, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x47, 0x65, 0x6E, 0x65,
-    0x72, 0x61, 0x6C, 0x20, 0x54, 0x61, 0x62, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x7D, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x5F, 0x69, 0x70, 0x5F, 0x66, 0x69, 0x65, 0x6C,
+    0x64, 0x73, 0x60, 0x5D, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C,
+    0x61, 0x79, 0x20, 0x3D, 0x20, 0x69, 0x73, 0x44, 0x68, 0x63, 0x70, 0x20, 0x3F, 0x20, 0x27, 0x6E,
+    0x6F, 0x6E, 0x65, 0x27, 0x20, 0x3A, 0x20, 0x27, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x27, 0x3B, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x67, 0x67,
+    0x6C, 0x65, 0x44, 0x48, 0x43, 0x50, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 0x28, 0x74, 0x79, 0x70,
+    0x65, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x73, 0x65, 0x44, 0x68, 0x63, 0x70, 0x53, 0x65,
+    0x72, 0x76, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x5B,
+    0x60, 0x24, 0x7B, 0x74, 0x79, 0x70, 0x65, 0x7D, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x73, 0x65,
+    0x72, 0x76, 0x65, 0x72, 0x60, 0x5D, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x3B, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x73, 0x5B, 0x60, 0x24, 0x7B, 0x74, 0x79, 0x70, 0x65, 0x7D, 0x5F, 0x64, 0x68,
+    0x63, 0x70, 0x5F, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x5F, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73,
+    0x60, 0x5D, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79,
+    0x20, 0x3D, 0x20, 0x75, 0x73, 0x65, 0x44, 0x68, 0x63, 0x70, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72,
+    0x20, 0x3F, 0x20, 0x27, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x27, 0x20, 0x3A, 0x20, 0x27, 0x6E, 0x6F,
+    0x6E, 0x65, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x43, 0x61, 0x72, 0x67, 0x61,
+    0x72, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E,
+    0x20, 0x69, 0x6E, 0x69, 0x63, 0x69, 0x61, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x66, 0x65, 0x74, 0x63, 0x68, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x28, 0x29, 0x20, 0x7B, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x79, 0x20,
+    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x77,
+    0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x61, 0x70, 0x69, 0x2F,
+    0x77, 0x69, 0x66, 0x69, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x27, 0x29, 0x3B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+    0x66, 0x20, 0x28, 0x21, 0x72, 0x65, 0x73, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x74, 0x68, 0x72, 0x6F,
+    0x77, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x60, 0x48, 0x54, 0x54,
+    0x50, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x21, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3A,
+    0x20, 0x24, 0x7B, 0x72, 0x65, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x7D, 0x60, 0x29,
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x20,
+    0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x2E, 0x6A, 0x73, 0x6F, 0x6E,
+    0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C, 0x20,
+    0x54, 0x61, 0x62, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x77, 0x69, 0x66,
+    0x69, 0x4D, 0x6F, 0x64, 0x65, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75,
+    0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x63, 0x75, 0x72, 0x72,
+    0x65, 0x6E, 0x74, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65,
+    0x4D, 0x6F, 0x64, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x28, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20,
+    0x53, 0x54, 0x41, 0x20, 0x54, 0x61, 0x62, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73,
-    0x2E, 0x77, 0x69, 0x66, 0x69, 0x4D, 0x6F, 0x64, 0x65, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x2E, 0x73, 0x74, 0x61, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
     0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E,
-    0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70,
-    0x64, 0x61, 0x74, 0x65, 0x4D, 0x6F, 0x64, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x28, 0x29, 0x3B, 0x0A,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x2F, 0x2F, 0x20, 0x53, 0x54, 0x41, 0x20, 0x54, 0x61, 0x62, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x73, 0x74, 0x61, 0x2E, 0x73, 0x73, 0x69, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x2E,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43,
+    0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F,
+    0x72, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61,
+    0x5F, 0x64, 0x68, 0x63, 0x70, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x20, 0x3D, 0x20,
+    0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x73, 0x74,
+    0x61, 0x2E, 0x75, 0x73, 0x65, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x69, 0x70, 0x2E, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69,
+    0x67, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x69, 0x70, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x6D, 0x61, 0x73, 0x6B, 0x2E, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69,
+    0x67, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x6D, 0x61, 0x73, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D,
-    0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x2E, 0x76, 0x61,
+    0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x67, 0x77, 0x2E, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69,
+    0x67, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x67, 0x77, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x6E, 0x73, 0x31, 0x2E, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69,
+    0x67, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x64, 0x6E, 0x73, 0x31, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x6E, 0x73, 0x32, 0x2E, 0x76, 0x61,
     0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E,
-    0x66, 0x69, 0x67, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x73, 0x73, 0x69, 0x64, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C,
-    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x70, 0x61, 0x73, 0x73, 0x77,
-    0x6F, 0x72, 0x64, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72,
-    0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x70, 0x61,
-    0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73,
-    0x2E, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65,
-    0x64, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69,
-    0x67, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x75, 0x73, 0x65, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x3B, 0x0A,
+    0x66, 0x69, 0x67, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x64, 0x6E, 0x73, 0x32, 0x3B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F,
+    0x67, 0x67, 0x6C, 0x65, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x49, 0x50, 0x28, 0x27, 0x73, 0x74,
+    0x61, 0x27, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x41, 0x50, 0x20, 0x54, 0x61, 0x62, 0x0A,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x69, 0x70, 0x2E,
-    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43,
-    0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x69, 0x70, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C,
-    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x6D, 0x61, 0x73, 0x6B, 0x2E,
-    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43,
-    0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x6D, 0x61, 0x73, 0x6B, 0x3B, 0x0A,
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x73, 0x73, 0x69, 0x64,
+    0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74,
+    0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61, 0x70, 0x2E, 0x73, 0x73, 0x69, 0x64, 0x3B, 0x0A,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x67, 0x77, 0x2E,
-    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43,
-    0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x67, 0x77, 0x3B, 0x0A, 0x20, 0x20,
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x70, 0x61, 0x73, 0x73,
+    0x77, 0x6F, 0x72, 0x64, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72,
+    0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61, 0x70, 0x2E, 0x70, 0x61,
+    0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73,
+    0x2E, 0x61, 0x70, 0x5F, 0x6D, 0x61, 0x78, 0x5F, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x73, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72,
+    0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61, 0x70, 0x2E, 0x6D, 0x61, 0x78,
+    0x5F, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3B, 0x0A, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C,
-    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x6E, 0x73, 0x31, 0x2E,
-    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43,
-    0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x64, 0x6E, 0x73, 0x31, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x6E, 0x73,
-    0x32, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
-    0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x64, 0x6E, 0x73, 0x32,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x49, 0x50,
-    0x28, 0x27, 0x73, 0x74, 0x61, 0x27, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x41, 0x50, 0x20,
-    0x54, 0x61, 0x62, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F,
-    0x73, 0x73, 0x69, 0x64, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72,
-    0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61, 0x70, 0x2E, 0x73, 0x73,
-    0x69, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F,
-    0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D,
-    0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61,
-    0x70, 0x2E, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D,
-    0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x6D, 0x61, 0x78, 0x5F, 0x63, 0x6F, 0x6E, 0x6E,
-    0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x73,
+    0x65, 0x72, 0x76, 0x65, 0x72, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x20, 0x3D, 0x20,
     0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61, 0x70,
-    0x2E, 0x6D, 0x61, 0x78, 0x5F, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x64, 0x68,
-    0x63, 0x70, 0x5F, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65,
-    0x64, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69,
-    0x67, 0x2E, 0x61, 0x70, 0x2E, 0x75, 0x73, 0x65, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x73, 0x65,
-    0x72, 0x76, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61,
-    0x70, 0x5F, 0x69, 0x70, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72,
-    0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61, 0x70, 0x2E, 0x69, 0x70,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x6D, 0x61,
-    0x73, 0x6B, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65,
-    0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61, 0x70, 0x2E, 0x6D, 0x61, 0x73, 0x6B,
+    0x2E, 0x75, 0x73, 0x65, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72,
     0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x67, 0x77,
+    0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x69, 0x70,
     0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74,
-    0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61, 0x70, 0x2E, 0x67, 0x77, 0x3B, 0x0A, 0x20, 0x20,
+    0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61, 0x70, 0x2E, 0x69, 0x70, 0x3B, 0x0A, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C,
-    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x64, 0x6E, 0x73, 0x31, 0x2E, 0x76,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x6D, 0x61, 0x73, 0x6B, 0x2E, 0x76,
     0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F,
-    0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61, 0x70, 0x2E, 0x64, 0x6E, 0x73, 0x31, 0x3B, 0x0A, 0x20, 0x20,
+    0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61, 0x70, 0x2E, 0x6D, 0x61, 0x73, 0x6B, 0x3B, 0x0A, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C,
-    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x64, 0x6E, 0x73, 0x32, 0x2E, 0x76,
-    0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F,
-    0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61, 0x70, 0x2E, 0x64, 0x6E, 0x73, 0x32, 0x3B, 0x0A, 0x20, 0x20,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x67, 0x77, 0x2E, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66,
+    0x69, 0x67, 0x2E, 0x61, 0x70, 0x2E, 0x67, 0x77, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x64, 0x6E, 0x73, 0x31, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67,
+    0x2E, 0x61, 0x70, 0x2E, 0x64, 0x6E, 0x73, 0x31, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x64, 0x6E, 0x73, 0x32, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67,
+    0x2E, 0x61, 0x70, 0x2E, 0x64, 0x6E, 0x73, 0x32, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65,
+    0x5F, 0x6D, 0x69, 0x6E, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72,
+    0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61, 0x70, 0x2E, 0x64, 0x68,
+    0x63, 0x70, 0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x69, 0x6E, 0x3B, 0x0A, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C,
     0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x72,
-    0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x69, 0x6E, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D,
+    0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x61, 0x78, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D,
     0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61,
-    0x70, 0x2E, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x69, 0x6E,
+    0x70, 0x2E, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x61, 0x78,
     0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x64, 0x68,
-    0x63, 0x70, 0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x61, 0x78, 0x2E, 0x76, 0x61, 0x6C,
-    0x75, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66,
-    0x69, 0x67, 0x2E, 0x61, 0x70, 0x2E, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65,
-    0x5F, 0x6D, 0x61, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x44, 0x48, 0x43, 0x50,
-    0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 0x28, 0x27, 0x61, 0x70, 0x27, 0x29, 0x3B, 0x0A, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x63, 0x61, 0x74,
-    0x63, 0x68, 0x20, 0x28, 0x65, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x54, 0x6F, 0x61,
-    0x73, 0x74, 0x28, 0x60, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x61, 0x6C, 0x20, 0x63, 0x61, 0x72,
-    0x67, 0x61, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x63, 0x69, 0xC3,
-    0xB3, 0x6E, 0x3A, 0x20, 0x24, 0x7B, 0x65, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x7D,
-    0x60, 0x2C, 0x20, 0x27, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73,
-    0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x65, 0x74,
-    0x63, 0x68, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x79, 0x20, 0x7B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-    0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74,
-    0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x61, 0x70, 0x69, 0x2F, 0x77, 0x69, 0x66,
-    0x69, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
-    0x21, 0x72, 0x65, 0x73, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x6E,
-    0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x60, 0x48, 0x54, 0x54, 0x50, 0x20, 0x65,
-    0x72, 0x72, 0x6F, 0x72, 0x21, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3A, 0x20, 0x24, 0x7B,
-    0x72, 0x65, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x7D, 0x60, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-    0x6F, 0x6E, 0x73, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69,
-    0x74, 0x20, 0x72, 0x65, 0x73, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C,
-    0x65, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x54, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x22, 0x22,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x63, 0x75,
-    0x72, 0x72, 0x65, 0x6E, 0x74, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x30, 0x3A, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x54, 0x65,
-    0x78, 0x74, 0x20, 0x3D, 0x20, 0x22, 0x41, 0x70, 0x61, 0x67, 0x61, 0x64, 0x6F, 0x20, 0x28, 0x4F,
-    0x46, 0x46, 0x29, 0x22, 0x3B, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x31, 0x3A, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x54, 0x65, 0x78,
-    0x74, 0x20, 0x3D, 0x20, 0x22, 0x45, 0x73, 0x74, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x28,
-    0x53, 0x54, 0x41, 0x29, 0x22, 0x3B, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x32, 0x3A, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x54, 0x65,
-    0x78, 0x74, 0x20, 0x3D, 0x20, 0x22, 0x50, 0x75, 0x6E, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x20, 0x41,
-    0x63, 0x63, 0x65, 0x73, 0x6F, 0x20, 0x28, 0x41, 0x50, 0x29, 0x22, 0x3B, 0x20, 0x62, 0x72, 0x65,
-    0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x33, 0x3A, 0x20,
-    0x6D, 0x6F, 0x64, 0x65, 0x54, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x22, 0x41, 0x50, 0x20, 0x2B,
-    0x20, 0x45, 0x73, 0x74, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x28, 0x41, 0x50, 0x53, 0x54,
-    0x41, 0x29, 0x22, 0x3B, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x3A, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x54, 0x65, 0x78,
-    0x74, 0x20, 0x3D, 0x20, 0x22, 0x44, 0x65, 0x73, 0x63, 0x6F, 0x6E, 0x6F, 0x63, 0x69, 0x64, 0x6F,
+    0x20, 0x20, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x44, 0x48, 0x43, 0x50, 0x53, 0x65, 0x72, 0x76,
+    0x65, 0x72, 0x28, 0x27, 0x61, 0x70, 0x27, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28,
+    0x65, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x54, 0x6F, 0x61, 0x73, 0x74, 0x28, 0x60,
+    0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x61, 0x6C, 0x20, 0x63, 0x61, 0x72, 0x67, 0x61, 0x72, 0x20,
+    0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x3A, 0x20,
+    0x24, 0x7B, 0x65, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x7D, 0x60, 0x2C, 0x20, 0x27,
+    0x65, 0x72, 0x72, 0x6F, 0x72, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D,
+    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20,
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x53, 0x74,
+    0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x79, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74,
+    0x20, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74,
+    0x63, 0x68, 0x28, 0x27, 0x2F, 0x61, 0x70, 0x69, 0x2F, 0x77, 0x69, 0x66, 0x69, 0x2F, 0x73, 0x74,
+    0x61, 0x74, 0x75, 0x73, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x72, 0x65, 0x73,
+    0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x45,
+    0x72, 0x72, 0x6F, 0x72, 0x28, 0x60, 0x48, 0x54, 0x54, 0x50, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
+    0x21, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3A, 0x20, 0x24, 0x7B, 0x72, 0x65, 0x73, 0x2E,
+    0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x7D, 0x60, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74,
+    0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65,
+    0x73, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x65, 0x74, 0x20, 0x6D,
+    0x6F, 0x64, 0x65, 0x54, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x22, 0x22, 0x3B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x77,
+    0x69, 0x74, 0x63, 0x68, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
+    0x74, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61,
+    0x73, 0x65, 0x20, 0x30, 0x3A, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x54, 0x65, 0x78, 0x74, 0x20, 0x3D,
+    0x20, 0x22, 0x41, 0x70, 0x61, 0x67, 0x61, 0x64, 0x6F, 0x20, 0x28, 0x4F, 0x46, 0x46, 0x29, 0x22,
+    0x3B, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73,
+    0x65, 0x20, 0x31, 0x3A, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x54, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20,
+    0x22, 0x45, 0x73, 0x74, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x28, 0x53, 0x54, 0x41, 0x29,
     0x22, 0x3B, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65,
-    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E,
-    0x49, 0x6E, 0x66, 0x6F, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D,
-    0x20, 0x60, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x70, 0x3E, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E,
-    0x67, 0x3E, 0x4D, 0x6F, 0x64, 0x6F, 0x20, 0x57, 0x69, 0x2D, 0x46, 0x69, 0x3A, 0x3C, 0x2F, 0x73,
-    0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x24, 0x7B, 0x6D, 0x6F, 0x64, 0x65, 0x54, 0x65, 0x78,
-    0x74, 0x7D, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x72, 0x20, 0x73,
-    0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A, 0x20, 0x30, 0x2E,
-    0x35, 0x72, 0x65, 0x6D, 0x20, 0x30, 0x3B, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20,
-    0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x74, 0x6F, 0x70,
-    0x3A, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28,
-    0x2D, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x29, 0x3B, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61,
+    0x73, 0x65, 0x20, 0x32, 0x3A, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x54, 0x65, 0x78, 0x74, 0x20, 0x3D,
+    0x20, 0x22, 0x50, 0x75, 0x6E, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x20, 0x41, 0x63, 0x63, 0x65, 0x73,
+    0x6F, 0x20, 0x28, 0x41, 0x50, 0x29, 0x22, 0x3B, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x70, 0x3E, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x45, 0x73, 0x74, 0x61,
-    0x64, 0x6F, 0x20, 0x53, 0x54, 0x41, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E,
-    0x20, 0x24, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x63, 0x6F, 0x6E, 0x6E,
-    0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x3F, 0x20, 0x27, 0xE2, 0x9C, 0x85, 0x20, 0x43, 0x6F, 0x6E,
-    0x65, 0x63, 0x74, 0x61, 0x64, 0x6F, 0x27, 0x20, 0x3A, 0x20, 0x27, 0xE2, 0x9D, 0x8C, 0x20, 0x44,
-    0x65, 0x73, 0x63, 0x6F, 0x6E, 0x65, 0x63, 0x74, 0x61, 0x64, 0x6F, 0x27, 0x7D, 0x3C, 0x2F, 0x70,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x70, 0x3E, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67,
-    0x3E, 0x53, 0x53, 0x49, 0x44, 0x20, 0x43, 0x6F, 0x6E, 0x65, 0x63, 0x74, 0x61, 0x64, 0x6F, 0x3A,
-    0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x24, 0x7B, 0x64, 0x61, 0x74, 0x61,
-    0x2E, 0x73, 0x74, 0x61, 0x5F, 0x73, 0x73, 0x69, 0x64, 0x20, 0x7C, 0x7C, 0x20, 0x27, 0x4E, 0x2F,
-    0x41, 0x27, 0x7D, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x70, 0x3E, 0x3C,
-    0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x49, 0x50, 0x20, 0x4C, 0x6F, 0x63, 0x61, 0x6C, 0x20,
-    0x53, 0x54, 0x41, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x24, 0x7B,
-    0x64, 0x61, 0x74, 0x61, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x69, 0x70, 0x20, 0x7C, 0x7C, 0x20, 0x27,
-    0x4E, 0x2F, 0x41, 0x27, 0x7D, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68,
-    0x72, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A,
-    0x20, 0x30, 0x2E, 0x35, 0x72, 0x65, 0x6D, 0x20, 0x30, 0x3B, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65,
-    0x72, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D,
-    0x74, 0x6F, 0x70, 0x3A, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76,
-    0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x29, 0x3B, 0x22, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x33, 0x3A, 0x20, 0x6D, 0x6F, 0x64, 0x65,
+    0x54, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x22, 0x41, 0x50, 0x20, 0x2B, 0x20, 0x45, 0x73, 0x74,
+    0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x28, 0x41, 0x50, 0x53, 0x54, 0x41, 0x29, 0x22, 0x3B,
+    0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x66, 0x61,
+    0x75, 0x6C, 0x74, 0x3A, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x54, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20,
+    0x22, 0x44, 0x65, 0x73, 0x63, 0x6F, 0x6E, 0x6F, 0x63, 0x69, 0x64, 0x6F, 0x22, 0x3B, 0x20, 0x62,
+    0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+    0x73, 0x2E, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x49, 0x6E, 0x66, 0x6F,
+    0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x60, 0x0A, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x70, 0x3E, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x43,
-    0x6C, 0x69, 0x65, 0x6E, 0x74, 0x65, 0x73, 0x20, 0x65, 0x6E, 0x20, 0x41, 0x50, 0x3A, 0x3C, 0x2F,
-    0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x24, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x61,
-    0x70, 0x5F, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x7C, 0x7C, 0x20, 0x30, 0x7D, 0x3C,
+    0x20, 0x20, 0x20, 0x3C, 0x70, 0x3E, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x4D, 0x6F,
+    0x64, 0x6F, 0x20, 0x57, 0x69, 0x2D, 0x46, 0x69, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E,
+    0x67, 0x3E, 0x20, 0x24, 0x7B, 0x6D, 0x6F, 0x64, 0x65, 0x54, 0x65, 0x78, 0x74, 0x7D, 0x3C, 0x2F,
+    0x70, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x72, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65,
+    0x3D, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A, 0x20, 0x30, 0x2E, 0x35, 0x72, 0x65, 0x6D,
+    0x20, 0x30, 0x3B, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65,
+    0x3B, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x74, 0x6F, 0x70, 0x3A, 0x20, 0x31, 0x70,
+    0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x62, 0x6F,
+    0x72, 0x64, 0x65, 0x72, 0x29, 0x3B, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x70, 0x3E,
+    0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x45, 0x73, 0x74, 0x61, 0x64, 0x6F, 0x20, 0x53,
+    0x54, 0x41, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x24, 0x7B, 0x64,
+    0x61, 0x74, 0x61, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x65,
+    0x64, 0x20, 0x3F, 0x20, 0x27, 0xE2, 0x9C, 0x85, 0x20, 0x43, 0x6F, 0x6E, 0x65, 0x63, 0x74, 0x61,
+    0x64, 0x6F, 0x27, 0x20, 0x3A, 0x20, 0x27, 0xE2, 0x9D, 0x8C, 0x20, 0x44, 0x65, 0x73, 0x63, 0x6F,
+    0x6E, 0x65, 0x63, 0x74, 0x61, 0x64, 0x6F, 0x27, 0x7D, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x70, 0x3E, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x53, 0x53, 0x49,
+    0x44, 0x20, 0x43, 0x6F, 0x6E, 0x65, 0x63, 0x74, 0x61, 0x64, 0x6F, 0x3A, 0x3C, 0x2F, 0x73, 0x74,
+    0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x24, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x73, 0x74, 0x61,
+    0x5F, 0x73, 0x73, 0x69, 0x64, 0x20, 0x7C, 0x7C, 0x20, 0x27, 0x4E, 0x2F, 0x41, 0x27, 0x7D, 0x3C,
     0x2F, 0x70, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x70, 0x3E, 0x3C, 0x73, 0x74, 0x72, 0x6F,
-    0x6E, 0x67, 0x3E, 0x53, 0x53, 0x49, 0x44, 0x20, 0x41, 0x50, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72,
-    0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x24, 0x7B, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F,
-    0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61, 0x70, 0x20, 0x3F, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
-    0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61, 0x70, 0x2E, 0x73, 0x73, 0x69, 0x64, 0x20,
-    0x3A, 0x20, 0x27, 0x4E, 0x2F, 0x41, 0x27, 0x7D, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x6E, 0x67, 0x3E, 0x49, 0x50, 0x20, 0x4C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x53, 0x54, 0x41, 0x3A,
+    0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x24, 0x7B, 0x64, 0x61, 0x74, 0x61,
+    0x2E, 0x73, 0x74, 0x61, 0x5F, 0x69, 0x70, 0x20, 0x7C, 0x7C, 0x20, 0x27, 0x4E, 0x2F, 0x41, 0x27,
+    0x7D, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x72, 0x20, 0x73, 0x74,
+    0x79, 0x6C, 0x65, 0x3D, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A, 0x20, 0x30, 0x2E, 0x35,
+    0x72, 0x65, 0x6D, 0x20, 0x30, 0x3B, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x6E,
+    0x6F, 0x6E, 0x65, 0x3B, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x74, 0x6F, 0x70, 0x3A,
+    0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D,
+    0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x29, 0x3B, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x70, 0x3E, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x49, 0x50, 0x20, 0x41,
-    0x50, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x24, 0x7B, 0x63, 0x75,
-    0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61, 0x70, 0x20, 0x3F,
-    0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61,
-    0x70, 0x2E, 0x69, 0x70, 0x20, 0x3A, 0x20, 0x27, 0x4E, 0x2F, 0x41, 0x27, 0x7D, 0x3C, 0x2F, 0x70,
-    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x60, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x29, 0x20, 0x7B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
-    0x68, 0x6F, 0x77, 0x54, 0x6F, 0x61, 0x73, 0x74, 0x28, 0x60, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20,
-    0x61, 0x6C, 0x20, 0x6F, 0x62, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x20, 0x65, 0x73, 0x74, 0x61, 0x64,
-    0x6F, 0x3A, 0x20, 0x24, 0x7B, 0x65, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x7D, 0x60,
-    0x2C, 0x20, 0x27, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x79,
-    0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x63, 0x61, 0x6E,
-    0x4E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
-    0x73, 0x2E, 0x73, 0x63, 0x61, 0x6E, 0x42, 0x74, 0x6E, 0x2E, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C,
-    0x65, 0x64, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E,
-    0x73, 0x63, 0x61, 0x6E, 0x42, 0x74, 0x6E, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74,
-    0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x27, 0x45, 0x73, 0x63, 0x61, 0x6E, 0x65, 0x61, 0x6E, 0x64,
-    0x6F, 0x2E, 0x2E, 0x2E, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x6E, 0x65, 0x74, 0x77,
-    0x6F, 0x72, 0x6B, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D,
-    0x4C, 0x20, 0x3D, 0x20, 0x60, 0x3C, 0x70, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x70,
-    0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x20, 0x63, 0x6F,
-    0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x2D,
-    0x6C, 0x69, 0x67, 0x68, 0x74, 0x29, 0x3B, 0x22, 0x3E, 0x42, 0x75, 0x73, 0x63, 0x61, 0x6E, 0x64,
-    0x6F, 0x20, 0x72, 0x65, 0x64, 0x65, 0x73, 0x2E, 0x2E, 0x2E, 0x3C, 0x2F, 0x70, 0x3E, 0x60, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x79,
-    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x61,
+    0x3C, 0x70, 0x3E, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x43, 0x6C, 0x69, 0x65, 0x6E,
+    0x74, 0x65, 0x73, 0x20, 0x65, 0x6E, 0x20, 0x41, 0x50, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F,
+    0x6E, 0x67, 0x3E, 0x20, 0x24, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x61, 0x70, 0x5F, 0x63, 0x6C,
+    0x69, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x7C, 0x7C, 0x20, 0x30, 0x7D, 0x3C, 0x2F, 0x70, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x70, 0x3E, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x53,
+    0x53, 0x49, 0x44, 0x20, 0x41, 0x50, 0x3A, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E,
+    0x20, 0x24, 0x7B, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67,
+    0x2E, 0x61, 0x70, 0x20, 0x3F, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E,
+    0x66, 0x69, 0x67, 0x2E, 0x61, 0x70, 0x2E, 0x73, 0x73, 0x69, 0x64, 0x20, 0x3A, 0x20, 0x27, 0x4E,
+    0x2F, 0x41, 0x27, 0x7D, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x70, 0x3E,
+    0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x49, 0x50, 0x20, 0x41, 0x50, 0x3A, 0x3C, 0x2F,
+    0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x20, 0x24, 0x7B, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
+    0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61, 0x70, 0x20, 0x3F, 0x20, 0x63, 0x75, 0x72,
+    0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x61, 0x70, 0x2E, 0x69, 0x70,
+    0x20, 0x3A, 0x20, 0x27, 0x4E, 0x2F, 0x41, 0x27, 0x7D, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0x3B,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x63,
+    0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x54,
+    0x6F, 0x61, 0x73, 0x74, 0x28, 0x60, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x61, 0x6C, 0x20, 0x6F,
+    0x62, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x20, 0x65, 0x73, 0x74, 0x61, 0x64, 0x6F, 0x3A, 0x20, 0x24,
+    0x7B, 0x65, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x7D, 0x60, 0x2C, 0x20, 0x27, 0x65,
+    0x72, 0x72, 0x6F, 0x72, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66,
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x63, 0x61, 0x6E, 0x4E, 0x65, 0x74, 0x77,
+    0x6F, 0x72, 0x6B, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x63,
+    0x61, 0x6E, 0x42, 0x74, 0x6E, 0x2E, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x3D,
+    0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x63, 0x61, 0x6E,
+    0x42, 0x74, 0x6E, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20,
+    0x3D, 0x20, 0x27, 0x45, 0x73, 0x63, 0x61, 0x6E, 0x65, 0x61, 0x6E, 0x64, 0x6F, 0x2E, 0x2E, 0x2E,
+    0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65,
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x4C,
+    0x69, 0x73, 0x74, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20,
+    0x60, 0x3C, 0x70, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x70, 0x61, 0x64, 0x64, 0x69,
+    0x6E, 0x67, 0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
+    0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x6C, 0x69, 0x67, 0x68,
+    0x74, 0x29, 0x3B, 0x22, 0x3E, 0x42, 0x75, 0x73, 0x63, 0x61, 0x6E, 0x64, 0x6F, 0x20, 0x72, 0x65,
+    0x64, 0x65, 0x73, 0x2E, 0x2E, 0x2E, 0x3C, 0x2F, 0x70, 0x3E, 0x60, 0x3B, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x79, 0x20, 0x7B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F,
+    0x2F, 0x20, 0x32, 0x30, 0x32, 0x3A, 0x20, 0x65, 0x6C, 0x20, 0x65, 0x73, 0x63, 0x61, 0x6E, 0x65,
+    0x6F, 0x20, 0x73, 0x69, 0x67, 0x75, 0x65, 0x20, 0x65, 0x6E, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6F,
+    0x20, 0x65, 0x6E, 0x20, 0x65, 0x6C, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69,
+    0x76, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x6C, 0x65, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61,
+    0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x61, 0x70, 0x69, 0x2F, 0x77,
+    0x69, 0x66, 0x69, 0x2F, 0x73, 0x63, 0x61, 0x6E, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C,
+    0x65, 0x20, 0x28, 0x72, 0x65, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x3D, 0x3D,
+    0x3D, 0x20, 0x32, 0x30, 0x32, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x77, 0x61,
+    0x69, 0x74, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x50, 0x72, 0x6F, 0x6D, 0x69, 0x73, 0x65, 0x28, 0x72,
+    0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x20, 0x3D, 0x3E, 0x20, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6D,
+    0x65, 0x6F, 0x75, 0x74, 0x28, 0x72, 0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x2C, 0x20, 0x35, 0x30,
+    0x30, 0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x61,
     0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x61, 0x70, 0x69,
     0x2F, 0x77, 0x69, 0x66, 0x69, 0x2F, 0x73, 0x63, 0x61, 0x6E, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
-    0x20, 0x28, 0x21, 0x72, 0x65, 0x73, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77,
-    0x20, 0x6E, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x60, 0x48, 0x54, 0x54, 0x50,
-    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x21, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3A, 0x20,
-    0x24, 0x7B, 0x72, 0x65, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x7D, 0x60, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x73, 0x20,
-    0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x2E, 0x6A, 0x73, 0x6F, 0x6E,
-    0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B,
-    0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20,
-    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x6E,
-    0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72,
-    0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x60, 0x3C, 0x70, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65,
-    0x3D, 0x22, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B,
-    0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65,
-    0x78, 0x74, 0x2D, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x29, 0x3B, 0x22, 0x3E, 0x4E, 0x6F, 0x20, 0x73,
-    0x65, 0x20, 0x65, 0x6E, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x61, 0x72, 0x6F, 0x6E, 0x20, 0x72, 0x65,
-    0x64, 0x65, 0x73, 0x2E, 0x3C, 0x2F, 0x70, 0x3E, 0x60, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73,
-    0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x69, 0x66, 0x20, 0x28, 0x21, 0x72, 0x65, 0x73, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x74, 0x68, 0x72,
+    0x6F, 0x77, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x60, 0x48, 0x54,
+    0x54, 0x50, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x21, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+    0x3A, 0x20, 0x24, 0x7B, 0x72, 0x65, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x7D, 0x60,
+    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B,
+    0x73, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x2E, 0x6A, 0x73,
+    0x6F, 0x6E, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x65, 0x74, 0x77, 0x6F,
+    0x72, 0x6B, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x30,
+    0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73,
     0x2E, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x69, 0x6E, 0x6E,
-    0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B,
-    0x73, 0x2E, 0x6D, 0x61, 0x70, 0x28, 0x6E, 0x20, 0x3D, 0x3E, 0x20, 0x60, 0x0A, 0x20, 0x20, 0x20,
+    0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x60, 0x3C, 0x70, 0x20, 0x73, 0x74, 0x79,
+    0x6C, 0x65, 0x3D, 0x22, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x31, 0x72, 0x65,
+    0x6D, 0x3B, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D,
+    0x74, 0x65, 0x78, 0x74, 0x2D, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x29, 0x3B, 0x22, 0x3E, 0x4E, 0x6F,
+    0x20, 0x73, 0x65, 0x20, 0x65, 0x6E, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x61, 0x72, 0x6F, 0x6E, 0x20,
+    0x72, 0x65, 0x64, 0x65, 0x73, 0x2E, 0x3C, 0x2F, 0x70, 0x3E, 0x60, 0x3B, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65,
+    0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x73, 0x2E, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x69,
+    0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x6E, 0x65, 0x74, 0x77, 0x6F,
+    0x72, 0x6B, 0x73, 0x2E, 0x6D, 0x61, 0x70, 0x28, 0x6E, 0x20, 0x3D, 0x3E, 0x20, 0x60, 0x0A, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
-    0x22, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x22, 0x20, 0x6F,
-    0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x4E, 0x65,
-    0x74, 0x77, 0x6F, 0x72, 0x6B, 0x28, 0x27, 0x24, 0x7B, 0x6E, 0x2E, 0x73, 0x73, 0x69, 0x64, 0x7D,
-    0x27, 0x29, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73,
+    0x73, 0x3D, 0x22, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x22,
+    0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74,
+    0x4E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x28, 0x27, 0x24, 0x7B, 0x6E, 0x2E, 0x73, 0x73, 0x69,
+    0x64, 0x7D, 0x27, 0x29, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x24, 0x7B, 0x6E, 0x2E, 0x73, 0x73, 0x69, 0x64, 0x7D,
-    0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x24, 0x7B, 0x6E, 0x2E, 0x73, 0x73, 0x69,
+    0x64, 0x7D, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D,
-    0x22, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x74, 0x65,
-    0x78, 0x74, 0x2D, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x29, 0x3B, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D,
-    0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20, 0x30, 0x2E, 0x38, 0x72, 0x65, 0x6D, 0x3B, 0x22, 0x3E, 0x24,
-    0x7B, 0x6E, 0x2E, 0x72, 0x73, 0x73, 0x69, 0x7D, 0x20, 0x64, 0x42, 0x6D, 0x20, 0x28, 0x24, 0x7B,
-    0x6E, 0x2E, 0x61, 0x75, 0x74, 0x68, 0x6D, 0x6F, 0x64, 0x65, 0x7D, 0x29, 0x3C, 0x2F, 0x73, 0x70,
-    0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69,
-    0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0x29, 0x2E, 0x6A, 0x6F, 0x69, 0x6E, 0x28, 0x27,
-    0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x29, 0x20, 0x7B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x73, 0x68, 0x6F, 0x77, 0x54, 0x6F, 0x61, 0x73, 0x74, 0x28, 0x60, 0x45, 0x72, 0x72, 0x6F, 0x72,
-    0x20, 0x65, 0x6E, 0x20, 0x65, 0x6C, 0x20, 0x65, 0x73, 0x63, 0x61, 0x6E, 0x65, 0x6F, 0x3A, 0x20,
-    0x24, 0x7B, 0x65, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x7D, 0x60, 0x2C, 0x20, 0x27,
-    0x65, 0x72, 0x72, 0x6F, 0x72, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x63, 0x61, 0x6E,
-    0x42, 0x74, 0x6E, 0x2E, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x66,
-    0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x63, 0x61, 0x6E, 0x42,
-    0x74, 0x6E, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D,
-    0x20, 0x27, 0x45, 0x73, 0x63, 0x61, 0x6E, 0x65, 0x61, 0x72, 0x20, 0x52, 0x65, 0x64, 0x65, 0x73,
-    0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73,
-    0x65, 0x6C, 0x65, 0x63, 0x74, 0x4E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x28, 0x73, 0x73, 0x69,
-    0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x73, 0x73,
-    0x69, 0x64, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x73, 0x73, 0x69, 0x64, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65,
-    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F,
-    0x72, 0x64, 0x2E, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
-    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x4D, 0x6F,
-    0x64, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6D, 0x6F, 0x64,
-    0x65, 0x20, 0x3D, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6E, 0x74, 0x28, 0x65, 0x6C, 0x65,
-    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x77, 0x69, 0x66, 0x69, 0x4D, 0x6F, 0x64, 0x65, 0x2E, 0x76,
-    0x61, 0x6C, 0x75, 0x65, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x6C, 0x65, 0x74, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x54, 0x65, 0x78, 0x74, 0x20,
-    0x3D, 0x20, 0x22, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 0x28, 0x6D, 0x6F, 0x64, 0x65, 0x29, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x73, 0x74, 0x79, 0x6C,
+    0x65, 0x3D, 0x22, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D,
+    0x74, 0x65, 0x78, 0x74, 0x2D, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x29, 0x3B, 0x20, 0x66, 0x6F, 0x6E,
+    0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20, 0x30, 0x2E, 0x38, 0x72, 0x65, 0x6D, 0x3B, 0x22,
+    0x3E, 0x24, 0x7B, 0x6E, 0x2E, 0x72, 0x73, 0x73, 0x69, 0x7D, 0x20, 0x64, 0x42, 0x6D, 0x20, 0x28,
+    0x24, 0x7B, 0x6E, 0x2E, 0x61, 0x75, 0x74, 0x68, 0x6D, 0x6F, 0x64, 0x65, 0x7D, 0x29, 0x3C, 0x2F,
+    0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F,
+    0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0x29, 0x2E, 0x6A, 0x6F, 0x69, 0x6E,
+    0x28, 0x27, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x29, 0x20,
     0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x30, 0x3A, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x54, 0x65,
-    0x78, 0x74, 0x20, 0x3D, 0x20, 0x22, 0x45, 0x6C, 0x20, 0x57, 0x69, 0x2D, 0x46, 0x69, 0x20, 0x65,
-    0x73, 0x74, 0x61, 0x72, 0xC3, 0xA1, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x61, 0x6D,
-    0x65, 0x6E, 0x74, 0x65, 0x20, 0x61, 0x70, 0x61, 0x67, 0x61, 0x64, 0x6F, 0x2E, 0x22, 0x3B, 0x20,
-    0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x31, 0x3A, 0x20, 0x69,
-    0x6E, 0x66, 0x6F, 0x54, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x22, 0x45, 0x6C, 0x20, 0x64, 0x69,
-    0x73, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x76, 0x6F, 0x20, 0x73, 0x65, 0x20, 0x63, 0x6F, 0x6E,
-    0x65, 0x63, 0x74, 0x61, 0x72, 0xC3, 0xA1, 0x20, 0x63, 0x6F, 0x6D, 0x6F, 0x20, 0x45, 0x73, 0x74,
-    0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x28, 0x53, 0x54, 0x41, 0x29, 0x20, 0x61, 0x20, 0x75,
-    0x6E, 0x61, 0x20, 0x72, 0x65, 0x64, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x74, 0x65,
-    0x2E, 0x22, 0x3B, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20,
-    0x32, 0x3A, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x54, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x22, 0x45,
-    0x6C, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x76, 0x6F, 0x20, 0x61, 0x63,
-    0x74, 0x75, 0x61, 0x72, 0xC3, 0xA1, 0x20, 0x63, 0x6F, 0x6D, 0x6F, 0x20, 0x50, 0x75, 0x6E, 0x74,
-    0x6F, 0x20, 0x64, 0x65, 0x20, 0x41, 0x63, 0x63, 0x65, 0x73, 0x6F, 0x20, 0x28, 0x41, 0x50, 0x29,
-    0x2C, 0x20, 0x63, 0x72, 0x65, 0x61, 0x6E, 0x64, 0x6F, 0x20, 0x73, 0x75, 0x20, 0x70, 0x72, 0x6F,
-    0x70, 0x69, 0x61, 0x20, 0x72, 0x65, 0x64, 0x2E, 0x22, 0x3B, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x33, 0x3A, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x54, 0x65,
-    0x78, 0x74, 0x20, 0x3D, 0x20, 0x22, 0x45, 0x6C, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6F, 0x73, 0x69,
-    0x74, 0x69, 0x76, 0x6F, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x69, 0x6F, 0x6E, 0x61, 0x72, 0xC3, 0xA1,
-    0x20, 0x73, 0x69, 0x6D, 0x75, 0x6C, 0x74, 0xC3, 0xA1, 0x6E, 0x65, 0x61, 0x6D, 0x65, 0x6E, 0x74,
-    0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6F, 0x20, 0x45, 0x73, 0x74, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E,
-    0x20, 0x79, 0x20, 0x50, 0x75, 0x6E, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x20, 0x41, 0x63, 0x63, 0x65,
-    0x73, 0x6F, 0x2E, 0x22, 0x3B, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E,
-    0x6D, 0x6F, 0x64, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E,
-    0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x54, 0x65, 0x78, 0x74, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-    0x6F, 0x6E, 0x20, 0x73, 0x61, 0x76, 0x65, 0x41, 0x6C, 0x6C, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67,
-    0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x73, 0x68, 0x6F, 0x77, 0x54, 0x6F, 0x61, 0x73, 0x74, 0x28, 0x27, 0x47, 0x75, 0x61, 0x72,
-    0x64, 0x61, 0x6E, 0x64, 0x6F, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x63,
-    0x69, 0xC3, 0xB3, 0x6E, 0x2E, 0x2E, 0x2E, 0x27, 0x2C, 0x20, 0x27, 0x6C, 0x6F, 0x61, 0x64, 0x69,
-    0x6E, 0x67, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x61, 0x76, 0x65, 0x43,
-    0x6F, 0x6E, 0x66, 0x69, 0x67, 0x42, 0x74, 0x6E, 0x2E, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65,
-    0x64, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x6F, 0x6E,
-    0x66, 0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75,
-    0x72, 0x72, 0x65, 0x6E, 0x74, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x20, 0x70, 0x61, 0x72, 0x73,
-    0x65, 0x49, 0x6E, 0x74, 0x28, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x77, 0x69,
-    0x66, 0x69, 0x4D, 0x6F, 0x64, 0x65, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x2C, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
-    0x74, 0x61, 0x3A, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x73, 0x69, 0x64, 0x3A, 0x20,
-    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x73, 0x73, 0x69,
-    0x64, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x73,
-    0x73, 0x77, 0x6F, 0x72, 0x64, 0x3A, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E,
-    0x73, 0x74, 0x61, 0x5F, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x2E, 0x76, 0x61, 0x6C,
-    0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x73, 0x65, 0x5F, 0x64, 0x68, 0x63, 0x70,
-    0x3A, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x64,
-    0x68, 0x63, 0x70, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x2C, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x2C, 0x0A,
+    0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x54, 0x6F, 0x61, 0x73, 0x74, 0x28, 0x60, 0x45, 0x72, 0x72,
+    0x6F, 0x72, 0x20, 0x65, 0x6E, 0x20, 0x65, 0x6C, 0x20, 0x65, 0x73, 0x63, 0x61, 0x6E, 0x65, 0x6F,
+    0x3A, 0x20, 0x24, 0x7B, 0x65, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x7D, 0x60, 0x2C,
+    0x20, 0x27, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x63,
+    0x61, 0x6E, 0x42, 0x74, 0x6E, 0x2E, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x3D,
+    0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x63, 0x61,
+    0x6E, 0x42, 0x74, 0x6E, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74,
+    0x20, 0x3D, 0x20, 0x27, 0x45, 0x73, 0x63, 0x61, 0x6E, 0x65, 0x61, 0x72, 0x20, 0x52, 0x65, 0x64,
+    0x65, 0x73, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x4E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x28, 0x73,
+    0x73, 0x69, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F,
+    0x73, 0x73, 0x69, 0x64, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x73, 0x73, 0x69,
+    0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65,
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x70, 0x61, 0x73, 0x73,
+    0x77, 0x6F, 0x72, 0x64, 0x2E, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65,
+    0x4D, 0x6F, 0x64, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6D,
+    0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6E, 0x74, 0x28, 0x65,
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x77, 0x69, 0x66, 0x69, 0x4D, 0x6F, 0x64, 0x65,
+    0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x65, 0x74, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x54, 0x65, 0x78,
+    0x74, 0x20, 0x3D, 0x20, 0x22, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 0x28, 0x6D, 0x6F, 0x64, 0x65,
+    0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x30, 0x3A, 0x20, 0x69, 0x6E, 0x66, 0x6F,
+    0x54, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x22, 0x45, 0x6C, 0x20, 0x57, 0x69, 0x2D, 0x46, 0x69,
+    0x20, 0x65, 0x73, 0x74, 0x61, 0x72, 0xC3, 0xA1, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74,
+    0x61, 0x6D, 0x65, 0x6E, 0x74, 0x65, 0x20, 0x61, 0x70, 0x61, 0x67, 0x61, 0x64, 0x6F, 0x2E, 0x22,
+    0x3B, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x31, 0x3A,
+    0x20, 0x69, 0x6E, 0x66, 0x6F, 0x54, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x22, 0x45, 0x6C, 0x20,
+    0x64, 0x69, 0x73, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x76, 0x6F, 0x20, 0x73, 0x65, 0x20, 0x63,
+    0x6F, 0x6E, 0x65, 0x63, 0x74, 0x61, 0x72, 0xC3, 0xA1, 0x20, 0x63, 0x6F, 0x6D, 0x6F, 0x20, 0x45,
+    0x73, 0x74, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x28, 0x53, 0x54, 0x41, 0x29, 0x20, 0x61,
+    0x20, 0x75, 0x6E, 0x61, 0x20, 0x72, 0x65, 0x64, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x65, 0x6E,
+    0x74, 0x65, 0x2E, 0x22, 0x3B, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73,
+    0x65, 0x20, 0x32, 0x3A, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x54, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20,
+    0x22, 0x45, 0x6C, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x76, 0x6F, 0x20,
+    0x61, 0x63, 0x74, 0x75, 0x61, 0x72, 0xC3, 0xA1, 0x20, 0x63, 0x6F, 0x6D, 0x6F, 0x20, 0x50, 0x75,
+    0x6E, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x20, 0x41, 0x63, 0x63, 0x65, 0x73, 0x6F, 0x20, 0x28, 0x41,
+    0x50, 0x29, 0x2C, 0x20, 0x63, 0x72, 0x65, 0x61, 0x6E, 0x64, 0x6F, 0x20, 0x73, 0x75, 0x20, 0x70,
+    0x72, 0x6F, 0x70, 0x69, 0x61, 0x20, 0x72, 0x65, 0x64, 0x2E, 0x22, 0x3B, 0x20, 0x62, 0x72, 0x65,
+    0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x33, 0x3A, 0x20, 0x69, 0x6E, 0x66, 0x6F,
+    0x54, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x22, 0x45, 0x6C, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6F,
+    0x73, 0x69, 0x74, 0x69, 0x76, 0x6F, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x69, 0x6F, 0x6E, 0x61, 0x72,
+    0xC3, 0xA1, 0x20, 0x73, 0x69, 0x6D, 0x75, 0x6C, 0x74, 0xC3, 0xA1, 0x6E, 0x65, 0x61, 0x6D, 0x65,
+    0x6E, 0x74, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6F, 0x20, 0x45, 0x73, 0x74, 0x61, 0x63, 0x69, 0xC3,
+    0xB3, 0x6E, 0x20, 0x79, 0x20, 0x50, 0x75, 0x6E, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x20, 0x41, 0x63,
+    0x63, 0x65, 0x73, 0x6F, 0x2E, 0x22, 0x3B, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+    0x73, 0x2E, 0x6D, 0x6F, 0x64, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43,
+    0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x54, 0x65, 0x78,
+    0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x61, 0x76, 0x65, 0x41, 0x6C, 0x6C, 0x43, 0x6F, 0x6E, 0x66,
+    0x69, 0x67, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x54, 0x6F, 0x61, 0x73, 0x74, 0x28, 0x27, 0x47, 0x75,
+    0x61, 0x72, 0x64, 0x61, 0x6E, 0x64, 0x6F, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72,
+    0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x2E, 0x2E, 0x2E, 0x27, 0x2C, 0x20, 0x27, 0x6C, 0x6F, 0x61,
+    0x64, 0x69, 0x6E, 0x67, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x61, 0x76,
+    0x65, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x42, 0x74, 0x6E, 0x2E, 0x64, 0x69, 0x73, 0x61, 0x62,
+    0x6C, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63,
+    0x6F, 0x6E, 0x66, 0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x20, 0x3D, 0x20, 0x7B, 0x0A,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x61, 0x70, 0x3A, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x73, 0x69, 0x64, 0x3A, 0x20,
-    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x73, 0x73, 0x69, 0x64,
-    0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x73, 0x73,
-    0x77, 0x6F, 0x72, 0x64, 0x3A, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61,
-    0x70, 0x5F, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x20, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x49, 0x6E, 0x74, 0x28, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E,
+    0x77, 0x69, 0x66, 0x69, 0x4D, 0x6F, 0x64, 0x65, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x2C,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x73, 0x74, 0x61, 0x3A, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x73, 0x69, 0x64,
+    0x3A, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x73,
+    0x73, 0x69, 0x64, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70,
+    0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x3A, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+    0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x2E, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x73, 0x65, 0x5F, 0x64, 0x68,
+    0x63, 0x70, 0x3A, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61,
+    0x5F, 0x64, 0x68, 0x63, 0x70, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x2C, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D,
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63,
-    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3A, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6E, 0x74, 0x28,
-    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x6D, 0x61, 0x78, 0x5F,
-    0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x76, 0x61, 0x6C, 0x75,
-    0x65, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x73, 0x65, 0x5F, 0x64, 0x68, 0x63, 0x70,
-    0x5F, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x3A, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
-    0x73, 0x2E, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72,
-    0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x65, 0x6C, 0x65,
-    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x2E, 0x63,
-    0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x61, 0x70, 0x3A, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x73, 0x69, 0x64,
+    0x3A, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x73, 0x73,
+    0x69, 0x64, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61,
+    0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x3A, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73,
+    0x2E, 0x61, 0x70, 0x5F, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x2E, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x63, 0x6F, 0x6E, 0x6E,
+    0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3A, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6E,
+    0x74, 0x28, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x6D, 0x61,
+    0x78, 0x5F, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x73, 0x65, 0x5F, 0x64, 0x68,
+    0x63, 0x70, 0x5F, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x3A, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x73, 0x65, 0x72, 0x76,
+    0x65, 0x72, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x3B, 0x0A, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x65,
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x68, 0x63, 0x70,
+    0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66,
+    0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x69, 0x70, 0x20,
+    0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x69,
+    0x70, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x54,
+    0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x6D, 0x61, 0x73, 0x6B, 0x20, 0x3D,
+    0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x6D, 0x61,
+    0x73, 0x6B, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67,
-    0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x69, 0x70, 0x20, 0x3D, 0x20,
-    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x69, 0x70, 0x2E,
+    0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x67, 0x77, 0x20, 0x3D, 0x20,
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x67, 0x77, 0x2E,
     0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x54, 0x6F, 0x53,
-    0x65, 0x6E, 0x64, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x6D, 0x61, 0x73, 0x6B, 0x20, 0x3D, 0x20, 0x65,
-    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x6D, 0x61, 0x73, 0x6B,
+    0x65, 0x6E, 0x64, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x64, 0x6E, 0x73, 0x31, 0x20, 0x3D, 0x20, 0x65,
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x6E, 0x73, 0x31,
     0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x54, 0x6F,
-    0x53, 0x65, 0x6E, 0x64, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x67, 0x77, 0x20, 0x3D, 0x20, 0x65, 0x6C,
-    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x67, 0x77, 0x2E, 0x76, 0x61,
-    0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E,
-    0x64, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x64, 0x6E, 0x73, 0x31, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65,
-    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x6E, 0x73, 0x31, 0x2E, 0x76,
+    0x53, 0x65, 0x6E, 0x64, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x64, 0x6E, 0x73, 0x32, 0x20, 0x3D, 0x20,
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x6E, 0x73,
+    0x32, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73,
+    0x2E, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x2E,
+    0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69,
+    0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x61, 0x70, 0x2E, 0x69, 0x70, 0x20, 0x3D, 0x20,
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x69, 0x70, 0x2E, 0x76,
     0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x54, 0x6F, 0x53, 0x65,
-    0x6E, 0x64, 0x2E, 0x73, 0x74, 0x61, 0x2E, 0x64, 0x6E, 0x73, 0x32, 0x20, 0x3D, 0x20, 0x65, 0x6C,
-    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x5F, 0x64, 0x6E, 0x73, 0x32, 0x2E,
-    0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61,
-    0x70, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x2E, 0x63, 0x68,
-    0x65, 0x63, 0x6B, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x54,
-    0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x61, 0x70, 0x2E, 0x69, 0x70, 0x20, 0x3D, 0x20, 0x65, 0x6C,
-    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x69, 0x70, 0x2E, 0x76, 0x61, 0x6C,
-    0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64,
-    0x2E, 0x61, 0x70, 0x2E, 0x6D, 0x61, 0x73, 0x6B, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
-    0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x6D, 0x61, 0x73, 0x6B, 0x2E, 0x76, 0x61, 0x6C, 0x75,
-    0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E,
-    0x61, 0x70, 0x2E, 0x67, 0x77, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73,
-    0x2E, 0x61, 0x70, 0x5F, 0x67, 0x77, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F,
-    0x6E, 0x66, 0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x61, 0x70, 0x2E, 0x64, 0x6E,
-    0x73, 0x31, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70,
-    0x5F, 0x64, 0x6E, 0x73, 0x31, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E,
-    0x66, 0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x61, 0x70, 0x2E, 0x64, 0x6E, 0x73,
-    0x32, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F,
-    0x64, 0x6E, 0x73, 0x32, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66,
-    0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x61, 0x70, 0x2E, 0x64, 0x68, 0x63, 0x70,
-    0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x69, 0x6E, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65,
-    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x72, 0x61,
-    0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x69, 0x6E, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20,
+    0x6E, 0x64, 0x2E, 0x61, 0x70, 0x2E, 0x6D, 0x61, 0x73, 0x6B, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x6D, 0x61, 0x73, 0x6B, 0x2E, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E,
+    0x64, 0x2E, 0x61, 0x70, 0x2E, 0x67, 0x77, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x67, 0x77, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x61, 0x70, 0x2E,
+    0x64, 0x6E, 0x73, 0x31, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E,
+    0x61, 0x70, 0x5F, 0x64, 0x6E, 0x73, 0x31, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
     0x6F, 0x6E, 0x66, 0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x61, 0x70, 0x2E, 0x64,
-    0x68, 0x63, 0x70, 0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x61, 0x78, 0x20, 0x3D, 0x20,
-    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63, 0x70,
-    0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x61, 0x78, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20,
-    0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x53, 0x69, 0x20, 0x65, 0x6C,
-    0x20, 0x73, 0x65, 0x72, 0x76, 0x69, 0x64, 0x6F, 0x72, 0x20, 0x44, 0x48, 0x43, 0x50, 0x20, 0x6E,
-    0x6F, 0x20, 0x65, 0x73, 0x74, 0xC3, 0xA1, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x6F, 0x2C, 0x20,
-    0x6C, 0x61, 0x73, 0x20, 0x49, 0x50, 0x73, 0x20, 0x64, 0x65, 0x6C, 0x20, 0x41, 0x50, 0x20, 0x64,
-    0x65, 0x62, 0x65, 0x6E, 0x20, 0x73, 0x65, 0x72, 0x20, 0x65, 0x73, 0x74, 0xC3, 0xA1, 0x74, 0x69,
-    0x63, 0x61, 0x73, 0x20, 0x79, 0x20, 0x73, 0x65, 0x20, 0x65, 0x6E, 0x76, 0xC3, 0xAD, 0x61, 0x6E,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x61,
-    0x70, 0x2E, 0x69, 0x70, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E,
-    0x61, 0x70, 0x5F, 0x69, 0x70, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20,
+    0x6E, 0x73, 0x32, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61,
+    0x70, 0x5F, 0x64, 0x6E, 0x73, 0x32, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F,
-    0x6E, 0x66, 0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x61, 0x70, 0x2E, 0x6D, 0x61,
-    0x73, 0x6B, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70,
-    0x5F, 0x6D, 0x61, 0x73, 0x6B, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F,
-    0x6E, 0x66, 0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x61, 0x70, 0x2E, 0x67, 0x77,
-    0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x67,
-    0x77, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67,
-    0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x61, 0x70, 0x2E, 0x64, 0x6E, 0x73, 0x31, 0x20, 0x3D,
-    0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x64, 0x6E, 0x73,
-    0x31, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67,
-    0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x61, 0x70, 0x2E, 0x64, 0x6E, 0x73, 0x32, 0x20, 0x3D,
-    0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x64, 0x6E, 0x73,
-    0x32, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x74, 0x72, 0x79, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73,
-    0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27,
-    0x2F, 0x61, 0x70, 0x69, 0x2F, 0x77, 0x69, 0x66, 0x69, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67,
-    0x27, 0x2C, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A,
-    0x20, 0x27, 0x50, 0x4F, 0x53, 0x54, 0x27, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x61,
-    0x64, 0x65, 0x72, 0x73, 0x3A, 0x20, 0x7B, 0x20, 0x27, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74,
-    0x2D, 0x54, 0x79, 0x70, 0x65, 0x27, 0x3A, 0x20, 0x27, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61,
-    0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x20, 0x7D, 0x2C, 0x0A, 0x20, 0x20,
+    0x6E, 0x66, 0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x61, 0x70, 0x2E, 0x64, 0x68,
+    0x63, 0x70, 0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x69, 0x6E, 0x20, 0x3D, 0x20, 0x65,
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x64, 0x68, 0x63, 0x70, 0x5F,
+    0x72, 0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x69, 0x6E, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x61, 0x70,
+    0x2E, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x61, 0x78, 0x20,
+    0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x64, 0x68,
+    0x63, 0x70, 0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x5F, 0x6D, 0x61, 0x78, 0x2E, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x53, 0x69, 0x20,
+    0x65, 0x6C, 0x20, 0x73, 0x65, 0x72, 0x76, 0x69, 0x64, 0x6F, 0x72, 0x20, 0x44, 0x48, 0x43, 0x50,
+    0x20, 0x6E, 0x6F, 0x20, 0x65, 0x73, 0x74, 0xC3, 0xA1, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x6F,
+    0x2C, 0x20, 0x6C, 0x61, 0x73, 0x20, 0x49, 0x50, 0x73, 0x20, 0x64, 0x65, 0x6C, 0x20, 0x41, 0x50,
+    0x20, 0x64, 0x65, 0x62, 0x65, 0x6E, 0x20, 0x73, 0x65, 0x72, 0x20, 0x65, 0x73, 0x74, 0xC3, 0xA1,
+    0x74, 0x69, 0x63, 0x61, 0x73, 0x20, 0x79, 0x20, 0x73, 0x65, 0x20, 0x65, 0x6E, 0x76, 0xC3, 0xAD,
+    0x61, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64,
+    0x2E, 0x61, 0x70, 0x2E, 0x69, 0x70, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+    0x73, 0x2E, 0x61, 0x70, 0x5F, 0x69, 0x70, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x3A, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x2E, 0x73, 0x74, 0x72,
-    0x69, 0x6E, 0x67, 0x69, 0x66, 0x79, 0x28, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x54, 0x6F, 0x53,
-    0x65, 0x6E, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x28, 0x72, 0x65, 0x73, 0x2E,
-    0x6F, 0x6B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x54, 0x6F,
-    0x61, 0x73, 0x74, 0x28, 0x27, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x63, 0x69,
-    0xC3, 0xB3, 0x6E, 0x20, 0x67, 0x75, 0x61, 0x72, 0x64, 0x61, 0x64, 0x61, 0x2E, 0x20, 0x52, 0x65,
-    0x69, 0x6E, 0x69, 0x63, 0x69, 0x61, 0x6E, 0x64, 0x6F, 0x20, 0x57, 0x69, 0x46, 0x69, 0x2E, 0x2E,
-    0x2E, 0x27, 0x2C, 0x20, 0x27, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x27, 0x29, 0x3B, 0x0A,
+    0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x61, 0x70, 0x2E,
+    0x6D, 0x61, 0x73, 0x6B, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E,
+    0x61, 0x70, 0x5F, 0x6D, 0x61, 0x73, 0x6B, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x56, 0x6F, 0x6C, 0x76, 0x65, 0x72, 0x20, 0x61, 0x20,
-    0x63, 0x61, 0x72, 0x67, 0x61, 0x72, 0x20, 0x65, 0x6C, 0x20, 0x65, 0x73, 0x74, 0x61, 0x64, 0x6F,
-    0x20, 0x79, 0x20, 0x6C, 0x61, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x63,
-    0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x64, 0x65, 0x73, 0x70, 0x75, 0xC3, 0xA9, 0x73, 0x20, 0x64, 0x65,
-    0x20, 0x75, 0x6E, 0x20, 0x72, 0x65, 0x69, 0x6E, 0x69, 0x63, 0x69, 0x6F, 0x20, 0x70, 0x6F, 0x74,
-    0x65, 0x6E, 0x63, 0x69, 0x61, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x54, 0x69,
-    0x6D, 0x65, 0x6F, 0x75, 0x74, 0x28, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20,
+    0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x61, 0x70, 0x2E,
+    0x67, 0x77, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70,
+    0x5F, 0x67, 0x77, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66,
+    0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x61, 0x70, 0x2E, 0x64, 0x6E, 0x73, 0x31,
+    0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x64,
+    0x6E, 0x73, 0x31, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66,
+    0x69, 0x67, 0x54, 0x6F, 0x53, 0x65, 0x6E, 0x64, 0x2E, 0x61, 0x70, 0x2E, 0x64, 0x6E, 0x73, 0x32,
+    0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x70, 0x5F, 0x64,
+    0x6E, 0x73, 0x32, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x74, 0x72, 0x79, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72,
+    0x65, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68,
+    0x28, 0x27, 0x2F, 0x61, 0x70, 0x69, 0x2F, 0x77, 0x69, 0x66, 0x69, 0x2F, 0x63, 0x6F, 0x6E, 0x66,
+    0x69, 0x67, 0x27, 0x2C, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F,
+    0x64, 0x3A, 0x20, 0x27, 0x50, 0x4F, 0x53, 0x54, 0x27, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68,
+    0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3A, 0x20, 0x7B, 0x20, 0x27, 0x43, 0x6F, 0x6E, 0x74, 0x65,
+    0x6E, 0x74, 0x2D, 0x54, 0x79, 0x70, 0x65, 0x27, 0x3A, 0x20, 0x27, 0x61, 0x70, 0x70, 0x6C, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x20, 0x7D, 0x2C, 0x0A,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x53, 0x74, 0x61, 0x74, 0x75,
-    0x73, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74,
-    0x63, 0x68, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x3A, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x2E, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x69, 0x66, 0x79, 0x28, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x54,
+    0x6F, 0x53, 0x65, 0x6E, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x28, 0x72, 0x65,
+    0x73, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77,
+    0x54, 0x6F, 0x61, 0x73, 0x74, 0x28, 0x27, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61,
+    0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x67, 0x75, 0x61, 0x72, 0x64, 0x61, 0x64, 0x61, 0x2E, 0x20,
+    0x52, 0x65, 0x69, 0x6E, 0x69, 0x63, 0x69, 0x61, 0x6E, 0x64, 0x6F, 0x20, 0x57, 0x69, 0x46, 0x69,
+    0x2E, 0x2E, 0x2E, 0x27, 0x2C, 0x20, 0x27, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x27, 0x29,
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x56, 0x6F, 0x6C, 0x76, 0x65, 0x72, 0x20,
+    0x61, 0x20, 0x63, 0x61, 0x72, 0x67, 0x61, 0x72, 0x20, 0x65, 0x6C, 0x20, 0x65, 0x73, 0x74, 0x61,
+    0x64, 0x6F, 0x20, 0x79, 0x20, 0x6C, 0x61, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72,
+    0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x64, 0x65, 0x73, 0x70, 0x75, 0xC3, 0xA9, 0x73, 0x20,
+    0x64, 0x65, 0x20, 0x75, 0x6E, 0x20, 0x72, 0x65, 0x69, 0x6E, 0x69, 0x63, 0x69, 0x6F, 0x20, 0x70,
+    0x6F, 0x74, 0x65, 0x6E, 0x63, 0x69, 0x61, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74,
+    0x54, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x28, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x7D, 0x2C, 0x20, 0x35, 0x30, 0x30, 0x30, 0x29, 0x3B, 0x20, 0x2F, 0x2F, 0x20, 0x44, 0x61, 0x72,
-    0x20, 0x74, 0x69, 0x65, 0x6D, 0x70, 0x6F, 0x20, 0x61, 0x6C, 0x20, 0x45, 0x53, 0x50, 0x33, 0x32,
-    0x20, 0x70, 0x61, 0x72, 0x61, 0x20, 0x72, 0x65, 0x69, 0x6E, 0x69, 0x63, 0x69, 0x61, 0x72, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x53, 0x74, 0x61,
+    0x74, 0x75, 0x73, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
+    0x65, 0x74, 0x63, 0x68, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E,
-    0x73, 0x74, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x54, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x61,
-    0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x54, 0x6F, 0x61, 0x73, 0x74, 0x28, 0x60,
-    0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x61, 0x6C, 0x20, 0x67, 0x75, 0x61, 0x72, 0x64, 0x61, 0x72,
-    0x3A, 0x20, 0x24, 0x7B, 0x72, 0x65, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x7D, 0x20,
-    0x2D, 0x20, 0x24, 0x7B, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x54, 0x65, 0x78, 0x74, 0x7D, 0x60, 0x2C,
-    0x20, 0x27, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68,
-    0x20, 0x28, 0x65, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x7D, 0x2C, 0x20, 0x35, 0x30, 0x30, 0x30, 0x29, 0x3B, 0x20, 0x2F, 0x2F, 0x20, 0x44,
+    0x61, 0x72, 0x20, 0x74, 0x69, 0x65, 0x6D, 0x70, 0x6F, 0x20, 0x61, 0x6C, 0x20, 0x45, 0x53, 0x50,
+    0x33, 0x32, 0x20, 0x70, 0x61, 0x72, 0x61, 0x20, 0x72, 0x65, 0x69, 0x6E, 0x69, 0x63, 0x69, 0x61,
+    0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
+    0x6F, 0x6E, 0x73, 0x74, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x54, 0x65, 0x78, 0x74, 0x20, 0x3D,
+    0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x28,
+    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x54, 0x6F, 0x61, 0x73, 0x74,
-    0x28, 0x60, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x64, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x65, 0x78,
-    0x69, 0xC3, 0xB3, 0x6E, 0x3A, 0x20, 0x24, 0x7B, 0x65, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67,
-    0x65, 0x7D, 0x60, 0x2C, 0x20, 0x27, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x27, 0x29, 0x3B, 0x0A, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
-    0x73, 0x2E, 0x73, 0x61, 0x76, 0x65, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x42, 0x74, 0x6E, 0x2E,
-    0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65,
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x49, 0x6E, 0x69, 0x63, 0x69, 0x61, 0x6C, 0x69,
-    0x7A, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x3A, 0x20, 0x43, 0x61, 0x72, 0x67, 0x61, 0x72, 0x20,
-    0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x20, 0x79,
-    0x20, 0x65, 0x73, 0x74, 0x61, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E,
-    0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x27, 0x44, 0x4F, 0x4D, 0x43, 0x6F,
-    0x6E, 0x74, 0x65, 0x6E, 0x74, 0x4C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x27, 0x2C, 0x20, 0x28, 0x29,
-    0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x28, 0x29, 0x3B,
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74,
-    0x63, 0x68, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
-    0x2E, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x41, 0x6C,
-    0x6C, 0x28, 0x27, 0x2E, 0x74, 0x61, 0x62, 0x27, 0x29, 0x2E, 0x66, 0x6F, 0x72, 0x45, 0x61, 0x63,
-    0x68, 0x28, 0x74, 0x61, 0x62, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x2E, 0x61,
-    0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28,
-    0x27, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x27, 0x2C, 0x20, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x73,
-    0x77, 0x69, 0x74, 0x63, 0x68, 0x54, 0x61, 0x62, 0x28, 0x74, 0x61, 0x62, 0x2E, 0x64, 0x61, 0x74,
-    0x61, 0x73, 0x65, 0x74, 0x2E, 0x74, 0x61, 0x62, 0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x41, 0x73, 0x65, 0x67, 0x75,
-    0x72, 0x61, 0x72, 0x73, 0x65, 0x20, 0x64, 0x65, 0x20, 0x71, 0x75, 0x65, 0x20, 0x6C, 0x6F, 0x73,
-    0x20, 0x63, 0x61, 0x6D, 0x70, 0x6F, 0x73, 0x20, 0x64, 0x65, 0x20, 0x49, 0x50, 0x20, 0x65, 0x73,
-    0x74, 0xC3, 0xA1, 0x74, 0x69, 0x63, 0x61, 0x20, 0x79, 0x20, 0x44, 0x48, 0x43, 0x50, 0x20, 0x73,
-    0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x73, 0x65, 0x20, 0x6D, 0x75, 0x65, 0x73, 0x74, 0x72, 0x65,
-    0x6E, 0x2F, 0x6F, 0x63, 0x75, 0x6C, 0x74, 0x65, 0x6E, 0x20, 0x63, 0x6F, 0x72, 0x72, 0x65, 0x63,
-    0x74, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x65, 0x20, 0x61, 0x6C, 0x20, 0x63, 0x61, 0x72, 0x67, 0x61,
-    0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F,
-    0x67, 0x67, 0x6C, 0x65, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x49, 0x50, 0x28, 0x27, 0x73, 0x74,
-    0x61, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x44, 0x48, 0x43, 0x50, 0x53, 0x65, 0x72, 0x76, 0x65,
-    0x72, 0x28, 0x27, 0x61, 0x70, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7D, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F,
-    0x20, 0x41, 0x63, 0x74, 0x69, 0x76, 0x61, 0x72, 0x20, 0x6C, 0x61, 0x20, 0x70, 0x65, 0x73, 0x74,
-    0x61, 0xC3, 0xB1, 0x61, 0x20, 0x27, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C, 0x27, 0x20, 0x70,
-    0x6F, 0x72, 0x20, 0x64, 0x65, 0x66, 0x65, 0x63, 0x74, 0x6F, 0x20, 0x65, 0x6E, 0x20, 0x6C, 0x75,
-    0x67, 0x61, 0x72, 0x20, 0x64, 0x65, 0x20, 0x27, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x27, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x28, 0x60, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x61, 0x6C, 0x20, 0x67, 0x75, 0x61, 0x72, 0x64,
+    0x61, 0x72, 0x3A, 0x20, 0x24, 0x7B, 0x72, 0x65, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+    0x7D, 0x20, 0x2D, 0x20, 0x24, 0x7B, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x54, 0x65, 0x78, 0x74, 0x7D,
+    0x60, 0x2C, 0x20, 0x27, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x63, 0x61, 0x74,
+    0x63, 0x68, 0x20, 0x28, 0x65, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x54, 0x6F, 0x61,
+    0x73, 0x74, 0x28, 0x60, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x64, 0x65, 0x20, 0x63, 0x6F, 0x6E,
+    0x65, 0x78, 0x69, 0xC3, 0xB3, 0x6E, 0x3A, 0x20, 0x24, 0x7B, 0x65, 0x2E, 0x6D, 0x65, 0x73, 0x73,
+    0x61, 0x67, 0x65, 0x7D, 0x60, 0x2C, 0x20, 0x27, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x27, 0x29, 0x3B,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x73, 0x2E, 0x73, 0x61, 0x76, 0x65, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x42, 0x74,
+    0x6E, 0x2E, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C,
+    0x73, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x49, 0x6E, 0x69, 0x63, 0x69, 0x61,
+    0x6C, 0x69, 0x7A, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E, 0x3A, 0x20, 0x43, 0x61, 0x72, 0x67, 0x61,
+    0x72, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x63, 0x69, 0xC3, 0xB3, 0x6E,
+    0x20, 0x79, 0x20, 0x65, 0x73, 0x74, 0x61, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76,
+    0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x27, 0x44, 0x4F, 0x4D,
+    0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x4C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x27, 0x2C, 0x20,
+    0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x28,
+    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
+    0x65, 0x74, 0x63, 0x68, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65,
+    0x6E, 0x74, 0x2E, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72,
+    0x41, 0x6C, 0x6C, 0x28, 0x27, 0x2E, 0x74, 0x61, 0x62, 0x27, 0x29, 0x2E, 0x66, 0x6F, 0x72, 0x45,
+    0x61, 0x63, 0x68, 0x28, 0x74, 0x61, 0x62, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62,
     0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65,
-    0x72, 0x28, 0x27, 0x44, 0x4F, 0x4D, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x4C, 0x6F, 0x61,
-    0x64, 0x65, 0x64, 0x27, 0x2C, 0x20, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68,
-    0x54, 0x61, 0x62, 0x28, 0x27, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C, 0x27, 0x29, 0x3B, 0x0A,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
-    0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x62, 0x6F, 0x64, 0x79,
-    0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E
+    0x72, 0x28, 0x27, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x27, 0x2C, 0x20, 0x28, 0x29, 0x20, 0x3D, 0x3E,
+    0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x54, 0x61, 0x62, 0x28, 0x74, 0x61, 0x62, 0x2E, 0x64,
+    0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x2E, 0x74, 0x61, 0x62, 0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29, 0x3B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x41, 0x73, 0x65,
+    0x67, 0x75, 0x72, 0x61, 0x72, 0x73, 0x65, 0x20, 0x64, 0x65, 0x20, 0x71, 0x75, 0x65, 0x20, 0x6C,
+    0x6F, 0x73, 0x20, 0x63, 0x61, 0x6D, 0x70, 0x6F, 0x73, 0x20, 0x64, 0x65, 0x20, 0x49, 0x50, 0x20,
+    0x65, 0x73, 0x74, 0xC3, 0xA1, 0x74, 0x69, 0x63, 0x61, 0x20, 0x79, 0x20, 0x44, 0x48, 0x43, 0x50,
+    0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x73, 0x65, 0x20, 0x6D, 0x75, 0x65, 0x73, 0x74,
+    0x72, 0x65, 0x6E, 0x2F, 0x6F, 0x63, 0x75, 0x6C, 0x74, 0x65, 0x6E, 0x20, 0x63, 0x6F, 0x72, 0x72,
+    0x65, 0x63, 0x74, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x65, 0x20, 0x61, 0x6C, 0x20, 0x63, 0x61, 0x72,
+    0x67, 0x61, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x49, 0x50, 0x28, 0x27,
+    0x73, 0x74, 0x61, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x44, 0x48, 0x43, 0x50, 0x53, 0x65, 0x72,
+    0x76, 0x65, 0x72, 0x28, 0x27, 0x61, 0x70, 0x27, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x7D, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x2F, 0x2F, 0x20, 0x41, 0x63, 0x74, 0x69, 0x76, 0x61, 0x72, 0x20, 0x6C, 0x61, 0x20, 0x70, 0x65,
+    0x73, 0x74, 0x61, 0xC3, 0xB1, 0x61, 0x20, 0x27, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C, 0x27,
+    0x20, 0x70, 0x6F, 0x72, 0x20, 0x64, 0x65, 0x66, 0x65, 0x63, 0x74, 0x6F, 0x20, 0x65, 0x6E, 0x20,
+    0x6C, 0x75, 0x67, 0x61, 0x72, 0x20, 0x64, 0x65, 0x20, 0x27, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+    0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65,
+    0x6E, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65,
+    0x6E, 0x65, 0x72, 0x28, 0x27, 0x44, 0x4F, 0x4D, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x4C,
+    0x6F, 0x61, 0x64, 0x65, 0x64, 0x27, 0x2C, 0x20, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x77, 0x69, 0x74,
+    0x63, 0x68, 0x54, 0x61, 0x62, 0x28, 0x27, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C, 0x27, 0x29,
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29, 0x3B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x62, 0x6F,
+    0x64, 0x79, 0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x00, 0x1F, 0x8B, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xCD, 0x3D, 0xDB, 0x72, 0xDB, 0x38, 0x96, 0xEF, 0xF9, 0x0A,
+    0x44, 0x3D, 0x53, 0x92, 0x66, 0x2D, 0x4A, 0x96, 0xE3, 0x74, 0x22, 0x5F, 0x66, 0xDD, 0xB1, 0x33,
+    0xF1, 0x56, 0x2E, 0xAE, 0xB6, 0x7B, 0x67, 0xA7, 0xBA, 0x52, 0x31, 0x4C, 0x42, 0x12, 0x3A, 0x14,
+    0xC9, 0x21, 0x29, 0x5F, 0x92, 0xF1, 0xE3, 0xBC, 0xCD, 0xDB, 0xBE, 0xEE, 0xD6, 0x56, 0x3F, 0xEE,
+    0xC3, 0x3E, 0x4C, 0xED, 0x27, 0xE4, 0x4F, 0xE6, 0x0B, 0xF6, 0x13, 0xF6, 0x1C, 0x00, 0xA4, 0x48,
+    0x10, 0x20, 0x29, 0xC7, 0x49, 0xB7, 0x3B, 0x95, 0x48, 0x04, 0x70, 0x70, 0x6E, 0x38, 0x37, 0x1C,
+    0xBA, 0x77, 0x1F, 0x1E, 0xBE, 0x79, 0x76, 0xF6, 0xA7, 0x93, 0x23, 0x32, 0x4F, 0x17, 0xFE, 0xFE,
+    0x83, 0x5D, 0xFC, 0x87, 0xF8, 0x34, 0x98, 0xED, 0x75, 0x58, 0xD2, 0xC1, 0x07, 0x8C, 0x7A, 0xFB,
+    0x0F, 0x08, 0xFC, 0xEC, 0x2E, 0x58, 0x4A, 0x89, 0x3B, 0xA7, 0x71, 0xC2, 0xD2, 0xBD, 0xCE, 0x0F,
+    0x67, 0xCF, 0x07, 0x4F, 0x3A, 0xC5, 0xA1, 0x80, 0x2E, 0xD8, 0x5E, 0xE7, 0x92, 0xB3, 0xAB, 0x28,
+    0x8C, 0xD3, 0x0E, 0x71, 0xC3, 0x20, 0x65, 0x01, 0x4C, 0xBD, 0xE2, 0x5E, 0x3A, 0xDF, 0xF3, 0xD8,
+    0x25, 0x77, 0xD9, 0x40, 0x7C, 0xD9, 0x20, 0x3C, 0xE0, 0x29, 0xA7, 0xFE, 0x20, 0x71, 0xA9, 0xCF,
+    0xF6, 0x36, 0x9D, 0x51, 0x06, 0x2A, 0xE5, 0xA9, 0xCF, 0xF6, 0x8F, 0x4E, 0x4F, 0xB6, 0xC6, 0xE4,
+    0x8F, 0x7C, 0xF0, 0x9C, 0x93, 0x57, 0x34, 0xA0, 0x33, 0x16, 0xEF, 0x0E, 0xE5, 0x90, 0x9C, 0x96,
+    0xA4, 0x37, 0xD9, 0x67, 0xFC, 0x99, 0xC4, 0x61, 0x98, 0x92, 0x8F, 0xF9, 0x77, 0xFC, 0x19, 0x0C,
+    0xA2, 0x98, 0x2F, 0x68, 0x7C, 0x33, 0x21, 0xDF, 0x8C, 0xB7, 0x1F, 0x6F, 0xB1, 0x8B, 0x1D, 0x6D,
+    0xFC, 0x62, 0x06, 0x43, 0xD3, 0x27, 0x53, 0x3A, 0x75, 0xF5, 0x21, 0x97, 0xC6, 0x1E, 0x0E, 0x8A,
+    0x1F, 0x7D, 0x30, 0x65, 0xD7, 0x29, 0x0C, 0x6E, 0xB2, 0xF1, 0xD3, 0xAD, 0x0B, 0xD3, 0xE0, 0xC0,
+    0xE7, 0xB3, 0x39, 0x4E, 0x79, 0xFC, 0xE8, 0xDB, 0x47, 0x4F, 0xAA, 0xFB, 0x86, 0xB1, 0xC7, 0x62,
+    0x18, 0x66, 0x63, 0xF6, 0x64, 0x3A, 0xD2, 0x87, 0x93, 0xA5, 0xEB, 0xB2, 0x24, 0x41, 0xB4, 0xC7,
+    0xEE, 0xF6, 0x36, 0xD3, 0xC7, 0x59, 0x1C, 0x87, 0x62, 0xF5, 0xF4, 0x11, 0xFC, 0xE8, 0xA3, 0x57,
+    0x34, 0x0E, 0x78, 0x20, 0x28, 0xDB, 0x7E, 0xCA, 0x46, 0x85, 0xCD, 0x6F, 0x1F, 0xE4, 0x1F, 0x2F,
+    0x42, 0xEF, 0x46, 0x63, 0xD7, 0x14, 0xC4, 0x35, 0x98, 0xD2, 0x05, 0xF7, 0x81, 0x61, 0xDD, 0x63,
+    0x90, 0x5D, 0xDC, 0xDD, 0x20, 0x09, 0x0D, 0x92, 0x41, 0xC2, 0x62, 0xAE, 0x31, 0xE1, 0x82, 0xBA,
+    0xEF, 0x67, 0x71, 0xB8, 0x0C, 0xBC, 0x81, 0x1B, 0xFA, 0x88, 0xCE, 0x25, 0x8D, 0x7B, 0xC8, 0xD2,
+    0x7E, 0x79, 0x62, 0x69, 0x14, 0x79, 0xA3, 0x8D, 0xFB, 0x3C, 0x60, 0x83, 0x39, 0x93, 0xFC, 0xDA,
+    0x74, 0xB6, 0xCB, 0xA3, 0x11, 0xF5, 0x3C, 0x41, 0xCC, 0x66, 0xCC, 0x16, 0x46, 0x4A, 0x1C, 0x54,
+    0x33, 0x0A, 0x40, 0x62, 0x8D, 0x9E, 0x05, 0xBD, 0x96, 0xCA, 0x36, 0x21, 0xDF, 0x8E, 0x46, 0xD1,
+    0xF5, 0x8E, 0x36, 0x1A, 0xCF, 0x78, 0x30, 0x21, 0x63, 0x80, 0x4B, 0xE8, 0x32, 0x0D, 0xDB, 0x91,
+    0x87, 0x6A, 0xA1, 0x11, 0x20, 0x85, 0x39, 0x88, 0xA9, 0xC7, 0x97, 0x20, 0xB3, 0x91, 0xF3, 0xED,
+    0x76, 0x09, 0x57, 0x39, 0xE7, 0x7A, 0x90, 0xCC, 0xA9, 0x17, 0x5E, 0xC1, 0x04, 0xB2, 0x09, 0xD8,
+    0x90, 0xCD, 0x6D, 0xF8, 0x6B, 0xB0, 0x05, 0x7F, 0xC5, 0xB3, 0x0B, 0xDA, 0x1B, 0x6D, 0x10, 0xF5,
+    0xC7, 0xD9, 0xEC, 0xC3, 0xDF, 0xE4, 0x11, 0x8C, 0x3C, 0xC6, 0x29, 0x63, 0xC3, 0x94, 0xD1, 0x76,
+    0xDF, 0xC2, 0xA7, 0xB1, 0x8D, 0x4F, 0x78, 0x90, 0x2B, 0x3C, 0x12, 0xBA, 0x4A, 0x41, 0x59, 0x81,
+    0x13, 0x2E, 0x43, 0x91, 0x9B, 0xB8, 0x04, 0xFA, 0x9A, 0xA6, 0xE1, 0x42, 0x07, 0x5E, 0x20, 0x3E,
+    0x9B, 0xB0, 0x09, 0xB8, 0x26, 0xA1, 0xCF, 0xBD, 0x4C, 0x1B, 0xC4, 0xB0, 0x19, 0xD7, 0xD5, 0xA2,
+    0x06, 0x94, 0xE7, 0x9B, 0x26, 0x4D, 0x4D, 0xF8, 0x07, 0x06, 0x18, 0x39, 0xE3, 0x2A, 0xB7, 0x4B,
+    0x12, 0x53, 0x36, 0xA0, 0x5F, 0x4B, 0xD8, 0xC8, 0xD9, 0x6E, 0x40, 0x22, 0xD2, 0x70, 0xA8, 0xA8,
+    0xB5, 0x3C, 0xF2, 0xDA, 0x36, 0x05, 0x4C, 0xED, 0x0A, 0x9C, 0xD2, 0x8B, 0x44, 0x83, 0xEE, 0xF1,
+    0x24, 0xF2, 0x29, 0x9C, 0xC3, 0xA9, 0xCF, 0xAE, 0x6B, 0x31, 0xDF, 0x74, 0x0C, 0xDA, 0xD6, 0xF6,
+    0x6C, 0x56, 0x54, 0xB7, 0x0A, 0x2B, 0x57, 0xAC, 0x91, 0x89, 0xD3, 0x45, 0xBD, 0xE6, 0x01, 0xF8,
+    0x05, 0xD4, 0x6E, 0xD0, 0x81, 0x46, 0x9D, 0xD5, 0xE8, 0xD7, 0x05, 0x0C, 0x54, 0x03, 0x69, 0x56,
+    0x4C, 0x0C, 0x27, 0xAC, 0x49, 0x93, 0xDD, 0x65, 0x9C, 0x20, 0x27, 0xA2, 0x90, 0x57, 0x07, 0x2B,
+    0x7C, 0xD8, 0x32, 0xED, 0x10, 0x83, 0x29, 0x04, 0xA7, 0x15, 0xC2, 0x0E, 0xD4, 0xF7, 0x91, 0x21,
+    0x09, 0x61, 0x34, 0x61, 0x03, 0x10, 0x47, 0xB8, 0x4C, 0x0D, 0x92, 0xBF, 0x52, 0x66, 0x6D, 0x7B,
+    0x34, 0xDA, 0xB9, 0x83, 0xF6, 0x2C, 0xC1, 0xEE, 0x82, 0xED, 0xF5, 0x99, 0x0B, 0x30, 0x82, 0x30,
+    0x60, 0x56, 0xFE, 0x4D, 0xE6, 0xE1, 0x65, 0xE5, 0x70, 0x5B, 0xD5, 0x40, 0x3F, 0x94, 0x1A, 0x30,
+    0x87, 0xBA, 0x29, 0xBF, 0x64, 0x2D, 0xA1, 0x19, 0x2C, 0x62, 0x8B, 0xF3, 0xA7, 0x19, 0x44, 0x50,
+    0x17, 0xBB, 0x25, 0xB4, 0x2A, 0xD4, 0x63, 0x3B, 0x0D, 0x03, 0x15, 0x7C, 0xD8, 0xCE, 0x55, 0x99,
+    0x9B, 0x15, 0x4F, 0x43, 0x46, 0x8D, 0x90, 0xCD, 0x5C, 0xCA, 0x37, 0xB8, 0xF0, 0x43, 0xF7, 0xBD,
+    0xC5, 0x61, 0x01, 0xC7, 0xAC, 0xCC, 0xFD, 0x6C, 0x47, 0x23, 0x23, 0x8B, 0x56, 0x86, 0xB8, 0xAD,
+    0x10, 0x6C, 0x8C, 0x32, 0x98, 0x8B, 0x06, 0xEB, 0x54, 0xB4, 0xAB, 0x5B, 0x4D, 0x16, 0xB5, 0xC6,
+    0x96, 0x9A, 0x6C, 0x91, 0xBE, 0xB5, 0xD5, 0xDE, 0x4E, 0xC3, 0x78, 0x31, 0x40, 0x6E, 0x47, 0x95,
+    0x88, 0xA1, 0x1D, 0x04, 0x9F, 0x5E, 0x30, 0xBF, 0xA5, 0xE0, 0x35, 0xCC, 0x47, 0xCE, 0x13, 0x83,
+    0xD4, 0xEA, 0x8D, 0x45, 0xC5, 0x57, 0x35, 0xB9, 0x3C, 0x8D, 0x79, 0x05, 0xCC, 0x79, 0x10, 0x2D,
+    0xD3, 0x1F, 0xD3, 0x9B, 0x08, 0x02, 0x75, 0x9C, 0xD5, 0x79, 0xBB, 0x61, 0x1C, 0x8B, 0x68, 0x92,
+    0x5C, 0x81, 0xCA, 0xD8, 0xC6, 0x83, 0xE5, 0xE2, 0x82, 0xC5, 0xC5, 0x51, 0x69, 0xA6, 0x34, 0xA6,
+    0xA8, 0xF0, 0x6B, 0x73, 0x34, 0xFA, 0x6D, 0xBD, 0x2D, 0xD7, 0x78, 0x7D, 0x07, 0x4D, 0x6E, 0x61,
+    0xC0, 0xAD, 0xCE, 0xF8, 0x5E, 0xE3, 0xD9, 0xA2, 0x9B, 0x50, 0x68, 0x89, 0x25, 0xC2, 0x5F, 0xB4,
+    0x14, 0xCA, 0x64, 0x1A, 0xBA, 0xCB, 0xA4, 0x49, 0x34, 0x75, 0xB3, 0x32, 0x01, 0xE9, 0x73, 0x94,
+    0x37, 0x11, 0x4F, 0x35, 0x61, 0x81, 0x0B, 0xC3, 0x58, 0xDC, 0x64, 0x1B, 0x8B, 0x74, 0xAC, 0x63,
+    0xD7, 0xF1, 0xBF, 0xDC, 0x72, 0x6F, 0x7D, 0xBB, 0x41, 0x9E, 0x3E, 0xDD, 0x20, 0xE3, 0xAD, 0x6D,
+    0x34, 0x2B, 0xE3, 0x66, 0x0D, 0x75, 0xE7, 0xCC, 0x7D, 0x0F, 0x10, 0x3B, 0x6F, 0xCD, 0x07, 0x35,
+    0x96, 0x07, 0xA6, 0x26, 0x78, 0x73, 0xE2, 0xF0, 0xCA, 0x76, 0x50, 0x67, 0x31, 0xF7, 0xCA, 0xC8,
+    0xE3, 0x13, 0x10, 0xE9, 0x02, 0xC6, 0x53, 0x86, 0xD4, 0x2E, 0x17, 0x01, 0x68, 0xD3, 0xE6, 0x54,
+    0x0B, 0x17, 0x66, 0x34, 0xAA, 0xB1, 0x0E, 0xFF, 0xBC, 0x60, 0x1E, 0xA7, 0xA4, 0xB7, 0x00, 0x0C,
+    0xD5, 0x01, 0x78, 0x8C, 0xF9, 0x47, 0x5F, 0x43, 0xC4, 0x80, 0x5B, 0x3D, 0x12, 0x55, 0x44, 0x6E,
+    0x8D, 0xA9, 0xDD, 0x12, 0xEC, 0x44, 0x70, 0xF7, 0x93, 0xB8, 0x46, 0x40, 0x69, 0xD6, 0x01, 0x35,
+    0xE5, 0x6A, 0xCE, 0x53, 0x66, 0x3E, 0xD3, 0x56, 0x0D, 0x6B, 0x71, 0x80, 0x33, 0x33, 0xF9, 0xB8,
+    0x12, 0x53, 0xD5, 0x45, 0x78, 0xA5, 0x53, 0xA9, 0x51, 0x53, 0x89, 0xE4, 0x36, 0xE4, 0x74, 0xF4,
+    0x13, 0xE8, 0xFF, 0x6A, 0xA2, 0x3C, 0xA5, 0x88, 0x69, 0x58, 0xA7, 0x10, 0x52, 0x20, 0x2D, 0x43,
+    0xB4, 0x6F, 0x36, 0xD9, 0xA3, 0x11, 0x9D, 0xEE, 0x90, 0xE1, 0xEF, 0xC8, 0x21, 0x8D, 0xDF, 0x63,
+    0xEA, 0x21, 0xB9, 0x4C, 0x7E, 0x37, 0xAC, 0x92, 0x84, 0x38, 0x4E, 0xE4, 0x47, 0xD4, 0x97, 0x3F,
+    0xF5, 0x06, 0x60, 0x2F, 0xFB, 0x75, 0x68, 0x80, 0xFE, 0xD3, 0x0B, 0x9F, 0xE9, 0x11, 0x48, 0x18,
+    0x51, 0x97, 0xA7, 0x37, 0xC8, 0xFA, 0xC7, 0x66, 0xBE, 0x06, 0x21, 0x06, 0xD8, 0x7E, 0x78, 0xC5,
+    0xBC, 0xCF, 0xD1, 0x8E, 0x02, 0xDA, 0xD6, 0x90, 0x56, 0xA2, 0xEA, 0x24, 0x0C, 0x62, 0x2D, 0x0F,
+    0x49, 0x6F, 0x17, 0x8A, 0x1A, 0x03, 0xE9, 0x1A, 0xB0, 0x6D, 0x45, 0xF2, 0xE8, 0x62, 0x7B, 0xFB,
+    0xF1, 0x56, 0x51, 0x24, 0x2B, 0xCC, 0x0A, 0x42, 0x29, 0xDA, 0x9D, 0x80, 0xA5, 0x60, 0xA4, 0xDF,
+    0x03, 0x36, 0x49, 0x6A, 0x36, 0x5E, 0x06, 0x9D, 0xF9, 0x32, 0x6E, 0x0F, 0xEB, 0x20, 0x59, 0x7D,
+    0x65, 0xBC, 0x5D, 0x29, 0x84, 0x20, 0x0B, 0xA6, 0x20, 0xD5, 0x01, 0xC8, 0xBE, 0x7D, 0x1D, 0xA4,
+    0xE4, 0x16, 0x4D, 0x84, 0xC3, 0xD9, 0x5F, 0x68, 0x84, 0xB7, 0x76, 0xFA, 0xEB, 0x95, 0x13, 0x6A,
+    0xCF, 0x7D, 0x4D, 0x22, 0xFD, 0xD3, 0x32, 0x49, 0xF9, 0xF4, 0x26, 0x8B, 0xE7, 0x27, 0x24, 0x81,
+    0x23, 0xC0, 0x06, 0x17, 0x40, 0x00, 0x63, 0x41, 0x79, 0xAE, 0x48, 0x2C, 0x05, 0x4D, 0x89, 0x39,
+    0xBD, 0x6C, 0xB0, 0x2F, 0x9B, 0x49, 0x33, 0xB7, 0x26, 0x3E, 0x4D, 0xD2, 0x81, 0x3B, 0xE7, 0x7E,
+    0x25, 0x3B, 0x28, 0x73, 0xC5, 0x9E, 0x09, 0x96, 0xC0, 0xDD, 0x5B, 0x4A, 0x58, 0x12, 0x29, 0x30,
+    0x29, 0x98, 0x4C, 0x79, 0x6C, 0x41, 0xD5, 0x1E, 0xC9, 0xD6, 0x43, 0xB4, 0xD2, 0x5E, 0x8E, 0x9D,
+    0x9B, 0xE3, 0xDE, 0xBA, 0xF3, 0xFF, 0x4D, 0x1A, 0xD2, 0xCA, 0x71, 0x8C, 0xC2, 0x4C, 0x6E, 0x53,
+    0x7E, 0x5D, 0x31, 0x6D, 0xD6, 0xC2, 0x97, 0xCF, 0xA6, 0x82, 0xC2, 0xDF, 0xEE, 0x34, 0x1A, 0xE5,
+    0x7F, 0xEB, 0x0D, 0x60, 0x5E, 0xFF, 0x2E, 0x7E, 0xB7, 0xB9, 0x3E, 0x63, 0x77, 0xB6, 0xF5, 0x49,
+    0x45, 0x4D, 0x26, 0x4C, 0x03, 0xB0, 0xDB, 0x92, 0x25, 0x09, 0x9C, 0x3D, 0xF6, 0x43, 0x84, 0x96,
+    0x45, 0x7A, 0xC1, 0xF2, 0xCC, 0x0F, 0xE0, 0x14, 0x3D, 0x51, 0xAA, 0x19, 0x59, 0x44, 0x2D, 0x59,
+    0xEE, 0xA8, 0x8A, 0x36, 0xF9, 0x68, 0xD5, 0x40, 0x35, 0xA3, 0xBF, 0x53, 0x08, 0x6A, 0xD4, 0x62,
+    0x51, 0xEE, 0xAE, 0x59, 0x2A, 0xC6, 0x4D, 0x0B, 0xFD, 0x90, 0x22, 0x8F, 0x6B, 0x96, 0xAA, 0x5A,
+    0xB9, 0x58, 0xBC, 0x0A, 0xE0, 0xDE, 0xB3, 0x9B, 0x69, 0x4C, 0x17, 0x2C, 0xC9, 0xE9, 0xD7, 0x74,
+    0x32, 0x0E, 0x17, 0x86, 0xC8, 0xCD, 0x24, 0x7B, 0x21, 0xFA, 0x0D, 0x11, 0x77, 0x69, 0x0A, 0x50,
+    0x76, 0xBA, 0xB6, 0xB8, 0x4E, 0xC0, 0x0D, 0xD7, 0xDB, 0x6C, 0x54, 0xB7, 0xD3, 0xA6, 0x3D, 0x82,
+    0x14, 0xF7, 0x2A, 0x43, 0x75, 0xB1, 0xB2, 0x3B, 0x94, 0x37, 0x3F, 0xBB, 0x78, 0x53, 0xA0, 0xEE,
+    0x5C, 0x3C, 0x7E, 0x49, 0x5C, 0x38, 0xA9, 0x09, 0x84, 0xE6, 0x59, 0xD1, 0xBD, 0xB3, 0xBA, 0x83,
+    0xD9, 0x95, 0xA5, 0xD2, 0xFD, 0xD2, 0x06, 0xBB, 0xF3, 0xCD, 0xFD, 0xFF, 0xFB, 0xAF, 0x7F, 0xFF,
+    0x99, 0x18, 0x6F, 0x74, 0x60, 0xB0, 0x3C, 0x3B, 0xDA, 0x7F, 0x16, 0x06, 0x53, 0x3E, 0x5B, 0xC6,
+    0x80, 0xEF, 0xA7, 0xFF, 0x0D, 0x08, 0xBD, 0xA4, 0xC1, 0x07, 0xEA, 0x51, 0xE2, 0x31, 0x12, 0x33,
+    0x6F, 0x77, 0x18, 0x15, 0x36, 0x1C, 0x66, 0x3B, 0xAE, 0x1E, 0x15, 0x70, 0xC4, 0xBA, 0x6A, 0x47,
+    0x83, 0x5F, 0x1E, 0x26, 0xB2, 0x86, 0xD3, 0x21, 0x1E, 0x4D, 0xE9, 0x00, 0x1E, 0xEC, 0x75, 0x92,
+    0x94, 0xA6, 0x4B, 0x58, 0x76, 0x04, 0x1F, 0xBC, 0x70, 0x77, 0x08, 0x0B, 0x6A, 0x41, 0x68, 0x6B,
+    0xE5, 0x42, 0x89, 0x7A, 0xEF, 0xF4, 0xEC, 0xA0, 0xBF, 0x1E, 0x04, 0x1A, 0x75, 0xF6, 0x4F, 0x96,
+    0x01, 0x48, 0x1C, 0xC8, 0x3D, 0xC0, 0x13, 0x11, 0x92, 0xDE, 0xC1, 0xC9, 0x9A, 0x50, 0x66, 0x0C,
+    0x04, 0x43, 0xFD, 0xCE, 0xFE, 0x1F, 0xE4, 0x07, 0x6D, 0xB5, 0xFA, 0xBA, 0xFA, 0xFE, 0x70, 0x30,
+    0x20, 0x6A, 0x2A, 0x39, 0x65, 0x69, 0x0A, 0x27, 0x22, 0x21, 0x67, 0xC0, 0x9E, 0xC1, 0x60, 0xBF,
+    0xCC, 0x59, 0xEE, 0xAD, 0xA0, 0x17, 0x36, 0xCF, 0x7C, 0x68, 0x0D, 0xB7, 0xB1, 0x9E, 0xA5, 0x0D,
+    0x4B, 0xF5, 0xD8, 0xDA, 0x7F, 0x15, 0x7A, 0x82, 0xDE, 0x37, 0x11, 0xCB, 0xA4, 0x2E, 0xD4, 0x04,
+    0xC4, 0xBB, 0x65, 0x58, 0x51, 0x00, 0xBA, 0xAA, 0xE4, 0x18, 0x40, 0x8B, 0xC9, 0xB2, 0x54, 0x03,
+    0xF3, 0xF0, 0x16, 0x72, 0xCA, 0x61, 0x2B, 0xD6, 0xD9, 0x3F, 0xC5, 0x24, 0xD8, 0x05, 0x03, 0x47,
+    0x63, 0x82, 0x9B, 0x4F, 0x76, 0x87, 0x62, 0x9E, 0x05, 0x86, 0x2A, 0x6D, 0x20, 0xED, 0x39, 0x0C,
+    0x12, 0x06, 0xEE, 0x9C, 0x06, 0x33, 0xC8, 0x52, 0x97, 0x11, 0x70, 0x9E, 0xE1, 0xD3, 0xE3, 0x60,
+    0x1A, 0xF6, 0xFA, 0x16, 0x54, 0x04, 0xA8, 0x30, 0x42, 0xBB, 0x0A, 0xC6, 0xC7, 0x5F, 0xC2, 0xCA,
+    0x51, 0x67, 0xFF, 0x20, 0xA2, 0x33, 0xD0, 0x33, 0xD2, 0x7B, 0xF3, 0xFC, 0x39, 0x48, 0x59, 0x8E,
+    0xB7, 0x06, 0xB0, 0x69, 0x50, 0xB7, 0x35, 0x41, 0x8C, 0x6D, 0x0A, 0xB7, 0x26, 0x9C, 0x2D, 0xA0,
+    0xE5, 0x84, 0xFC, 0x13, 0x29, 0xE0, 0x73, 0x70, 0xD2, 0x8C, 0x11, 0xD8, 0x1B, 0xC1, 0x5D, 0x83,
+    0x9C, 0xAB, 0x2A, 0x5F, 0x52, 0xC3, 0x85, 0x62, 0x78, 0x87, 0x08, 0x8B, 0x05, 0x0F, 0xF4, 0xB8,
+    0xDA, 0x1E, 0x1C, 0x74, 0xF6, 0x4D, 0x07, 0xAA, 0xC5, 0x29, 0x39, 0x15, 0xD6, 0xC1, 0x7E, 0x36,
+    0x94, 0xF5, 0x30, 0x1C, 0x8D, 0xCC, 0xD4, 0xDC, 0xE9, 0x84, 0x20, 0x9D, 0xF1, 0x42, 0xF1, 0x15,
+    0x04, 0x05, 0x36, 0x92, 0x5D, 0xE3, 0x97, 0x9A, 0x23, 0x82, 0xE8, 0xC0, 0xDE, 0x01, 0x30, 0x17,
+    0xB8, 0xDF, 0xC0, 0xA9, 0x72, 0x51, 0x44, 0x16, 0x38, 0x54, 0xB4, 0x51, 0x8E, 0xC0, 0x9E, 0x8A,
+    0x67, 0xB6, 0xD3, 0x06, 0xD6, 0x1B, 0x40, 0xD3, 0x00, 0x14, 0x9A, 0x17, 0x50, 0x76, 0x1C, 0xA7,
+    0x64, 0xB7, 0x9B, 0x44, 0xAC, 0x2A, 0x18, 0x70, 0xC4, 0x7C, 0xEE, 0xBE, 0x87, 0x63, 0xCE, 0x52,
+    0x77, 0x2E, 0x59, 0x0F, 0xC7, 0x2B, 0xE3, 0x57, 0x9E, 0x83, 0x81, 0xE6, 0xB9, 0xE9, 0x12, 0x42,
+    0xF4, 0x0F, 0x70, 0x9E, 0x33, 0xBB, 0x2D, 0x61, 0xDC, 0x41, 0xC2, 0x67, 0x07, 0xB5, 0xE2, 0xBD,
+    0x3F, 0xB3, 0xA7, 0x39, 0x3A, 0x10, 0x6B, 0xE5, 0x2C, 0x1B, 0x85, 0xAB, 0x73, 0x27, 0x71, 0x69,
+    0xF0, 0x5A, 0x06, 0xD4, 0x82, 0x3D, 0x02, 0x51, 0x78, 0xF6, 0x5D, 0x1A, 0x98, 0x78, 0x75, 0x84,
+    0x63, 0x0C, 0x38, 0xF5, 0x3D, 0xF3, 0x58, 0x62, 0x66, 0x54, 0x89, 0x68, 0x15, 0xAC, 0xBF, 0x84,
+    0x4C, 0x36, 0x87, 0x57, 0x4C, 0x6F, 0xAD, 0xCA, 0x90, 0xA9, 0x5B, 0xF9, 0x0E, 0xBF, 0xEE, 0x54,
+    0xBE, 0xA0, 0x1F, 0x08, 0x52, 0x45, 0x58, 0x40, 0x3A, 0x65, 0x44, 0x3B, 0x10, 0x31, 0xC7, 0x14,
+    0x52, 0x78, 0x78, 0x1A, 0xAF, 0xA9, 0x50, 0xD5, 0x79, 0xA2, 0xB4, 0xA3, 0x24, 0xFA, 0x1C, 0x3E,
+    0x9B, 0x8F, 0x86, 0x53, 0xAB, 0xEC, 0xEB, 0xF8, 0x21, 0xDD, 0x17, 0xC1, 0xB6, 0xEF, 0x92, 0x84,
+    0x83, 0x6A, 0x9C, 0x9E, 0x1E, 0x1F, 0xD6, 0xBA, 0x1F, 0xB1, 0x54, 0x54, 0x45, 0x49, 0xA1, 0x44,
+    0x9C, 0x21, 0x2F, 0xA1, 0x40, 0x64, 0xF4, 0xE7, 0x25, 0x87, 0xF0, 0xC8, 0x66, 0x64, 0x8D, 0x6C,
+    0xB9, 0x17, 0x2A, 0xF2, 0x72, 0x34, 0xEA, 0x33, 0x44, 0xA2, 0x09, 0xFB, 0xF4, 0x77, 0xBA, 0x1E,
+    0x41, 0x39, 0x88, 0x9C, 0xA8, 0x15, 0xD0, 0xAF, 0x44, 0x8F, 0x7D, 0xBC, 0x82, 0x6D, 0x5E, 0x94,
+    0xCE, 0xB1, 0xF5, 0xE6, 0x6E, 0x54, 0x0C, 0x08, 0xD2, 0x70, 0x36, 0xF3, 0x19, 0xDA, 0x2B, 0xEE,
+    0x1E, 0x9F, 0xF4, 0xBA, 0x30, 0xA7, 0x0B, 0x51, 0x01, 0xF9, 0x21, 0x01, 0x65, 0x3E, 0x7C, 0xF1,
+    0xEC, 0xC4, 0x8E, 0x4C, 0x6D, 0x1C, 0xD2, 0x40, 0x75, 0xAE, 0x11, 0x62, 0xE3, 0x77, 0x3C, 0x7A,
+    0x37, 0xE5, 0xCC, 0xF7, 0x92, 0x5C, 0xB7, 0xCB, 0x29, 0x5F, 0x1D, 0x4F, 0x2C, 0x4C, 0xD4, 0x65,
+    0xCF, 0xE1, 0xD9, 0x21, 0xA8, 0x9D, 0x2B, 0x8D, 0xD6, 0xF1, 0x49, 0x86, 0x7F, 0x8D, 0xBE, 0xE2,
+    0x9A, 0x1A, 0x4A, 0xF4, 0xED, 0xE3, 0xF0, 0xAA, 0xD3, 0x20, 0x9C, 0x96, 0xC8, 0x2E, 0x68, 0xF2,
+    0xBE, 0xB3, 0xFF, 0xEA, 0xD3, 0xCF, 0x68, 0x40, 0x44, 0x3A, 0x71, 0xBA, 0xBC, 0x10, 0x19, 0x45,
+    0x23, 0xCE, 0x72, 0x69, 0x03, 0xD6, 0xEB, 0xE0, 0x32, 0xBB, 0xC2, 0xA8, 0x8B, 0xC5, 0xA9, 0xC0,
+    0xE3, 0x28, 0xF0, 0xA9, 0xCB, 0x5A, 0xE0, 0x81, 0xCB, 0x9A, 0x78, 0xF7, 0x4B, 0xB0, 0xD6, 0x0B,
+    0x12, 0x88, 0x44, 0x0F, 0x5F, 0x9F, 0x92, 0x13, 0x51, 0xF2, 0xE5, 0x61, 0x0B, 0x62, 0xE4, 0xA2,
+    0x7B, 0x64, 0x2A, 0x00, 0x1C, 0x4B, 0x2C, 0x4E, 0x99, 0xBB, 0x44, 0x6F, 0xD7, 0x16, 0x8F, 0xF1,
+    0xE7, 0xB0, 0xD5, 0x16, 0xC4, 0x0C, 0x11, 0xD7, 0xF5, 0xE3, 0x0F, 0x08, 0xA2, 0xAD, 0xE1, 0x07,
+    0x64, 0x87, 0x5F, 0x30, 0xFA, 0x30, 0xA7, 0x01, 0xC6, 0x10, 0x24, 0x77, 0x9F, 0x34, 0x12, 0xDE,
+    0xF3, 0x0B, 0xF8, 0x16, 0x1A, 0x15, 0x1C, 0x24, 0x60, 0xE5, 0x03, 0x67, 0xEE, 0xEA, 0x27, 0x33,
+    0x58, 0xBF, 0x90, 0x9B, 0x84, 0xED, 0xEF, 0xDD, 0x4B, 0x96, 0x60, 0x7E, 0x6D, 0x6A, 0x16, 0xF4,
+    0xFA, 0xDD, 0x2A, 0xB5, 0x48, 0xC0, 0xAA, 0xD2, 0x6B, 0x47, 0x25, 0x25, 0xF0, 0x57, 0xB2, 0x1E,
+    0x61, 0xEA, 0xAA, 0x3A, 0x23, 0x4B, 0x07, 0x4E, 0x16, 0x3C, 0xC0, 0x4C, 0x17, 0xEF, 0x31, 0xE0,
+    0xDF, 0xD1, 0xFA, 0xE4, 0x7E, 0xF5, 0xA0, 0x00, 0xA8, 0xC0, 0x98, 0xE0, 0x5D, 0xC2, 0xE2, 0x4B,
+    0xA4, 0x4C, 0x0F, 0x0D, 0x30, 0x06, 0x38, 0x15, 0x63, 0xBD, 0x2E, 0x8D, 0x44, 0x6C, 0xF0, 0x82,
+    0x5E, 0x70, 0x9F, 0xA7, 0x10, 0x20, 0xE0, 0x00, 0xF7, 0xC2, 0x2F, 0x1D, 0x29, 0x94, 0x71, 0xFC,
+    0xA2, 0xA1, 0x02, 0x6C, 0x85, 0x5E, 0xFF, 0xF8, 0x44, 0x3B, 0xC6, 0xF6, 0xD3, 0xFA, 0x8B, 0x04,
+    0x09, 0x42, 0xF7, 0xEE, 0x14, 0x23, 0xE4, 0x2B, 0xEF, 0xC9, 0x9B, 0x01, 0xBC, 0x3B, 0x44, 0x08,
+    0x6A, 0xD5, 0xAF, 0x2D, 0x40, 0x40, 0x45, 0x5B, 0x37, 0x3E, 0xC8, 0xD7, 0xDC, 0x1F, 0x43, 0xEF,
+    0x10, 0x1D, 0xE4, 0xAB, 0x7E, 0x8D, 0x2C, 0xC5, 0xB3, 0x1B, 0xA3, 0x51, 0x79, 0x07, 0xF6, 0xB1,
+    0xB3, 0xFF, 0x3D, 0x7C, 0x0C, 0x85, 0xC9, 0x20, 0xAF, 0x78, 0xD0, 0x82, 0x30, 0x6D, 0xFD, 0x3D,
+    0x32, 0xBA, 0x00, 0x99, 0x5E, 0x97, 0x31, 0xA3, 0xD7, 0xEB, 0x61, 0x86, 0xEB, 0x7F, 0x15, 0x91,
+    0x99, 0xAA, 0xB9, 0x88, 0x98, 0x91, 0x5E, 0x32, 0x19, 0x3C, 0x89, 0x02, 0xCB, 0xAA, 0x0C, 0x03,
+    0xCF, 0x0F, 0x7C, 0x5F, 0x0E, 0x61, 0x15, 0xF8, 0x0F, 0x4B, 0x88, 0xBE, 0xC0, 0xA0, 0x6B, 0x91,
+    0xD6, 0x0D, 0xF9, 0x9E, 0xF1, 0x80, 0xBB, 0x1C, 0x86, 0xFE, 0xC8, 0xB1, 0xCA, 0x5D, 0xAC, 0xC0,
+    0x14, 0x77, 0xCE, 0x6D, 0xB5, 0xB8, 0xCD, 0xCA, 0x43, 0xBF, 0x39, 0xF7, 0x3C, 0xB6, 0x12, 0x99,
+    0x7A, 0x1D, 0xC6, 0x8D, 0x79, 0x54, 0xA8, 0xA2, 0x82, 0x07, 0x4D, 0x52, 0xC2, 0x7C, 0xB6, 0x80,
+    0x08, 0x31, 0x21, 0x7B, 0xE4, 0xE3, 0xED, 0xEA, 0xE2, 0xE7, 0xC7, 0x6E, 0x56, 0xC7, 0xEE, 0x6E,
+    0x90, 0x6E, 0x56, 0x48, 0xC5, 0xCF, 0xE5, 0x82, 0x21, 0x3E, 0x51, 0x95, 0x24, 0xFC, 0x58, 0x28,
+    0x04, 0x75, 0x57, 0x1D, 0x65, 0xA4, 0x9B, 0x95, 0x21, 0xC4, 0xF4, 0x42, 0xF6, 0x9E, 0x7D, 0x47,
+    0x89, 0x66, 0x9F, 0xF5, 0xE4, 0xB4, 0x02, 0x88, 0xE7, 0x53, 0xD1, 0xA4, 0x66, 0x9F, 0x67, 0x57,
+    0x39, 0x30, 0xB0, 0x0B, 0x85, 0xCF, 0xE3, 0x12, 0x00, 0x15, 0xE8, 0xE1, 0x78, 0x21, 0x40, 0x52,
+    0x5F, 0xB5, 0xC0, 0x42, 0x3D, 0x2D, 0x38, 0x41, 0x1D, 0x54, 0xD5, 0x3F, 0xAA, 0x35, 0x12, 0x47,
+    0x65, 0xF5, 0xD5, 0x47, 0x89, 0xA1, 0x32, 0x5C, 0xAB, 0x8F, 0x63, 0x23, 0xD0, 0xFC, 0xE0, 0x15,
+    0x91, 0xC8, 0x75, 0x5E, 0x90, 0x57, 0xD4, 0x32, 0x7C, 0x20, 0x74, 0xA0, 0x9B, 0xC3, 0x7A, 0x8B,
+    0x5D, 0xAC, 0x47, 0xD4, 0x9D, 0xF7, 0xB8, 0x47, 0xF6, 0xF6, 0xB5, 0x0B, 0xC2, 0x4C, 0xEE, 0x3F,
+    0x72, 0xEF, 0x2D, 0xC8, 0xDE, 0x0B, 0xDD, 0x25, 0x7E, 0x77, 0x66, 0x2C, 0x3D, 0x92, 0x43, 0xDF,
+    0xDD, 0x1C, 0x7B, 0xB0, 0xB4, 0x78, 0x4F, 0x0E, 0x9F, 0x57, 0x1D, 0xAE, 0x2C, 0xC5, 0xBE, 0x8A,
+    0x18, 0x66, 0x4A, 0x2C, 0xA4, 0x06, 0x91, 0xE1, 0x90, 0x1C, 0xF8, 0x0B, 0xF0, 0x45, 0x01, 0x25,
+    0x3E, 0x45, 0x2D, 0x2B, 0xDD, 0xD5, 0x89, 0x32, 0xAC, 0xF0, 0xF2, 0xE2, 0xB6, 0x6F, 0x05, 0x6F,
+    0xBA, 0x0C, 0x04, 0xD7, 0x49, 0x72, 0xC5, 0x53, 0x77, 0x0E, 0x19, 0x4E, 0x0F, 0x32, 0x98, 0x63,
+    0x4F, 0xEF, 0x89, 0xCB, 0x31, 0xFD, 0x33, 0xF8, 0xBE, 0x1B, 0x71, 0x4F, 0x93, 0x86, 0x31, 0x1C,
+    0xAB, 0x5E, 0x17, 0x7B, 0xAF, 0xBB, 0xFD, 0x9C, 0xEC, 0x14, 0xA9, 0x4E, 0x1D, 0x71, 0x26, 0x50,
+    0x23, 0x9D, 0x98, 0x2D, 0xC2, 0x4B, 0x06, 0x01, 0x95, 0xA8, 0xB3, 0x77, 0xFB, 0xDA, 0x25, 0x68,
+    0x03, 0xE4, 0x2C, 0x99, 0x2A, 0xEC, 0xE0, 0xE2, 0x0E, 0x6E, 0xFB, 0x1D, 0xB4, 0x6B, 0x79, 0x3C,
+    0x7F, 0xF2, 0x6E, 0x83, 0x79, 0x98, 0xD1, 0xED, 0x59, 0x50, 0xE8, 0x9D, 0xE3, 0xFE, 0x3F, 0xAE,
+    0x6E, 0xEF, 0x7E, 0xF3, 0x51, 0xB0, 0xE6, 0xB6, 0xF3, 0xF6, 0x5C, 0xDB, 0x81, 0x4F, 0x49, 0xAF,
+    0x00, 0xB2, 0x5F, 0x84, 0x5F, 0xC0, 0x93, 0x7A, 0xDE, 0x0A, 0xC9, 0xD6, 0x38, 0x3E, 0x53, 0xF7,
+    0x14, 0x76, 0x75, 0x91, 0x12, 0xB3, 0xA3, 0xA4, 0x20, 0xF4, 0x75, 0x90, 0x76, 0xD4, 0x2A, 0xA0,
+    0xC4, 0x16, 0x64, 0x6F, 0x6F, 0x4F, 0x1C, 0xF0, 0x74, 0x99, 0x74, 0xFB, 0xA4, 0x54, 0xFD, 0xDF,
+    0xA9, 0x5B, 0xA2, 0x6E, 0x26, 0x61, 0x8D, 0x7E, 0x27, 0xB7, 0xD3, 0xB0, 0x53, 0xB6, 0x4D, 0x66,
+    0xBD, 0x85, 0xA6, 0x8B, 0xBB, 0x8C, 0xD8, 0xAE, 0xE7, 0xF0, 0xC7, 0xA5, 0x8B, 0x0B, 0x34, 0xE4,
+    0x14, 0xEF, 0x0D, 0xEA, 0xF6, 0xC0, 0x30, 0xFF, 0x73, 0xB7, 0x38, 0x38, 0x31, 0x75, 0x58, 0xAC,
+    0x8E, 0xD6, 0x3C, 0xBC, 0x3A, 0x43, 0x2B, 0xD1, 0x5B, 0x24, 0xB3, 0x0D, 0xE1, 0x5A, 0x09, 0x52,
+    0x27, 0x1B, 0x2B, 0xBA, 0xFD, 0x4A, 0xBB, 0x3D, 0x4A, 0x1F, 0xE5, 0x9D, 0x59, 0x0B, 0x47, 0xD8,
+    0x18, 0xAD, 0x9F, 0xC5, 0x41, 0xE7, 0xBC, 0xD2, 0x0D, 0x00, 0xAD, 0x4F, 0x10, 0xD2, 0x7D, 0x4D,
+    0x17, 0xB8, 0xDB, 0xB9, 0x94, 0xDA, 0x60, 0x01, 0x3B, 0xD2, 0x19, 0x23, 0xA0, 0xCB, 0x80, 0xC6,
+    0xED, 0xB9, 0xBE, 0x46, 0xA4, 0x19, 0x8E, 0xCA, 0x32, 0x10, 0x4B, 0xD1, 0x35, 0xDF, 0x2D, 0x4F,
+    0x4B, 0x58, 0x7A, 0xC6, 0x17, 0x2C, 0x5C, 0xA6, 0xBD, 0x5E, 0xBF, 0x6A, 0xE4, 0x2C, 0x90, 0x30,
+    0x63, 0xD1, 0x00, 0xDD, 0x6E, 0x90, 0xAD, 0xD1, 0x68, 0x64, 0x6E, 0x0A, 0xCA, 0xF9, 0xA7, 0x95,
+    0x6D, 0x11, 0x71, 0x33, 0xCF, 0x78, 0x72, 0x08, 0xF6, 0xBA, 0xC0, 0xB8, 0x1F, 0xCF, 0x15, 0x9D,
+    0xC2, 0x90, 0x9F, 0xBF, 0x75, 0x44, 0x3A, 0xA8, 0xF7, 0x12, 0x55, 0x67, 0xEB, 0xCE, 0x10, 0x56,
+    0xEA, 0xE4, 0xA8, 0xBD, 0x7E, 0xAF, 0xE8, 0x22, 0x93, 0x2A, 0xAB, 0xEC, 0xB4, 0x14, 0xF2, 0x4C,
+    0x3B, 0x35, 0xCB, 0x84, 0xE1, 0x16, 0x72, 0x9E, 0x95, 0x28, 0xE5, 0x07, 0xDB, 0xD3, 0x56, 0x75,
+    0x9E, 0x06, 0xEA, 0xCA, 0x7B, 0xFF, 0x3E, 0xA3, 0x0D, 0xA9, 0xD4, 0xC4, 0x58, 0x20, 0x72, 0x75,
+    0x6C, 0xB4, 0x33, 0x23, 0xA3, 0x2A, 0x3F, 0x9F, 0x48, 0x93, 0x9B, 0xC0, 0x5D, 0xF1, 0xA4, 0x74,
+    0xFA, 0xF4, 0xF7, 0x20, 0x2B, 0x3D, 0xA6, 0x2B, 0x06, 0xC5, 0x0C, 0xE3, 0x27, 0x7A, 0x45, 0x79,
+    0x2A, 0x61, 0xF4, 0xBA, 0x43, 0x1A, 0xF1, 0x21, 0xC6, 0x50, 0x43, 0x89, 0x42, 0xD7, 0xD0, 0x71,
+    0x83, 0x06, 0xE0, 0x21, 0xAC, 0x75, 0xC2, 0xF7, 0x7D, 0x92, 0xCE, 0xB1, 0xD9, 0x3B, 0x60, 0x57,
+    0xE4, 0x08, 0x9B, 0x95, 0x7A, 0xE7, 0x2F, 0xCE, 0xCE, 0x4E, 0x88, 0x68, 0x5C, 0x7A, 0x48, 0xE4,
+    0x99, 0x99, 0xC0, 0x61, 0xC1, 0xE9, 0xF2, 0xDB, 0xED, 0xB9, 0x01, 0xA4, 0xEE, 0x91, 0x25, 0x4E,
+    0xB8, 0xE8, 0xA7, 0x24, 0x0C, 0x7A, 0x86, 0x15, 0x95, 0x07, 0xC0, 0xBC, 0xAC, 0xD3, 0x03, 0x9C,
+    0x46, 0x65, 0x38, 0x37, 0x05, 0x59, 0x80, 0xE8, 0x88, 0xEB, 0x7D, 0xD8, 0xAB, 0xB4, 0xB7, 0xA3,
+    0xBE, 0xBD, 0xC3, 0xD8, 0xB1, 0xBA, 0x6B, 0xD5, 0xFA, 0x9A, 0xF0, 0x50, 0x37, 0xAD, 0x76, 0x1C,
+    0xB2, 0xB8, 0xD2, 0x82, 0x03, 0x0C, 0x3B, 0x38, 0xBC, 0x53, 0x0F, 0x21, 0x8B, 0x02, 0x6B, 0xA0,
+    0x64, 0x53, 0x1A, 0x20, 0xA1, 0x4A, 0x67, 0xEA, 0x6F, 0x84, 0x03, 0xEA, 0x2C, 0x26, 0x35, 0xC0,
+    0xE1, 0x51, 0x0D, 0x2E, 0xBC, 0x69, 0x35, 0xC6, 0x9C, 0x35, 0xEB, 0x71, 0xB8, 0x01, 0xC2, 0xEC,
+    0xAA, 0x66, 0xFD, 0xEC, 0xAA, 0x89, 0x0B, 0x10, 0xDF, 0xD6, 0xAC, 0xC7, 0xE1, 0x66, 0x08, 0xE3,
+    0x7A, 0x08, 0xE3, 0x2A, 0x04, 0xE3, 0xA5, 0x9A, 0x59, 0xB1, 0x64, 0x09, 0xDD, 0x8E, 0x83, 0xCA,
+    0x12, 0x2C, 0x28, 0xD0, 0xA8, 0x49, 0xAB, 0x0A, 0xA9, 0x85, 0x1D, 0x46, 0x0B, 0x9D, 0xAA, 0xE6,
+    0x24, 0x76, 0x70, 0xDA, 0xC4, 0x7A, 0xA8, 0x05, 0xDB, 0x6B, 0xD5, 0x57, 0x80, 0x99, 0xA9, 0xAB,
+    0x9A, 0x5A, 0x0F, 0xD3, 0xAA, 0xB4, 0x00, 0xA8, 0x56, 0x67, 0x55, 0x9A, 0x54, 0x47, 0x5A, 0xAD,
+    0xC6, 0x8A, 0xDC, 0xCA, 0xBE, 0xBA, 0x56, 0x5F, 0x55, 0x3A, 0x66, 0x5F, 0xDD, 0xA0, 0xAD, 0x2A,
+    0x87, 0xAB, 0x5D, 0x3F, 0x6E, 0x21, 0x8B, 0x3C, 0xDF, 0xAB, 0x81, 0x54, 0x9A, 0xD7, 0x1E, 0x26,
+    0xBD, 0x6E, 0x07, 0x93, 0x5E, 0xDB, 0xCE, 0x94, 0x5E, 0x8D, 0xD6, 0x0E, 0xD5, 0x2D, 0x44, 0xA0,
+    0xE0, 0xF4, 0x48, 0xAF, 0x12, 0x3F, 0x88, 0x18, 0x2D, 0x0F, 0x3A, 0xCF, 0x85, 0x67, 0x93, 0x11,
+    0xAB, 0xC1, 0x3B, 0xA3, 0x7B, 0x63, 0x8E, 0x8A, 0x0B, 0x6F, 0xCF, 0x21, 0xA3, 0x15, 0xDE, 0x4F,
+    0xF7, 0x9C, 0xC6, 0x37, 0x9A, 0x4C, 0x8E, 0x3C, 0x4B, 0x08, 0xEE, 0xCB, 0x91, 0x67, 0xE9, 0xC6,
+    0xD7, 0x71, 0xE4, 0x02, 0x1F, 0x4C, 0xF9, 0xEE, 0xE6, 0xC5, 0x31, 0x3D, 0x47, 0xD7, 0x7B, 0x06,
+    0xB1, 0x39, 0x40, 0xE8, 0x74, 0xAA, 0x6B, 0x64, 0xA2, 0xDD, 0xC3, 0x3D, 0x4A, 0xDE, 0xDA, 0x24,
+    0x44, 0x81, 0x12, 0x4D, 0x18, 0x19, 0x4D, 0x4A, 0x60, 0x4B, 0xCD, 0x89, 0x9D, 0x1D, 0x72, 0x11,
+    0x33, 0x6A, 0x38, 0xAA, 0xF9, 0xF2, 0xCD, 0xF2, 0x72, 0xAD, 0x9D, 0xA9, 0x05, 0x80, 0x71, 0x19,
+    0x80, 0xE9, 0x46, 0xB2, 0x05, 0x94, 0x2D, 0x8D, 0x0A, 0x63, 0x5B, 0x62, 0x3D, 0x1C, 0x8F, 0x4D,
+    0xE9, 0xD2, 0x4F, 0xCB, 0x80, 0x0E, 0x59, 0x02, 0x82, 0x0B, 0x5D, 0xEE, 0x85, 0xF6, 0xD5, 0xB7,
+    0x0F, 0xEC, 0x47, 0xB7, 0x5C, 0x5D, 0x73, 0x38, 0x7C, 0x8B, 0x5F, 0x9C, 0xBD, 0x7A, 0x89, 0x89,
+    0x93, 0xAD, 0xA1, 0x6E, 0x37, 0x49, 0xE3, 0x30, 0x98, 0xC9, 0x26, 0x59, 0xD1, 0x16, 0x3B, 0xC1,
+    0x1E, 0x6D, 0xF1, 0x0C, 0x14, 0x2D, 0xC3, 0xEF, 0xD6, 0xD8, 0x0F, 0x25, 0x2F, 0x7B, 0xE3, 0x72,
+    0x73, 0x53, 0xD6, 0xD9, 0x47, 0x46, 0x3B, 0xE5, 0x17, 0xF2, 0xB2, 0xD7, 0x0D, 0x64, 0xF3, 0x93,
+    0xE5, 0xD5, 0x1B, 0x7B, 0xEB, 0x5F, 0x86, 0xA9, 0xEC, 0xC0, 0xC3, 0xF0, 0xAE, 0x84, 0xA9, 0xD0,
+    0x44, 0x74, 0xFF, 0x8A, 0x0B, 0xE0, 0x93, 0x20, 0xE0, 0xFF, 0xC7, 0x7F, 0xFC, 0x55, 0x5C, 0x1C,
+    0xBA, 0xB8, 0x46, 0x04, 0xFE, 0xFF, 0xF8, 0xCF, 0xBF, 0x11, 0xC9, 0x69, 0xF5, 0xB0, 0x86, 0xB4,
+    0xD5, 0xA6, 0xE2, 0x96, 0x38, 0x07, 0x64, 0xDE, 0x18, 0xDD, 0x3A, 0xF9, 0xCB, 0x5F, 0x48, 0xF7,
+    0xF5, 0xF0, 0xA0, 0x1D, 0xD4, 0xE3, 0x13, 0xF2, 0x32, 0x74, 0xB1, 0x2B, 0xDA, 0x46, 0x0C, 0x8F,
+    0xDA, 0x40, 0xFC, 0xDA, 0x22, 0x78, 0xE6, 0x73, 0x7C, 0x47, 0x29, 0xC1, 0x3E, 0xBA, 0x83, 0x93,
+    0x2A, 0xE6, 0xE0, 0x43, 0x5C, 0x31, 0x25, 0x41, 0xEC, 0x47, 0xED, 0x39, 0xAC, 0x01, 0xD3, 0x3D,
+    0x0E, 0x48, 0xD4, 0x18, 0x4C, 0xA1, 0x5C, 0xD7, 0x61, 0xFA, 0x1D, 0xB6, 0x01, 0x41, 0xD4, 0x6E,
+    0xA2, 0x95, 0x20, 0xD6, 0xF7, 0x6A, 0xE1, 0x45, 0x8A, 0x89, 0x13, 0x61, 0x42, 0xBD, 0xEF, 0xD1,
+    0x9D, 0x95, 0xFB, 0x37, 0x2D, 0x95, 0x5C, 0x47, 0xD5, 0xE1, 0x9D, 0xFC, 0xF5, 0xCD, 0x3D, 0xF0,
+    0x75, 0x4B, 0xB6, 0x53, 0x3F, 0xBB, 0x5C, 0xBC, 0xE9, 0xAA, 0x96, 0xCA, 0xC0, 0x0B, 0x1D, 0xC7,
+    0xE9, 0x5A, 0xD6, 0x16, 0xCA, 0xFC, 0x65, 0x13, 0x75, 0x97, 0x8E, 0xCE, 0xEF, 0xB0, 0x5F, 0x13,
+    0xFB, 0x81, 0x63, 0x6C, 0xE2, 0x54, 0x7D, 0x9B, 0x7A, 0x39, 0xC8, 0xE8, 0xB3, 0x21, 0x90, 0x1F,
+    0x8F, 0xC0, 0x21, 0x30, 0x1F, 0x58, 0x8E, 0x68, 0x87, 0x24, 0x81, 0x70, 0x82, 0xA1, 0x4E, 0x8B,
+    0x57, 0xFE, 0xF0, 0x03, 0x0C, 0x62, 0x35, 0x41, 0xBC, 0xC2, 0x75, 0x19, 0x1A, 0xFD, 0x64, 0xBD,
+    0xD7, 0x07, 0xC0, 0x26, 0x9F, 0x7F, 0x35, 0xE7, 0x3E, 0x23, 0xBD, 0x95, 0x1B, 0x17, 0x55, 0x3C,
+    0xC0, 0xC7, 0xE6, 0x3E, 0x25, 0x7C, 0x8C, 0x0B, 0x4E, 0xE2, 0x70, 0xC1, 0x13, 0x86, 0x6B, 0x43,
+    0xFF, 0x92, 0x61, 0xDD, 0xAA, 0x50, 0xC8, 0x52, 0x4F, 0x37, 0xF0, 0x85, 0xAC, 0x7E, 0xDF, 0xEC,
+    0x7C, 0xEE, 0x84, 0xF1, 0xED, 0xD7, 0x8B, 0x5B, 0x94, 0x82, 0x24, 0x77, 0x8B, 0x5D, 0x10, 0xAD,
+    0x0C, 0x82, 0xE3, 0xB3, 0x60, 0x96, 0xCE, 0x05, 0x73, 0x47, 0x36, 0xD6, 0x7E, 0x19, 0xC5, 0x7C,
+    0x0D, 0xEA, 0x84, 0xBA, 0xE4, 0x8A, 0x7E, 0x1C, 0xB0, 0x34, 0x4A, 0x43, 0x0D, 0xFA, 0x29, 0xED,
+    0x05, 0xF3, 0x13, 0x76, 0x57, 0x0C, 0x73, 0x7A, 0x17, 0x34, 0xEA, 0x05, 0xA8, 0x12, 0xE7, 0xAD,
+    0xAE, 0x8B, 0x8B, 0xEF, 0x49, 0x16, 0xAF, 0x1A, 0x45, 0x7D, 0x5D, 0xD9, 0x8C, 0x5E, 0xF7, 0x37,
+    0x1F, 0x03, 0x61, 0x65, 0x6F, 0xBB, 0xFD, 0xA6, 0xCB, 0x65, 0x7C, 0xD7, 0x72, 0x3F, 0x9F, 0x0F,
+    0x36, 0x16, 0xBF, 0x37, 0x2F, 0xC9, 0xD8, 0x6B, 0xE5, 0xA7, 0xE1, 0x35, 0xCD, 0x8E, 0xD8, 0x27,
+    0x86, 0x8D, 0x6E, 0x89, 0xF7, 0xDD, 0x82, 0xF4, 0xF0, 0x2B, 0x5D, 0xA6, 0x73, 0x0C, 0x59, 0x6E,
+    0xFB, 0x4D, 0x7B, 0xD7, 0xDC, 0xEB, 0x9E, 0xF7, 0x9D, 0x9F, 0x42, 0x1E, 0xF4, 0xBA, 0xCD, 0xE7,
+    0x60, 0x4D, 0x33, 0x2F, 0x2D, 0x8A, 0x32, 0x37, 0x6B, 0x9B, 0xF8, 0x26, 0x7B, 0x3D, 0xA5, 0x7E,
+    0x72, 0x37, 0x83, 0xAD, 0x7A, 0xE0, 0x1B, 0x8A, 0xBE, 0x65, 0xB5, 0x40, 0x09, 0xDB, 0xBD, 0x89,
+    0x5E, 0x5A, 0xAB, 0x96, 0x3C, 0xCC, 0x45, 0x34, 0xF1, 0x8B, 0x43, 0x7A, 0x0D, 0x95, 0x74, 0xBD,
+    0xFE, 0x67, 0xAC, 0x3B, 0xA3, 0x1A, 0xC0, 0xC6, 0x11, 0xFE, 0x3A, 0xC9, 0xE3, 0x20, 0xED, 0x59,
+    0x4A, 0x8F, 0xFA, 0x6F, 0x0B, 0x04, 0x8B, 0x8E, 0xAF, 0x96, 0x58, 0x32, 0x1F, 0x99, 0xF5, 0x90,
+    0x9E, 0x2D, 0xD3, 0xC9, 0xB2, 0x9C, 0x22, 0x88, 0x23, 0x5F, 0xBD, 0x95, 0x88, 0x9E, 0x3D, 0xFE,
+    0xF4, 0x33, 0xE0, 0xB7, 0x88, 0x60, 0x1F, 0x8A, 0xE8, 0x30, 0x42, 0x65, 0x12, 0xE4, 0xD8, 0x43,
+    0xFE, 0x2C, 0xF7, 0xD1, 0x80, 0x16, 0x1C, 0x13, 0x9A, 0x1A, 0x15, 0xD0, 0xAA, 0x0D, 0x42, 0xFD,
+    0x65, 0x0F, 0x42, 0xC9, 0x32, 0xA0, 0x68, 0x84, 0x08, 0xBB, 0x06, 0xFB, 0x81, 0x7B, 0x37, 0xED,
+    0x39, 0xAE, 0xDD, 0x53, 0x5C, 0x21, 0xE5, 0xDB, 0x99, 0x72, 0xA9, 0x0D, 0xE2, 0xC6, 0x22, 0x1A,
+    0x20, 0xC9, 0x92, 0x44, 0x71, 0x18, 0x71, 0x81, 0x40, 0xD3, 0xB6, 0x5B, 0xB5, 0xDB, 0xA2, 0x16,
+    0x88, 0x57, 0xEB, 0x60, 0xE7, 0x84, 0x2F, 0x20, 0x8B, 0xFA, 0xF4, 0x33, 0xA8, 0xB0, 0x64, 0xA6,
+    0x46, 0xF9, 0x8D, 0x8E, 0x96, 0x65, 0x6B, 0xCB, 0x19, 0xCB, 0x3A, 0x17, 0xB4, 0x53, 0x93, 0x21,
+    0xB7, 0xD3, 0x26, 0xF8, 0x2A, 0x77, 0x6D, 0x68, 0x2A, 0xB3, 0x32, 0x10, 0x5D, 0xD9, 0xCD, 0x81,
+    0xBC, 0x2A, 0xD7, 0x35, 0x30, 0x90, 0x02, 0xD3, 0xA0, 0x5E, 0x35, 0xD6, 0x8D, 0xC3, 0xEA, 0x10,
+    0x15, 0xEF, 0xF3, 0xAB, 0x41, 0x9C, 0xE1, 0x7C, 0xC8, 0x6D, 0xCE, 0xC2, 0x53, 0x16, 0xE0, 0xBC,
+    0x8F, 0xB6, 0xDB, 0x00, 0x91, 0xD5, 0x4F, 0x9A, 0xCF, 0xD1, 0x46, 0xD5, 0xFC, 0xA5, 0x74, 0x62,
+    0xF1, 0x68, 0x68, 0x0E, 0x26, 0x36, 0x73, 0xB1, 0x61, 0x5C, 0x92, 0x99, 0x88, 0x49, 0x5D, 0xF9,
+    0xDD, 0xBC, 0x34, 0x2B, 0x44, 0x4E, 0xEC, 0xF5, 0xF6, 0xEA, 0xC2, 0xDB, 0xEA, 0x23, 0x7C, 0x6B,
+    0xAD, 0x15, 0x3D, 0xA5, 0x0A, 0x70, 0x6B, 0x72, 0x2A, 0x75, 0x5F, 0xF3, 0x4A, 0xAD, 0x54, 0x6B,
+    0x12, 0x8D, 0xAD, 0xF2, 0xDB, 0xAF, 0xE7, 0x8F, 0x2A, 0xD4, 0x4E, 0x9A, 0x8A, 0xBD, 0x1B, 0x4D,
+    0x5E, 0xD1, 0x70, 0xF3, 0xFE, 0xD0, 0xCA, 0xFA, 0xBE, 0xB9, 0xA0, 0x96, 0x2B, 0xA7, 0xBA, 0xB6,
+    0x28, 0x5E, 0x24, 0x17, 0x6F, 0x39, 0x76, 0x9A, 0x17, 0x63, 0x05, 0x58, 0x5F, 0xBE, 0xAA, 0x19,
+    0xB7, 0x00, 0x30, 0xBB, 0xD2, 0x97, 0x67, 0x25, 0xE3, 0x16, 0x8B, 0xB1, 0x06, 0xAC, 0x2F, 0x5F,
+    0x55, 0x8D, 0xDB, 0x01, 0x18, 0x1B, 0x00, 0x8C, 0x4D, 0x00, 0x6E, 0xAB, 0x9C, 0x6F, 0x10, 0x66,
+    0x23, 0xFB, 0x65, 0xF2, 0xBB, 0x67, 0xAC, 0xD6, 0xEF, 0x34, 0x2E, 0xD5, 0x79, 0x5F, 0x2A, 0xD7,
+    0x37, 0x2F, 0x2F, 0x73, 0xBE, 0x50, 0xAB, 0x6F, 0x5E, 0xAA, 0xF3, 0xBD, 0x54, 0xAC, 0x6F, 0xB5,
+    0x7C, 0x5C, 0x5D, 0x3E, 0x6E, 0xBD, 0xBC, 0x54, 0x6F, 0xD7, 0x01, 0x19, 0x8A, 0xF6, 0xEB, 0x81,
+    0xA4, 0xD7, 0x35, 0x20, 0xB3, 0x9A, 0xBD, 0x5E, 0x92, 0xB0, 0xA5, 0x18, 0x78, 0x59, 0xCA, 0x31,
+    0x32, 0x4D, 0x8A, 0xBD, 0xE1, 0x24, 0x08, 0x31, 0x64, 0x01, 0x37, 0x2B, 0x1A, 0x6A, 0xC2, 0x0D,
+    0x02, 0x49, 0x03, 0x39, 0x3E, 0x49, 0x54, 0x9B, 0x35, 0xFC, 0x73, 0xC1, 0x30, 0x2A, 0x8C, 0xE5,
+    0xB4, 0x94, 0x83, 0xF7, 0x06, 0x97, 0x2B, 0xD2, 0x9E, 0xCB, 0x4F, 0xFF, 0x43, 0x83, 0xEA, 0x4E,
+    0x9F, 0xA1, 0x58, 0x9F, 0xAB, 0x59, 0x9F, 0xA3, 0x5A, 0x9F, 0xAB, 0x5B, 0x9F, 0xA3, 0x5C, 0x65,
+    0xD3, 0xFA, 0xE0, 0x5E, 0xDB, 0x0A, 0x36, 0x2C, 0xEE, 0x6C, 0xC1, 0xD2, 0x79, 0x08, 0xAE, 0xA9,
+    0x7B, 0xF2, 0xE6, 0xF4, 0xAC, 0x6B, 0x76, 0x1A, 0xF2, 0x57, 0x63, 0x80, 0xFB, 0xF9, 0x48, 0xBA,
+    0x2A, 0x36, 0x1A, 0x9C, 0xDD, 0x44, 0xAC, 0x3B, 0xC1, 0x6E, 0xA4, 0x08, 0x32, 0x49, 0xF1, 0x3B,
+    0x5E, 0x86, 0x98, 0xB8, 0x77, 0x4D, 0xDE, 0x14, 0x7F, 0xF0, 0x97, 0x7F, 0x4C, 0xC8, 0xBF, 0x9C,
+    0xBE, 0x79, 0x0D, 0x56, 0x2D, 0x86, 0x00, 0x87, 0x4F, 0x6F, 0x7A, 0x45, 0x66, 0xF5, 0xAB, 0xAE,
+    0xC6, 0x78, 0x85, 0xD2, 0xCB, 0x0A, 0x11, 0x16, 0xFF, 0xBC, 0x0A, 0xB4, 0xB4, 0x76, 0xD9, 0x99,
+    0x88, 0xBB, 0x3C, 0xEA, 0xE4, 0x6D, 0xB3, 0x81, 0x28, 0x84, 0x3F, 0xE7, 0x2A, 0xF2, 0xCA, 0xFB,
+    0x9B, 0xCC, 0xC5, 0x14, 0x38, 0x3B, 0xFF, 0x8A, 0x15, 0x17, 0x6C, 0xA0, 0x52, 0x17, 0x53, 0x22,
+    0xC5, 0x13, 0x35, 0xEA, 0x1B, 0x43, 0xE7, 0x15, 0xE4, 0x59, 0xD1, 0xF2, 0xD3, 0x7F, 0xE3, 0x29,
+    0x82, 0x88, 0x1C, 0xC4, 0x24, 0x76, 0x0D, 0x49, 0x14, 0x02, 0x0B, 0x4B, 0xFD, 0x25, 0x6B, 0xF6,
+    0x2A, 0xE5, 0x69, 0x92, 0xBD, 0x9F, 0xAD, 0x32, 0x2D, 0x6F, 0x16, 0x33, 0x4E, 0xBB, 0x15, 0x65,
+    0xA4, 0x91, 0x6C, 0x25, 0x3B, 0x04, 0xCA, 0x52, 0xCE, 0x16, 0x51, 0x88, 0xD5, 0x4A, 0xF9, 0xDB,
+    0x56, 0xC4, 0x2B, 0xD3, 0x71, 0xD6, 0x6E, 0xBC, 0x5E, 0x51, 0x43, 0x75, 0x10, 0x63, 0xCA, 0xAB,
+    0x22, 0xFD, 0x55, 0xB1, 0x07, 0xE3, 0x6D, 0x1B, 0x52, 0xA6, 0xDA, 0xA9, 0x14, 0x62, 0xAC, 0x55,
+    0x98, 0xC8, 0x00, 0x33, 0xEC, 0x6C, 0x03, 0x7B, 0x86, 0xFD, 0xD9, 0x69, 0xBD, 0x27, 0xB3, 0xAF,
+    0xEB, 0x3B, 0xDD, 0x43, 0xB6, 0x0B, 0xE3, 0xB5, 0xDC, 0xBE, 0xDC, 0xAE, 0x74, 0x2C, 0x1B, 0x93,
+    0xF8, 0x87, 0xEC, 0x2A, 0xD4, 0xDC, 0xBF, 0x74, 0xA3, 0xD4, 0xF2, 0x41, 0xA5, 0x67, 0x95, 0x7A,
+    0xDE, 0xD1, 0x25, 0x7C, 0x78, 0x29, 0x12, 0x43, 0xBC, 0xA8, 0x3D, 0x7C, 0xF3, 0x4A, 0x1D, 0xEA,
+    0x97, 0x90, 0x79, 0x30, 0xEC, 0x71, 0x36, 0xE9, 0x5D, 0x8D, 0x12, 0xD5, 0xA8, 0xE1, 0x1A, 0x5D,
+    0xB8, 0xD8, 0xD8, 0x6A, 0x6C, 0xCC, 0xC3, 0x5F, 0x23, 0x5D, 0xC1, 0x5A, 0xD4, 0xAF, 0x72, 0x54,
+    0x4B, 0xBD, 0xC0, 0x0E, 0x5E, 0x4C, 0xC0, 0x29, 0xC2, 0x0D, 0xF4, 0xC2, 0xA8, 0x6E, 0x52, 0xB0,
+    0xC7, 0x23, 0x61, 0xC8, 0x38, 0x08, 0xAC, 0x51, 0xBA, 0x80, 0x27, 0xF1, 0xC3, 0x04, 0x7B, 0x25,
+    0x21, 0x0F, 0xC5, 0x27, 0xC7, 0x27, 0x2B, 0xA7, 0x07, 0x8C, 0x15, 0xFE, 0x52, 0xC6, 0x55, 0xE8,
+    0xFF, 0x16, 0x4B, 0x18, 0x84, 0xE4, 0x69, 0x08, 0x84, 0xFA, 0x29, 0x16, 0x94, 0x43, 0xC8, 0xA5,
+    0xDC, 0x3C, 0xE5, 0xCF, 0xEE, 0xB0, 0x1F, 0xB4, 0xE8, 0x40, 0x69, 0x73, 0xA1, 0x6E, 0xEC, 0xB1,
+    0x46, 0x2A, 0xD0, 0x71, 0xCB, 0xFE, 0xCF, 0x08, 0x65, 0xFF, 0xE9, 0xEF, 0x74, 0xD5, 0xC5, 0x0A,
+    0x16, 0x07, 0x55, 0x77, 0x8A, 0xCC, 0xC7, 0xCA, 0x94, 0xBF, 0x44, 0x9D, 0x01, 0xDA, 0xB2, 0xD6,
+    0xD8, 0x7B, 0xD4, 0x93, 0x95, 0x28, 0x56, 0x4D, 0xB4, 0x65, 0xB4, 0x65, 0x4D, 0x2E, 0x7B, 0xCD,
+    0x60, 0x77, 0x28, 0x7F, 0x2D, 0xD4, 0xEE, 0x50, 0xFC, 0x7F, 0x43, 0xFE, 0x1F, 0x62, 0xFF, 0x3B,
+    0xC0, 0x47, 0x64, 0x00, 0x00
 };
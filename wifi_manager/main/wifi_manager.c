@@ -14,6 +14,7 @@
 #include "esp_wifi.h"
 #include "esp_event.h"
 #include "lwip/netif.h" // Para netif_set_addr
+#include <stddef.h>
 #include <string.h>
 
 /* ========================================================================== */
@@ -23,6 +24,16 @@
 /** Tag para logging */
 static const char *TAG = "WiFiManager";
 
+/** Parámetros comunes del escaneo síncrono y del asíncrono */
+static const wifi_scan_config_t wifi_manager_scan_config = {
+	.ssid = NULL,
+	.bssid = NULL,
+	.channel = 0,
+	.show_hidden = false,
+	.scan_type = WIFI_SCAN_TYPE_ACTIVE,
+	.scan_time.active.min = 100,
+	.scan_time.active.max = 300};
+
 /* ========================================================================== */
 /*                       PROTOTIPOS FUNCIONES PRIVADAS                        */
 /* ========================================================================== */
@@ -30,6 +41,8 @@ static const char *TAG = "WiFiManager";
 static error_t wifi_manager_init_sta_interface(WifiManagerContext_t *context);
 static error_t wifi_manager_init_ap_interface(WifiManagerContext_t *context);
 // static error_t wifi_manager_start_wifi(WifiManagerContext_t *context); // Eliminar si no se usa o mover
+static error_t wifi_manager_check_scan_mode(void);
+static error_t wifi_manager_store_scan_results(WifiManagerContext_t *context);
 static void wifi_manager_copy_str(char *dest, uint32_t dest_len,
 								  const char *src);
 static void wifi_manager_event_handler(void *arg, esp_event_base_t event_base,
@@ -37,6 +50,11 @@ static void wifi_manager_event_handler(void *arg, esp_event_base_t event_base,
 // static wifi_mode_t esp_wifi_mode_to_wifi_mode_t(wifi_mode_t esp_mode); // Eliminar
 static esp_err_t wifi_manager_apply_sta_config(WifiManagerContext_t *context);
 static esp_err_t wifi_manager_apply_ap_config(WifiManagerContext_t *context);
+static void wifi_manager_link_change_callback(NetInterface *interface,
+											 bool_t link_state, void *param);
+static void wifi_manager_dhcp_state_callback(DhcpClientContext *dhcp_context,
+											 NetInterface *interface,
+											 DhcpState state);
 
 /* ========================================================================== */
 /*                       IMPLEMENTACIÓN FUNCIONES PÚBLICAS                    */
@@ -79,6 +97,10 @@ error_t WifiManager_SetConfig(WifiManagerContext_t *context,
 
 	context->config_set = true;
 
+	// Invalidar las respuestas construidas con la configuración anterior
+	context->config_version++;
+	context->status_version++;
+
 	return NO_ERROR;
 }
 
@@ -206,15 +228,15 @@ error_t WifiManager_SetOperatingMode(WifiManagerContext_t *context, wm_wifi_mode
 	}
 
 	context->config.current_mode = mode; // Actualizar el modo en la configuración
+	context->config_version++;
+	context->status_version++;
 	return NO_ERROR;
 }
 
 error_t WifiManager_ScanNetworks(WifiManagerContext_t *context)
 {
 	esp_err_t ret;
-	uint16_t ap_count = 0;
-	uint16_t ap_num = MAX_SCANNED_NETWORKS;
-	wifi_ap_record_t ap_records[MAX_SCANNED_NETWORKS];
+	error_t error;
 
 	if (context == NULL)
 	{
@@ -224,93 +246,59 @@ error_t WifiManager_ScanNetworks(WifiManagerContext_t *context)
 	ESP_LOGI(TAG, "Iniciando escaneo de redes WiFi...");
 	context->scanned_networks_count = 0;
 
-	// Verificar modo WiFi actual
-	wifi_mode_t current_mode;
-	ret = esp_wifi_get_mode(&current_mode);
-	if (ret != ESP_OK)
-	{
-		ESP_LOGE(TAG, "Error obteniendo modo WiFi: 0x%x", ret);
-		return ERROR_FAILURE;
-	}
-	ESP_LOGI(TAG, "Modo WiFi actual: %d", current_mode);
-
-	// El escaneo solo funciona en modo STA o APSTA
-	if (current_mode == WIFI_MODE_NULL || current_mode == WIFI_MODE_AP)
+	error = wifi_manager_check_scan_mode();
+	if (error != NO_ERROR)
 	{
-		ESP_LOGW(TAG, "WiFi debe estar en modo STA o APSTA para escanear. Modo actual: %d", current_mode);
-		return ERROR_INVALID_REQUEST;
+		return error;
 	}
 
-	// Configurar escaneo
-	wifi_scan_config_t scan_config = {
-		.ssid = NULL,
-		.bssid = NULL,
-		.channel = 0,
-		.show_hidden = false,
-		.scan_type = WIFI_SCAN_TYPE_ACTIVE,
-		.scan_time.active.min = 100,
-		.scan_time.active.max = 300};
-
 	// Iniciar escaneo síncrono (true = bloquea hasta completar)
-	ret = esp_wifi_scan_start(&scan_config, true);
+	ret = esp_wifi_scan_start(&wifi_manager_scan_config, true);
 	if (ret != ESP_OK)
 	{
 		ESP_LOGE(TAG, "Error al iniciar escaneo: 0x%x (%s)", ret, esp_err_to_name(ret));
 		return ERROR_FAILURE;
 	}
 
-	// Primero obtener número de APs encontrados
-	ret = esp_wifi_scan_get_ap_num(&ap_count);
-	if (ret != ESP_OK)
-	{
-		ESP_LOGE(TAG, "Error obteniendo número de APs: 0x%x", ret);
-		return ERROR_FAILURE;
-	}
+	return wifi_manager_store_scan_results(context);
+}
 
-	ESP_LOGI(TAG, "Encontrados %d APs", ap_count);
+error_t WifiManager_StartScan(WifiManagerContext_t *context)
+{
+	esp_err_t ret;
+	error_t error;
 
-	if (ap_count == 0)
+	if (context == NULL)
 	{
-		ESP_LOGW(TAG, "No se encontraron redes WiFi");
-		context->scanned_networks_count = 0;
-		return NO_ERROR;
+		return ERROR_INVALID_PARAMETER;
 	}
 
-	// Limitar al máximo de redes
-	if (ap_count > MAX_SCANNED_NETWORKS)
+	// Los resultados del escaneo en curso servirán también para esta petición
+	if (context->scan_in_progress)
 	{
-		ap_count = MAX_SCANNED_NETWORKS;
+		return NO_ERROR;
 	}
 
-	// Obtener registros de APs
-	ap_num = ap_count;
-	ret = esp_wifi_scan_get_ap_records(&ap_num, ap_records);
-	if (ret != ESP_OK)
+	error = wifi_manager_check_scan_mode();
+	if (error != NO_ERROR)
 	{
-		ESP_LOGE(TAG, "Error al obtener AP records: 0x%x (%s)", ret, esp_err_to_name(ret));
-		return ERROR_FAILURE;
+		return error;
 	}
 
-	ESP_LOGI(TAG, "Obtenidos %d AP records", ap_num);
+	ESP_LOGI(TAG, "Iniciando escaneo asíncrono de redes WiFi...");
 
-	// Copiar datos al contexto
-	for (uint16_t i = 0; i < ap_num; i++)
+	// WIFI_EVENT_SCAN_DONE puede llegar antes de que vuelva esp_wifi_scan_start()
+	context->scan_in_progress = true;
+
+	// Iniciar escaneo asíncrono (false = termina con WIFI_EVENT_SCAN_DONE)
+	ret = esp_wifi_scan_start(&wifi_manager_scan_config, false);
+	if (ret != ESP_OK)
 	{
-		wifi_manager_copy_str(context->scanned_networks[i].ssid,
-							  WIFI_MANAGER_SSID_MAX_LEN,
-							  (const char *)ap_records[i].ssid);
-		context->scanned_networks[i].rssi = ap_records[i].rssi;
-		context->scanned_networks[i].authmode = ap_records[i].authmode;
-		ESP_LOGI(TAG, "[%d] SSID: %s, RSSI: %d, Auth: %d",
-				 i,
-				 context->scanned_networks[i].ssid,
-				 context->scanned_networks[i].rssi,
-				 context->scanned_networks[i].authmode);
+		context->scan_in_progress = false;
+		ESP_LOGE(TAG, "Error al iniciar escaneo: 0x%x (%s)", ret, esp_err_to_name(ret));
+		return ERROR_FAILURE;
 	}
 
-	context->scanned_networks_count = ap_num;
-	ESP_LOGI(TAG, "Escaneo completado: %d redes encontradas", context->scanned_networks_count);
-
 	return NO_ERROR;
 }
 
@@ -344,10 +332,15 @@ static error_t wifi_manager_init_sta_interface(WifiManagerContext_t *context)
 		return error;
 	}
 
+	// El estado publicado por la API cambia con el enlace
+	netAttachLinkChangeCallback(interface, wifi_manager_link_change_callback,
+								context);
+
 	// Inicializar cliente DHCP para la interfaz STA
 	dhcpClientGetDefaultSettings(&context->dhcp_client_settings);
 	context->dhcp_client_settings.interface = interface;
 	context->dhcp_client_settings.ipAddrIndex = 0;
+	context->dhcp_client_settings.stateChangeEvent = wifi_manager_dhcp_state_callback;
 
 	error = dhcpClientInit(&context->dhcp_client_ctx, &context->dhcp_client_settings);
 	if (error)
@@ -518,6 +511,92 @@ static error_t wifi_manager_start_wifi(WifiManagerContext_t *context)
 }
 #endif
 
+static error_t wifi_manager_check_scan_mode(void)
+{
+	esp_err_t ret;
+	wifi_mode_t current_mode;
+
+	// Verificar modo WiFi actual
+	ret = esp_wifi_get_mode(&current_mode);
+	if (ret != ESP_OK)
+	{
+		ESP_LOGE(TAG, "Error obteniendo modo WiFi: 0x%x", ret);
+		return ERROR_FAILURE;
+	}
+	ESP_LOGI(TAG, "Modo WiFi actual: %d", current_mode);
+
+	// El escaneo solo funciona en modo STA o APSTA
+	if (current_mode == WIFI_MODE_NULL || current_mode == WIFI_MODE_AP)
+	{
+		ESP_LOGW(TAG, "WiFi debe estar en modo STA o APSTA para escanear. Modo actual: %d", current_mode);
+		return ERROR_INVALID_REQUEST;
+	}
+
+	return NO_ERROR;
+}
+
+static error_t wifi_manager_store_scan_results(WifiManagerContext_t *context)
+{
+	esp_err_t ret;
+	uint16_t ap_count = 0;
+	uint16_t ap_num = MAX_SCANNED_NETWORKS;
+	wifi_ap_record_t ap_records[MAX_SCANNED_NETWORKS];
+
+	// Primero obtener número de APs encontrados
+	ret = esp_wifi_scan_get_ap_num(&ap_count);
+	if (ret != ESP_OK)
+	{
+		ESP_LOGE(TAG, "Error obteniendo número de APs: 0x%x", ret);
+		return ERROR_FAILURE;
+	}
+
+	ESP_LOGI(TAG, "Encontrados %d APs", ap_count);
+
+	if (ap_count == 0)
+	{
+		ESP_LOGW(TAG, "No se encontraron redes WiFi");
+		context->scanned_networks_count = 0;
+		return NO_ERROR;
+	}
+
+	// Limitar al máximo de redes
+	if (ap_count > MAX_SCANNED_NETWORKS)
+	{
+		ap_count = MAX_SCANNED_NETWORKS;
+	}
+
+	// Obtener registros de APs
+	ap_num = ap_count;
+	ret = esp_wifi_scan_get_ap_records(&ap_num, ap_records);
+	if (ret != ESP_OK)
+	{
+		ESP_LOGE(TAG, "Error al obtener AP records: 0x%x (%s)", ret, esp_err_to_name(ret));
+		return ERROR_FAILURE;
+	}
+
+	ESP_LOGI(TAG, "Obtenidos %d AP records", ap_num);
+
+	// Copiar datos al contexto
+	for (uint16_t i = 0; i < ap_num; i++)
+	{
+		wifi_manager_copy_str(context->scanned_networks[i].ssid,
+							  WIFI_MANAGER_SSID_MAX_LEN,
+							  (const char *)ap_records[i].ssid);
+		context->scanned_networks[i].rssi = ap_records[i].rssi;
+		context->scanned_networks[i].authmode = ap_records[i].authmode;
+		ESP_LOGI(TAG, "[%d] SSID: %s, RSSI: %d, Auth: %d",
+				 i,
+				 context->scanned_networks[i].ssid,
+				 context->scanned_networks[i].rssi,
+				 context->scanned_networks[i].authmode);
+	}
+
+	context->scanned_networks_count = ap_num;
+	ESP_LOGI(TAG, "Escaneo completado: %d redes encontradas", context->scanned_networks_count);
+
+	return NO_ERROR;
+}
+
 static void wifi_manager_copy_str(char *dest, uint32_t dest_len,
 								  const char *src)
 {
@@ -571,4 +650,44 @@ static void wifi_manager_event_handler(void *arg, esp_event_base_t event_base,
 	{
 		ESP_LOGI(TAG, "Cliente desconectado del AP");
 	}
+	else if (event_id == WIFI_EVENT_SCAN_DONE)
+	{
+		// Solo escaneos de WifiManager_StartScan(): el síncrono lee los
+		// resultados él mismo
+		if (context->scan_in_progress)
+		{
+			if (wifi_manager_store_scan_results(context) != NO_ERROR)
+			{
+				context->scanned_networks_count = 0;
+			}
+			context->scan_timestamp = osGetSystemTime();
+			context->scan_version++;
+			context->scan_in_progress = false;
+		}
+	}
+}
+
+static void wifi_manager_link_change_callback(NetInterface *interface,
+											 bool_t link_state, void *param)
+{
+	WifiManagerContext_t *context = (WifiManagerContext_t *)param;
+	(void)interface;
+	(void)link_state;
+
+	// linkState ya está actualizado: invalidar el estado cacheado
+	context->status_version++;
+}
+
+static void wifi_manager_dhcp_state_callback(DhcpClientContext *dhcp_context,
+											 NetInterface *interface,
+											 DhcpState state)
+{
+	// El cliente DHCP está embebido en el contexto del gestor
+	WifiManagerContext_t *context = (WifiManagerContext_t *)(
+		(uint8_t *)dhcp_context - offsetof(WifiManagerContext_t, dhcp_client_ctx));
+	(void)interface;
+	(void)state;
+
+	// La dirección IP de la STA puede haber cambiado
+	context->status_version++;
 }
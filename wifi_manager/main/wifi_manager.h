@@ -105,6 +105,13 @@ typedef struct
     // Resultados del último escaneo
     scanned_network_t scanned_networks[MAX_SCANNED_NETWORKS];
     uint8_t scanned_networks_count;
+    volatile bool scan_in_progress;   /**< Escaneo asíncrono en curso */
+    volatile uint32_t scan_version;   /**< Cambia al terminar cada escaneo asíncrono */
+    volatile systime_t scan_timestamp; /**< Fin del último escaneo asíncrono */
+
+    /* Versiones de los datos expuestos por la API (cache de respuestas) */
+    volatile uint32_t config_version; /**< Cambia con cada nueva configuración */
+    volatile uint32_t status_version; /**< Cambia con el enlace, DHCP o la configuración */
 } WifiManagerContext_t;
 
 /* ========================================================================== */
@@ -149,6 +156,16 @@ error_t WifiManager_SetOperatingMode(WifiManagerContext_t *context, wm_wifi_mode
  */
 error_t WifiManager_ScanNetworks(WifiManagerContext_t *context);
 
+/**
+ * @brief Inicia un escaneo de redes WiFi sin bloquear.
+ * @details Los resultados se copian en scanned_networks al recibir
+ * WIFI_EVENT_SCAN_DONE; entonces scan_in_progress vuelve a false y
+ * scan_version cambia. No hace nada si ya hay un escaneo en curso.
+ * @param[in,out] context Contexto del gestor WiFi
+ * @return error_t NO_ERROR si el escaneo está en curso
+ */
+error_t WifiManager_StartScan(WifiManagerContext_t *context);
+
 #ifdef __cplusplus
 }
 #endif
@@ -20,24 +20,127 @@
 # python pack_rc.py web_root compressed build/no_gzip.c -n -m 512000
 # Se usará web_root como origen, sin compresión, y el tamaño máximo será de 512000 bytes.
 
+# Por defecto cada archivo se guarda junto con sus variantes gzip y brotli
+# (si están instaladas las bindings 'brotli' de Python) y el servidor elige
+# la mejor según Accept-Encoding. La carpeta 'compressed' solo se utiliza
+# con --no-index, que genera imágenes con archivos .gz para lectores antiguos.
+
+# Imagen para las particiones de recursos (RES_PARTITION_SUPPORT):
+
+# Bash
+
+# python pack.py dist resources res.bin --partition
+# esptool.py write_flash 0x110000 res.bin
+
 import os
 import sys
 import struct
 import gzip
+import zlib
+import json
+import re
+import hashlib
 import argparse
 
+try:
+    import brotli
+except ImportError:
+    brotli = None
+
 RES_TYPE_DIR = 1
 RES_TYPE_FILE = 2
 
 TRESENTRY_BASE_SIZE = 1 + 4 + 4 + 1
 TRESHEADER_SIZE = 4 + TRESENTRY_BASE_SIZE
 
+# Índice de rutas (tabla hash almacenada como archivo oculto en la raíz)
+RES_INDEX_NAME = '.resindex'
+RES_INDEX_MAGIC = 0x32444952
+RES_INDEX_HEADER_SIZE = 4 + 4 + 4
+RES_INDEX_BUCKET_SIZE = 4 + 4 + 4 + 4 + 8 + 4
+
+# Tabla de tipos MIME del servidor (el identificador es la posición + 1)
+MIME_TABLE_FILE = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                               'main', 'cyclone_tcp', 'http', 'mime.c')
+
+# Hash de contenido (SHA-256 truncado) usado como ETag y huella de archivo
+RES_DIGEST_SIZE = 8
+
+# Cabecera de partición de recursos (debe coincidir con ResPartitionHeader)
+RES_PARTITION_MAGIC = 0x50534552
+RES_PARTITION_VERSION = 1
+RES_PARTITION_HEADER_SIZE = 4 + 2 + 2 + 4 + 4 + 4 + 4
+
+# Variantes precomprimidas (deben coincidir con ResEncoding)
+RES_ENCODING_GZIP = 1
+RES_ENCODING_BROTLI = 2
+RES_VARIANT_SIZE = 1 + 4 + 4
+
 def align4(x):
     return ((x + 3) // 4) * 4
 
+def normalize_path(path):
+    # Misma normalización que resource_manager.c: minúsculas ASCII (bytes.lower
+    # no toca los caracteres UTF-8), '/' como separador y sin separadores
+    # iniciales ni repetidos
+    parts = [p for p in path.replace('\\', '/').split('/') if p]
+    return '/'.join(parts).encode('utf-8').lower()
+
+def fnv1a(data):
+    h = 2166136261
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+def load_mime_table(path):
+    # Lee las posiciones de la tabla hash perfecta de mime.c
+    try:
+        with open(path, 'r', encoding='utf-8') as f:
+            source = f.read()
+    except OSError:
+        print(f"Aviso: no se encuentra '{path}', no se guardarán tipos MIME en el índice.")
+        return {}
+    table = source[source.find('mimeTypeTable['):]
+    return {ext.lower(): int(slot) + 1
+            for slot, ext in re.findall(r'\[(\d+)\]\s*=\s*\{"(\.[^"]+)"', table)}
+
+def mime_id(path, mime_table):
+    # Identificador del tipo MIME según la extensión (0 si es desconocida)
+    name = path.decode('utf-8').rsplit('/', 1)[-1]
+    ext = name[name.rfind('.'):] if '.' in name else ''
+    return mime_table.get(ext, 0)
+
+def content_digest(data):
+    return hashlib.sha256(data).digest()[:RES_DIGEST_SIZE]
+
+def fingerprint_path(path, digest):
+    # nombre.ext -> nombre.<huella>.ext
+    head, tail = os.path.split(path)
+    base, ext = os.path.splitext(tail)
+    return os.path.join(head, f"{base}.{digest.hex()}{ext}").replace(os.sep, '/')
+
+def compress_variants(data):
+    # Nivel máximo de compresión; solo se conservan las variantes que
+    # ocupan menos que el original, ordenadas de menor a mayor tamaño
+    variants = [(RES_ENCODING_GZIP, gzip.compress(data, compresslevel=9, mtime=0))]
+    if brotli is not None:
+        variants.append((RES_ENCODING_BROTLI, brotli.compress(data, quality=11)))
+    variants = [v for v in variants if len(v[1]) < len(data)]
+    return sorted(variants, key=lambda v: len(v[1]))
+
 class ResourceCompiler:
-    def __init__(self, max_size=1024*1024):
+    def __init__(self, max_size=1024*1024, index=True, compress=False, mime_table=None):
         self.max_size = max_size
+        self.mime_table = mime_table or {}
+        self.index = index
+        self.compress = compress
+        self.variants = {}
+        self.manifest = {}
+        self.root = None
+        self.index_files = []
+        self.index_offset = 0
+        self.index_size = 0
+        self.bucket_count = 0
         self.buf = bytearray(max_size)
         self.total_size = TRESHEADER_SIZE
         self._write_u32(0, self.total_size)
@@ -79,6 +182,79 @@ class ResourceCompiler:
             print(f"[FILE]    {filename}    ({length} bytes)")
             return offset, length
 
+    def prepare_index(self, root):
+        # Dimensiona el índice antes de generar el árbol, ya que su espacio
+        # se reserva dentro del directorio raíz
+        self.root = root
+        paths = []
+        for dirpath, dirnames, filenames in os.walk(root):
+            for filename in filenames:
+                relative_path = os.path.relpath(os.path.join(dirpath, filename), root)
+                if relative_path != RES_INDEX_NAME:
+                    paths.append(normalize_path(relative_path))
+                    if self.compress:
+                        with open(os.path.join(dirpath, filename), 'rb') as f:
+                            self.variants[paths[-1]] = compress_variants(f.read())
+
+        # Factor de carga máximo del 50% para resolver casi siempre en un acceso
+        self.bucket_count = 1
+        while self.bucket_count < 2 * len(paths):
+            self.bucket_count *= 2
+
+        self.index_size = RES_INDEX_HEADER_SIZE + self.bucket_count * RES_INDEX_BUCKET_SIZE
+        self.index_size += sum(len(p) + 1 for p in paths)
+        self.index_size += sum(1 + len(v) * RES_VARIANT_SIZE
+                               for v in self.variants.values() if v)
+
+    def write_index(self):
+        off = self.index_offset
+        self._write_u32(off + 0, RES_INDEX_MAGIC)
+        self._write_u32(off + 4, self.bucket_count)
+        self._write_u32(off + 8, len(self.index_files))
+
+        buckets = off + RES_INDEX_HEADER_SIZE
+        pool = buckets + self.bucket_count * RES_INDEX_BUCKET_SIZE
+        probes = 0
+
+        for path, entry_offset, variants, digest in self.index_files:
+            h = fnv1a(path)
+            i = h & (self.bucket_count - 1)
+            while struct.unpack_from('<I', self.buf, buckets + i * RES_INDEX_BUCKET_SIZE + 4)[0] != 0:
+                i = (i + 1) & (self.bucket_count - 1)
+                probes += 1
+            bucket = buckets + i * RES_INDEX_BUCKET_SIZE
+            self._write_u32(bucket + 0, h)
+            self._write_u32(bucket + 4, entry_offset)
+            self._write_u32(bucket + 8, pool)
+            self._write_bytes(bucket + 16, digest)
+            self._write_u8(bucket + 24, mime_id(path, self.mime_table))
+            self._write_bytes(pool, path + b'\0')
+            pool += len(path) + 1
+            if variants:
+                self._write_u32(bucket + 12, pool)
+                self._write_u8(pool, len(variants))
+                pool += 1
+                for encoding, data_offset, data_length in variants:
+                    self._write_u8(pool, encoding)
+                    self._write_u32(pool + 1, data_offset)
+                    self._write_u32(pool + 5, data_length)
+                    pool += RES_VARIANT_SIZE
+
+        print(f"[INDEX]   {len(self.index_files)} files, {self.bucket_count} buckets, {probes} extra probes")
+
+    def add_variants(self, path):
+        # Las variantes se almacenan a continuación del archivo original
+        placed = []
+        for encoding, data in self.variants.get(path, []):
+            self.total_size = align4(self.total_size)
+            self._ensure_space(len(data))
+            self._write_bytes(self.total_size, data)
+            placed.append((encoding, self.total_size, len(data)))
+            self.total_size += len(data)
+            name = 'gzip' if encoding == RES_ENCODING_GZIP else 'br'
+            print(f"[{name.upper()}]{' ' * (8 - len(name))}{path.decode('utf-8')}    ({len(data)} bytes)")
+        return placed
+
     def add_directory(self, parentOffset, parentSize, directory):
         pos = self.total_size
         i = pos
@@ -97,10 +273,23 @@ class ResourceCompiler:
             i += TRESENTRY_BASE_SIZE + 2
             dir_length += TRESENTRY_BASE_SIZE + 2
 
+        is_root = self.index and directory == self.root
         entries = sorted(os.listdir(directory))
+
+        if is_root:
+            # El índice se coloca al principio para localizarlo enseguida
+            entries = [RES_INDEX_NAME] + [e for e in entries if e != RES_INDEX_NAME]
+
         for name in entries:
             if name in ('.', '..'):
                 continue
+            if is_root and name == RES_INDEX_NAME:
+                name_bytes = name.encode('utf-8')
+                self._ensure_space(TRESENTRY_BASE_SIZE + len(name_bytes))
+                self._write_entry(i, RES_TYPE_FILE, 0, 0, name_bytes)
+                i += TRESENTRY_BASE_SIZE + len(name_bytes)
+                dir_length += TRESENTRY_BASE_SIZE + len(name_bytes)
+                continue
             fullpath = os.path.join(directory, name)
             entry_type = RES_TYPE_DIR if os.path.isdir(fullpath) else RES_TYPE_FILE
             name_bytes = name.encode('utf-8')
@@ -134,12 +323,24 @@ class ResourceCompiler:
 
                 self._write_u32(read_ptr + 1, self.total_size)
                 fullpath = os.path.join(directory, name)
-                if type_ == RES_TYPE_DIR:
+                if is_root and name == RES_INDEX_NAME:
+                    self._ensure_space(self.index_size)
+                    self.index_offset = self.total_size
+                    self.total_size += self.index_size
+                    self._write_u32(read_ptr + 5, self.index_size)
+                elif type_ == RES_TYPE_DIR:
                     sub_offset, sub_len = self.add_directory(pos, dir_length, fullpath)
                     self._write_u32(read_ptr + 5, sub_len)
                 else:
                     off, length = self.add_file_contents(fullpath)
                     self._write_u32(read_ptr + 5, length)
+                    if self.index:
+                        relative_path = os.path.relpath(fullpath, self.root)
+                        digest = content_digest(bytes(self.buf[off:off + length]))
+                        self.manifest[relative_path.replace(os.sep, '/')] = fingerprint_path(relative_path, digest)
+                        relative_path = normalize_path(relative_path)
+                        variants = self.add_variants(relative_path)
+                        self.index_files.append((relative_path, read_ptr, variants, digest))
 
             step = TRESENTRY_BASE_SIZE + nameLength
             remaining -= step
@@ -147,14 +348,23 @@ class ResourceCompiler:
 
         return pos, dir_length
 
-    def finalize_and_write(self, dest_file):
+    def partition_header(self, sequence):
+        image = bytes(self.buf[:self.total_size])
+        header = struct.pack('<IHHIII', RES_PARTITION_MAGIC, RES_PARTITION_VERSION,
+                             RES_PARTITION_HEADER_SIZE, self.total_size,
+                             zlib.crc32(image), sequence)
+        # El CRC de la cabecera cubre todos los campos anteriores
+        return header + struct.pack('<I', zlib.crc32(header))
+
+    def finalize_and_write(self, dest_file, partition=False, sequence=1):
         self._write_u32(0, self.total_size)
         ext = os.path.splitext(dest_file)[1].lower()
         if ext in ('.c', '.h'):
             os.makedirs(os.path.dirname(dest_file) or '.', exist_ok=True)
             base = os.path.splitext(os.path.basename(dest_file))[0]
             with open(dest_file, 'w', newline='\n') as f:
-                f.write(f"#include \"tcs_xxx_config.h\"\n\r#include <stdint.h>\n\r\n\rEXTFLASH_MEM_ATTRIBUTE const uint8_t {base}[] =\n{{\n")
+                # Mismo formato que el res.c enlazado por main/CMakeLists.txt
+                f.write(f"#include <stdint.h>\n\nconst uint8_t {base}[] =\n{{\n")
                 for i in range(self.total_size):
                     if (i % 16) == 0:
                         f.write("    ")
@@ -169,6 +379,9 @@ class ResourceCompiler:
         else:
             os.makedirs(os.path.dirname(dest_file) or '.', exist_ok=True)
             with open(dest_file, 'wb') as f:
+                # Imagen lista para grabar en la partición res_a/res_b
+                if partition:
+                    f.write(self.partition_header(sequence))
                 f.write(self.buf[:self.total_size])
 
 def compress_files(input_dir, output_dir):
@@ -217,22 +430,49 @@ def main():
                         help="Carpeta raíz de los archivos originales (por defecto: 'dist').")
     
     parser.add_argument('compressed_dir', type=str, nargs='?', default='resources',
-                        help="Carpeta donde se guardarán los archivos comprimidos (por defecto: 'resources').")
+                        help="Carpeta donde se guardarán los archivos .gz con --no-index (por defecto: 'resources').")
                         
     parser.add_argument('output_file', type=str, nargs='?', default='res.c',
                         help="Ruta del archivo de salida .c (por defecto: 'res.c').")
     
     parser.add_argument('-n', '--no-compress', action='store_true',
-                        help="No comprimir los archivos, utilizar la carpeta de entrada directamente.")
+                        help="No generar variantes comprimidas (gzip/brotli) de los archivos.")
+
+    parser.add_argument('--no-index', action='store_true',
+                        help="No generar el índice de rutas (imagen compatible con versiones anteriores).")
+
+    parser.add_argument('--manifest', type=str, default=None,
+                        help="Archivo JSON con la ruta con huella de cada recurso (p. ej. app.js -> app.<hash>.js). "
+                             "Las rutas con huella se sirven con Cache-Control: immutable.")
+
+    parser.add_argument('--partition', action='store_true',
+                        help="Genera un binario para las particiones res_a/res_b (salida .bin con cabecera "
+                             "ResPartitionHeader). Se graba con esptool o se envía a POST /api/resources.")
+
+    parser.add_argument('--sequence', type=int, default=1,
+                        help="Número de secuencia de la imagen con --partition; gana la partición con el mayor "
+                             "(por defecto: 1).")
+
+    parser.add_argument('--mime-table', type=str, default=MIME_TABLE_FILE,
+                        help="Archivo mime.c del que se toman los identificadores de tipo MIME "
+                             "guardados en el índice (por defecto: el del proyecto).")
 
     parser.add_argument('-m', '--maxsize', type=int, default=1024*1024,
                         help="Tamaño máximo del archivo de salida en bytes (por defecto: 1048576).")
 
     args = parser.parse_args()
 
+    if args.partition and os.path.splitext(args.output_file)[1].lower() in ('.c', '.h'):
+        print("Error: --partition requiere un archivo de salida binario (p. ej. res.bin).")
+        return 1
+
     source_dir_for_compiler = args.input_dir
 
-    if not args.no_compress:
+    if not args.no_index:
+        # Las variantes comprimidas se incluyen en la imagen junto al original
+        if not args.no_compress and brotli is None:
+            print("Aviso: módulo 'brotli' no disponible, solo se generarán variantes gzip.")
+    elif not args.no_compress:
         if compress_files(args.input_dir, args.compressed_dir):
             source_dir_for_compiler = args.compressed_dir
     else:
@@ -242,12 +482,22 @@ def main():
         print(f"Error: El directorio de origen para la compilación '{source_dir_for_compiler}' no existe.")
         return 1
 
-    rc = ResourceCompiler(max_size=args.maxsize)
+    rc = ResourceCompiler(max_size=args.maxsize, index=not args.no_index,
+                          compress=not args.no_index and not args.no_compress,
+                          mime_table=load_mime_table(args.mime_table) if not args.no_index else None)
     try:
         path = os.path.abspath(source_dir_for_compiler)
+        if rc.index:
+            rc.prepare_index(path)
         pos, length = rc.add_directory(0, 0, path)
         rc._write_u32(4 + 5, length)
-        rc.finalize_and_write(args.output_file)
+        if rc.index:
+            rc.write_index()
+            if args.manifest:
+                with open(args.manifest, 'w', newline='\n') as f:
+                    json.dump(rc.manifest, f, indent=2, sort_keys=True)
+        rc.finalize_and_write(args.output_file, partition=args.partition,
+                              sequence=args.sequence & 0xFFFFFFFF)
     except MemoryError as e:
         print("Error:", e)
         return 1